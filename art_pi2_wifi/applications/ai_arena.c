@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Per-interaction arena allocator
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include "ai_arena.h"
+#include "memory_helper.h"
+
+#define DBG_TAG "ai.arena"
+#define DBG_LVL DBG_INFO
+#include <rtdbg.h>
+
+#define AI_ARENA_MAGIC          0xA7E4B10CU
+#define AI_ARENA_ROUND(size)    (((size) + AI_ARENA_ALIGN - 1) & ~(uint32_t)(AI_ARENA_ALIGN - 1))
+
+/* 块头：记录块大小，realloc需要知道原数据长度 */
+typedef struct {
+    uint32_t size;
+    uint32_t magic;
+} ai_arena_block_t;
+
+static struct {
+    uint8_t *base;
+    uint32_t size;
+    uint32_t used;
+    uint32_t peak;
+    uint32_t live;
+    uint32_t depth;             /* begin/end 嵌套层数，大于0时从内存池分配 */
+    uint32_t allocs;
+    uint32_t fallbacks;
+    uint32_t resets;
+    uint32_t deferred;
+    const char *backing;
+} ai_arena;
+
+/* 以下 _locked 函数在 rt_enter_critical 中调用，不能打印日志 */
+static void ai_arena_reset_locked(void)
+{
+    if (ai_arena.used > 0)
+    {
+        ai_arena.resets++;
+    }
+    ai_arena.used = 0;
+}
+
+static void *ai_arena_alloc_locked(uint32_t size)
+{
+    ai_arena_block_t *block;
+    uint32_t need = sizeof(ai_arena_block_t) + AI_ARENA_ROUND(size);
+
+    if (ai_arena.depth == 0 || ai_arena.base == RT_NULL)
+    {
+        return RT_NULL;
+    }
+    if (need < size || ai_arena.size - ai_arena.used < need)
+    {
+        ai_arena.fallbacks++;
+        return RT_NULL;
+    }
+
+    block = (ai_arena_block_t *)(ai_arena.base + ai_arena.used);
+    block->size = need - sizeof(ai_arena_block_t);
+    block->magic = AI_ARENA_MAGIC;
+
+    ai_arena.used += need;
+    if (ai_arena.used > ai_arena.peak)
+    {
+        ai_arena.peak = ai_arena.used;
+    }
+    ai_arena.live++;
+    ai_arena.allocs++;
+
+    return block + 1;
+}
+
+static void ai_arena_free_locked(void *ptr)
+{
+    ai_arena_block_t *block = (ai_arena_block_t *)ptr - 1;
+
+    RT_ASSERT(block->magic == AI_ARENA_MAGIC);
+    block->magic = 0;
+
+    /* 释放的是最后切出的块（常见于失败路径和realloc搬移）则直接退回 */
+    if ((uint8_t *)ptr + block->size == ai_arena.base + ai_arena.used)
+    {
+        ai_arena.used = (uint32_t)((uint8_t *)block - ai_arena.base);
+    }
+
+    RT_ASSERT(ai_arena.live > 0);
+    ai_arena.live--;
+    if (ai_arena.live == 0)
+    {
+        /* 所有块都已释放：交互中途也可以从头复用，推迟的复位在这里完成 */
+        ai_arena_reset_locked();
+    }
+}
+
+int ai_arena_init(uint32_t size)
+{
+    void *mem;
+    uint32_t offset;
+
+    if (ai_arena.base != RT_NULL)
+    {
+        return RT_EOK;
+    }
+    if (size == 0)
+    {
+        size = AI_ARENA_SIZE;
+    }
+
+    mem = mem_class_alloc(MEM_CLASS_BULK, size);
+    if (mem == RT_NULL)
+    {
+        LOG_E("Failed to allocate arena (%d bytes)", size);
+        return -RT_ENOMEM;
+    }
+
+    offset = (uint32_t)(-(rt_ubase_t)mem & (AI_ARENA_ALIGN - 1));
+
+    rt_enter_critical();
+    ai_arena.base = (uint8_t *)mem + offset;
+    ai_arena.size = (size - offset) & ~(uint32_t)(AI_ARENA_ALIGN - 1);
+    ai_arena.used = 0;
+    ai_arena.backing = mem_class_of(mem) == MEM_CLASS_BULK ? "psram" : "sram";
+    rt_exit_critical();
+
+    LOG_I("Arena: %d KB in %s", ai_arena.size / 1024, ai_arena.backing);
+
+    return RT_EOK;
+}
+
+void ai_arena_begin(void)
+{
+    if (ai_arena.base == RT_NULL)
+    {
+        ai_arena_init(0);
+    }
+
+    rt_enter_critical();
+    ai_arena.depth++;
+    rt_exit_critical();
+}
+
+void ai_arena_end(void)
+{
+    uint32_t live = 0;
+
+    rt_enter_critical();
+    if (ai_arena.depth > 0 && --ai_arena.depth == 0)
+    {
+        if (ai_arena.live == 0)
+        {
+            ai_arena_reset_locked();
+        }
+        else
+        {
+            /* 被中止的阶段稍后才释放它们的数据，最后一块释放时复位 */
+            ai_arena.deferred++;
+            live = ai_arena.live;
+        }
+    }
+    rt_exit_critical();
+
+    if (live > 0)
+    {
+        LOG_W("Arena: %d blocks still in use, reset deferred", live);
+    }
+}
+
+rt_bool_t ai_arena_contains(const void *ptr)
+{
+    return ai_arena.base != RT_NULL &&
+           (const uint8_t *)ptr >= ai_arena.base &&
+           (const uint8_t *)ptr < ai_arena.base + ai_arena.size;
+}
+
+void *ai_arena_alloc(uint32_t size)
+{
+    void *ptr;
+    uint32_t fallbacks;
+
+    rt_enter_critical();
+    fallbacks = ai_arena.fallbacks;
+    ptr = ai_arena_alloc_locked(size);
+    fallbacks = ai_arena.fallbacks - fallbacks;
+    rt_exit_critical();
+
+    if (ptr == RT_NULL)
+    {
+        if (fallbacks)
+        {
+            LOG_W("Arena full, %d bytes from heap", size);
+        }
+        /* 交互之外的HTTP响应体、TTS音频等同样是大块数据，放在PSRAM */
+        ptr = mem_class_alloc(MEM_CLASS_BULK, size);
+    }
+
+    return ptr;
+}
+
+void *ai_arena_realloc(void *ptr, uint32_t size)
+{
+    ai_arena_block_t *block;
+    uint32_t old_size;
+    void *new_ptr;
+
+    if (ptr == RT_NULL)
+    {
+        return ai_arena_alloc(size);
+    }
+    if (size == 0)
+    {
+        ai_arena_free(ptr);
+        return RT_NULL;
+    }
+    if (!ai_arena_contains(ptr))
+    {
+        /* 交互之外分配的块在PSRAM堆中，不知道原来的长度，由所在的堆搬移 */
+        return mem_class_realloc(ptr, size);
+    }
+
+    block = (ai_arena_block_t *)ptr - 1;
+
+    rt_enter_critical();
+    RT_ASSERT(block->magic == AI_ARENA_MAGIC);
+    old_size = block->size;
+    if (size <= old_size)
+    {
+        rt_exit_critical();
+        return ptr;
+    }
+    /* 最后切出的块原地扩大：响应体、TTS音频的逐步增长都走这里 */
+    if ((uint8_t *)ptr + old_size == ai_arena.base + ai_arena.used &&
+        AI_ARENA_ROUND(size) >= size &&
+        ai_arena.size - ((uint8_t *)ptr - ai_arena.base) >= AI_ARENA_ROUND(size))
+    {
+        block->size = AI_ARENA_ROUND(size);
+        ai_arena.used = (uint32_t)((uint8_t *)ptr - ai_arena.base) + block->size;
+        if (ai_arena.used > ai_arena.peak)
+        {
+            ai_arena.peak = ai_arena.used;
+        }
+        rt_exit_critical();
+        return ptr;
+    }
+    rt_exit_critical();
+
+    new_ptr = ai_arena_alloc(size);
+    if (new_ptr == RT_NULL)
+    {
+        return RT_NULL;
+    }
+    rt_memcpy(new_ptr, ptr, old_size);
+    ai_arena_free(ptr);
+
+    return new_ptr;
+}
+
+char *ai_arena_strdup(const char *str)
+{
+    uint32_t len = rt_strlen(str) + 1;
+    char *copy = (char *)ai_arena_alloc(len);
+
+    if (copy != RT_NULL)
+    {
+        rt_memcpy(copy, str, len);
+    }
+
+    return copy;
+}
+
+void ai_arena_free(void *ptr)
+{
+    if (ptr == RT_NULL)
+    {
+        return;
+    }
+    if (!ai_arena_contains(ptr))
+    {
+        mem_class_free(ptr);
+        return;
+    }
+
+    rt_enter_critical();
+    ai_arena_free_locked(ptr);
+    rt_exit_critical();
+}
+
+void ai_arena_get_stats(ai_arena_stats_t *stats)
+{
+    rt_enter_critical();
+    stats->size = ai_arena.size;
+    stats->used = ai_arena.used;
+    stats->peak = ai_arena.peak;
+    stats->live = ai_arena.live;
+    stats->allocs = ai_arena.allocs;
+    stats->fallbacks = ai_arena.fallbacks;
+    stats->resets = ai_arena.resets;
+    stats->deferred = ai_arena.deferred;
+    rt_exit_critical();
+}
+
+#ifdef FINSH_USING_MSH
+#include <finsh.h>
+
+static int cmd_ai_arena(int argc, char **argv)
+{
+    ai_arena_stats_t stats;
+
+    if (ai_arena.base == RT_NULL && ai_arena_init(0) != RT_EOK)
+    {
+        return -1;
+    }
+    ai_arena_get_stats(&stats);
+
+    rt_kprintf("Arena (%s): %d KB, used %d, peak %d, live %d blocks\n",
+               ai_arena.backing, stats.size / 1024, stats.used, stats.peak, stats.live);
+    rt_kprintf("  allocs %d, heap fallbacks %d, resets %d, deferred %d\n",
+               stats.allocs, stats.fallbacks, stats.resets, stats.deferred);
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_ai_arena, ai_arena, Show per-interaction arena statistics);
+#endif
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Per-interaction arena allocator
+ */
+
+#ifndef __AI_ARENA_H__
+#define __AI_ARENA_H__
+
+/*
+ * 一次语音交互的临时内存池（bump分配）：
+ *   - ai_arena_begin() 到 ai_arena_end() 之间的分配从PSRAM中的一整块内存顺序切出，
+ *     HTTP请求头、接收缓冲区、响应体、JSON字段、识别文本、TTS音频都在这里，
+ *     交互结束时整体复位，不在系统堆里留下大小不一的空洞
+ *   - 交互之外或内存池用完时退回 mem_class_alloc(MEM_CLASS_BULK)（同样在PSRAM），
+ *     ai_arena_free 按地址区分，任何指针都可以交给它释放
+ *   - ai_arena_end() 时仍有未释放的块（被中止的流水线阶段稍后才释放）则推迟复位，
+ *     直到最后一块释放
+ *   - 多个线程（流水线各阶段）可以同时分配和释放
+ */
+
+#include <rtthread.h>
+
+/* 内存池默认大小，可在编译选项中定义覆盖 */
+#ifndef AI_ARENA_SIZE
+#define AI_ARENA_SIZE       (1024 * 1024)
+#endif
+
+/* 分配对齐 */
+#define AI_ARENA_ALIGN      8
+
+typedef struct {
+    uint32_t size;          /* 内存池大小，0表示未初始化 */
+    uint32_t used;          /* 当前已切出的字节数（含块头）*/
+    uint32_t peak;          /* 单次交互的最大用量 */
+    uint32_t live;          /* 未释放的块数 */
+    uint32_t allocs;        /* 从内存池分配的次数 */
+    uint32_t fallbacks;     /* 交互中内存池不足、退回PSRAM堆的次数 */
+    uint32_t resets;        /* 整体复位次数 */
+    uint32_t deferred;      /* 交互结束时仍有块未释放、推迟复位的次数 */
+} ai_arena_stats_t;
+
+/* 分配内存池，size为0时使用 AI_ARENA_SIZE；重复调用直接返回 */
+int ai_arena_init(uint32_t size);
+
+/* 开始/结束一次交互，可以嵌套，最外层结束时复位 */
+void ai_arena_begin(void);
+void ai_arena_end(void);
+
+/* 交互中从内存池分配，否则（或内存池不足时）从PSRAM堆分配 */
+void *ai_arena_alloc(uint32_t size);
+void *ai_arena_realloc(void *ptr, uint32_t size);
+char *ai_arena_strdup(const char *str);
+
+/* 释放 ai_arena_alloc/realloc/strdup、mem_class_alloc 或 rt_malloc 得到的指针 */
+void ai_arena_free(void *ptr);
+
+/* 指针是否位于内存池中 */
+rt_bool_t ai_arena_contains(const void *ptr);
+
+void ai_arena_get_stats(ai_arena_stats_t *stats);
+
+#endif /* __AI_ARENA_H__ */
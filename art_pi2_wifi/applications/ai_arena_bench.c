@@ -0,0 +1,586 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Arena soak test
+ */
+
+/*
+ * 内存池长时间运行测试：按一次语音交互的分配顺序模拟数千轮交互，比较两种做法下堆的碎片：
+ *   heap    交互中的临时分配和其他模块的长期分配都在同一个堆上（原做法）
+ *   arena   交互中的临时分配走 ai_arena，堆上只剩其他模块的长期分配
+ * 每轮依次模拟：STT（请求头、接收块、按Content-Length分配的响应体、识别文本），
+ * 对话（JSON请求、custom header、chunked逐步扩大的响应体、回复文本、分句），
+ * 逐句TTS（音频缓冲区倍增扩大，上一句播放完才释放）。
+ * 交互前和交互进行中穿插其他模块的长期小块分配，寿命随机，它们落在临时数据之间，
+ * 临时数据释放后留下空洞，这是长时间运行后大块分配失败的原因。
+ *
+ * 堆用私有的一块内存，碎片 = 1 - 最大空闲块 / 空闲总量；失败次数即
+ * "Failed to allocate receive buffer" 之类的错误在设备上出现的次数。
+ * 设备端用真实的 rt_memheap 管理这块内存；PC端用同样策略（首次适配、空闲块插到链表头、
+ * 前后合并、realloc优先向后扩展）的简化实现。
+ *
+ * 设备端：ai_arena_soak [轮数] [堆KB]
+ * PC端（与设备端同一份ai_arena.c）：
+ *   gcc -O2 -DAI_ARENA_BENCH_MAIN -I../host -I. ai_arena.c memory_helper.c ai_arena_bench.c -lpthread -o arena_soak
+ *   ./arena_soak 5000 256
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include "ai_arena.h"
+
+#define SOAK_SENTENCES_MAX  6
+#define SOAK_BACKGROUND     48      /* 同时存在的长期分配 */
+#define SOAK_REPORTS        5       /* 中途报告次数 */
+
+/* ==================== 私有堆 ==================== */
+
+#if defined(__RTTHREAD__) && defined(RT_USING_MEMHEAP)
+
+#define SOAK_ITEM_SIZE      RT_ALIGN(sizeof(struct rt_memheap_item), RT_ALIGN_SIZE)
+
+static struct rt_memheap soak_memheap;
+static void *soak_pool;
+
+static int soak_heap_init(uint32_t size)
+{
+    soak_pool = rt_malloc(size);
+    if (soak_pool == RT_NULL)
+    {
+        return -RT_ENOMEM;
+    }
+    return rt_memheap_init(&soak_memheap, "soak", soak_pool, size);
+}
+
+static void soak_heap_deinit(void)
+{
+    rt_memheap_detach(&soak_memheap);
+    rt_free(soak_pool);
+}
+
+static void *soak_heap_alloc(uint32_t size)
+{
+    return rt_memheap_alloc(&soak_memheap, size);
+}
+
+static void *soak_heap_realloc(void *ptr, uint32_t size)
+{
+    return rt_memheap_realloc(&soak_memheap, ptr, size);
+}
+
+static void soak_heap_free(void *ptr)
+{
+    if (ptr)
+    {
+        rt_memheap_free(ptr);
+    }
+}
+
+/* 遍历空闲链表：空闲总量和最大空闲块 */
+static void soak_heap_measure(uint32_t *free_bytes, uint32_t *largest)
+{
+    struct rt_memheap_item *item;
+
+    *free_bytes = 0;
+    *largest = 0;
+    for (item = soak_memheap.free_list->next_free; item != soak_memheap.free_list; item = item->next_free)
+    {
+        uint32_t size = (uint32_t)((rt_ubase_t)item->next - (rt_ubase_t)item - SOAK_ITEM_SIZE);
+
+        *free_bytes += size;
+        if (size > *largest)
+        {
+            *largest = size;
+        }
+    }
+}
+
+#else
+
+/* rt_memheap 的简化实现：块头之后是数据，块大小由物理上的下一块推出 */
+typedef struct soak_block {
+    struct soak_block *prev;
+    struct soak_block *next;
+    struct soak_block *prev_free;
+    struct soak_block *next_free;
+    uint32_t used;
+    uint32_t pad;
+} soak_block_t;
+
+#define SOAK_ALIGN(size)    (((size) + 7) & ~7U)
+#define SOAK_HDR            SOAK_ALIGN(sizeof(soak_block_t))
+#define SOAK_MIN_ALLOC      16
+#define SOAK_SIZE(b)        ((uint32_t)((uint8_t *)(b)->next - (uint8_t *)(b)) - SOAK_HDR)
+
+static struct {
+    uint8_t *pool;
+    soak_block_t free_head;     /* 空闲链表头 */
+} soak_heap;
+
+static void soak_free_insert(soak_block_t *b)
+{
+    b->next_free = soak_heap.free_head.next_free;
+    b->prev_free = &soak_heap.free_head;
+    soak_heap.free_head.next_free->prev_free = b;
+    soak_heap.free_head.next_free = b;
+}
+
+static void soak_free_remove(soak_block_t *b)
+{
+    b->prev_free->next_free = b->next_free;
+    b->next_free->prev_free = b->prev_free;
+}
+
+/* 块b保留size字节，剩余部分足够大时拆成新的空闲块 */
+static void soak_split(soak_block_t *b, uint32_t size)
+{
+    soak_block_t *rest;
+
+    if (SOAK_SIZE(b) < size + SOAK_HDR + SOAK_MIN_ALLOC)
+    {
+        return;
+    }
+    rest = (soak_block_t *)((uint8_t *)b + SOAK_HDR + size);
+    rest->used = 0;
+    rest->prev = b;
+    rest->next = b->next;
+    b->next->prev = rest;
+    b->next = rest;
+    if (!rest->next->used)
+    {
+        /* 与后面的空闲块合并 */
+        soak_block_t *next = rest->next;
+
+        soak_free_remove(next);
+        rest->next = next->next;
+        next->next->prev = rest;
+    }
+    soak_free_insert(rest);
+}
+
+static int soak_heap_init(uint32_t size)
+{
+    soak_block_t *first, *tail;
+
+    soak_heap.pool = (uint8_t *)rt_malloc(size);
+    if (soak_heap.pool == RT_NULL)
+    {
+        return -RT_ENOMEM;
+    }
+
+    /* 首块覆盖整个堆，末尾是一个永远占用的哨兵块 */
+    first = (soak_block_t *)soak_heap.pool;
+    tail = (soak_block_t *)(soak_heap.pool + ((size - SOAK_HDR) & ~7U));
+    tail->used = 1;
+    tail->prev = first;
+    tail->next = tail;
+    first->used = 0;
+    first->prev = first;
+    first->next = tail;
+
+    soak_heap.free_head.next_free = &soak_heap.free_head;
+    soak_heap.free_head.prev_free = &soak_heap.free_head;
+    soak_heap.free_head.used = 1;
+    soak_free_insert(first);
+
+    return RT_EOK;
+}
+
+static void soak_heap_deinit(void)
+{
+    rt_free(soak_heap.pool);
+}
+
+static void *soak_heap_alloc(uint32_t size)
+{
+    soak_block_t *b;
+
+    size = SOAK_ALIGN(size < SOAK_MIN_ALLOC ? SOAK_MIN_ALLOC : size);
+    for (b = soak_heap.free_head.next_free; b != &soak_heap.free_head; b = b->next_free)
+    {
+        if (SOAK_SIZE(b) >= size)
+        {
+            soak_free_remove(b);
+            b->used = 1;
+            soak_split(b, size);
+            return (uint8_t *)b + SOAK_HDR;
+        }
+    }
+
+    return RT_NULL;
+}
+
+static void soak_heap_free(void *ptr)
+{
+    soak_block_t *b;
+
+    if (ptr == RT_NULL)
+    {
+        return;
+    }
+    b = (soak_block_t *)((uint8_t *)ptr - SOAK_HDR);
+    b->used = 0;
+
+    if (!b->next->used)
+    {
+        soak_block_t *next = b->next;
+
+        soak_free_remove(next);
+        b->next = next->next;
+        next->next->prev = b;
+    }
+    if (b->prev != b && !b->prev->used)
+    {
+        b->prev->next = b->next;
+        b->next->prev = b->prev;
+        return;
+    }
+    soak_free_insert(b);
+}
+
+static void *soak_heap_realloc(void *ptr, uint32_t size)
+{
+    soak_block_t *b;
+    void *new_ptr;
+    uint32_t old_size;
+
+    if (ptr == RT_NULL)
+    {
+        return soak_heap_alloc(size);
+    }
+    b = (soak_block_t *)((uint8_t *)ptr - SOAK_HDR);
+    old_size = SOAK_SIZE(b);
+    size = SOAK_ALIGN(size);
+    if (size <= old_size)
+    {
+        return ptr;
+    }
+
+    /* 后面是足够大的空闲块时原地扩展 */
+    if (!b->next->used && old_size + SOAK_HDR + SOAK_SIZE(b->next) >= size)
+    {
+        soak_block_t *next = b->next;
+
+        soak_free_remove(next);
+        b->next = next->next;
+        next->next->prev = b;
+        soak_split(b, size);
+        return ptr;
+    }
+
+    new_ptr = soak_heap_alloc(size);
+    if (new_ptr == RT_NULL)
+    {
+        return RT_NULL;
+    }
+    rt_memcpy(new_ptr, ptr, old_size);
+    soak_heap_free(ptr);
+
+    return new_ptr;
+}
+
+static void soak_heap_measure(uint32_t *free_bytes, uint32_t *largest)
+{
+    soak_block_t *b;
+
+    *free_bytes = 0;
+    *largest = 0;
+    for (b = soak_heap.free_head.next_free; b != &soak_heap.free_head; b = b->next_free)
+    {
+        *free_bytes += SOAK_SIZE(b);
+        if (SOAK_SIZE(b) > *largest)
+        {
+            *largest = SOAK_SIZE(b);
+        }
+    }
+}
+
+#endif /* __RTTHREAD__ && RT_USING_MEMHEAP */
+
+/* ==================== 模拟交互 ==================== */
+
+/* 交互中临时分配的去向 */
+typedef struct {
+    const char *name;
+    void *(*alloc)(uint32_t size);
+    void *(*realloc)(void *ptr, uint32_t size);
+    void (*free)(void *ptr);
+    void (*begin)(void);
+    void (*end)(void);
+} soak_ops_t;
+
+static void soak_nop(void)
+{
+}
+
+static const soak_ops_t soak_heap_ops = {
+    "heap", soak_heap_alloc, soak_heap_realloc, soak_heap_free, soak_nop, soak_nop
+};
+
+static const soak_ops_t soak_arena_ops = {
+    "arena", ai_arena_alloc, ai_arena_realloc, ai_arena_free, ai_arena_begin, ai_arena_end
+};
+
+static struct {
+    const soak_ops_t *ops;
+    uint32_t seed;
+    uint32_t failures;
+    void *background[SOAK_BACKGROUND];
+    uint32_t expire[SOAK_BACKGROUND];
+} soak;
+
+static uint32_t soak_rand(uint32_t range)
+{
+    soak.seed = soak.seed * 1103515245 + 12345;
+    return (soak.seed >> 8) % range;
+}
+
+static void *soak_alloc(uint32_t size)
+{
+    void *ptr = soak.ops->alloc(size);
+
+    if (ptr == RT_NULL)
+    {
+        soak.failures++;
+    }
+    return ptr;
+}
+
+/* 按需扩大：失败时保留原缓冲区，和 web_client_body_reserve 一样 */
+static void *soak_grow(void *ptr, uint32_t size)
+{
+    void *grown = soak.ops->realloc(ptr, size);
+
+    if (grown == RT_NULL)
+    {
+        soak.failures++;
+        return ptr;
+    }
+    return grown;
+}
+
+/* 一次HTTP请求：请求头和接收块用完即释放，返回响应体 */
+static void *soak_http(uint32_t body_len, rt_bool_t chunked)
+{
+    void *header = soak_alloc(1024);
+    void *recv = soak_alloc(2 * 1024);
+    void *body = RT_NULL;
+    uint32_t size;
+
+    if (chunked)
+    {
+        for (size = 512; size < body_len * 2; size *= 2)
+        {
+            body = soak_grow(body, size + 1);
+        }
+    }
+    else
+    {
+        body = soak_grow(RT_NULL, body_len + 1);
+    }
+
+    soak.ops->free(recv);
+    soak.ops->free(header);
+
+    return body;
+}
+
+/* json_stream_extract：取值缓冲区从64字节倍增 */
+static void *soak_extract(uint32_t len)
+{
+    void *value = RT_NULL;
+    uint32_t size;
+
+    for (size = 64; size <= len * 2; size *= 2)
+    {
+        value = soak_grow(value, size);
+    }
+    return value;
+}
+
+/* 其他模块的长期分配（DNS缓存、日志、网络等），寿命1~200轮 */
+static void soak_background(uint32_t round)
+{
+    uint32_t i;
+
+    for (i = 0; i < SOAK_BACKGROUND; i++)
+    {
+        if (soak.background[i] && soak.expire[i] <= round)
+        {
+            soak_heap_free(soak.background[i]);
+            soak.background[i] = RT_NULL;
+        }
+    }
+
+    for (i = soak_rand(3); i > 0; i--)
+    {
+        uint32_t slot = soak_rand(SOAK_BACKGROUND);
+
+        if (soak.background[slot] == RT_NULL)
+        {
+            soak.background[slot] = soak_heap_alloc(32 + soak_rand(480));
+            soak.expire[slot] = round + 1 + soak_rand(200);
+        }
+    }
+}
+
+static void soak_interaction(uint32_t round)
+{
+    void *sentences[SOAK_SENTENCES_MAX];
+    void *text, *json, *header, *body, *reply, *audio, *playing = RT_NULL;
+    uint32_t count, i, size, audio_len;
+
+    soak.ops->begin();
+
+    /* STT */
+    body = soak_http(200 + soak_rand(800), RT_FALSE);
+    text = soak_extract(16 + soak_rand(96));
+    soak.ops->free(body);
+
+    /* 对话 */
+    json = soak_alloc(2048);
+    header = soak_alloc(512);
+    body = soak_http(1024 + soak_rand(5 * 1024), RT_TRUE);
+    soak.ops->free(header);
+    reply = soak_extract(64 + soak_rand(600));
+    soak.ops->free(body);
+    soak.ops->free(json);
+
+    count = 1 + soak_rand(SOAK_SENTENCES_MAX);
+    for (i = 0; i < count; i++)
+    {
+        sentences[i] = soak_alloc(20 + soak_rand(100));
+    }
+    soak.ops->free(reply);
+    soak.ops->free(text);
+
+    /* 交互进行中其他模块也在分配（DNS缓存、日志等），落在临时数据之间 */
+    soak_background(round);
+
+    /* 逐句TTS，上一句的音频播放完才释放 */
+    for (i = 0; i < count; i++)
+    {
+        audio_len = 8 * 1024 + soak_rand(56 * 1024);
+        header = soak_alloc(1024);
+        body = soak_alloc(2 * 1024);
+        audio = RT_NULL;
+        for (size = 4 * 1024; size < audio_len * 2; size *= 2)
+        {
+            audio = soak_grow(audio, size);
+        }
+        soak.ops->free(body);
+        soak.ops->free(header);
+        soak.ops->free(sentences[i]);
+
+        soak.ops->free(playing);
+        playing = audio;
+        if (i == 0)
+        {
+            soak_background(round);
+        }
+    }
+    soak.ops->free(playing);
+
+    soak.ops->end();
+}
+
+static void soak_report(uint32_t round)
+{
+    uint32_t free_bytes, largest;
+
+    soak_heap_measure(&free_bytes, &largest);
+    rt_kprintf("%-6s %8d %10d %10d %6d%% %9d\n", soak.ops->name, round, free_bytes, largest,
+               free_bytes ? 100 - (int)((uint64_t)largest * 100 / free_bytes) : 0, soak.failures);
+}
+
+static int soak_run(const soak_ops_t *ops, uint32_t rounds, uint32_t heap_size)
+{
+    rt_tick_t start, ticks;
+    uint32_t i;
+
+    if (soak_heap_init(heap_size) != RT_EOK)
+    {
+        rt_kprintf("Failed to allocate %d bytes for the soak heap\n", heap_size);
+        return -1;
+    }
+    rt_memset(&soak, 0, sizeof(soak));
+    soak.ops = ops;
+    soak.seed = 1;
+
+    start = rt_tick_get();
+    for (i = 1; i <= rounds; i++)
+    {
+        soak_background(i);
+        soak_interaction(i);
+        if (i % (rounds / SOAK_REPORTS ? rounds / SOAK_REPORTS : 1) == 0 || i == rounds)
+        {
+            ticks = rt_tick_get() - start;
+            soak_report(i);
+            start = rt_tick_get() - ticks;
+        }
+    }
+    ticks = rt_tick_get() - start;
+    rt_kprintf("%-6s %d rounds in %d ms\n", ops->name, rounds, ticks * 1000 / RT_TICK_PER_SECOND);
+
+    for (i = 0; i < SOAK_BACKGROUND; i++)
+    {
+        soak_heap_free(soak.background[i]);
+    }
+    soak_heap_deinit();
+
+    return (int)soak.failures;
+}
+
+static int ai_arena_soak(uint32_t rounds, uint32_t heap_kb)
+{
+    ai_arena_stats_t before, after;
+    int heap_failures, arena_failures;
+
+    if (rounds == 0 || heap_kb == 0)
+    {
+        return -1;
+    }
+    if (ai_arena_init(0) != RT_EOK)
+    {
+        return -1;
+    }
+
+    rt_kprintf("Soak: %d interactions, %d KB heap\n", rounds, heap_kb);
+    rt_kprintf("mode      round  free(B)  largest(B)   frag  failures\n");
+
+    heap_failures = soak_run(&soak_heap_ops, rounds, heap_kb * 1024);
+
+    ai_arena_get_stats(&before);
+    arena_failures = soak_run(&soak_arena_ops, rounds, heap_kb * 1024);
+    ai_arena_get_stats(&after);
+
+    rt_kprintf("arena: peak %d bytes, %d allocs, %d resets, %d heap fallbacks\n", after.peak,
+               after.allocs - before.allocs, after.resets - before.resets, after.fallbacks - before.fallbacks);
+    rt_kprintf("failures: heap %d, arena %d\n", heap_failures, arena_failures);
+
+    return arena_failures == 0 ? 0 : -1;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+#include <finsh.h>
+
+static int cmd_ai_arena_soak(int argc, char **argv)
+{
+    return ai_arena_soak(argc > 1 ? atoi(argv[1]) : 5000, argc > 2 ? atoi(argv[2]) : 256);
+}
+MSH_CMD_EXPORT_ALIAS(cmd_ai_arena_soak, ai_arena_soak, Arena soak test: ai_arena_soak [rounds] [heap_KB]);
+#endif
+
+#ifdef AI_ARENA_BENCH_MAIN
+HOST_CRITICAL_LOCK_DEFINE;
+
+int main(int argc, char **argv)
+{
+    return ai_arena_soak(argc > 1 ? atoi(argv[1]) : 5000, argc > 2 ? atoi(argv[2]) : 256) == 0 ? 0 : 1;
+}
+#endif
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Streaming chat time-to-first-token test
+ */
+
+/*
+ * 流式对话的首字延迟测试：同一个问题交替用普通请求和流式请求（"stream":true）发送，比较
+ *   - 首字：普通请求要等整段回复返回，流式请求是第一个回复片段到达的时间
+ *   - 首句：回复中出现第一个句末标点的时间，即下游TTS可以开始合成第一句的时刻
+ *   - 总耗时，以及两种方式得到的回复是否相同
+ * 服务器端用 mock_ai_server.py 的 /chat：delay是第一个片段之前的耗时，token_ms是之后每个片段的耗时，
+ * 普通请求在全部片段生成完后才返回。OpenAI格式和百度格式各测一遍，测试期间替换对话服务的配置，结束后恢复。
+ *
+ * 设备端：chat_bench http://PC_IP:8090 [轮数] [delay] [token_ms]
+ * PC端（与设备端同一份ai_chat_service.c和web_client.c）：
+ *   gcc -O2 -DAI_CHAT_BENCH_MAIN -I../host -I. ai_chat_bench.c ai_chat_service.c ai_conversation.c \
+ *       web_client.c web_dns.c web_http_parser.c web_sse_parser.c json_stream.c ai_trace.c ai_arena.c memory_helper.c \
+ *       -lpthread -o chat_bench
+ *   python ../mock_ai_server.py 8090 &
+ *   ./chat_bench http://127.0.0.1:8090 5 300 40
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include "ai_chat_service.h"
+#include "ai_conversation.h"
+
+#define CHAT_BENCH_QUESTION     "今天天气怎么样？"
+#define CHAT_BENCH_SENTENCES    4
+
+#define CHAT_BENCH_TICK_TO_MS(t)    ((uint32_t)((uint64_t)(t) * 1000 / RT_TICK_PER_SECOND))
+
+/* 一次请求的测量结果 */
+typedef struct {
+    rt_tick_t start;
+    uint32_t first_ms;          /* 首字 */
+    uint32_t sentence_ms;       /* 首句 */
+    uint32_t total_ms;
+    uint32_t deltas;
+    rt_bool_t has_sentence;
+} chat_bench_probe_t;
+
+/* 各格式、各方式的累计 */
+typedef struct {
+    uint32_t count;
+    uint32_t first_ms;
+    uint32_t sentence_ms;
+    uint32_t total_ms;
+    uint32_t deltas;
+} chat_bench_sum_t;
+
+static rt_bool_t chat_bench_sentence_end(const char *text, uint32_t len)
+{
+    static const char *const marks[] = {"\xe3\x80\x82", "\xef\xbc\x81", "\xef\xbc\x9f", ".", "!", "?"};
+    uint32_t i, m, n;
+
+    for (i = 0; i < len; i++)
+    {
+        for (m = 0; m < sizeof(marks) / sizeof(marks[0]); m++)
+        {
+            n = strlen(marks[m]);
+            if (i + n <= len && memcmp(text + i, marks[m], n) == 0)
+            {
+                return RT_TRUE;
+            }
+        }
+    }
+
+    return RT_FALSE;
+}
+
+static int chat_bench_delta(const char *text, uint32_t len, void *user_data)
+{
+    chat_bench_probe_t *probe = (chat_bench_probe_t *)user_data;
+    uint32_t ms = CHAT_BENCH_TICK_TO_MS(rt_tick_get() - probe->start);
+
+    if (probe->deltas++ == 0)
+    {
+        probe->first_ms = ms;
+    }
+    if (!probe->has_sentence && chat_bench_sentence_end(text, len))
+    {
+        probe->has_sentence = RT_TRUE;
+        probe->sentence_ms = ms;
+    }
+
+    return RT_EOK;
+}
+
+static void chat_bench_add(chat_bench_sum_t *sum, const chat_bench_probe_t *probe)
+{
+    sum->count++;
+    sum->first_ms += probe->first_ms;
+    sum->sentence_ms += probe->sentence_ms;
+    sum->total_ms += probe->total_ms;
+    sum->deltas += probe->deltas;
+}
+
+static void chat_bench_print(const char *format, const char *mode, const chat_bench_sum_t *sum)
+{
+    uint32_t n = sum->count ? sum->count : 1;
+
+    rt_kprintf("%-7s %-9s %5d %12d %15d %8d %8d\n", format, mode, sum->count,
+               sum->first_ms / n, sum->sentence_ms / n, sum->total_ms / n, sum->deltas / n);
+}
+
+/* 一种格式：普通请求和流式请求交替，返回回复不一致或失败的次数 */
+static int chat_bench_format(const char *name, ai_chat_config_t *config, int rounds)
+{
+    chat_bench_sum_t buffered = {0}, streamed = {0};
+    chat_bench_probe_t probe;
+    ai_chat_response_t plain, stream;
+    int failures = 0;
+    int i;
+
+    ai_chat_service_init(config);
+
+    for (i = 0; i < rounds; i++)
+    {
+        /* 每次都是第一轮对话，请求体相同 */
+        ai_conv_clear();
+        rt_memset(&probe, 0, sizeof(probe));
+        probe.start = rt_tick_get();
+        ai_chat_service_chat(CHAT_BENCH_QUESTION, &plain);
+        probe.total_ms = CHAT_BENCH_TICK_TO_MS(rt_tick_get() - probe.start);
+        probe.first_ms = probe.total_ms;
+        probe.sentence_ms = probe.total_ms;
+        probe.deltas = 1;
+        if (plain.reply_text)
+        {
+            chat_bench_add(&buffered, &probe);
+        }
+
+        ai_conv_clear();
+        rt_memset(&probe, 0, sizeof(probe));
+        probe.start = rt_tick_get();
+        ai_chat_service_chat_stream(CHAT_BENCH_QUESTION, chat_bench_delta, &probe, &stream);
+        probe.total_ms = CHAT_BENCH_TICK_TO_MS(rt_tick_get() - probe.start);
+        if (stream.reply_text)
+        {
+            chat_bench_add(&streamed, &probe);
+        }
+
+        if (plain.reply_text == RT_NULL || stream.reply_text == RT_NULL ||
+            strcmp(plain.reply_text, stream.reply_text) != 0)
+        {
+            rt_kprintf("%s round %d: %s\n", name, i + 1,
+                       (plain.reply_text && stream.reply_text) ? "replies differ" : "request failed");
+            failures++;
+        }
+
+        ai_chat_service_free_response(&plain);
+        ai_chat_service_free_response(&stream);
+    }
+
+    chat_bench_print(name, "buffered", &buffered);
+    chat_bench_print(name, "stream", &streamed);
+
+    return failures;
+}
+
+static int chat_bench(const char *base_url, int rounds, int delay_ms, int token_ms)
+{
+    ai_chat_config_t saved, config;
+    rt_bool_t has_chat;
+    int failures;
+
+    has_chat = (ai_chat_service_get_config(&saved) == RT_EOK);
+
+    rt_kprintf("Chat TTFT: %d rounds, delay %d ms, %d ms per piece, %d sentences\n",
+               rounds, delay_ms, token_ms, CHAT_BENCH_SENTENCES);
+    rt_kprintf("%-7s %-9s %5s %12s %15s %8s %8s\n", "format", "mode", "count",
+               "first (ms)", "sentence (ms)", "total", "deltas");
+
+    rt_memset(&config, 0, sizeof(config));
+    config.provider = AI_CHAT_OPENAI;
+    strncpy(config.model, "mock", sizeof(config.model) - 1);
+    rt_snprintf(config.api_url, sizeof(config.api_url), "%s/chat?sentences=%d&delay=%d&token_ms=%d",
+                base_url, CHAT_BENCH_SENTENCES, delay_ms, token_ms);
+    failures = chat_bench_format("openai", &config, rounds);
+
+    config.provider = AI_CHAT_BAIDU_WENXIN;
+    rt_snprintf(config.api_url, sizeof(config.api_url),
+                "%s/chat?sentences=%d&delay=%d&token_ms=%d&format=baidu",
+                base_url, CHAT_BENCH_SENTENCES, delay_ms, token_ms);
+    failures += chat_bench_format("baidu", &config, rounds);
+
+    rt_kprintf("Reply mismatches or failures: %d\n", failures);
+
+    if (has_chat)
+    {
+        ai_chat_service_init(&saved);
+    }
+
+    return failures == 0 ? 0 : -1;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+#include <finsh.h>
+
+static int cmd_chat_bench(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        rt_kprintf("Usage: chat_bench <mock_base_url> [rounds] [delay_ms] [token_ms]\n");
+        rt_kprintf("  e.g. chat_bench http://PC_IP:8090 5 300 40\n");
+        return -1;
+    }
+
+    return chat_bench(argv[1], argc > 2 ? atoi(argv[2]) : 5,
+                      argc > 3 ? atoi(argv[3]) : 300, argc > 4 ? atoi(argv[4]) : 40);
+}
+MSH_CMD_EXPORT_ALIAS(cmd_chat_bench, chat_bench, Streaming chat TTFT test: chat_bench url [rounds] [delay] [token_ms]);
+#endif
+
+#ifdef AI_CHAT_BENCH_MAIN
+HOST_CRITICAL_LOCK_DEFINE;
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        rt_kprintf("Usage: %s <mock_base_url> [rounds] [delay_ms] [token_ms]\n", argv[0]);
+        return 1;
+    }
+
+    return chat_bench(argv[1], argc > 2 ? atoi(argv[2]) : 5,
+                      argc > 3 ? atoi(argv[3]) : 300, argc > 4 ? atoi(argv[4]) : 40) == 0 ? 0 : 1;
+}
+#endif
@@ -13,6 +13,11 @@
 #include <stdio.h>
 #include "ai_chat_service.h"
 #include "web_client.h"
+#include "json_stream.h"
+#include "web_sse_parser.h"
+#include "ai_arena.h"
+#include "ai_conversation.h"
+#include "ai_trace.h"
 
 #define DBG_TAG "ai.chat"
 #define DBG_LVL DBG_INFO
@@ -34,12 +39,27 @@ int ai_chat_service_init(ai_chat_config_t *config)
     rt_memcpy(&g_chat_config, config, sizeof(ai_chat_config_t));
     g_chat_initialized = RT_TRUE;
     
+    /* 换了服务或配置，之前的对话不再延续 */
+    ai_conv_clear();
+    
     LOG_I("AI chat service initialized (Provider: %d, Model: %s)", 
           config->provider, config->model);
     
     return RT_EOK;
 }
 
+/* 获取当前配置，未初始化时返回错误 */
+int ai_chat_service_get_config(ai_chat_config_t *config)
+{
+    if (config == RT_NULL || !g_chat_initialized)
+    {
+        return -RT_ERROR;
+    }
+    
+    rt_memcpy(config, &g_chat_config, sizeof(ai_chat_config_t));
+    return RT_EOK;
+}
+
 /* 设置系统提示词 */
 int ai_chat_service_set_system_prompt(const char *prompt)
 {
@@ -54,159 +74,333 @@ int ai_chat_service_set_system_prompt(const char *prompt)
     return RT_EOK;
 }
 
-/* 提取JSON字符串值（简化版JSON解析）*/
-static char *extract_json_string(const char *json, const char *key)
+/* 回复文本在各服务商响应中的位置 */
+static const char *const openai_reply_paths[] = {"choices[0].message.content"};
+static const char *const baidu_reply_paths[] = {"answer", "result"};    /* V2优先，其次V1 */
+
+/* 流式回复中每个事件里片段的位置（百度的流式事件与非流式响应格式相同）*/
+static const char *const openai_delta_paths[] = {"choices[0].delta.content"};
+
+/* 对话请求体：前缀 + messages数组 + 后缀，messages由对话上下文从历史缓冲区直接写出 */
+typedef struct {
+    char prefix[128];
+    const char *suffix;
+    const char *system;         /* 为空时不发送系统提示词 */
+    const char *user_message;
+    web_client_stream_t *stream;
+    uint32_t len;
+    char buf[256];              /* 攒够一段再发送，减少send调用 */
+} chat_body_t;
+
+static int chat_body_emit(const void *data, uint32_t len, void *user_data)
+{
+    chat_body_t *body = (chat_body_t *)user_data;
+    
+    if (body->len + len > sizeof(body->buf))
+    {
+        if (web_client_stream_write(body->stream, body->buf, body->len) != RT_EOK)
+        {
+            return -RT_ERROR;
+        }
+        body->len = 0;
+        if (len > sizeof(body->buf))
+        {
+            return web_client_stream_write(body->stream, data, len);
+        }
+    }
+    
+    rt_memcpy(body->buf + body->len, data, len);
+    body->len += len;
+    return RT_EOK;
+}
+
+/* 写出请求体，连接失效重试时会再调用一次 */
+static int chat_body_writer(web_client_stream_t *stream, void *user_data)
+{
+    chat_body_t *body = (chat_body_t *)user_data;
+    
+    body->stream = stream;
+    body->len = 0;
+    
+    if (chat_body_emit(body->prefix, strlen(body->prefix), body) != RT_EOK ||
+        ai_conv_write_messages(body->system, body->user_message, chat_body_emit, body) < 0 ||
+        chat_body_emit(body->suffix, strlen(body->suffix), body) != RT_EOK)
+    {
+        return -RT_ERROR;
+    }
+    
+    return web_client_stream_write(stream, body->buf, body->len);
+}
+
+/* 发送对话请求：先计算请求体长度，再边序列化边发送（调用者持有对话上下文的锁）*/
+static int chat_post(const char *url, const char *custom_header, chat_body_t *body,
+                     http_response_t *http_resp)
+{
+    int32_t messages_len = ai_conv_write_messages(body->system, body->user_message, RT_NULL, RT_NULL);
+    
+    return web_client_post_stream_with_header(url, "application/json", custom_header,
+                                              strlen(body->prefix) + messages_len + strlen(body->suffix),
+                                              chat_body_writer, body, http_resp);
+}
+
+/* 流式对话的接收状态 */
+typedef struct {
+    ai_chat_delta_cb on_delta;
+    void *user_data;
+    const char *const *delta_paths;     /* SSE事件中片段的位置 */
+    const char *const *reply_paths;     /* 普通JSON响应中完整回复的位置 */
+    int path_count;
+    rt_bool_t started;                  /* 已收到响应体 */
+    rt_bool_t sse;                      /* 响应是 text/event-stream */
+    rt_bool_t done;                     /* 收到 [DONE] */
+    int error;                          /* 内存不足或调用者中止 */
+    char *reply;                        /* 累积的完整回复（非200时是响应体开头）*/
+    uint32_t reply_len;
+    uint32_t reply_size;
+    rt_tick_t start;
+    uint32_t first_token_ms;
+    json_stream_t js;
+    web_sse_parser_t sse_parser;
+} chat_stream_t;
+
+#define CHAT_STREAM_ERROR_BODY  256     /* 非200时保留的响应体长度，用于日志 */
+
+static int chat_stream_append(chat_stream_t *cs, const char *data, uint32_t len)
+{
+    uint32_t size = cs->reply_size ? cs->reply_size : 256;
+    char *reply;
+    
+    while (cs->reply_len + len + 1 > size)
+    {
+        size *= 2;
+    }
+    if (size != cs->reply_size)
+    {
+        reply = (char *)ai_arena_realloc(cs->reply, size);
+        if (reply == RT_NULL)
+        {
+            LOG_E("Failed to allocate reply buffer (%d bytes)", size);
+            return -RT_ENOMEM;
+        }
+        cs->reply = reply;
+        cs->reply_size = size;
+    }
+    
+    rt_memcpy(cs->reply + cs->reply_len, data, len);
+    cs->reply_len += len;
+    cs->reply[cs->reply_len] = '\0';
+    
+    return RT_EOK;
+}
+
+/* 回复文本的一段：累积到完整回复并交给调用者 */
+static int chat_stream_value(json_stream_t *js, int path, json_value_type_t type,
+                             const char *data, uint32_t len, rt_bool_t done, void *user_data)
 {
-    char search_key[128];
-    char *result = RT_NULL;
-    char *start, *end;
-    int len;
+    chat_stream_t *cs = (chat_stream_t *)user_data;
     
-    /* 构造搜索键 "key": */
-    rt_snprintf(search_key, sizeof(search_key), "\"%s\":", key);
+    (void)js;
+    (void)path;
+    (void)done;
+    if (type != JSON_VALUE_STRING || len == 0)
+    {
+        return RT_EOK;
+    }
     
-    start = strstr(json, search_key);
-    if (start == RT_NULL)
+    if (cs->reply_len == 0)
     {
-        return RT_NULL;
+        AI_TRACE_INSTANT("chat first token", len);
+        cs->first_token_ms = (rt_tick_get() - cs->start) * 1000 / RT_TICK_PER_SECOND;
     }
     
-    /* 跳过搜索键，定位到冒号后 */
-    start = start + strlen(search_key);
+    cs->error = chat_stream_append(cs, data, len);
+    if (cs->error == RT_EOK && cs->on_delta(data, len, cs->user_data) != RT_EOK)
+    {
+        cs->error = -RT_EINTR;
+    }
+    
+    return cs->error;
+}
+
+static void chat_stream_json_init(chat_stream_t *cs, const char *const *paths)
+{
+    int i;
+    
+    json_stream_init(&cs->js, chat_stream_value, cs);
+    for (i = 0; i < cs->path_count; i++)
+    {
+        json_stream_add_path(&cs->js, paths[i]);
+    }
+}
+
+/* 一个SSE事件是一个独立的JSON对象，[DONE]表示回复结束 */
+static int chat_stream_event(web_sse_parser_t *parser, const char *event,
+                             const char *data, uint32_t len, void *user_data)
+{
+    chat_stream_t *cs = (chat_stream_t *)user_data;
     
-    /* 跳过可能的空格 */
-    while (*start == ' ' || *start == '\t' || *start == '\r' || *start == '\n')
+    (void)parser;
+    (void)event;
+    if (cs->done)
     {
-        start++;
+        return RT_EOK;
+    }
+    if (len == 6 && memcmp(data, "[DONE]", 6) == 0)
+    {
+        cs->done = RT_TRUE;
+        return RT_EOK;
     }
     
-    /* 检查是否是字符串值（以引号开始）*/
-    if (*start != '\"')
+    chat_stream_json_init(cs, cs->delta_paths);
+    if (json_stream_feed(&cs->js, data, len) == -RT_EINTR)
     {
-        return RT_NULL;
+        return -RT_ERROR;
     }
     
-    start++; /* 跳过开始引号 */
+    /* 格式不对的事件（如心跳或服务商自定义的事件）跳过 */
+    return RT_EOK;
+}
+
+/* 响应体：SSE逐个事件解析，普通JSON边收边取出回复 */
+static int chat_stream_reader(web_client_resp_stream_t *resp, const uint8_t *data,
+                              uint32_t len, void *user_data)
+{
+    chat_stream_t *cs = (chat_stream_t *)user_data;
+    int ret;
+    
+    if (resp->status_code != 200)
+    {
+        /* 错误响应只保留开头用于日志 */
+        if (cs->reply_len + len > CHAT_STREAM_ERROR_BODY)
+        {
+            len = CHAT_STREAM_ERROR_BODY - cs->reply_len;
+        }
+        return chat_stream_append(cs, (const char *)data, len);
+    }
     
-    /* 找到结束引号 */
-    end = start;
-    while (*end && *end != '\"')
+    if (!cs->started)
     {
-        if (*end == '\\' && *(end + 1))
+        cs->started = RT_TRUE;
+        cs->sse = (strncmp(resp->content_type, "text/event-stream", 17) == 0);
+        if (cs->sse)
         {
-            end += 2; /* 跳过转义字符 */
+            web_sse_parser_init(&cs->sse_parser, chat_stream_event, cs);
         }
         else
         {
-            end++;
+            LOG_W("Server did not stream the reply (%s)", resp->content_type);
+            chat_stream_json_init(cs, cs->reply_paths);
         }
     }
     
-    if (*end != '\"')
+    if (cs->sse)
     {
-        return RT_NULL;
+        ret = web_sse_parser_execute(&cs->sse_parser, data, len);
+    }
+    else
+    {
+        ret = json_stream_feed(&cs->js, (const char *)data, len);
     }
     
-    len = end - start;
-    result = (char *)rt_malloc(len + 1);
-    if (result)
+    return (ret == -RT_EINTR || cs->error != RT_EOK) ? -RT_ERROR : RT_EOK;
+}
+
+/* 发送流式对话请求并接收回复，结果填入response（调用者持有对话上下文的锁）*/
+static int chat_post_stream(const char *url, const char *custom_header, chat_body_t *body,
+                            chat_stream_t *cs, ai_chat_response_t *response)
+{
+    web_client_resp_stream_t resp;
+    int32_t messages_len = ai_conv_write_messages(body->system, body->user_message, RT_NULL, RT_NULL);
+    int ret;
+    
+    cs->start = rt_tick_get();
+    ret = web_client_post_stream_recv(url, "application/json", custom_header,
+                                      strlen(body->prefix) + messages_len + strlen(body->suffix),
+                                      chat_body_writer, body, chat_stream_reader, cs, &resp);
+    
+    if (ret == RT_EOK && resp.status_code == 200 && cs->reply_len > 0)
     {
-        rt_memcpy(result, start, len);
-        result[len] = '\0';
-        
-        /* 解码Unicode转义序列 (\uXXXX) */
-        char *read_pos = result;
-        char *write_pos = result;
-        
-        while (*read_pos)
+        response->reply_text = cs->reply;
+        response->first_token_ms = cs->first_token_ms;
+        response->error_code = 0;
+        LOG_I("AI reply: %s", cs->reply);
+        LOG_I("First token after %d ms, %d SSE events", cs->first_token_ms, cs->sse_parser.events);
+        return RT_EOK;
+    }
+    
+    if (cs->error == -RT_EINTR)
+    {
+        LOG_I("Reply aborted after %d bytes", cs->reply_len);
+        response->error_code = -1;
+        response->error_msg = ai_arena_strdup("Reply aborted");
+    }
+    else if (ret == RT_EOK && resp.status_code == 200)
+    {
+        LOG_W("Failed to parse AI response");
+        response->error_code = -1;
+        response->error_msg = ai_arena_strdup("Failed to parse AI response");
+    }
+    else
+    {
+        LOG_E("HTTP request failed (status: %d)", resp.status_code);
+        if (resp.status_code != 200 && cs->reply_len > 0)
         {
-            if (*read_pos == '\\' && *(read_pos + 1) == 'u' && 
-                *(read_pos + 2) && *(read_pos + 3) && *(read_pos + 4) && *(read_pos + 5))
-            {
-                /* 解析\uXXXX格式的Unicode转义 */
-                unsigned int unicode = 0;
-                char hex[5] = {0};
-                rt_memcpy(hex, read_pos + 2, 4);
-                
-                /* 转换为整数 */
-                for (int i = 0; i < 4; i++)
-                {
-                    unicode *= 16;
-                    if (hex[i] >= '0' && hex[i] <= '9')
-                        unicode += hex[i] - '0';
-                    else if (hex[i] >= 'a' && hex[i] <= 'f')
-                        unicode += hex[i] - 'a' + 10;
-                    else if (hex[i] >= 'A' && hex[i] <= 'F')
-                        unicode += hex[i] - 'A' + 10;
-                }
-                
-                /* 将Unicode码点转换为UTF-8 */
-                if (unicode < 0x80)
-                {
-                    *write_pos++ = (char)unicode;
-                }
-                else if (unicode < 0x800)
-                {
-                    *write_pos++ = (char)(0xC0 | (unicode >> 6));
-                    *write_pos++ = (char)(0x80 | (unicode & 0x3F));
-                }
-                else
-                {
-                    *write_pos++ = (char)(0xE0 | (unicode >> 12));
-                    *write_pos++ = (char)(0x80 | ((unicode >> 6) & 0x3F));
-                    *write_pos++ = (char)(0x80 | (unicode & 0x3F));
-                }
-                
-                read_pos += 6; /* 跳过\uXXXX */
-            }
-            else
-            {
-                *write_pos++ = *read_pos++;
-            }
+            LOG_E("Response body: %s", cs->reply);
         }
-        
-        *write_pos = '\0';
+        response->error_code = resp.status_code;
+        response->error_msg = ai_arena_strdup("AI API request failed");
+    }
+    
+    if (cs->reply)
+    {
+        ai_arena_free(cs->reply);
+        cs->reply = RT_NULL;
     }
     
-    return result;
+    return ret;
 }
 
 /* 对话功能 - OpenAI ChatGPT */
-static int chat_with_openai(const char *user_message, ai_chat_response_t *response)
+static int chat_with_openai(const char *user_message, chat_stream_t *cs, ai_chat_response_t *response)
 {
     http_response_t http_resp;
-    char *json_data = RT_NULL;
+    chat_body_t *body;
     int ret = -RT_ERROR;
     
-    /* 构造JSON请求 */
-    json_data = (char *)rt_malloc(2048);
-    if (json_data == RT_NULL)
+    body = (chat_body_t *)ai_arena_alloc(sizeof(chat_body_t));
+    if (body == RT_NULL)
     {
         LOG_E("Failed to allocate JSON buffer");
         return -RT_ERROR;
     }
     
-    /* OpenAI API格式 */
-    rt_snprintf(json_data, 2048,
-                "{\"model\":\"%s\","
-                "\"messages\":["
-                "{\"role\":\"system\",\"content\":\"%s\"},"
-                "{\"role\":\"user\",\"content\":\"%s\"}"
-                "],\"max_tokens\":150,\"temperature\":0.7}",
-                g_chat_config.model,
-                g_chat_config.system_prompt,
-                user_message);
+    /* OpenAI API格式，messages中带上最近几轮对话 */
+    rt_snprintf(body->prefix, sizeof(body->prefix), "{\"model\":\"%s\",\"messages\":", g_chat_config.model);
+    body->suffix = cs ? ",\"max_tokens\":150,\"temperature\":0.7,\"stream\":true}" :
+                        ",\"max_tokens\":150,\"temperature\":0.7}";
+    body->system = g_chat_config.system_prompt;
+    body->user_message = user_message;
+    
+    /* 流式请求在chat_post_stream中处理响应 */
+    if (cs != RT_NULL)
+    {
+        cs->delta_paths = openai_delta_paths;
+        cs->reply_paths = openai_reply_paths;
+        cs->path_count = 1;
+        ret = chat_post_stream(g_chat_config.api_url, RT_NULL, body, cs, response);
+        ai_arena_free(body);
+        return ret;
+    }
     
     /* 发送HTTP POST请求 */
-    ret = web_client_post(g_chat_config.api_url, json_data, strlen(json_data),
-                          "application/json", &http_resp);
+    ret = chat_post(g_chat_config.api_url, RT_NULL, body, &http_resp);
     
     if (ret == RT_EOK && http_resp.status_code == 200)
     {
         LOG_I("Chat successful");
         
         /* 解析JSON响应，提取回复文本 */
-        response->reply_text = extract_json_string(http_resp.body, "content");
+        response->reply_text = json_stream_extract(http_resp.body, http_resp.body_len, openai_reply_paths, 1);
         
         if (response->reply_text)
         {
@@ -217,7 +411,7 @@ static int chat_with_openai(const char *user_message, ai_chat_response_t *respon
         {
             LOG_W("Failed to parse response");
             response->error_code = -1;
-            response->error_msg = rt_strdup("Failed to parse AI response");
+            response->error_msg = ai_arena_strdup("Failed to parse AI response");
         }
         
         web_client_free_response(&http_resp);
@@ -226,48 +420,47 @@ static int chat_with_openai(const char *user_message, ai_chat_response_t *respon
     {
         LOG_E("HTTP request failed (status: %d)", http_resp.status_code);
         response->error_code = http_resp.status_code;
-        response->error_msg = rt_strdup("HTTP request failed");
+        response->error_msg = ai_arena_strdup("HTTP request failed");
         web_client_free_response(&http_resp);
     }
     
-    rt_free(json_data);
+    ai_arena_free(body);
     
     return ret;
 }
 
 /* 对话功能 - 百度文心一言 */
-static int chat_with_baidu_wenxin(const char *user_message, ai_chat_response_t *response)
+static int chat_with_baidu_wenxin(const char *user_message, chat_stream_t *cs, ai_chat_response_t *response)
 {
     http_response_t http_resp;
-    char *json_data = RT_NULL;
+    chat_body_t *body;
     char *custom_header = RT_NULL;
     int ret = -RT_ERROR;
     
-    /* 构造JSON请求 */
-    json_data = (char *)rt_malloc(2048);
-    if (json_data == RT_NULL)
+    body = (chat_body_t *)ai_arena_alloc(sizeof(chat_body_t));
+    if (body == RT_NULL)
     {
         LOG_E("Failed to allocate JSON buffer");
         return -RT_ERROR;
     }
     
-    /* 构造请求数据 */
+    /* 构造请求数据：V1和V2格式相同，messages中带上最近几轮对话 */
+    rt_snprintf(body->prefix, sizeof(body->prefix), "{\"messages\":");
+    body->suffix = cs ? ",\"stream\":true}" : ",\"stream\":false}";
+    body->system = RT_NULL;
+    body->user_message = user_message;
+    
     if (g_chat_config.use_v2)
     {
         /* V2协议格式 */
         LOG_I("Using AI Chat V2 protocol");
-        rt_snprintf(json_data, 2048,
-                    "{\"messages\":["
-                    "{\"role\":\"user\",\"content\":\"%s\"}"
-                    "],\"stream\":false}",
-                    user_message);
         
         /* V2需要自定义Header进行IAM认证 */
-        custom_header = (char *)rt_malloc(512);
+        custom_header = (char *)ai_arena_alloc(512);
         if (custom_header == RT_NULL)
         {
             LOG_E("Failed to allocate header buffer");
-            rt_free(json_data);
+            ai_arena_free(body);
             return -RT_ERROR;
         }
         
@@ -285,28 +478,30 @@ static int chat_with_baidu_wenxin(const char *user_message, ai_chat_response_t *
     {
         /* V1协议格式（通过HTTP代理，支持讯飞星火等）*/
         LOG_I("Using AI Chat via HTTP Proxy (XFyun Spark)");
-        rt_snprintf(json_data, 2048,
-                    "{\"messages\":["
-                    "{\"role\":\"user\",\"content\":\"%s\"}"
-                    "],\"stream\":false}",
-                    user_message);
     }
     
-    LOG_D("Request JSON: %s", json_data);
-    
-    /* 发送HTTP POST请求 */
-    if (g_chat_config.use_v2)
+    /* 发送HTTP POST请求：V2使用自定义Header，V1使用URL中的access_token */
+    if (cs != RT_NULL)
     {
-        /* V2使用自定义Header */
-        ret = web_client_post_with_header(g_chat_config.api_url, json_data, strlen(json_data),
-                                          "application/json", custom_header, &http_resp);
-        rt_free(custom_header);
+        cs->delta_paths = baidu_reply_paths;
+        cs->reply_paths = baidu_reply_paths;
+        cs->path_count = 2;
+        ret = chat_post_stream(g_chat_config.api_url, custom_header, body, cs, response);
     }
     else
     {
-        /* V1使用URL中的access_token */
-        ret = web_client_post(g_chat_config.api_url, json_data, strlen(json_data),
-                              "application/json", &http_resp);
+        ret = chat_post(g_chat_config.api_url, custom_header, body, &http_resp);
+    }
+    if (custom_header)
+    {
+        ai_arena_free(custom_header);
+    }
+    
+    /* 流式请求的响应已经处理完 */
+    if (cs != RT_NULL)
+    {
+        ai_arena_free(body);
+        return ret;
     }
     
     if (ret == RT_EOK && http_resp.status_code == 200)
@@ -314,13 +509,8 @@ static int chat_with_baidu_wenxin(const char *user_message, ai_chat_response_t *
         LOG_I("AI chat successful");
         
         /* 解析JSON响应，提取回复文本 */
-        /* V2和V1的响应格式可能不同，先尝试V2格式 */
-        response->reply_text = extract_json_string(http_resp.body, "answer");
-        if (!response->reply_text)
-        {
-            /* 如果V2格式失败，尝试V1格式 */
-            response->reply_text = extract_json_string(http_resp.body, "result");
-        }
+        /* V2和V1的响应格式不同，一次扫描同时查找，V2优先 */
+        response->reply_text = json_stream_extract(http_resp.body, http_resp.body_len, baidu_reply_paths, 2);
         
         if (response->reply_text)
         {
@@ -332,7 +522,7 @@ static int chat_with_baidu_wenxin(const char *user_message, ai_chat_response_t *
             LOG_W("Failed to parse AI response");
             LOG_D("Response body: %s", http_resp.body);
             response->error_code = -1;
-            response->error_msg = rt_strdup("Failed to parse AI response");
+            response->error_msg = ai_arena_strdup("Failed to parse AI response");
         }
         
         web_client_free_response(&http_resp);
@@ -345,18 +535,20 @@ static int chat_with_baidu_wenxin(const char *user_message, ai_chat_response_t *
             LOG_E("Response body: %s", http_resp.body);
         }
         response->error_code = http_resp.status_code;
-        response->error_msg = rt_strdup("AI API request failed");
+        response->error_msg = ai_arena_strdup("AI API request failed");
         web_client_free_response(&http_resp);
     }
     
-    rt_free(json_data);
+    ai_arena_free(body);
     
     return ret;
 }
 
-/* 通用对话接口 */
-int ai_chat_service_chat(const char *user_message, ai_chat_response_t *response)
+/* 对话请求：cs为空时等待完整的响应，否则流式接收 */
+static int chat_request(const char *user_message, chat_stream_t *cs, ai_chat_response_t *response)
 {
+    int ret;
+    
     if (!g_chat_initialized)
     {
         LOG_E("AI chat service not initialized");
@@ -373,28 +565,82 @@ int ai_chat_service_chat(const char *user_message, ai_chat_response_t *response)
     
     LOG_I("User: %s", user_message);
     
+    /* 请求期间历史不变，回复成功后这一轮加入历史 */
+    ai_conv_lock();
+    AI_TRACE_BEGIN("chat");
+    
     /* 根据提供商调用不同的API */
     switch (g_chat_config.provider)
     {
         case AI_CHAT_OPENAI:
-            return chat_with_openai(user_message, response);
+            ret = chat_with_openai(user_message, cs, response);
+            break;
             
         case AI_CHAT_BAIDU_WENXIN:
-            return chat_with_baidu_wenxin(user_message, response);
+            ret = chat_with_baidu_wenxin(user_message, cs, response);
+            break;
             
         case AI_CHAT_CUSTOM:
             /* 自定义API实现 */
             LOG_W("Custom chat API not implemented");
             response->error_code = -1;
-            response->error_msg = rt_strdup("Custom API not implemented");
-            return -RT_ERROR;
+            response->error_msg = ai_arena_strdup("Custom API not implemented");
+            ret = -RT_ERROR;
+            break;
             
         default:
             LOG_E("Unknown chat provider: %d", g_chat_config.provider);
             response->error_code = -1;
-            response->error_msg = rt_strdup("Unknown provider");
-            return -RT_ERROR;
+            response->error_msg = ai_arena_strdup("Unknown provider");
+            ret = -RT_ERROR;
+            break;
+    }
+    
+    if (ret == RT_EOK && response->error_code == 0 && response->reply_text)
+    {
+        ai_conv_add_turn(user_message, response->reply_text);
     }
+    
+    AI_TRACE_END("chat", ret == RT_EOK);
+    ai_conv_unlock();
+    
+    return ret;
+}
+
+/* 通用对话接口 */
+int ai_chat_service_chat(const char *user_message, ai_chat_response_t *response)
+{
+    return chat_request(user_message, RT_NULL, response);
+}
+
+/* 流式对话接口 */
+int ai_chat_service_chat_stream(const char *user_message, ai_chat_delta_cb on_delta,
+                                void *user_data, ai_chat_response_t *response)
+{
+    chat_stream_t *cs;
+    int ret;
+    
+    if (on_delta == RT_NULL)
+    {
+        return -RT_EINVAL;
+    }
+    
+    /* SSE事件缓冲区较大，不放在线程栈上 */
+    cs = (chat_stream_t *)ai_arena_alloc(sizeof(chat_stream_t));
+    if (cs == RT_NULL)
+    {
+        LOG_E("Failed to allocate stream state");
+        return -RT_ENOMEM;
+    }
+    rt_memset(cs, 0, sizeof(chat_stream_t));
+    cs->on_delta = on_delta;
+    cs->user_data = user_data;
+    
+    ret = chat_request(user_message, cs, response);
+    
+    ai_arena_free(cs);
+    
+    return ret;
 }
 
 /* 释放响应数据 */
@@ -404,12 +650,12 @@ void ai_chat_service_free_response(ai_chat_response_t *response)
     {
         if (response->reply_text)
         {
-            rt_free(response->reply_text);
+            ai_arena_free(response->reply_text);
             response->reply_text = RT_NULL;
         }
         if (response->error_msg)
         {
-            rt_free(response->error_msg);
+            ai_arena_free(response->error_msg);
             response->error_msg = RT_NULL;
         }
         response->error_code = 0;
@@ -39,11 +39,24 @@ typedef struct {
     int error_code;
     char *reply_text;         /* AI回复的文本 */
     char *error_msg;          /* 错误信息 */
+    uint32_t first_token_ms;  /* 流式对话：从发出请求到收到第一段回复的时间 */
 } ai_chat_response_t;
 
+/* 流式回复的一段文本：不以0结尾，只在回调期间有效；返回非RT_EOK时中止接收 */
+typedef int (*ai_chat_delta_cb)(const char *text, uint32_t len, void *user_data);
+
 /* 对话AI接口 */
 int ai_chat_service_init(ai_chat_config_t *config);
+int ai_chat_service_get_config(ai_chat_config_t *config);
 int ai_chat_service_chat(const char *user_message, ai_chat_response_t *response);
+
+/*
+ * 流式对话：请求带 "stream":true，回复按SSE事件逐段交给on_delta，下游可以边收边合成；
+ * 返回后response中是完整的回复（与ai_chat_service_chat相同）。
+ * 服务器不支持流式、返回普通JSON时，回复同样逐段交给on_delta
+ */
+int ai_chat_service_chat_stream(const char *user_message, ai_chat_delta_cb on_delta,
+                                void *user_data, ai_chat_response_t *response);
 void ai_chat_service_free_response(ai_chat_response_t *response);
 
 /* 设置系统提示词（定义AI的角色和行为）*/
@@ -6,13 +6,25 @@
  * Change Logs:
  * Date           Author       Notes
  * 2024-10-16     AI Assistant first version - AI Cloud Service Implementation
+ * 2024-10-27     AI Assistant Report the TTS sample rate from Content-Type or WAV header
+ * 2024-10-27     AI Assistant Decode IMA ADPCM/MP3 TTS audio while streaming
+ * 2024-10-27     AI Assistant Serve repeated TTS phrases from the SD card cache
+ * 2024-10-27     AI Assistant Add latency trace points for STT, TTS and decoding
+ * 2024-10-27     AI Assistant Drop MP3 decoding, always request PCM from Baidu/iFlytek
+ * 2024-10-27     AI Assistant Synthesize the echo prefix separately so it is served from the TTS cache
  */
 
 #include <rtthread.h>
 #include <string.h>
 #include <stdlib.h>
 #include "ai_cloud_service.h"
+#include "ai_chat_service.h"
 #include "web_client.h"
+#include "json_stream.h"
+#include "base64_codec.h"
+#include "ai_arena.h"
+#include "tts_cache.h"
+#include "ai_trace.h"
 
 #define DBG_TAG "ai.cloud"
 #define DBG_LVL DBG_INFO
@@ -22,93 +34,89 @@
 static ai_service_config_t g_ai_config = {0};
 static rt_bool_t g_ai_initialized = RT_FALSE;
 
-/* Base64编码表 */
-static const char base64_table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+/* STT流式上传时每次编码的PCM字节数（必须是3的倍数）*/
+#define STT_ENCODE_CHUNK    192
 
-/* Base64编码 */
-static char *base64_encode(const uint8_t *data, uint32_t data_len)
+/* TTS流式解码时每次交给输出回调的最大字节数 */
+#define TTS_DECODE_CHUNK    384
+
+/* 缓冲式TTS的初始音频缓冲区，按需倍增 */
+#define TTS_BUFFER_INIT     (16 * 1024)
+
+#define AI_TICK_TO_MS(tick) ((tick) * 1000 / RT_TICK_PER_SECOND)
+
+/* 识别结果在响应中的位置 */
+static const char *const stt_result_paths[] = {"result[0]"};
+
+/* 初始化AI云服务 */
+int ai_cloud_service_init(ai_service_config_t *config)
 {
-    uint32_t encoded_len = ((data_len + 2) / 3) * 4;
-    char *encoded = (char *)rt_malloc(encoded_len + 1);
-    
-    if (encoded == RT_NULL)
+    if (config == RT_NULL)
     {
-        return RT_NULL;
+        LOG_E("Invalid configuration");
+        return -RT_EINVAL;
     }
     
-    uint32_t i, j;
-    for (i = 0, j = 0; i < data_len;)
-    {
-        uint32_t octet_a = i < data_len ? data[i++] : 0;
-        uint32_t octet_b = i < data_len ? data[i++] : 0;
-        uint32_t octet_c = i < data_len ? data[i++] : 0;
-        uint32_t triple = (octet_a << 16) + (octet_b << 8) + octet_c;
-        
-        encoded[j++] = base64_table[(triple >> 18) & 0x3F];
-        encoded[j++] = base64_table[(triple >> 12) & 0x3F];
-        encoded[j++] = base64_table[(triple >> 6) & 0x3F];
-        encoded[j++] = base64_table[triple & 0x3F];
-    }
+    rt_memcpy(&g_ai_config, config, sizeof(ai_service_config_t));
+    g_ai_initialized = RT_TRUE;
     
-    /* 添加填充 */
-    for (i = 0; i < (3 - data_len % 3) % 3; i++)
-    {
-        encoded[encoded_len - 1 - i] = '=';
-    }
+    LOG_I("AI cloud service initialized (Provider: %d)", config->provider);
     
-    encoded[encoded_len] = '\0';
-    return encoded;
+    return RT_EOK;
 }
 
-/* Base64解码 */
-static uint8_t *base64_decode(const char *encoded, uint32_t *decoded_len)
+/* 获取当前配置（测试命令临时切换服务器时保存/恢复）*/
+int ai_cloud_service_get_config(ai_service_config_t *config)
 {
-    uint32_t encoded_len = strlen(encoded);
-    uint32_t output_len = encoded_len / 4 * 3;
-    
-    if (encoded[encoded_len - 1] == '=') output_len--;
-    if (encoded[encoded_len - 2] == '=') output_len--;
-    
-    uint8_t *decoded = (uint8_t *)rt_malloc(output_len);
-    if (decoded == RT_NULL)
-    {
-        return RT_NULL;
-    }
-    
-    uint32_t i, j;
-    for (i = 0, j = 0; i < encoded_len;)
+    if (config == RT_NULL || !g_ai_initialized)
     {
-        uint32_t sextet_a = encoded[i] == '=' ? 0 & i++ : strchr(base64_table, encoded[i++]) - base64_table;
-        uint32_t sextet_b = encoded[i] == '=' ? 0 & i++ : strchr(base64_table, encoded[i++]) - base64_table;
-        uint32_t sextet_c = encoded[i] == '=' ? 0 & i++ : strchr(base64_table, encoded[i++]) - base64_table;
-        uint32_t sextet_d = encoded[i] == '=' ? 0 & i++ : strchr(base64_table, encoded[i++]) - base64_table;
-        
-        uint32_t triple = (sextet_a << 18) + (sextet_b << 12) + (sextet_c << 6) + sextet_d;
-        
-        if (j < output_len) decoded[j++] = (triple >> 16) & 0xFF;
-        if (j < output_len) decoded[j++] = (triple >> 8) & 0xFF;
-        if (j < output_len) decoded[j++] = triple & 0xFF;
+        return -RT_ERROR;
     }
     
-    *decoded_len = output_len;
-    return decoded;
+    rt_memcpy(config, &g_ai_config, sizeof(ai_service_config_t));
+    return RT_EOK;
 }
 
-/* 初始化AI云服务 */
-int ai_cloud_service_init(ai_service_config_t *config)
+/* STT请求体流式写出上下文 */
+typedef struct {
+    const char *prefix;
+    uint32_t prefix_len;
+    const uint8_t *audio;
+    uint32_t audio_len;
+    const char *suffix;
+    uint32_t suffix_len;
+} stt_stream_ctx_t;
+
+/* 写出STT请求体：JSON前缀 + 分块Base64音频 + JSON后缀 */
+static int stt_body_writer(web_client_stream_t *stream, void *user_data)
 {
-    if (config == RT_NULL)
+    stt_stream_ctx_t *ctx = (stt_stream_ctx_t *)user_data;
+    char encoded[STT_ENCODE_CHUNK / 3 * 4];
+    uint32_t offset = 0;
+    
+    if (web_client_stream_write(stream, ctx->prefix, ctx->prefix_len) != RT_EOK)
     {
-        LOG_E("Invalid configuration");
-        return -RT_EINVAL;
+        return -RT_ERROR;
     }
     
-    rt_memcpy(&g_ai_config, config, sizeof(ai_service_config_t));
-    g_ai_initialized = RT_TRUE;
-    
-    LOG_I("AI cloud service initialized (Provider: %d)", config->provider);
+    /* 只有最后一块可能不是3的倍数，因此填充只出现在末尾 */
+    while (offset < ctx->audio_len)
+    {
+        uint32_t n = ctx->audio_len - offset;
+        if (n > STT_ENCODE_CHUNK)
+        {
+            n = STT_ENCODE_CHUNK;
+        }
+        
+        uint32_t encoded_len = base64_encode(ctx->audio + offset, n, encoded);
+        if (web_client_stream_write(stream, encoded, encoded_len) != RT_EOK)
+        {
+            return -RT_ERROR;
+        }
+        offset += n;
+    }
     
-    return RT_EOK;
+    return web_client_stream_write(stream, ctx->suffix, ctx->suffix_len);
 }
 
 /* 语音识别（Speech to Text）*/
@@ -116,8 +124,9 @@ int ai_cloud_service_speech_to_text(const uint8_t *audio_data, uint32_t audio_le
                                      ai_response_t *response)
 {
     http_response_t http_resp;
-    char *json_data = RT_NULL;
-    char *audio_base64 = RT_NULL;
+    stt_stream_ctx_t ctx;
+    char prefix[384];
+    char suffix[128];
     int ret = -RT_ERROR;
     
     if (!g_ai_initialized)
@@ -136,98 +145,66 @@ int ai_cloud_service_speech_to_text(const uint8_t *audio_data, uint32_t audio_le
     
     LOG_I("Starting speech to text (audio_len: %d bytes)", audio_len);
     
-    /* 将音频数据编码为Base64 */
-    audio_base64 = base64_encode(audio_data, audio_len);
-    if (audio_base64 == RT_NULL)
-    {
-        LOG_E("Failed to encode audio data");
-        return -RT_ERROR;
-    }
-    
-    /* 构造JSON请求数据 */
+    /* 构造JSON前缀和后缀，音频Base64在发送时分块编码，不再整体缓存 */
     /* 注意：这里需要根据具体的AI服务提供商构造不同的JSON格式 */
-    /* 以下是一个通用的示例格式 */
-    json_data = (char *)rt_malloc(audio_len * 2 + 512);
-    if (json_data == RT_NULL)
-    {
-        LOG_E("Failed to allocate JSON buffer");
-        rt_free(audio_base64);
-        return -RT_ERROR;
-    }
-    
     if (g_ai_config.provider == AI_SERVICE_BAIDU)
     {
         /* 百度AI格式 */
-        rt_snprintf(json_data, audio_len * 2 + 512,
+        ctx.prefix_len = rt_snprintf(prefix, sizeof(prefix),
                     "{\"format\":\"pcm\",\"rate\":16000,\"channel\":1,"
-                    "\"cuid\":\"%s\",\"token\":\"%s\",\"speech\":\"%s\",\"len\":%d}",
-                    g_ai_config.app_id, g_ai_config.api_key, audio_base64, audio_len);
+                    "\"cuid\":\"%s\",\"token\":\"%s\",\"speech\":\"",
+                    g_ai_config.app_id, g_ai_config.api_key);
+        ctx.suffix_len = rt_snprintf(suffix, sizeof(suffix), "\",\"len\":%d}", audio_len);
     }
     else if (g_ai_config.provider == AI_SERVICE_XFYUN)
     {
         /* 讯飞格式 */
-        rt_snprintf(json_data, audio_len * 2 + 512,
+        ctx.prefix_len = rt_snprintf(prefix, sizeof(prefix),
                     "{\"common\":{\"app_id\":\"%s\"},\"business\":{\"language\":\"zh_cn\","
                     "\"domain\":\"iat\",\"accent\":\"mandarin\"},\"data\":{\"status\":2,"
                     "\"format\":\"audio/L16;rate=16000\",\"encoding\":\"raw\","
-                    "\"audio\":\"%s\"}}",
-                    g_ai_config.app_id, audio_base64);
+                    "\"audio\":\"",
+                    g_ai_config.app_id);
+        ctx.suffix_len = rt_snprintf(suffix, sizeof(suffix), "\"}}");
     }
     else
     {
         /* 通用格式 */
-        rt_snprintf(json_data, audio_len * 2 + 512,
-                    "{\"audio_data\":\"%s\",\"audio_len\":%d,\"format\":\"pcm\","
+        ctx.prefix_len = rt_snprintf(prefix, sizeof(prefix), "{\"audio_data\":\"");
+        ctx.suffix_len = rt_snprintf(suffix, sizeof(suffix),
+                    "\",\"audio_len\":%d,\"format\":\"pcm\","
                     "\"sample_rate\":16000,\"channels\":1}",
-                    audio_base64, audio_len);
+                    audio_len);
     }
     
-    /* 发送HTTP POST请求 */
-    ret = web_client_post(g_ai_config.api_url, json_data, strlen(json_data),
-                          "application/json", &http_resp);
+    ctx.prefix = prefix;
+    ctx.suffix = suffix;
+    ctx.audio = audio_data;
+    ctx.audio_len = audio_len;
+    
+    /* 发送HTTP POST请求（Content-Length预先计算）*/
+    AI_TRACE_BEGIN("stt");
+    ret = web_client_post_stream(g_ai_config.api_url, "application/json",
+                                 ctx.prefix_len + ((audio_len + 2) / 3) * 4 + ctx.suffix_len,
+                                 stt_body_writer, &ctx, &http_resp);
     
     if (ret == RT_EOK && http_resp.status_code == 200)
     {
         LOG_I("Speech to text successful");
         
-        /* 解析JSON响应 */
-        /* 注意：这里需要一个完整的JSON解析器，简化处理只提取关键字段 */
-        /* 建议集成cJSON或jsmn等JSON库 */
-        
-        /* 临时简化处理：假设返回格式为 {"result":["识别结果"]} */
-        char *result_start = strstr(http_resp.body, "\"result\"");
-        if (result_start)
+        /* 识别结果格式：{"result":["识别结果"], ...} */
+        response->text_result = json_stream_extract(http_resp.body, http_resp.body_len, stt_result_paths, 1);
+        if (response->text_result)
         {
-            char *text_start = strchr(result_start, '[');
-            if (text_start)
-            {
-                text_start = strchr(text_start, '\"');
-                if (text_start)
-                {
-                    text_start++;
-                    char *text_end = strchr(text_start, '\"');
-                    if (text_end)
-                    {
-                        int text_len = text_end - text_start;
-                        response->text_result = (char *)rt_malloc(text_len + 1);
-                        if (response->text_result)
-                        {
-                            rt_memcpy(response->text_result, text_start, text_len);
-                            response->text_result[text_len] = '\0';
-                            response->error_code = 0;
-                            
-                            LOG_I("Recognized text: %s", response->text_result);
-                        }
-                    }
-                }
-            }
+            response->error_code = 0;
+            LOG_I("Recognized text: %s", response->text_result);
         }
         
         if (response->text_result == RT_NULL)
         {
             LOG_W("Failed to parse response, raw: %s", http_resp.body);
             response->error_code = -1;
-            response->error_msg = rt_strdup("Failed to parse response");
+            response->error_msg = ai_arena_strdup("Failed to parse response");
         }
         
         web_client_free_response(&http_resp);
@@ -236,106 +213,734 @@ int ai_cloud_service_speech_to_text(const uint8_t *audio_data, uint32_t audio_le
     {
         LOG_E("HTTP request failed (status: %d)", http_resp.status_code);
         response->error_code = http_resp.status_code;
-        response->error_msg = rt_strdup("HTTP request failed");
+        response->error_msg = ai_arena_strdup("HTTP request failed");
         web_client_free_response(&http_resp);
     }
-    
-    rt_free(audio_base64);
-    rt_free(json_data);
+    AI_TRACE_END("stt", http_resp.status_code);
     
     return ret;
 }
 
-/* 语音合成（Text to Speech）*/
-int ai_cloud_service_text_to_speech(const char *text, ai_response_t *response)
+/* 各服务商的发音人，也是TTS缓存键的一部分 */
+#define TTS_BAIDU_PER       "0"
+#define TTS_XFYUN_VCN       "xiaoyan"
+
+/* TTS响应体格式 */
+enum {
+    TTS_BODY_UNKNOWN = 0,
+    TTS_BODY_RAW,               /* 原始PCM */
+    TTS_BODY_BASE64,            /* Base64编码的PCM */
+    TTS_BODY_ERROR              /* JSON错误信息或非200响应 */
+};
+
+/* WAV头解析状态：音频数据可能带WAV头（原始或Base64编码），头部可能被分在多段中 */
+enum {
+    TTS_WAV_DETECT = 0,         /* 收集前12字节判断是否为RIFF/WAVE */
+    TTS_WAV_CHUNK,              /* 收集8字节块头 */
+    TTS_WAV_FMT,                /* 收集fmt块的前16字节（格式、声道、采样率、块长度）*/
+    TTS_WAV_SKIP,               /* 跳过块数据 */
+    TTS_WAV_PCM                 /* data块或非WAV数据：原样输出 */
+};
+
+/* TTS响应体增量处理上下文 */
+typedef struct {
+    ai_audio_sink_t sink;
+    void *user_data;
+    ai_response_t *response;
+    rt_tick_t start;
+    int format;
+    int sink_ret;
+    base64_decoder_t base64;    /* 跨段的Base64比特 */
+    uint8_t odd_byte;           /* 跨段的半个样本 */
+    rt_bool_t has_odd;
+    int wav_state;
+    uint8_t wav_buf[16];        /* 跨段的RIFF头、块头或fmt块 */
+    uint32_t wav_have;
+    uint32_t wav_skip;
+    uint16_t wav_format;        /* fmt块中的格式：1为PCM，0x11为IMA ADPCM */
+    uint16_t wav_channels;
+    uint16_t wav_block_align;
+    audio_dec_t *dec;           /* 压缩音频的解码器，PCM时为空 */
+    tts_cache_file_t *cache;    /* 未命中时同时写入缓存，为空表示不缓存 */
+    char error[128];
+    uint32_t error_len;
+} tts_stream_ctx_t;
+
+/* 缓冲式TTS的输出：拼接全部音频 */
+typedef struct {
+    uint8_t *data;
+    uint32_t len;
+    uint32_t size;
+} tts_buffer_t;
+
+/* 构造TTS请求JSON：百度、讯飞的压缩格式只有MP3，不能解码，总是请求PCM；通用格式按 AI_TTS_CODEC 请求 */
+static void tts_build_request(const char *text, char *json_data, uint32_t size)
 {
-    http_response_t http_resp;
-    char json_data[1024];
-    int ret = -RT_ERROR;
-    
-    if (!g_ai_initialized)
-    {
-        LOG_E("AI service not initialized");
-        return -RT_ERROR;
-    }
-    
-    if (text == RT_NULL || response == RT_NULL)
-    {
-        LOG_E("Invalid parameters");
-        return -RT_EINVAL;
-    }
-    
-    rt_memset(response, 0, sizeof(ai_response_t));
+    audio_codec_t codec = AI_TTS_CODEC;
     
-    LOG_I("Starting text to speech: %s", text);
-    
-    /* 构造JSON请求数据 */
     if (g_ai_config.provider == AI_SERVICE_BAIDU)
     {
-        /* 百度AI格式 */
-        rt_snprintf(json_data, sizeof(json_data),
+        /* 百度AI格式：aue 4为16kHz PCM */
+        rt_snprintf(json_data, size,
                     "{\"tex\":\"%s\",\"tok\":\"%s\",\"cuid\":\"%s\","
-                    "\"ctp\":1,\"lan\":\"zh\",\"spd\":5,\"pit\":5,\"vol\":5,\"per\":0}",
+                    "\"ctp\":1,\"lan\":\"zh\",\"spd\":5,\"pit\":5,\"vol\":5,\"per\":" TTS_BAIDU_PER ",\"aue\":4}",
                     text, g_ai_config.api_key, g_ai_config.app_id);
     }
     else if (g_ai_config.provider == AI_SERVICE_XFYUN)
     {
-        /* 讯飞格式 */
-        rt_snprintf(json_data, sizeof(json_data),
+        /* 讯飞格式：raw为PCM */
+        rt_snprintf(json_data, size,
                     "{\"common\":{\"app_id\":\"%s\"},\"business\":{\"aue\":\"raw\","
-                    "\"auf\":\"audio/L16;rate=16000\",\"vcn\":\"xiaoyan\",\"speed\":50},"
+                    "\"auf\":\"audio/L16;rate=16000\",\"vcn\":\"" TTS_XFYUN_VCN "\",\"speed\":50},"
                     "\"data\":{\"status\":2,\"text\":\"%s\"}}",
                     g_ai_config.app_id, text);
     }
     else
     {
         /* 通用格式 */
-        rt_snprintf(json_data, sizeof(json_data),
-                    "{\"text\":\"%s\",\"format\":\"pcm\",\"sample_rate\":16000}",
-                    text);
+        rt_snprintf(json_data, size,
+                    "{\"text\":\"%s\",\"format\":\"%s\",\"sample_rate\":16000}",
+                    text, audio_codec_name(codec));
     }
+}
+
+/* TTS缓存的发音人标识：服务商、发音人和合成地址，任一项不同时音频不同 */
+static void tts_voice_id(char *voice, uint32_t size)
+{
+    const char *url = g_ai_config.tts_url[0] ? g_ai_config.tts_url : g_ai_config.api_url;
+    const char *name = "";
     
-    /* 发送HTTP POST请求 */
-    ret = web_client_post(g_ai_config.api_url, json_data, strlen(json_data),
-                          "application/json", &http_resp);
+    if (g_ai_config.provider == AI_SERVICE_BAIDU)
+    {
+        name = TTS_BAIDU_PER;
+    }
+    else if (g_ai_config.provider == AI_SERVICE_XFYUN)
+    {
+        name = TTS_XFYUN_VCN;
+    }
     
-    if (ret == RT_EOK && http_resp.status_code == 200)
+    rt_snprintf(voice, size, "%d/%s/%08x", g_ai_config.provider, name,
+                (uint32_t)tts_cache_hash(url, strlen(url), 0));
+}
+
+/* 交给sink，未命中缓存时同时写入缓存 */
+static void tts_deliver(tts_stream_ctx_t *ctx, const uint8_t *pcm, uint32_t len)
+{
+    ctx->sink_ret = ctx->sink(pcm, len, ctx->user_data);
+    ctx->response->audio_len += len;
+    if (ctx->cache != RT_NULL && ctx->sink_ret == RT_EOK)
+    {
+        tts_cache_write(ctx->cache, pcm, len);
+    }
+}
+
+/* 输出一段PCM：保证交给回调的长度为偶数，奇数字节留到下一段 */
+static int tts_output(tts_stream_ctx_t *ctx, const uint8_t *data, uint32_t len)
+{
+    ai_response_t *response = ctx->response;
+    uint32_t even;
+    
+    if (len == 0 || ctx->sink_ret != RT_EOK)
     {
-        LOG_I("Text to speech successful (audio_len: %d)", http_resp.body_len);
+        return ctx->sink_ret;
+    }
+    
+    if (response->audio_len == 0)
+    {
+        AI_TRACE_INSTANT("tts first audio", response->sample_rate);
+        response->first_audio_ms = AI_TICK_TO_MS(rt_tick_get() - ctx->start);
+        if (response->sample_rate != AI_TTS_SAMPLE_RATE)
+        {
+            LOG_I("TTS audio is %d Hz", response->sample_rate);
+        }
+    }
+    
+    if (ctx->has_odd)
+    {
+        uint8_t pair[2] = {ctx->odd_byte, data[0]};
+        
+        ctx->has_odd = RT_FALSE;
+        tts_deliver(ctx, pair, 2);
+        data++;
+        len--;
+    }
+    
+    even = len & ~1U;
+    if (even > 0 && ctx->sink_ret == RT_EOK)
+    {
+        tts_deliver(ctx, data, even);
+    }
+    
+    if (len & 1)
+    {
+        ctx->odd_byte = data[len - 1];
+        ctx->has_odd = RT_TRUE;
+    }
+    
+    return ctx->sink_ret;
+}
+
+/* 解码器输出：采样率取自WAV头，在交给sink之前更新 */
+static int tts_dec_output(const int16_t *pcm, uint32_t samples, void *user_data)
+{
+    tts_stream_ctx_t *ctx = (tts_stream_ctx_t *)user_data;
+    
+    ctx->response->sample_rate = ctx->dec->sample_rate;
+    return tts_output(ctx, (const uint8_t *)pcm, samples * sizeof(int16_t));
+}
+
+/* 响应是压缩音频：从内存池分配解码器（约6KB），请求结束时释放 */
+static int tts_decoder_open(tts_stream_ctx_t *ctx, audio_codec_t codec, uint32_t channels, uint32_t block_align)
+{
+    ctx->dec = (audio_dec_t *)ai_arena_alloc(sizeof(audio_dec_t));
+    if (ctx->dec == RT_NULL)
+    {
+        LOG_E("No memory for %s decoder", audio_codec_name(codec));
+        ctx->sink_ret = -RT_ENOMEM;
+        return ctx->sink_ret;
+    }
+    
+    if (audio_dec_init(ctx->dec, codec, ctx->response->sample_rate, channels, block_align) != 0)
+    {
+        /* 包括MP3：不解码，报错而不是把压缩数据当作PCM播放 */
+        LOG_E("Unsupported TTS audio: %s, %d channels, block %d",
+              audio_codec_name(codec), channels, block_align);
+        ai_arena_free(ctx->dec);
+        ctx->dec = RT_NULL;
+        ctx->sink_ret = -RT_ERROR;
+        return ctx->sink_ret;
+    }
+    
+    ctx->response->codec = codec;
+    return RT_EOK;
+}
+
+/* 音频数据：压缩格式先解码，PCM直接输出 */
+static int tts_decode_audio(tts_stream_ctx_t *ctx, const uint8_t *data, uint32_t len)
+{
+    if (ctx->dec == RT_NULL)
+    {
+        return tts_output(ctx, data, len);
+    }
+    
+    if (len > 0 && ctx->sink_ret == RT_EOK)
+    {
+        /* 解码输出直接交给播放，时间段中包含写入播放器的时间 */
+        AI_TRACE_BEGIN("tts decode");
+        audio_dec_feed(ctx->dec, data, len, tts_dec_output, ctx);
+        AI_TRACE_END("tts decode", len);
+    }
+    return ctx->sink_ret;
+}
+
+/* 处理收集满的RIFF头/块头/fmt块，非WAV数据把收集的字节作为音频输出 */
+static int tts_wav_header(tts_stream_ctx_t *ctx)
+{
+    const uint8_t *buf = ctx->wav_buf;
+    uint32_t size = buf[4] | (buf[5] << 8) | (buf[6] << 16) | ((uint32_t)buf[7] << 24);
+    
+    ctx->wav_have = 0;
+    switch (ctx->wav_state)
+    {
+    case TTS_WAV_DETECT:
+        if (rt_memcmp(buf, "RIFF", 4) == 0 && rt_memcmp(buf + 8, "WAVE", 4) == 0)
+        {
+            ctx->wav_state = TTS_WAV_CHUNK;
+            return RT_EOK;
+        }
+        ctx->wav_state = TTS_WAV_PCM;
+        /* 未声明类型的MP3：以ID3标签开头，按不支持的格式报错 */
+        if (ctx->dec == RT_NULL && rt_memcmp(buf, "ID3", 3) == 0 &&
+            tts_decoder_open(ctx, AUDIO_CODEC_MP3, 0, 0) != RT_EOK)
+        {
+            return ctx->sink_ret;
+        }
+        return tts_decode_audio(ctx, buf, 12);
+        
+    case TTS_WAV_CHUNK:
+        /* data块的长度不使用，流式WAV常填0或0xFFFFFFFF */
+        if (rt_memcmp(buf, "data", 4) == 0)
+        {
+            ctx->wav_state = TTS_WAV_PCM;
+            if (ctx->wav_format == 0x11)
+            {
+                return tts_decoder_open(ctx, AUDIO_CODEC_IMA_ADPCM, ctx->wav_channels, ctx->wav_block_align);
+            }
+            if (ctx->wav_format > 1)
+            {
+                LOG_W("Unknown WAV format 0x%x, played as PCM", ctx->wav_format);
+            }
+            return RT_EOK;
+        }
+        ctx->wav_skip = size + (size & 1);
+        if (rt_memcmp(buf, "fmt ", 4) == 0 && ctx->wav_skip >= 16)
+        {
+            ctx->wav_skip -= 16;
+            ctx->wav_state = TTS_WAV_FMT;
+            return RT_EOK;
+        }
+        break;
+        
+    default:
+        /* fmt块：格式(2) 声道(2) 采样率(4) 字节率(4) 块长度(2) 位数(2) */
+        ctx->wav_format = buf[0] | (buf[1] << 8);
+        ctx->wav_channels = buf[2] | (buf[3] << 8);
+        ctx->wav_block_align = buf[12] | (buf[13] << 8);
+        ctx->response->sample_rate = size;
+        break;
+    }
+    
+    ctx->wav_state = ctx->wav_skip ? TTS_WAV_SKIP : TTS_WAV_CHUNK;
+    return RT_EOK;
+}
+
+/* 输出解码后的音频数据：去掉WAV头（取其中的格式和采样率），其余交给tts_decode_audio */
+static int tts_emit(tts_stream_ctx_t *ctx, const uint8_t *data, uint32_t len)
+{
+    ctx->response->encoded_len += len;
+    
+    while (len > 0 && ctx->wav_state != TTS_WAV_PCM)
+    {
+        uint32_t need = (ctx->wav_state == TTS_WAV_DETECT) ? 12 : (ctx->wav_state == TTS_WAV_FMT) ? 16 : 8;
+        uint32_t n;
+        
+        if (ctx->wav_state == TTS_WAV_DETECT && ctx->wav_have == 0 && data[0] != 'R' && data[0] != 'I')
+        {
+            ctx->wav_state = TTS_WAV_PCM;
+            break;
+        }
         
-        /* 检查响应是否为音频数据 */
-        if (http_resp.body_len > 0)
+        if (ctx->wav_state == TTS_WAV_SKIP)
         {
-            /* 如果返回的是Base64编码的音频 */
-            if (http_resp.body[0] != 0xFF && http_resp.body[0] != 0x00)
+            n = len < ctx->wav_skip ? len : ctx->wav_skip;
+            ctx->wav_skip -= n;
+            if (ctx->wav_skip == 0)
+            {
+                ctx->wav_state = TTS_WAV_CHUNK;
+            }
+        }
+        else
+        {
+            n = need - ctx->wav_have;
+            if (n > len)
+            {
+                n = len;
+            }
+            rt_memcpy(ctx->wav_buf + ctx->wav_have, data, n);
+            ctx->wav_have += n;
+            if (ctx->wav_have == need && tts_wav_header(ctx) != RT_EOK)
             {
-                /* 尝试解码Base64 */
-                uint32_t decoded_len;
-                response->audio_result = (char *)base64_decode(http_resp.body, &decoded_len);
-                response->audio_len = decoded_len;
+                return ctx->sink_ret;
             }
-            else
+        }
+        data += n;
+        len -= n;
+    }
+    
+    return tts_decode_audio(ctx, data, len);
+}
+
+/* 增量Base64解码：跳过换行、引号等非编码字符，每段输入不超过输出缓冲区大小 */
+static int tts_decode_base64(tts_stream_ctx_t *ctx, const uint8_t *data, uint32_t len)
+{
+    uint8_t out[TTS_DECODE_CHUNK];
+    
+    while (len > 0)
+    {
+        uint32_t n = len > TTS_DECODE_CHUNK ? TTS_DECODE_CHUNK : len;
+        uint32_t out_len = base64_decode_update(&ctx->base64, (const char *)data, n, out);
+        
+        if (tts_emit(ctx, out, out_len) != RT_EOK)
+        {
+            return ctx->sink_ret;
+        }
+        data += n;
+        len -= n;
+    }
+    
+    return RT_EOK;
+}
+
+/* 从Content-Type（如 audio/L16;rate=24000）中取采样率，未声明返回0 */
+static uint32_t tts_parse_rate(const char *content_type)
+{
+    const char *rate = strstr(content_type, "rate=");
+    
+    if (rate == RT_NULL)
+    {
+        return 0;
+    }
+    
+    return (uint32_t)atoi(rate + 5);
+}
+
+/* 响应体到达：第一段决定格式和采样率，之后边收边解码边输出 */
+static int tts_body_reader(web_client_resp_stream_t *resp, const uint8_t *data,
+                           uint32_t len, void *user_data)
+{
+    tts_stream_ctx_t *ctx = (tts_stream_ctx_t *)user_data;
+    
+    if (ctx->format == TTS_BODY_UNKNOWN)
+    {
+        if (resp->status_code != 200 || strncmp(resp->content_type, "application/json", 16) == 0)
+        {
+            ctx->format = TTS_BODY_ERROR;
+        }
+        else if (strncmp(resp->content_type, "audio/", 6) == 0 ||
+                 strncmp(resp->content_type, "application/octet-stream", 24) == 0)
+        {
+            ctx->format = TTS_BODY_RAW;
+        }
+        else if (data[0] != 0xFF && data[0] != 0x00 && !(len >= 4 && rt_memcmp(data, "RIFF", 4) == 0) &&
+                 !(len >= 3 && rt_memcmp(data, "ID3", 3) == 0))
+        {
+            /* 未声明类型时沿用原来的判断：非0xFF/0x00开头（且不是WAV、MP3）视为Base64 */
+            ctx->format = TTS_BODY_BASE64;
+        }
+        else
+        {
+            ctx->format = TTS_BODY_RAW;
+        }
+        
+        if (ctx->format != TTS_BODY_ERROR)
+        {
+            uint32_t rate = tts_parse_rate(resp->content_type);
+            
+            if (rate != 0)
             {
-                /* 直接是原始音频数据 */
-                response->audio_result = (char *)rt_malloc(http_resp.body_len);
-                if (response->audio_result)
-                {
-                    rt_memcpy(response->audio_result, http_resp.body, http_resp.body_len);
-                    response->audio_len = http_resp.body_len;
-                }
+                ctx->response->sample_rate = rate;
             }
             
-            response->error_code = 0;
+            if ((strncmp(resp->content_type, "audio/mpeg", 10) == 0 ||
+                 strncmp(resp->content_type, "audio/mp3", 9) == 0) &&
+                tts_decoder_open(ctx, AUDIO_CODEC_MP3, 0, 0) != RT_EOK)
+            {
+                return ctx->sink_ret;
+            }
         }
+    }
+    
+    switch (ctx->format)
+    {
+    case TTS_BODY_RAW:
+        return tts_emit(ctx, data, len);
         
-        web_client_free_response(&http_resp);
+    case TTS_BODY_BASE64:
+        return tts_decode_base64(ctx, data, len);
+        
+    default:
+        /* 错误信息只保留开头部分 */
+        if (ctx->error_len < sizeof(ctx->error) - 1)
+        {
+            uint32_t copy = sizeof(ctx->error) - 1 - ctx->error_len;
+            if (copy > len)
+            {
+                copy = len;
+            }
+            rt_memcpy(ctx->error + ctx->error_len, data, copy);
+            ctx->error_len += copy;
+            ctx->error[ctx->error_len] = '\0';
+        }
+        return RT_EOK;
+    }
+}
+
+/* 缓冲式TTS的输出回调 */
+static int tts_buffer_sink(const uint8_t *pcm, uint32_t len, void *user_data)
+{
+    tts_buffer_t *buffer = (tts_buffer_t *)user_data;
+    
+    if (buffer->len + len > buffer->size)
+    {
+        uint32_t size = buffer->size ? buffer->size : TTS_BUFFER_INIT;
+        uint8_t *data;
+        
+        while (size < buffer->len + len)
+        {
+            size *= 2;
+        }
+        
+        data = (uint8_t *)ai_arena_realloc(buffer->data, size);
+        if (data == RT_NULL)
+        {
+            LOG_E("No memory for TTS audio (%d bytes)", size);
+            return -RT_ENOMEM;
+        }
+        buffer->data = data;
+        buffer->size = size;
+    }
+    
+    rt_memcpy(buffer->data + buffer->len, pcm, len);
+    buffer->len += len;
+    
+    return RT_EOK;
+}
+
+/* 从TTS缓存播放；读出错且还没有输出音频时返回-RT_EIO，由调用者改走网络 */
+static int tts_play_cached(tts_stream_ctx_t *ctx, tts_cache_file_t *file, uint32_t sample_rate)
+{
+    ai_response_t *response = ctx->response;
+    const uint8_t *data;
+    int len;
+    
+    response->sample_rate = sample_rate;
+    response->cached = RT_TRUE;
+    
+    AI_TRACE_BEGIN("tts cache");
+    while ((len = tts_cache_read(file, &data)) > 0)
+    {
+        if (tts_output(ctx, data, (uint32_t)len) != RT_EOK)
+        {
+            break;
+        }
+    }
+    tts_cache_close(file);
+    AI_TRACE_END("tts cache", response->audio_len);
+    response->total_ms = AI_TICK_TO_MS(rt_tick_get() - ctx->start);
+    
+    if (len < 0 && response->audio_len == 0)
+    {
+        response->sample_rate = AI_TTS_SAMPLE_RATE;
+        response->cached = RT_FALSE;
+        return -RT_EIO;
+    }
+    if (len < 0 || ctx->sink_ret != RT_EOK)
+    {
+        response->error_code = -1;
+        return -RT_ERROR;
+    }
+    
+    LOG_I("Text to speech from cache (audio_len: %d, first audio: %d ms, total: %d ms)",
+          response->audio_len, response->first_audio_ms, response->total_ms);
+    return RT_EOK;
+}
+
+/* 先查TTS缓存，未命中或读缓存出错时请求云端 */
+static int tts_synthesize(const char *text, ai_audio_sink_t sink, void *user_data,
+                          ai_response_t *response)
+{
+    web_client_resp_stream_t http_resp;
+    tts_stream_ctx_t ctx;
+    tts_cache_file_t *cached;
+    uint32_t cached_rate, cached_len;
+    char json_data[1024];
+    char voice[48];
+    int ret;
+    
+    if (!g_ai_initialized)
+    {
+        LOG_E("AI service not initialized");
+        return -RT_ERROR;
+    }
+    
+    if (text == RT_NULL || sink == RT_NULL || response == RT_NULL)
+    {
+        LOG_E("Invalid parameters");
+        return -RT_EINVAL;
+    }
+    
+    rt_memset(response, 0, sizeof(ai_response_t));
+    response->sample_rate = AI_TTS_SAMPLE_RATE;
+    rt_memset(&ctx, 0, sizeof(ctx));
+    ctx.sink = sink;
+    ctx.user_data = user_data;
+    ctx.response = response;
+    ctx.sink_ret = RT_EOK;
+    
+    LOG_I("Starting text to speech: %s", text);
+    
+    ctx.start = rt_tick_get();
+    tts_voice_id(voice, sizeof(voice));
+    cached = tts_cache_open(voice, text, &cached_rate, &cached_len);
+    if (cached != RT_NULL)
+    {
+        ret = tts_play_cached(&ctx, cached, cached_rate);
+        if (ret != -RT_EIO)
+        {
+            return ret;
+        }
+        ctx.start = rt_tick_get();
+    }
+    
+    tts_build_request(text, json_data, sizeof(json_data));
+    ctx.cache = tts_cache_create(voice, text);
+    
+    ret = web_client_post_recv_stream(g_ai_config.tts_url[0] ? g_ai_config.tts_url : g_ai_config.api_url,
+                                      json_data, strlen(json_data),
+                                      "application/json", tts_body_reader, &ctx, &http_resp);
+    
+    /* 不足12字节、以'R'或'I'开头的音频还留在WAV头缓冲区中 */
+    if (ret == RT_EOK && ctx.wav_state == TTS_WAV_DETECT && ctx.wav_have > 0)
+    {
+        tts_decode_audio(&ctx, ctx.wav_buf, ctx.wav_have);
+    }
+    
+    /* 解码最后不完整的块（帧），释放解码器 */
+    if (ctx.dec != RT_NULL)
+    {
+        if (ret == RT_EOK && ctx.sink_ret == RT_EOK)
+        {
+            audio_dec_finish(ctx.dec, tts_dec_output, &ctx);
+        }
+        LOG_I("TTS %s: %d bytes -> %d samples, %d frames, %d errors", audio_codec_name(ctx.dec->codec),
+              response->encoded_len, ctx.dec->samples, ctx.dec->frames, ctx.dec->errors);
+        audio_dec_deinit(ctx.dec);
+        ai_arena_free(ctx.dec);
+        ctx.dec = RT_NULL;
+    }
+    
+    /* 完整合成的音频加入缓存，失败或被中止的丢弃 */
+    if (ctx.cache != RT_NULL)
+    {
+        if (ret == RT_EOK && ctx.format != TTS_BODY_ERROR && ctx.sink_ret == RT_EOK)
+        {
+            tts_cache_commit(ctx.cache, response->sample_rate);
+        }
+        else
+        {
+            tts_cache_close(ctx.cache);
+        }
+        ctx.cache = RT_NULL;
+    }
+    
+    response->total_ms = AI_TICK_TO_MS(rt_tick_get() - ctx.start);
+    
+    if (ret == RT_EOK && ctx.format != TTS_BODY_ERROR && ctx.sink_ret == RT_EOK)
+    {
+        LOG_I("Text to speech successful (audio_len: %d, first audio: %d ms, total: %d ms)",
+              response->audio_len, response->first_audio_ms, response->total_ms);
+        response->error_code = 0;
+        return RT_EOK;
+    }
+    
+    if (ctx.format == TTS_BODY_ERROR)
+    {
+        LOG_E("TTS failed (status: %d): %s", http_resp.status_code, ctx.error);
+        response->error_code = http_resp.status_code != 200 ? http_resp.status_code : -1;
+        response->error_msg = ai_arena_strdup(ctx.error_len ? ctx.error : "TTS request failed");
     }
     else
     {
         LOG_E("HTTP request failed (status: %d)", http_resp.status_code);
-        response->error_code = http_resp.status_code;
-        response->error_msg = rt_strdup("HTTP request failed");
-        web_client_free_response(&http_resp);
+        response->error_code = http_resp.status_code ? http_resp.status_code : -1;
+        response->error_msg = ai_arena_strdup(ctx.sink_ret != RT_EOK ? "Audio output aborted" : "HTTP request failed");
+    }
+    
+    return -RT_ERROR;
+}
+
+/* 流式语音合成：音频边下载边交给sink，不受HTTP响应缓冲区大小限制；
+ * 合成过的文本从SD卡上的TTS缓存播放 */
+int ai_cloud_service_text_to_speech_stream(const char *text, ai_audio_sink_t sink, void *user_data,
+                                           ai_response_t *response)
+{
+    int ret;
+    
+    AI_TRACE_BEGIN("tts");
+    ret = tts_synthesize(text, sink, user_data, response);
+    AI_TRACE_END("tts", response ? response->audio_len : 0);
+    
+    return ret;
+}
+
+/* 语音合成（Text to Speech）：下载完成后返回完整音频 */
+int ai_cloud_service_text_to_speech(const char *text, ai_response_t *response)
+{
+    tts_buffer_t buffer = {0};
+    int ret;
+    
+    ret = ai_cloud_service_text_to_speech_stream(text, tts_buffer_sink, &buffer, response);
+    if (ret == RT_EOK)
+    {
+        response->audio_result = (char *)buffer.data;
+    }
+    else
+    {
+        ai_arena_free(buffer.data);
+        if (response)
+        {
+            response->audio_len = 0;
+        }
+    }
+    
+    return ret;
+}
+
+/* 全双工的回复文本：对话服务已初始化时由对话AI回答；否则复述识别结果，
+ * reply_text中只有识别结果，返回RT_TRUE，由调用者在前面加上 AI_ECHO_PREFIX */
+static rt_bool_t full_duplex_reply(const char *recognized, char *reply_text, uint32_t size)
+{
+    ai_chat_config_t chat_config;
+    ai_chat_response_t chat_resp;
+    
+    if (ai_chat_service_get_config(&chat_config) == RT_EOK)
+    {
+        if (ai_chat_service_chat(recognized, &chat_resp) == RT_EOK && chat_resp.reply_text)
+        {
+            strncpy(reply_text, chat_resp.reply_text, size - 1);
+            reply_text[size - 1] = '\0';
+            ai_chat_service_free_response(&chat_resp);
+            return RT_FALSE;
+        }
+        ai_chat_service_free_response(&chat_resp);
+    }
+    
+    strncpy(reply_text, recognized, size - 1);
+    reply_text[size - 1] = '\0';
+    return RT_TRUE;
+}
+
+/* 合成全双工的回复：prefix不为空时先单独合成前缀，再合成text，两段依次交给同一个输出；
+ * sink为空时两段音频拼接后放在response->audio_result */
+static int full_duplex_speak(const char *prefix, const char *text, ai_audio_sink_t sink, void *user_data,
+                             ai_response_t *response)
+{
+    tts_buffer_t buffer = {0};
+    ai_response_t head;
+    rt_bool_t buffered = (sink == RT_NULL);
+    int ret = RT_EOK;
+    
+    if (buffered)
+    {
+        sink = tts_buffer_sink;
+        user_data = &buffer;
+    }
+    
+    rt_memset(&head, 0, sizeof(head));
+    if (prefix != RT_NULL)
+    {
+        ret = ai_cloud_service_text_to_speech_stream(prefix, sink, user_data, &head);
+    }
+    
+    if (prefix != RT_NULL && (ret != RT_EOK || text[0] == '\0'))
+    {
+        *response = head;
+    }
+    else
+    {
+        ret = ai_cloud_service_text_to_speech_stream(text, sink, user_data, response);
+        if (prefix != RT_NULL)
+        {
+            /* 首段音频的耗时以前缀为准，长度和总耗时包括两段 */
+            response->first_audio_ms = head.first_audio_ms;
+            response->total_ms += head.total_ms;
+            response->audio_len += head.audio_len;
+            response->encoded_len += head.encoded_len;
+            response->cached = response->cached && head.cached;
+        }
+    }
+    
+    if (buffered)
+    {
+        if (ret == RT_EOK)
+        {
+            response->audio_result = (char *)buffer.data;
+        }
+        else
+        {
+            ai_arena_free(buffer.data);
+            response->audio_len = 0;
+        }
     }
     
     return ret;
@@ -344,8 +949,18 @@ int ai_cloud_service_text_to_speech(const char *text, ai_response_t *response)
 /* 全双工语音交互（语音输入 -> 识别 -> AI处理 -> 语音输出）*/
 int ai_cloud_service_full_duplex(const uint8_t *audio_data, uint32_t audio_len,
                                   ai_response_t *response)
+{
+    return ai_cloud_service_full_duplex_stream(audio_data, audio_len, RT_NULL, RT_NULL, response);
+}
+
+/* 全双工语音交互：sink不为空时回复音频边下载边输出，否则缓存在response->audio_result */
+int ai_cloud_service_full_duplex_stream(const uint8_t *audio_data, uint32_t audio_len,
+                                         ai_audio_sink_t sink, void *user_data,
+                                         ai_response_t *response)
 {
     ai_response_t stt_response;
+    char reply_text[512];
+    rt_bool_t echo;
     int ret;
     
     if (!g_ai_initialized)
@@ -371,7 +986,7 @@ int ai_cloud_service_full_duplex(const uint8_t *audio_data, uint32_t audio_len,
     {
         LOG_E("Speech to text failed");
         response->error_code = stt_response.error_code;
-        response->error_msg = rt_strdup("Speech recognition failed");
+        response->error_msg = ai_arena_strdup("Speech recognition failed");
         ai_cloud_service_free_response(&stt_response);
         return -RT_ERROR;
     }
@@ -379,17 +994,22 @@ int ai_cloud_service_full_duplex(const uint8_t *audio_data, uint32_t audio_len,
     LOG_I("Recognized text: %s", stt_response.text_result);
     
     /* 步骤2：语音合成AI回复 */
-    /* 注意：这里可以添加额外的AI对话处理，比如调用ChatGPT等 */
-    /* 为了简化，这里直接将识别的文本合成语音作为回复 */
-    char reply_text[256];
-    rt_snprintf(reply_text, sizeof(reply_text), "您说的是：%s", stt_response.text_result);
+    AI_TRACE_BEGIN("reply");
+    echo = full_duplex_reply(stt_response.text_result, reply_text, sizeof(reply_text));
+    AI_TRACE_END("reply", strlen(reply_text));
     
-    ret = ai_cloud_service_text_to_speech(reply_text, response);
+    ret = full_duplex_speak(echo ? AI_ECHO_PREFIX : RT_NULL, reply_text, sink, user_data, response);
     if (ret != RT_EOK)
     {
         LOG_E("Text to speech failed");
-        response->error_code = -1;
-        response->error_msg = rt_strdup("Speech synthesis failed");
+        if (response->error_msg == RT_NULL)
+        {
+            response->error_msg = ai_arena_strdup("Speech synthesis failed");
+        }
+        if (response->error_code == 0)
+        {
+            response->error_code = -1;
+        }
     }
     
     /* 保留识别的文本 */
@@ -410,17 +1030,17 @@ void ai_cloud_service_free_response(ai_response_t *response)
     {
         if (response->text_result)
         {
-            rt_free(response->text_result);
+            ai_arena_free(response->text_result);
             response->text_result = RT_NULL;
         }
         if (response->audio_result)
         {
-            rt_free(response->audio_result);
+            ai_arena_free(response->audio_result);
             response->audio_result = RT_NULL;
         }
         if (response->error_msg)
         {
-            rt_free(response->error_msg);
+            ai_arena_free(response->error_msg);
             response->error_msg = RT_NULL;
         }
         response->audio_len = 0;
@@ -430,6 +1050,106 @@ void ai_cloud_service_free_response(ai_response_t *response)
 
 /* 导出MSH命令 */
 #ifdef FINSH_USING_MSH
+#include "audio_player.h"
+#include "drv_audio_max98357a.h"
+
+/* mock_ai_server.py /tts 返回的锯齿波：第i个样本 = ((i * 64) & 0x1FFF) - 4096；
+ * 压缩格式（有损）不逐样本比较，mismatches显示为-1 */
+typedef struct {
+    uint32_t samples;
+    uint32_t mismatches;
+    ai_response_t *response;    /* 第一段音频到达时已解析出采样率 */
+} tts_check_t;
+
+static void tts_check_pcm(tts_check_t *check, const uint8_t *pcm, uint32_t len)
+{
+    for (uint32_t i = 0; i + 1 < len; i += 2, check->samples++)
+    {
+        int16_t sample = (int16_t)(pcm[i] | (pcm[i + 1] << 8));
+        if (sample != (int16_t)(((check->samples * 64) & 0x1FFF) - 4096))
+        {
+            check->mismatches++;
+        }
+    }
+}
+
+static int tts_check_sink(const uint8_t *pcm, uint32_t len, void *user_data)
+{
+    tts_check_t *check = (tts_check_t *)user_data;
+    
+    if (audio_player_stream_set_rate(check->response->sample_rate) != RT_EOK)
+    {
+        return -RT_ERROR;
+    }
+    tts_check_pcm(check, pcm, len);
+    return audio_player_stream_write(pcm, len);
+}
+
+/* 测量从发出请求到第一个样本进入I2S DMA的时间 */
+static void tts_stream_bench(void)
+{
+    ai_response_t response;
+    max98357a_stream_stats_t stats;
+    tts_check_t check = {0};
+    rt_tick_t start;
+    int buffered_ms = -1, stream_ms = -1;
+    rt_bool_t cache_enabled;
+    int ret;
+    
+    audio_player_init();
+    rt_memset(&response, 0, sizeof(response));
+    /* 测量的是网络路径，不从TTS缓存播放 */
+    cache_enabled = tts_cache_set_enabled(RT_FALSE);
+    
+    /* 1. 缓冲式：下载、解码完成后整体交给播放器 */
+    start = rt_tick_get();
+    ret = ai_cloud_service_text_to_speech("mock", &response);
+    if (ret == RT_EOK && audio_player_play_rate((uint8_t *)response.audio_result, response.audio_len,
+                                                response.sample_rate) == RT_EOK)
+    {
+        tts_check_pcm(&check, (uint8_t *)response.audio_result, response.audio_len);
+        do
+        {
+            rt_thread_mdelay(1);
+            max98357a_stream_get_stats(&stats);
+        } while (stats.first_data_tick == 0 && audio_player_get_state() == AUDIO_PLAYER_PLAYING);
+        
+        if (stats.first_data_tick)
+        {
+            buffered_ms = AI_TICK_TO_MS(stats.first_data_tick - start);
+        }
+        audio_player_stop();
+    }
+    rt_kprintf("Buffered: %d bytes at %d Hz (%s, %d bytes received), mismatches: %d, download %d ms, first sample %d ms\n",
+               response.audio_len, response.sample_rate, audio_codec_name(response.codec), response.encoded_len,
+               response.codec == AUDIO_CODEC_PCM ? (int)check.mismatches : -1, response.total_ms, buffered_ms);
+    ai_cloud_service_free_response(&response);
+    
+    /* 2. 流式：边下载边解码边播放 */
+    rt_memset(&check, 0, sizeof(check));
+    check.response = &response;
+    if (audio_player_stream_begin() != RT_EOK)
+    {
+        tts_cache_set_enabled(cache_enabled);
+        return;
+    }
+    start = rt_tick_get();
+    ret = ai_cloud_service_text_to_speech_stream("mock", tts_check_sink, &check, &response);
+    audio_player_stream_end();
+    max98357a_stream_get_stats(&stats);
+    if (ret == RT_EOK && stats.first_data_tick)
+    {
+        stream_ms = AI_TICK_TO_MS(stats.first_data_tick - start);
+    }
+    rt_kprintf("Streamed: %d bytes (%s, %d bytes received), mismatches: %d, download %d ms, first audio %d ms, first sample %d ms\n",
+               response.audio_len, audio_codec_name(response.codec), response.encoded_len,
+               response.codec == AUDIO_CODEC_PCM ? (int)check.mismatches : -1, response.total_ms,
+               response.first_audio_ms, stream_ms);
+    rt_kprintf("Underruns: %d, min fill: %d bytes\n", stats.underruns, stats.min_fill);
+    ai_cloud_service_free_response(&response);
+    tts_cache_set_enabled(cache_enabled);
+}
+
 static int cmd_ai_test(int argc, char **argv)
 {
     if (argc < 2)
@@ -437,6 +1157,8 @@ static int cmd_ai_test(int argc, char **argv)
         rt_kprintf("Usage: ai_test [init|stt|tts]\n");
         rt_kprintf("  init <provider> <api_key> <app_id> <api_url>\n");
         rt_kprintf("  tts <text>\n");
+        rt_kprintf("  stt_wire <mock_url> [bytes]  (see mock_ai_server.py)\n");
+        rt_kprintf("  tts_stream <mock_url>        (time to first sample)\n");
         return -1;
     }
     
@@ -449,6 +1171,7 @@ static int cmd_ai_test(int argc, char **argv)
         }
         
         ai_service_config_t config;
+        rt_memset(&config, 0, sizeof(config));
         config.provider = atoi(argv[2]);
         strncpy(config.api_key, argv[3], sizeof(config.api_key) - 1);
         strncpy(config.app_id, argv[4], sizeof(config.app_id) - 1);
@@ -473,12 +1196,70 @@ static int cmd_ai_test(int argc, char **argv)
         }
         else
         {
-            rt_kprintf("TTS failed: %s\n", response.error_msg);
+            rt_kprintf("TTS failed: %s\n", response.error_msg ? response.error_msg : "unknown");
+        }
+        
+        ai_cloud_service_free_response(&response);
+        return ret;
+    }
+    else if (strcmp(argv[1], "stt_wire") == 0)
+    {
+        /* 向mock_ai_server.py发送确定性的PCM，由服务器逐字节校验请求体 */
+        char saved_url[sizeof(g_ai_config.api_url)];
+        uint32_t bytes = argc > 3 ? atoi(argv[3]) : 16000 * 2 * 3;
+        rt_size_t total, used_before, used_after, max_used;
+        
+        if (argc < 3)
+        {
+            rt_kprintf("Usage: ai_test stt_wire <mock_url> [bytes]\n");
+            return -1;
+        }
+        
+        uint8_t *pcm = (uint8_t *)rt_malloc(bytes);
+        if (pcm == RT_NULL)
+        {
+            rt_kprintf("Failed to allocate %d bytes\n", bytes);
+            return -1;
+        }
+        for (uint32_t i = 0; i < bytes; i++)
+        {
+            pcm[i] = (uint8_t)(i * 31 + 7);
         }
         
+        rt_memcpy(saved_url, g_ai_config.api_url, sizeof(saved_url));
+        strncpy(g_ai_config.api_url, argv[2], sizeof(g_ai_config.api_url) - 1);
+        
+        ai_response_t response;
+        rt_memory_info(&total, &used_before, &max_used);
+        int ret = ai_cloud_service_speech_to_text(pcm, bytes, &response);
+        rt_memory_info(&total, &used_after, &max_used);
+        
+        rt_memcpy(g_ai_config.api_url, saved_url, sizeof(saved_url));
+        rt_free(pcm);
+        
+        rt_kprintf("Server: %s\n", response.text_result ? response.text_result : "(no result)");
+        rt_kprintf("Heap used before/after: %d/%d, max used: %d\n", used_before, used_after, max_used);
+        
         ai_cloud_service_free_response(&response);
         return ret;
     }
+    else if (strcmp(argv[1], "tts_stream") == 0)
+    {
+        char saved_url[sizeof(g_ai_config.tts_url)];
+        
+        if (argc < 3)
+        {
+            rt_kprintf("Usage: ai_test tts_stream <mock_url>\n");
+            rt_kprintf("  e.g. http://PC_IP:8090/tts?bytes=96000&rate=64000&b64=1\n");
+            return -1;
+        }
+        
+        rt_memcpy(saved_url, g_ai_config.tts_url, sizeof(saved_url));
+        strncpy(g_ai_config.tts_url, argv[2], sizeof(g_ai_config.tts_url) - 1);
+        tts_stream_bench();
+        rt_memcpy(g_ai_config.tts_url, saved_url, sizeof(saved_url));
+        return 0;
+    }
     else
     {
         rt_kprintf("Unknown command: %s\n", argv[1]);
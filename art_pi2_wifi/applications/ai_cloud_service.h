@@ -6,12 +6,29 @@
  * Change Logs:
  * Date           Author       Notes
  * 2024-10-16     AI Assistant first version - AI Cloud Service Module
+ * 2024-10-27     AI Assistant Add TTS sample rate to the response
+ * 2024-10-27     AI Assistant Add TTS audio codec selection
+ * 2024-10-27     AI Assistant Mark TTS responses served from the SD card cache
+ * 2024-10-27     AI Assistant Share the echo reply prefix
  */
 
 #ifndef __AI_CLOUD_SERVICE_H__
 #define __AI_CLOUD_SERVICE_H__
 
 #include <rtthread.h>
+#include "audio_decoder.h"
+
+/* TTS音频默认采样率，与扬声器相同；响应声明其他采样率时由播放器转换 */
+#define AI_TTS_SAMPLE_RATE      16000
+
+/* 向自定义服务端请求的TTS音频格式：默认PCM，可以选 AUDIO_CODEC_IMA_ADPCM（约为PCM的1/4）；
+ * 百度、讯飞总是请求PCM。响应的实际格式以Content-Type和WAV头为准 */
+#ifndef AI_TTS_CODEC
+#define AI_TTS_CODEC            AUDIO_CODEC_PCM
+#endif
+
+/* 没有对话服务时复述识别结果的前缀；单独作为一句合成，每次都能从TTS缓存播放 */
+#define AI_ECHO_PREFIX          "您说的是："
 
 /* AI服务提供商 */
 typedef enum {
@@ -28,6 +45,7 @@ typedef struct {
     char api_secret[128];
     char app_id[64];
     char api_url[256];
+    char tts_url[256];        /* 语音合成地址，为空时与api_url相同 */
 } ai_service_config_t;
 
 /* AI响应结构 */
@@ -37,15 +55,30 @@ typedef struct {
     char *audio_result;       /* AI回复的音频数据 */
     uint32_t audio_len;       /* 音频数据长度 */
     char *error_msg;          /* 错误信息 */
+    uint32_t first_audio_ms;  /* 请求发出到第一段音频交给输出的耗时 */
+    uint32_t total_ms;        /* 请求总耗时 */
+    uint32_t sample_rate;     /* TTS音频采样率：来自Content-Type或WAV头，未声明时为16000 */
+    audio_codec_t codec;      /* TTS响应的音频格式，audio_len始终是解码后的PCM长度 */
+    uint32_t encoded_len;     /* 解码前的音频字节数（含WAV头）*/
+    rt_bool_t cached;         /* 音频来自SD卡上的TTS缓存，没有经过网络 */
 } ai_response_t;
 
+/* TTS音频输出回调：每解码出一段16bit小端PCM（长度为偶数）调用一次，返回非RT_EOK时中止下载 */
+typedef int (*ai_audio_sink_t)(const uint8_t *pcm, uint32_t len, void *user_data);
+
 /* AI云服务接口 */
 int ai_cloud_service_init(ai_service_config_t *config);
+int ai_cloud_service_get_config(ai_service_config_t *config);
 int ai_cloud_service_speech_to_text(const uint8_t *audio_data, uint32_t audio_len, 
                                      ai_response_t *response);
 int ai_cloud_service_text_to_speech(const char *text, ai_response_t *response);
+int ai_cloud_service_text_to_speech_stream(const char *text, ai_audio_sink_t sink, void *user_data,
+                                           ai_response_t *response);
 int ai_cloud_service_full_duplex(const uint8_t *audio_data, uint32_t audio_len,
                                   ai_response_t *response);
+int ai_cloud_service_full_duplex_stream(const uint8_t *audio_data, uint32_t audio_len,
+                                         ai_audio_sink_t sink, void *user_data,
+                                         ai_response_t *response);
 void ai_cloud_service_free_response(ai_response_t *response);
 
 #endif /* __AI_CLOUD_SERVICE_H__ */
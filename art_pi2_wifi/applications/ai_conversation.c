@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Multi-turn conversation context
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include "ai_conversation.h"
+#include "memory_helper.h"
+
+#define DBG_TAG "ai.conv"
+#define DBG_LVL DBG_INFO
+#include <rtdbg.h>
+
+/* 一轮对话：提问和回复首尾相接存放在文本缓冲区中，不跨越缓冲区末尾 */
+typedef struct {
+    uint32_t offset;
+    uint32_t user_len;
+    uint32_t reply_len;
+    uint32_t tokens;          /* 含两条消息的固定开销 */
+} ai_conv_turn_t;
+
+static struct {
+    struct rt_mutex lock;
+    rt_bool_t lock_ready;
+    char *text;                               /* 文本缓冲区 (PSRAM)，第一次加入时分配 */
+    ai_conv_turn_t turns[AI_CONV_MAX_TURNS];
+    uint32_t first;                           /* 最早一轮的下标 */
+    uint32_t count;
+    uint32_t head;                            /* 最新一轮文本之后的位置 */
+    ai_conv_stats_t stats;
+} ai_conv;
+
+void ai_conv_lock(void)
+{
+    if (!ai_conv.lock_ready)
+    {
+        rt_enter_critical();
+        if (!ai_conv.lock_ready)
+        {
+            rt_mutex_init(&ai_conv.lock, "ai_conv", RT_IPC_FLAG_PRIO);
+            ai_conv.lock_ready = RT_TRUE;
+        }
+        rt_exit_critical();
+    }
+
+    rt_mutex_take(&ai_conv.lock, RT_WAITING_FOREVER);
+}
+
+void ai_conv_unlock(void)
+{
+    rt_mutex_release(&ai_conv.lock);
+}
+
+uint32_t ai_conv_count_tokens(const char *text, uint32_t len)
+{
+    uint32_t ascii = 0;
+    uint32_t wide = 0;
+    uint32_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        uint8_t c = (uint8_t)text[i];
+
+        if (c < 0x80)
+        {
+            ascii++;
+        }
+        else if (c >= 0xC0)
+        {
+            wide++;     /* UTF-8首字节，后续字节不计 */
+        }
+    }
+
+    return wide + (ascii + 3) / 4;
+}
+
+static uint32_t ai_conv_budget(void)
+{
+    return ai_conv.stats.budget ? ai_conv.stats.budget : AI_CONV_TOKEN_BUDGET;
+}
+
+/* 淘汰最早的一轮（需持有锁）*/
+static void ai_conv_drop_oldest(void)
+{
+    ai_conv_turn_t *turn = &ai_conv.turns[ai_conv.first];
+
+    ai_conv.stats.bytes -= turn->user_len + turn->reply_len;
+    ai_conv.stats.tokens -= turn->tokens;
+    ai_conv.first = (ai_conv.first + 1) % AI_CONV_MAX_TURNS;
+    ai_conv.count--;
+    if (ai_conv.count == 0)
+    {
+        ai_conv.head = 0;
+    }
+}
+
+/* 为新的一轮找到连续的need字节（need不超过缓冲区大小），必要时淘汰最早的几轮（需持有锁）*/
+static uint32_t ai_conv_reserve(uint32_t need)
+{
+    while (ai_conv.count > 0)
+    {
+        const ai_conv_turn_t *oldest = &ai_conv.turns[ai_conv.first];
+
+        if (ai_conv.count < AI_CONV_MAX_TURNS)
+        {
+            if (oldest->offset >= ai_conv.head)
+            {
+                /* 已回绕：空闲区在最新一轮之后、最早一轮之前 */
+                if (oldest->offset - ai_conv.head >= need)
+                {
+                    return ai_conv.head;
+                }
+            }
+            else if (AI_CONV_TEXT_SIZE - ai_conv.head >= need)
+            {
+                return ai_conv.head;
+            }
+            else if (oldest->offset >= need)
+            {
+                return 0;
+            }
+        }
+
+        ai_conv_drop_oldest();
+        ai_conv.stats.evicted++;
+    }
+
+    return 0;
+}
+
+int ai_conv_add_turn(const char *user, const char *assistant)
+{
+    ai_conv_turn_t *turn;
+    uint32_t user_len, reply_len;
+    uint32_t offset, tokens;
+
+    if (user == RT_NULL || assistant == RT_NULL || user[0] == '\0')
+    {
+        return -RT_EINVAL;
+    }
+
+    user_len = strlen(user);
+    reply_len = strlen(assistant);
+    tokens = ai_conv_count_tokens(user, user_len) + ai_conv_count_tokens(assistant, reply_len) +
+             2 * AI_CONV_MSG_TOKENS;
+
+    ai_conv_lock();
+
+    if (ai_conv.text == RT_NULL)
+    {
+        ai_conv.text = (char *)mem_class_alloc(MEM_CLASS_BULK, AI_CONV_TEXT_SIZE);
+        if (ai_conv.text == RT_NULL)
+        {
+            ai_conv_unlock();
+            LOG_E("Failed to allocate conversation buffer");
+            return -RT_ENOMEM;
+        }
+    }
+
+    if (user_len + reply_len > AI_CONV_TEXT_SIZE || tokens > ai_conv_budget())
+    {
+        ai_conv.stats.dropped++;
+        ai_conv_unlock();
+        LOG_D("Turn too long for the conversation context (%d bytes, %d tokens)",
+              user_len + reply_len, tokens);
+        return -RT_EFULL;
+    }
+
+    offset = ai_conv_reserve(user_len + reply_len);
+    turn = &ai_conv.turns[(ai_conv.first + ai_conv.count) % AI_CONV_MAX_TURNS];
+    turn->offset = offset;
+    turn->user_len = user_len;
+    turn->reply_len = reply_len;
+    turn->tokens = tokens;
+    rt_memcpy(ai_conv.text + offset, user, user_len);
+    rt_memcpy(ai_conv.text + offset + user_len, assistant, reply_len);
+    ai_conv.head = offset + user_len + reply_len;
+    ai_conv.count++;
+
+    ai_conv.stats.bytes += user_len + reply_len;
+    ai_conv.stats.tokens += tokens;
+    ai_conv.stats.added++;
+
+    /* 新的一轮本身不超过预算，最多淘汰到只剩它 */
+    while (ai_conv.stats.tokens > ai_conv_budget())
+    {
+        ai_conv_drop_oldest();
+        ai_conv.stats.trimmed++;
+    }
+
+    ai_conv_unlock();
+
+    return RT_EOK;
+}
+
+void ai_conv_clear(void)
+{
+    ai_conv_lock();
+    while (ai_conv.count > 0)
+    {
+        ai_conv_drop_oldest();
+    }
+    ai_conv_unlock();
+}
+
+void ai_conv_set_budget(uint32_t tokens)
+{
+    ai_conv_lock();
+    ai_conv.stats.budget = tokens;
+    while (ai_conv.count > 0 && ai_conv.stats.tokens > ai_conv_budget())
+    {
+        ai_conv_drop_oldest();
+        ai_conv.stats.trimmed++;
+    }
+    ai_conv_unlock();
+}
+
+/* ==================== 输出 ==================== */
+
+typedef struct {
+    ai_conv_emit_t emit;      /* 为空时只计算长度 */
+    void *user_data;
+    int32_t len;
+    int ret;
+} ai_conv_out_t;
+
+static void ai_conv_out(ai_conv_out_t *out, const char *data, uint32_t len)
+{
+    if (out->ret != RT_EOK || len == 0)
+    {
+        return;
+    }
+    if (out->emit)
+    {
+        out->ret = out->emit(data, len, out->user_data);
+    }
+    out->len += len;
+}
+
+/* JSON字符串内容：不需要转义的连续片段直接从原处输出 */
+static void ai_conv_out_string(ai_conv_out_t *out, const char *text, uint32_t len)
+{
+    static const char hex[] = "0123456789abcdef";
+    uint32_t start = 0;
+    uint32_t i;
+    char esc[6];
+
+    for (i = 0; i < len; i++)
+    {
+        uint8_t c = (uint8_t)text[i];
+        uint32_t esc_len = 2;
+
+        if (c >= 0x20 && c != '"' && c != '\\')
+        {
+            continue;
+        }
+
+        ai_conv_out(out, text + start, i - start);
+        esc[0] = '\\';
+        switch (c)
+        {
+        case '"':  esc[1] = '"';  break;
+        case '\\': esc[1] = '\\'; break;
+        case '\n': esc[1] = 'n';  break;
+        case '\r': esc[1] = 'r';  break;
+        case '\t': esc[1] = 't';  break;
+        default:
+            esc[1] = 'u';
+            esc[2] = '0';
+            esc[3] = '0';
+            esc[4] = hex[c >> 4];
+            esc[5] = hex[c & 0x0F];
+            esc_len = 6;
+            break;
+        }
+        ai_conv_out(out, esc, esc_len);
+        start = i + 1;
+    }
+
+    ai_conv_out(out, text + start, len - start);
+}
+
+static void ai_conv_out_message(ai_conv_out_t *out, rt_bool_t comma, const char *role,
+                                const char *text, uint32_t len)
+{
+    const char *open = comma ? ",{\"role\":\"" : "{\"role\":\"";
+
+    ai_conv_out(out, open, strlen(open));
+    ai_conv_out(out, role, strlen(role));
+    ai_conv_out(out, "\",\"content\":\"", 13);
+    ai_conv_out_string(out, text, len);
+    ai_conv_out(out, "\"}", 2);
+}
+
+int32_t ai_conv_write_messages(const char *system, const char *user,
+                               ai_conv_emit_t emit, void *user_data)
+{
+    ai_conv_out_t out;
+    const ai_conv_turn_t *turn;
+    uint32_t system_len = system ? strlen(system) : 0;
+    uint32_t user_len = user ? strlen(user) : 0;
+    uint32_t used = 0;
+    uint32_t sent, i;
+
+    out.emit = emit;
+    out.user_data = user_data;
+    out.len = 0;
+    out.ret = RT_EOK;
+
+    ai_conv_lock();
+
+    /* 从最新一轮往前，带上预算内的轮数 */
+    if (system_len > 0)
+    {
+        used += ai_conv_count_tokens(system, system_len) + AI_CONV_MSG_TOKENS;
+    }
+    used += ai_conv_count_tokens(user, user_len) + AI_CONV_MSG_TOKENS;
+    for (sent = 0; sent < ai_conv.count; sent++)
+    {
+        turn = &ai_conv.turns[(ai_conv.first + ai_conv.count - 1 - sent) % AI_CONV_MAX_TURNS];
+        if (used + turn->tokens > ai_conv_budget())
+        {
+            break;
+        }
+        used += turn->tokens;
+    }
+    ai_conv.stats.last_sent = sent;
+
+    ai_conv_out(&out, "[", 1);
+    if (system_len > 0)
+    {
+        ai_conv_out_message(&out, RT_FALSE, "system", system, system_len);
+    }
+    for (i = ai_conv.count - sent; i < ai_conv.count; i++)
+    {
+        turn = &ai_conv.turns[(ai_conv.first + i) % AI_CONV_MAX_TURNS];
+        ai_conv_out_message(&out, out.len > 1, "user", ai_conv.text + turn->offset, turn->user_len);
+        ai_conv_out_message(&out, RT_TRUE, "assistant", ai_conv.text + turn->offset + turn->user_len,
+                            turn->reply_len);
+    }
+    ai_conv_out_message(&out, out.len > 1, "user", user ? user : "", user_len);
+    ai_conv_out(&out, "]", 1);
+
+    ai_conv_unlock();
+
+    if (out.ret != RT_EOK)
+    {
+        return out.ret < 0 ? out.ret : -RT_ERROR;
+    }
+    return out.len;
+}
+
+void ai_conv_get_stats(ai_conv_stats_t *stats)
+{
+    ai_conv_lock();
+    rt_memcpy(stats, &ai_conv.stats, sizeof(ai_conv_stats_t));
+    stats->turns = ai_conv.count;
+    stats->budget = ai_conv_budget();
+    ai_conv_unlock();
+}
+
+#ifdef FINSH_USING_MSH
+#include <finsh.h>
+
+/* 截取不超过max字节的完整UTF-8字符 */
+static uint32_t ai_conv_preview_len(const char *text, uint32_t len, uint32_t max)
+{
+    if (len <= max)
+    {
+        return len;
+    }
+    while (max > 0 && ((uint8_t)text[max] & 0xC0) == 0x80)
+    {
+        max--;
+    }
+    return max;
+}
+
+static int cmd_ai_conv(int argc, char **argv)
+{
+    ai_conv_stats_t stats;
+    uint32_t i;
+
+    if (argc >= 2 && strcmp(argv[1], "clear") == 0)
+    {
+        ai_conv_clear();
+        rt_kprintf("Conversation cleared\n");
+        return 0;
+    }
+    if (argc >= 3 && strcmp(argv[1], "budget") == 0)
+    {
+        ai_conv_set_budget((uint32_t)atoi(argv[2]));
+    }
+    else if (argc >= 2)
+    {
+        rt_kprintf("Usage: ai_conv [clear | budget <tokens>]\n");
+        return -1;
+    }
+
+    ai_conv_get_stats(&stats);
+    rt_kprintf("Conversation: %d turns, %d/%d bytes, %d/%d tokens, last request sent %d turns\n",
+               stats.turns, stats.bytes, AI_CONV_TEXT_SIZE, stats.tokens, stats.budget, stats.last_sent);
+    rt_kprintf("Added %d, trimmed (budget) %d, evicted (space) %d, dropped (too long) %d\n",
+               stats.added, stats.trimmed, stats.evicted, stats.dropped);
+
+    ai_conv_lock();
+    for (i = 0; i < ai_conv.count; i++)
+    {
+        const ai_conv_turn_t *turn = &ai_conv.turns[(ai_conv.first + i) % AI_CONV_MAX_TURNS];
+        const char *text = ai_conv.text + turn->offset;
+
+        rt_kprintf("  %2d %4d tokens  Q: %.*s\n", i, turn->tokens,
+                   ai_conv_preview_len(text, turn->user_len, 48), text);
+        rt_kprintf("                  A: %.*s\n",
+                   ai_conv_preview_len(text + turn->user_len, turn->reply_len, 48), text + turn->user_len);
+    }
+    ai_conv_unlock();
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_ai_conv, ai_conv, show or clear the chat history: ai_conv [clear | budget N]);
+#endif
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Multi-turn conversation context
+ */
+
+#ifndef __AI_CONVERSATION_H__
+#define __AI_CONVERSATION_H__
+
+/*
+ * 多轮对话的上下文：保存最近几轮（用户提问 + AI回复）的原文，请求对话服务时一起发送
+ *   - 各轮文本首尾相接存放在PSRAM中的一块环形缓冲区里，空间或轮数不够时淘汰最早的一轮
+ *   - 每轮按近似的token数计数，总数超过预算时从最早的一轮开始淘汰；发送时再为系统提示词
+ *     和本次提问留出位置，只带上预算内最近的几轮
+ *   - ai_conv_write_messages 直接从缓冲区输出服务商的 messages 数组（JSON转义），
+ *     不拼接字符串；emit为空时只计算长度，用于先确定Content-Length
+ *   - 计算长度和写出之间历史不能变化，调用者在整个请求期间持有 ai_conv_lock
+ */
+
+#include <rtthread.h>
+
+/* 保存的轮数上限 */
+#ifndef AI_CONV_MAX_TURNS
+#define AI_CONV_MAX_TURNS       16
+#endif
+
+/* 历史文本缓冲区大小 (PSRAM) */
+#ifndef AI_CONV_TEXT_SIZE
+#define AI_CONV_TEXT_SIZE       (8 * 1024)
+#endif
+
+/* 默认token预算：历史、系统提示词和本次提问合计 */
+#ifndef AI_CONV_TOKEN_BUDGET
+#define AI_CONV_TOKEN_BUDGET    1024
+#endif
+
+/* 每条消息的固定开销（角色和分隔符）*/
+#define AI_CONV_MSG_TOKENS      4
+
+typedef struct {
+    uint32_t turns;           /* 当前保存的轮数 */
+    uint32_t bytes;           /* 当前历史文本字节数 */
+    uint32_t tokens;          /* 当前历史的token数 */
+    uint32_t budget;          /* token预算 */
+    uint32_t added;           /* 加入的轮数 */
+    uint32_t trimmed;         /* 因预算淘汰的轮数 */
+    uint32_t evicted;         /* 因缓冲区或轮数上限淘汰的轮数 */
+    uint32_t dropped;         /* 超过缓冲区大小、没有保存的轮数 */
+    uint32_t last_sent;       /* 最近一次请求带上的历史轮数 */
+} ai_conv_stats_t;
+
+/* 输出回调：返回非RT_EOK时中止 */
+typedef int (*ai_conv_emit_t)(const void *data, uint32_t len, void *user_data);
+
+/* 请求期间保持历史不变 */
+void ai_conv_lock(void);
+void ai_conv_unlock(void);
+
+/* 近似的token数：非ASCII字符（中文）每字1个，ASCII每4字节1个 */
+uint32_t ai_conv_count_tokens(const char *text, uint32_t len);
+
+/* 加入一轮对话，成功的回复才加入；缓冲区在第一次加入时分配 */
+int ai_conv_add_turn(const char *user, const char *assistant);
+
+/* 清空历史 */
+void ai_conv_clear(void);
+
+/* 设置token预算，0恢复默认值；超出新预算的历史立即淘汰 */
+void ai_conv_set_budget(uint32_t tokens);
+
+/*
+ * 输出JSON数组 [system, 历史..., user]，system为空时省略
+ * 返回输出的字节数，emit失败时返回负的错误码
+ */
+int32_t ai_conv_write_messages(const char *system, const char *user,
+                               ai_conv_emit_t emit, void *user_data);
+
+void ai_conv_get_stats(ai_conv_stats_t *stats);
+
+#endif /* __AI_CONVERSATION_H__ */
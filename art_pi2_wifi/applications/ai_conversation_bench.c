@@ -0,0 +1,422 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Conversation context test
+ */
+
+/*
+ * 多轮对话上下文的测试：
+ *   escape   含引号、反斜杠、换行、控制字符和中文的几轮对话，输出的messages用json_stream逐条取回比较；
+ *            legacy 为原来用 %s 直接拼进JSON的做法
+ *   soak     随机长度的对话不断加入，检查保存的总是最近加入的若干轮、token数不超过预算、
+ *            缓冲区和轮数上限下的淘汰，以及计算出的长度与实际写出的长度一致
+ *   cost     满历史时每次请求的序列化：rebuild 先拼出完整请求体再发送，stream 边序列化边发送
+ * 测试使用正式的对话历史，结束时清空。
+ *
+ * 设备端：ai_conv_bench [轮数]
+ * PC端（与设备端同一份ai_conversation.c）：
+ *   gcc -O2 -DAI_CONV_BENCH_MAIN -I../host -I. ai_conversation.c json_stream.c ai_arena.c memory_helper.c \
+ *       ai_conversation_bench.c -lpthread -o conv_bench
+ *   ./conv_bench 2000
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include "ai_conversation.h"
+#include "json_stream.h"
+#include "ai_arena.h"
+
+#define CONV_BENCH_BODY_MAX     (AI_CONV_TEXT_SIZE * 2 + 1024)  /* 全部转义时的上限 */
+#define CONV_BENCH_TEXT_MAX     1200
+#define CONV_BENCH_SEND_BUF     256
+
+/* 写入平坦缓冲区 */
+typedef struct {
+    char *buf;
+    uint32_t len;
+    uint32_t size;
+} conv_bench_flat_t;
+
+static int conv_bench_flat_emit(const void *data, uint32_t len, void *user_data)
+{
+    conv_bench_flat_t *flat = (conv_bench_flat_t *)user_data;
+
+    if (flat->len + len > flat->size)
+    {
+        return -RT_EFULL;
+    }
+    rt_memcpy(flat->buf + flat->len, data, len);
+    flat->len += len;
+    return RT_EOK;
+}
+
+/* 输出 {"messages":[...]}，返回长度，失败返回-1 */
+static int32_t conv_bench_write(conv_bench_flat_t *flat, const char *system, const char *user)
+{
+    int32_t len;
+
+    flat->len = 0;
+    conv_bench_flat_emit("{\"messages\":", 12, flat);
+    len = ai_conv_write_messages(system, user, conv_bench_flat_emit, flat);
+    if (len < 0 || conv_bench_flat_emit("}", 1, flat) != RT_EOK)
+    {
+        return -1;
+    }
+    flat->buf[flat->len] = '\0';
+    return len;
+}
+
+/* 取回第index条消息的字段并与期望比较 */
+static rt_bool_t conv_bench_check(const conv_bench_flat_t *flat, int index, const char *field,
+                                  const char *expected)
+{
+    char path[48];
+    const char *paths[1];
+    char *value;
+    rt_bool_t ok;
+
+    rt_snprintf(path, sizeof(path), "messages[%d].%s", index, field);
+    paths[0] = path;
+    value = json_stream_extract(flat->buf, flat->len, paths, 1);
+    ok = value != RT_NULL && strcmp(value, expected) == 0;
+    ai_arena_free(value);
+    return ok;
+}
+
+/* ==================== escape ==================== */
+
+static const char *const conv_bench_turns[][2] = {
+    {"他说\"你好\"是什么意思？", "就是打招呼，C:\\Users 里的反斜杠也要转义。"},
+    {"第一行\n第二行\ttab", "收到\r\n两行\x01\x1f。"},
+    {"emoji 😀 and ascii", "{\"role\":\"system\"} 不会被当成消息"},
+};
+
+static int conv_bench_escape(conv_bench_flat_t *flat)
+{
+    const char *system = "你是\"小石\"";
+    const char *user = "刚才\\说了什么？";
+    char legacy[512];
+    const char *paths[1] = {"messages[0].content"};
+    char *value;
+    int failures = 0;
+    int i;
+
+    ai_conv_clear();
+    for (i = 0; i < (int)(sizeof(conv_bench_turns) / sizeof(conv_bench_turns[0])); i++)
+    {
+        ai_conv_add_turn(conv_bench_turns[i][0], conv_bench_turns[i][1]);
+    }
+
+    if (conv_bench_write(flat, system, user) < 0 ||
+        ai_conv_write_messages(system, user, RT_NULL, RT_NULL) + 13 != (int32_t)flat->len)
+    {
+        rt_kprintf("escape     length mismatch\n");
+        return 1;
+    }
+
+    failures += !conv_bench_check(flat, 0, "role", "system");
+    failures += !conv_bench_check(flat, 0, "content", system);
+    for (i = 0; i < (int)(sizeof(conv_bench_turns) / sizeof(conv_bench_turns[0])); i++)
+    {
+        failures += !conv_bench_check(flat, 1 + i * 2, "role", "user");
+        failures += !conv_bench_check(flat, 1 + i * 2, "content", conv_bench_turns[i][0]);
+        failures += !conv_bench_check(flat, 2 + i * 2, "role", "assistant");
+        failures += !conv_bench_check(flat, 2 + i * 2, "content", conv_bench_turns[i][1]);
+    }
+    failures += !conv_bench_check(flat, 7, "content", user);
+    rt_kprintf("escape     %d messages, %d bytes, %s\n", 8, flat->len, failures ? "WRONG" : "ok");
+
+    /* 原来的做法 */
+    rt_snprintf(legacy, sizeof(legacy), "{\"messages\":[{\"role\":\"user\",\"content\":\"%s\"}]}",
+                conv_bench_turns[0][0]);
+    value = json_stream_extract(legacy, strlen(legacy), paths, 1);
+    rt_kprintf("legacy     %s\n", value && strcmp(value, conv_bench_turns[0][0]) == 0 ? "ok" : "WRONG");
+    ai_arena_free(value);
+
+    return failures;
+}
+
+/* ==================== soak ==================== */
+
+typedef struct {
+    char user[CONV_BENCH_TEXT_MAX + 1];
+    char reply[CONV_BENCH_TEXT_MAX + 1];
+} conv_bench_turn_t;
+
+/* 随机文本：中英文混合，偶尔有引号和换行 */
+static void conv_bench_text(char *text, uint32_t max_len)
+{
+    static const char *const pieces[] = {"今天", "天气", "怎么样", "hello ", "world", "\"", "\n", "，", "。", "42"};
+    uint32_t target = 1 + rand() % max_len;
+    uint32_t len = 0;
+
+    while (len < target)
+    {
+        const char *piece = pieces[rand() % (sizeof(pieces) / sizeof(pieces[0]))];
+        uint32_t n = strlen(piece);
+
+        if (len + n > max_len)
+        {
+            break;
+        }
+        rt_memcpy(text + len, piece, n);
+        len += n;
+    }
+    if (len == 0)
+    {
+        text[len++] = 'a';
+    }
+    text[len] = '\0';
+}
+
+static int conv_bench_soak(conv_bench_flat_t *flat, int rounds)
+{
+    conv_bench_turn_t *history;
+    ai_conv_stats_t stats, base;
+    uint32_t budgets[] = {256, 1024, 4096};
+    int failures = 0;
+    int added = 0;
+    int round, b;
+
+    history = (conv_bench_turn_t *)rt_malloc(sizeof(conv_bench_turn_t) * AI_CONV_MAX_TURNS * 2);
+    if (history == RT_NULL)
+    {
+        return 1;
+    }
+
+    for (b = 0; b < (int)(sizeof(budgets) / sizeof(budgets[0])); b++)
+    {
+        uint32_t max_sent = 0;
+
+        srand(b + 1);
+        ai_conv_clear();
+        ai_conv_set_budget(budgets[b]);
+        ai_conv_get_stats(&base);
+        added = 0;
+
+        for (round = 0; round < rounds; round++)
+        {
+            conv_bench_turn_t *turn = &history[added % (AI_CONV_MAX_TURNS * 2)];
+            int32_t len;
+            int i, n;
+
+            /* 大多是短句，偶尔是长回复 */
+            conv_bench_text(turn->user, rand() % 8 ? 60 : 300);
+            conv_bench_text(turn->reply, rand() % 8 ? 200 : CONV_BENCH_TEXT_MAX);
+            if (ai_conv_add_turn(turn->user, turn->reply) == RT_EOK)
+            {
+                added++;
+            }
+
+            ai_conv_get_stats(&stats);
+            if (stats.tokens > stats.budget || stats.bytes > AI_CONV_TEXT_SIZE ||
+                stats.turns > AI_CONV_MAX_TURNS || (int)stats.turns > added)
+            {
+                rt_kprintf("soak       round %d: %d turns, %d bytes, %d/%d tokens\n",
+                           round, stats.turns, stats.bytes, stats.tokens, stats.budget);
+                failures++;
+                break;
+            }
+
+            /* 带上的历史是最近加入的几轮，顺序不变 */
+            len = conv_bench_write(flat, RT_NULL, "继续");
+            if (len < 0 || len + 13 != (int32_t)flat->len ||
+                ai_conv_write_messages(RT_NULL, "继续", RT_NULL, RT_NULL) != len)
+            {
+                rt_kprintf("soak       round %d: write failed\n", round);
+                failures++;
+                break;
+            }
+            ai_conv_get_stats(&stats);
+            n = stats.last_sent;
+            for (i = 0; i < n; i++)
+            {
+                const conv_bench_turn_t *expected = &history[(added - n + i) % (AI_CONV_MAX_TURNS * 2)];
+
+                if (!conv_bench_check(flat, i * 2, "content", expected->user) ||
+                    !conv_bench_check(flat, i * 2 + 1, "content", expected->reply))
+                {
+                    rt_kprintf("soak       round %d: turn %d of %d differs\n", round, i, n);
+                    failures++;
+                    break;
+                }
+            }
+            if (!conv_bench_check(flat, n * 2, "content", "继续"))
+            {
+                failures++;
+            }
+            if (failures)
+            {
+                break;
+            }
+            if ((uint32_t)n > max_sent)
+            {
+                max_sent = n;
+            }
+        }
+
+        ai_conv_get_stats(&stats);
+        rt_kprintf("soak       budget %4d: %d rounds, added %d, trimmed %d, evicted %d, dropped %d, "
+                   "max sent %d turns, %s\n",
+                   stats.budget, round, stats.added - base.added, stats.trimmed - base.trimmed,
+                   stats.evicted - base.evicted, stats.dropped - base.dropped,
+                   max_sent, failures ? "WRONG" : "ok");
+        if (failures)
+        {
+            break;
+        }
+    }
+
+    rt_free(history);
+    ai_conv_set_budget(0);
+    return failures;
+}
+
+/* ==================== cost ==================== */
+
+/* 模拟发送：攒够一段计一次send */
+typedef struct {
+    char buf[CONV_BENCH_SEND_BUF];
+    uint32_t len;
+    uint32_t sends;
+    uint32_t sum;
+} conv_bench_send_t;
+
+static void conv_bench_send(conv_bench_send_t *send, const void *data, uint32_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        send->sum = send->sum * 31 + p[i];
+    }
+    send->sends++;
+}
+
+static int conv_bench_stream_emit(const void *data, uint32_t len, void *user_data)
+{
+    conv_bench_send_t *send = (conv_bench_send_t *)user_data;
+
+    if (send->len + len > sizeof(send->buf))
+    {
+        conv_bench_send(send, send->buf, send->len);
+        send->len = 0;
+        if (len > sizeof(send->buf))
+        {
+            conv_bench_send(send, data, len);
+            return RT_EOK;
+        }
+    }
+    rt_memcpy(send->buf + send->len, data, len);
+    send->len += len;
+    return RT_EOK;
+}
+
+static int conv_bench_cost(conv_bench_flat_t *flat, int count)
+{
+    const char *system = "你是小石，一个友好的智能助手。请用简短的中文回答问题，不超过50字。";
+    conv_bench_send_t send;
+    ai_conv_stats_t stats;
+    rt_tick_t start, rebuild_ticks, stream_ticks;
+    uint32_t rebuild_sum, rebuild_len = 0;
+    char user[128], reply[256];
+    int i;
+
+    /* 填满历史 */
+    ai_conv_clear();
+    srand(7);
+    for (i = 0; i < AI_CONV_MAX_TURNS * 2; i++)
+    {
+        conv_bench_text(user, 60);
+        conv_bench_text(reply, 200);
+        ai_conv_add_turn(user, reply);
+    }
+    ai_conv_get_stats(&stats);
+
+    rt_memset(&send, 0, sizeof(send));
+    start = rt_tick_get();
+    for (i = 0; i < count; i++)
+    {
+        flat->len = 0;
+        ai_conv_write_messages(system, "明天呢？", conv_bench_flat_emit, flat);
+        rebuild_len = flat->len;
+        conv_bench_send(&send, flat->buf, flat->len);
+    }
+    rebuild_ticks = rt_tick_get() - start;
+    rebuild_sum = send.sum;
+
+    rt_memset(&send, 0, sizeof(send));
+    start = rt_tick_get();
+    for (i = 0; i < count; i++)
+    {
+        /* 先算Content-Length，再边序列化边发送 */
+        ai_conv_write_messages(system, "明天呢？", RT_NULL, RT_NULL);
+        send.len = 0;
+        ai_conv_write_messages(system, "明天呢？", conv_bench_stream_emit, &send);
+        conv_bench_send(&send, send.buf, send.len);
+    }
+    stream_ticks = rt_tick_get() - start;
+
+    rt_kprintf("cost       history %d turns, %d tokens, request sends %d turns, %d bytes of messages\n",
+               stats.turns, stats.tokens, stats.last_sent, rebuild_len);
+    rt_kprintf("rebuild    %d requests in %d ms, body buffer %d bytes\n",
+               count, rebuild_ticks * 1000 / RT_TICK_PER_SECOND, rebuild_len);
+    rt_kprintf("stream     %d requests in %d ms, send buffer %d bytes, %d sends per request\n",
+               count, stream_ticks * 1000 / RT_TICK_PER_SECOND, CONV_BENCH_SEND_BUF, send.sends / count);
+
+    if (send.sum != rebuild_sum)
+    {
+        rt_kprintf("cost       stream output differs from rebuild\n");
+        return 1;
+    }
+    return 0;
+}
+
+static int ai_conv_bench(int rounds)
+{
+    conv_bench_flat_t flat;
+    int failures = 0;
+
+    flat.size = CONV_BENCH_BODY_MAX;
+    flat.buf = (char *)rt_malloc(flat.size + 1);
+    if (flat.buf == RT_NULL)
+    {
+        rt_kprintf("Out of memory\n");
+        return -1;
+    }
+
+    failures += conv_bench_escape(&flat);
+    failures += conv_bench_soak(&flat, rounds);
+    failures += conv_bench_cost(&flat, rounds);
+
+    ai_conv_clear();
+    rt_free(flat.buf);
+
+    rt_kprintf("Result: %s\n", failures ? "FAIL" : "PASS");
+    return failures ? -1 : 0;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+#include <finsh.h>
+
+static int cmd_ai_conv_bench(int argc, char **argv)
+{
+    return ai_conv_bench(argc > 1 ? atoi(argv[1]) : 500);
+}
+MSH_CMD_EXPORT_ALIAS(cmd_ai_conv_bench, ai_conv_bench, Conversation context test: ai_conv_bench [rounds]);
+#endif
+
+#ifdef AI_CONV_BENCH_MAIN
+HOST_CRITICAL_LOCK_DEFINE;
+
+int main(int argc, char **argv)
+{
+    return ai_conv_bench(argc > 1 ? atoi(argv[1]) : 500) == 0 ? 0 : 1;
+}
+#endif
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Echo reply TTS cache check
+ */
+
+/*
+ * 复述回复的TTS缓存检查：没有对话服务时全双工复述识别结果，前缀 AI_ECHO_PREFIX 单独合成，
+ * 识别结果不同的两轮之间前缀也能命中缓存。对照 mock_ai_server.py 依次验证
+ *   first      第一轮前缀和识别结果都未命中，两段都加入缓存
+ *   prefix     识别结果不同的第二轮前缀命中、识别结果未命中
+ *   audio      单独合成的前缀（命中）与两轮回复开头的音频逐字节相同
+ *   repeat     与第二轮相同的第三轮两段都命中，音频相同
+ * /stt 的识别结果随请求体长度变化，/tts 的音频长度与文本字数成正比。
+ * 测试期间替换AI服务的配置、使用单独的缓存目录，结束后恢复；对话服务已配置时不复述，不能测试。
+ *
+ * 设备端：echo_bench http://PC_IP:8090 [缓存目录]（默认 /sdcard/tts_echo_bench）
+ * PC端（与设备端同一份ai_cloud_service.c和tts_cache.c）：
+ *   gcc -O2 -DAI_ECHO_BENCH_MAIN -I../host -I. ai_echo_bench.c ai_cloud_service.c ai_chat_service.c ai_conversation.c \
+ *       tts_cache.c audio_decoder.c base64_codec.c web_client.c web_dns.c web_http_parser.c web_sse_parser.c \
+ *       json_stream.c ai_trace.c ai_arena.c memory_helper.c -lpthread -o echo_bench
+ *   python ../mock_ai_server.py 8090 &
+ *   ./echo_bench http://127.0.0.1:8090 /tmp/tts_echo_bench
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include "ai_cloud_service.h"
+#include "ai_chat_service.h"
+#include "tts_cache.h"
+
+#define ECHO_BENCH_SHORT        (16000 * 2)     /* 两种录音长度，识别结果不同 */
+#define ECHO_BENCH_LONG         (16000 * 2 * 2)
+
+static int echo_bench_failed;
+
+static void echo_bench_check(const char *name, int ok)
+{
+    rt_kprintf("%-10s %s\n", name, ok ? "ok" : "FAIL");
+    echo_bench_failed += !ok;
+}
+
+/* 一轮全双工，返回本轮的缓存命中和新加入的条目数 */
+static int echo_bench_turn(const uint8_t *pcm, uint32_t bytes, ai_response_t *response,
+                           uint32_t *hits, uint32_t *stores)
+{
+    tts_cache_stats_t before, after;
+    int ret;
+
+    tts_cache_get_stats(&before);
+    ret = ai_cloud_service_full_duplex(pcm, bytes, response);
+    tts_cache_get_stats(&after);
+
+    *hits = after.hits - before.hits;
+    *stores = after.stores - before.stores;
+    rt_kprintf("echo       \"%s\": %d bytes, first audio %d ms, %d hits, %d stores\n",
+               response->text_result ? response->text_result : "", response->audio_len,
+               response->first_audio_ms, *hits, *stores);
+    return ret;
+}
+
+/* a的开头是否与b相同 */
+static int echo_bench_starts_with(const ai_response_t *a, const ai_response_t *b)
+{
+    return a->audio_result && b->audio_result && a->audio_len > b->audio_len &&
+           rt_memcmp(a->audio_result, b->audio_result, b->audio_len) == 0;
+}
+
+int echo_bench(const char *base_url, const char *dir)
+{
+    ai_service_config_t saved_ai, test_ai;
+    ai_chat_config_t chat_config;
+    ai_response_t first, second, third, prefix;
+    uint32_t hits, stores, i;
+    rt_bool_t has_ai, cache_enabled;
+    uint8_t *pcm;
+    int ok;
+
+    if (ai_chat_service_get_config(&chat_config) == RT_EOK)
+    {
+        rt_kprintf("Chat service is configured, replies are not echoed\n");
+        return -1;
+    }
+
+    pcm = (uint8_t *)rt_malloc(ECHO_BENCH_LONG);
+    if (pcm == RT_NULL)
+    {
+        rt_kprintf("Failed to allocate %d bytes\n", ECHO_BENCH_LONG);
+        return -1;
+    }
+    for (i = 0; i < ECHO_BENCH_LONG; i++)
+    {
+        pcm[i] = (uint8_t)(i * 31 + 7);
+    }
+
+    if (tts_cache_init(dir, 0) != RT_EOK)
+    {
+        rt_kprintf("Cannot open %s\n", dir);
+        rt_free(pcm);
+        return -1;
+    }
+    tts_cache_flush();
+    cache_enabled = tts_cache_set_enabled(RT_TRUE);
+
+    has_ai = (ai_cloud_service_get_config(&saved_ai) == RT_EOK);
+    rt_memset(&test_ai, 0, sizeof(test_ai));
+    test_ai.provider = AI_SERVICE_BAIDU;
+    strncpy(test_ai.api_key, "test_token", sizeof(test_ai.api_key) - 1);
+    strncpy(test_ai.app_id, "test_cuid", sizeof(test_ai.app_id) - 1);
+    rt_snprintf(test_ai.api_url, sizeof(test_ai.api_url), "%s/stt", base_url);
+    rt_snprintf(test_ai.tts_url, sizeof(test_ai.tts_url), "%s/tts?char_bytes=3200", base_url);
+    ai_cloud_service_init(&test_ai);
+
+    echo_bench_failed = 0;
+    rt_memset(&first, 0, sizeof(first));
+    rt_memset(&second, 0, sizeof(second));
+    rt_memset(&third, 0, sizeof(third));
+    rt_memset(&prefix, 0, sizeof(prefix));
+
+    ok = echo_bench_turn(pcm, ECHO_BENCH_SHORT, &first, &hits, &stores) == RT_EOK;
+    ok &= hits == 0 && stores == 2 && !first.cached;
+    echo_bench_check("first", ok);
+
+    ok = echo_bench_turn(pcm, ECHO_BENCH_LONG, &second, &hits, &stores) == RT_EOK;
+    ok &= hits == 1 && stores == 1 && !second.cached;
+    ok &= first.text_result && second.text_result && strcmp(first.text_result, second.text_result) != 0;
+    echo_bench_check("prefix", ok);
+
+    ok = ai_cloud_service_text_to_speech(AI_ECHO_PREFIX, &prefix) == RT_EOK && prefix.cached;
+    ok &= echo_bench_starts_with(&first, &prefix) && echo_bench_starts_with(&second, &prefix);
+    echo_bench_check("audio", ok);
+
+    ok = echo_bench_turn(pcm, ECHO_BENCH_LONG, &third, &hits, &stores) == RT_EOK;
+    ok &= hits == 2 && stores == 0 && third.cached && third.audio_len == second.audio_len &&
+          rt_memcmp(third.audio_result, second.audio_result, second.audio_len) == 0;
+    echo_bench_check("repeat", ok);
+
+    rt_kprintf("Result: %s\n", echo_bench_failed ? "FAIL" : "PASS");
+
+    ai_cloud_service_free_response(&first);
+    ai_cloud_service_free_response(&second);
+    ai_cloud_service_free_response(&third);
+    ai_cloud_service_free_response(&prefix);
+    rt_free(pcm);
+
+    /* 恢复：之后的TTS使用默认目录和原来的配置 */
+    if (has_ai)
+    {
+        ai_cloud_service_init(&saved_ai);
+    }
+    tts_cache_set_enabled(cache_enabled);
+    tts_cache_flush();
+    tts_cache_deinit();
+    tts_cache_init(TTS_CACHE_DIR, 0);
+
+    return echo_bench_failed ? -1 : 0;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+#include <finsh.h>
+
+static int cmd_echo_bench(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        rt_kprintf("Usage: echo_bench <mock_base_url> [cache_dir]\n");
+        rt_kprintf("  e.g. echo_bench http://PC_IP:8090\n");
+        return -1;
+    }
+    return echo_bench(argv[1], argc > 2 ? argv[2] : "/sdcard/tts_echo_bench");
+}
+MSH_CMD_EXPORT_ALIAS(cmd_echo_bench, echo_bench, Check that echo replies reuse the cached prefix audio);
+#endif
+
+#ifdef AI_ECHO_BENCH_MAIN
+HOST_CRITICAL_LOCK_DEFINE;
+
+int main(int argc, char **argv)
+{
+    const char *dir = argc > 2 ? argv[2] : "/tmp/tts_echo_bench";
+
+    if (argc < 2)
+    {
+        rt_kprintf("Usage: %s <mock_base_url> [cache_dir]\n", argv[0]);
+        return 1;
+    }
+
+    mkdir(dir, 0777);
+    return echo_bench(argv[1], dir) == 0 ? 0 : 1;
+}
+#endif
@@ -6,6 +6,8 @@
  * Change Logs:
  * Date           Author       Notes
  * 2024-10-17     AI Assistant AI cloud service test tool
+ * 2024-10-27     AI Assistant Play TTS audio at the sample rate the service reports
+ * 2024-10-27     AI Assistant Show when ai_say audio comes from the TTS cache
  */
 
 #include <rtthread.h>
@@ -90,10 +92,24 @@ static int ai_test_tool_init(void)
     return RT_EOK;
 }
 
+/* TTS音频直接写入播放器，采样率与16kHz不同时由播放器转换 */
+static int ai_say_sink(const uint8_t *pcm, uint32_t len, void *user_data)
+{
+    ai_response_t *response = (ai_response_t *)user_data;
+    
+    if (audio_player_stream_set_rate(response->sample_rate) != RT_EOK)
+    {
+        return -RT_ERROR;
+    }
+    
+    return audio_player_stream_write(pcm, len);
+}
+
 /* 发送文本到AI并播放语音回复 */
 static int ai_say_command(int argc, char **argv)
 {
     ai_response_t response;
+    rt_bool_t streamed = RT_FALSE;
     int ret;
     char text[256] = {0};
     int i;
@@ -135,9 +151,18 @@ static int ai_say_command(int argc, char **argv)
     
     LOG_I("Sending text to AI: %s", text);
     
-    /* 发送到AI进行语音合成 */
+    /* 发送到AI进行语音合成，播放器可用时边下载边播放 */
     rt_memset(&response, 0, sizeof(ai_response_t));
-    ret = ai_cloud_service_text_to_speech(text, &response);
+    if (audio_player_stream_begin() == RT_EOK)
+    {
+        streamed = RT_TRUE;
+        ret = ai_cloud_service_text_to_speech_stream(text, ai_say_sink, &response, &response);
+        audio_player_stream_end();
+    }
+    else
+    {
+        ret = ai_cloud_service_text_to_speech(text, &response);
+    }
     
     if (ret != RT_EOK || response.error_code != 0)
     {
@@ -158,13 +183,21 @@ static int ai_say_command(int argc, char **argv)
     rt_kprintf("\n[AI] Processing completed!\n");
     
     /* 显示AI响应信息 */
-    if (response.audio_result && response.audio_len > 0)
+    if (streamed && response.audio_len > 0)
+    {
+        rt_kprintf("Audio streamed: %d bytes, first audio after %d ms, %s %d ms\n",
+                   response.audio_len, response.first_audio_ms,
+                   response.cached ? "from TTS cache" : "download", response.total_ms);
+        rt_kprintf("Playback completed!\n");
+    }
+    else if (response.audio_result && response.audio_len > 0)
     {
         rt_kprintf("Audio data received: %d bytes\n", response.audio_len);
         
         /* 播放音频 */
         LOG_I("Playing AI response audio...");
-        ret = audio_player_play((uint8_t *)response.audio_result, response.audio_len);
+        ret = audio_player_play_rate((uint8_t *)response.audio_result, response.audio_len,
+                                     response.sample_rate);
         
         if (ret == RT_EOK)
         {
@@ -0,0 +1,641 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Per-stage latency trace ring
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "ai_trace.h"
+#include "memory_helper.h"
+
+#ifdef __RTTHREAD__
+#include <board.h>
+#else
+#include <sys/prctl.h>
+#endif
+
+#define DBG_TAG "ai.trace"
+#define DBG_LVL DBG_INFO
+#include <rtdbg.h>
+
+#define AI_TRACE_MASK       (AI_TRACE_EVENTS - 1)
+#define AI_TRACE_THREADS    16      /* 导出时区分的线程数，更多的线程的事件跳过 */
+#define AI_TRACE_DEPTH      16      /* 每个线程记录开始时间的嵌套层数 */
+#define AI_TRACE_NAMES      48      /* 汇总的事件名数 */
+#define AI_TRACE_LINE_MAX   192     /* 导出的一行JSON */
+#define AI_TRACE_WRITE_BUF  2048
+
+#if (AI_TRACE_EVENTS & AI_TRACE_MASK) != 0
+#error "AI_TRACE_EVENTS must be a power of 2"
+#endif
+
+/* 单核M7和x86上写入顺序即为其他线程看到的顺序，只需要阻止编译器重排 */
+#define AI_TRACE_BARRIER()  __asm volatile ("" ::: "memory")
+
+typedef struct {
+    volatile uint32_t seq;      /* 槽位序号+1，写入中为0 */
+    uint32_t cycles;            /* 时间戳计数的低32位 */
+    rt_tick_t tick;             /* 同时的系统节拍，用于消除回绕 */
+    uint32_t arg;
+    const char *name;
+    char phase;
+    char thread[RT_NAME_MAX];
+} ai_trace_event_t;
+
+static struct {
+    ai_trace_event_t *ring;
+    volatile rt_atomic_t head;  /* 下一个槽位序号 */
+    volatile rt_atomic_t start; /* 清空时的序号，之前的事件不再导出 */
+    volatile rt_bool_t enabled;
+    uint32_t clock_hz;
+    uint32_t cycles_per_tick;
+    uint64_t base_cycles;       /* 初始化时的计数（加一圈，避免减到负数）*/
+    rt_tick_t base_tick;
+} ai_trace;
+
+/* 导出时每个线程的状态 */
+typedef struct {
+    char name[RT_NAME_MAX];
+    uint32_t depth;                     /* 未结束的时间段层数 */
+    uint64_t begin[AI_TRACE_DEPTH];     /* 各层的开始时间(ns) */
+} ai_trace_thread_t;
+
+typedef struct {
+    ai_trace_thread_t threads[AI_TRACE_THREADS];
+    uint32_t thread_count;
+    rt_bool_t has_origin;
+    uint64_t origin;                    /* 第一个事件的时间，导出的时间从0开始 */
+} ai_trace_walk_t;
+
+/* 遍历的回调：ts为相对第一个事件的纳秒，duration为结束事件所在时间段的长度（开始已被覆盖时为0）*/
+typedef int (*ai_trace_visit_cb)(const ai_trace_event_t *ev, uint32_t tid, rt_bool_t new_thread,
+                                 uint64_t ts, uint64_t duration, void *user_data);
+
+static uint32_t ai_trace_clock(void)
+{
+#ifdef __RTTHREAD__
+    return DWT->CYCCNT;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+#endif
+}
+
+static void ai_trace_thread_name(char *name)
+{
+#ifdef __RTTHREAD__
+    rt_thread_t thread = rt_thread_self();
+
+    if (rt_interrupt_get_nest() > 0 || thread == RT_NULL)
+    {
+        rt_strncpy(name, rt_interrupt_get_nest() > 0 ? "isr" : "init", RT_NAME_MAX);
+        return;
+    }
+    rt_memcpy(name, thread->parent.name, RT_NAME_MAX);
+#else
+    /* Linux的线程名最长16字节（含结尾的0）*/
+    prctl(PR_GET_NAME, name);
+#endif
+}
+
+int ai_trace_init(void)
+{
+    ai_trace_event_t *ring;
+
+    if (ai_trace.ring != RT_NULL)
+    {
+        return RT_EOK;
+    }
+
+    ring = (ai_trace_event_t *)mem_class_alloc(MEM_CLASS_BULK, AI_TRACE_EVENTS * sizeof(ai_trace_event_t));
+    if (ring == RT_NULL)
+    {
+        LOG_E("Failed to allocate trace ring (%d events)", AI_TRACE_EVENTS);
+        return -RT_ENOMEM;
+    }
+    rt_memset(ring, 0, AI_TRACE_EVENTS * sizeof(ai_trace_event_t));
+
+#ifdef __RTTHREAD__
+    /* 其他测试也会打开DWT，只在未打开时清零，之后计数器不能再被清零 */
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    ai_trace.clock_hz = SystemCoreClock;
+#else
+    ai_trace.clock_hz = 1000000000UL;
+#endif
+    ai_trace.cycles_per_tick = ai_trace.clock_hz / RT_TICK_PER_SECOND;
+    ai_trace.base_tick = rt_tick_get();
+    ai_trace.base_cycles = (uint64_t)ai_trace_clock() + 0x100000000ULL;
+    ai_trace.head = 0;
+    ai_trace.start = 0;
+    ai_trace.enabled = RT_TRUE;
+
+    AI_TRACE_BARRIER();
+    ai_trace.ring = ring;
+
+    LOG_I("Trace: %d events (%d KB), clock %d Hz", AI_TRACE_EVENTS,
+          (int)(AI_TRACE_EVENTS * sizeof(ai_trace_event_t) / 1024), ai_trace.clock_hz);
+
+    return RT_EOK;
+}
+
+void ai_trace_event(const char *name, char phase, uint32_t arg)
+{
+    ai_trace_event_t *ev;
+    uint32_t seq;
+
+    if (ai_trace.ring == RT_NULL || !ai_trace.enabled)
+    {
+        return;
+    }
+
+    seq = (uint32_t)rt_atomic_add(&ai_trace.head, 1);
+    ev = &ai_trace.ring[seq & AI_TRACE_MASK];
+
+    ev->seq = 0;
+    AI_TRACE_BARRIER();
+    ev->cycles = ai_trace_clock();
+    ev->tick = rt_tick_get();
+    ev->arg = arg;
+    ev->name = name;
+    ev->phase = phase;
+    ai_trace_thread_name(ev->thread);
+    AI_TRACE_BARRIER();
+    ev->seq = seq + 1;
+}
+
+void ai_trace_set_enabled(rt_bool_t enabled)
+{
+    ai_trace.enabled = enabled;
+}
+
+void ai_trace_clear(void)
+{
+    rt_atomic_store(&ai_trace.start, rt_atomic_load(&ai_trace.head));
+}
+
+void ai_trace_get_stats(ai_trace_stats_t *stats)
+{
+    uint32_t recorded = (uint32_t)(rt_atomic_load(&ai_trace.head) - rt_atomic_load(&ai_trace.start));
+
+    stats->size = ai_trace.ring ? AI_TRACE_EVENTS : 0;
+    stats->recorded = recorded;
+    stats->overwritten = recorded > AI_TRACE_EVENTS ? recorded - AI_TRACE_EVENTS : 0;
+    stats->clock_hz = ai_trace.clock_hz;
+    stats->enabled = ai_trace.enabled;
+}
+
+/* 事件的完整时间(ns)：节拍给出不回绕的粗略时间，在它附近取与计数低32位一致的值 */
+static uint64_t ai_trace_time(const ai_trace_event_t *ev)
+{
+    uint64_t expect, cycles;
+
+    expect = ai_trace.base_cycles +
+             (uint64_t)(rt_tick_t)(ev->tick - ai_trace.base_tick) * ai_trace.cycles_per_tick;
+    cycles = expect + (int64_t)(int32_t)(ev->cycles - (uint32_t)expect);
+
+    return cycles / ai_trace.clock_hz * 1000000000ULL +
+           cycles % ai_trace.clock_hz * 1000000000ULL / ai_trace.clock_hz;
+}
+
+static int ai_trace_find_thread(ai_trace_walk_t *walk, const char *name, rt_bool_t *created)
+{
+    uint32_t i;
+
+    *created = RT_FALSE;
+    for (i = 0; i < walk->thread_count; i++)
+    {
+        if (strncmp(walk->threads[i].name, name, RT_NAME_MAX) == 0)
+        {
+            return (int)i;
+        }
+    }
+    if (walk->thread_count == AI_TRACE_THREADS)
+    {
+        return -1;
+    }
+
+    rt_memcpy(walk->threads[i].name, name, RT_NAME_MAX);
+    walk->threads[i].name[RT_NAME_MAX - 1] = '\0';
+    walk->threads[i].depth = 0;
+    walk->thread_count++;
+    *created = RT_TRUE;
+    return (int)i;
+}
+
+/* 按序号顺序遍历缓冲区中完整的事件；开始已被覆盖的结束事件跳过 */
+static int ai_trace_walk(ai_trace_walk_t *walk, ai_trace_visit_cb visit, void *user_data)
+{
+    const ai_trace_event_t *src;
+    ai_trace_event_t ev;
+    ai_trace_thread_t *thread;
+    uint32_t head, seq;
+    uint64_t now, ts, duration;
+    rt_bool_t created;
+    int tid;
+    int count = 0;
+
+    if (ai_trace.ring == RT_NULL)
+    {
+        return 0;
+    }
+
+    rt_memset(walk, 0, sizeof(ai_trace_walk_t));
+    head = (uint32_t)rt_atomic_load(&ai_trace.head);
+    seq = (uint32_t)rt_atomic_load(&ai_trace.start);
+    if (head - seq > AI_TRACE_EVENTS)
+    {
+        seq = head - AI_TRACE_EVENTS;
+    }
+
+    for (; seq != head; seq++)
+    {
+        /* 拷贝前后序号都对才是完整的事件，否则正在写入或已被新事件覆盖 */
+        src = &ai_trace.ring[seq & AI_TRACE_MASK];
+        if (src->seq != seq + 1)
+        {
+            continue;
+        }
+        AI_TRACE_BARRIER();
+        rt_memcpy(&ev, src, sizeof(ev));
+        AI_TRACE_BARRIER();
+        if (src->seq != seq + 1)
+        {
+            continue;
+        }
+        ev.thread[RT_NAME_MAX - 1] = '\0';
+
+        tid = ai_trace_find_thread(walk, ev.thread, &created);
+        if (tid < 0)
+        {
+            continue;
+        }
+        thread = &walk->threads[tid];
+
+        now = ai_trace_time(&ev);
+        if (!walk->has_origin)
+        {
+            walk->has_origin = RT_TRUE;
+            walk->origin = now;
+        }
+        /* 取得槽位和读时钟之间被抢占的事件可能比前一个早一点 */
+        ts = now > walk->origin ? now - walk->origin : 0;
+
+        duration = 0;
+        if (ev.phase == AI_TRACE_PH_BEGIN)
+        {
+            if (thread->depth < AI_TRACE_DEPTH)
+            {
+                thread->begin[thread->depth] = ts;
+            }
+            thread->depth++;
+        }
+        else if (ev.phase == AI_TRACE_PH_END)
+        {
+            if (thread->depth == 0)
+            {
+                continue;
+            }
+            thread->depth--;
+            if (thread->depth < AI_TRACE_DEPTH && ts > thread->begin[thread->depth])
+            {
+                duration = ts - thread->begin[thread->depth];
+            }
+        }
+
+        if (visit(&ev, (uint32_t)tid, created, ts, duration, user_data) != RT_EOK)
+        {
+            return -RT_ERROR;
+        }
+        count++;
+    }
+
+    return count;
+}
+
+/* 导出的缓冲写入 */
+typedef struct {
+    int fd;
+    uint32_t len;
+    rt_bool_t failed;
+    char *buf;
+} ai_trace_writer_t;
+
+static void ai_trace_flush(ai_trace_writer_t *writer)
+{
+    if (writer->len > 0 && !writer->failed &&
+        write(writer->fd, writer->buf, writer->len) != (int)writer->len)
+    {
+        writer->failed = RT_TRUE;
+    }
+    writer->len = 0;
+}
+
+/* ts以微秒为单位，保留到纳秒；超过4294秒时整数部分分两段输出 */
+static int ai_trace_format_ts(char *buf, uint32_t size, uint64_t ns)
+{
+    uint32_t sec = (uint32_t)(ns / 1000000000ULL);
+    uint32_t rem = (uint32_t)(ns % 1000000000ULL);
+
+    if (sec > 0)
+    {
+        return rt_snprintf(buf, size, "%u%06u.%03u", sec, rem / 1000, rem % 1000);
+    }
+    return rt_snprintf(buf, size, "%u.%03u", rem / 1000, rem % 1000);
+}
+
+static int ai_trace_dump_event(const ai_trace_event_t *ev, uint32_t tid, rt_bool_t new_thread,
+                               uint64_t ts, uint64_t duration, void *user_data)
+{
+    ai_trace_writer_t *writer = (ai_trace_writer_t *)user_data;
+    char *line;
+    char ts_text[24];
+    int len;
+
+    (void)duration;
+    if (writer->len + 2 * AI_TRACE_LINE_MAX > AI_TRACE_WRITE_BUF)
+    {
+        ai_trace_flush(writer);
+        if (writer->failed)
+        {
+            return -RT_EIO;
+        }
+    }
+
+    /* 线程第一次出现时先给出线程名 */
+    if (new_thread)
+    {
+        line = writer->buf + writer->len;
+        len = rt_snprintf(line, AI_TRACE_LINE_MAX,
+                          ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                          "\"args\":{\"name\":\"%s\"}}",
+                          tid, ev->thread);
+        writer->len += len;
+    }
+
+    ai_trace_format_ts(ts_text, sizeof(ts_text), ts);
+    line = writer->buf + writer->len;
+    len = rt_snprintf(line, AI_TRACE_LINE_MAX, ",\n{\"name\":\"%s\",\"ph\":\"%c\",%s\"ts\":%s,\"pid\":1,\"tid\":%u",
+                      ev->name, ev->phase, ev->phase == AI_TRACE_PH_INSTANT ? "\"s\":\"t\"," : "",
+                      ts_text, tid);
+    if (ev->phase == AI_TRACE_PH_COUNTER)
+    {
+        len += rt_snprintf(line + len, AI_TRACE_LINE_MAX - len, ",\"args\":{\"value\":%u}}", ev->arg);
+    }
+    else if (ev->arg != 0)
+    {
+        len += rt_snprintf(line + len, AI_TRACE_LINE_MAX - len, ",\"args\":{\"arg\":%u}}", ev->arg);
+    }
+    else
+    {
+        len += rt_snprintf(line + len, AI_TRACE_LINE_MAX - len, "}");
+    }
+    writer->len += len;
+
+    return RT_EOK;
+}
+
+int ai_trace_dump(const char *path)
+{
+    static const char head[] = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+                               "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"voice\"}}";
+    static const char tail[] = "\n]}\n";
+    ai_trace_walk_t *walk;
+    ai_trace_writer_t writer;
+    int count;
+
+    if (ai_trace.ring == RT_NULL)
+    {
+        LOG_E("Trace not initialized");
+        return -RT_ERROR;
+    }
+
+    walk = (ai_trace_walk_t *)rt_malloc(sizeof(ai_trace_walk_t));
+    writer.buf = (char *)rt_malloc(AI_TRACE_WRITE_BUF);
+    if (walk == RT_NULL || writer.buf == RT_NULL)
+    {
+        LOG_E("Failed to allocate trace export buffers");
+        rt_free(walk);
+        rt_free(writer.buf);
+        return -RT_ENOMEM;
+    }
+
+    writer.fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (writer.fd < 0)
+    {
+        LOG_E("Failed to create %s", path);
+        rt_free(walk);
+        rt_free(writer.buf);
+        return -RT_EIO;
+    }
+    writer.failed = RT_FALSE;
+    writer.len = sizeof(head) - 1;
+    rt_memcpy(writer.buf, head, writer.len);
+
+    count = ai_trace_walk(walk, ai_trace_dump_event, &writer);
+
+    rt_memcpy(writer.buf + writer.len, tail, sizeof(tail) - 1);
+    writer.len += sizeof(tail) - 1;
+    ai_trace_flush(&writer);
+    close(writer.fd);
+
+    rt_free(walk);
+    rt_free(writer.buf);
+
+    if (count < 0 || writer.failed)
+    {
+        LOG_E("Failed to write %s", path);
+        return -RT_EIO;
+    }
+
+    return count;
+}
+
+/* 汇总：每个事件名的时间段次数和耗时 */
+typedef struct {
+    const char *name;
+    char phase;
+    uint32_t count;
+    uint64_t total;
+    uint64_t max;
+} ai_trace_sum_t;
+
+typedef struct {
+    ai_trace_sum_t names[AI_TRACE_NAMES];
+    uint32_t count;
+} ai_trace_summary_t;
+
+static int ai_trace_sum_event(const ai_trace_event_t *ev, uint32_t tid, rt_bool_t new_thread,
+                              uint64_t ts, uint64_t duration, void *user_data)
+{
+    ai_trace_summary_t *summary = (ai_trace_summary_t *)user_data;
+    ai_trace_sum_t *sum = RT_NULL;
+    uint32_t i;
+
+    (void)tid;
+    (void)new_thread;
+    (void)ts;
+    /* 时间段在结束时按结束事件的名字计入 */
+    if (ev->phase == AI_TRACE_PH_BEGIN)
+    {
+        return RT_EOK;
+    }
+
+    for (i = 0; i < summary->count; i++)
+    {
+        if (summary->names[i].phase == ev->phase &&
+            (summary->names[i].name == ev->name || strcmp(summary->names[i].name, ev->name) == 0))
+        {
+            sum = &summary->names[i];
+            break;
+        }
+    }
+    if (sum == RT_NULL)
+    {
+        if (summary->count == AI_TRACE_NAMES)
+        {
+            return RT_EOK;
+        }
+        sum = &summary->names[summary->count++];
+        sum->name = ev->name;
+        sum->phase = ev->phase;
+    }
+
+    sum->count++;
+    if (ev->phase == AI_TRACE_PH_END)
+    {
+        sum->total += duration;
+        if (duration > sum->max)
+        {
+            sum->max = duration;
+        }
+    }
+    else
+    {
+        /* 时刻和计数事件记录最后的参数 */
+        sum->total = ev->arg;
+    }
+
+    return RT_EOK;
+}
+
+void ai_trace_summary(void)
+{
+    ai_trace_walk_t *walk;
+    ai_trace_summary_t *summary;
+    ai_trace_stats_t stats;
+    ai_trace_sum_t *sum;
+    uint32_t avg_us, max_us;
+    uint32_t i;
+    int count;
+
+    ai_trace_get_stats(&stats);
+    rt_kprintf("Trace: %s, %d events, %d recorded, %d overwritten, clock %d Hz\n",
+               stats.enabled ? "on" : "off", stats.size, stats.recorded, stats.overwritten, stats.clock_hz);
+
+    walk = (ai_trace_walk_t *)rt_malloc(sizeof(ai_trace_walk_t));
+    summary = (ai_trace_summary_t *)rt_calloc(1, sizeof(ai_trace_summary_t));
+    if (walk == RT_NULL || summary == RT_NULL)
+    {
+        rt_free(walk);
+        rt_free(summary);
+        return;
+    }
+
+    count = ai_trace_walk(walk, ai_trace_sum_event, summary);
+    if (count > 0)
+    {
+        rt_kprintf("%-20s %6s %12s %12s\n", "span", "count", "avg (ms)", "max (ms)");
+        for (i = 0; i < summary->count; i++)
+        {
+            sum = &summary->names[i];
+            if (sum->phase != AI_TRACE_PH_END)
+            {
+                continue;
+            }
+            avg_us = (uint32_t)(sum->total / sum->count / 1000);
+            max_us = (uint32_t)(sum->max / 1000);
+            rt_kprintf("%-20s %6d %8d.%03d %8d.%03d\n", sum->name, sum->count,
+                       avg_us / 1000, avg_us % 1000, max_us / 1000, max_us % 1000);
+        }
+        for (i = 0; i < summary->count; i++)
+        {
+            sum = &summary->names[i];
+            if (sum->phase != AI_TRACE_PH_END)
+            {
+                rt_kprintf("%-20s %6d %12s %12d\n", sum->name, sum->count,
+                           sum->phase == AI_TRACE_PH_COUNTER ? "last value" : "last arg", (uint32_t)sum->total);
+            }
+        }
+        rt_kprintf("Threads:");
+        for (i = 0; i < walk->thread_count; i++)
+        {
+            rt_kprintf(" %s", walk->threads[i].name);
+        }
+        rt_kprintf("\n");
+    }
+
+    rt_free(walk);
+    rt_free(summary);
+}
+
+#ifdef FINSH_USING_MSH
+#include <finsh.h>
+
+static int cmd_ai_trace(int argc, char **argv)
+{
+    const char *path;
+    int count;
+
+    if (ai_trace_init() != RT_EOK)
+    {
+        return -1;
+    }
+
+    if (argc < 2)
+    {
+        ai_trace_summary();
+        return 0;
+    }
+
+    if (strcmp(argv[1], "dump") == 0)
+    {
+        path = argc > 2 ? argv[2] : AI_TRACE_DUMP_PATH;
+        count = ai_trace_dump(path);
+        if (count < 0)
+        {
+            return -1;
+        }
+        rt_kprintf("%d events written to %s, open it in chrome://tracing or ui.perfetto.dev\n", count, path);
+    }
+    else if (strcmp(argv[1], "clear") == 0)
+    {
+        ai_trace_clear();
+    }
+    else if (strcmp(argv[1], "on") == 0 || strcmp(argv[1], "off") == 0)
+    {
+        ai_trace_set_enabled(strcmp(argv[1], "on") == 0);
+    }
+    else
+    {
+        rt_kprintf("Usage: ai_trace [dump [path] | clear | on | off]\n");
+        return -1;
+    }
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_ai_trace, ai_trace, Voice latency trace: ai_trace [dump [path] | clear | on | off]);
+#endif
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Per-stage latency trace ring
+ */
+
+#ifndef __AI_TRACE_H__
+#define __AI_TRACE_H__
+
+/*
+ * 语音交互的分段耗时追踪：录音、DNS、连接、上传、等待云端、下载、解码、播放等位置打点，
+ * 事件记录在RAM中的环形缓冲区里，ai_trace dump 导出为Chrome trace JSON
+ * （chrome://tracing 或 ui.perfetto.dev 打开，按线程显示嵌套的时间段）
+ *   - 时间戳：设备端为DWT周期计数，PC端为clock_gettime的纳秒；同时记下系统节拍，
+ *     导出时由节拍消除计数器32位回绕（600MHz下约7秒一圈）的歧义
+ *   - 记录不加锁：原子递增取得槽位后写入，写完再写序号；缓冲区满时覆盖最早的事件，
+ *     导出时序号不符（正在写或已被覆盖）的事件跳过
+ *   - 事件名只保存指针，必须是字符串常量；线程名在记录时拷贝，线程退出后仍然可读
+ *   - ai_trace_init() 之前或 AI_TRACE_ENABLE 为0时不记录
+ */
+
+#include <rtthread.h>
+
+/* 为0时打点宏为空，不占用任何代码和内存 */
+#ifndef AI_TRACE_ENABLE
+#define AI_TRACE_ENABLE     1
+#endif
+
+/* 环形缓冲区的事件数（2的幂），每个事件40字节，位于PSRAM */
+#ifndef AI_TRACE_EVENTS
+#define AI_TRACE_EVENTS     1024
+#endif
+
+#define AI_TRACE_DUMP_PATH  "/sdcard/trace.json"
+
+/* 事件类型，即Chrome trace的ph字段 */
+#define AI_TRACE_PH_BEGIN   'B'     /* 时间段开始 */
+#define AI_TRACE_PH_END     'E'     /* 时间段结束，与同一线程最近的开始配对 */
+#define AI_TRACE_PH_INSTANT 'i'     /* 时刻 */
+#define AI_TRACE_PH_COUNTER 'C'     /* 计数值 */
+
+typedef struct {
+    uint32_t size;          /* 缓冲区事件数，0表示未初始化 */
+    uint32_t recorded;      /* 上次清空以来记录的事件数 */
+    uint32_t overwritten;   /* 其中被覆盖的事件数 */
+    uint32_t clock_hz;      /* 时间戳计数频率 */
+    rt_bool_t enabled;
+} ai_trace_stats_t;
+
+#if AI_TRACE_ENABLE
+#define AI_TRACE_BEGIN(name)            ai_trace_event(name, AI_TRACE_PH_BEGIN, 0)
+#define AI_TRACE_END(name, arg)         ai_trace_event(name, AI_TRACE_PH_END, (uint32_t)(arg))
+#define AI_TRACE_INSTANT(name, arg)     ai_trace_event(name, AI_TRACE_PH_INSTANT, (uint32_t)(arg))
+#define AI_TRACE_COUNTER(name, value)   ai_trace_event(name, AI_TRACE_PH_COUNTER, (uint32_t)(value))
+#else
+#define AI_TRACE_BEGIN(name)            ((void)0)
+#define AI_TRACE_END(name, arg)         ((void)0)
+#define AI_TRACE_INSTANT(name, arg)     ((void)0)
+#define AI_TRACE_COUNTER(name, value)   ((void)0)
+#endif
+
+/* 分配环形缓冲区并开始记录；重复调用直接返回 */
+int ai_trace_init(void);
+
+/* 记录一个事件，arg在导出时作为args（结束事件为本段的附加数据，计数事件为计数值）；
+ * 可以在任意线程和中断中调用 */
+void ai_trace_event(const char *name, char phase, uint32_t arg);
+
+/* 暂停/恢复记录 */
+void ai_trace_set_enabled(rt_bool_t enabled);
+
+/* 丢弃已记录的事件 */
+void ai_trace_clear(void);
+
+/* 导出为Chrome trace JSON，返回写出的事件数，失败返回负值 */
+int ai_trace_dump(const char *path);
+
+/* 按事件名汇总时间段的次数、平均和最大耗时，打印到控制台 */
+void ai_trace_summary(void);
+
+void ai_trace_get_stats(ai_trace_stats_t *stats);
+
+#endif /* __AI_TRACE_H__ */
@@ -0,0 +1,476 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Trace ring test
+ */
+
+/*
+ * 延迟追踪环形缓冲区的测试，导出的JSON读回后逐行检查：
+ *   nested     多个线程同时记录三层嵌套的时间段，事件数、每个线程的开始/结束配对和时间顺序
+ *   stress     记录的同时反复导出，缓冲区被多次覆盖；导出的事件不能是半写的
+ *              （时刻和结束事件的参数必须相同），结束事件不能多于开始事件
+ *   overwrite  记录缓冲区三倍的事件，只导出最新的一圈
+ *   wrap       时间段跨过时间戳计数器的回绕（设备端600MHz约7.2秒，PC端约4.3秒），长度仍然正确
+ *   cost       每个事件的记录耗时，单线程和多线程
+ * 测试会清空已记录的事件，应在语音助手空闲时运行。
+ *
+ * 设备端：trace_bench [导出文件]
+ * PC端（与设备端同一份ai_trace.c）：
+ *   gcc -O2 -DAI_TRACE_BENCH_MAIN -I../host -I. ai_trace.c memory_helper.c ai_trace_bench.c -lpthread -o trace_bench
+ *   ./trace_bench trace_bench.json
+ *   python -m json.tool trace_bench.json > /dev/null
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "ai_trace.h"
+
+#define TRACE_BENCH_THREADS     4
+#define TRACE_BENCH_ROUNDS      30      /* 4个线程x30轮x8个事件，不超过缓冲区 */
+#define TRACE_BENCH_STRESS      5000
+#define TRACE_BENCH_DUMPS       20
+#define TRACE_BENCH_COST        1000000
+#define TRACE_BENCH_TIDS        16
+
+#ifdef __RTTHREAD__
+#define TRACE_BENCH_PATH        "/sdcard/trace_bench.json"
+#else
+#define TRACE_BENCH_PATH        "trace_bench.json"
+#endif
+
+#define TRACE_BENCH_TICK_TO_MS(t)   ((uint32_t)((uint64_t)(t) * 1000 / RT_TICK_PER_SECOND))
+
+static struct {
+    rt_sem_t done;
+    volatile rt_atomic_t finished;
+    volatile rt_bool_t stop;
+    uint32_t rounds;
+    uint32_t events;        /* 只记录，不成对，测耗时用 */
+} trace_bench;
+
+/* 读回的一个线程 */
+typedef struct {
+    rt_bool_t worker;       /* 测试线程（名字以tb开头）*/
+    int depth;
+    double last_ts;
+    uint32_t mark;
+    uint32_t begins;
+    uint32_t ends;
+} trace_bench_tid_t;
+
+typedef struct {
+    trace_bench_tid_t tids[TRACE_BENCH_TIDS];
+    uint32_t events;        /* 测试线程的事件数 */
+    uint32_t errors;
+    double wrap_begin;
+    double wrap_ms;
+} trace_bench_check_t;
+
+static void trace_bench_worker(void *parameter)
+{
+    uint32_t i;
+
+    (void)parameter;
+    for (i = 0; i < trace_bench.rounds && !trace_bench.stop; i++)
+    {
+        if (trace_bench.events > 0)
+        {
+            AI_TRACE_INSTANT("cost", i);
+            continue;
+        }
+        AI_TRACE_BEGIN("outer");
+        AI_TRACE_BEGIN("middle");
+        AI_TRACE_BEGIN("inner");
+        AI_TRACE_INSTANT("mark", i);
+        AI_TRACE_END("inner", i);
+        AI_TRACE_END("middle", 0);
+        AI_TRACE_END("outer", 0);
+        AI_TRACE_COUNTER("round", i);
+    }
+
+    rt_atomic_add(&trace_bench.finished, 1);
+    rt_sem_release(trace_bench.done);
+}
+
+static const char *trace_bench_field(const char *line, const char *key)
+{
+    const char *p = strstr(line, key);
+
+    return p ? p + strlen(key) : RT_NULL;
+}
+
+/* 检查导出的一行 */
+static void trace_bench_line(trace_bench_check_t *check, const char *line)
+{
+    const char *name, *ph, *ts, *tid, *arg;
+    trace_bench_tid_t *t;
+    double time;
+    uint32_t value;
+    int id;
+
+    name = trace_bench_field(line, "{\"name\":\"");
+    ph = trace_bench_field(line, "\"ph\":\"");
+    tid = trace_bench_field(line, "\"tid\":");
+    if (name == RT_NULL || ph == RT_NULL || tid == RT_NULL)
+    {
+        return;
+    }
+    id = atoi(tid);
+    if (id < 0 || id >= TRACE_BENCH_TIDS)
+    {
+        check->errors++;
+        return;
+    }
+    t = &check->tids[id];
+
+    if (*ph == 'M')
+    {
+        arg = trace_bench_field(line, "\"args\":{\"name\":\"");
+        t->worker = (arg != RT_NULL && strncmp(arg, "tb", 2) == 0);
+        return;
+    }
+
+    ts = trace_bench_field(line, "\"ts\":");
+    time = ts ? strtod(ts, RT_NULL) : -1;
+    arg = trace_bench_field(line, "\"args\":{\"arg\":");
+    value = arg ? (uint32_t)strtoul(arg, RT_NULL, 10) : 0;
+
+    if (strncmp(name, "wrap\"", 5) == 0)
+    {
+        if (*ph == 'B')
+        {
+            check->wrap_begin = time;
+        }
+        else if (*ph == 'E')
+        {
+            check->wrap_ms = (time - check->wrap_begin) / 1000;
+        }
+        return;
+    }
+    if (!t->worker)
+    {
+        return;
+    }
+
+    check->events++;
+    if (time < t->last_ts)
+    {
+        check->errors++;
+    }
+    t->last_ts = time;
+
+    switch (*ph)
+    {
+    case 'B':
+        t->depth++;
+        t->begins++;
+        break;
+    case 'E':
+        t->ends++;
+        if (--t->depth < 0)
+        {
+            check->errors++;
+        }
+        /* 三层都完整时，内层的结束与前面的时刻属于同一轮 */
+        if (strncmp(name, "inner\"", 6) == 0 && t->depth == 2 && value != t->mark)
+        {
+            check->errors++;
+        }
+        break;
+    case 'i':
+        if (strncmp(name, "mark\"", 5) == 0)
+        {
+            t->mark = value;
+        }
+        break;
+    case 'C':
+        break;
+    default:
+        check->errors++;
+        break;
+    }
+}
+
+/* 导出并读回检查 */
+static int trace_bench_check(const char *path, trace_bench_check_t *check)
+{
+    struct stat st;
+    char *text, *line, *end;
+    int count, fd, len;
+
+    /* 错误数在多次导出之间累计 */
+    rt_memset(check->tids, 0, sizeof(check->tids));
+    check->events = 0;
+
+    count = ai_trace_dump(path);
+    if (count < 0 || stat(path, &st) != 0)
+    {
+        return -1;
+    }
+
+    text = (char *)rt_malloc(st.st_size + 1);
+    fd = open(path, O_RDONLY);
+    if (text == RT_NULL || fd < 0)
+    {
+        rt_free(text);
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        return -1;
+    }
+    len = read(fd, text, st.st_size);
+    close(fd);
+    text[len > 0 ? len : 0] = '\0';
+
+    if (strncmp(text, "{\"displayTimeUnit\"", 18) != 0 || strstr(text, "\n]}\n") == RT_NULL)
+    {
+        check->errors++;
+    }
+    for (line = text; line && *line; line = end)
+    {
+        end = strchr(line, '\n');
+        if (end)
+        {
+            *end++ = '\0';
+        }
+        trace_bench_line(check, line);
+    }
+
+    rt_free(text);
+    return count;
+}
+
+/* 启动测试线程；check不为空时在它们运行期间反复导出并检查 */
+static int trace_bench_run(uint32_t rounds, const char *path, trace_bench_check_t *check, uint32_t *dumps)
+{
+    char name[RT_NAME_MAX];
+    rt_thread_t thread;
+    int started = 0;
+    int i;
+
+    trace_bench.rounds = rounds;
+    trace_bench.stop = RT_FALSE;
+    rt_atomic_store(&trace_bench.finished, 0);
+    for (i = 0; i < TRACE_BENCH_THREADS; i++)
+    {
+        rt_snprintf(name, sizeof(name), "tb%d", i);
+        thread = rt_thread_create(name, trace_bench_worker, RT_NULL, 2048, 20, 1);
+        if (thread != RT_NULL && rt_thread_startup(thread) == RT_EOK)
+        {
+            started++;
+        }
+    }
+
+    while (check && (int)rt_atomic_load(&trace_bench.finished) < started && *dumps < TRACE_BENCH_DUMPS)
+    {
+        if (trace_bench_check(path, check) < 0)
+        {
+            trace_bench.stop = RT_TRUE;
+            break;
+        }
+        (*dumps)++;
+    }
+    for (i = 0; i < started; i++)
+    {
+        rt_sem_take(trace_bench.done, RT_WAITING_FOREVER);
+    }
+
+    return started == TRACE_BENCH_THREADS ? RT_EOK : -RT_ERROR;
+}
+
+static rt_bool_t trace_bench_nested(const char *path)
+{
+    trace_bench_check_t check;
+    uint32_t expect = TRACE_BENCH_THREADS * TRACE_BENCH_ROUNDS * 8;
+    rt_bool_t ok;
+    int workers = 0;
+    int i;
+
+    rt_memset(&check, 0, sizeof(check));
+    ai_trace_clear();
+    if (trace_bench_run(TRACE_BENCH_ROUNDS, RT_NULL, RT_NULL, RT_NULL) != RT_EOK ||
+        trace_bench_check(path, &check) < 0)
+    {
+        rt_kprintf("nested     failed to run\n");
+        return RT_FALSE;
+    }
+
+    ok = (check.events == expect && check.errors == 0);
+    for (i = 0; i < TRACE_BENCH_TIDS; i++)
+    {
+        if (check.tids[i].worker)
+        {
+            workers++;
+            ok = ok && check.tids[i].depth == 0 && check.tids[i].begins == TRACE_BENCH_ROUNDS * 3 &&
+                 check.tids[i].ends == TRACE_BENCH_ROUNDS * 3;
+        }
+    }
+    ok = ok && workers == TRACE_BENCH_THREADS;
+
+    rt_kprintf("nested     %d threads x %d rounds, %d/%d events, errors %d, %s\n", workers,
+               TRACE_BENCH_ROUNDS, check.events, expect, check.errors, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+static rt_bool_t trace_bench_stress(const char *path)
+{
+    trace_bench_check_t check;
+    uint32_t dumps = 0;
+    rt_bool_t ok;
+
+    rt_memset(&check, 0, sizeof(check));
+    ai_trace_clear();
+    if (trace_bench_run(TRACE_BENCH_STRESS, path, &check, &dumps) != RT_EOK ||
+        trace_bench_check(path, &check) < 0)
+    {
+        rt_kprintf("stress     failed to run\n");
+        return RT_FALSE;
+    }
+
+    ok = (check.errors == 0 && check.events > 0);
+    rt_kprintf("stress     %d threads x %d rounds, %d checked dumps while recording, %d events in last, errors %d, %s\n",
+               TRACE_BENCH_THREADS, TRACE_BENCH_STRESS, dumps, check.events, check.errors, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+static rt_bool_t trace_bench_overwrite(const char *path)
+{
+    ai_trace_stats_t stats;
+    uint32_t i;
+    int count;
+    rt_bool_t ok;
+
+    ai_trace_clear();
+    ai_trace_get_stats(&stats);
+    for (i = 0; i < stats.size * 3; i++)
+    {
+        AI_TRACE_INSTANT("fill", i);
+    }
+    ai_trace_get_stats(&stats);
+    count = ai_trace_dump(path);
+
+    ok = (stats.recorded == stats.size * 3 && stats.overwritten == stats.size * 2 && count == (int)stats.size);
+    rt_kprintf("overwrite  %d recorded, %d overwritten, %d exported, %s\n",
+               stats.recorded, stats.overwritten, count, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+static rt_bool_t trace_bench_wrap(const char *path)
+{
+    trace_bench_check_t check;
+    ai_trace_stats_t stats;
+    uint32_t period_ms, sleep_ms;
+    rt_tick_t start;
+    rt_bool_t ok;
+
+    ai_trace_get_stats(&stats);
+    period_ms = (uint32_t)(0x100000000ULL * 1000 / stats.clock_hz);
+
+    ai_trace_clear();
+    start = rt_tick_get();
+    AI_TRACE_BEGIN("wrap");
+    rt_thread_mdelay(period_ms + 1000);
+    AI_TRACE_END("wrap", 0);
+    sleep_ms = TRACE_BENCH_TICK_TO_MS(rt_tick_get() - start);
+
+    rt_memset(&check, 0, sizeof(check));
+    if (trace_bench_check(path, &check) < 0)
+    {
+        rt_kprintf("wrap       failed to run\n");
+        return RT_FALSE;
+    }
+
+    /* 节拍和计数器的读取相差不到1ms */
+    ok = (check.wrap_ms > sleep_ms - 2 && check.wrap_ms < sleep_ms + 2);
+    rt_kprintf("wrap       counter period %d ms, span %d.%03d ms for %d ms measured by tick, %s\n",
+               period_ms, (int)check.wrap_ms, (int)(check.wrap_ms * 1000) % 1000, sleep_ms, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+static void trace_bench_cost(void)
+{
+    rt_tick_t start;
+    uint32_t single_ms, multi_ms;
+    uint32_t i;
+
+    ai_trace_clear();
+    start = rt_tick_get();
+    for (i = 0; i < TRACE_BENCH_COST; i++)
+    {
+        AI_TRACE_INSTANT("cost", i);
+    }
+    single_ms = TRACE_BENCH_TICK_TO_MS(rt_tick_get() - start);
+
+    trace_bench.events = TRACE_BENCH_COST;
+    start = rt_tick_get();
+    trace_bench_run(TRACE_BENCH_COST / TRACE_BENCH_THREADS, RT_NULL, RT_NULL, RT_NULL);
+    multi_ms = TRACE_BENCH_TICK_TO_MS(rt_tick_get() - start);
+    trace_bench.events = 0;
+
+    rt_kprintf("cost       %d events: 1 thread %d ns per event, %d threads %d ns per event\n",
+               TRACE_BENCH_COST, (int)((uint64_t)single_ms * 1000000 / TRACE_BENCH_COST),
+               TRACE_BENCH_THREADS, (int)((uint64_t)multi_ms * 1000000 / TRACE_BENCH_COST));
+}
+
+static int trace_bench_main(const char *path)
+{
+    ai_trace_stats_t stats;
+    rt_bool_t ok = RT_TRUE;
+
+    if (ai_trace_init() != RT_EOK)
+    {
+        return -1;
+    }
+    if (trace_bench.done == RT_NULL)
+    {
+        trace_bench.done = rt_sem_create("tbench", 0, RT_IPC_FLAG_FIFO);
+        if (trace_bench.done == RT_NULL)
+        {
+            return -1;
+        }
+    }
+
+    ai_trace_get_stats(&stats);
+    ai_trace_set_enabled(RT_TRUE);
+    rt_kprintf("Trace ring: %d events, clock %d Hz, export to %s\n", stats.size, stats.clock_hz, path);
+
+    ok = trace_bench_nested(path) && ok;
+    ok = trace_bench_stress(path) && ok;
+    ok = trace_bench_overwrite(path) && ok;
+    ok = trace_bench_wrap(path) && ok;
+    trace_bench_cost();
+
+    ai_trace_clear();
+    ai_trace_set_enabled(stats.enabled);
+
+    rt_kprintf("Result: %s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : -1;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+#include <finsh.h>
+
+static int cmd_trace_bench(int argc, char **argv)
+{
+    return trace_bench_main(argc > 1 ? argv[1] : TRACE_BENCH_PATH);
+}
+MSH_CMD_EXPORT_ALIAS(cmd_trace_bench, trace_bench, Trace ring test: trace_bench [export_file]);
+#endif
+
+#ifdef AI_TRACE_BENCH_MAIN
+HOST_CRITICAL_LOCK_DEFINE;
+
+int main(int argc, char **argv)
+{
+    return trace_bench_main(argc > 1 ? argv[1] : TRACE_BENCH_PATH) == 0 ? 0 : 1;
+}
+#endif
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-19     AI Assistant first version - Capture ring split out of the MAX4466 driver
+ */
+
+#ifndef __AUDIO_CAPTURE_RING_H__
+#define __AUDIO_CAPTURE_RING_H__
+
+/*
+ * 麦克风采集环形缓冲区：ADC DMA回调（中断）单生产者，audio_capture_read单消费者。
+ *   - 以DMA半缓冲区为单位写入，空间不足时丢弃整块并计入overruns，消费者读到的样本始终连续
+ *   - 读取无数据时在信号量上等待，按截止时间计算剩余等待，信号量计数多于数据时也不会提前返回
+ * 不依赖HAL，PC上可以编译（见 audio_ring_bench.c）。
+ */
+
+#include <rtthread.h>
+#include <rtdevice.h>
+#include "drv_audio_max4466.h"
+
+#define AUDIO_CAPTURE_BLOCK_SAMPLES 1024    /* 一个DMA半缓冲区的样本数（64ms @16kHz）*/
+#define AUDIO_CAPTURE_RING_BLOCKS   4       /* 可缓存的半缓冲区数量 */
+#define AUDIO_CAPTURE_RING_SIZE     (AUDIO_CAPTURE_BLOCK_SAMPLES * sizeof(int16_t) * AUDIO_CAPTURE_RING_BLOCKS)
+
+typedef struct {
+    struct rt_ringbuffer rb;
+    rt_sem_t data_sem;
+    volatile rt_bool_t running;     /* 停止后读取立即返回 */
+    audio_capture_stats_t stats;
+} audio_capture_ring_t;
+
+/* 初始化（pool为 AUDIO_CAPTURE_RING_SIZE 字节），创建数据信号量 */
+rt_err_t audio_capture_ring_init(audio_capture_ring_t *ring, rt_uint8_t *pool, rt_uint32_t size);
+
+/* 开始采集前清空数据和统计 */
+void audio_capture_ring_start(audio_capture_ring_t *ring);
+
+/* 停止采集，唤醒阻塞在读取中的线程 */
+void audio_capture_ring_stop(audio_capture_ring_t *ring);
+
+/* 写入一块PCM（在DMA中断上下文中调用），空间不足时整块丢弃 */
+void audio_capture_ring_put(audio_capture_ring_t *ring, const int16_t *pcm, uint32_t count);
+
+/* 读取PCM：无数据时最多阻塞timeout毫秒，超时返回0，已停止返回-RT_ERROR */
+int audio_capture_ring_read(audio_capture_ring_t *ring, uint8_t *buffer, uint32_t size, uint32_t timeout);
+
+#endif /* __AUDIO_CAPTURE_RING_H__ */
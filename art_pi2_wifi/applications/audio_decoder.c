@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Streaming decoder for compressed TTS audio
+ * 2024-10-27     AI Assistant Remove the untested helix MP3 path
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "audio_decoder.h"
+
+/* IMA ADPCM 量化步长表和步长索引调整表 */
+static const int16_t audio_dec_ima_step[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+    157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+    3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t audio_dec_ima_index[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+const char *audio_codec_name(audio_codec_t codec)
+{
+    switch (codec)
+    {
+    case AUDIO_CODEC_IMA_ADPCM:
+        return "adpcm";
+    case AUDIO_CODEC_MP3:
+        return "mp3";
+    default:
+        return "pcm";
+    }
+}
+
+/* 输出out中的样本 */
+static int audio_dec_output(audio_dec_t *dec, uint32_t samples, audio_dec_output_t output, void *user_data)
+{
+    if (samples == 0)
+    {
+        return 0;
+    }
+    dec->samples += samples;
+    return output(dec->out, samples, user_data);
+}
+
+/* 解码一个ADPCM块：4字节块头（第一个样本、步长索引），之后每字节两个样本，低4位在前；
+ * 最后一块可以不完整 */
+static int audio_dec_adpcm_block(audio_dec_t *dec, const uint8_t *block, uint32_t len,
+                                 audio_dec_output_t output, void *user_data)
+{
+    int32_t pred, index;
+    uint32_t n = 0;
+    int ret;
+
+    if (len < 4)
+    {
+        return 0;
+    }
+
+    pred = (int16_t)(block[0] | (block[1] << 8));
+    index = block[2];
+    if (index > 88)
+    {
+        dec->errors++;
+        index = 88;
+    }
+    dec->out[n++] = (int16_t)pred;
+
+    for (uint32_t i = 4; i < len; i++)
+    {
+        for (uint32_t shift = 0; shift <= 4; shift += 4)
+        {
+            uint32_t code = (block[i] >> shift) & 0x0F;
+            int32_t step = audio_dec_ima_step[index];
+            int32_t diff = step >> 3;
+
+            if (code & 4)
+            {
+                diff += step;
+            }
+            if (code & 2)
+            {
+                diff += step >> 1;
+            }
+            if (code & 1)
+            {
+                diff += step >> 2;
+            }
+            pred += (code & 8) ? -diff : diff;
+            pred = pred > 32767 ? 32767 : (pred < -32768 ? -32768 : pred);
+
+            index += audio_dec_ima_index[code];
+            index = index < 0 ? 0 : (index > 88 ? 88 : index);
+
+            dec->out[n++] = (int16_t)pred;
+        }
+
+        if (n + 2 > AUDIO_DEC_OUT_SAMPLES)
+        {
+            ret = audio_dec_output(dec, n, output, user_data);
+            if (ret != 0)
+            {
+                return ret;
+            }
+            n = 0;
+        }
+    }
+
+    dec->frames++;
+    return audio_dec_output(dec, n, output, user_data);
+}
+
+static int audio_dec_adpcm_feed(audio_dec_t *dec, const uint8_t *data, uint32_t len,
+                                audio_dec_output_t output, void *user_data)
+{
+    int ret;
+
+    while (len > 0)
+    {
+        uint32_t n;
+
+        /* 完整的块直接从输入解码，不经过缓冲区 */
+        if (dec->have == 0 && len >= dec->block_align)
+        {
+            ret = audio_dec_adpcm_block(dec, data, dec->block_align, output, user_data);
+            if (ret != 0)
+            {
+                return ret;
+            }
+            data += dec->block_align;
+            len -= dec->block_align;
+            continue;
+        }
+
+        n = dec->block_align - dec->have;
+        if (n > len)
+        {
+            n = len;
+        }
+        memcpy(dec->buf + dec->have, data, n);
+        dec->have += n;
+        data += n;
+        len -= n;
+
+        if (dec->have == dec->block_align)
+        {
+            dec->have = 0;
+            ret = audio_dec_adpcm_block(dec, dec->buf, dec->block_align, output, user_data);
+            if (ret != 0)
+            {
+                return ret;
+            }
+        }
+    }
+
+    return 0;
+}
+
+int audio_dec_init(audio_dec_t *dec, audio_codec_t codec, uint32_t sample_rate,
+                   uint32_t channels, uint32_t block_align)
+{
+    memset(dec, 0, offsetof(audio_dec_t, buf));
+    dec->codec = codec;
+    dec->sample_rate = sample_rate;
+
+    switch (codec)
+    {
+    case AUDIO_CODEC_IMA_ADPCM:
+        /* TTS为单声道；块长度至少包含块头和一个字节 */
+        if (channels != 1 || block_align < 5 || block_align > AUDIO_DEC_BUF_SIZE)
+        {
+            return -1;
+        }
+        dec->block_align = block_align;
+        return 0;
+
+    default:
+        return -1;
+    }
+}
+
+int audio_dec_feed(audio_dec_t *dec, const uint8_t *data, uint32_t len,
+                   audio_dec_output_t output, void *user_data)
+{
+    switch (dec->codec)
+    {
+    case AUDIO_CODEC_IMA_ADPCM:
+        return audio_dec_adpcm_feed(dec, data, len, output, user_data);
+
+    default:
+        return -1;
+    }
+}
+
+int audio_dec_finish(audio_dec_t *dec, audio_dec_output_t output, void *user_data)
+{
+    uint32_t have = dec->have;
+
+    switch (dec->codec)
+    {
+    case AUDIO_CODEC_IMA_ADPCM:
+        dec->have = 0;
+        return audio_dec_adpcm_block(dec, dec->buf, have, output, user_data);
+
+    default:
+        return -1;
+    }
+}
+
+void audio_dec_deinit(audio_dec_t *dec)
+{
+    dec->have = 0;
+}
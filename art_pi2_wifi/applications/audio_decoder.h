@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Streaming decoder for compressed TTS audio
+ * 2024-10-27     AI Assistant Remove the untested helix MP3 path
+ */
+
+#ifndef __AUDIO_DECODER_H__
+#define __AUDIO_DECODER_H__
+
+/*
+ * 压缩TTS音频的流式解码：数据按任意长度分段送入，够一帧（块）就解码输出16bit单声道PCM
+ *   - IMA ADPCM：WAV格式（fmt 0x0011），4bit/样本，16kHz约8KB/s，是PCM的1/4；定点实现，
+ *     状态只有一个块的缓冲区，PC上可以编译（见 audio_decoder_bench.c）
+ *   - PCM：不经过解码器，调用者直接输出
+ * 不解码MP3：需要的helix软件包不在本仓库中，也没有与参考解码器比对过；声明为MP3的响应按不支持的格式处理。
+ *
+ * 本模块不依赖RT-Thread内核接口，状态由调用者分配（约6KB）。
+ */
+
+#include <stdint.h>
+
+#define AUDIO_DEC_BUF_SIZE      4096    /* 输入缓冲区：一个ADPCM块，块长度不能超过它 */
+#define AUDIO_DEC_OUT_SAMPLES   1024    /* 输出缓冲区：每次交给回调的最大样本数 */
+
+/* 音频编码格式 */
+typedef enum {
+    AUDIO_CODEC_PCM = 0,        /* 16bit小端PCM */
+    AUDIO_CODEC_IMA_ADPCM,      /* WAV IMA ADPCM */
+    AUDIO_CODEC_MP3             /* 只用于识别响应格式，audio_dec_init 不支持 */
+} audio_codec_t;
+
+/* 解码输出回调，返回非0时停止解码并把该值返回给调用者 */
+typedef int (*audio_dec_output_t)(const int16_t *pcm, uint32_t samples, void *user_data);
+
+typedef struct {
+    audio_codec_t codec;
+    uint32_t sample_rate;
+    uint32_t block_align;       /* ADPCM块长度 */
+    uint32_t have;              /* buf中的字节数 */
+    uint32_t frames;            /* 已解码的块数 */
+    uint32_t samples;           /* 已输出的样本数 */
+    uint32_t errors;            /* 块头损坏的块数 */
+    uint8_t buf[AUDIO_DEC_BUF_SIZE];
+    int16_t out[AUDIO_DEC_OUT_SAMPLES];
+} audio_dec_t;
+
+/* 初始化：ADPCM需要WAV头中的声道数（只支持单声道）和块长度；不支持的格式返回-1 */
+int audio_dec_init(audio_dec_t *dec, audio_codec_t codec, uint32_t sample_rate,
+                   uint32_t channels, uint32_t block_align);
+
+/* 送入一段数据，解码出的PCM交给output；返回0或output的返回值，内存不足等错误返回-1 */
+int audio_dec_feed(audio_dec_t *dec, const uint8_t *data, uint32_t len,
+                   audio_dec_output_t output, void *user_data);
+
+/* 数据结束：解码缓冲区中剩余的不完整块 */
+int audio_dec_finish(audio_dec_t *dec, audio_dec_output_t output, void *user_data);
+
+/* 结束解码，丢弃缓冲区中的数据 */
+void audio_dec_deinit(audio_dec_t *dec);
+
+/* 格式名称，用于日志和请求参数 */
+const char *audio_codec_name(audio_codec_t codec);
+
+#endif /* __AUDIO_DECODER_H__ */
@@ -0,0 +1,422 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Compressed TTS decoder check and speed benchmark
+ * 2024-10-27     AI Assistant Check IMA ADPCM files only, MP3 is not decoded
+ */
+
+/*
+ * 压缩TTS音频解码评估
+ *   reference  IMA ADPCM参考数据逐样本比较：按1/7/64字节和整段送入，最后一块不完整；
+ *              参考输出由CPython的 audioop.adpcm2lin 生成（与 mock_ai_server.py 的 ima_adpcm_wav 相同的编码）
+ *   speed      256字节块的ADPCM，每个输出样本的CPU周期（设备端DWT，x86 PC上为TSC）和下载字节数
+ *   file       指定文件时解码IMA ADPCM的WAV，报告块数、采样率和速度；
+ *              再指定参考PCM（16bit单声道，如 ffmpeg -i x.wav -f s16le -ac 1 ref.pcm）时逐样本比较
+ *
+ * 设备端：dec_bench [/sdcard/tts.wav [/sdcard/tts.pcm]]
+ * PC端：
+ *   gcc -O2 -DAUDIO_DEC_BENCH_MAIN audio_decoder.c audio_decoder_bench.c -lm -o dec_bench
+ *   ./dec_bench [tts.wav [tts.pcm]]
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "audio_decoder.h"
+
+#ifdef __RTTHREAD__
+#include <rtthread.h>
+#include <board.h>
+#define DEC_PRINTF      rt_kprintf
+#define DEC_MALLOC      rt_malloc
+#define DEC_FREE        rt_free
+#else
+#include <stdio.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#define DEC_PRINTF      printf
+#define DEC_MALLOC      malloc
+#define DEC_FREE        free
+#endif
+
+#define DEC_BENCH_RATE          16000
+#define DEC_BENCH_BLOCK         256     /* 速度测试的ADPCM块长度，505样本 */
+#define DEC_BENCH_SECONDS       4
+#define DEC_BENCH_FILE_CHUNK    512     /* 文件按此长度分段送入，模拟网络分段 */
+
+/* 参考数据：64字节块，两个完整块和一个41字节的不完整块 */
+#define DEC_REF_BLOCK_ALIGN     64
+
+static const uint8_t dec_ref_adpcm[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xAF, 0x57, 0x22, 0x80, 0xB9,
+    0xBD, 0xAC, 0x89, 0x31, 0x44, 0x33, 0x12, 0xA8, 0xDC, 0xCB, 0x9A, 0x18, 0x43, 0x34, 0x23, 0x81,
+    0xDA, 0xDB, 0xAB, 0x89, 0x21, 0x45, 0x23, 0x12, 0xA8, 0xCC, 0xAC, 0x9B, 0x18, 0x43, 0x35, 0x22,
+    0x81, 0xCA, 0xCC, 0xBA, 0x89, 0xF1, 0x79, 0x07, 0x00, 0xF0, 0x8A, 0x80, 0x78, 0x03, 0x00, 0xF0,
+    0x00, 0x80, 0x58, 0x00, 0x80, 0x08, 0x27, 0x00, 0x00, 0xBF, 0x80, 0x08, 0x37, 0x0C, 0x88, 0x80,
+    0x80, 0x80, 0x80, 0x08, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x88, 0x88, 0x99,
+    0xA9, 0xAA, 0xAA, 0x9C, 0x9A, 0x88, 0x0A, 0x22, 0x14, 0x35, 0x44, 0x41, 0x32, 0x23, 0x21, 0x12,
+    0xA1, 0xA9, 0xCC, 0xFB, 0xAB, 0xCB, 0xAC, 0x9A, 0xAA, 0x9A, 0x00, 0x02, 0x54, 0x43, 0x52, 0x33,
+    0xD5, 0x03, 0x2C, 0x00, 0x23, 0x43, 0x12, 0x18, 0x88, 0xBA, 0xBF, 0xCB, 0xEB, 0xAA, 0xAA, 0x9C,
+    0x8A, 0x88, 0x29, 0x32, 0x25, 0x35, 0x34, 0x14, 0x33, 0x33, 0x21, 0x11, 0xC8, 0xB9, 0xDC, 0xEB,
+    0xAA, 0xBB, 0xAD, 0xA9, 0x99, 0x0A, 0x20, 0x12, 0x36
+};
+
+static const int16_t dec_ref_pcm[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 11, -19, -82, -218,
+    -511, -1142, -2499, -5409, -7487, -1817, 7098, 13030, 18423, 19403, 18512, 16081,
+    10925, 3559, -3304, -11327, -16720, -19661, -20552, -18121, -12965, -6938, 356, 7219,
+    13459, 17511, 19720, 19051, 16008, 11027, 3661, -3202, -11225, -16618, -19559, -20450,
+    -18019, -12863, -6836, 458, 7321, 13561, 17613, 19822, 19153, 16110, 10022, 4349,
+    -3754, -11304, -16206, -18880, -19690, -17481, -14133, -7437, 586, 8136, 13038, 17495,
+    19926, 19190, 15842, 10363, 3733, -4290, -9683, -16546, -19220, -20030, -17821, -13134,
+    -7655, 448, 7998, 12900, 17357, 19788, 19052, 15704, 10225, 3595, -4428, -9821,
+    -16684, -19358, -20168, -17959, -28004, -32310, -12732, 29239, 32767, 32767, 32767, 32767,
+    -9204, -29682, -32768, -29383, -32460, -32768, 5387, 32767, 32767, 32767, 32767, 32767,
+    -5388, -32768, -28673, -32397, -32768, -29691, 12280, 32758, 32767, 32767, 32767, 32767,
+    -5388, -32768, -29044, -32429, -32768, -29970, 8185, 32767, -751, 3344, -380, -3765,
+    -688, -3486, -943, -3255, -1153, -3064, -1327, -2906, -4341, -3036, -1850, -2928,
+    -1948, -1057, -247, -983, -314, 294, 847, 1350, 1807, 2222, 2600, 2943,
+    2631, 2915, 3173, 2939, 2726, 2532, 2356, 2196, 1760, 1363, 1003, 456,
+    -41, -493, -904, -1277, -1889, -2135, -2508, -2712, -2773, -2829, -3084, -3038,
+    -2828, -2637, -2324, -2198, -1777, -1385, -926, -371, -148, 464, 875, 1397,
+    1873, 2181, 2349, 2604, 2835, 2961, 3075, 2902, 2808, 2665, 2430, 2146,
+    1879, 1358, 836, 496, 65, -440, -1052, -1463, -1836, -2040, -2348, -2628,
+    -2883, -3021, -2979, -2941, -2768, -2737, -2479, -2097, -1740, -1323, -1043, -482,
+    40, 516, 981, 1412, 1692, 2049, 2466, 2746, 2899, 2853, 2979, 2941,
+    2907, 2750, 2550, 2159, 1767, 1410, 993, 601, -62, -514, -925, -1298,
+    -1638, -2193, -2416, -2756, -2817, -2873, -2924, -3062, -2852, -2661, -2419, -2072,
+    -1841, -1378, -947, -442, 34, 589, 812, 1288, 1719, 2111, 2468, 2606,
+    2816, 2930, 3033, 3002, 2744, 2641, 2421, 2163, 1781, 1424, 822, 411,
+    38, -438, -869, -1486, -1897, -2120, -2460, -2644, -2812, -3067, -3021, -2979,
+    -2788, -2615, -2521, -2148, -1791
+};
+
+/* 比较解码输出与参考PCM */
+typedef struct {
+    const int16_t *ref;
+    uint32_t ref_count;
+    uint32_t count;
+    uint32_t mismatches;
+    double signal;
+    double error;
+} dec_bench_check_t;
+
+static int dec_bench_check(const int16_t *pcm, uint32_t samples, void *user_data)
+{
+    dec_bench_check_t *check = (dec_bench_check_t *)user_data;
+
+    for (uint32_t i = 0; i < samples; i++, check->count++)
+    {
+        int32_t ref;
+
+        if (check->ref == NULL || check->count >= check->ref_count)
+        {
+            continue;
+        }
+        ref = check->ref[check->count];
+        if (pcm[i] != ref)
+        {
+            check->mismatches++;
+        }
+        check->signal += (double)ref * ref;
+        check->error += (double)(pcm[i] - ref) * (pcm[i] - ref);
+    }
+
+    return 0;
+}
+
+/* 周期计数：设备端为DWT，x86为TSC，其他平台以纳秒代替 */
+static uint64_t dec_bench_cycles(void)
+{
+#ifdef __RTTHREAD__
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    return DWT->CYCCNT;
+#elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+/* 参考数据按不同分段送入，输出须与参考逐样本一致 */
+static int dec_bench_reference(audio_dec_t *dec)
+{
+    static const uint32_t chunks[] = {1, 7, DEC_REF_BLOCK_ALIGN, sizeof(dec_ref_adpcm)};
+    uint32_t ref_count = sizeof(dec_ref_pcm) / sizeof(dec_ref_pcm[0]);
+    int failed = 0;
+
+    for (uint32_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++)
+    {
+        dec_bench_check_t check;
+
+        memset(&check, 0, sizeof(check));
+        check.ref = dec_ref_pcm;
+        check.ref_count = ref_count;
+
+        audio_dec_init(dec, AUDIO_CODEC_IMA_ADPCM, DEC_BENCH_RATE, 1, DEC_REF_BLOCK_ALIGN);
+        for (uint32_t pos = 0; pos < sizeof(dec_ref_adpcm); pos += chunks[c])
+        {
+            uint32_t n = sizeof(dec_ref_adpcm) - pos;
+
+            audio_dec_feed(dec, &dec_ref_adpcm[pos], n < chunks[c] ? n : chunks[c], dec_bench_check, &check);
+        }
+        audio_dec_finish(dec, dec_bench_check, &check);
+        audio_dec_deinit(dec);
+
+        DEC_PRINTF("reference  chunk %3d bytes: %d/%d samples, mismatches %d\n",
+                   chunks[c], check.count, ref_count, check.mismatches);
+        failed += (check.count != ref_count || check.mismatches != 0);
+    }
+
+    return failed ? -1 : 0;
+}
+
+static int dec_bench_discard(const int16_t *pcm, uint32_t samples, void *user_data)
+{
+    (void)pcm;
+    (void)samples;
+    (void)user_data;
+    return 0;
+}
+
+/* 解码速度：伪随机码流（任意4bit码都合法），块头取真实的样本和步长索引范围 */
+static int dec_bench_speed(audio_dec_t *dec)
+{
+    uint32_t blocks = DEC_BENCH_SECONDS * DEC_BENCH_RATE / ((DEC_BENCH_BLOCK - 4) * 2 + 1);
+    uint32_t bytes = blocks * DEC_BENCH_BLOCK;
+    uint32_t seed = 12345;
+    uint8_t *stream;
+    uint64_t start, cycles;
+    uint32_t x10;
+
+    stream = (uint8_t *)DEC_MALLOC(bytes);
+    if (stream == NULL)
+    {
+        DEC_PRINTF("No memory for %d bytes\n", bytes);
+        return -1;
+    }
+    for (uint32_t i = 0; i < bytes; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        stream[i] = (uint8_t)(seed >> 16);
+        if (i % DEC_BENCH_BLOCK == 2)
+        {
+            stream[i] %= 89;
+        }
+    }
+
+    audio_dec_init(dec, AUDIO_CODEC_IMA_ADPCM, DEC_BENCH_RATE, 1, DEC_BENCH_BLOCK);
+    start = dec_bench_cycles();
+    for (uint32_t pos = 0; pos < bytes; pos += DEC_BENCH_FILE_CHUNK)
+    {
+        uint32_t n = bytes - pos;
+
+        audio_dec_feed(dec, &stream[pos], n < DEC_BENCH_FILE_CHUNK ? n : DEC_BENCH_FILE_CHUNK,
+                       dec_bench_discard, NULL);
+    }
+    audio_dec_finish(dec, dec_bench_discard, NULL);
+    cycles = dec_bench_cycles() - start;
+    audio_dec_deinit(dec);
+    DEC_FREE(stream);
+
+    x10 = (uint32_t)(cycles * 10 / dec->samples);
+    DEC_PRINTF("speed      adpcm %d samples, %d.%d cycles/sample, %d bytes/s (pcm %d bytes/s)\n",
+               dec->samples, x10 / 10, x10 % 10,
+               (int)((uint64_t)bytes * DEC_BENCH_RATE / dec->samples), DEC_BENCH_RATE * 2);
+#if !defined(__RTTHREAD__) && !defined(__x86_64__) && !defined(__i386__)
+    DEC_PRINTF("(cycles are ns on this host)\n");
+#endif
+
+    return 0;
+}
+
+/* 读取整个文件 */
+static uint8_t *dec_bench_load_file(const char *path, uint32_t *size)
+{
+    struct stat st;
+    uint8_t *data;
+    int fd;
+
+    if (stat(path, &st) != 0 || st.st_size <= 0)
+    {
+        return NULL;
+    }
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+    data = (uint8_t *)DEC_MALLOC(st.st_size);
+    if (data != NULL && read(fd, data, st.st_size) != st.st_size)
+    {
+        DEC_FREE(data);
+        data = NULL;
+    }
+    close(fd);
+
+    *size = st.st_size;
+    return data;
+}
+
+/* 解码WAV文件：格式取自fmt块，只支持IMA ADPCM */
+static int dec_bench_file(audio_dec_t *dec, const char *path, const char *ref_path)
+{
+    dec_bench_check_t check;
+    uint8_t *file, *ref = NULL;
+    uint32_t size, ref_size = 0;
+    uint32_t offset = 0, end;
+    uint32_t channels = 1, block_align = 0, rate = DEC_BENCH_RATE;
+    audio_codec_t codec = AUDIO_CODEC_PCM;
+    uint64_t start, cycles;
+    int ret = -1;
+
+    file = dec_bench_load_file(path, &size);
+    if (file == NULL)
+    {
+        DEC_PRINTF("Cannot read %s\n", path);
+        return -1;
+    }
+    end = size;
+
+    if (size >= 12 && memcmp(file, "RIFF", 4) == 0 && memcmp(file + 8, "WAVE", 4) == 0)
+    {
+        for (offset = 12; offset + 8 <= size; )
+        {
+            uint8_t *chunk = file + offset;
+            uint32_t len = chunk[4] | (chunk[5] << 8) | (chunk[6] << 16) | ((uint32_t)chunk[7] << 24);
+
+            offset += 8;
+            if (memcmp(chunk, "fmt ", 4) == 0 && len >= 16 && offset + 16 <= size)
+            {
+                codec = (chunk[8] | (chunk[9] << 8)) == 0x0011 ? AUDIO_CODEC_IMA_ADPCM : AUDIO_CODEC_PCM;
+                channels = chunk[10] | (chunk[11] << 8);
+                rate = chunk[12] | (chunk[13] << 8) | (chunk[14] << 16) | ((uint32_t)chunk[15] << 24);
+                block_align = chunk[20] | (chunk[21] << 8);
+            }
+            if (memcmp(chunk, "data", 4) == 0)
+            {
+                end = (len < size - offset) ? offset + len : size;
+                break;
+            }
+            offset += len + (len & 1);
+        }
+    }
+
+    if (audio_dec_init(dec, codec, rate, channels, block_align) != 0)
+    {
+        DEC_PRINTF("file       %s: unsupported format (%s, %d channels, block %d)\n",
+                   path, audio_codec_name(codec), channels, block_align);
+        DEC_FREE(file);
+        return -1;
+    }
+
+    memset(&check, 0, sizeof(check));
+    if (ref_path)
+    {
+        ref = dec_bench_load_file(ref_path, &ref_size);
+        check.ref = (const int16_t *)ref;
+        check.ref_count = ref_size / 2;
+    }
+
+    start = dec_bench_cycles();
+    for (uint32_t pos = offset; pos < end; pos += DEC_BENCH_FILE_CHUNK)
+    {
+        uint32_t n = end - pos;
+
+        audio_dec_feed(dec, &file[pos], n < DEC_BENCH_FILE_CHUNK ? n : DEC_BENCH_FILE_CHUNK,
+                       dec_bench_check, &check);
+    }
+    audio_dec_finish(dec, dec_bench_check, &check);
+    cycles = dec_bench_cycles() - start;
+
+    if (dec->samples > 0)
+    {
+        uint32_t x10 = (uint32_t)(cycles * 10 / dec->samples);
+
+        DEC_PRINTF("file       %s: %s, %d bytes -> %d samples at %d Hz, %d frames, %d errors, %d.%d cycles/sample\n",
+                   path, audio_codec_name(codec), end - offset, dec->samples, dec->sample_rate,
+                   dec->frames, dec->errors, x10 / 10, x10 % 10);
+        ret = 0;
+    }
+    else
+    {
+        DEC_PRINTF("file       %s: no audio decoded\n", path);
+    }
+
+    if (ref)
+    {
+        int snr_x10 = check.error > 0 ? (int)(100.0 * log10(check.signal / check.error)) : 999;
+
+        DEC_PRINTF("reference  %s: %d/%d samples, mismatches %d, snr %d.%d dB\n",
+                   ref_path, dec->samples, check.ref_count, check.mismatches,
+                   snr_x10 / 10, (snr_x10 < 0 ? -snr_x10 : snr_x10) % 10);
+        if (check.mismatches != 0 || dec->samples != check.ref_count)
+        {
+            ret = -1;
+        }
+        DEC_FREE(ref);
+    }
+
+    audio_dec_deinit(dec);
+    DEC_FREE(file);
+    return ret;
+}
+
+int audio_dec_bench(const char *path, const char *ref_path)
+{
+    audio_dec_t *dec;
+    int failed = 0;
+
+    dec = (audio_dec_t *)DEC_MALLOC(sizeof(audio_dec_t));
+    if (dec == NULL)
+    {
+        DEC_PRINTF("No memory for decoder (%d bytes)\n", (int)sizeof(audio_dec_t));
+        return -1;
+    }
+
+    failed += dec_bench_reference(dec) != 0;
+    failed += dec_bench_speed(dec) != 0;
+    if (path)
+    {
+        failed += dec_bench_file(dec, path, ref_path) != 0;
+    }
+    DEC_PRINTF("Decoder: %d bytes of state\n", (int)sizeof(audio_dec_t));
+    DEC_PRINTF("Result: %s\n", failed ? "FAIL" : "PASS");
+
+    DEC_FREE(dec);
+    return failed ? -1 : 0;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+static int cmd_dec_bench(int argc, char **argv)
+{
+    return audio_dec_bench(argc > 1 ? argv[1] : NULL, argc > 2 ? argv[2] : NULL);
+}
+MSH_CMD_EXPORT_ALIAS(cmd_dec_bench, dec_bench, Check compressed TTS decoder against reference and measure speed);
+#endif
+
+#ifdef AUDIO_DEC_BENCH_MAIN
+int main(int argc, char **argv)
+{
+    return audio_dec_bench(argc > 1 ? argv[1] : NULL, argc > 2 ? argv[2] : NULL) == 0 ? 0 : 1;
+}
+#endif
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Fixed-point microphone front end
+ */
+
+#include <string.h>
+#include <math.h>
+#include "audio_frontend.h"
+
+#if AUDIO_FE_ENABLE
+
+static q15_t audio_fe_q15(float value)
+{
+    int32_t q = (int32_t)lrintf(value * 32768.0f);
+
+    return (q15_t)(q > 32767 ? 32767 : (q < -32768 ? -32768 : q));
+}
+
+void audio_fe_init(audio_fe_t *fe, uint32_t sample_rate, uint32_t flags)
+{
+    /* 二阶巴特沃斯高通（RBJ），Q = 1/sqrt(2) */
+    float w0 = 2.0f * PI * AUDIO_FE_HPF_HZ / sample_rate;
+    float cosw = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * 0.70710678f);
+    float a0 = 1.0f + alpha;
+    float b0 = (1.0f + cosw) / 2.0f / a0;
+
+    memset(fe, 0, sizeof(*fe));
+    fe->flags = flags;
+    fe->dc = AUDIO_FE_ADC_CENTER << 8;
+
+    /* CMSIS系数格式 {b0, 0, b1, b2, -a1, -a2}，b1和a1接近2，按postShift=1存为一半 */
+    fe->hpf_coeffs[0] = audio_fe_q15(b0 / 2);
+    fe->hpf_coeffs[1] = 0;
+    fe->hpf_coeffs[2] = audio_fe_q15(-b0);
+    fe->hpf_coeffs[3] = audio_fe_q15(b0 / 2);
+    fe->hpf_coeffs[4] = audio_fe_q15(cosw / a0);
+    fe->hpf_coeffs[5] = audio_fe_q15(-(1.0f - alpha) / a0 / 2);
+    arm_biquad_cascade_df1_init_q15(&fe->hpf, 1, fe->hpf_coeffs, fe->hpf_state, 1);
+
+    audio_fe_reset(fe);
+}
+
+void audio_fe_reset(audio_fe_t *fe)
+{
+    memset(fe->hpf_state, 0, sizeof(fe->hpf_state));
+    fe->gain = AUDIO_FE_GAIN_ONE;
+    fe->peak = 0;
+}
+
+/* 块内ADC值之和 */
+static uint32_t audio_fe_sum(const uint16_t *adc, uint32_t count)
+{
+    uint32_t sum = 0;
+    uint32_t i = 0;
+
+#if defined(ARM_MATH_DSP)
+    const q15_t *src = (const q15_t *)adc;
+
+    /* 12位ADC值按有符号16位处理不会溢出，两个一起累加 */
+    for (; i + 2 <= count; i += 2)
+    {
+        sum = __SMLAD(read_q15x2_ia(&src), 0x00010001, sum);
+    }
+#endif
+    for (; i < count; i++)
+    {
+        sum += adc[i];
+    }
+
+    return sum;
+}
+
+/* 减去偏置，饱和到12位有符号后放大16倍 */
+static void audio_fe_remove_dc(const uint16_t *adc, int16_t *pcm, uint32_t count, int32_t dc)
+{
+    uint32_t i = 0;
+
+#if defined(ARM_MATH_DSP)
+    const q15_t *src = (const q15_t *)adc;
+    q15_t *dst = pcm;
+    uint32_t dc2 = __PKHBT(dc, dc, 16);
+
+    for (; i + 2 <= count; i += 2)
+    {
+        uint32_t diff = __SSAT16(__SSUB16(read_q15x2_ia(&src), dc2), 12);
+
+        /* 整个字左移4位，低半字溢出到高半字的符号位用掩码清掉 */
+        write_q15x2_ia(&dst, (q31_t)((diff << 4) & 0xFFF0FFF0U));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        int32_t value = (int32_t)adc[i] - dc;
+
+        if (value > 2047)
+        {
+            value = 2047;
+        }
+        else if (value < -2048)
+        {
+            value = -2048;
+        }
+        pcm[i] = (int16_t)(value * 16);
+    }
+}
+
+/* 按本块峰值计算新增益，并在块内从旧增益线性过渡到新增益 */
+static void audio_fe_agc(audio_fe_t *fe, int16_t *pcm, uint32_t count)
+{
+    int32_t peak = 0;
+    int32_t target = fe->gain;
+    int32_t gain, step;
+    uint32_t i = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        int32_t value = pcm[i] < 0 ? -pcm[i] : pcm[i];
+
+        if (value > peak)
+        {
+            peak = value;
+        }
+    }
+    fe->peak = peak;
+
+    if (peak >= AUDIO_FE_AGC_GATE)
+    {
+        int32_t want = AUDIO_FE_AGC_TARGET * AUDIO_FE_GAIN_ONE / peak;
+
+        if (want > AUDIO_FE_AGC_MAX_GAIN * AUDIO_FE_GAIN_ONE)
+        {
+            want = AUDIO_FE_AGC_MAX_GAIN * AUDIO_FE_GAIN_ONE;
+        }
+        /* 变响时立即降到目标，变轻时每块靠近1/8（向上取整，保证最终到达）*/
+        target = want < target ? want : target + ((want - target + 7) >> 3);
+    }
+    else
+    {
+        /* 静音时回落到1倍，不放大底噪 */
+        target -= (target - AUDIO_FE_GAIN_ONE) >> 3;
+    }
+
+    /* 增益Q16，逐样本过渡，避免块边界上的幅度跳变 */
+    gain = fe->gain << 8;
+    step = ((target - fe->gain) << 8) / (int32_t)(count > 0 ? count : 1);
+    fe->gain = target;
+    if (step == 0 && target == AUDIO_FE_GAIN_ONE)
+    {
+        return;
+    }
+
+    i = 0;
+#if defined(ARM_MATH_DSP)
+    {
+        q15_t *p = pcm;
+
+        for (; i + 2 <= count; i += 2)
+        {
+            q31_t in = read_q15x2(p);
+            int32_t g = gain >> 8;
+            int32_t lo = __SSAT(__SMULBB(in, g) >> 8, 16);
+            int32_t hi = __SSAT(__SMULTB(in, g) >> 8, 16);
+
+            write_q15x2_ia(&p, (q31_t)__PKHBT(lo, hi, 16));
+            gain += step * 2;
+        }
+    }
+#endif
+    for (; i < count; i++)
+    {
+        int32_t value = (pcm[i] * (gain >> 8)) >> 8;
+
+        pcm[i] = (int16_t)(value > 32767 ? 32767 : (value < -32768 ? -32768 : value));
+        gain += step;
+    }
+}
+
+void audio_fe_process(audio_fe_t *fe, const uint16_t *adc, int16_t *pcm, uint32_t count)
+{
+    int32_t dc = AUDIO_FE_ADC_CENTER;
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    if (fe->flags & AUDIO_FE_DC)
+    {
+        int32_t mean = (int32_t)(audio_fe_sum(adc, count) / count);
+
+        fe->dc += ((mean << 8) - fe->dc) >> AUDIO_FE_DC_SHIFT;
+        dc = (fe->dc + 128) >> 8;
+    }
+    audio_fe_remove_dc(adc, pcm, count, dc);
+
+    if (fe->flags & AUDIO_FE_HIGHPASS)
+    {
+        arm_biquad_cascade_df1_q15(&fe->hpf, pcm, pcm, count);
+    }
+
+    if (fe->flags & AUDIO_FE_AGC)
+    {
+        audio_fe_agc(fe, pcm, count);
+    }
+
+    fe->blocks++;
+}
+
+#endif /* AUDIO_FE_ENABLE */
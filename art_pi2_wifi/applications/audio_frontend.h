@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Fixed-point microphone front end
+ */
+
+#ifndef __AUDIO_FRONTEND_H__
+#define __AUDIO_FRONTEND_H__
+
+/*
+ * MAX4466麦克风前端：在DMA中断中把一个半缓冲区的12位ADC原始值转换为16位PCM（可原地处理）
+ *   1. 自适应去直流：按块均值跟踪偏置（不再假定2048），减去后放大16倍并饱和
+ *   2. 高通：二阶巴特沃斯（CMSIS-DSP arm_biquad_cascade_df1_q15），去掉低频漂移和工频干扰
+ *   3. AGC：按块峰值调整增益，说话声小时最多放大 AUDIO_FE_AGC_MAX_GAIN 倍，静音时回落到1倍
+ * Cortex-M7上用DSP扩展的SIMD指令（__SSUB16/__SSAT16/__SMULBB），一次处理两个样本；
+ * PC上编译时使用同样结果的C实现（见 audio_frontend_bench.c）。
+ *
+ * 本模块不依赖RT-Thread内核接口，状态由调用者分配。
+ */
+
+#include <stdint.h>
+
+#ifdef __RTTHREAD__
+#include <rtconfig.h>
+#endif
+
+/* 设备端需要在menuconfig中开启 External Libraries -> CMSIS-DSP/NN */
+#if !defined(__RTTHREAD__) || defined(ART_PI_USING_CMSIS_DSP_NN)
+#define AUDIO_FE_ENABLE         1
+#else
+#define AUDIO_FE_ENABLE         0
+#endif
+
+/* 处理选项，0为原来的固定偏置2048、放大16倍 */
+#define AUDIO_FE_DC             (1 << 0)
+#define AUDIO_FE_HIGHPASS       (1 << 1)
+#define AUDIO_FE_AGC            (1 << 2)
+#define AUDIO_FE_DEFAULT        (AUDIO_FE_DC | AUDIO_FE_HIGHPASS | AUDIO_FE_AGC)
+
+#if AUDIO_FE_ENABLE
+
+#include "arm_math.h"
+
+#define AUDIO_FE_ADC_CENTER     2048
+#define AUDIO_FE_DC_SHIFT       3       /* 偏置跟踪：每块靠近块均值1/8，约0.5秒 */
+#define AUDIO_FE_HPF_HZ         100     /* 高通截止频率 */
+#define AUDIO_FE_AGC_TARGET     16384   /* 目标峰值（半满幅）*/
+#define AUDIO_FE_AGC_GATE       1024    /* 峰值低于此值视为静音，不再提高增益 */
+#define AUDIO_FE_AGC_MAX_GAIN   4       /* 最大增益（倍），过大会把底噪抬过VAD门限 */
+#define AUDIO_FE_GAIN_ONE       256     /* 增益Q8：256为1倍 */
+
+/* 每样本CPU周期预算（DMA中断中处理，1024样本一块）*/
+#define AUDIO_FE_CYCLES_PER_SAMPLE  32
+
+typedef struct {
+    uint32_t flags;
+    int32_t dc;                         /* 偏置估计，ADC单位Q8 */
+    int32_t gain;                       /* AGC增益Q8 */
+    int32_t peak;                       /* 最近一块高通后的峰值 */
+    arm_biquad_casd_df1_inst_q15 hpf;
+    q15_t hpf_coeffs[6];
+    q15_t hpf_state[4];
+    uint32_t blocks;
+} audio_fe_t;
+
+/* 初始化，flags为 AUDIO_FE_* 组合 */
+void audio_fe_init(audio_fe_t *fe, uint32_t sample_rate, uint32_t flags);
+
+/* 清除滤波器状态和AGC增益（开始新的录音），保留偏置估计 */
+void audio_fe_reset(audio_fe_t *fe);
+
+/* 处理一块：adc 与 pcm 可以是同一块内存（原地处理）*/
+void audio_fe_process(audio_fe_t *fe, const uint16_t *adc, int16_t *pcm, uint32_t count);
+
+#endif /* AUDIO_FE_ENABLE */
+
+#endif /* __AUDIO_FRONTEND_H__ */
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Microphone front end self test
+ */
+
+/*
+ * 麦克风前端自测：用合成的ADC信号逐项检查 audio_frontend 的各级处理并测量耗时
+ *   raw   选项为0时与原来的 (adc - 2048) * 16 逐值一致（全部4096个ADC码）
+ *   dc    偏置在1900而不是2048时，输出均值收敛到0附近
+ *   hpf   50Hz工频衰减约12dB，1kHz基本不衰减
+ *   agc   小声放大（不超过最大增益），大声压到目标峰值附近，静音回落到1倍
+ *   time  每样本耗时，设备端与 AUDIO_FE_CYCLES_PER_SAMPLE 比较
+ *
+ * 设备端：fe_bench
+ * PC端（使用C实现，结果与设备端相同）：
+ *   gcc -O2 -DAUDIO_FE_BENCH_MAIN -D__GNUC_PYTHON__ -D__RESTRICT=__restrict -include arm_math.h \
+ *       -I../libraries/CMSIS/DSP/Include -I../libraries/CMSIS/DSP/PrivateInclude \
+ *       -I../libraries/CMSIS/Core/Include \
+ *       audio_frontend.c audio_frontend_bench.c \
+ *       ../libraries/CMSIS/DSP/Source/FilteringFunctions/arm_biquad_cascade_df1_q15.c \
+ *       ../libraries/CMSIS/DSP/Source/FilteringFunctions/arm_biquad_cascade_df1_init_q15.c \
+ *       -lm -o fe_bench
+ *   ./fe_bench
+ */
+
+#include <string.h>
+#include <math.h>
+#include "audio_frontend.h"
+
+#if AUDIO_FE_ENABLE
+
+#ifdef __RTTHREAD__
+#include <rtthread.h>
+#include <board.h>
+#define FE_PRINTF       rt_kprintf
+#else
+#include <stdio.h>
+#include <time.h>
+#define FE_PRINTF       printf
+#endif
+
+#define FE_BENCH_RATE       16000
+#define FE_BENCH_BLOCK      1024        /* 与DMA半缓冲区相同 */
+
+static uint16_t fe_bench_adc[FE_BENCH_BLOCK];
+static int16_t fe_bench_pcm[FE_BENCH_BLOCK];
+
+/* 时间戳：设备端为CPU周期，PC端为纳秒 */
+static uint32_t fe_bench_now(void)
+{
+#ifdef __RTTHREAD__
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    return DWT->CYCCNT;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+#endif
+}
+
+/* 生成一块正弦ADC数据，index为起始样本序号 */
+static void fe_bench_tone(uint32_t index, float hz, int32_t amplitude, int32_t center)
+{
+    for (uint32_t i = 0; i < FE_BENCH_BLOCK; i++)
+    {
+        int32_t value = center + (int32_t)lrintf(amplitude * sinf(2.0f * PI * hz * (index + i) / FE_BENCH_RATE));
+
+        fe_bench_adc[i] = (uint16_t)(value < 0 ? 0 : (value > 4095 ? 4095 : value));
+    }
+}
+
+/* 连续处理 seconds 秒的正弦信号，返回最后一块的峰值，rms/mean 为最后一块的统计 */
+static int32_t fe_bench_run(audio_fe_t *fe, float hz, int32_t amplitude, int32_t center,
+                            uint32_t seconds, int32_t *rms, int32_t *mean)
+{
+    uint32_t blocks = seconds * FE_BENCH_RATE / FE_BENCH_BLOCK;
+    int32_t peak = 0;
+    int64_t sum = 0, square = 0;
+
+    for (uint32_t b = 0; b < blocks; b++)
+    {
+        fe_bench_tone(b * FE_BENCH_BLOCK, hz, amplitude, center);
+        audio_fe_process(fe, fe_bench_adc, fe_bench_pcm, FE_BENCH_BLOCK);
+    }
+
+    for (uint32_t i = 0; i < FE_BENCH_BLOCK; i++)
+    {
+        int32_t value = fe_bench_pcm[i];
+
+        sum += value;
+        square += (int64_t)value * value;
+        if ((value < 0 ? -value : value) > peak)
+        {
+            peak = value < 0 ? -value : value;
+        }
+    }
+    if (rms)
+    {
+        *rms = (int32_t)sqrtf((float)(square / FE_BENCH_BLOCK));
+    }
+    if (mean)
+    {
+        *mean = (int32_t)(sum / FE_BENCH_BLOCK);
+    }
+
+    return peak;
+}
+
+/* 原始换算：全部ADC码与原来的公式一致，奇数长度覆盖SIMD之后的尾部处理 */
+static int fe_bench_raw(audio_fe_t *fe)
+{
+    uint32_t mismatches = 0;
+
+    audio_fe_init(fe, FE_BENCH_RATE, 0);
+    for (uint32_t base = 0; base < 4096; base += FE_BENCH_BLOCK)
+    {
+        for (uint32_t i = 0; i < FE_BENCH_BLOCK; i++)
+        {
+            fe_bench_adc[i] = (uint16_t)(base + i);
+        }
+        /* 原地处理，与驱动的环形缓冲区模式相同 */
+        audio_fe_process(fe, fe_bench_adc, (int16_t *)fe_bench_adc, FE_BENCH_BLOCK - 1);
+        for (uint32_t i = 0; i < FE_BENCH_BLOCK - 1; i++)
+        {
+            if (((int16_t *)fe_bench_adc)[i] != (int16_t)(((int32_t)(base + i) - 2048) * 16))
+            {
+                mismatches++;
+            }
+        }
+    }
+    FE_PRINTF("raw   4096 codes, mismatches %d\n", mismatches);
+
+    return mismatches == 0 ? 0 : -1;
+}
+
+/* 去直流：偏置1900时输出均值应接近0（原来的固定2048会留下-2368的偏移）*/
+static int fe_bench_dc(audio_fe_t *fe)
+{
+    int32_t rms, mean;
+
+    audio_fe_init(fe, FE_BENCH_RATE, AUDIO_FE_DC);
+    fe_bench_run(fe, 1000.0f, 300, 1900, 3, &rms, &mean);
+    FE_PRINTF("dc    offset 1900 -> estimate %d, output mean %d\n", (fe->dc + 128) >> 8, mean);
+
+    return (mean > -64 && mean < 64) ? 0 : -1;
+}
+
+/* 高通：相同幅度下50Hz与1kHz的输出比较 */
+static int fe_bench_hpf(audio_fe_t *fe)
+{
+    int32_t rms_50, rms_1k, rms_in;
+    float db_50, db_1k;
+
+    audio_fe_init(fe, FE_BENCH_RATE, 0);
+    fe_bench_run(fe, 1000.0f, 500, 2048, 1, &rms_in, NULL);
+
+    audio_fe_init(fe, FE_BENCH_RATE, AUDIO_FE_DC | AUDIO_FE_HIGHPASS);
+    fe_bench_run(fe, 50.0f, 500, 2048, 2, &rms_50, NULL);
+    audio_fe_init(fe, FE_BENCH_RATE, AUDIO_FE_DC | AUDIO_FE_HIGHPASS);
+    fe_bench_run(fe, 1000.0f, 500, 2048, 2, &rms_1k, NULL);
+
+    db_50 = 20.0f * log10f((float)rms_50 / rms_in);
+    db_1k = 20.0f * log10f((float)rms_1k / rms_in);
+    FE_PRINTF("hpf   50Hz %d.%d dB, 1kHz %d.%d dB\n",
+              (int)db_50, (int)(fabsf(db_50) * 10) % 10, (int)db_1k, (int)(fabsf(db_1k) * 10) % 10);
+
+    return (db_50 < -9.0f && db_1k > -1.0f) ? 0 : -1;
+}
+
+/* AGC：小声、大声、静音三种输入的最终增益和峰值 */
+static int fe_bench_agc(audio_fe_t *fe)
+{
+    int32_t quiet, loud, silent;
+    int32_t gain_quiet, gain_loud;
+    int ret = 0;
+
+    audio_fe_init(fe, FE_BENCH_RATE, AUDIO_FE_DEFAULT);
+    quiet = fe_bench_run(fe, 1000.0f, 200, 2048, 3, NULL, NULL);
+    gain_quiet = fe->gain;
+    loud = fe_bench_run(fe, 1000.0f, 1800, 2048, 1, NULL, NULL);
+    gain_loud = fe->gain;
+    silent = fe_bench_run(fe, 1000.0f, 10, 2048, 3, NULL, NULL);
+
+    FE_PRINTF("agc   quiet peak %d (gain %d/256), loud peak %d (gain %d/256), silence gain %d/256 peak %d\n",
+              quiet, gain_quiet, loud, gain_loud, fe->gain, silent);
+
+    /* 小声输入3200，最大4倍；大声输入28800，压到目标附近且不削波 */
+    if (gain_quiet != AUDIO_FE_AGC_MAX_GAIN * AUDIO_FE_GAIN_ONE || quiet < 3 * 3200)
+    {
+        ret = -1;
+    }
+    if (loud > AUDIO_FE_AGC_TARGET * 5 / 4 || loud < AUDIO_FE_AGC_TARGET * 3 / 4)
+    {
+        ret = -1;
+    }
+    if (fe->gain > AUDIO_FE_GAIN_ONE + 16)
+    {
+        ret = -1;
+    }
+
+    return ret;
+}
+
+/* 耗时：全部处理级，每样本周期数（设备端）或纳秒（PC端）*/
+static int fe_bench_time(audio_fe_t *fe)
+{
+    uint32_t rounds = 64;
+    uint32_t start, elapsed;
+    uint32_t per_sample_x10;
+
+    audio_fe_init(fe, FE_BENCH_RATE, AUDIO_FE_DEFAULT);
+    fe_bench_tone(0, 1000.0f, 500, 2000);
+    start = fe_bench_now();
+    for (uint32_t i = 0; i < rounds; i++)
+    {
+        /* 每轮都从ADC原始数据开始，避免原地处理后输入变化 */
+        audio_fe_process(fe, fe_bench_adc, fe_bench_pcm, FE_BENCH_BLOCK);
+    }
+    elapsed = fe_bench_now() - start;
+    per_sample_x10 = (uint32_t)((uint64_t)elapsed * 10 / (rounds * FE_BENCH_BLOCK));
+
+#ifdef __RTTHREAD__
+    FE_PRINTF("time  %d.%d cycles/sample (budget %d), %d cycles/block\n",
+              per_sample_x10 / 10, per_sample_x10 % 10, AUDIO_FE_CYCLES_PER_SAMPLE, elapsed / rounds);
+    return per_sample_x10 <= AUDIO_FE_CYCLES_PER_SAMPLE * 10 ? 0 : -1;
+#else
+    FE_PRINTF("time  %d.%d ns/sample (host, not checked)\n", per_sample_x10 / 10, per_sample_x10 % 10);
+    return 0;
+#endif
+}
+
+int audio_fe_bench(void)
+{
+    static audio_fe_t fe;
+    int failed = 0;
+
+    failed += fe_bench_raw(&fe) != 0;
+    failed += fe_bench_dc(&fe) != 0;
+    failed += fe_bench_hpf(&fe) != 0;
+    failed += fe_bench_agc(&fe) != 0;
+    failed += fe_bench_time(&fe) != 0;
+    FE_PRINTF("Result: %s\n", failed ? "FAIL" : "PASS");
+
+    return failed ? -1 : 0;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+static int cmd_fe_bench(int argc, char **argv)
+{
+    return audio_fe_bench();
+}
+MSH_CMD_EXPORT_ALIAS(cmd_fe_bench, fe_bench, Check microphone front end stages and timing);
+#endif
+
+#ifdef AUDIO_FE_BENCH_MAIN
+int main(void)
+{
+    return audio_fe_bench() == 0 ? 0 : 1;
+}
+#endif
+
+#endif /* AUDIO_FE_ENABLE */
@@ -0,0 +1,703 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Shared capture hub
+ * 2024-10-27     AI Assistant Subscribe from a past position for wakeup pre-roll
+ * 2024-10-27     AI Assistant Run mic_hub_test with the front end in raw mode
+ */
+
+#include <rtthread.h>
+#include <rthw.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "audio_hub.h"
+#include "audio_capture.h"
+#include "memory_helper.h"
+
+#define DBG_TAG "audio.hub"
+#define DBG_LVL DBG_INFO
+#include <rtdbg.h>
+
+/* 写位置对环形缓冲区取模，32位样本序号回绕时仍然连续 */
+#if (AUDIO_HUB_RING_SAMPLES & (AUDIO_HUB_RING_SAMPLES - 1)) != 0
+#error "AUDIO_HUB_BLOCKS must be a power of 2"
+#endif
+#define AUDIO_HUB_INDEX(pos)    ((pos) & (AUDIO_HUB_RING_SAMPLES - 1))
+
+static struct {
+    struct rt_mutex lock;           /* 保护订阅和采集启停 */
+    rt_bool_t lock_ready;
+    rt_bool_t capture_ready;        /* 已调用 audio_capture_init */
+    rt_bool_t simulated;            /* 测试：不启动ADC，由定时器送入数据 */
+    int16_t *ring;                  /* 第一次启动时分配，之后一直保留 */
+    volatile uint32_t write_pos;    /* 已写入的样本总数 */
+    uint32_t block;                 /* 最近一次写入的样本数 */
+    uint32_t blocks;
+    uint32_t count;
+    audio_hub_sub_t *subs;          /* 中断中遍历，修改时关中断 */
+} audio_hub = {
+    .block = AUDIO_HUB_BLOCK_SAMPLES
+};
+
+static void audio_hub_lock(void)
+{
+    if (!audio_hub.lock_ready)
+    {
+        rt_enter_critical();
+        if (!audio_hub.lock_ready)
+        {
+            rt_mutex_init(&audio_hub.lock, "mic_hub", RT_IPC_FLAG_PRIO);
+            audio_hub.lock_ready = RT_TRUE;
+        }
+        rt_exit_critical();
+    }
+
+    rt_mutex_take(&audio_hub.lock, RT_WAITING_FOREVER);
+}
+
+static void audio_hub_unlock(void)
+{
+    rt_mutex_release(&audio_hub.lock);
+}
+
+/* 采集回调（DMA中断上下文）：半缓冲区直接转换写入环形缓冲区，唤醒等待中的订阅者 */
+static void audio_hub_capture_callback(uint16_t *adc_data, uint32_t count, void *user_data)
+{
+    uint32_t offset = AUDIO_HUB_INDEX(audio_hub.write_pos);
+    uint32_t first = AUDIO_HUB_RING_SAMPLES - offset;
+    audio_hub_sub_t *sub;
+    rt_base_t level;
+
+    if (first > count)
+    {
+        first = count;
+    }
+    audio_process_samples(adc_data, audio_hub.ring + offset, first);
+    if (count > first)
+    {
+        audio_process_samples(adc_data + first, audio_hub.ring, count - first);
+    }
+
+    level = rt_hw_interrupt_disable();
+    audio_hub.write_pos += count;
+    audio_hub.block = count;
+    audio_hub.blocks++;
+    for (sub = audio_hub.subs; sub != RT_NULL; sub = sub->next)
+    {
+        if (sub->waiting)
+        {
+            sub->waiting = RT_FALSE;
+            rt_sem_release(sub->data_sem);
+        }
+    }
+    rt_hw_interrupt_enable(level);
+}
+
+/* 计算读位置落后多少样本，已被覆盖时跳到仍有效的数据（需关中断）*/
+static uint32_t audio_hub_lag_locked(audio_hub_sub_t *sub)
+{
+    uint32_t lag = audio_hub.write_pos - sub->cursor;
+
+    if (lag > AUDIO_HUB_RING_SAMPLES)
+    {
+        /* 最早的一块会被下一次中断覆盖，一并跳过 */
+        uint32_t keep = AUDIO_HUB_RING_SAMPLES - audio_hub.block;
+
+        sub->overruns++;
+        sub->lost += lag - keep;
+        sub->cursor = audio_hub.write_pos - keep;
+        lag = keep;
+    }
+    if (lag > sub->max_lag)
+    {
+        sub->max_lag = lag;
+    }
+
+    return lag;
+}
+
+static rt_err_t audio_hub_capture_start(void)
+{
+    rt_err_t ret;
+
+    /* 2秒历史有64KB，放在PSRAM；每个半缓冲区只写一次、每个订阅者顺序读一次，带宽很低 */
+    if (audio_hub.ring == RT_NULL)
+    {
+        audio_hub.ring = (int16_t *)mem_class_alloc(MEM_CLASS_BULK,
+                                                    AUDIO_HUB_RING_SAMPLES * sizeof(int16_t));
+        if (audio_hub.ring == RT_NULL)
+        {
+            return -RT_ENOMEM;
+        }
+    }
+
+    audio_hub.write_pos = 0;
+    audio_hub.blocks = 0;
+    if (audio_hub.simulated)
+    {
+        return RT_EOK;
+    }
+
+    if (!audio_hub.capture_ready)
+    {
+        ret = audio_capture_init();
+        if (ret != RT_EOK)
+        {
+            return ret;
+        }
+        audio_hub.capture_ready = RT_TRUE;
+    }
+
+    return audio_capture_start(audio_hub_capture_callback, RT_NULL);
+}
+
+static rt_err_t audio_hub_attach(audio_hub_sub_t *sub, const char *name, rt_bool_t history, uint32_t pos)
+{
+    rt_base_t level;
+    rt_err_t ret;
+
+    rt_memset(sub, 0, sizeof(*sub));
+    sub->name = name;
+    sub->data_sem = rt_sem_create(name, 0, RT_IPC_FLAG_FIFO);
+    if (sub->data_sem == RT_NULL)
+    {
+        return -RT_ENOMEM;
+    }
+
+    audio_hub_lock();
+
+    if (audio_hub.count == 0)
+    {
+        history = RT_FALSE;
+        ret = audio_hub_capture_start();
+        if (ret != RT_EOK)
+        {
+            audio_hub_unlock();
+            LOG_E("Failed to start capture for %s", name);
+            rt_sem_delete(sub->data_sem);
+            sub->data_sem = RT_NULL;
+            return ret;
+        }
+    }
+
+    level = rt_hw_interrupt_disable();
+    sub->cursor = audio_hub.write_pos;
+    if (history)
+    {
+        uint32_t back = audio_hub.write_pos - pos;
+
+        /* 最多回溯到不会被下一次中断覆盖的最早数据，pos在写位置之后则从当前开始 */
+        if ((rt_int32_t)back < 0)
+        {
+            back = 0;
+        }
+        if (audio_hub.blocks < AUDIO_HUB_BLOCKS && back > audio_hub.write_pos)
+        {
+            back = audio_hub.write_pos;
+        }
+        if (back > AUDIO_HUB_RING_SAMPLES - audio_hub.block)
+        {
+            back = AUDIO_HUB_RING_SAMPLES - audio_hub.block;
+        }
+        sub->cursor -= back;
+    }
+    sub->next = audio_hub.subs;
+    audio_hub.subs = sub;
+    rt_hw_interrupt_enable(level);
+    audio_hub.count++;
+
+    audio_hub_unlock();
+
+    LOG_D("%s subscribed (%d)", name, audio_hub.count);
+    return RT_EOK;
+}
+
+rt_err_t audio_hub_subscribe(audio_hub_sub_t *sub, const char *name)
+{
+    return audio_hub_attach(sub, name, RT_FALSE, 0);
+}
+
+rt_err_t audio_hub_subscribe_from(audio_hub_sub_t *sub, const char *name, uint32_t pos)
+{
+    return audio_hub_attach(sub, name, RT_TRUE, pos);
+}
+
+void audio_hub_unsubscribe(audio_hub_sub_t *sub)
+{
+    audio_hub_sub_t **link;
+    rt_base_t level;
+
+    if (sub->data_sem == RT_NULL)
+    {
+        return;
+    }
+
+    audio_hub_lock();
+
+    level = rt_hw_interrupt_disable();
+    for (link = &audio_hub.subs; *link != RT_NULL; link = &(*link)->next)
+    {
+        if (*link == sub)
+        {
+            *link = sub->next;
+            break;
+        }
+    }
+    rt_hw_interrupt_enable(level);
+
+    if (--audio_hub.count == 0 && !audio_hub.simulated)
+    {
+        audio_capture_stop();
+    }
+
+    audio_hub_unlock();
+
+    rt_sem_delete(sub->data_sem);
+    sub->data_sem = RT_NULL;
+
+    if (sub->overruns > 0)
+    {
+        LOG_W("%s: %d samples read, %d overruns, %d samples lost",
+              sub->name, sub->samples, sub->overruns, sub->lost);
+    }
+}
+
+int audio_hub_peek(audio_hub_sub_t *sub, const int16_t **samples, uint32_t timeout)
+{
+    rt_tick_t deadline = rt_tick_get() + rt_tick_from_millisecond(timeout);
+    uint32_t lag, offset;
+    rt_base_t level;
+
+    if (sub->data_sem == RT_NULL)
+    {
+        return -RT_ERROR;
+    }
+
+    while (1)
+    {
+        rt_tick_t now;
+
+        level = rt_hw_interrupt_disable();
+        lag = audio_hub_lag_locked(sub);
+        sub->waiting = (lag == 0);
+        rt_hw_interrupt_enable(level);
+
+        if (lag > 0)
+        {
+            break;
+        }
+
+        /* 信号量可能是上一次等待遗留的，按截止时间重新计算剩余等待 */
+        now = rt_tick_get();
+        if ((rt_int32_t)(deadline - now) <= 0 ||
+            rt_sem_take(sub->data_sem, deadline - now) != RT_EOK)
+        {
+            sub->waiting = RT_FALSE;
+            return 0;
+        }
+    }
+
+    offset = AUDIO_HUB_INDEX(sub->cursor);
+    if (lag > AUDIO_HUB_RING_SAMPLES - offset)
+    {
+        lag = AUDIO_HUB_RING_SAMPLES - offset;
+    }
+    *samples = audio_hub.ring + offset;
+
+    return lag;
+}
+
+rt_err_t audio_hub_consume(audio_hub_sub_t *sub, uint32_t count)
+{
+    rt_err_t ret = RT_EOK;
+    rt_base_t level;
+
+    level = rt_hw_interrupt_disable();
+    if (audio_hub.write_pos - sub->cursor > AUDIO_HUB_RING_SAMPLES)
+    {
+        /* 处理期间写入方已绕回，读到的数据不完整 */
+        audio_hub_lag_locked(sub);
+        ret = -RT_EFULL;
+    }
+    else
+    {
+        sub->cursor += count;
+        sub->samples += count;
+    }
+    rt_hw_interrupt_enable(level);
+
+    return ret;
+}
+
+int audio_hub_read(audio_hub_sub_t *sub, uint8_t *buffer, uint32_t size, uint32_t timeout)
+{
+    uint32_t want = size / sizeof(int16_t);
+    uint32_t got = 0;
+    const int16_t *samples;
+    int n;
+
+    if (buffer == RT_NULL || want == 0)
+    {
+        return -RT_EINVAL;
+    }
+
+    /* 只在没有数据时等待，之后取完已有的数据就返回 */
+    n = audio_hub_peek(sub, &samples, timeout);
+    while (n > 0)
+    {
+        uint32_t take = want - got < (uint32_t)n ? want - got : (uint32_t)n;
+
+        rt_memcpy(buffer + got * sizeof(int16_t), samples, take * sizeof(int16_t));
+        if (audio_hub_consume(sub, take) == RT_EOK)
+        {
+            got += take;
+        }
+        if (got == want)
+        {
+            break;
+        }
+        n = audio_hub_peek(sub, &samples, 0);
+    }
+
+    return got > 0 ? (int)(got * sizeof(int16_t)) : n;
+}
+
+uint32_t audio_hub_subscribers(void)
+{
+    return audio_hub.count;
+}
+
+uint32_t audio_hub_position(void)
+{
+    return audio_hub.write_pos;
+}
+
+#ifdef FINSH_USING_MSH
+#define AUDIO_HUB_MS(samples)   ((samples) * 1000 / AUDIO_SAMPLE_RATE)
+
+static int cmd_mic_hub(int argc, char **argv)
+{
+    audio_hub_sub_t *sub;
+
+    audio_hub_lock();
+    rt_kprintf("Capture hub: %s, %d subscribers, ring %d ms, %d blocks\n",
+               audio_hub.count > 0 ? "running" : "stopped", audio_hub.count,
+               AUDIO_HUB_MS(AUDIO_HUB_RING_SAMPLES), audio_hub.blocks);
+    if (audio_hub.count > 0)
+    {
+        rt_kprintf("Name        Read ms  Lag ms  Max lag ms  Overruns  Lost ms\n");
+    }
+    for (sub = audio_hub.subs; sub != RT_NULL; sub = sub->next)
+    {
+        rt_kprintf("%-10s %8d %7d %11d %9d %8d\n", sub->name,
+                   AUDIO_HUB_MS(sub->samples), AUDIO_HUB_MS(audio_hub.write_pos - sub->cursor),
+                   AUDIO_HUB_MS(sub->max_lag), sub->overruns, AUDIO_HUB_MS(sub->lost));
+    }
+    audio_hub_unlock();
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_mic_hub, mic_hub, Show capture hub subscribers);
+
+/* 电平表订阅者：每200ms打印一次平均幅度和峰值 */
+static int cmd_mic_level(int argc, char **argv)
+{
+    uint32_t seconds = argc > 1 ? atoi(argv[1]) : 5;
+    uint32_t total = seconds * AUDIO_SAMPLE_RATE;
+    uint32_t window = AUDIO_SAMPLE_RATE / 5;
+    uint32_t sum = 0, peak = 0, in_window = 0;
+    audio_hub_sub_t sub;
+    const int16_t *samples;
+    int n;
+
+    if (audio_hub_subscribe(&sub, "level") != RT_EOK)
+    {
+        return -RT_ERROR;
+    }
+
+    while (sub.samples + sub.lost < total && (n = audio_hub_peek(&sub, &samples, 1000)) > 0)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            uint32_t value = samples[i] < 0 ? -samples[i] : samples[i];
+
+            sum += value;
+            if (value > peak)
+            {
+                peak = value;
+            }
+            if (++in_window == window)
+            {
+                uint32_t avg = sum / window;
+                int bar = avg * 40 / 8192;
+                char meter[41];
+
+                rt_memset(meter, ' ', 40);
+                rt_memset(meter, '#', bar > 40 ? 40 : bar);
+                meter[40] = '\0';
+                rt_kprintf("avg %5d  peak %5d  |%s|\n", avg, peak, meter);
+                sum = 0;
+                peak = 0;
+                in_window = 0;
+            }
+        }
+        audio_hub_consume(&sub, n);
+    }
+
+    audio_hub_unsubscribe(&sub);
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_mic_level, mic_level, Print microphone level from capture hub: mic_level [seconds]);
+
+/* 文件转存订阅者：环形缓冲区中的PCM直接写入文件 */
+static int cmd_mic_dump(int argc, char **argv)
+{
+    uint32_t seconds;
+    uint32_t total;
+    audio_hub_sub_t sub;
+    const int16_t *samples;
+    int fd, n;
+
+    if (argc < 2)
+    {
+        rt_kprintf("Usage: mic_dump <file> [seconds]\n");
+        return -RT_EINVAL;
+    }
+    seconds = argc > 2 ? atoi(argv[2]) : 5;
+    total = seconds * AUDIO_SAMPLE_RATE;
+
+    fd = open(argv[1], O_WRONLY | O_CREAT | O_TRUNC);
+    if (fd < 0)
+    {
+        rt_kprintf("Failed to open %s\n", argv[1]);
+        return -RT_ERROR;
+    }
+    if (audio_hub_subscribe(&sub, "dump") != RT_EOK)
+    {
+        close(fd);
+        return -RT_ERROR;
+    }
+
+    while (sub.samples + sub.lost < total && (n = audio_hub_peek(&sub, &samples, 1000)) > 0)
+    {
+        if ((uint32_t)n > total - sub.samples - sub.lost)
+        {
+            n = total - sub.samples - sub.lost;
+        }
+        if (write(fd, samples, n * sizeof(int16_t)) != n * (int)sizeof(int16_t))
+        {
+            rt_kprintf("Write failed\n");
+            break;
+        }
+        audio_hub_consume(&sub, n);
+    }
+
+    close(fd);
+    rt_kprintf("Saved %d ms to %s (%d overruns, %d ms lost)\n",
+               AUDIO_HUB_MS(sub.samples), argv[1], sub.overruns, AUDIO_HUB_MS(sub.lost));
+    audio_hub_unsubscribe(&sub);
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_mic_dump, mic_dump, Save raw PCM from capture hub: mic_dump <file> [seconds]);
+
+/* 多订阅者回放测试：软定时器按16kHz节奏送入递增锯齿波，三个订阅者以不同速度读取，
+ * 按样本序号校验内容，慢速订阅者应出现覆盖且 已读 + 丢失 = 写入总数 */
+static struct {
+    uint16_t half[AUDIO_HUB_BLOCK_SAMPLES];
+    uint32_t next;
+    uint32_t total;
+    rt_sem_t done;
+} hub_test;
+
+typedef struct {
+    audio_hub_sub_t sub;
+    int mode;                       /* 0: peek/consume  1: audio_hub_read  2: 慢速 */
+    uint32_t mismatches;
+    rt_bool_t timeout;
+} hub_test_reader_t;
+
+static void hub_test_timeout(void *parameter)
+{
+    if (hub_test.next >= hub_test.total)
+    {
+        return;
+    }
+    for (uint32_t i = 0; i < AUDIO_HUB_BLOCK_SAMPLES; i++)
+    {
+        hub_test.half[i] = (uint16_t)((hub_test.next + i) & 0x0FFF);
+    }
+    hub_test.next += AUDIO_HUB_BLOCK_SAMPLES;
+
+    audio_hub_capture_callback(hub_test.half, AUDIO_HUB_BLOCK_SAMPLES, RT_NULL);
+}
+
+static uint32_t hub_test_check(const int16_t *samples, uint32_t count, uint32_t index)
+{
+    uint32_t mismatches = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (samples[i] != (int16_t)(((int32_t)((index + i) & 0x0FFF) - 2048) * 16))
+        {
+            mismatches++;
+        }
+    }
+
+    return mismatches;
+}
+
+static void hub_test_reader(void *parameter)
+{
+    hub_test_reader_t *reader = (hub_test_reader_t *)parameter;
+    audio_hub_sub_t *sub = &reader->sub;
+    int16_t chunk[160];
+    const int16_t *samples;
+    int n;
+
+    while (sub->cursor != hub_test.total)
+    {
+        if (reader->mode == 1)
+        {
+            uint32_t index;
+
+            /* 以10ms为单位读取，与录音线程的读法一致 */
+            n = audio_hub_read(sub, (uint8_t *)chunk, sizeof(chunk), 1000);
+            if (n <= 0)
+            {
+                reader->timeout = RT_TRUE;
+                break;
+            }
+            /* 读取中途跳过了数据时，按新的读位置往前推算 */
+            index = sub->cursor - n / sizeof(int16_t);
+            reader->mismatches += hub_test_check(chunk, n / sizeof(int16_t), index);
+            continue;
+        }
+
+        n = audio_hub_peek(sub, &samples, 1000);
+        if (n <= 0)
+        {
+            reader->timeout = RT_TRUE;
+            break;
+        }
+        if (reader->mode == 2 && n > 512)
+        {
+            /* 每100ms只处理512个样本，约为采集速度的三分之一 */
+            n = 512;
+        }
+        reader->mismatches += hub_test_check(samples, n, sub->cursor);
+        audio_hub_consume(sub, n);
+        if (reader->mode == 2)
+        {
+            rt_thread_mdelay(100);
+        }
+    }
+
+    rt_sem_release(hub_test.done);
+}
+
+static int mic_hub_test(int argc, char **argv)
+{
+    static const char *names[] = {"fast", "read", "slow"};
+    hub_test_reader_t readers[3];
+    uint32_t seconds = argc > 1 ? atoi(argv[1]) : 5;
+    rt_bool_t pass = RT_TRUE;
+    rt_timer_t timer;
+    uint32_t fe_flags;
+    int i;
+
+    audio_hub_lock();
+    if (audio_hub.count > 0)
+    {
+        audio_hub_unlock();
+        rt_kprintf("Capture hub is running, stop its subscribers first\n");
+        return -RT_EBUSY;
+    }
+    audio_hub.simulated = RT_TRUE;
+    audio_hub_unlock();
+
+    /* 锯齿波按原始换算校验，测试期间关闭前端处理 */
+    fe_flags = audio_capture_set_frontend(0);
+    hub_test.next = 0;
+    hub_test.total = (seconds * AUDIO_SAMPLE_RATE) / AUDIO_HUB_BLOCK_SAMPLES * AUDIO_HUB_BLOCK_SAMPLES;
+    hub_test.done = rt_sem_create("hub_test", 0, RT_IPC_FLAG_FIFO);
+    timer = rt_timer_create("hub_sim", hub_test_timeout, RT_NULL,
+                            rt_tick_from_millisecond(AUDIO_HUB_BLOCK_SAMPLES * 1000 / AUDIO_SAMPLE_RATE),
+                            RT_TIMER_FLAG_PERIODIC | RT_TIMER_FLAG_SOFT_TIMER);
+    if (hub_test.done == RT_NULL || timer == RT_NULL)
+    {
+        goto _exit;
+    }
+
+    rt_memset(readers, 0, sizeof(readers));
+    for (i = 0; i < 3; i++)
+    {
+        rt_thread_t thread;
+
+        readers[i].mode = i;
+        if (audio_hub_subscribe(&readers[i].sub, names[i]) != RT_EOK)
+        {
+            break;
+        }
+        thread = rt_thread_create(names[i], hub_test_reader, &readers[i], 2048, 20, 10);
+        if (thread == RT_NULL)
+        {
+            rt_kprintf("Failed to create reader %s\n", names[i]);
+            audio_hub_unsubscribe(&readers[i].sub);
+            break;
+        }
+        rt_thread_startup(thread);
+    }
+    rt_timer_start(timer);
+
+    while (i-- > 0)
+    {
+        rt_sem_take(hub_test.done, RT_WAITING_FOREVER);
+    }
+    rt_timer_stop(timer);
+
+    rt_kprintf("Written: %d samples in %d blocks\n", hub_test.total, audio_hub.blocks);
+    rt_kprintf("Name   Samples   Lost  Overruns  Max lag  Mismatches\n");
+    for (i = 0; i < 3; i++)
+    {
+        audio_hub_sub_t *sub = &readers[i].sub;
+
+        if (sub->data_sem == RT_NULL)
+        {
+            pass = RT_FALSE;
+            continue;
+        }
+        rt_kprintf("%-5s %8d %6d %9d %8d %11d%s\n", sub->name, sub->samples, sub->lost,
+                   sub->overruns, sub->max_lag, readers[i].mismatches,
+                   readers[i].timeout ? "  (timeout)" : "");
+        if (readers[i].timeout || readers[i].mismatches > 0 ||
+            sub->samples + sub->lost != hub_test.total ||
+            (i < 2 && sub->overruns > 0) || (i == 2 && sub->overruns == 0))
+        {
+            pass = RT_FALSE;
+        }
+        audio_hub_unsubscribe(sub);
+    }
+    rt_kprintf("Result: %s\n", pass ? "PASS" : "FAIL");
+
+_exit:
+    if (timer)
+    {
+        rt_timer_delete(timer);
+    }
+    if (hub_test.done)
+    {
+        rt_sem_delete(hub_test.done);
+    }
+    audio_hub.simulated = RT_FALSE;
+    audio_capture_set_frontend(fe_flags);
+
+    return 0;
+}
+MSH_CMD_EXPORT(mic_hub_test, replay simulated capture through hub with fast and slow subscribers);
+#endif /* FINSH_USING_MSH */
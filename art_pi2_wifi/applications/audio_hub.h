@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Shared capture hub
+ * 2024-10-27     AI Assistant Subscribe from a past position for wakeup pre-roll
+ */
+
+#ifndef __AUDIO_HUB_H__
+#define __AUDIO_HUB_H__
+
+/*
+ * 麦克风采集集线器：ADC只启动一次，多个订阅者（唤醒词、录音、电平表、文件转存……）共用一个PCM环形缓冲区
+ *   - 第一个订阅者加入时启动采集，最后一个退出时停止，订阅者之间不再抢 audio_capture_start/stop
+ *   - DMA中断把每个半缓冲区转换为PCM后写入环形缓冲区一次，不按订阅者复制
+ *   - 每个订阅者有自己的读位置（从采集开始计的样本序号），audio_hub_peek 直接返回环形缓冲区中的数据，
+ *     处理完用 audio_hub_consume 前进
+ *   - 写入方从不等待：读得太慢、数据已被覆盖的订阅者跳到仍有效的最早数据，并计入overruns和lost
+ */
+
+#include <rtthread.h>
+
+/* 环形缓冲区大小（采集半缓冲区1024样本的倍数，须为2的幂），默认32块 = 2048ms，可在编译选项中定义覆盖；
+ * 同时也是订阅者能回溯的最长历史 */
+#ifndef AUDIO_HUB_BLOCKS
+#define AUDIO_HUB_BLOCKS        32
+#endif
+#define AUDIO_HUB_BLOCK_SAMPLES 1024
+#define AUDIO_HUB_RING_SAMPLES  (AUDIO_HUB_BLOCKS * AUDIO_HUB_BLOCK_SAMPLES)
+
+/* 订阅者，由调用者提供存储，订阅期间不能释放 */
+typedef struct audio_hub_sub {
+    const char *name;
+    rt_sem_t data_sem;
+    volatile rt_bool_t waiting;     /* 正在等待新数据，中断中据此唤醒 */
+    uint32_t cursor;                /* 下一个要读的样本序号 */
+    uint32_t samples;               /* 已读样本数 */
+    uint32_t overruns;              /* 数据被覆盖的次数 */
+    uint32_t lost;                  /* 因覆盖跳过的样本数 */
+    uint32_t max_lag;               /* 读位置落后写位置的最大样本数 */
+    struct audio_hub_sub *next;
+} audio_hub_sub_t;
+
+/* 加入/退出，第一个加入时启动采集，最后一个退出时停止；新订阅者从当前写位置开始读 */
+rt_err_t audio_hub_subscribe(audio_hub_sub_t *sub, const char *name);
+void audio_hub_unsubscribe(audio_hub_sub_t *sub);
+
+/* 从过去的样本序号 pos 开始读（如唤醒词结束处），超出环形缓冲区的部分从仍有效的最早数据开始；
+ * 采集原本未运行时没有历史，与 audio_hub_subscribe 相同 */
+rt_err_t audio_hub_subscribe_from(audio_hub_sub_t *sub, const char *name, uint32_t pos);
+
+/* 当前写位置：采集开始以来的样本总数 */
+uint32_t audio_hub_position(void);
+
+/* 等待并返回环形缓冲区中连续可读的样本数（不跨越缓冲区末尾），超时返回0，采集停止返回负数；
+ * 数据留在环形缓冲区中，处理完后调用 audio_hub_consume */
+int audio_hub_peek(audio_hub_sub_t *sub, const int16_t **samples, uint32_t timeout);
+
+/* 读位置前进count个样本；处理期间数据已被覆盖时返回 -RT_EFULL 并跳到仍有效的数据 */
+rt_err_t audio_hub_consume(audio_hub_sub_t *sub, uint32_t count);
+
+/* 复制到调用者的缓冲区（如录音缓冲），用法与 audio_capture_read 相同，返回字节数 */
+int audio_hub_read(audio_hub_sub_t *sub, uint8_t *buffer, uint32_t size, uint32_t timeout);
+
+/* 当前订阅者数量 */
+uint32_t audio_hub_subscribers(void);
+
+#endif /* __AUDIO_HUB_H__ */
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-21     AI Assistant first version - Speaker stream refill test
+ */
+
+/*
+ * 功放播放环形缓冲区测试：一个线程按16ms节奏调用 audio_playback_ring_fill，代替I2S DMA的半满/全满中断，
+ * 写入方写入递增序列，监视回调跳过静音后按序号校验L/R两路：
+ *   realtime  写入方每次写20ms、缓冲区满时阻塞，不能丢失或重复样本，不能欠载，最低水位（不计排空阶段）保持在一半以上，
+ *             半区间隔不超过16ms加误差，排空后返回
+ *   starved   写入方每30ms才写20ms数据，应统计到欠载，最低水位为0，数据仍按顺序送出
+ *   stall     填充线程在第10个半区后停顿100ms，缓冲区里有256ms数据，不应欠载，最大间隔应为116ms左右
+ * 不使用I2S和驱动的缓冲区，播放时也可以运行。
+ *
+ * 设备端：spk_ring_test [秒数]（realtime的时长，默认2秒）
+ * PC端（与设备端同一份audio_playback_ring.c和RT-Thread的ringbuffer.c）：
+ *   gcc -O2 -DAUDIO_PLAYBACK_BENCH_MAIN -I../host -I. audio_playback_ring.c audio_playback_bench.c \
+ *       ../rt-thread/components/drivers/ipc/ringbuffer.c -lpthread -o playback_bench
+ *   ./playback_bench 2
+ */
+
+#include <rtthread.h>
+#include <stdlib.h>
+#include "audio_playback_ring.h"
+
+/* 与 drv_audio_max98357a.h 中的 MAX98357A_DMA_FRAMES、MAX98357A_RING_SIZE 相同 */
+#define PLAY_BENCH_RATE         16000
+#define PLAY_BENCH_FRAMES       256     /* 每个半区的立体声帧数 (16ms) */
+#define PLAY_BENCH_RING_SIZE    (1024 * 8)
+#define PLAY_BENCH_HALF_MS      (PLAY_BENCH_FRAMES * 1000 / PLAY_BENCH_RATE)
+#define PLAY_BENCH_CHUNK        320     /* 每次写入的样本数（20ms），与TTS分片写入的粒度相近 */
+#define PLAY_BENCH_SLOW_MS      30      /* starved：每次写入后等待的时间 */
+#define PLAY_BENCH_STALL_AT     10      /* stall：在第几个半区后停顿 */
+#define PLAY_BENCH_STALL_MS     100
+#define PLAY_BENCH_SLACK        30      /* 间隔允许的误差（毫秒）*/
+
+static struct {
+    audio_playback_ring_t ring;
+    rt_uint8_t pool[PLAY_BENCH_RING_SIZE];
+    int16_t half[PLAY_BENCH_FRAMES * 2];
+    rt_bool_t ready;
+    rt_sem_t done;
+    volatile rt_bool_t dma_running;
+    uint32_t stall_at;      /* 0表示不停顿 */
+    volatile uint32_t next; /* 监视回调：下一个应送出的样本序号 */
+    volatile uint32_t errors;
+} play_bench;
+
+static int16_t play_bench_value(uint32_t index)
+{
+    return (int16_t)(index % 30000 + 1);
+}
+
+/* 监视回调：跳过补的静音，校验L/R相同且按序号递增 */
+static void play_bench_monitor(const int16_t *stereo, uint32_t frames)
+{
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        if (stereo[i * 2] == 0 && stereo[i * 2 + 1] == 0)
+        {
+            continue;
+        }
+
+        if (stereo[i * 2] != stereo[i * 2 + 1] ||
+            stereo[i * 2] != play_bench_value(play_bench.next))
+        {
+            play_bench.errors++;
+        }
+        play_bench.next++;
+    }
+}
+
+/* 模拟DMA：每个半区按截止时间填充，不累积延迟 */
+static void play_bench_dma(void *parameter)
+{
+    rt_tick_t next = rt_tick_get();
+    uint32_t halves = 0;
+
+    (void)parameter;
+    while (play_bench.dma_running)
+    {
+        rt_int32_t wait;
+
+        next += rt_tick_from_millisecond(PLAY_BENCH_HALF_MS);
+        if (play_bench.stall_at && halves == play_bench.stall_at)
+        {
+            next += rt_tick_from_millisecond(PLAY_BENCH_STALL_MS);
+        }
+        wait = (rt_int32_t)(next - rt_tick_get());
+        if (wait > 0)
+        {
+            rt_thread_mdelay(wait * 1000 / RT_TICK_PER_SECOND);
+        }
+
+        audio_playback_ring_fill(&play_bench.ring, play_bench.half, PLAY_BENCH_FRAMES);
+        halves++;
+    }
+
+    rt_sem_release(play_bench.done);
+}
+
+static rt_err_t play_bench_start(uint32_t stall_at)
+{
+    rt_thread_t thread;
+
+    play_bench.next = 0;
+    play_bench.errors = 0;
+    play_bench.stall_at = stall_at;
+    audio_playback_ring_start(&play_bench.ring);
+    play_bench.ring.monitor = play_bench_monitor;
+
+    play_bench.dma_running = RT_TRUE;
+    thread = rt_thread_create("spk_dma", play_bench_dma, RT_NULL, 2048, 5, 10);
+    if (thread == RT_NULL || rt_thread_startup(thread) != RT_EOK)
+    {
+        play_bench.dma_running = RT_FALSE;
+        rt_kprintf("Failed to start DMA thread\n");
+        return -RT_ERROR;
+    }
+    return RT_EOK;
+}
+
+/* 写入total个样本后排空，停止模拟DMA，返回排空结果 */
+static rt_err_t play_bench_feed(uint32_t total, uint32_t delay_ms)
+{
+    int16_t chunk[PLAY_BENCH_CHUNK];
+    uint32_t sent = 0;
+    rt_err_t drained;
+
+    while (sent < total)
+    {
+        uint32_t n = total - sent < PLAY_BENCH_CHUNK ? total - sent : PLAY_BENCH_CHUNK;
+
+        for (uint32_t i = 0; i < n; i++)
+        {
+            chunk[i] = play_bench_value(sent + i);
+        }
+        if (audio_playback_ring_write(&play_bench.ring, chunk, n, 1000) != (int)n)
+        {
+            rt_kprintf("Write timeout after %d samples\n", sent);
+            break;
+        }
+        sent += n;
+
+        if (delay_ms)
+        {
+            rt_thread_mdelay(delay_ms);
+        }
+    }
+
+    drained = audio_playback_ring_drain(&play_bench.ring, 1000);
+
+    play_bench.dma_running = RT_FALSE;
+    rt_sem_take(play_bench.done, RT_WAITING_FOREVER);
+    audio_playback_ring_stop(&play_bench.ring);
+    return drained;
+}
+
+static rt_bool_t play_bench_realtime(uint32_t seconds)
+{
+    uint32_t total = seconds * PLAY_BENCH_RATE;
+    audio_playback_stats_t *stats = &play_bench.ring.stats;
+    rt_err_t drained;
+    rt_bool_t ok;
+
+    if (play_bench_start(0) != RT_EOK)
+    {
+        return RT_FALSE;
+    }
+    drained = play_bench_feed(total, 0);
+
+    ok = play_bench.next == total && play_bench.errors == 0 && drained == RT_EOK &&
+         stats->underruns == 0 && stats->min_fill >= PLAY_BENCH_RING_SIZE / 2 &&
+         stats->max_interval_ms <= PLAY_BENCH_HALF_MS + PLAY_BENCH_SLACK;
+    rt_kprintf("realtime  samples %d/%d, errors %d, underruns %d, min fill %d/%d bytes, max interval %d ms, drain %s  %s\n",
+               play_bench.next, total, play_bench.errors, stats->underruns, stats->min_fill,
+               PLAY_BENCH_RING_SIZE, stats->max_interval_ms, drained == RT_EOK ? "ok" : "timeout",
+               ok ? "ok" : "FAIL");
+    return ok;
+}
+
+static rt_bool_t play_bench_starved(void)
+{
+    uint32_t total = PLAY_BENCH_RATE;
+    audio_playback_stats_t *stats = &play_bench.ring.stats;
+    rt_err_t drained;
+    rt_bool_t ok;
+
+    if (play_bench_start(0) != RT_EOK)
+    {
+        return RT_FALSE;
+    }
+    drained = play_bench_feed(total, PLAY_BENCH_SLOW_MS);
+
+    ok = play_bench.next == total && play_bench.errors == 0 && drained == RT_EOK &&
+         stats->underruns > 0 && stats->min_fill == 0;
+    rt_kprintf("starved   20 ms every %d ms: samples %d/%d, errors %d, underruns %d, min fill %d bytes, drain %s  %s\n",
+               PLAY_BENCH_SLOW_MS, play_bench.next, total, play_bench.errors, stats->underruns,
+               stats->min_fill, drained == RT_EOK ? "ok" : "timeout", ok ? "ok" : "FAIL");
+    return ok;
+}
+
+static rt_bool_t play_bench_stall(void)
+{
+    uint32_t total = PLAY_BENCH_RATE;
+    uint32_t expect = PLAY_BENCH_HALF_MS + PLAY_BENCH_STALL_MS;
+    audio_playback_stats_t *stats = &play_bench.ring.stats;
+    rt_err_t drained;
+    rt_bool_t ok;
+
+    if (play_bench_start(PLAY_BENCH_STALL_AT) != RT_EOK)
+    {
+        return RT_FALSE;
+    }
+    drained = play_bench_feed(total, 0);
+
+    ok = play_bench.next == total && play_bench.errors == 0 && drained == RT_EOK &&
+         stats->underruns == 0 &&
+         stats->max_interval_ms >= PLAY_BENCH_STALL_MS && stats->max_interval_ms <= expect + PLAY_BENCH_SLACK;
+    rt_kprintf("stall     %d ms after half %d: samples %d/%d, errors %d, underruns %d, max interval %d ms (expect %d)  %s\n",
+               PLAY_BENCH_STALL_MS, PLAY_BENCH_STALL_AT, play_bench.next, total, play_bench.errors,
+               stats->underruns, stats->max_interval_ms, expect, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+static int play_bench_main(uint32_t seconds)
+{
+    rt_bool_t ok = RT_TRUE;
+
+    if (!play_bench.ready)
+    {
+        play_bench.done = rt_sem_create("spk_dmad", 0, RT_IPC_FLAG_FIFO);
+        if (play_bench.done == RT_NULL ||
+            audio_playback_ring_init(&play_bench.ring, play_bench.pool, sizeof(play_bench.pool)) != RT_EOK)
+        {
+            return -1;
+        }
+        play_bench.ready = RT_TRUE;
+    }
+
+    rt_kprintf("Playback ring: %d bytes, %d frames x 2 halves, %d ms per half\n",
+               PLAY_BENCH_RING_SIZE, PLAY_BENCH_FRAMES, PLAY_BENCH_HALF_MS);
+
+    ok = play_bench_realtime(seconds) && ok;
+    ok = play_bench_starved() && ok;
+    ok = play_bench_stall() && ok;
+
+    rt_kprintf("Result: %s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : -1;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+#include <finsh.h>
+
+static int spk_ring_test(int argc, char **argv)
+{
+    return play_bench_main(argc > 1 ? atoi(argv[1]) : 2);
+}
+MSH_CMD_EXPORT(spk_ring_test, feed speaker playback ring through a simulated DMA thread: spk_ring_test [seconds]);
+#endif
+
+#ifdef AUDIO_PLAYBACK_BENCH_MAIN
+int main(int argc, char **argv)
+{
+    return play_bench_main(argc > 1 ? atoi(argv[1]) : 2) == 0 ? 0 : 1;
+}
+#endif
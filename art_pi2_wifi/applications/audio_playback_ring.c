@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-21     AI Assistant first version - Playback ring split out of the MAX98357A driver
+ */
+
+#include "audio_playback_ring.h"
+
+rt_err_t audio_playback_ring_init(audio_playback_ring_t *ring, rt_uint8_t *pool, rt_uint32_t size)
+{
+    rt_memset(ring, 0, sizeof(*ring));
+    rt_ringbuffer_init(&ring->rb, pool, size);
+    ring->space_sem = rt_sem_create("spk_space", 0, RT_IPC_FLAG_FIFO);
+    ring->drain_sem = rt_sem_create("spk_drain", 0, RT_IPC_FLAG_FIFO);
+
+    return (ring->space_sem == RT_NULL || ring->drain_sem == RT_NULL) ? -RT_ENOMEM : RT_EOK;
+}
+
+void audio_playback_ring_start(audio_playback_ring_t *ring)
+{
+    rt_ringbuffer_reset(&ring->rb);
+    rt_sem_control(ring->space_sem, RT_IPC_CMD_RESET, RT_NULL);
+    rt_sem_control(ring->drain_sem, RT_IPC_CMD_RESET, RT_NULL);
+    rt_memset(&ring->stats, 0, sizeof(ring->stats));
+    ring->stats.min_fill = rt_ringbuffer_get_size(&ring->rb);
+    ring->active = RT_FALSE;
+    ring->draining = RT_FALSE;
+    ring->empty_halves = 0;
+    ring->last_tick = 0;
+    ring->running = RT_TRUE;
+}
+
+/* 丢弃未播放的数据，唤醒阻塞在写入或排空中的线程 */
+void audio_playback_ring_stop(audio_playback_ring_t *ring)
+{
+    ring->running = RT_FALSE;
+    ring->active = RT_FALSE;
+    ring->draining = RT_FALSE;
+    rt_ringbuffer_reset(&ring->rb);
+
+    rt_sem_release(ring->space_sem);
+    rt_sem_release(ring->drain_sem);
+}
+
+/* 中断栈较小，先把单声道数据读到半区后部，再原地展开成立体声 */
+void audio_playback_ring_fill(audio_playback_ring_t *ring, int16_t *stereo, uint32_t frames)
+{
+    int16_t *mono = stereo + frames;
+    rt_tick_t now = rt_tick_get();
+    uint32_t got;
+    uint32_t fill;
+    uint32_t i;
+
+    got = rt_ringbuffer_get(&ring->rb, (rt_uint8_t *)mono, frames * sizeof(int16_t)) / sizeof(int16_t);
+
+    /* 写位置 2i+1 始终不超过读位置 frames+i，正向展开不会覆盖未读数据 */
+    for (i = 0; i < got; i++)
+    {
+        int16_t sample = mono[i];
+        stereo[i * 2] = sample;
+        stereo[i * 2 + 1] = sample;
+    }
+    rt_memset(&stereo[got * 2], 0, (frames - got) * 2 * sizeof(int16_t));
+
+    ring->stats.halves++;
+    if (ring->last_tick != 0 && now - ring->last_tick > ring->stats.max_interval_ms)
+    {
+        ring->stats.max_interval_ms = now - ring->last_tick;
+    }
+    ring->last_tick = now;
+
+    /* 排空阶段缓冲区本来就会取空，最后一段数据不足一个半区也属于正常结束 */
+    if (ring->active && !ring->draining)
+    {
+        if (got < frames)
+        {
+            ring->stats.underruns++;
+        }
+
+        fill = rt_ringbuffer_data_len(&ring->rb);
+        if (fill < ring->stats.min_fill)
+        {
+            ring->stats.min_fill = fill;
+        }
+    }
+
+    if (got > 0)
+    {
+        if (ring->stats.first_data_tick == 0)
+        {
+            ring->stats.first_data_tick = now;
+        }
+        ring->empty_halves = 0;
+        rt_sem_release(ring->space_sem);
+    }
+    else if (ring->draining && ++ring->empty_halves >= 2)
+    {
+        /* 连续两个静音半区：最后一个数据半区已经完整送出 */
+        ring->active = RT_FALSE;
+        ring->draining = RT_FALSE;
+        rt_sem_release(ring->drain_sem);
+    }
+
+    if (ring->monitor)
+    {
+        ring->monitor(stereo, frames);
+    }
+}
+
+int audio_playback_ring_write(audio_playback_ring_t *ring, const int16_t *pcm, uint32_t samples, rt_int32_t timeout)
+{
+    const rt_uint8_t *data = (const rt_uint8_t *)pcm;
+    rt_size_t total = samples * sizeof(int16_t);
+    rt_size_t written = 0;
+    rt_tick_t deadline = rt_tick_get() + rt_tick_from_millisecond(timeout);
+
+    if (pcm == RT_NULL)
+    {
+        return -RT_EINVAL;
+    }
+
+    if (!ring->running)
+    {
+        return -RT_ERROR;
+    }
+
+    while (written < total)
+    {
+        rt_tick_t now;
+        rt_size_t n;
+
+        /* 写入奇数字节会让消费者错位，缓冲区容量为偶数，空闲空间也总是偶数 */
+        n = rt_ringbuffer_put(&ring->rb, data + written, total - written);
+        if (n > 0)
+        {
+            written += n;
+            ring->draining = RT_FALSE;
+            ring->active = RT_TRUE;
+            continue;
+        }
+
+        now = rt_tick_get();
+        if (!ring->running)
+        {
+            break;
+        }
+
+        if (timeout == RT_WAITING_FOREVER)
+        {
+            rt_sem_take(ring->space_sem, RT_WAITING_FOREVER);
+        }
+        else if ((rt_int32_t)(deadline - now) <= 0 ||
+                 rt_sem_take(ring->space_sem, deadline - now) != RT_EOK)
+        {
+            break;
+        }
+    }
+
+    return written / sizeof(int16_t);
+}
+
+rt_err_t audio_playback_ring_drain(audio_playback_ring_t *ring, rt_int32_t timeout)
+{
+    if (!ring->running)
+    {
+        return -RT_ERROR;
+    }
+
+    if (!ring->active)
+    {
+        return RT_EOK;
+    }
+
+    rt_sem_control(ring->drain_sem, RT_IPC_CMD_RESET, RT_NULL);
+    ring->draining = RT_TRUE;
+
+    if (rt_sem_take(ring->drain_sem, timeout == RT_WAITING_FOREVER ?
+                    RT_WAITING_FOREVER : rt_tick_from_millisecond(timeout)) != RT_EOK)
+    {
+        return -RT_ETIMEOUT;
+    }
+
+    return ring->running ? RT_EOK : -RT_ERROR;
+}
+
+uint32_t audio_playback_ring_free(audio_playback_ring_t *ring)
+{
+    return rt_ringbuffer_space_len(&ring->rb) / sizeof(int16_t);
+}
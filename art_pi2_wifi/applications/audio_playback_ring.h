@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-21     AI Assistant first version - Playback ring split out of the MAX98357A driver
+ */
+
+#ifndef __AUDIO_PLAYBACK_RING_H__
+#define __AUDIO_PLAYBACK_RING_H__
+
+/*
+ * 功放播放环形缓冲区：写入线程单生产者，I2S DMA半满/全满中断单消费者。
+ *   - 生产者写入16bit单声道PCM，缓冲区满时在信号量上等待
+ *   - 中断每次取出一个半区的数据，复制成L/R两路；数据不足时补静音并计为一次欠载
+ *   - 排空时等到连续两个静音半区，保证最后一个数据半区已经完整送出
+ * 不依赖HAL，PC上可以编译（见 audio_playback_bench.c）。
+ */
+
+#include <rtthread.h>
+#include <rtdevice.h>
+
+/* 播放统计 */
+typedef struct {
+    uint32_t halves;            /* 已填充的半缓冲区数 */
+    uint32_t underruns;         /* 播放中数据不足、补静音的半缓冲区数 */
+    uint32_t min_fill;          /* 播放中环形缓冲区的最低水位 (字节) */
+    uint32_t max_interval_ms;   /* 相邻两次半缓冲区回调的最大间隔 */
+    rt_tick_t first_data_tick;  /* 第一个含数据的半缓冲区被填充的时刻，0表示尚无数据 */
+} audio_playback_stats_t;
+
+/* 监视回调：每填充一个半缓冲区调用一次 (中断上下文)，用于测试 */
+typedef void (*audio_playback_monitor_t)(const int16_t *stereo, uint32_t frames);
+
+typedef struct {
+    struct rt_ringbuffer rb;
+    rt_sem_t space_sem;             /* 环形缓冲区腾出空间 */
+    rt_sem_t drain_sem;             /* 最后一个数据半区播放完毕 */
+    volatile rt_bool_t running;
+    volatile rt_bool_t active;      /* 已写入数据，尚未排空 */
+    volatile rt_bool_t draining;
+    uint32_t empty_halves;          /* 排空阶段连续填充静音的半区数 */
+    rt_tick_t last_tick;
+    audio_playback_monitor_t monitor;
+    audio_playback_stats_t stats;
+} audio_playback_ring_t;
+
+rt_err_t audio_playback_ring_init(audio_playback_ring_t *ring, rt_uint8_t *pool, rt_uint32_t size);
+void audio_playback_ring_start(audio_playback_ring_t *ring);
+void audio_playback_ring_stop(audio_playback_ring_t *ring);
+
+/* 填充一个半区 (中断上下文)：stereo 为 frames 个L/R交替的立体声帧 */
+void audio_playback_ring_fill(audio_playback_ring_t *ring, int16_t *stereo, uint32_t frames);
+
+/* 写入单声道PCM：缓冲区满时阻塞，返回实际写入的样本数 */
+int audio_playback_ring_write(audio_playback_ring_t *ring, const int16_t *pcm, uint32_t samples, rt_int32_t timeout);
+
+/* 等待已写入的数据全部送出 */
+rt_err_t audio_playback_ring_drain(audio_playback_ring_t *ring, rt_int32_t timeout);
+
+/* 环形缓冲区空闲的样本数 */
+uint32_t audio_playback_ring_free(audio_playback_ring_t *ring);
+
+#endif /* __AUDIO_PLAYBACK_RING_H__ */
@@ -6,87 +6,266 @@
  * Change Logs:
  * Date           Author       Notes
  * 2024-10-16     AI Assistant first version - Audio Player Implementation
+ * 2024-10-27     AI Assistant Resample PCM at other sample rates to the speaker rate
+ * 2024-10-27     AI Assistant Add software volume
+ * 2024-10-27     AI Assistant Add latency trace points for playback
  */
 
 #include <rtthread.h>
 #include <rtdevice.h>
+#include <stdlib.h>
 #include <math.h>
 #include "audio_player.h"
+#include "drv_audio_max98357a.h"
+#include "audio_resampler.h"
+#include "memory_helper.h"
+#include "ai_trace.h"
 
 #define DBG_TAG "audio.player"
 #define DBG_LVL DBG_INFO
 #include <rtdbg.h>
 
+#define AUDIO_PLAY_GAIN_UNITY   32768   /* Q15增益1.0 */
+
 /* 音频播放控制结构 */
 static struct {
-    audio_player_state_t state;
-    rt_device_t dac_dev;
+    volatile audio_player_state_t state;
     rt_thread_t player_thread;
     rt_mutex_t lock;
-    rt_sem_t sem;
+    rt_sem_t sem;                   /* 播放线程退出 */
+    rt_bool_t streaming;            /* 由调用者线程直接写入扬声器流 */
     audio_player_callback callback;
-    uint8_t buffer[AUDIO_PLAY_BUFFER_SIZE];
+    uint8_t *buffer;
     uint32_t buffer_size;
-    uint32_t buffer_pos;
+    volatile uint32_t buffer_pos;
+    uint32_t sample_rate;           /* 输入PCM的采样率，与功放不同时经过重采样 */
+    rt_bool_t resample;
+    uint32_t volume;
+    volatile uint32_t gain;         /* Q15，由音量换算 */
+    int16_t vol_out[AUDIO_PLAY_CHUNK_SAMPLES];
+#if AUDIO_RS_ENABLE
+    audio_rs_t *rs;                 /* 第一次需要时分配，之后复用 */
+    int16_t rs_out[AUDIO_PLAY_CHUNK_SAMPLES];
+#endif
 } audio_player_ctrl = {
     .state = AUDIO_PLAYER_IDLE,
-    .dac_dev = RT_NULL,
     .player_thread = RT_NULL,
     .lock = RT_NULL,
     .sem = RT_NULL,
+    .streaming = RT_FALSE,
     .callback = RT_NULL,
+    .buffer = RT_NULL,
     .buffer_size = 0,
-    .buffer_pos = 0
+    .buffer_pos = 0,
+    .sample_rate = AUDIO_PLAY_SAMPLE_RATE,
+    .resample = RT_FALSE,
+    .volume = AUDIO_PLAY_VOLUME_DEFAULT,
+    .gain = AUDIO_PLAY_GAIN_UNITY * AUDIO_PLAY_VOLUME_DEFAULT / 100 * AUDIO_PLAY_VOLUME_DEFAULT / 100
 };
 
-/* 音频播放线程 */
-static void audio_player_thread_entry(void *parameter)
+/* 设置输入采样率：与功放相同时直通，否则准备重采样器（同一采样率的滤波器组不重复生成）*/
+static int audio_player_setup_rate(uint32_t sample_rate)
 {
-    uint16_t dac_value;
+    if (sample_rate == 0)
+    {
+        sample_rate = AUDIO_PLAY_SAMPLE_RATE;
+    }
     
-    LOG_I("Audio player thread started");
+    audio_player_ctrl.resample = RT_FALSE;
+    audio_player_ctrl.sample_rate = sample_rate;
+    if (sample_rate == AUDIO_PLAY_SAMPLE_RATE)
+    {
+        return RT_EOK;
+    }
+    
+#if AUDIO_RS_ENABLE
+    /* 滤波器点积是热点，放在片内SRAM */
+    if (audio_player_ctrl.rs == RT_NULL)
+    {
+        audio_player_ctrl.rs = (audio_rs_t *)mem_class_alloc(MEM_CLASS_FAST, sizeof(audio_rs_t));
+        if (audio_player_ctrl.rs == RT_NULL)
+        {
+            LOG_E("No memory for resampler (%d bytes)", sizeof(audio_rs_t));
+            return -RT_ENOMEM;
+        }
+        audio_player_ctrl.rs->in_rate = 0;
+    }
+    
+    if (audio_player_ctrl.rs->in_rate != sample_rate ||
+        audio_player_ctrl.rs->out_rate != AUDIO_PLAY_SAMPLE_RATE)
+    {
+        if (audio_rs_init(audio_player_ctrl.rs, sample_rate, AUDIO_PLAY_SAMPLE_RATE) != 0)
+        {
+            audio_player_ctrl.rs->in_rate = 0;
+            LOG_W("Unsupported sample rate %d Hz, playing at %d Hz", sample_rate, AUDIO_PLAY_SAMPLE_RATE);
+            return -RT_EINVAL;
+        }
+    }
+    else
+    {
+        audio_rs_reset(audio_player_ctrl.rs);
+    }
+    
+    audio_player_ctrl.resample = RT_TRUE;
+    LOG_I("Resampling %d Hz -> %d Hz", sample_rate, AUDIO_PLAY_SAMPLE_RATE);
+    return RT_EOK;
+#else
+    LOG_W("Resampler disabled (needs CMSIS-DSP), playing %d Hz audio at %d Hz",
+          sample_rate, AUDIO_PLAY_SAMPLE_RATE);
+    return -RT_ENOSYS;
+#endif
+}
+
+/* 按音量缩放后写入扬声器流（count不超过 AUDIO_PLAY_CHUNK_SAMPLES），音量为100时直接写入 */
+static int audio_player_write(const int16_t *pcm, uint32_t count)
+{
+    int32_t gain = (int32_t)audio_player_ctrl.gain;
+    
+    if (gain < AUDIO_PLAY_GAIN_UNITY)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            audio_player_ctrl.vol_out[i] = (int16_t)((pcm[i] * gain) >> 15);
+        }
+        pcm = audio_player_ctrl.vol_out;
+    }
     
-    while (audio_player_ctrl.state == AUDIO_PLAYER_PLAYING)
+    return max98357a_stream_write(pcm, count, AUDIO_PLAY_WRITE_TIMEOUT) == (int)count ?
+           RT_EOK : -RT_ERROR;
+}
+
+/* 写入扬声器流，需要时先重采样；全部写入返回RT_EOK，超时或流被停止返回错误 */
+static int audio_player_output(const int16_t *pcm, uint32_t count)
+{
+#if AUDIO_RS_ENABLE
+    if (audio_player_ctrl.resample)
     {
-        rt_mutex_take(audio_player_ctrl.lock, RT_WAITING_FOREVER);
+        uint32_t pos = 0;
+        uint32_t used, n;
         
-        /* 检查是否还有数据需要播放 */
-        if (audio_player_ctrl.buffer_pos < audio_player_ctrl.buffer_size)
+        /* 输出缓冲区满时可能还有未取出的样本，直到输入读完且输出未满 */
+        do
         {
-            /* 从缓冲区读取16位音频数据 */
-            dac_value = (audio_player_ctrl.buffer[audio_player_ctrl.buffer_pos] << 8) |
-                        audio_player_ctrl.buffer[audio_player_ctrl.buffer_pos + 1];
-            audio_player_ctrl.buffer_pos += 2;
-            
-            /* 写入DAC设备 */
-            if (audio_player_ctrl.dac_dev)
+            n = audio_rs_process(audio_player_ctrl.rs, &pcm[pos], count - pos, &used,
+                                 audio_player_ctrl.rs_out, AUDIO_PLAY_CHUNK_SAMPLES);
+            pos += used;
+            if (n > 0 && audio_player_write(audio_player_ctrl.rs_out, n) != RT_EOK)
             {
-                rt_device_write(audio_player_ctrl.dac_dev, 0, &dac_value, sizeof(dac_value));
+                return -RT_ERROR;
             }
-            
-            rt_mutex_release(audio_player_ctrl.lock);
-            
-            /* 根据采样率延时 */
-            rt_thread_mdelay(1000 / AUDIO_PLAY_SAMPLE_RATE);
+        } while (pos < count || n == AUDIO_PLAY_CHUNK_SAMPLES);
+        
+        return RT_EOK;
+    }
+#endif
+    
+    return audio_player_write(pcm, count);
+}
+
+/* 一段音频结束：推出重采样滤波器中剩余的样本 */
+static int audio_player_output_flush(void)
+{
+#if AUDIO_RS_ENABLE
+    uint32_t n;
+    
+    if (!audio_player_ctrl.resample)
+    {
+        return RT_EOK;
+    }
+    
+    do
+    {
+        n = audio_rs_flush(audio_player_ctrl.rs, audio_player_ctrl.rs_out, AUDIO_PLAY_CHUNK_SAMPLES);
+        if (n > 0 && audio_player_write(audio_player_ctrl.rs_out, n) != RT_EOK)
+        {
+            audio_rs_reset(audio_player_ctrl.rs);
+            return -RT_ERROR;
         }
-        else
+    } while (n == AUDIO_PLAY_CHUNK_SAMPLES);
+#endif
+    
+    return RT_EOK;
+}
+
+/* 音频播放线程：按块写入扬声器流，写满时阻塞，由DMA中断按采样率取走 */
+static void audio_player_thread_entry(void *parameter)
+{
+    const int16_t *pcm = (const int16_t *)audio_player_ctrl.buffer;
+    uint32_t total = audio_player_ctrl.buffer_size / sizeof(int16_t);
+    uint32_t pos = 0;
+    rt_bool_t completed;
+    max98357a_stream_stats_t stats;
+    
+    LOG_I("Audio player thread started");
+    AI_TRACE_BEGIN("play");
+    
+    while (pos < total && audio_player_ctrl.state != AUDIO_PLAYER_STOPPED)
+    {
+        uint32_t count = total - pos;
+        
+        if (audio_player_ctrl.state == AUDIO_PLAYER_PAUSED)
+        {
+            /* 暂停时先播完已缓冲的数据，之后输出的静音不计为欠载 */
+            max98357a_stream_drain(RT_WAITING_FOREVER);
+            rt_thread_mdelay(20);
+            continue;
+        }
+        
+        if (count > AUDIO_PLAY_CHUNK_SAMPLES)
         {
-            /* 播放完成 */
-            audio_player_ctrl.state = AUDIO_PLAYER_IDLE;
-            audio_player_ctrl.buffer_size = 0;
-            audio_player_ctrl.buffer_pos = 0;
-            
-            rt_mutex_release(audio_player_ctrl.lock);
-            
-            /* 触发播放完成回调 */
-            if (audio_player_ctrl.callback)
+            count = AUDIO_PLAY_CHUNK_SAMPLES;
+        }
+        
+        if (audio_player_output(&pcm[pos], count) != RT_EOK)
+        {
+            if (audio_player_ctrl.state != AUDIO_PLAYER_STOPPED)
             {
-                audio_player_ctrl.callback();
+                LOG_W("Speaker stream write failed at %d/%d samples", pos, total);
             }
-            
-            LOG_I("Audio playback completed");
             break;
         }
+        
+        pos += count;
+        audio_player_ctrl.buffer_pos = pos * sizeof(int16_t);
+    }
+    
+    /* 等待重采样器、环形缓冲区和DMA半区中的数据播完 */
+    if (pos == total && audio_player_ctrl.state == AUDIO_PLAYER_PLAYING &&
+        audio_player_output_flush() == RT_EOK)
+    {
+        max98357a_stream_drain(AUDIO_PLAY_WRITE_TIMEOUT);
+    }
+    
+    max98357a_stream_get_stats(&stats);
+    max98357a_stream_stop();
+    
+    rt_mutex_take(audio_player_ctrl.lock, RT_WAITING_FOREVER);
+    completed = (pos == total && audio_player_ctrl.state == AUDIO_PLAYER_PLAYING);
+    mem_class_free(audio_player_ctrl.buffer);
+    audio_player_ctrl.buffer = RT_NULL;
+    audio_player_ctrl.buffer_size = 0;
+    audio_player_ctrl.buffer_pos = 0;
+    audio_player_ctrl.state = AUDIO_PLAYER_IDLE;
+    audio_player_ctrl.player_thread = RT_NULL;
+    rt_mutex_release(audio_player_ctrl.lock);
+    
+    rt_sem_release(audio_player_ctrl.sem);
+    
+    AI_TRACE_END("play", pos * sizeof(int16_t));
+    AI_TRACE_COUNTER("play underruns", stats.underruns);
+    if (stats.underruns > 0)
+    {
+        LOG_W("Playback underruns: %d (min fill %d bytes)", stats.underruns, stats.min_fill);
+    }
+    
+    /* 触发播放完成回调 */
+    if (completed)
+    {
+        LOG_I("Audio playback completed");
+        if (audio_player_ctrl.callback)
+        {
+            audio_player_ctrl.callback();
+        }
     }
     
     LOG_I("Audio player thread stopped");
@@ -115,25 +294,10 @@ int audio_player_init(void)
     {
         LOG_E("Failed to create player semaphore");
         rt_mutex_delete(audio_player_ctrl.lock);
+        audio_player_ctrl.lock = RT_NULL;
         return -RT_ERROR;
     }
     
-    /* 查找并打开DAC设备（如果存在）*/
-    /* 注意：需要根据实际硬件配置DAC设备名称 */
-    audio_player_ctrl.dac_dev = rt_device_find("dac1");
-    if (audio_player_ctrl.dac_dev)
-    {
-        if (rt_device_open(audio_player_ctrl.dac_dev, RT_DEVICE_OFLAG_WRONLY) != RT_EOK)
-        {
-            LOG_W("Failed to open DAC device, audio output disabled");
-            audio_player_ctrl.dac_dev = RT_NULL;
-        }
-    }
-    else
-    {
-        LOG_W("DAC device not found, audio output disabled");
-    }
-    
     audio_player_ctrl.state = AUDIO_PLAYER_IDLE;
     
     LOG_I("Audio player initialized (Sample rate: %d Hz, Channels: %d, Bits: %d)",
@@ -142,8 +306,14 @@ int audio_player_init(void)
     return RT_EOK;
 }
 
-/* 播放音频数据 */
+/* 播放16kHz音频数据 */
 int audio_player_play(const uint8_t *data, uint32_t size)
+{
+    return audio_player_play_rate(data, size, AUDIO_PLAY_SAMPLE_RATE);
+}
+
+/* 播放指定采样率的音频数据 */
+int audio_player_play_rate(const uint8_t *data, uint32_t size, uint32_t sample_rate)
 {
     if (audio_player_ctrl.lock == RT_NULL)
     {
@@ -151,34 +321,42 @@ int audio_player_play(const uint8_t *data, uint32_t size)
         return -RT_ERROR;
     }
     
-    if (data == RT_NULL || size == 0)
+    if (data == RT_NULL || size < sizeof(int16_t))
     {
         LOG_E("Invalid audio data");
         return -RT_EINVAL;
     }
     
-    if (size > AUDIO_PLAY_BUFFER_SIZE)
-    {
-        LOG_W("Audio data too large, will be truncated");
-        size = AUDIO_PLAY_BUFFER_SIZE;
-    }
-    
     /* 如果正在播放，先停止 */
-    if (audio_player_ctrl.state == AUDIO_PLAYER_PLAYING)
-    {
-        audio_player_stop();
-        rt_thread_mdelay(100);
-    }
+    audio_player_stop();
     
     rt_mutex_take(audio_player_ctrl.lock, RT_WAITING_FOREVER);
     
-    /* 拷贝音频数据到缓冲区 */
+    /* 拷贝音频数据，调用者可以立即释放自己的缓冲区；播放线程逐块拷进扬声器流，放在PSRAM即可 */
+    audio_player_ctrl.buffer = (uint8_t *)mem_class_alloc(MEM_CLASS_BULK, size);
+    if (audio_player_ctrl.buffer == RT_NULL)
+    {
+        rt_mutex_release(audio_player_ctrl.lock);
+        LOG_E("No memory for audio data (%d bytes)", size);
+        return -RT_ENOMEM;
+    }
     rt_memcpy(audio_player_ctrl.buffer, data, size);
-    audio_player_ctrl.buffer_size = size;
+    audio_player_ctrl.buffer_size = size & ~1U;
     audio_player_ctrl.buffer_pos = 0;
-    audio_player_ctrl.state = AUDIO_PLAYER_PLAYING;
+    audio_player_setup_rate(sample_rate);
     
-    rt_mutex_release(audio_player_ctrl.lock);
+    if (max98357a_stream_start(MAX98357A_BACKEND_I2S) != RT_EOK)
+    {
+        mem_class_free(audio_player_ctrl.buffer);
+        audio_player_ctrl.buffer = RT_NULL;
+        audio_player_ctrl.buffer_size = 0;
+        rt_mutex_release(audio_player_ctrl.lock);
+        LOG_E("Failed to start speaker stream");
+        return -RT_ERROR;
+    }
+    
+    rt_sem_control(audio_player_ctrl.sem, RT_IPC_CMD_RESET, RT_NULL);
+    audio_player_ctrl.state = AUDIO_PLAYER_PLAYING;
     
     /* 创建播放线程 */
     audio_player_ctrl.player_thread = rt_thread_create("audio_play",
@@ -190,10 +368,16 @@ int audio_player_play(const uint8_t *data, uint32_t size)
     if (audio_player_ctrl.player_thread == RT_NULL)
     {
         LOG_E("Failed to create audio player thread");
+        max98357a_stream_stop();
+        mem_class_free(audio_player_ctrl.buffer);
+        audio_player_ctrl.buffer = RT_NULL;
+        audio_player_ctrl.buffer_size = 0;
         audio_player_ctrl.state = AUDIO_PLAYER_IDLE;
+        rt_mutex_release(audio_player_ctrl.lock);
         return -RT_ERROR;
     }
     
+    rt_mutex_release(audio_player_ctrl.lock);
     rt_thread_startup(audio_player_ctrl.player_thread);
     
     LOG_I("Audio playback started (size: %d bytes)", size);
@@ -228,31 +412,206 @@ int audio_player_resume(void)
 /* 停止播放 */
 int audio_player_stop(void)
 {
-    if (audio_player_ctrl.state == AUDIO_PLAYER_IDLE)
+    if (audio_player_ctrl.streaming)
+    {
+        /* 写入线程会在下一次写入时收到错误，由它调用 audio_player_stream_end */
+        audio_player_ctrl.state = AUDIO_PLAYER_STOPPED;
+        max98357a_stream_stop();
+        return RT_EOK;
+    }
+    
+    if (audio_player_ctrl.player_thread == RT_NULL)
     {
         return RT_EOK;
     }
     
     audio_player_ctrl.state = AUDIO_PLAYER_STOPPED;
     
+    /* 停止扬声器流会唤醒阻塞在写入或排空中的播放线程 */
+    max98357a_stream_stop();
+    
     /* 等待线程结束 */
-    if (audio_player_ctrl.player_thread)
+    if (rt_sem_take(audio_player_ctrl.sem, rt_tick_from_millisecond(AUDIO_PLAY_WRITE_TIMEOUT)) != RT_EOK)
     {
-        rt_thread_mdelay(100);
-        audio_player_ctrl.player_thread = RT_NULL;
+        LOG_W("Audio player thread exit timeout");
+        return -RT_ETIMEOUT;
     }
     
+    LOG_I("Audio playback stopped");
+    
+    return RT_EOK;
+}
+
+/* 开始流式播放：停止当前播放并启动扬声器流 */
+int audio_player_stream_begin(void)
+{
+    if (audio_player_ctrl.lock == RT_NULL)
+    {
+        LOG_E("Audio player not initialized");
+        return -RT_ERROR;
+    }
+    
+    audio_player_stop();
+    
     rt_mutex_take(audio_player_ctrl.lock, RT_WAITING_FOREVER);
-    audio_player_ctrl.buffer_size = 0;
+    if (max98357a_stream_start(MAX98357A_BACKEND_I2S) != RT_EOK)
+    {
+        rt_mutex_release(audio_player_ctrl.lock);
+        LOG_E("Failed to start speaker stream");
+        return -RT_ERROR;
+    }
+    audio_player_ctrl.streaming = RT_TRUE;
+    audio_player_ctrl.buffer_pos = 0;
+    audio_player_ctrl.state = AUDIO_PLAYER_PLAYING;
+    audio_player_setup_rate(AUDIO_PLAY_SAMPLE_RATE);
+    rt_mutex_release(audio_player_ctrl.lock);
+    AI_TRACE_INSTANT("play stream begin", 0);
+    
+    return RT_EOK;
+}
+
+/* 设置之后写入的PCM的采样率；与当前相同时不做任何事，不同时先推出上一段的剩余样本 */
+int audio_player_stream_set_rate(uint32_t sample_rate)
+{
+    if (!audio_player_ctrl.streaming)
+    {
+        return -RT_ERROR;
+    }
+    
+    if (sample_rate == 0)
+    {
+        sample_rate = AUDIO_PLAY_SAMPLE_RATE;
+    }
+    if (sample_rate == audio_player_ctrl.sample_rate)
+    {
+        return RT_EOK;
+    }
+    
+    if (audio_player_output_flush() != RT_EOK)
+    {
+        return -RT_ERROR;
+    }
+    
+    /* 不支持的采样率已记录警告，按16kHz继续播放 */
+    audio_player_setup_rate(sample_rate);
+    return RT_EOK;
+}
+
+/* 流式写入16bit小端PCM，size须为偶数；播放被停止时返回错误，调用者应中止数据源
+ * 数据按块写入，整段音频（如一句TTS）较长时每块仍有独立的超时 */
+int audio_player_stream_write(const uint8_t *data, uint32_t size)
+{
+    const int16_t *pcm = (const int16_t *)data;
+    uint32_t samples = size / sizeof(int16_t);
+    uint32_t pos = 0;
+    uint32_t count;
+    
+    if (!audio_player_ctrl.streaming)
+    {
+        return -RT_ERROR;
+    }
+    
+    /* 扬声器流写满时阻塞，时间段的长度反映播放速度对数据源的反压 */
+    AI_TRACE_BEGIN("play write");
+    while (pos < samples)
+    {
+        while (audio_player_ctrl.state == AUDIO_PLAYER_PAUSED)
+        {
+            max98357a_stream_drain(RT_WAITING_FOREVER);
+            rt_thread_mdelay(20);
+        }
+        
+        if (audio_player_ctrl.state != AUDIO_PLAYER_PLAYING)
+        {
+            AI_TRACE_END("play write", pos * sizeof(int16_t));
+            return -RT_ERROR;
+        }
+        
+        count = samples - pos;
+        if (count > AUDIO_PLAY_CHUNK_SAMPLES)
+        {
+            count = AUDIO_PLAY_CHUNK_SAMPLES;
+        }
+        
+        if (audio_player_output(&pcm[pos], count) != RT_EOK)
+        {
+            LOG_W("Speaker stream write failed at %d/%d samples", pos, samples);
+            AI_TRACE_END("play write", pos * sizeof(int16_t));
+            return -RT_ERROR;
+        }
+        
+        pos += count;
+        audio_player_ctrl.buffer_pos += count * sizeof(int16_t);
+    }
+    AI_TRACE_END("play write", size);
+    
+    return RT_EOK;
+}
+
+/* 结束流式播放：等待已写入的数据播完后停止扬声器流 */
+int audio_player_stream_end(void)
+{
+    max98357a_stream_stats_t stats;
+    rt_bool_t completed;
+    
+    if (!audio_player_ctrl.streaming)
+    {
+        return -RT_ERROR;
+    }
+    
+    /* 等待已写入的数据播完 */
+    AI_TRACE_BEGIN("play drain");
+    if (audio_player_ctrl.state == AUDIO_PLAYER_PLAYING &&
+        audio_player_output_flush() == RT_EOK)
+    {
+        max98357a_stream_drain(AUDIO_PLAY_WRITE_TIMEOUT);
+    }
+    AI_TRACE_END("play drain", 0);
+    
+    max98357a_stream_get_stats(&stats);
+    max98357a_stream_stop();
+    AI_TRACE_COUNTER("play underruns", stats.underruns);
+    
+    rt_mutex_take(audio_player_ctrl.lock, RT_WAITING_FOREVER);
+    completed = (audio_player_ctrl.state == AUDIO_PLAYER_PLAYING);
+    audio_player_ctrl.streaming = RT_FALSE;
     audio_player_ctrl.buffer_pos = 0;
     audio_player_ctrl.state = AUDIO_PLAYER_IDLE;
     rt_mutex_release(audio_player_ctrl.lock);
     
-    LOG_I("Audio playback stopped");
+    if (stats.underruns > 0)
+    {
+        LOG_W("Playback underruns: %d (min fill %d bytes)", stats.underruns, stats.min_fill);
+    }
+    
+    if (completed && audio_player_ctrl.callback)
+    {
+        audio_player_ctrl.callback();
+    }
+    
+    return completed ? RT_EOK : -RT_ERROR;
+}
+
+/* 设置音量 (0~100)：增益按音量的平方换算，听感上每一级的变化接近均匀 */
+int audio_player_set_volume(uint32_t volume)
+{
+    if (volume > 100)
+    {
+        volume = 100;
+    }
+    
+    audio_player_ctrl.volume = volume;
+    audio_player_ctrl.gain = AUDIO_PLAY_GAIN_UNITY * volume / 100 * volume / 100;
+    LOG_I("Volume: %d", volume);
     
     return RT_EOK;
 }
 
+uint32_t audio_player_get_volume(void)
+{
+    return audio_player_ctrl.volume;
+}
+
 /* 设置播放完成回调 */
 int audio_player_set_callback(audio_player_callback callback)
 {
@@ -266,19 +625,10 @@ audio_player_state_t audio_player_get_state(void)
     return audio_player_ctrl.state;
 }
 
-/* 获取空闲缓冲区大小 */
+/* 获取扬声器流环形缓冲区的空闲字节数 */
 int audio_player_get_free_space(void)
 {
-    if (audio_player_ctrl.state == AUDIO_PLAYER_IDLE)
-    {
-        return AUDIO_PLAY_BUFFER_SIZE;
-    }
-    
-    rt_mutex_take(audio_player_ctrl.lock, RT_WAITING_FOREVER);
-    int free_space = AUDIO_PLAY_BUFFER_SIZE - audio_player_ctrl.buffer_size;
-    rt_mutex_release(audio_player_ctrl.lock);
-    
-    return free_space;
+    return max98357a_stream_free() * sizeof(int16_t);
 }
 
 /* 导出MSH命令 */
@@ -287,7 +637,7 @@ static int cmd_audio_player_test(int argc, char **argv)
 {
     if (argc < 2)
     {
-        rt_kprintf("Usage: audio_play [init|start|stop|status]\n");
+        rt_kprintf("Usage: audio_play [init|start|stop|status|volume [0-100]]\n");
         return -1;
     }
     
@@ -297,24 +647,49 @@ static int cmd_audio_player_test(int argc, char **argv)
     }
     else if (strcmp(argv[1], "start") == 0)
     {
-        /* 生成测试音频数据（1秒的440Hz正弦波）*/
-        static uint8_t test_audio[AUDIO_PLAY_SAMPLE_RATE * 2];
+        /* 生成测试音频数据（1秒的440Hz正弦波），播放器会拷贝一份，用完即释放 */
+        uint32_t test_size = AUDIO_PLAY_SAMPLE_RATE * 2;
+        uint8_t *test_audio = (uint8_t *)mem_class_alloc(MEM_CLASS_BULK, test_size);
+        int ret;
+        
+        if (test_audio == RT_NULL)
+        {
+            rt_kprintf("No memory for test audio\n");
+            return -RT_ENOMEM;
+        }
         for (int i = 0; i < AUDIO_PLAY_SAMPLE_RATE; i++)
         {
             int16_t sample = (int16_t)(32767 * 0.5 * sin(2 * 3.14159 * 440 * i / AUDIO_PLAY_SAMPLE_RATE));
-            test_audio[i * 2] = (sample >> 8) & 0xFF;
-            test_audio[i * 2 + 1] = sample & 0xFF;
+            test_audio[i * 2] = sample & 0xFF;
+            test_audio[i * 2 + 1] = (sample >> 8) & 0xFF;
         }
-        return audio_player_play(test_audio, sizeof(test_audio));
+        ret = audio_player_play(test_audio, test_size);
+        mem_class_free(test_audio);
+        return ret;
     }
     else if (strcmp(argv[1], "stop") == 0)
     {
         return audio_player_stop();
     }
+    else if (strcmp(argv[1], "volume") == 0)
+    {
+        if (argc > 2)
+        {
+            return audio_player_set_volume(atoi(argv[2]));
+        }
+        rt_kprintf("Volume: %d\n", audio_player_get_volume());
+        return 0;
+    }
     else if (strcmp(argv[1], "status") == 0)
     {
+        max98357a_stream_stats_t stats;
+        
+        max98357a_stream_get_stats(&stats);
         rt_kprintf("Audio player state: %d\n", audio_player_get_state());
         rt_kprintf("Free buffer space: %d bytes\n", audio_player_get_free_space());
+        rt_kprintf("Stream: %s, halves: %d, underruns: %d, min fill: %d bytes, max interval: %d ms\n",
+                   max98357a_stream_is_running() ? "running" : "stopped",
+                   stats.halves, stats.underruns, stats.min_fill, stats.max_interval_ms);
         return 0;
     }
     else
@@ -6,6 +6,8 @@
  * Change Logs:
  * Date           Author       Notes
  * 2024-10-16     AI Assistant first version - Audio Player Module
+ * 2024-10-27     AI Assistant Add sample rate aware play/stream interfaces
+ * 2024-10-27     AI Assistant Add software volume
  */
 
 #ifndef __AUDIO_PLAYER_H__
@@ -17,7 +19,9 @@
 #define AUDIO_PLAY_SAMPLE_RATE       16000   /* 采样率 16kHz */
 #define AUDIO_PLAY_CHANNELS          1       /* 单声道 */
 #define AUDIO_PLAY_BITS_PER_SAMPLE   16      /* 16位采样 */
-#define AUDIO_PLAY_BUFFER_SIZE       (1024 * 8)  /* 8KB缓冲区（降低内存占用）*/
+#define AUDIO_PLAY_CHUNK_SAMPLES     512     /* 每次写入扬声器流的样本数 (32ms) */
+#define AUDIO_PLAY_WRITE_TIMEOUT     1000    /* 写入超时(ms)，超时说明DMA已停止 */
+#define AUDIO_PLAY_VOLUME_DEFAULT    100     /* 音量 (0~100)，100时不做任何处理 */
 
 /* 音频播放状态 */
 typedef enum {
@@ -30,9 +34,11 @@ typedef enum {
 /* 音频播放回调函数类型 */
 typedef void (*audio_player_callback)(void);
 
-/* 音频播放接口 */
+/* 音频播放接口：数据为16bit小端单声道PCM，播放前会复制一份 */
 int audio_player_init(void);
 int audio_player_play(const uint8_t *data, uint32_t size);
+/* 非16kHz的PCM经 audio_resampler 转换为16kHz播放（需要CMSIS-DSP，否则按16kHz播放）*/
+int audio_player_play_rate(const uint8_t *data, uint32_t size, uint32_t sample_rate);
 int audio_player_pause(void);
 int audio_player_resume(void);
 int audio_player_stop(void);
@@ -40,5 +46,16 @@ int audio_player_set_callback(audio_player_callback callback);
 audio_player_state_t audio_player_get_state(void);
 int audio_player_get_free_space(void);
 
+/* 流式播放接口：数据边到达边写入（如TTS下载），写满时阻塞，end等待播放完毕 */
+int audio_player_stream_begin(void);
+int audio_player_stream_write(const uint8_t *data, uint32_t size);
+int audio_player_stream_end(void);
+/* begin之后默认16kHz；采样率改变时先播完上一段在重采样器中的剩余样本 */
+int audio_player_stream_set_rate(uint32_t sample_rate);
+
+/* 音量 (0~100)：写入扬声器流之前按比例缩放，对正在播放的音频立即生效 */
+int audio_player_set_volume(uint32_t volume);
+uint32_t audio_player_get_volume(void);
+
 #endif /* __AUDIO_PLAYER_H__ */
 
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Polyphase sample rate converter
+ */
+
+#include <string.h>
+#include <math.h>
+#include "audio_resampler.h"
+
+#if AUDIO_RS_ENABLE
+
+#define AUDIO_RS_HIST_SIZE      (AUDIO_RS_TAPS + AUDIO_RS_BLOCK)
+#define AUDIO_RS_KAISER_BETA    6.0f    /* 阻带约-60dB */
+
+/* 零阶修正贝塞尔函数（级数展开），只在生成滤波器组时使用 */
+static float audio_rs_bessel_i0(float x)
+{
+    float sum = 1.0f;
+    float term = 1.0f;
+
+    for (int k = 1; k < 32; k++)
+    {
+        term *= (x / (2.0f * k)) * (x / (2.0f * k));
+        sum += term;
+        if (term < sum * 1e-8f)
+        {
+            break;
+        }
+    }
+
+    return sum;
+}
+
+int audio_rs_init(audio_rs_t *rs, uint32_t in_rate, uint32_t out_rate)
+{
+    uint32_t low = in_rate < out_rate ? in_rate : out_rate;
+    float half = AUDIO_RS_TAPS / 2.0f;
+    float i0_beta = audio_rs_bessel_i0(AUDIO_RS_KAISER_BETA);
+    float cutoff;
+    float row[AUDIO_RS_TAPS];
+
+    if (in_rate < AUDIO_RS_MIN_RATE || in_rate > AUDIO_RS_MAX_RATE ||
+        out_rate < AUDIO_RS_MIN_RATE || out_rate > AUDIO_RS_MAX_RATE)
+    {
+        return -1;
+    }
+
+    rs->in_rate = in_rate;
+    rs->out_rate = out_rate;
+
+    /* 截止频率（相对输入采样率）：较低的奈奎斯特频率减去半个过渡带，过渡带宽约为 3.6/TAPS */
+    cutoff = 0.5f * low / in_rate - 1.8f / AUDIO_RS_TAPS;
+
+    /* 第p行第k个系数 = h(TAPS/2 - 1 + p/PHASES - k)，即输出位于窗口中点之后 p/PHASES 个输入样本处 */
+    for (int p = 0; p <= AUDIO_RS_PHASES; p++)
+    {
+        float sum = 0.0f;
+
+        for (int k = 0; k < AUDIO_RS_TAPS; k++)
+        {
+            float x = half - 1.0f + (float)p / AUDIO_RS_PHASES - k;
+            float r = x / half;
+            float sinc = fabsf(x) < 1e-6f ? 1.0f : sinf(2.0f * PI * cutoff * x) / (2.0f * PI * cutoff * x);
+            float window = fabsf(r) >= 1.0f ? 0.0f :
+                           audio_rs_bessel_i0(AUDIO_RS_KAISER_BETA * sqrtf(1.0f - r * r)) / i0_beta;
+
+            row[k] = sinc * window;
+            sum += row[k];
+        }
+
+        /* 每个相位的直流增益归一化为1 */
+        for (int k = 0; k < AUDIO_RS_TAPS; k++)
+        {
+            int32_t q = (int32_t)lrintf(row[k] / sum * 32768.0f);
+
+            rs->bank[p * AUDIO_RS_TAPS + k] = (q15_t)(q > 32767 ? 32767 : (q < -32768 ? -32768 : q));
+        }
+    }
+
+    audio_rs_reset(rs);
+    return 0;
+}
+
+void audio_rs_reset(audio_rs_t *rs)
+{
+    /* 预置 TAPS/2-1 个零，第一个输出正好对准第一个输入样本 */
+    memset(rs->hist, 0, sizeof(rs->hist));
+    rs->fill = AUDIO_RS_TAPS / 2 - 1;
+    rs->pos = 0;
+    rs->frac = 0;
+    rs->drain = 0;
+    rs->flushing = 0;
+}
+
+/* 一个相位的点积，结果为16位幅度（未饱和）*/
+static int32_t audio_rs_dot(const int16_t *x, const q15_t *h)
+{
+    int64_t acc = 0;
+
+#if defined(ARM_MATH_DSP)
+    const q15_t *px = x;
+
+    for (int k = 0; k < AUDIO_RS_TAPS; k += 2)
+    {
+        acc = __SMLALD(read_q15x2_ia(&px), read_q15x2_ia(&h), acc);
+    }
+#else
+    for (int k = 0; k < AUDIO_RS_TAPS; k++)
+    {
+        acc += (int32_t)x[k] * h[k];
+    }
+#endif
+
+    return (int32_t)(acc >> 15);
+}
+
+uint32_t audio_rs_process(audio_rs_t *rs, const int16_t *in, uint32_t in_count, uint32_t *used,
+                          int16_t *out, uint32_t out_size)
+{
+    uint32_t produced = 0;
+    uint32_t consumed = 0;
+
+    while (1)
+    {
+        uint32_t copy;
+
+        /* 窗口内的输入都已到达时输出 */
+        while (rs->pos + AUDIO_RS_TAPS <= rs->fill && produced < out_size)
+        {
+            uint64_t scaled = (uint64_t)rs->frac * AUDIO_RS_PHASES;
+            uint32_t phase = (uint32_t)(scaled / rs->out_rate);
+            uint32_t rem = (uint32_t)(scaled % rs->out_rate);
+            const int16_t *x = &rs->hist[rs->pos];
+            int32_t y = audio_rs_dot(x, &rs->bank[phase * AUDIO_RS_TAPS]);
+
+            if (rem != 0)
+            {
+                int32_t y1 = audio_rs_dot(x, &rs->bank[(phase + 1) * AUDIO_RS_TAPS]);
+                int32_t weight = (int32_t)(((uint64_t)rem << 15) / rs->out_rate);
+
+                y += (int32_t)(((int64_t)(y1 - y) * weight) >> 15);
+            }
+            out[produced++] = (int16_t)(y > 32767 ? 32767 : (y < -32768 ? -32768 : y));
+
+            rs->frac += rs->in_rate;
+            rs->pos += rs->frac / rs->out_rate;
+            rs->frac %= rs->out_rate;
+        }
+
+        if (produced == out_size || consumed == in_count)
+        {
+            break;
+        }
+
+        /* 丢掉已经用不到的样本；降采样时pos可能超过fill，超出部分在后续输入中跳过 */
+        if (rs->pos >= rs->fill)
+        {
+            rs->pos -= rs->fill;
+            rs->fill = 0;
+        }
+        else if (rs->pos > 0)
+        {
+            memmove(rs->hist, &rs->hist[rs->pos], (rs->fill - rs->pos) * sizeof(int16_t));
+            rs->fill -= rs->pos;
+            rs->pos = 0;
+        }
+
+        copy = AUDIO_RS_HIST_SIZE - rs->fill;
+        if (copy > in_count - consumed)
+        {
+            copy = in_count - consumed;
+        }
+        memcpy(&rs->hist[rs->fill], &in[consumed], copy * sizeof(int16_t));
+        rs->fill += copy;
+        consumed += copy;
+    }
+
+    if (used)
+    {
+        *used = consumed;
+    }
+    return produced;
+}
+
+uint32_t audio_rs_flush(audio_rs_t *rs, int16_t *out, uint32_t out_size)
+{
+    static const int16_t zeros[AUDIO_RS_TAPS / 2];
+    uint32_t produced, used;
+
+    /* 补 TAPS/2 个零，最后一个输入样本之后的输出窗口才完整 */
+    if (!rs->flushing)
+    {
+        rs->flushing = 1;
+        rs->drain = AUDIO_RS_TAPS / 2;
+    }
+
+    produced = audio_rs_process(rs, zeros, rs->drain, &used, out, out_size);
+    rs->drain -= used;
+    if (produced < out_size)
+    {
+        audio_rs_reset(rs);
+    }
+
+    return produced;
+}
+
+#endif /* AUDIO_RS_ENABLE */
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Polyphase sample rate converter
+ */
+
+#ifndef __AUDIO_RESAMPLER_H__
+#define __AUDIO_RESAMPLER_H__
+
+/*
+ * 流式采样率转换：TTS返回8k/22.05k/24k等采样率时转换为功放的16kHz
+ *   - 多相滤波器组：Kaiser窗sinc低通按 AUDIO_RS_PHASES 个相位预先算好，Q15定点
+ *   - 输出位置用精确的有理数跟踪（分母为输出采样率），长时间播放不漂移；
+ *     位置落在两个相位之间时对两相的结果线性插值（8k/24k -> 16k 总是正好落在相位上）
+ *   - 截止频率取输入、输出中较低的奈奎斯特频率，升采样时抑制镜像，降采样时抑制混叠
+ * Cortex-M7上用 __SMLALD 一次乘加两个样本，PC上使用同样结果的C实现（见 audio_resampler_bench.c）。
+ *
+ * 本模块不依赖RT-Thread内核接口，状态（含滤波器组，约8.8KB）由调用者分配。
+ */
+
+#include <stdint.h>
+
+#ifdef __RTTHREAD__
+#include <rtconfig.h>
+#endif
+
+/* 设备端需要在menuconfig中开启 External Libraries -> CMSIS-DSP/NN */
+#if !defined(__RTTHREAD__) || defined(ART_PI_USING_CMSIS_DSP_NN)
+#define AUDIO_RS_ENABLE         1
+#else
+#define AUDIO_RS_ENABLE         0
+#endif
+
+#if AUDIO_RS_ENABLE
+
+#include "arm_math.h"
+
+#define AUDIO_RS_TAPS           32      /* 每个相位的抽头数（输入样本数），须为偶数 */
+#define AUDIO_RS_PHASES         128     /* 相位数，另存一行供最后一个相位插值 */
+#define AUDIO_RS_BLOCK          256     /* 每次搬入历史缓冲区的最大输入样本数 */
+#define AUDIO_RS_MIN_RATE       4000
+#define AUDIO_RS_MAX_RATE       48000
+
+typedef struct {
+    uint32_t in_rate;
+    uint32_t out_rate;
+    uint32_t frac;                      /* 输出位置的小数部分，单位 1/out_rate 个输入样本 */
+    uint32_t pos;                       /* 下一个输出窗口在hist中的起点 */
+    uint32_t fill;                      /* hist中的样本数 */
+    uint32_t drain;                     /* 结束时还要补入的零样本数 */
+    uint8_t flushing;
+    q15_t bank[(AUDIO_RS_PHASES + 1) * AUDIO_RS_TAPS];
+    int16_t hist[AUDIO_RS_TAPS + AUDIO_RS_BLOCK];
+} audio_rs_t;
+
+/* 按输入/输出采样率生成滤波器组，采样率超出范围返回-1 */
+int audio_rs_init(audio_rs_t *rs, uint32_t in_rate, uint32_t out_rate);
+
+/* 清空历史，开始新的一段音频（滤波器组不变）*/
+void audio_rs_reset(audio_rs_t *rs);
+
+/* 转换：读取最多in_count个输入样本，输出最多out_size个样本，*used 返回实际读取的输入样本数；
+ * 返回值等于out_size时可能还有输出未取出（即使输入已全部读取），应再次调用（in_count可以为0）；
+ * 小于out_size时输入已全部读取 */
+uint32_t audio_rs_process(audio_rs_t *rs, const int16_t *in, uint32_t in_count, uint32_t *used,
+                          int16_t *out, uint32_t out_size);
+
+/* 一段音频结束：补零推出滤波器中剩余的样本，返回输出样本数；返回值等于out_size时再次调用，
+ * 小于out_size时已取完并复位，可以开始下一段 */
+uint32_t audio_rs_flush(audio_rs_t *rs, int16_t *out, uint32_t out_size);
+
+#endif /* AUDIO_RS_ENABLE */
+
+#endif /* __AUDIO_RESAMPLER_H__ */
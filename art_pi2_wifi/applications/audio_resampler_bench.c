@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Resampler quality/cycle benchmark
+ */
+
+/*
+ * 采样率转换评估：把常见TTS采样率的合成正弦流式转换为16kHz，检查样本数、失真和混叠，并测量每个输出样本的耗时
+ *   samples  输出样本数与 输入样本数 * 16000 / 输入采样率 相差不超过1
+ *   snr      1kHz正弦与理想16kHz正弦比较（含升采样的镜像），不低于40dB
+ *   alias    降采样时10kHz正弦（高于输出的奈奎斯特频率）的残留，不高于-40dB
+ *   cycles   每个输出样本的CPU周期：设备端为DWT周期计数器，x86 PC上为TSC
+ * 输入按160样本分段、输出缓冲区只有100个样本，覆盖输出缓冲区满时的部分读取。
+ *
+ * 设备端：rs_bench
+ * PC端（使用C实现，结果与设备端相同）：
+ *   gcc -O2 -DAUDIO_RS_BENCH_MAIN -D__GNUC_PYTHON__ -D__RESTRICT=__restrict -include arm_math.h \
+ *       -I../libraries/CMSIS/DSP/Include -I../libraries/CMSIS/DSP/PrivateInclude \
+ *       -I../libraries/CMSIS/Core/Include \
+ *       audio_resampler.c audio_resampler_bench.c -lm -o rs_bench
+ *   ./rs_bench
+ */
+
+#include <string.h>
+#include <math.h>
+#include "audio_resampler.h"
+
+#if AUDIO_RS_ENABLE
+
+#ifdef __RTTHREAD__
+#include <rtthread.h>
+#include <board.h>
+#define RS_PRINTF       rt_kprintf
+#define RS_MALLOC       rt_malloc
+#define RS_FREE         rt_free
+#else
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#define RS_PRINTF       printf
+#define RS_MALLOC       malloc
+#define RS_FREE         free
+#endif
+
+#define RS_BENCH_OUT_RATE   16000
+#define RS_BENCH_AMPLITUDE  10000.0f
+#define RS_BENCH_IN_CHUNK   160
+#define RS_BENCH_OUT_CHUNK  100
+
+/* 每项评估的统计 */
+typedef struct {
+    uint32_t in_rate;
+    float hz;
+    uint32_t inputs;
+    uint32_t outputs;
+    uint32_t skip;              /* 开头和结尾跳过的样本数（滤波器建立/补零）*/
+    double signal;
+    double error;
+    double power;
+    uint64_t cycles;
+} rs_bench_t;
+
+/* 周期计数：设备端为DWT，x86为TSC，其他平台以纳秒代替 */
+static uint64_t rs_bench_cycles(void)
+{
+#ifdef __RTTHREAD__
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    return DWT->CYCCNT;
+#elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+/* 比较一段输出与理想正弦，total为应有的输出总数 */
+static void rs_bench_check(rs_bench_t *b, const int16_t *out, uint32_t count, uint32_t total)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t j = b->outputs + i;
+        double ideal = RS_BENCH_AMPLITUDE * sin(2.0 * PI * b->hz * j / RS_BENCH_OUT_RATE);
+
+        if (j < b->skip || j + b->skip >= total)
+        {
+            continue;
+        }
+        b->signal += ideal * ideal;
+        b->error += (out[i] - ideal) * (out[i] - ideal);
+        b->power += (double)out[i] * out[i];
+    }
+    b->outputs += count;
+}
+
+/* 把 in_rate 的1秒正弦流式转换为16kHz */
+static int rs_bench_run(audio_rs_t *rs, rs_bench_t *b)
+{
+    int16_t in[RS_BENCH_IN_CHUNK];
+    int16_t out[RS_BENCH_OUT_CHUNK];
+    uint32_t total = (uint32_t)((uint64_t)b->inputs * RS_BENCH_OUT_RATE / b->in_rate);
+    uint32_t sent = 0;
+    uint32_t used, count;
+    uint64_t start;
+
+    if (audio_rs_init(rs, b->in_rate, RS_BENCH_OUT_RATE) != 0)
+    {
+        return -1;
+    }
+
+    /* 跳过开头和结尾各一个滤波器长度的输出 */
+    b->skip = AUDIO_RS_TAPS * RS_BENCH_OUT_RATE / b->in_rate + AUDIO_RS_TAPS;
+
+    while (sent < b->inputs)
+    {
+        uint32_t n = b->inputs - sent;
+        uint32_t pos = 0;
+
+        if (n > RS_BENCH_IN_CHUNK)
+        {
+            n = RS_BENCH_IN_CHUNK;
+        }
+        for (uint32_t i = 0; i < n; i++)
+        {
+            in[i] = (int16_t)lrint(RS_BENCH_AMPLITUDE * sin(2.0 * PI * b->hz * (sent + i) / b->in_rate));
+        }
+
+        /* 输出缓冲区满时继续取，直到输入读完且输出未满 */
+        do
+        {
+            start = rs_bench_cycles();
+            count = audio_rs_process(rs, &in[pos], n - pos, &used, out, RS_BENCH_OUT_CHUNK);
+            b->cycles += rs_bench_cycles() - start;
+            rs_bench_check(b, out, count, total);
+            pos += used;
+        } while (pos < n || count == RS_BENCH_OUT_CHUNK);
+        sent += n;
+    }
+
+    do
+    {
+        start = rs_bench_cycles();
+        count = audio_rs_flush(rs, out, RS_BENCH_OUT_CHUNK);
+        b->cycles += rs_bench_cycles() - start;
+        rs_bench_check(b, out, count, total);
+    } while (count == RS_BENCH_OUT_CHUNK);
+
+    return 0;
+}
+
+/* 以0.1为单位打印，rt_kprintf不支持浮点 */
+static void rs_bench_print_x10(const char *fmt, double value)
+{
+    int x10 = (int)lrint(value * 10.0);
+
+    RS_PRINTF(fmt, x10 / 10, (x10 < 0 ? -x10 : x10) % 10);
+}
+
+int audio_rs_bench(void)
+{
+    static const uint32_t rates[] = {8000, 11025, 16000, 22050, 24000, 32000, 44100, 48000};
+    audio_rs_t *rs;
+    int failed = 0;
+
+    rs = (audio_rs_t *)RS_MALLOC(sizeof(audio_rs_t));
+    if (rs == NULL)
+    {
+        RS_PRINTF("No memory for resampler (%d bytes)\n", (int)sizeof(audio_rs_t));
+        return -1;
+    }
+
+    RS_PRINTF("In rate  Samples        SNR 1kHz   Alias 10kHz  Cycles/out\n");
+    for (uint32_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+    {
+        rs_bench_t tone, alias;
+        double snr, leak = 0.0;
+        int ok;
+
+        memset(&tone, 0, sizeof(tone));
+        tone.in_rate = rates[r];
+        tone.hz = 1000.0f;
+        tone.inputs = rates[r];
+        if (rs_bench_run(rs, &tone) != 0)
+        {
+            failed++;
+            continue;
+        }
+        snr = 10.0 * log10(tone.signal / (tone.error > 0 ? tone.error : 1e-9));
+        ok = snr >= 40.0;
+        if (tone.outputs + 1 < RS_BENCH_OUT_RATE || tone.outputs > RS_BENCH_OUT_RATE + 1)
+        {
+            ok = 0;
+        }
+
+        RS_PRINTF("%7d  %5d/%5d  ", rates[r], tone.outputs, RS_BENCH_OUT_RATE);
+        rs_bench_print_x10("%6d.%d dB  ", snr);
+
+        /* 只有输入奈奎斯特频率高于10kHz时才有混叠可测 */
+        if (rates[r] > 20000)
+        {
+            memset(&alias, 0, sizeof(alias));
+            alias.in_rate = rates[r];
+            alias.hz = 10000.0f;
+            alias.inputs = rates[r];
+            rs_bench_run(rs, &alias);
+            leak = 10.0 * log10((alias.power > 0 ? alias.power : 1e-9) / alias.signal);
+            rs_bench_print_x10("%6d.%d dB  ", leak);
+            if (leak > -40.0)
+            {
+                ok = 0;
+            }
+        }
+        else
+        {
+            RS_PRINTF("         -   ");
+        }
+
+        rs_bench_print_x10("%7d.%d", (double)tone.cycles / tone.outputs);
+        RS_PRINTF("%s\n", ok ? "" : "  FAIL");
+        failed += !ok;
+    }
+
+#if !defined(__RTTHREAD__) && !defined(__x86_64__) && !defined(__i386__)
+    RS_PRINTF("(cycles column is ns on this host)\n");
+#endif
+    RS_PRINTF("Filter: %d taps x %d phases, %d bytes of state\n",
+              AUDIO_RS_TAPS, AUDIO_RS_PHASES, (int)sizeof(audio_rs_t));
+    RS_PRINTF("Result: %s\n", failed ? "FAIL" : "PASS");
+
+    RS_FREE(rs);
+    return failed ? -1 : 0;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+static int cmd_rs_bench(int argc, char **argv)
+{
+    return audio_rs_bench();
+}
+MSH_CMD_EXPORT_ALIAS(cmd_rs_bench, rs_bench, Check TTS resampler quality and cycles per output sample);
+#endif
+
+#ifdef AUDIO_RS_BENCH_MAIN
+int main(void)
+{
+    return audio_rs_bench() == 0 ? 0 : 1;
+}
+#endif
+
+#endif /* AUDIO_RS_ENABLE */
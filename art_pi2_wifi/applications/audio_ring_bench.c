@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-19     AI Assistant first version - Capture ring replay test
+ */
+
+/*
+ * 麦克风采集环形缓冲区测试：按样本序号生成锯齿波作为DMA半缓冲区，写入独立的一份环形缓冲区，
+ * 读取方按样本序号逐个校验：
+ *   realtime  生产者线程按16kHz节奏（每64ms一块）写入，读取方每次读10ms，不能丢失或重复样本，不能有覆盖
+ *   overrun   读取方停顿时连续写入6块：保留最早的4块并计2次覆盖，之后读到的第一个样本正好从被丢弃的块之后开始
+ *   deadline  环形缓冲区为空但信号量还有计数时，读取仍等到超时才返回0；等待中数据到达时立即返回
+ * 不使用ADC和采集驱动的缓冲区，录音时也可以运行。
+ *
+ * 设备端：mic_ring_test [秒数]（默认3秒）
+ * PC端（与设备端同一份audio_capture_ring.c和RT-Thread的ringbuffer.c）：
+ *   gcc -O2 -DAUDIO_RING_BENCH_MAIN -I../host -I. audio_capture_ring.c audio_ring_bench.c \
+ *       ../rt-thread/components/drivers/ipc/ringbuffer.c -lpthread -o ring_bench
+ *   ./ring_bench 3
+ */
+
+#include <rtthread.h>
+#include <stdlib.h>
+#include "audio_capture_ring.h"
+
+#define RING_BENCH_CHUNK        160     /* 每次读取的样本数（10ms），与语音助手线程的读法一致 */
+#define RING_BENCH_BLOCK_MS     (AUDIO_CAPTURE_BLOCK_SAMPLES * 1000 / AUDIO_SAMPLE_RATE)
+#define RING_BENCH_STALL_BLOCKS (AUDIO_CAPTURE_RING_BLOCKS + 2)
+#define RING_BENCH_TIMEOUT      100     /* 空缓冲区读取的超时（毫秒）*/
+#define RING_BENCH_SLACK        30      /* 返回时间允许的误差（毫秒）*/
+
+static struct {
+    audio_capture_ring_t ring;
+    rt_uint8_t pool[AUDIO_CAPTURE_RING_SIZE];
+    int16_t block[AUDIO_CAPTURE_BLOCK_SAMPLES];
+    rt_bool_t ready;
+    rt_sem_t done;
+    uint32_t next;          /* 下一个生成的样本序号，被丢弃的块也计入 */
+    uint32_t blocks;        /* 生产者线程要写入的块数 */
+} ring_bench;
+
+/* 生成一块锯齿波并写入，相当于一次DMA半满/全满事件 */
+static void ring_bench_publish(void)
+{
+    for (uint32_t i = 0; i < AUDIO_CAPTURE_BLOCK_SAMPLES; i++)
+    {
+        ring_bench.block[i] = (int16_t)(ring_bench.next + i);
+    }
+    ring_bench.next += AUDIO_CAPTURE_BLOCK_SAMPLES;
+
+    audio_capture_ring_put(&ring_bench.ring, ring_bench.block, AUDIO_CAPTURE_BLOCK_SAMPLES);
+}
+
+/* 生产者：每块按截止时间等待，不累积延迟 */
+static void ring_bench_producer(void *parameter)
+{
+    rt_tick_t next = rt_tick_get();
+
+    (void)parameter;
+    for (uint32_t i = 0; i < ring_bench.blocks; i++)
+    {
+        rt_int32_t wait;
+
+        next += rt_tick_from_millisecond(RING_BENCH_BLOCK_MS);
+        wait = (rt_int32_t)(next - rt_tick_get());
+        if (wait > 0)
+        {
+            rt_thread_mdelay(wait * 1000 / RT_TICK_PER_SECOND);
+        }
+        ring_bench_publish();
+    }
+
+    rt_sem_release(ring_bench.done);
+}
+
+static rt_err_t ring_bench_start_producer(uint32_t blocks)
+{
+    rt_thread_t thread;
+
+    ring_bench.blocks = blocks;
+    thread = rt_thread_create("mic_sim", ring_bench_producer, RT_NULL, 2048, 5, 10);
+    if (thread == RT_NULL || rt_thread_startup(thread) != RT_EOK)
+    {
+        rt_kprintf("Failed to start producer\n");
+        return -RT_ERROR;
+    }
+    return RT_EOK;
+}
+
+/* 读取count个样本，从序号first开始逐个校验，返回读到的样本数 */
+static uint32_t ring_bench_consume(uint32_t first, uint32_t count, uint32_t *mismatches)
+{
+    int16_t chunk[RING_BENCH_CHUNK];
+    uint32_t received = 0;
+
+    while (received < count)
+    {
+        int len = audio_capture_ring_read(&ring_bench.ring, (uint8_t *)chunk, sizeof(chunk), 1000);
+        if (len <= 0)
+        {
+            rt_kprintf("Read returned %d after %d samples\n", len, received);
+            break;
+        }
+
+        for (int i = 0; i < len / 2; i++, received++)
+        {
+            if (chunk[i] != (int16_t)(first + received))
+            {
+                (*mismatches)++;
+            }
+        }
+    }
+
+    return received;
+}
+
+static rt_bool_t ring_bench_realtime(uint32_t seconds)
+{
+    uint32_t blocks = seconds * AUDIO_SAMPLE_RATE / AUDIO_CAPTURE_BLOCK_SAMPLES;
+    uint32_t expect = blocks * AUDIO_CAPTURE_BLOCK_SAMPLES;
+    uint32_t received, mismatches = 0;
+    audio_capture_stats_t *stats = &ring_bench.ring.stats;
+    rt_bool_t ok;
+
+    audio_capture_ring_start(&ring_bench.ring);
+    ring_bench.next = 0;
+    if (ring_bench_start_producer(blocks) != RT_EOK)
+    {
+        return RT_FALSE;
+    }
+
+    received = ring_bench_consume(0, expect, &mismatches);
+    rt_sem_take(ring_bench.done, RT_WAITING_FOREVER);
+
+    ok = received == expect && mismatches == 0 && stats->blocks == blocks && stats->overruns == 0;
+    rt_kprintf("realtime  %d blocks, samples %d/%d, mismatches %d, overruns %d, max fill %d/%d bytes  %s\n",
+               blocks, received, expect, mismatches, stats->overruns, stats->max_fill,
+               (int)AUDIO_CAPTURE_RING_SIZE, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+static rt_bool_t ring_bench_overrun(void)
+{
+    uint32_t kept = AUDIO_CAPTURE_RING_BLOCKS * AUDIO_CAPTURE_BLOCK_SAMPLES;
+    uint32_t resume = RING_BENCH_STALL_BLOCKS * AUDIO_CAPTURE_BLOCK_SAMPLES;
+    uint32_t received, mismatches = 0;
+    audio_capture_stats_t stalled;
+    rt_bool_t ok;
+
+    audio_capture_ring_start(&ring_bench.ring);
+    ring_bench.next = 0;
+
+    /* 读取方停顿期间的DMA事件 */
+    for (uint32_t i = 0; i < RING_BENCH_STALL_BLOCKS; i++)
+    {
+        ring_bench_publish();
+    }
+    stalled = ring_bench.ring.stats;
+    ok = stalled.blocks == AUDIO_CAPTURE_RING_BLOCKS &&
+         stalled.overruns == RING_BENCH_STALL_BLOCKS - AUDIO_CAPTURE_RING_BLOCKS &&
+         stalled.max_fill == AUDIO_CAPTURE_RING_SIZE;
+
+    /* 保留的是停顿前最早的几块，之后的数据从下一块的开头接上 */
+    received = ring_bench_consume(0, kept, &mismatches);
+    ring_bench_publish();
+    received += ring_bench_consume(resume, AUDIO_CAPTURE_BLOCK_SAMPLES, &mismatches);
+
+    ok = ok && received == kept + AUDIO_CAPTURE_BLOCK_SAMPLES && mismatches == 0;
+    rt_kprintf("overrun   %d blocks while stalled: kept %d, overruns %d, resumed at sample %d, mismatches %d  %s\n",
+               RING_BENCH_STALL_BLOCKS, stalled.blocks, stalled.overruns, resume, mismatches,
+               ok ? "ok" : "FAIL");
+    return ok;
+}
+
+static rt_bool_t ring_bench_deadline(void)
+{
+    uint8_t buffer[RING_BENCH_CHUNK * sizeof(int16_t)];
+    rt_tick_t start;
+    uint32_t empty_ms, data_ms;
+    int empty_ret, data_ret;
+    rt_bool_t ok;
+
+    /* 紧接overrun：数据已读完，写入时释放的信号量还没有被取走 */
+    start = rt_tick_get();
+    empty_ret = audio_capture_ring_read(&ring_bench.ring, buffer, sizeof(buffer), RING_BENCH_TIMEOUT);
+    empty_ms = (rt_tick_get() - start) * 1000 / RT_TICK_PER_SECOND;
+
+    /* 等待中第一块在64ms后到达 */
+    audio_capture_ring_start(&ring_bench.ring);
+    if (ring_bench_start_producer(1) != RT_EOK)
+    {
+        return RT_FALSE;
+    }
+    start = rt_tick_get();
+    data_ret = audio_capture_ring_read(&ring_bench.ring, buffer, sizeof(buffer), 1000);
+    data_ms = (rt_tick_get() - start) * 1000 / RT_TICK_PER_SECOND;
+    rt_sem_take(ring_bench.done, RT_WAITING_FOREVER);
+
+    ok = empty_ret == 0 && empty_ms >= RING_BENCH_TIMEOUT && empty_ms <= RING_BENCH_TIMEOUT + RING_BENCH_SLACK &&
+         data_ret == (int)sizeof(buffer) && data_ms <= RING_BENCH_BLOCK_MS + RING_BENCH_SLACK;
+    rt_kprintf("deadline  empty: %d after %d ms (timeout %d), data at %d ms: %d bytes after %d ms  %s\n",
+               empty_ret, empty_ms, RING_BENCH_TIMEOUT, RING_BENCH_BLOCK_MS, data_ret, data_ms,
+               ok ? "ok" : "FAIL");
+    return ok;
+}
+
+static int ring_bench_main(uint32_t seconds)
+{
+    rt_bool_t ok = RT_TRUE;
+
+    if (!ring_bench.ready)
+    {
+        ring_bench.done = rt_sem_create("mic_simd", 0, RT_IPC_FLAG_FIFO);
+        if (ring_bench.done == RT_NULL ||
+            audio_capture_ring_init(&ring_bench.ring, ring_bench.pool, sizeof(ring_bench.pool)) != RT_EOK)
+        {
+            return -1;
+        }
+        ring_bench.ready = RT_TRUE;
+    }
+
+    rt_kprintf("Capture ring: %d blocks x %d samples, %d ms per block\n",
+               AUDIO_CAPTURE_RING_BLOCKS, AUDIO_CAPTURE_BLOCK_SAMPLES, RING_BENCH_BLOCK_MS);
+
+    ok = ring_bench_realtime(seconds) && ok;
+    ok = ring_bench_overrun() && ok;
+    ok = ring_bench_deadline() && ok;
+    audio_capture_ring_stop(&ring_bench.ring);
+
+    rt_kprintf("Result: %s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : -1;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+#include <finsh.h>
+
+static int mic_ring_test(int argc, char **argv)
+{
+    return ring_bench_main(argc > 1 ? atoi(argv[1]) : 3);
+}
+MSH_CMD_EXPORT(mic_ring_test, replay simulated ADC DMA events through capture ring: mic_ring_test [seconds]);
+#endif
+
+#ifdef AUDIO_RING_BENCH_MAIN
+int main(int argc, char **argv)
+{
+    return ring_bench_main(argc > 1 ? atoi(argv[1]) : 3) == 0 ? 0 : 1;
+}
+#endif
@@ -0,0 +1,433 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Base64 codec benchmark
+ */
+
+/*
+ * Base64编解码的正确性和吞吐量对比：
+ *   strchr   最初的实现（每个字符strchr查64字节编码表，整段解码到新分配的缓冲区）
+ *   branch   流式TTS中的实现（比较分支求6bit值，凑满4个字符输出3字节）
+ *   table    base64_codec.c（反查表 + 32位整组处理），分别测一次性、2KB分段和原地解码
+ * 正确性检查包括随机长度往返、任意分段位置、原地编解码、带换行和引号的输入、分段补齐后拼接的输入。
+ *
+ * 设备端：base64_bench [KB]
+ * PC端（与设备端同一份base64_codec.c）：
+ *   gcc -O2 -DBASE64_BENCH_MAIN -I../host -I. base64_codec.c base64_bench.c -o base64_bench
+ *   ./base64_bench 1024
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include "base64_codec.h"
+
+#define B64_BENCH_SEGMENT   2048    /* 与HTTP接收块大小相同 */
+#define B64_BENCH_ROUNDS    2000
+
+static const char b64_bench_table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static uint32_t b64_bench_seed = 1;
+
+static uint32_t b64_bench_rand(void)
+{
+    b64_bench_seed = b64_bench_seed * 1103515245 + 12345;
+    return b64_bench_seed >> 8;
+}
+
+/* 最初的编码实现 */
+static uint32_t b64_bench_strchr_encode(const uint8_t *data, uint32_t data_len, char *encoded)
+{
+    uint32_t encoded_len = ((data_len + 2) / 3) * 4;
+    uint32_t i, j;
+
+    for (i = 0, j = 0; i < data_len;)
+    {
+        uint32_t octet_a = i < data_len ? data[i++] : 0;
+        uint32_t octet_b = i < data_len ? data[i++] : 0;
+        uint32_t octet_c = i < data_len ? data[i++] : 0;
+        uint32_t triple = (octet_a << 16) + (octet_b << 8) + octet_c;
+
+        encoded[j++] = b64_bench_table[(triple >> 18) & 0x3F];
+        encoded[j++] = b64_bench_table[(triple >> 12) & 0x3F];
+        encoded[j++] = b64_bench_table[(triple >> 6) & 0x3F];
+        encoded[j++] = b64_bench_table[triple & 0x3F];
+    }
+
+    for (i = 0; i < (3 - data_len % 3) % 3; i++)
+    {
+        encoded[encoded_len - 1 - i] = '=';
+    }
+
+    return encoded_len;
+}
+
+/* 最初的解码实现（要求以'\0'结尾、不含换行） */
+static uint8_t *b64_bench_strchr_decode(const char *encoded, uint32_t *decoded_len)
+{
+    uint32_t encoded_len = strlen(encoded);
+    uint32_t output_len = encoded_len / 4 * 3;
+
+    if (encoded[encoded_len - 1] == '=') output_len--;
+    if (encoded[encoded_len - 2] == '=') output_len--;
+
+    uint8_t *decoded = (uint8_t *)rt_malloc(output_len);
+    if (decoded == RT_NULL)
+    {
+        return RT_NULL;
+    }
+
+    uint32_t i, j;
+    for (i = 0, j = 0; i < encoded_len;)
+    {
+        uint32_t sextet_a = encoded[i] == '=' ? 0 & i++ : strchr(b64_bench_table, encoded[i++]) - b64_bench_table;
+        uint32_t sextet_b = encoded[i] == '=' ? 0 & i++ : strchr(b64_bench_table, encoded[i++]) - b64_bench_table;
+        uint32_t sextet_c = encoded[i] == '=' ? 0 & i++ : strchr(b64_bench_table, encoded[i++]) - b64_bench_table;
+        uint32_t sextet_d = encoded[i] == '=' ? 0 & i++ : strchr(b64_bench_table, encoded[i++]) - b64_bench_table;
+
+        uint32_t triple = (sextet_a << 18) + (sextet_b << 12) + (sextet_c << 6) + sextet_d;
+
+        if (j < output_len) decoded[j++] = (triple >> 16) & 0xFF;
+        if (j < output_len) decoded[j++] = (triple >> 8) & 0xFF;
+        if (j < output_len) decoded[j++] = triple & 0xFF;
+    }
+
+    *decoded_len = output_len;
+    return decoded;
+}
+
+static int b64_bench_branch_value(char c)
+{
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return -1;
+}
+
+/* 流式TTS中的解码实现，输出经384字节栈缓冲区转交 */
+static uint32_t b64_bench_branch_decode(const char *data, uint32_t len, uint8_t *dst)
+{
+    uint8_t out[384];
+    uint32_t out_len = 0, total = 0;
+    uint32_t quad = 0, quad_len = 0;
+    uint32_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        int value = b64_bench_branch_value(data[i]);
+        if (value < 0)
+        {
+            continue;
+        }
+
+        quad = (quad << 6) | value;
+        if (++quad_len == 4)
+        {
+            out[out_len++] = (quad >> 16) & 0xFF;
+            out[out_len++] = (quad >> 8) & 0xFF;
+            out[out_len++] = quad & 0xFF;
+            quad = 0;
+            quad_len = 0;
+
+            if (out_len > sizeof(out) - 3)
+            {
+                rt_memcpy(dst + total, out, out_len);
+                total += out_len;
+                out_len = 0;
+            }
+        }
+    }
+    rt_memcpy(dst + total, out, out_len);
+    total += out_len;
+
+    if (quad_len >= 2)
+    {
+        uint32_t bits = quad << (6 * (4 - quad_len));
+        dst[total++] = (bits >> 16) & 0xFF;
+        if (quad_len == 3)
+        {
+            dst[total++] = (bits >> 8) & 0xFF;
+        }
+    }
+
+    return total;
+}
+
+/* 按 segment 分段流式解码 */
+static uint32_t b64_bench_decode_segments(const char *src, uint32_t len, uint32_t segment, uint8_t *dst)
+{
+    base64_decoder_t dec;
+    uint32_t offset, out_len = 0;
+
+    base64_decoder_init(&dec);
+    for (offset = 0; offset < len; offset += segment)
+    {
+        uint32_t n = len - offset < segment ? len - offset : segment;
+        out_len += base64_decode_update(&dec, src + offset, n, dst + out_len);
+    }
+
+    return out_len;
+}
+
+/* 正确性检查，返回失败次数 */
+static int b64_bench_verify(void)
+{
+    uint8_t data[300], decoded[300 + 8];
+    char encoded[BASE64_ENCODED_LEN(300) + 8], reference[BASE64_ENCODED_LEN(300) + 8];
+    char noisy[BASE64_ENCODED_LEN(300) * 2 + 8];
+    uint8_t inplace[BASE64_ENCODED_LEN(300) + 8];
+    base64_encoder_t enc;
+    int failures = 0;
+    uint32_t len, i;
+
+    for (len = 0; len <= 300; len++)
+    {
+        uint32_t enc_len, ref_len, out_len, split, noisy_len;
+
+        for (i = 0; i < len; i++)
+        {
+            data[i] = (uint8_t)b64_bench_rand();
+        }
+
+        /* 一次性编码与原实现逐字符一致 */
+        ref_len = b64_bench_strchr_encode(data, len, reference);
+        enc_len = base64_encode(data, len, encoded);
+        if (enc_len != ref_len || memcmp(encoded, reference, ref_len) != 0)
+        {
+            rt_kprintf("encode mismatch at length %d\n", len);
+            failures++;
+        }
+
+        /* 原地编码 */
+        rt_memcpy(inplace, data, len);
+        if (base64_encode(inplace, len, (char *)inplace) != ref_len || memcmp(inplace, reference, ref_len) != 0)
+        {
+            rt_kprintf("in-place encode mismatch at length %d\n", len);
+            failures++;
+        }
+
+        /* 分三段流式编码 */
+        split = len ? b64_bench_rand() % (len + 1) : 0;
+        base64_encoder_init(&enc);
+        enc_len = base64_encode_update(&enc, data, split, encoded);
+        enc_len += base64_encode_update(&enc, data + split, (len - split) / 2, encoded + enc_len);
+        enc_len += base64_encode_update(&enc, data + split + (len - split) / 2,
+                                        len - split - (len - split) / 2, encoded + enc_len);
+        enc_len += base64_encode_final(&enc, encoded + enc_len);
+        if (enc_len != ref_len || memcmp(encoded, reference, ref_len) != 0)
+        {
+            rt_kprintf("streamed encode mismatch at length %d\n", len);
+            failures++;
+        }
+
+        /* 一次性解码、任意分段解码 */
+        out_len = base64_decode(reference, ref_len, decoded);
+        if (out_len != len || memcmp(decoded, data, len) != 0)
+        {
+            rt_kprintf("decode mismatch at length %d\n", len);
+            failures++;
+        }
+        for (split = 1; split <= 9; split++)
+        {
+            out_len = b64_bench_decode_segments(reference, ref_len, split, decoded);
+            if (out_len != len || memcmp(decoded, data, len) != 0)
+            {
+                rt_kprintf("segmented decode mismatch at length %d, segment %d\n", len, split);
+                failures++;
+            }
+        }
+
+        /* 原地解码 */
+        rt_memcpy(inplace, reference, ref_len);
+        out_len = base64_decode((const char *)inplace, ref_len, inplace);
+        if (out_len != len || memcmp(inplace, data, len) != 0)
+        {
+            rt_kprintf("in-place decode mismatch at length %d\n", len);
+            failures++;
+        }
+
+        /* 混入引号、每76字符换行（MIME格式） */
+        noisy_len = 0;
+        noisy[noisy_len++] = '"';
+        for (i = 0; i < ref_len; i++)
+        {
+            if (i > 0 && i % 76 == 0)
+            {
+                noisy[noisy_len++] = '\r';
+                noisy[noisy_len++] = '\n';
+            }
+            noisy[noisy_len++] = reference[i];
+        }
+        noisy[noisy_len++] = '"';
+        out_len = b64_bench_decode_segments(noisy, noisy_len, 7, decoded);
+        if (out_len != len || memcmp(decoded, data, len) != 0)
+        {
+            rt_kprintf("noisy decode mismatch at length %d\n", len);
+            failures++;
+        }
+
+        /* 两段分别编码（各自补'='）后拼接 */
+        split = len ? b64_bench_rand() % (len + 1) : 0;
+        enc_len = base64_encode(data, split, noisy);
+        enc_len += base64_encode(data + split, len - split, noisy + enc_len);
+        out_len = base64_decode(noisy, enc_len, decoded);
+        if (out_len != len || memcmp(decoded, data, len) != 0)
+        {
+            rt_kprintf("concatenated decode mismatch at length %d, split %d\n", len, split);
+            failures++;
+        }
+    }
+
+    return failures;
+}
+
+static uint32_t b64_bench_mbps(uint32_t bytes, uint32_t rounds, rt_tick_t ticks)
+{
+    uint32_t ms = ticks * 1000 / RT_TICK_PER_SECOND;
+
+    if (ms == 0)
+    {
+        ms = 1;
+    }
+    return (uint32_t)((uint64_t)bytes * rounds / 1000 / ms);
+}
+
+static int base64_bench(int kbytes)
+{
+    uint32_t len, enc_len, out_len = 0, rounds, i;
+    uint8_t *data, *decoded;
+    char *encoded;
+    rt_tick_t start, ticks;
+    int failures;
+
+    if (kbytes <= 0)
+    {
+        kbytes = 64;
+    }
+    len = (uint32_t)kbytes * 1024;
+    rounds = B64_BENCH_ROUNDS * 64 / kbytes;
+    if (rounds == 0)
+    {
+        rounds = 1;
+    }
+
+    failures = b64_bench_verify();
+    rt_kprintf("Round trips: 301 lengths, failures: %d\n", failures);
+
+    data = (uint8_t *)rt_malloc(len);
+    decoded = (uint8_t *)rt_malloc(len + 8);
+    encoded = (char *)rt_malloc(BASE64_ENCODED_LEN(len) + 1);
+    if (data == RT_NULL || decoded == RT_NULL || encoded == RT_NULL)
+    {
+        rt_kprintf("No memory for %d KB\n", kbytes);
+        rt_free(data);
+        rt_free(decoded);
+        rt_free(encoded);
+        return -1;
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        data[i] = (uint8_t)b64_bench_rand();
+    }
+    enc_len = base64_encode(data, len, encoded);
+    encoded[enc_len] = '\0';
+
+    rt_kprintf("%d KB x %d, throughput in MB/s of encoded text\n", kbytes, rounds);
+
+    start = rt_tick_get();
+    for (i = 0; i < rounds; i++)
+    {
+        b64_bench_strchr_encode(data, len, encoded);
+    }
+    ticks = rt_tick_get() - start;
+    rt_kprintf("encode  strchr          %6d\n", b64_bench_mbps(enc_len, rounds, ticks));
+
+    start = rt_tick_get();
+    for (i = 0; i < rounds; i++)
+    {
+        base64_encode(data, len, encoded);
+    }
+    ticks = rt_tick_get() - start;
+    rt_kprintf("encode  table           %6d\n", b64_bench_mbps(enc_len, rounds, ticks));
+
+    start = rt_tick_get();
+    for (i = 0; i < rounds; i++)
+    {
+        rt_free(b64_bench_strchr_decode(encoded, &out_len));
+    }
+    ticks = rt_tick_get() - start;
+    rt_kprintf("decode  strchr          %6d\n", b64_bench_mbps(enc_len, rounds, ticks));
+
+    start = rt_tick_get();
+    for (i = 0; i < rounds; i++)
+    {
+        out_len = b64_bench_branch_decode(encoded, enc_len, decoded);
+    }
+    ticks = rt_tick_get() - start;
+    rt_kprintf("decode  branch          %6d\n", b64_bench_mbps(enc_len, rounds, ticks));
+
+    start = rt_tick_get();
+    for (i = 0; i < rounds; i++)
+    {
+        out_len = base64_decode(encoded, enc_len, decoded);
+    }
+    ticks = rt_tick_get() - start;
+    rt_kprintf("decode  table           %6d\n", b64_bench_mbps(enc_len, rounds, ticks));
+
+    start = rt_tick_get();
+    for (i = 0; i < rounds; i++)
+    {
+        out_len = b64_bench_decode_segments(encoded, enc_len, B64_BENCH_SEGMENT, decoded);
+    }
+    ticks = rt_tick_get() - start;
+    rt_kprintf("decode  table 2KB segs  %6d\n", b64_bench_mbps(enc_len, rounds, ticks));
+    if (out_len != len || memcmp(decoded, data, len) != 0)
+    {
+        failures++;
+    }
+
+    /* 原地解码会破坏输入，每轮重新编码，计时只算解码部分 */
+    ticks = 0;
+    for (i = 0; i < rounds; i++)
+    {
+        base64_encode(data, len, encoded);
+        start = rt_tick_get();
+        out_len = base64_decode(encoded, enc_len, (uint8_t *)encoded);
+        ticks += rt_tick_get() - start;
+    }
+    rt_kprintf("decode  table in-place  %6d\n", b64_bench_mbps(enc_len, rounds, ticks));
+    if (out_len != len || memcmp(encoded, data, len) != 0)
+    {
+        failures++;
+    }
+
+    rt_free(data);
+    rt_free(decoded);
+    rt_free(encoded);
+
+    return failures == 0 ? 0 : -1;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+#include <finsh.h>
+
+static int cmd_base64_bench(int argc, char **argv)
+{
+    return base64_bench(argc > 1 ? atoi(argv[1]) : 64);
+}
+MSH_CMD_EXPORT_ALIAS(cmd_base64_bench, base64_bench, Base64 codec benchmark: base64_bench [KB]);
+#endif
+
+#ifdef BASE64_BENCH_MAIN
+int main(int argc, char **argv)
+{
+    return base64_bench(argc > 1 ? atoi(argv[1]) : 64) == 0 ? 0 : 1;
+}
+#endif
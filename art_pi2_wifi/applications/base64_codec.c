@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Table-driven base64 codec
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include "base64_codec.h"
+
+/* 反查表中的特殊值：最高位为1表示不是编码字符 */
+#define B64_INVALID     0xFF
+#define B64_PAD         0xFE
+
+/*
+ * 4个字符/字节与32位字的对应关系。用memcpy读写未对齐的字，
+ * GCC在Cortex-M7上会内联为单条LDR/STR（rt_memcpy是函数调用，不能内联）
+ */
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define B64_WORD(a, b, c, d)    (((uint32_t)(a) << 24) | ((uint32_t)(b) << 16) | ((uint32_t)(c) << 8) | (uint32_t)(d))
+#define B64_BYTE(word, n)       (((word) >> (24 - 8 * (n))) & 0xFF)
+#else
+#define B64_WORD(a, b, c, d)    ((uint32_t)(a) | ((uint32_t)(b) << 8) | ((uint32_t)(c) << 16) | ((uint32_t)(d) << 24))
+#define B64_BYTE(word, n)       (((word) >> (8 * (n))) & 0xFF)
+#endif
+
+static const char base64_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/* 字符到6bit值的反查表，'='为B64_PAD，其他非编码字符为B64_INVALID */
+static const uint8_t base64_reverse[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+/* 3字节编码为4个字符，一次写出一个字 */
+rt_inline void base64_encode_triple(uint8_t a, uint8_t b, uint8_t c, char *dst)
+{
+    uint32_t triple = ((uint32_t)a << 16) | ((uint32_t)b << 8) | c;
+    uint32_t word = B64_WORD(base64_alphabet[triple >> 18],
+                             base64_alphabet[(triple >> 12) & 0x3F],
+                             base64_alphabet[(triple >> 6) & 0x3F],
+                             base64_alphabet[triple & 0x3F]);
+
+    memcpy(dst, &word, 4);
+}
+
+/* 末尾1或2个字节编码并补'=' */
+static void base64_encode_tail(const uint8_t *src, uint32_t len, char *dst)
+{
+    uint8_t a = src[0];
+    uint8_t b = len > 1 ? src[1] : 0;
+
+    base64_encode_triple(a, b, 0, dst);
+    if (len == 1)
+    {
+        dst[2] = '=';
+    }
+    dst[3] = '=';
+}
+
+uint32_t base64_encode(const uint8_t *src, uint32_t len, char *dst)
+{
+    uint32_t full = len / 3;
+    uint32_t tail = len % 3;
+    uint32_t i;
+
+    /*
+     * 从尾部向前编码：第i组的输出位置4i不小于输入位置3i，
+     * 写出时覆盖的只是已经读过的输入，因此dst可以与src相同
+     */
+    if (tail)
+    {
+        uint8_t rest[2];
+
+        rest[0] = src[full * 3];
+        rest[1] = tail > 1 ? src[full * 3 + 1] : 0;
+        base64_encode_tail(rest, tail, dst + full * 4);
+    }
+
+    for (i = full; i-- > 0;)
+    {
+        const uint8_t *in = src + i * 3;
+        base64_encode_triple(in[0], in[1], in[2], dst + i * 4);
+    }
+
+    return BASE64_ENCODED_LEN(len);
+}
+
+void base64_encoder_init(base64_encoder_t *enc)
+{
+    rt_memset(enc, 0, sizeof(base64_encoder_t));
+}
+
+uint32_t base64_encode_update(base64_encoder_t *enc, const uint8_t *src, uint32_t len, char *dst)
+{
+    const uint8_t *end = src + len;
+    char *out = dst;
+
+    /* 先凑满上一段遗留的字节 */
+    if (enc->carry_len > 0)
+    {
+        uint32_t need = 3 - enc->carry_len;
+
+        if (len < need)
+        {
+            rt_memcpy(enc->carry + enc->carry_len, src, len);
+            enc->carry_len += len;
+            return 0;
+        }
+
+        base64_encode_triple(enc->carry[0], enc->carry_len > 1 ? enc->carry[1] : src[0],
+                             src[need - 1], out);
+        src += need;
+        out += 4;
+        enc->carry_len = 0;
+    }
+
+    while (end - src >= 3)
+    {
+        base64_encode_triple(src[0], src[1], src[2], out);
+        src += 3;
+        out += 4;
+    }
+
+    while (src < end)
+    {
+        enc->carry[enc->carry_len++] = *src++;
+    }
+
+    return (uint32_t)(out - dst);
+}
+
+uint32_t base64_encode_final(base64_encoder_t *enc, char *dst)
+{
+    uint32_t len = enc->carry_len;
+
+    if (len == 0)
+    {
+        return 0;
+    }
+
+    base64_encode_tail(enc->carry, len, dst);
+    enc->carry_len = 0;
+
+    return 4;
+}
+
+void base64_decoder_init(base64_decoder_t *dec)
+{
+    rt_memset(dec, 0, sizeof(base64_decoder_t));
+}
+
+uint32_t base64_decode_update(base64_decoder_t *dec, const char *src, uint32_t len, uint8_t *dst)
+{
+    const uint8_t *p = (const uint8_t *)src;
+    const uint8_t *end = p + len;
+    uint8_t *out = dst;
+    uint32_t bits = dec->bits;
+    uint32_t bit_count = dec->bit_count;
+    uint32_t value;
+
+    while (p < end)
+    {
+        if (bit_count == 0)
+        {
+            /* 整组快速路径：4个字符一次读入，任一字符无效时退回逐字符处理 */
+            while (end - p >= 4)
+            {
+                uint32_t word, a, b, c, d, triple;
+
+                memcpy(&word, p, 4);
+                a = base64_reverse[B64_BYTE(word, 0)];
+                b = base64_reverse[B64_BYTE(word, 1)];
+                c = base64_reverse[B64_BYTE(word, 2)];
+                d = base64_reverse[B64_BYTE(word, 3)];
+                if ((a | b | c | d) & 0x80)
+                {
+                    break;
+                }
+
+                triple = (a << 18) | (b << 12) | (c << 6) | d;
+                out[0] = (uint8_t)(triple >> 16);
+                out[1] = (uint8_t)(triple >> 8);
+                out[2] = (uint8_t)triple;
+                out += 3;
+                p += 4;
+            }
+            if (p >= end)
+            {
+                break;
+            }
+        }
+
+        /* 逐字符：每个字符最多输出一个字节，输出位置不会超过输入位置 */
+        value = base64_reverse[*p++];
+        if (value & 0x80)
+        {
+            if (value == B64_PAD)
+            {
+                /* 填充结束一组，剩余比特丢弃；分别编码后拼接的数据也能正确解码 */
+                bits = 0;
+                bit_count = 0;
+            }
+            continue;
+        }
+
+        bits = (bits << 6) | value;
+        bit_count += 6;
+        if (bit_count >= 8)
+        {
+            bit_count -= 8;
+            *out++ = (uint8_t)(bits >> bit_count);
+            bits &= (1U << bit_count) - 1;
+        }
+    }
+
+    dec->bits = bits;
+    dec->bit_count = (uint8_t)bit_count;
+
+    return (uint32_t)(out - dst);
+}
+
+uint32_t base64_decode(const char *src, uint32_t len, uint8_t *dst)
+{
+    base64_decoder_t dec;
+
+    base64_decoder_init(&dec);
+    return base64_decode_update(&dec, src, len, dst);
+}
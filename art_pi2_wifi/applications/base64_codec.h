@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Table-driven base64 codec
+ */
+
+#ifndef __BASE64_CODEC_H__
+#define __BASE64_CODEC_H__
+
+/*
+ * 标准Base64（RFC 4648，+/ 字母表）编解码：
+ *   - 解码查256项反查表，每次读入4个字符作为一个32位字处理，整组有效时一次输出3字节
+ *   - 流式解码跳过非编码字符（换行、引号等），数据可以在任意位置分段；
+ *     填充'='结束当前一组，分别编码后拼接起来的数据也能正确解码
+ *   - 解码每读一个字符最多输出一个字节，因此 dst 可以与 src 相同（原地解码）
+ *   - 编码 dst 可以与 src 相同（从尾部向前编码），缓冲区须能容纳 BASE64_ENCODED_LEN(len)
+ */
+
+#include <rtthread.h>
+
+/* 编码输出字符数（含填充，不含结束符）*/
+#define BASE64_ENCODED_LEN(len)     (((len) + 2) / 3 * 4)
+
+/* 解码一段输入最多输出的字节数（含上一段遗留的比特）*/
+#define BASE64_DECODED_MAX(len)     ((len) / 4 * 3 + 3)
+
+/* 流式编码状态：不足3字节的部分留到下一段 */
+typedef struct {
+    uint8_t carry[2];
+    uint8_t carry_len;
+} base64_encoder_t;
+
+/* 流式解码状态：不足8位的比特留到下一段 */
+typedef struct {
+    uint32_t bits;
+    uint8_t bit_count;
+} base64_decoder_t;
+
+/* 一次性编码，末尾补'='，返回输出字符数 */
+uint32_t base64_encode(const uint8_t *src, uint32_t len, char *dst);
+
+void base64_encoder_init(base64_encoder_t *enc);
+
+/* 编码一段数据，返回输出字符数（最多 BASE64_ENCODED_LEN(len + 2)）*/
+uint32_t base64_encode_update(base64_encoder_t *enc, const uint8_t *src, uint32_t len, char *dst);
+
+/* 输出剩余字节并补'='，返回输出字符数（0或4）*/
+uint32_t base64_encode_final(base64_encoder_t *enc, char *dst);
+
+/* 一次性解码，跳过非编码字符，返回输出字节数 */
+uint32_t base64_decode(const char *src, uint32_t len, uint8_t *dst);
+
+void base64_decoder_init(base64_decoder_t *dec);
+
+/* 解码一段数据，返回输出字节数；结尾不足一个字节的比特（填充部分）直接丢弃即可 */
+uint32_t base64_decode_update(base64_decoder_t *dec, const char *src, uint32_t len, uint8_t *dst);
+
+#endif /* __BASE64_CODEC_H__ */
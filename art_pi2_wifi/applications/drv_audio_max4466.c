@@ -6,6 +6,8 @@
 #include <rtthread.h>
 #include <rtdevice.h>
 #include "drv_audio_max4466.h"
+#include "audio_frontend.h"
+#include "audio_capture_ring.h"
 #include "stm32h7rsxx_hal.h"
 
 #define DBG_TAG "drv.mic"
@@ -17,32 +19,61 @@ extern ADC_HandleTypeDef hadc1;
 extern DMA_HandleTypeDef handle_GPDMA1_Channel0;
 
 /* 音频采集缓冲区（双缓冲）*/
-#define AUDIO_BUFFER_SIZE  1024  /* 每个缓冲区样本数 */
+#define AUDIO_BUFFER_SIZE  AUDIO_CAPTURE_BLOCK_SAMPLES  /* 每个缓冲区样本数 */
 static uint16_t adc_buffer[AUDIO_BUFFER_SIZE * 2];  /* 双缓冲 */
 
+/* PCM环形缓冲区：DMA回调单生产者，audio_capture_read单消费者（见audio_capture_ring.h）*/
+static rt_uint8_t audio_ring_pool[AUDIO_CAPTURE_RING_SIZE];
+
+#if AUDIO_FE_ENABLE
+/* 前端处理（去直流/高通/AGC）状态和耗时统计，只在DMA中断中更新 */
+static struct {
+    audio_fe_t fe;
+    rt_bool_t ready;
+    uint32_t last_cycles;
+    uint32_t max_cycles;
+    uint64_t total_cycles;
+    uint32_t total_samples;
+    uint32_t over_budget;
+} audio_fe_ctrl;
+#endif
+
 /* 音频采集控制 */
 static struct {
     rt_bool_t is_recording;
     audio_capture_callback callback;
     void *user_data;
+    rt_bool_t ring_ready;
+    audio_capture_ring_t ring;
 } audio_capture_ctrl = {
     .is_recording = RT_FALSE,
     .callback = RT_NULL,
-    .user_data = RT_NULL
+    .user_data = RT_NULL,
+    .ring_ready = RT_FALSE
 };
 
+/* 发布一个半缓冲区（在DMA中断上下文中调用）*/
+static void audio_capture_publish(uint16_t *adc_data, uint32_t count)
+{
+    /* 回调模式：数据直接交给调用者，不进入环形缓冲区 */
+    if (audio_capture_ctrl.callback)
+    {
+        audio_capture_ctrl.callback(adc_data, count, audio_capture_ctrl.user_data);
+        return;
+    }
+
+    /* 原地转换为16bit PCM（DMA此时正在写另一半缓冲区）*/
+    audio_process_samples(adc_data, (int16_t *)adc_data, count);
+    audio_capture_ring_put(&audio_capture_ctrl.ring, (int16_t *)adc_data, count);
+}
+
 /* ADC转换完成回调（半满）*/
 void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
 {
     if (hadc == &hadc1)
     {
         /* 处理前半部分缓冲区数据 */
-        if (audio_capture_ctrl.callback)
-        {
-            audio_capture_ctrl.callback(adc_buffer, 
-                                       AUDIO_BUFFER_SIZE,
-                                       audio_capture_ctrl.user_data);
-        }
+        audio_capture_publish(adc_buffer, AUDIO_BUFFER_SIZE);
     }
 }
 
@@ -52,12 +83,7 @@ void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
     if (hadc == &hadc1)
     {
         /* 处理后半部分缓冲区数据 */
-        if (audio_capture_ctrl.callback)
-        {
-            audio_capture_ctrl.callback(&adc_buffer[AUDIO_BUFFER_SIZE], 
-                                       AUDIO_BUFFER_SIZE,
-                                       audio_capture_ctrl.user_data);
-        }
+        audio_capture_publish(&adc_buffer[AUDIO_BUFFER_SIZE], AUDIO_BUFFER_SIZE);
     }
 }
 
@@ -66,6 +92,29 @@ rt_err_t audio_capture_init(void)
 {
     LOG_I("MAX4466 audio capture init");
     
+#if AUDIO_FE_ENABLE
+    if (!audio_fe_ctrl.ready)
+    {
+        audio_fe_init(&audio_fe_ctrl.fe, AUDIO_SAMPLE_RATE, AUDIO_FE_DEFAULT);
+        audio_fe_ctrl.ready = RT_TRUE;
+    }
+    
+    /* 周期计数器用于统计前端处理耗时 */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    
+    /* 创建环形缓冲区和数据信号量 */
+    if (!audio_capture_ctrl.ring_ready)
+    {
+        if (audio_capture_ring_init(&audio_capture_ctrl.ring, audio_ring_pool, sizeof(audio_ring_pool)) != RT_EOK)
+        {
+            LOG_E("Failed to create capture semaphore");
+            return -RT_ERROR;
+        }
+        audio_capture_ctrl.ring_ready = RT_TRUE;
+    }
+    
     /* 链接DMA到ADC */
     __HAL_LINKDMA(&hadc1, DMA_Handle, handle_GPDMA1_Channel0);
     
@@ -89,6 +138,17 @@ rt_err_t audio_capture_start(audio_capture_callback callback, void *user_data)
         return -RT_ERROR;
     }
     
+    if (!audio_capture_ctrl.ring_ready)
+    {
+        LOG_E("Audio capture not initialized");
+        return -RT_ERROR;
+    }
+    
+    audio_capture_ring_start(&audio_capture_ctrl.ring);
+#if AUDIO_FE_ENABLE
+    /* 新的采集从1倍增益、空滤波器状态开始，偏置估计保留 */
+    audio_fe_reset(&audio_fe_ctrl.fe);
+#endif
     audio_capture_ctrl.callback = callback;
     audio_capture_ctrl.user_data = user_data;
     audio_capture_ctrl.is_recording = RT_TRUE;
@@ -99,6 +159,7 @@ rt_err_t audio_capture_start(audio_capture_callback callback, void *user_data)
     {
         LOG_E("Failed to start ADC DMA");
         audio_capture_ctrl.is_recording = RT_FALSE;
+        audio_capture_ring_stop(&audio_capture_ctrl.ring);
         return -RT_ERROR;
     }
     
@@ -120,7 +181,11 @@ rt_err_t audio_capture_stop(void)
     audio_capture_ctrl.callback = RT_NULL;
     audio_capture_ctrl.user_data = RT_NULL;
     
-    LOG_I("Audio capture stopped");
+    /* 唤醒可能阻塞在audio_capture_read中的线程 */
+    audio_capture_ring_stop(&audio_capture_ctrl.ring);
+    
+    LOG_I("Audio capture stopped (blocks: %d, overruns: %d)",
+          audio_capture_ctrl.ring.stats.blocks, audio_capture_ctrl.ring.stats.overruns);
     return RT_EOK;
 }
 
@@ -130,9 +195,33 @@ rt_bool_t audio_capture_is_recording(void)
     return audio_capture_ctrl.is_recording;
 }
 
-/* 音频数据处理：ADC原始值 → PCM 16bit */
+/* 音频数据处理：ADC原始值 → PCM 16bit（在DMA中断中调用，adc_data与pcm_data可以相同）*/
 void audio_process_samples(uint16_t *adc_data, int16_t *pcm_data, uint32_t count)
 {
+#if AUDIO_FE_ENABLE
+    uint32_t start, cycles;
+    
+    if (audio_fe_ctrl.ready)
+    {
+        start = DWT->CYCCNT;
+        audio_fe_process(&audio_fe_ctrl.fe, adc_data, pcm_data, count);
+        cycles = DWT->CYCCNT - start;
+        
+        audio_fe_ctrl.last_cycles = cycles;
+        if (cycles > audio_fe_ctrl.max_cycles)
+        {
+            audio_fe_ctrl.max_cycles = cycles;
+        }
+        audio_fe_ctrl.total_cycles += cycles;
+        audio_fe_ctrl.total_samples += count;
+        if (cycles > count * AUDIO_FE_CYCLES_PER_SAMPLE)
+        {
+            audio_fe_ctrl.over_budget++;
+        }
+        return;
+    }
+#endif
+    
     for (uint32_t i = 0; i < count; i++)
     {
         /* ADC: 12bit, 0-4095, 中心点约2048 */
@@ -148,19 +237,111 @@ void audio_process_samples(uint16_t *adc_data, int16_t *pcm_data, uint32_t count
     }
 }
 
-/* 读取音频数据（兼容旧API）*/
-int audio_capture_read(uint8_t *buffer, uint32_t size, uint32_t timeout)
+/* 设置前端处理选项，返回原来的选项 */
+uint32_t audio_capture_set_frontend(uint32_t flags)
 {
-    if (!audio_capture_ctrl.is_recording)
+#if AUDIO_FE_ENABLE
+    uint32_t old;
+    rt_base_t level;
+    
+    if (!audio_fe_ctrl.ready)
     {
-        return -RT_ERROR;
+        audio_fe_init(&audio_fe_ctrl.fe, AUDIO_SAMPLE_RATE, AUDIO_FE_DEFAULT);
+        audio_fe_ctrl.ready = RT_TRUE;
     }
     
-    /* 简化实现：返回当前缓冲区数据 */
-    /* 注意：这是一个简化版本，实际应该使用队列或环形缓冲 */
-    uint32_t copy_size = size > AUDIO_BUFFER_SIZE * 2 ? AUDIO_BUFFER_SIZE * 2 : size;
-    rt_memcpy(buffer, adc_buffer, copy_size);
+    /* 与DMA中断互斥，切换时清除滤波器状态 */
+    level = rt_hw_interrupt_disable();
+    old = audio_fe_ctrl.fe.flags;
+    audio_fe_ctrl.fe.flags = flags;
+    audio_fe_reset(&audio_fe_ctrl.fe);
+    rt_hw_interrupt_enable(level);
     
-    return copy_size;
+    return old;
+#else
+    (void)flags;
+    return 0;
+#endif
+}
+
+/* 读取PCM数据：无数据时阻塞等待，超时返回0 */
+int audio_capture_read(uint8_t *buffer, uint32_t size, uint32_t timeout)
+{
+    return audio_capture_ring_read(&audio_capture_ctrl.ring, buffer, size, timeout);
 }
 
+/* 获取采集统计 */
+void audio_capture_get_stats(audio_capture_stats_t *stats)
+{
+    if (stats)
+    {
+        *stats = audio_capture_ctrl.ring.stats;
+    }
+}
+
+#ifdef FINSH_USING_MSH
+#if AUDIO_FE_ENABLE
+/* 前端处理状态：mic_fe [dc|hpf|agc|all|raw]... */
+static int mic_fe(int argc, char **argv)
+{
+    audio_fe_t *fe = &audio_fe_ctrl.fe;
+    uint32_t avg_x10;
+
+    if (argc > 1)
+    {
+        uint32_t flags = 0;
+
+        for (int i = 1; i < argc; i++)
+        {
+            if (!rt_strcmp(argv[i], "dc"))
+            {
+                flags |= AUDIO_FE_DC;
+            }
+            else if (!rt_strcmp(argv[i], "hpf"))
+            {
+                flags |= AUDIO_FE_HIGHPASS;
+            }
+            else if (!rt_strcmp(argv[i], "agc"))
+            {
+                flags |= AUDIO_FE_AGC;
+            }
+            else if (!rt_strcmp(argv[i], "all"))
+            {
+                flags |= AUDIO_FE_DEFAULT;
+            }
+            else if (rt_strcmp(argv[i], "raw"))
+            {
+                rt_kprintf("Usage: mic_fe [dc|hpf|agc|all|raw]...\n");
+                return -RT_EINVAL;
+            }
+        }
+        audio_capture_set_frontend(flags);
+    }
+    else if (!audio_fe_ctrl.ready)
+    {
+        audio_capture_set_frontend(AUDIO_FE_DEFAULT);
+    }
+
+    rt_kprintf("Stages: %s%s%s%s\n",
+               fe->flags & AUDIO_FE_DC ? "dc " : "",
+               fe->flags & AUDIO_FE_HIGHPASS ? "hpf " : "",
+               fe->flags & AUDIO_FE_AGC ? "agc " : "",
+               fe->flags ? "" : "raw (fixed 2048 offset)");
+    rt_kprintf("DC offset: %d.%02d  gain: %d.%02dx  peak: %d\n",
+               fe->dc >> 8, (fe->dc & 0xFF) * 100 / 256,
+               fe->gain / AUDIO_FE_GAIN_ONE, (fe->gain % AUDIO_FE_GAIN_ONE) * 100 / AUDIO_FE_GAIN_ONE,
+               fe->peak);
+
+    avg_x10 = audio_fe_ctrl.total_samples ?
+              (uint32_t)(audio_fe_ctrl.total_cycles * 10 / audio_fe_ctrl.total_samples) : 0;
+    rt_kprintf("Blocks: %d  cycles/block last %d, max %d (budget %d)\n",
+               fe->blocks, audio_fe_ctrl.last_cycles, audio_fe_ctrl.max_cycles,
+               AUDIO_BUFFER_SIZE * AUDIO_FE_CYCLES_PER_SAMPLE);
+    rt_kprintf("Cycles/sample: %d.%d avg, over budget: %d blocks\n",
+               avg_x10 / 10, avg_x10 % 10, audio_fe_ctrl.over_budget);
+
+    return 0;
+}
+MSH_CMD_EXPORT(mic_fe, show or select microphone front end stages);
+#endif /* AUDIO_FE_ENABLE */
+#endif /* FINSH_USING_MSH */
@@ -12,13 +12,20 @@
 #define AUDIO_BITS           12     /* ADC 12bit */
 #define AUDIO_CHANNELS       1      /* 单声道 */
 
+/* 采集环形缓冲区统计 */
+typedef struct {
+    uint32_t blocks;      /* 已写入环形缓冲区的半缓冲区数量 */
+    uint32_t overruns;    /* 因缓冲区满而丢弃的半缓冲区数量 */
+    uint32_t max_fill;    /* 缓冲区最高水位（字节）*/
+} audio_capture_stats_t;
+
 /* 音频采集回调函数类型 */
 typedef void (*audio_capture_callback)(uint16_t *data, uint32_t size, void *user_data);
 
 /* 初始化音频采集 */
 rt_err_t audio_capture_init(void);
 
-/* 开始录音 */
+/* 开始录音（callback为RT_NULL时数据写入环形缓冲区，用audio_capture_read读取）*/
 rt_err_t audio_capture_start(audio_capture_callback callback, void *user_data);
 
 /* 停止录音 */
@@ -27,8 +34,17 @@ rt_err_t audio_capture_stop(void);
 /* 获取录音状态 */
 rt_bool_t audio_capture_is_recording(void);
 
-/* 音频数据处理 */
+/* 读取16bit PCM数据，无数据时最多阻塞timeout毫秒，超时返回0 */
+int audio_capture_read(uint8_t *buffer, uint32_t size, uint32_t timeout);
+
+/* 获取采集统计 */
+void audio_capture_get_stats(audio_capture_stats_t *stats);
+
+/* 音频数据处理：前端（去直流/高通/AGC，见audio_frontend.h）处理一块ADC数据 */
 void audio_process_samples(uint16_t *adc_data, int16_t *pcm_data, uint32_t count);
 
+/* 设置前端处理选项（AUDIO_FE_*，0为固定偏置2048的原始换算），返回原来的选项 */
+uint32_t audio_capture_set_frontend(uint32_t flags);
+
 #endif /* __DRV_AUDIO_MAX4466_H__ */
 
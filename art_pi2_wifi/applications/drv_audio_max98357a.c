@@ -8,6 +8,7 @@
 
 #include <rtthread.h>
 #include <rtdevice.h>
+#include <stdlib.h>
 #include "drv_audio_max98357a.h"
 #include "stm32h7rsxx_hal.h"
 
@@ -57,6 +58,19 @@ struct rt_audio_device
     struct rt_audio_ops *ops;
 };
 
+/* 设备写接口转发到 ops->transmit */
+static rt_ssize_t rt_audio_write(rt_device_t dev, rt_off_t pos, const void *buffer, rt_size_t size)
+{
+    struct rt_audio_device *audio = (struct rt_audio_device *)dev;
+    
+    if (audio->ops == RT_NULL || audio->ops->transmit == RT_NULL)
+    {
+        return 0;
+    }
+    
+    return audio->ops->transmit(audio, buffer, size);
+}
+
 /* 简化的audio注册函数 */
 rt_err_t rt_audio_register(struct rt_audio_device *audio, const char *name, rt_uint32_t flag, void *data)
 {
@@ -71,7 +85,7 @@ rt_err_t rt_audio_register(struct rt_audio_device *audio, const char *name, rt_u
     device->open    = RT_NULL;
     device->close   = RT_NULL;
     device->read    = RT_NULL;
-    device->write   = RT_NULL;
+    device->write   = rt_audio_write;
     device->control = RT_NULL;
     
     device->user_data = data;
@@ -89,33 +103,286 @@ extern I2S_HandleTypeDef hi2s1;
 /* 音频设备控制块 */
 static struct rt_audio_device audio_dev = {0};
 
-/* DMA 传输完成标志 */
-static rt_sem_t dma_sem = RT_NULL;
+/* ==================== 流式播放 ==================== */
+
+/*
+ * 乒乓缓冲：I2S1通过GPDMA1 Channel2循环发送 stream_dma_buf，
+ * 半满/全满中断里从环形缓冲区取出单声道PCM，复制成L/R两路填入刚播完的半区。
+ * 生产者只需写环形缓冲区，数据不足时补静音并计为一次欠载（见 audio_playback_ring.h）。
+ */
+#define STREAM_HALF_SAMPLES     (MAX98357A_DMA_FRAMES * 2)  /* 每个半区的int16个数 (L/R交替) */
+#define STREAM_HALF_MS          (MAX98357A_DMA_FRAMES * 1000 / MAX98357A_SAMPLE_RATE)
+
+/* Channel0为ADC1采集，dma_config.h中UART4的DMA中断映射到Channel0/1，这里用没有驱动占用的Channel2 */
+#define STREAM_DMA_CHANNEL      GPDMA1_Channel2
+#define STREAM_DMA_IRQn         GPDMA1_Channel2_IRQn
+#define STREAM_DMA_IRQHandler   GPDMA1_Channel2_IRQHandler
+
+/* DMA直接从SRAM读取，缓冲区和链表节点按cache行对齐，CPU写入后需要清理D-Cache */
+rt_align(32) static int16_t stream_dma_buf[STREAM_HALF_SAMPLES * 2];
+rt_align(32) static DMA_NodeTypeDef stream_dma_node;
+static DMA_QListTypeDef stream_dma_list;
+static DMA_HandleTypeDef stream_dma_handle;
+
+static struct {
+    rt_bool_t dma_ready;
+    rt_bool_t ring_ready;
+    max98357a_backend_t backend;
+    audio_playback_ring_t ring;
+    uint8_t ring_pool[MAX98357A_RING_SIZE];
+    rt_timer_t sim_timer;
+    uint32_t sim_half;
+} stream_ctrl;
+
+/* 填充一个半区 (中断上下文)，I2S后端随后清理D-Cache */
+static void stream_refill(uint32_t half)
+{
+    int16_t *dst = &stream_dma_buf[half * STREAM_HALF_SAMPLES];
+
+    audio_playback_ring_fill(&stream_ctrl.ring, dst, MAX98357A_DMA_FRAMES);
 
-/* DMA 传输完成回调 */
+    if (stream_ctrl.backend == MAX98357A_BACKEND_I2S)
+    {
+        SCB_CleanDCache_by_Addr((uint32_t *)dst, STREAM_HALF_SAMPLES * sizeof(int16_t));
+    }
+}
+
+/* DMA 半满回调：前半区已送出 */
+void HAL_I2S_TxHalfCpltCallback(I2S_HandleTypeDef *hi2s)
+{
+    if (hi2s == &hi2s1 && stream_ctrl.ring.running)
+    {
+        stream_refill(0);
+    }
+}
+
+/* DMA 全满回调：后半区已送出，DMA回到缓冲区开头 */
 void HAL_I2S_TxCpltCallback(I2S_HandleTypeDef *hi2s)
 {
-    if (hi2s == &hi2s1)
+    if (hi2s == &hi2s1 && stream_ctrl.ring.running)
     {
-        rt_sem_release(dma_sem);
+        stream_refill(1);
     }
 }
 
-/* 初始化 I2S 外设 */
-static rt_err_t audio_init(struct rt_audio_device *audio)
+void STREAM_DMA_IRQHandler(void)
 {
-    LOG_I("MAX98357A audio init");
-    
-    /* 创建 DMA 传输信号量 */
-    if (dma_sem == RT_NULL)
+    rt_interrupt_enter();
+    HAL_DMA_IRQHandler(&stream_dma_handle);
+    rt_interrupt_leave();
+}
+
+/* 模拟后端：软件定时器按半区时长触发，代替DMA中断 */
+static void stream_sim_timeout(void *parameter)
+{
+    stream_refill(stream_ctrl.sim_half);
+    stream_ctrl.sim_half ^= 1;
+}
+
+/* 配置 SPI1_TX 的GPDMA循环链表，与ADC1采集 (Channel0) 的配置方式相同 */
+static rt_err_t stream_dma_init(void)
+{
+    DMA_NodeConfTypeDef node_config = {0};
+
+    if (stream_ctrl.dma_ready)
+    {
+        return RT_EOK;
+    }
+
+    node_config.NodeType = DMA_GPDMA_LINEAR_NODE;
+    node_config.Init.Request = GPDMA1_REQUEST_SPI1_TX;
+    node_config.Init.BlkHWRequest = DMA_BREQ_SINGLE_BURST;
+    node_config.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    node_config.Init.SrcInc = DMA_SINC_INCREMENTED;
+    node_config.Init.DestInc = DMA_DINC_FIXED;
+    node_config.Init.SrcDataWidth = DMA_SRC_DATAWIDTH_HALFWORD;
+    node_config.Init.DestDataWidth = DMA_DEST_DATAWIDTH_HALFWORD;
+    node_config.Init.SrcBurstLength = 1;
+    node_config.Init.DestBurstLength = 1;
+    node_config.Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT0;
+    node_config.Init.TransferEventMode = DMA_TCEM_BLOCK_TRANSFER;
+    node_config.Init.Mode = DMA_NORMAL;
+    node_config.TriggerConfig.TriggerPolarity = DMA_TRIG_POLARITY_MASKED;
+    node_config.DataHandlingConfig.DataExchange = DMA_EXCHANGE_NONE;
+    node_config.DataHandlingConfig.DataAlignment = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+    /* 预先填入地址和长度，与 HAL_I2S_Transmit_DMA 写入节点的值一致 */
+    node_config.SrcAddress = (uint32_t)stream_dma_buf;
+    node_config.DstAddress = (uint32_t)&hi2s1.Instance->TXDR;
+    node_config.DataSize = sizeof(stream_dma_buf);
+
+    if (HAL_DMAEx_List_BuildNode(&node_config, &stream_dma_node) != HAL_OK ||
+        HAL_DMAEx_List_InsertNode(&stream_dma_list, NULL, &stream_dma_node) != HAL_OK ||
+        HAL_DMAEx_List_SetCircularMode(&stream_dma_list) != HAL_OK)
+    {
+        LOG_E("Build I2S DMA node failed");
+        return -RT_ERROR;
+    }
+
+    stream_dma_handle.Instance = STREAM_DMA_CHANNEL;
+    stream_dma_handle.InitLinkedList.Priority = DMA_HIGH_PRIORITY;
+    stream_dma_handle.InitLinkedList.LinkStepMode = DMA_LSM_FULL_EXECUTION;
+    stream_dma_handle.InitLinkedList.LinkAllocatedPort = DMA_LINK_ALLOCATED_PORT0;
+    stream_dma_handle.InitLinkedList.TransferEventMode = DMA_TCEM_BLOCK_TRANSFER;
+    stream_dma_handle.InitLinkedList.LinkedListMode = DMA_LINKEDLIST_CIRCULAR;
+    /* I2S的DMA完成回调按Init.Mode判断是否为单次传输，为DMA_NORMAL时会关闭TXDMAEN */
+    stream_dma_handle.Init.Mode = DMA_LINKEDLIST_CIRCULAR;
+    if (HAL_DMAEx_List_Init(&stream_dma_handle) != HAL_OK ||
+        HAL_DMAEx_List_LinkQ(&stream_dma_handle, &stream_dma_list) != HAL_OK)
+    {
+        LOG_E("Init I2S DMA channel failed");
+        return -RT_ERROR;
+    }
+
+    __HAL_LINKDMA(&hi2s1, hdmatx, stream_dma_handle);
+
+    if (HAL_DMA_ConfigChannelAttributes(&stream_dma_handle, DMA_CHANNEL_NPRIV) != HAL_OK)
+    {
+        LOG_E("Config I2S DMA attributes failed");
+        return -RT_ERROR;
+    }
+
+    /* 通道启动时DMA从SRAM加载链表节点 */
+    SCB_CleanDCache_by_Addr((uint32_t *)&stream_dma_node, sizeof(stream_dma_node));
+
+    HAL_NVIC_SetPriority(STREAM_DMA_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(STREAM_DMA_IRQn);
+
+    stream_ctrl.dma_ready = RT_TRUE;
+    return RT_EOK;
+}
+
+/* 启动流式播放：两个半区先填静音，随后由中断持续填充 */
+rt_err_t max98357a_stream_start(max98357a_backend_t backend)
+{
+    if (stream_ctrl.ring.running)
+    {
+        return RT_EOK;
+    }
+
+    if (!stream_ctrl.ring_ready)
     {
-        dma_sem = rt_sem_create("audio_dma", 0, RT_IPC_FLAG_FIFO);
-        if (dma_sem == RT_NULL)
+        if (audio_playback_ring_init(&stream_ctrl.ring, stream_ctrl.ring_pool, sizeof(stream_ctrl.ring_pool)) != RT_EOK)
         {
-            LOG_E("Create DMA semaphore failed");
+            LOG_E("Create stream semaphore failed");
+            return -RT_ENOMEM;
+        }
+        stream_ctrl.ring_ready = RT_TRUE;
+    }
+
+    stream_ctrl.backend = backend;
+    rt_memset(stream_dma_buf, 0, sizeof(stream_dma_buf));
+
+    if (backend == MAX98357A_BACKEND_I2S)
+    {
+        if (stream_dma_init() != RT_EOK)
+        {
+            return -RT_ERROR;
+        }
+
+        SCB_CleanDCache_by_Addr((uint32_t *)stream_dma_buf, sizeof(stream_dma_buf));
+        audio_playback_ring_start(&stream_ctrl.ring);
+
+        /* Size为16bit数据个数 */
+        if (HAL_I2S_Transmit_DMA(&hi2s1, (uint16_t *)stream_dma_buf,
+                                 STREAM_HALF_SAMPLES * 2) != HAL_OK)
+        {
+            audio_playback_ring_stop(&stream_ctrl.ring);
+            LOG_E("I2S DMA start failed");
             return -RT_ERROR;
         }
     }
+    else
+    {
+        if (stream_ctrl.sim_timer == RT_NULL)
+        {
+            stream_ctrl.sim_timer = rt_timer_create("spk_sim", stream_sim_timeout, RT_NULL,
+                                                    rt_tick_from_millisecond(STREAM_HALF_MS),
+                                                    RT_TIMER_FLAG_PERIODIC | RT_TIMER_FLAG_SOFT_TIMER);
+            if (stream_ctrl.sim_timer == RT_NULL)
+            {
+                LOG_E("Create sim timer failed");
+                return -RT_ENOMEM;
+            }
+        }
+
+        stream_ctrl.sim_half = 0;
+        audio_playback_ring_start(&stream_ctrl.ring);
+        rt_timer_start(stream_ctrl.sim_timer);
+    }
+
+    LOG_I("Speaker stream started (%s, %d frames x 2)",
+          backend == MAX98357A_BACKEND_I2S ? "i2s" : "sim", MAX98357A_DMA_FRAMES);
+    return RT_EOK;
+}
+
+/* 停止流式播放，丢弃未播放的数据 */
+rt_err_t max98357a_stream_stop(void)
+{
+    if (!stream_ctrl.ring.running)
+    {
+        return RT_EOK;
+    }
+
+    /* 先让中断不再填充，再停止DMA或定时器 */
+    stream_ctrl.ring.running = RT_FALSE;
+
+    if (stream_ctrl.backend == MAX98357A_BACKEND_I2S)
+    {
+        HAL_I2S_DMAStop(&hi2s1);
+    }
+    else
+    {
+        rt_timer_stop(stream_ctrl.sim_timer);
+    }
+
+    /* 唤醒阻塞在写入或排空中的线程 */
+    audio_playback_ring_stop(&stream_ctrl.ring);
+
+    LOG_I("Speaker stream stopped (halves: %d, underruns: %d)",
+          stream_ctrl.ring.stats.halves, stream_ctrl.ring.stats.underruns);
+    return RT_EOK;
+}
+
+/* 写入单声道PCM：环形缓冲区满时阻塞，返回实际写入的样本数 */
+int max98357a_stream_write(const int16_t *pcm, uint32_t samples, rt_int32_t timeout)
+{
+    return audio_playback_ring_write(&stream_ctrl.ring, pcm, samples, timeout);
+}
+
+/* 等待已写入的数据全部送到功放 */
+rt_err_t max98357a_stream_drain(rt_int32_t timeout)
+{
+    return audio_playback_ring_drain(&stream_ctrl.ring, timeout);
+}
+
+/* 环形缓冲区空闲的样本数 */
+uint32_t max98357a_stream_free(void)
+{
+    return audio_playback_ring_free(&stream_ctrl.ring);
+}
+
+rt_bool_t max98357a_stream_is_running(void)
+{
+    return stream_ctrl.ring.running;
+}
+
+void max98357a_stream_get_stats(max98357a_stream_stats_t *stats)
+{
+    if (stats)
+    {
+        *stats = stream_ctrl.ring.stats;
+    }
+}
+
+void max98357a_stream_set_monitor(max98357a_monitor_t monitor)
+{
+    stream_ctrl.ring.monitor = monitor;
+}
+
+/* 初始化 I2S 外设 */
+static rt_err_t audio_init(struct rt_audio_device *audio)
+{
+    LOG_I("MAX98357A audio init");
     
     /* 注意：I2S已经在board层初始化（cubemx_init.c），这里不需要再初始化 */
     LOG_I("I2S already initialized in board layer");
@@ -135,8 +402,7 @@ static rt_err_t audio_start(struct rt_audio_device *audio, rt_uint8_t stream)
 static rt_err_t audio_stop(struct rt_audio_device *audio, rt_uint8_t stream)
 {
     LOG_D("Audio stop");
-    HAL_I2S_DMAStop(&hi2s1);
-    return RT_EOK;
+    return max98357a_stream_stop();
 }
 
 /* 配置音频参数 */
@@ -180,8 +446,8 @@ static rt_err_t audio_config(struct rt_audio_device *audio, struct rt_audio_caps
             }
             
             /* 注意：运行时改变采样率需要重新初始化I2S */
-            /* 当前版本暂不支持动态改变采样率，使用固定16KHz */
-            LOG_W("Dynamic samplerate change not supported, using 16KHz");
+            /* I2S固定16KHz，其他采样率的PCM由 audio_player（audio_resampler）转换后写入 */
+            LOG_W("I2S stays at 16KHz, other rates are resampled by audio_player");
             break;
             
         case AUDIO_DSP_SAMPLERATE:
@@ -236,32 +502,32 @@ __attribute__((unused)) static rt_err_t audio_getcaps(struct rt_audio_device *au
     return result;
 }
 
-/* 发送音频数据（通过 DMA）*/
+/* 发送音频数据：写入流式播放环形缓冲区，首次写入时启动I2S DMA */
 static rt_size_t audio_transmit(struct rt_audio_device *audio, 
                                 const void *writeBuf, 
                                 rt_size_t size)
 {
-    const uint16_t *buf = (const uint16_t *)writeBuf;
-    rt_size_t count = size / 2;  /* 16bit 数据 */
+    int written;
     
-    LOG_D("Transmit %d bytes (%d samples)", size, count);
-    
-    /* 通过 DMA 发送数据 */
-    if (HAL_I2S_Transmit_DMA(&hi2s1, (uint16_t *)buf, count) != HAL_OK)
+    if (!max98357a_stream_is_running() &&
+        max98357a_stream_start(MAX98357A_BACKEND_I2S) != RT_EOK)
     {
-        LOG_E("I2S DMA transmit failed");
         return 0;
     }
     
-    /* 等待 DMA 传输完成 */
-    if (rt_sem_take(dma_sem, rt_tick_from_millisecond(1000)) != RT_EOK)
+    /* 缓冲区满时等待DMA取走数据，1秒内没有进展说明DMA已停止 */
+    written = max98357a_stream_write((const int16_t *)writeBuf, size / 2, 1000);
+    if (written < 0)
     {
-        LOG_W("DMA transmit timeout");
-        HAL_I2S_DMAStop(&hi2s1);
         return 0;
     }
     
-    return size;
+    if ((rt_size_t)written * 2 < size)
+    {
+        LOG_W("Stream write timeout (%d/%d samples)", written, size / 2);
+    }
+    
+    return written * 2;
 }
 
 /* Audio 设备操作接口 */
@@ -298,3 +564,110 @@ int rt_hw_audio_max98357a_init(void)
 }
 INIT_DEVICE_EXPORT(rt_hw_audio_max98357a_init);
 
+
+#ifdef FINSH_USING_MSH
+/* 流式播放测试：模拟后端按16ms节奏消费，写入递增序列 1..N，
+ * 监视回调跳过静音后按顺序校验L/R两路，检查是否有丢失、重复或欠载 */
+static volatile uint32_t stream_test_next;
+static volatile uint32_t stream_test_errors;
+
+static int16_t stream_test_value(uint32_t index)
+{
+    return (int16_t)(index % 30000 + 1);
+}
+
+static void stream_test_monitor(const int16_t *stereo, uint32_t frames)
+{
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        if (stereo[i * 2] == 0 && stereo[i * 2 + 1] == 0)
+        {
+            continue;
+        }
+
+        if (stereo[i * 2] != stereo[i * 2 + 1] ||
+            stereo[i * 2] != stream_test_value(stream_test_next))
+        {
+            stream_test_errors++;
+        }
+        stream_test_next++;
+    }
+}
+
+static int spk_stream_test(int argc, char **argv)
+{
+    uint32_t seconds = argc > 1 ? atoi(argv[1]) : 2;
+    uint32_t delay_ms = argc > 2 ? atoi(argv[2]) : 0;
+    uint32_t expect_total = seconds * MAX98357A_SAMPLE_RATE;
+    uint32_t sent = 0;
+    int16_t chunk[320];     /* 20ms，与TTS分片写入的粒度相近 */
+    max98357a_stream_stats_t stats;
+    rt_tick_t start;
+    rt_err_t drained;
+
+    if (max98357a_stream_is_running())
+    {
+        rt_kprintf("Speaker stream is running, stop it first\n");
+        return -RT_EBUSY;
+    }
+
+    stream_test_next = 0;
+    stream_test_errors = 0;
+    max98357a_stream_set_monitor(stream_test_monitor);
+
+    if (max98357a_stream_start(MAX98357A_BACKEND_SIM) != RT_EOK)
+    {
+        max98357a_stream_set_monitor(RT_NULL);
+        return -RT_ERROR;
+    }
+
+    start = rt_tick_get();
+    while (sent < expect_total)
+    {
+        uint32_t n = expect_total - sent;
+        int written;
+
+        if (n > sizeof(chunk) / sizeof(chunk[0]))
+        {
+            n = sizeof(chunk) / sizeof(chunk[0]);
+        }
+        for (uint32_t i = 0; i < n; i++)
+        {
+            chunk[i] = stream_test_value(sent + i);
+        }
+
+        written = max98357a_stream_write(chunk, n, 1000);
+        if (written != (int)n)
+        {
+            rt_kprintf("Write timeout after %d samples\n", sent);
+            break;
+        }
+        sent += n;
+
+        /* 生产者比实时慢时应当统计到欠载 */
+        if (delay_ms)
+        {
+            rt_thread_mdelay(delay_ms);
+        }
+    }
+
+    drained = max98357a_stream_drain(1000);
+    max98357a_stream_get_stats(&stats);
+    max98357a_stream_stop();
+    max98357a_stream_set_monitor(RT_NULL);
+
+    rt_kprintf("Samples: %d/%d played, errors: %d, drain: %s\n",
+               stream_test_next, expect_total, stream_test_errors,
+               drained == RT_EOK ? "ok" : "timeout");
+    rt_kprintf("Halves: %d, underruns: %d, min fill: %d/%d bytes, max interval: %d ms\n",
+               stats.halves, stats.underruns, stats.min_fill, MAX98357A_RING_SIZE,
+               stats.max_interval_ms);
+    rt_kprintf("Elapsed: %d ms (audio %d ms)\n",
+               rt_tick_get() - start, seconds * 1000);
+    rt_kprintf("Result: %s\n", (stream_test_next == expect_total && stream_test_errors == 0 &&
+                                 drained == RT_EOK && stats.underruns == 0) ? "PASS" : "FAIL");
+
+    return 0;
+}
+MSH_CMD_EXPORT(spk_stream_test, feed speaker stream through simulated I2S DMA: [seconds] [delay_ms]);
+#endif /* FINSH_USING_MSH */
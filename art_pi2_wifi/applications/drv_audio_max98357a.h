@@ -11,6 +11,7 @@
 
 #include <rtthread.h>
 #include <rtdevice.h>
+#include "audio_playback_ring.h"
 
 /* 包含 STM32 HAL 库 */
 #include "stm32h7rsxx_hal.h"
@@ -20,8 +21,32 @@
 #define MAX98357A_CHANNELS       1      /* 单声道 */
 #define MAX98357A_BITS           16     /* 16位 */
 
+/* 流式播放配置 */
+#define MAX98357A_DMA_FRAMES     256    /* 每个DMA半缓冲区的立体声帧数 (16ms) */
+#define MAX98357A_RING_SIZE      (1024 * 8)  /* 生产者环形缓冲区 (单声道PCM，256ms) */
+
+/* 流式播放后端 */
+typedef enum {
+    MAX98357A_BACKEND_I2S = 0,  /* I2S1 + GPDMA循环传输 */
+    MAX98357A_BACKEND_SIM       /* 软件定时器模拟DMA半缓冲区中断，不需要功放硬件 */
+} max98357a_backend_t;
+
+/* 流式播放统计和测试用监视回调，与播放环形缓冲区相同 */
+typedef audio_playback_stats_t max98357a_stream_stats_t;
+typedef audio_playback_monitor_t max98357a_monitor_t;
+
 /* 初始化函数 */
 int rt_hw_audio_max98357a_init(void);
 
+/* 流式播放接口：16bit单声道PCM写入环形缓冲区，由DMA乒乓缓冲区连续输出 */
+rt_err_t max98357a_stream_start(max98357a_backend_t backend);
+rt_err_t max98357a_stream_stop(void);
+int max98357a_stream_write(const int16_t *pcm, uint32_t samples, rt_int32_t timeout);
+rt_err_t max98357a_stream_drain(rt_int32_t timeout);
+uint32_t max98357a_stream_free(void);
+rt_bool_t max98357a_stream_is_running(void);
+void max98357a_stream_get_stats(max98357a_stream_stats_t *stats);
+void max98357a_stream_set_monitor(max98357a_monitor_t monitor);
+
 #endif /* __DRV_AUDIO_MAX98357A_H__ */
 
@@ -0,0 +1,768 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Streaming JSON tokenizer
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include "json_stream.h"
+#include "ai_arena.h"
+
+#define DBG_TAG "json"
+#define DBG_LVL DBG_INFO
+#include <rtdbg.h>
+
+/* 解析状态 */
+enum {
+    JSON_S_VALUE = 0,           /* 期待一个值 */
+    JSON_S_VALUE_OR_END,        /* '[' 之后：值或 ']' */
+    JSON_S_KEY_OR_END,          /* '{' 之后：键或 '}' */
+    JSON_S_KEY,                 /* ',' 之后的键 */
+    JSON_S_COLON,
+    JSON_S_AFTER,               /* 值之后：',' 或结束符 */
+    JSON_S_STRING,
+    JSON_S_ESCAPE,
+    JSON_S_UNICODE,
+    JSON_S_SURROGATE_BS,        /* 高位代理之后期待 '\' */
+    JSON_S_SURROGATE_U,         /* 高位代理之后期待 'u' */
+    JSON_S_LITERAL,
+    JSON_S_DONE,
+    JSON_S_ERROR
+};
+
+/* 字符串中解码出的转义字符先攒在这里，按段交给回调 */
+#define JSON_DECODE_CHUNK   64
+
+typedef struct {
+    char buf[JSON_DECODE_CHUNK];
+    uint32_t len;
+} json_decode_t;
+
+void json_stream_init(json_stream_t *js, json_stream_value_cb callback, void *user_data)
+{
+    rt_memset(js, 0, sizeof(json_stream_t));
+    js->callback = callback;
+    js->user_data = user_data;
+    js->state = JSON_S_VALUE;
+}
+
+int json_stream_add_path(json_stream_t *js, const char *path)
+{
+    json_stream_path_t *p;
+    const char *s = path;
+
+    if (js->path_count >= JSON_STREAM_PATHS || strlen(path) > 255)
+    {
+        return -RT_EFULL;
+    }
+
+    p = &js->paths[js->path_count];
+    rt_memset(p, 0, sizeof(json_stream_path_t));
+    p->path = path;
+
+    while (*s)
+    {
+        if (p->depth >= JSON_STREAM_DEPTH)
+        {
+            return -RT_EFULL;
+        }
+
+        if (*s == '[')
+        {
+            uint32_t index = 0;
+            s++;
+            if (*s < '0' || *s > '9')
+            {
+                return -RT_EINVAL;
+            }
+            while (*s >= '0' && *s <= '9')
+            {
+                index = index * 10 + (*s++ - '0');
+            }
+            if (*s++ != ']' || index > 0xFFFF)
+            {
+                return -RT_EINVAL;
+            }
+            p->key_len[p->depth] = 0;
+            p->index[p->depth] = (uint16_t)index;
+        }
+        else
+        {
+            const char *start = s;
+            while (*s && *s != '.' && *s != '[')
+            {
+                s++;
+            }
+            if (s == start || s - start >= JSON_STREAM_KEY_MAX)
+            {
+                return -RT_EINVAL;
+            }
+            p->key_off[p->depth] = (uint8_t)(start - path);
+            p->key_len[p->depth] = (uint8_t)(s - start);
+        }
+        p->depth++;
+
+        if (*s == '.')
+        {
+            s++;
+        }
+    }
+
+    return js->path_count++;
+}
+
+/* 一个值开始：由上一层的匹配状态和当前键名/下标得到匹配的路径 */
+static uint8_t json_value_begin(json_stream_t *js)
+{
+    uint8_t mask = 0;
+    int i;
+
+    if (js->depth == 0)
+    {
+        mask = (uint8_t)((1 << js->path_count) - 1);
+    }
+    else
+    {
+        int level = js->depth - 1;
+        uint8_t type = js->stack[level].type;
+
+        for (i = 0; i < js->path_count; i++)
+        {
+            json_stream_path_t *p = &js->paths[i];
+
+            if (!(js->stack[level].mask & (1 << i)))
+            {
+                continue;
+            }
+            if (p->key_len[level] == 0)
+            {
+                if (type == '[' && p->index[level] == js->stack[level].index)
+                {
+                    mask |= 1 << i;
+                }
+            }
+            else if (type == '{' && !js->key_overflow && js->key_len == p->key_len[level] &&
+                     memcmp(js->key, p->path + p->key_off[level], js->key_len) == 0)
+            {
+                mask |= 1 << i;
+            }
+        }
+    }
+
+    /* 路径到这一层为止的是完整匹配，更长的留给子节点 */
+    js->value_mask = 0;
+    for (i = 0; i < js->path_count; i++)
+    {
+        if ((mask & (1 << i)) && js->paths[i].depth == js->depth)
+        {
+            js->value_mask |= 1 << i;
+            mask &= ~(1 << i);
+        }
+    }
+
+    return mask;
+}
+
+/* 把值的一段交给匹配的路径 */
+static int json_emit(json_stream_t *js, json_value_type_t type, const char *data, uint32_t len,
+                     rt_bool_t done)
+{
+    int i;
+
+    if (js->callback == RT_NULL)
+    {
+        return RT_EOK;
+    }
+
+    for (i = 0; i < js->path_count; i++)
+    {
+        if ((js->value_mask & (1 << i)) &&
+            js->callback(js, i, type, data, len, done, js->user_data) != RT_EOK)
+        {
+            js->state = JSON_S_ERROR;
+            return -RT_EINTR;
+        }
+    }
+
+    return RT_EOK;
+}
+
+/* 字符串中的一段（已解码）：键名追加到键缓冲，值交给回调 */
+static int json_string_append(json_stream_t *js, const char *data, uint32_t len)
+{
+    if (js->in_key)
+    {
+        if (js->key_len + len > JSON_STREAM_KEY_MAX)
+        {
+            js->key_overflow = RT_TRUE;
+        }
+        else
+        {
+            rt_memcpy(js->key + js->key_len, data, len);
+            js->key_len += len;
+        }
+        return RT_EOK;
+    }
+
+    if (js->value_mask == 0 || len == 0)
+    {
+        return RT_EOK;
+    }
+
+    return json_emit(js, JSON_VALUE_STRING, data, len, RT_FALSE);
+}
+
+static int json_decode_flush(json_stream_t *js, json_decode_t *decode)
+{
+    int ret = RT_EOK;
+
+    if (decode->len > 0)
+    {
+        ret = json_string_append(js, decode->buf, decode->len);
+        decode->len = 0;
+    }
+
+    return ret;
+}
+
+/* 码点编码为UTF-8放入解码缓冲 */
+static int json_decode_put(json_stream_t *js, json_decode_t *decode, uint32_t code)
+{
+    char *out;
+
+    if (decode->len + 4 > sizeof(decode->buf) && json_decode_flush(js, decode) != RT_EOK)
+    {
+        return -RT_EINTR;
+    }
+
+    out = decode->buf + decode->len;
+    if (code < 0x80)
+    {
+        out[0] = (char)code;
+        decode->len += 1;
+    }
+    else if (code < 0x800)
+    {
+        out[0] = (char)(0xC0 | (code >> 6));
+        out[1] = (char)(0x80 | (code & 0x3F));
+        decode->len += 2;
+    }
+    else if (code < 0x10000)
+    {
+        out[0] = (char)(0xE0 | (code >> 12));
+        out[1] = (char)(0x80 | ((code >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (code & 0x3F));
+        decode->len += 3;
+    }
+    else
+    {
+        out[0] = (char)(0xF0 | (code >> 18));
+        out[1] = (char)(0x80 | ((code >> 12) & 0x3F));
+        out[2] = (char)(0x80 | ((code >> 6) & 0x3F));
+        out[3] = (char)(0x80 | (code & 0x3F));
+        decode->len += 4;
+    }
+
+    return RT_EOK;
+}
+
+/* \uXXXX 解码完成：处理UTF-16代理对，不成对的代理输出U+FFFD */
+static int json_unicode_done(json_stream_t *js, json_decode_t *decode)
+{
+    uint32_t code = js->unicode;
+
+    if (js->high_surrogate)
+    {
+        if (code >= 0xDC00 && code <= 0xDFFF)
+        {
+            code = 0x10000 + ((js->high_surrogate - 0xD800) << 10) + (code - 0xDC00);
+            js->high_surrogate = 0;
+            js->state = JSON_S_STRING;
+            return json_decode_put(js, decode, code);
+        }
+        js->high_surrogate = 0;
+        if (json_decode_put(js, decode, 0xFFFD) != RT_EOK)
+        {
+            return -RT_EINTR;
+        }
+    }
+
+    if (code >= 0xD800 && code <= 0xDBFF)
+    {
+        js->high_surrogate = (uint16_t)code;
+        js->state = JSON_S_SURROGATE_BS;
+        return RT_EOK;
+    }
+
+    js->state = JSON_S_STRING;
+    return json_decode_put(js, decode, code >= 0xDC00 && code <= 0xDFFF ? 0xFFFD : code);
+}
+
+/* 数字或true/false/null结束 */
+static int json_literal_done(json_stream_t *js)
+{
+    const char *s = js->literal;
+    uint32_t len = js->literal_len;
+    json_value_type_t type;
+
+    if ((len == 4 && memcmp(s, "true", 4) == 0) || (len == 5 && memcmp(s, "false", 5) == 0))
+    {
+        type = JSON_VALUE_BOOL;
+    }
+    else if (len == 4 && memcmp(s, "null", 4) == 0)
+    {
+        type = JSON_VALUE_NULL;
+    }
+    else if ((s[0] >= '0' && s[0] <= '9') || (s[0] == '-' && len > 1))
+    {
+        type = JSON_VALUE_NUMBER;
+    }
+    else
+    {
+        js->state = JSON_S_ERROR;
+        return -RT_ERROR;
+    }
+
+    js->state = js->depth == 0 ? JSON_S_DONE : JSON_S_AFTER;
+    if (js->value_mask)
+    {
+        return json_emit(js, type, s, len, RT_TRUE);
+    }
+
+    return RT_EOK;
+}
+
+static int json_push(json_stream_t *js, uint8_t type, uint8_t mask)
+{
+    if (js->depth >= JSON_STREAM_DEPTH)
+    {
+        LOG_W("JSON nested too deep (max %d)", JSON_STREAM_DEPTH);
+        js->state = JSON_S_ERROR;
+        return -RT_EFULL;
+    }
+
+    js->stack[js->depth].type = type;
+    js->stack[js->depth].mask = mask;
+    js->stack[js->depth].index = 0;
+    js->depth++;
+
+    return RT_EOK;
+}
+
+rt_inline rt_bool_t json_is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+int json_stream_feed(json_stream_t *js, const char *data, uint32_t len)
+{
+    json_decode_t decode;
+    const char *p = data;
+    const char *end = data + len;
+    const char *run;
+    uint8_t mask;
+    int value;
+    int ret = RT_EOK;
+    char c;
+
+    decode.len = 0;
+
+    while (p < end && ret == RT_EOK)
+    {
+        c = *p;
+
+        switch (js->state)
+        {
+        case JSON_S_VALUE_OR_END:
+            if (json_is_space(c))
+            {
+                p++;
+                break;
+            }
+            if (c == ']')
+            {
+                js->depth--;
+                js->state = JSON_S_AFTER;
+                p++;
+                break;
+            }
+            js->state = JSON_S_VALUE;
+            /* fall through */
+        case JSON_S_VALUE:
+            if (json_is_space(c))
+            {
+                p++;
+                break;
+            }
+            mask = json_value_begin(js);
+            p++;
+            if (c == '{')
+            {
+                ret = json_push(js, '{', mask);
+                js->state = JSON_S_KEY_OR_END;
+            }
+            else if (c == '[')
+            {
+                ret = json_push(js, '[', mask);
+                js->state = JSON_S_VALUE_OR_END;
+            }
+            else if (c == '"')
+            {
+                js->in_key = RT_FALSE;
+                js->state = JSON_S_STRING;
+            }
+            else if (c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' || c == 'n')
+            {
+                js->literal[0] = c;
+                js->literal_len = 1;
+                js->state = JSON_S_LITERAL;
+            }
+            else
+            {
+                ret = -RT_ERROR;
+            }
+            break;
+
+        case JSON_S_KEY_OR_END:
+        case JSON_S_KEY:
+            p++;
+            if (json_is_space(c))
+            {
+                break;
+            }
+            if (c == '}' && js->state == JSON_S_KEY_OR_END)
+            {
+                js->depth--;
+                js->state = JSON_S_AFTER;
+            }
+            else if (c == '"')
+            {
+                js->in_key = RT_TRUE;
+                js->key_len = 0;
+                js->key_overflow = RT_FALSE;
+                js->state = JSON_S_STRING;
+            }
+            else
+            {
+                ret = -RT_ERROR;
+            }
+            break;
+
+        case JSON_S_COLON:
+            p++;
+            if (c == ':')
+            {
+                js->state = JSON_S_VALUE;
+            }
+            else if (!json_is_space(c))
+            {
+                ret = -RT_ERROR;
+            }
+            break;
+
+        case JSON_S_AFTER:
+            p++;
+            if (json_is_space(c))
+            {
+                break;
+            }
+            if (js->depth == 0)
+            {
+                ret = -RT_ERROR;
+            }
+            else if (c == ',')
+            {
+                if (js->stack[js->depth - 1].type == '{')
+                {
+                    js->state = JSON_S_KEY;
+                }
+                else
+                {
+                    js->stack[js->depth - 1].index++;
+                    js->state = JSON_S_VALUE;
+                }
+            }
+            else if ((c == '}' && js->stack[js->depth - 1].type == '{') ||
+                     (c == ']' && js->stack[js->depth - 1].type == '['))
+            {
+                js->depth--;
+            }
+            else
+            {
+                ret = -RT_ERROR;
+            }
+            if (ret == RT_EOK && js->depth == 0 && js->state == JSON_S_AFTER)
+            {
+                js->state = JSON_S_DONE;
+            }
+            break;
+
+        case JSON_S_STRING:
+            /* 不含转义的部分直接交给回调，不拷贝 */
+            run = p;
+            while (p < end && *p != '"' && *p != '\\')
+            {
+                p++;
+            }
+            if (p > run)
+            {
+                if ((ret = json_decode_flush(js, &decode)) != RT_EOK)
+                {
+                    break;
+                }
+                ret = json_string_append(js, run, (uint32_t)(p - run));
+            }
+            if (p == end || ret != RT_EOK)
+            {
+                break;
+            }
+
+            if (*p++ == '\\')
+            {
+                js->state = JSON_S_ESCAPE;
+                break;
+            }
+
+            /* 字符串结束 */
+            if ((ret = json_decode_flush(js, &decode)) != RT_EOK)
+            {
+                break;
+            }
+            if (js->in_key)
+            {
+                js->in_key = RT_FALSE;
+                js->state = JSON_S_COLON;
+            }
+            else
+            {
+                js->state = JSON_S_AFTER;
+                if (js->value_mask)
+                {
+                    ret = json_emit(js, JSON_VALUE_STRING, "", 0, RT_TRUE);
+                }
+                if (js->depth == 0)
+                {
+                    js->state = JSON_S_DONE;
+                }
+            }
+            break;
+
+        case JSON_S_ESCAPE:
+            p++;
+            js->state = JSON_S_STRING;
+            switch (c)
+            {
+            case '"':  ret = json_decode_put(js, &decode, '"');  break;
+            case '\\': ret = json_decode_put(js, &decode, '\\'); break;
+            case '/':  ret = json_decode_put(js, &decode, '/');  break;
+            case 'b':  ret = json_decode_put(js, &decode, '\b'); break;
+            case 'f':  ret = json_decode_put(js, &decode, '\f'); break;
+            case 'n':  ret = json_decode_put(js, &decode, '\n'); break;
+            case 'r':  ret = json_decode_put(js, &decode, '\r'); break;
+            case 't':  ret = json_decode_put(js, &decode, '\t'); break;
+            case 'u':
+                js->unicode = 0;
+                js->hex_count = 0;
+                js->state = JSON_S_UNICODE;
+                break;
+            default:
+                ret = -RT_ERROR;
+                break;
+            }
+            break;
+
+        case JSON_S_UNICODE:
+            p++;
+            if (c >= '0' && c <= '9')
+            {
+                value = c - '0';
+            }
+            else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+            {
+                value = (c | 0x20) - 'a' + 10;
+            }
+            else
+            {
+                ret = -RT_ERROR;
+                break;
+            }
+            js->unicode = (js->unicode << 4) | value;
+            if (++js->hex_count == 4)
+            {
+                ret = json_unicode_done(js, &decode);
+            }
+            break;
+
+        case JSON_S_SURROGATE_BS:
+        case JSON_S_SURROGATE_U:
+            if (c == (js->state == JSON_S_SURROGATE_BS ? '\\' : 'u'))
+            {
+                p++;
+                if (js->state == JSON_S_SURROGATE_BS)
+                {
+                    js->state = JSON_S_SURROGATE_U;
+                }
+                else
+                {
+                    js->unicode = 0;
+                    js->hex_count = 0;
+                    js->state = JSON_S_UNICODE;
+                }
+                break;
+            }
+            /* 高位代理后面不是 \u：输出U+FFFD，当前字符按原状态重新处理 */
+            js->high_surrogate = 0;
+            ret = json_decode_put(js, &decode, 0xFFFD);
+            js->state = (js->state == JSON_S_SURROGATE_BS) ? JSON_S_STRING : JSON_S_ESCAPE;
+            break;
+
+        case JSON_S_LITERAL:
+            if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || c == '.' || c == '+' ||
+                c == '-' || c == 'E')
+            {
+                if (js->literal_len >= JSON_STREAM_LITERAL_MAX)
+                {
+                    ret = -RT_ERROR;
+                    break;
+                }
+                js->literal[js->literal_len++] = c;
+                p++;
+                break;
+            }
+            /* 当前字符属于后面的结构，留给JSON_S_AFTER */
+            ret = json_literal_done(js);
+            break;
+
+        case JSON_S_DONE:
+            p++;
+            if (!json_is_space(c))
+            {
+                ret = -RT_ERROR;
+            }
+            break;
+
+        default:
+            ret = -RT_ERROR;
+            break;
+        }
+    }
+
+    if (ret == RT_EOK)
+    {
+        ret = json_decode_flush(js, &decode);
+    }
+
+    if (ret != RT_EOK)
+    {
+        js->state = JSON_S_ERROR;
+        return ret;
+    }
+
+    return RT_EOK;
+}
+
+int json_stream_finish(json_stream_t *js)
+{
+    if (js->state == JSON_S_LITERAL && js->depth == 0 && json_literal_done(js) != RT_EOK)
+    {
+        return -RT_ERROR;
+    }
+
+    return js->state == JSON_S_DONE ? RT_EOK : -RT_ERROR;
+}
+
+/* ==================== 完整文本取值 ==================== */
+
+typedef struct {
+    char *value[JSON_STREAM_PATHS];
+    uint32_t len[JSON_STREAM_PATHS];
+    uint32_t size[JSON_STREAM_PATHS];
+    rt_bool_t done[JSON_STREAM_PATHS];
+} json_extract_t;
+
+static int json_extract_collect(json_stream_t *js, int path, json_value_type_t type,
+                                const char *data, uint32_t len, rt_bool_t done, void *user_data)
+{
+    json_extract_t *ex = (json_extract_t *)user_data;
+
+    (void)js;
+    if (type != JSON_VALUE_STRING || ex->done[path])
+    {
+        return RT_EOK;
+    }
+
+    if (ex->value[path] == RT_NULL || ex->len[path] + len >= ex->size[path])
+    {
+        uint32_t size = ex->size[path] ? ex->size[path] : 64;
+        char *value;
+
+        while (size <= ex->len[path] + len)
+        {
+            size *= 2;
+        }
+        value = (char *)ai_arena_realloc(ex->value[path], size);
+        if (value == RT_NULL)
+        {
+            return -RT_ENOMEM;
+        }
+        ex->value[path] = value;
+        ex->size[path] = size;
+    }
+
+    rt_memcpy(ex->value[path] + ex->len[path], data, len);
+    ex->len[path] += len;
+    ex->value[path][ex->len[path]] = '\0';
+    ex->done[path] = done;
+
+    /* 优先级最高的路径已经取到，不必解析剩余部分 */
+    return (done && path == 0) ? -RT_EINTR : RT_EOK;
+}
+
+char *json_stream_extract(const char *json, uint32_t len, const char *const *paths, int count)
+{
+    json_stream_t js;
+    json_extract_t ex;
+    char *result = RT_NULL;
+    int i;
+
+    if (json == RT_NULL || count <= 0 || count > JSON_STREAM_PATHS)
+    {
+        return RT_NULL;
+    }
+
+    rt_memset(&ex, 0, sizeof(ex));
+    json_stream_init(&js, json_extract_collect, &ex);
+    for (i = 0; i < count; i++)
+    {
+        if (json_stream_add_path(&js, paths[i]) < 0)
+        {
+            LOG_E("Invalid JSON path: %s", paths[i]);
+            return RT_NULL;
+        }
+    }
+
+    /* 提前结束或格式错误时，已经取到的完整值仍然可用 */
+    if (json_stream_feed(&js, json, len) != RT_EOK || json_stream_finish(&js) != RT_EOK)
+    {
+        LOG_D("JSON parse stopped at state %d", js.state);
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if (result == RT_NULL && ex.done[i])
+        {
+            result = ex.value[i];
+        }
+        else if (ex.value[i])
+        {
+            ai_arena_free(ex.value[i]);
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Streaming JSON tokenizer
+ */
+
+#ifndef __JSON_STREAM_H__
+#define __JSON_STREAM_H__
+
+/*
+ * 增量式JSON解析（SAX风格），用于从云端响应中按路径取值：
+ *   - 数据可以分任意多段送入（如HTTP响应体逐段到达），不需要整个响应体驻留内存
+ *   - 路径写法：choices[0].message.content、result[0]、data.audio，键名区分大小写
+ *   - 只跟踪已注册路径的匹配状态，嵌套深度固定上限，不分配内存
+ *   - 字符串值边解码边输出：不含转义的部分直接指向输入数据，\uXXXX（含代理对）解码为UTF-8
+ *   - 只输出标量值（字符串、数字、true/false/null），路径指向对象或数组时不输出
+ */
+
+#include <rtthread.h>
+
+#define JSON_STREAM_DEPTH       16      /* 最大嵌套层数 */
+#define JSON_STREAM_PATHS       4       /* 可同时注册的路径数 */
+#define JSON_STREAM_KEY_MAX     48      /* 参与匹配的键名长度上限，更长的键不会匹配任何路径 */
+#define JSON_STREAM_LITERAL_MAX 32      /* 数字/true/false/null的长度上限 */
+
+typedef enum {
+    JSON_VALUE_STRING = 0,
+    JSON_VALUE_NUMBER,
+    JSON_VALUE_BOOL,
+    JSON_VALUE_NULL
+} json_value_type_t;
+
+typedef struct json_stream json_stream_t;
+
+/*
+ * 路径上的值：字符串可能分多次输出，最后一次 done 为 RT_TRUE（len可以为0）；
+ * 其他类型一次输出原文。返回非RT_EOK时中止解析
+ */
+typedef int (*json_stream_value_cb)(json_stream_t *js, int path, json_value_type_t type,
+                                    const char *data, uint32_t len, rt_bool_t done, void *user_data);
+
+/* 已注册的路径，拆分为逐层的键名或下标 */
+typedef struct {
+    const char *path;
+    uint8_t depth;
+    uint8_t key_off[JSON_STREAM_DEPTH];
+    uint8_t key_len[JSON_STREAM_DEPTH];     /* 0表示这一层是数组下标 */
+    uint16_t index[JSON_STREAM_DEPTH];
+} json_stream_path_t;
+
+struct json_stream {
+    json_stream_value_cb callback;
+    void *user_data;
+    json_stream_path_t paths[JSON_STREAM_PATHS];
+    uint8_t path_count;
+
+    /* 内部状态 */
+    uint8_t state;
+    uint8_t depth;
+    uint8_t value_mask;         /* 当前值完整匹配的路径 */
+    struct {
+        uint8_t type;           /* '{' 或 '[' */
+        uint8_t mask;           /* 与这一层之前的路径前缀匹配的路径 */
+        uint16_t index;         /* 数组元素下标 */
+    } stack[JSON_STREAM_DEPTH];
+
+    char key[JSON_STREAM_KEY_MAX];
+    uint8_t key_len;
+    rt_bool_t key_overflow;
+    rt_bool_t in_key;
+
+    char literal[JSON_STREAM_LITERAL_MAX];
+    uint8_t literal_len;
+
+    uint32_t unicode;           /* \uXXXX 累积 */
+    uint8_t hex_count;
+    uint16_t high_surrogate;    /* 等待低位代理的高位代理 */
+};
+
+void json_stream_init(json_stream_t *js, json_stream_value_cb callback, void *user_data);
+
+/* 注册路径，返回路径编号；path须在解析期间保持有效 */
+int json_stream_add_path(json_stream_t *js, const char *path);
+
+/* 送入一段数据，格式错误返回 -RT_ERROR，嵌套过深返回 -RT_EFULL，回调中止返回 -RT_EINTR */
+int json_stream_feed(json_stream_t *js, const char *data, uint32_t len);
+
+/* 数据结束：顶层值完整时返回RT_EOK */
+int json_stream_finish(json_stream_t *js);
+
+/*
+ * 从完整的JSON文本中取出字符串值（已解码，ai_arena_alloc分配，调用者用ai_arena_free释放），
+ * 按paths的顺序优先，只扫描一遍；都不存在时返回RT_NULL
+ */
+char *json_stream_extract(const char *json, uint32_t len, const char *const *paths, int count);
+
+#endif /* __JSON_STREAM_H__ */
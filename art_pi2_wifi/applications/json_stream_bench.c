@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - JSON tokenizer benchmark
+ */
+
+/*
+ * 云端响应取值的正确性和性能对比：
+ *   legacy   原来的做法（strstr找 "key": 后取到下一个引号，只解码\uXXXX）
+ *   extract  json_stream_extract 对完整响应体取值
+ *   stream   同一响应按16字节分段送入json_stream，模拟边接收边解析
+ * 样例是各服务商的真实响应格式（OpenAI、百度语音识别、文心一言V1、AppBuilder V2）。
+ *
+ * 设备端：json_bench [次数]
+ * PC端（与设备端同一份json_stream.c）：
+ *   gcc -O2 -DJSON_STREAM_BENCH_MAIN -I../host -I. json_stream.c ai_arena.c memory_helper.c json_stream_bench.c -o json_bench
+ *   ./json_bench 20000
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include "json_stream.h"
+#include "ai_arena.h"
+
+#define JSON_BENCH_SEGMENT  16
+
+typedef struct {
+    const char *name;
+    const char *legacy_key;     /* 原实现查找的键 */
+    const char *path;
+    const char *json;
+    const char *expected;
+} json_bench_sample_t;
+
+static const json_bench_sample_t json_bench_samples[] = {
+    {
+        "openai ascii", "content", "choices[0].message.content",
+        "{\n"
+        "  \"id\": \"chatcmpl-AJ5Zo2bX1xk3N2mJq7Yh\",\n"
+        "  \"object\": \"chat.completion\",\n"
+        "  \"created\": 1729170000,\n"
+        "  \"model\": \"gpt-4o-mini-2024-07-18\",\n"
+        "  \"choices\": [\n"
+        "    {\n"
+        "      \"index\": 0,\n"
+        "      \"message\": {\n"
+        "        \"role\": \"assistant\",\n"
+        "        \"content\": \"\\u597d\\u7684\\uff0c\\u4eca\\u5929\\u5929\\u6c14\\u6674\\u3002\\n"
+        "\\u8bb0\\u5f97\\u5e26\\u4f1e\\ud83c\\udf02\\uff01\",\n"
+        "        \"refusal\": null\n"
+        "      },\n"
+        "      \"logprobs\": null,\n"
+        "      \"finish_reason\": \"stop\"\n"
+        "    }\n"
+        "  ],\n"
+        "  \"usage\": {\n"
+        "    \"prompt_tokens\": 38,\n"
+        "    \"completion_tokens\": 17,\n"
+        "    \"total_tokens\": 55\n"
+        "  },\n"
+        "  \"system_fingerprint\": \"fp_e2bde53e6e\"\n"
+        "}\n",
+        "好的，今天天气晴。\n记得带伞🌂！"
+    },
+    {
+        "openai utf8", "content", "choices[0].message.content",
+        "{\"id\":\"chatcmpl-123\",\"object\":\"chat.completion\",\"created\":1729170000,"
+        "\"model\":\"qwen-turbo\",\"choices\":[{\"index\":0,\"message\":{\"role\":\"assistant\","
+        "\"content\":\"他说\\\"明天见\\\"，路径是C:\\\\temp\\/a。\"},\"finish_reason\":\"stop\"}],"
+        "\"usage\":{\"prompt_tokens\":20,\"completion_tokens\":12,\"total_tokens\":32}}",
+        "他说\"明天见\"，路径是C:\\temp/a。"
+    },
+    {
+        "baidu stt", "result", "result[0]",
+        "{\"corpus_no\":\"6433214037620997779\",\"err_msg\":\"success.\",\"err_no\":0,"
+        "\"result\":[\"北京科技馆。\"],\"sn\":\"371191073711497849365\"}",
+        "北京科技馆。"
+    },
+    {
+        "baidu stt quote", "result", "result[0]",
+        "{\"corpus_no\":\"6433214037620997780\",\"err_msg\":\"success.\",\"err_no\":0,"
+        "\"result\":[\"打开\\\"客厅\\\"的灯\"],\"sn\":\"371191073711497849366\"}",
+        "打开\"客厅\"的灯"
+    },
+    {
+        "ernie v1", "result", "result",
+        "{\"id\":\"as-bcmt5ct4iy\",\"object\":\"chat.completion\",\"created\":1729170000,"
+        "\"result\":\"你好！有什么可以帮你的吗？\",\"is_truncated\":false,\"need_clear_history\":false,"
+        "\"finish_reason\":\"normal\",\"usage\":{\"prompt_tokens\":1,\"completion_tokens\":9,\"total_tokens\":10}}",
+        "你好！有什么可以帮你的吗？"
+    },
+    {
+        "appbuilder v2", "answer", "answer",
+        "{\"request_id\":\"e6c5b1a4-7a8e-4b8f-9f2d-1c3a5e7b9d0f\",\"date\":\"2024-10-17T12:00:00Z\","
+        "\"answer\":\"今天北京晴，最高气温22度。\",\"conversation_id\":\"5a8e4c2b\","
+        "\"message_id\":\"9f1e3d5c\",\"is_completion\":true,\"content\":[{\"event_code\":0,"
+        "\"event_message\":\"\",\"event_type\":\"ChatAgent\",\"event_id\":\"0\",\"event_status\":\"done\","
+        "\"content_type\":\"text\",\"outputs\":{\"text\":\"今天北京晴，最高气温22度。\"}}]}",
+        "今天北京晴，最高气温22度。"
+    },
+};
+
+#define JSON_BENCH_SAMPLES  (sizeof(json_bench_samples) / sizeof(json_bench_samples[0]))
+
+/* ==================== 原实现 ==================== */
+
+/* ai_chat_service.c 原来的 extract_json_string */
+static char *json_bench_legacy(const char *json, const char *key)
+{
+    char search_key[128];
+    char *result;
+    const char *start, *end;
+    char *read_pos, *write_pos;
+    unsigned int unicode;
+    int len, i;
+
+    rt_snprintf(search_key, sizeof(search_key), "\"%s\":", key);
+    start = strstr(json, search_key);
+    if (start == RT_NULL)
+    {
+        return RT_NULL;
+    }
+    start += strlen(search_key);
+    while (*start == ' ' || *start == '\t' || *start == '\r' || *start == '\n')
+    {
+        start++;
+    }
+    /* 原来的语音识别结果取 "result" 后第一个 '[' 之后的字符串 */
+    if (*start == '[')
+    {
+        start = strchr(start, '"');
+        if (start == RT_NULL)
+        {
+            return RT_NULL;
+        }
+    }
+    if (*start != '"')
+    {
+        return RT_NULL;
+    }
+    start++;
+
+    end = start;
+    while (*end && *end != '"')
+    {
+        end += (*end == '\\' && *(end + 1)) ? 2 : 1;
+    }
+    if (*end != '"')
+    {
+        return RT_NULL;
+    }
+
+    len = end - start;
+    result = (char *)rt_malloc(len + 1);
+    if (result == RT_NULL)
+    {
+        return RT_NULL;
+    }
+    rt_memcpy(result, start, len);
+    result[len] = '\0';
+
+    read_pos = write_pos = result;
+    while (*read_pos)
+    {
+        if (read_pos[0] == '\\' && read_pos[1] == 'u' && read_pos[2] && read_pos[3] && read_pos[4] && read_pos[5])
+        {
+            unicode = 0;
+            for (i = 2; i < 6; i++)
+            {
+                char c = read_pos[i];
+                unicode = unicode * 16 + ((c >= '0' && c <= '9') ? c - '0' : ((c | 0x20) - 'a' + 10));
+            }
+            if (unicode < 0x80)
+            {
+                *write_pos++ = (char)unicode;
+            }
+            else if (unicode < 0x800)
+            {
+                *write_pos++ = (char)(0xC0 | (unicode >> 6));
+                *write_pos++ = (char)(0x80 | (unicode & 0x3F));
+            }
+            else
+            {
+                *write_pos++ = (char)(0xE0 | (unicode >> 12));
+                *write_pos++ = (char)(0x80 | ((unicode >> 6) & 0x3F));
+                *write_pos++ = (char)(0x80 | (unicode & 0x3F));
+            }
+            read_pos += 6;
+        }
+        else
+        {
+            *write_pos++ = *read_pos++;
+        }
+    }
+    *write_pos = '\0';
+
+    return result;
+}
+
+/* ==================== 分段解析 ==================== */
+
+typedef struct {
+    char value[256];
+    uint32_t len;
+    rt_bool_t done;
+} json_bench_collect_t;
+
+static int json_bench_on_value(json_stream_t *js, int path, json_value_type_t type,
+                               const char *data, uint32_t len, rt_bool_t done, void *user_data)
+{
+    json_bench_collect_t *collect = (json_bench_collect_t *)user_data;
+
+    (void)js;
+    (void)path;
+    (void)type;
+    if (collect->len + len < sizeof(collect->value))
+    {
+        rt_memcpy(collect->value + collect->len, data, len);
+        collect->len += len;
+        collect->value[collect->len] = '\0';
+    }
+    collect->done = done;
+
+    return RT_EOK;
+}
+
+/* 按segment字节分段送入 */
+static int json_bench_stream(const char *json, const char *path, uint32_t segment,
+                             json_bench_collect_t *collect)
+{
+    json_stream_t js;
+    uint32_t len = strlen(json);
+    uint32_t offset, n;
+
+    rt_memset(collect, 0, sizeof(json_bench_collect_t));
+    json_stream_init(&js, json_bench_on_value, collect);
+    json_stream_add_path(&js, path);
+
+    for (offset = 0; offset < len; offset += n)
+    {
+        n = len - offset < segment ? len - offset : segment;
+        if (json_stream_feed(&js, json + offset, n) != RT_EOK)
+        {
+            return -RT_ERROR;
+        }
+    }
+
+    return json_stream_finish(&js);
+}
+
+/* ==================== 测试 ==================== */
+
+static int json_bench(int count)
+{
+    json_bench_collect_t collect;
+    rt_tick_t start, legacy_ticks = 0, extract_ticks = 0, stream_ticks = 0;
+    uint32_t bytes = 0;
+    int failures = 0;
+    uint32_t s, seg;
+    int i;
+
+    if (count <= 0)
+    {
+        count = 10000;
+    }
+
+    rt_kprintf("%-16s %-8s %-8s %-8s\n", "sample", "legacy", "extract", "stream");
+    for (s = 0; s < JSON_BENCH_SAMPLES; s++)
+    {
+        const json_bench_sample_t *sample = &json_bench_samples[s];
+        const char *paths[1] = {sample->path};
+        char *legacy = json_bench_legacy(sample->json, sample->legacy_key);
+        char *extract = json_stream_extract(sample->json, strlen(sample->json), paths, 1);
+        rt_bool_t legacy_ok = legacy && strcmp(legacy, sample->expected) == 0;
+        rt_bool_t extract_ok = extract && strcmp(extract, sample->expected) == 0;
+        rt_bool_t stream_ok = RT_TRUE;
+
+        /* 任意分段位置结果都应相同 */
+        for (seg = 1; seg <= 64 && stream_ok; seg++)
+        {
+            stream_ok = json_bench_stream(sample->json, sample->path, seg, &collect) == RT_EOK &&
+                        collect.done && strcmp(collect.value, sample->expected) == 0;
+        }
+
+        rt_kprintf("%-16s %-8s %-8s %-8s\n", sample->name, legacy_ok ? "ok" : "WRONG",
+                   extract_ok ? "ok" : "WRONG", stream_ok ? "ok" : "WRONG");
+        if (!legacy_ok && legacy)
+        {
+            rt_kprintf("  legacy: %s\n", legacy);
+        }
+        if (!extract_ok || !stream_ok)
+        {
+            failures++;
+        }
+        rt_free(legacy);
+        ai_arena_free(extract);
+    }
+
+    for (s = 0; s < JSON_BENCH_SAMPLES; s++)
+    {
+        const json_bench_sample_t *sample = &json_bench_samples[s];
+        const char *paths[1] = {sample->path};
+        uint32_t len = strlen(sample->json);
+
+        start = rt_tick_get();
+        for (i = 0; i < count; i++)
+        {
+            rt_free(json_bench_legacy(sample->json, sample->legacy_key));
+        }
+        legacy_ticks += rt_tick_get() - start;
+
+        start = rt_tick_get();
+        for (i = 0; i < count; i++)
+        {
+            ai_arena_free(json_stream_extract(sample->json, len, paths, 1));
+        }
+        extract_ticks += rt_tick_get() - start;
+
+        start = rt_tick_get();
+        for (i = 0; i < count; i++)
+        {
+            json_bench_stream(sample->json, sample->path, JSON_BENCH_SEGMENT, &collect);
+        }
+        stream_ticks += rt_tick_get() - start;
+
+        bytes += len;
+    }
+
+    rt_kprintf("%d x %d bytes: legacy %d ms, extract %d ms, stream (%d-byte segments) %d ms\n",
+               count, bytes, legacy_ticks * 1000 / RT_TICK_PER_SECOND,
+               extract_ticks * 1000 / RT_TICK_PER_SECOND, JSON_BENCH_SEGMENT,
+               stream_ticks * 1000 / RT_TICK_PER_SECOND);
+    rt_kprintf("json_stream_t: %d bytes (no heap)\n", (int)sizeof(json_stream_t));
+
+    return failures == 0 ? 0 : -1;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+#include <finsh.h>
+
+static int cmd_json_bench(int argc, char **argv)
+{
+    return json_bench(argc > 1 ? atoi(argv[1]) : 10000);
+}
+MSH_CMD_EXPORT_ALIAS(cmd_json_bench, json_bench, JSON extraction benchmark: json_bench [count]);
+#endif
+
+#ifdef JSON_STREAM_BENCH_MAIN
+HOST_CRITICAL_LOCK_DEFINE;
+
+int main(int argc, char **argv)
+{
+    return json_bench(argc > 1 ? atoi(argv[1]) : 10000) == 0 ? 0 : 1;
+}
+#endif
@@ -0,0 +1,545 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-21     AI Assistant first version - On-device Keyword Spotting
+ * 2024-10-27     AI Assistant Add utterance-level phrase spotting for local commands
+ */
+
+#include <string.h>
+#include <math.h>
+#include "kws.h"
+
+#if KWS_ENABLE
+
+/* arm_rfft_q15 对1024点的输出缩小了2^10 (输入1.15，输出11.5) */
+#define KWS_FFT_UPSCALE_BITS    10
+
+/* ==================== 前端 (MFCC) ==================== */
+
+static float kws_hz_to_mel(float hz)
+{
+    return 1127.0f * logf(1.0f + hz / 700.0f);
+}
+
+/* 初始化前端：窗函数、三角滤波器组、DCT矩阵 */
+int kws_frontend_init(kws_frontend_t *fe)
+{
+    float mel_low = kws_hz_to_mel(KWS_MEL_LOW_HZ);
+    float mel_high = kws_hz_to_mel(KWS_MEL_HIGH_HZ);
+    float mel_step = (mel_high - mel_low) / (KWS_MEL_BINS + 1);
+    uint32_t offset = 0;
+    int i, j;
+
+    memset(fe, 0, sizeof(kws_frontend_t));
+
+    if (arm_rfft_init_q15(&fe->rfft, KWS_FFT_LEN, 0, 1) != ARM_MATH_SUCCESS)
+    {
+        return -1;
+    }
+
+    /* Hann窗 */
+    for (i = 0; i < KWS_FRAME_LEN; i++)
+    {
+        float w = 0.5f - 0.5f * cosf(2.0f * (float)PI * i / KWS_FRAME_LEN);
+        fe->window[i] = (q15_t)(w * 32767.0f);
+    }
+
+    /* 三角滤波器：只保存非零部分 */
+    for (i = 0; i < KWS_MEL_BINS; i++)
+    {
+        float left = mel_low + mel_step * i;
+        float center = left + mel_step;
+        float right = center + mel_step;
+        int first = -1, last = -1;
+
+        for (j = 1; j <= KWS_FFT_LEN / 2; j++)
+        {
+            float mel = kws_hz_to_mel((float)j * KWS_SAMPLE_RATE / KWS_FFT_LEN);
+            if (mel > left && mel < right)
+            {
+                if (first < 0)
+                {
+                    first = j;
+                }
+                last = j;
+            }
+        }
+
+        fe->mel_start[i] = first < 0 ? 0 : first;
+        fe->mel_len[i] = first < 0 ? 0 : last - first + 1;
+        fe->mel_offset[i] = offset;
+        if (offset + fe->mel_len[i] > KWS_MEL_WEIGHTS_MAX)
+        {
+            return -1;
+        }
+
+        for (j = 0; j < fe->mel_len[i]; j++)
+        {
+            float mel = kws_hz_to_mel((float)(first + j) * KWS_SAMPLE_RATE / KWS_FFT_LEN);
+            fe->mel_weight[offset + j] = mel <= center ? (mel - left) / (center - left)
+                                                       : (right - mel) / (right - center);
+        }
+        offset += fe->mel_len[i];
+    }
+
+    /* DCT-II */
+    for (i = 0; i < KWS_MFCC_COEFFS; i++)
+    {
+        for (j = 0; j < KWS_MEL_BINS; j++)
+        {
+            fe->dct[i * KWS_MEL_BINS + j] = sqrtf(2.0f / KWS_MEL_BINS) *
+                                            cosf((float)PI / KWS_MEL_BINS * (j + 0.5f) * i);
+        }
+    }
+
+    return 0;
+}
+
+/* 计算一帧 (KWS_FRAME_LEN个样本) 的MFCC，按 dec_bits 量化为q7 */
+void kws_frontend_compute(kws_frontend_t *fe, const int16_t *frame, int dec_bits, q7_t *mfcc)
+{
+    float mel_log[KWS_MEL_BINS];
+    int32_t max_abs = 0;
+    int8_t shift = 0;
+    int i, j;
+
+    arm_mult_q15((q15_t *)frame, fe->window, fe->fft_in, KWS_FRAME_LEN);
+    memset(fe->fft_in + KWS_FRAME_LEN, 0, (KWS_FFT_LEN - KWS_FRAME_LEN) * sizeof(q15_t));
+
+    /* 块浮点：左移到满幅度，减少q15 FFT逐级缩放造成的精度损失
+     * （q15 FFT的动态范围有限，训练用的特征必须由本前端生成，可在PC上编译本文件导出）*/
+    for (i = 0; i < KWS_FRAME_LEN; i++)
+    {
+        int32_t v = fe->fft_in[i] < 0 ? -fe->fft_in[i] : fe->fft_in[i];
+        if (v > max_abs)
+        {
+            max_abs = v;
+        }
+    }
+    while (max_abs != 0 && (max_abs << (shift + 1)) <= 0x7FFF)
+    {
+        shift++;
+    }
+    if (shift > 0)
+    {
+        arm_shift_q15(fe->fft_in, shift, fe->fft_in, KWS_FRAME_LEN);
+    }
+
+    /* arm_rfft_q15 会修改输入缓冲区 */
+    arm_rfft_q15(&fe->rfft, fe->fft_in, fe->fft_out);
+
+    /* 功率谱 -> Mel能量 -> 取对数，能量按输入归一化到[-1, 1)计算 */
+    for (i = 0; i < KWS_MEL_BINS; i++)
+    {
+        const float *weight = &fe->mel_weight[fe->mel_offset[i]];
+        const q15_t *bin = &fe->fft_out[fe->mel_start[i] * 2];
+        float energy = 0.0f;
+
+        for (j = 0; j < fe->mel_len[i]; j++)
+        {
+            int32_t re = bin[j * 2];
+            int32_t im = bin[j * 2 + 1];
+            energy += weight[j] * (float)(re * re + im * im);
+        }
+
+        energy = ldexpf(energy, 2 * (KWS_FFT_UPSCALE_BITS - 15 - shift));
+        mel_log[i] = logf(energy > 1e-12f ? energy : 1e-12f);
+    }
+
+    /* DCT，并量化为 Qx.dec_bits */
+    for (i = 0; i < KWS_MFCC_COEFFS; i++)
+    {
+        float sum = 0.0f;
+
+        for (j = 0; j < KWS_MEL_BINS; j++)
+        {
+            sum += fe->dct[i * KWS_MEL_BINS + j] * mel_log[j];
+        }
+
+        sum = roundf(ldexpf(sum, dec_bits));
+        mfcc[i] = (q7_t)(sum > 127.0f ? 127 : (sum < -128.0f ? -128 : sum));
+    }
+}
+
+/* ==================== 模型 (DS-CNN) ==================== */
+
+/* 模型数据区大小 (不含文件头) */
+uint32_t kws_model_size(uint8_t channels, uint8_t num_classes)
+{
+    uint32_t c = channels;
+
+    return c * KWS_CONV1_KX * KWS_CONV1_KY + c
+           + KWS_DS_BLOCKS * (9 * c + c + c * c + c)
+           + num_classes * c + num_classes;
+}
+
+/* 解析模型文件，权重指针直接指向 blob */
+int kws_model_load(kws_model_t *model, const uint8_t *blob, uint32_t size)
+{
+    const q7_t *p;
+    uint32_t c;
+    int i;
+
+    if (size < KWS_MODEL_HEADER_SIZE)
+    {
+        return -1;
+    }
+    if ((blob[0] | (blob[1] << 8) | (blob[2] << 16) | ((uint32_t)blob[3] << 24)) != KWS_MODEL_MAGIC ||
+        blob[4] != KWS_MODEL_VERSION)
+    {
+        return -1;
+    }
+
+    memset(model, 0, sizeof(kws_model_t));
+    model->num_classes = blob[5];
+    model->wakeup_index = blob[6];
+    model->channels = blob[7];
+    model->mfcc_dec_bits = (int8_t)blob[8];
+
+    /* CMSIS-NN 1x1快速卷积要求通道数为4的倍数 */
+    if (model->num_classes == 0 || model->num_classes > KWS_MAX_CLASSES ||
+        model->wakeup_index >= model->num_classes ||
+        model->channels == 0 || model->channels > KWS_MAX_CHANNELS || (model->channels % 4) != 0)
+    {
+        return -1;
+    }
+    if (size < KWS_MODEL_HEADER_SIZE + kws_model_size(model->channels, model->num_classes))
+    {
+        return -1;
+    }
+
+    for (i = 0; i < KWS_LAYER_NUM; i++)
+    {
+        model->bias_shift[i] = blob[12 + i * 2];
+        model->out_shift[i] = blob[12 + i * 2 + 1];
+    }
+    for (i = 0; i < model->num_classes; i++)
+    {
+        memcpy(model->labels[i], blob + 32 + i * KWS_LABEL_LEN, KWS_LABEL_LEN);
+        model->labels[i][KWS_LABEL_LEN] = '\0';
+    }
+
+    c = model->channels;
+    p = (const q7_t *)(blob + KWS_MODEL_HEADER_SIZE);
+    model->conv1_w = p;     p += c * KWS_CONV1_KX * KWS_CONV1_KY;
+    model->conv1_b = p;     p += c;
+    for (i = 0; i < KWS_DS_BLOCKS; i++)
+    {
+        model->dw_w[i] = p; p += 9 * c;
+        model->dw_b[i] = p; p += c;
+        model->pw_w[i] = p; p += c * c;
+        model->pw_b[i] = p; p += c;
+    }
+    model->fc_w = p;        p += model->num_classes * c;
+    model->fc_b = p;
+
+    return 0;
+}
+
+/* 运行一次推理：输入 KWS_INPUT_FRAMES x KWS_MFCC_COEFFS 的q7 MFCC，输出q7后验概率 */
+int kws_model_run(const kws_model_t *model, kws_model_work_t *work, const q7_t *mfcc, q7_t *probs)
+{
+    const uint32_t c = model->channels;
+    const int32_t positions = KWS_FEAT_X * KWS_FEAT_Y;
+    arm_status ret;
+    q7_t *in = work->act_a;
+    q7_t *out = work->act_b;
+    int i, layer = 0;
+
+    /* conv1: 10(时间) x 4(MFCC)，步长2，SAME填充 */
+    ret = arm_convolve_HWC_q7_basic_nonsquare(mfcc, KWS_MFCC_COEFFS, KWS_INPUT_FRAMES, 1,
+                                              model->conv1_w, c, KWS_CONV1_KX, KWS_CONV1_KY,
+                                              1, 4, 2, 2,
+                                              model->conv1_b, model->bias_shift[layer], model->out_shift[layer],
+                                              in, KWS_FEAT_X, KWS_FEAT_Y, work->col, NULL);
+    if (ret != ARM_MATH_SUCCESS)
+    {
+        return -1;
+    }
+    arm_relu_q7(in, positions * c);
+    layer++;
+
+    for (i = 0; i < KWS_DS_BLOCKS; i++)
+    {
+        /* 深度卷积 3x3 */
+        ret = arm_depthwise_separable_conv_HWC_q7_nonsquare(in, KWS_FEAT_X, KWS_FEAT_Y, c,
+                                                            model->dw_w[i], c, 3, 3, 1, 1, 1, 1,
+                                                            model->dw_b[i], model->bias_shift[layer], model->out_shift[layer],
+                                                            out, KWS_FEAT_X, KWS_FEAT_Y, work->col, NULL);
+        if (ret != ARM_MATH_SUCCESS)
+        {
+            return -1;
+        }
+        arm_relu_q7(out, positions * c);
+        layer++;
+
+        /* 逐点卷积 1x1 */
+        ret = arm_convolve_1x1_HWC_q7_fast_nonsquare(out, KWS_FEAT_X, KWS_FEAT_Y, c,
+                                                     model->pw_w[i], c, 1, 1, 0, 0, 1, 1,
+                                                     model->pw_b[i], model->bias_shift[layer], model->out_shift[layer],
+                                                     in, KWS_FEAT_X, KWS_FEAT_Y, work->col, NULL);
+        if (ret != ARM_MATH_SUCCESS)
+        {
+            return -1;
+        }
+        arm_relu_q7(in, positions * c);
+        layer++;
+    }
+
+    /* 全局平均池化 (ReLU之后均为非负) */
+    for (i = 0; i < (int)c; i++)
+    {
+        int32_t sum = 0;
+        int32_t k;
+
+        for (k = 0; k < positions; k++)
+        {
+            sum += in[k * c + i];
+        }
+        out[i] = (q7_t)((sum + positions / 2) / positions);
+    }
+
+    ret = arm_fully_connected_q7(out, model->fc_w, c, model->num_classes,
+                                 model->bias_shift[layer], model->out_shift[layer],
+                                 model->fc_b, work->logits, work->col);
+    if (ret != ARM_MATH_SUCCESS)
+    {
+        return -1;
+    }
+
+    arm_softmax_q7(work->logits, model->num_classes, probs);
+
+    return 0;
+}
+
+/* ==================== 识别引擎 ==================== */
+
+/* 初始化引擎：model_blob 需在引擎使用期间保持有效 */
+int kws_engine_init(kws_engine_t *kws, const uint8_t *model_blob, uint32_t model_size)
+{
+    memset(kws, 0, sizeof(kws_engine_t));
+
+    if (kws_model_load(&kws->model, model_blob, model_size) != 0)
+    {
+        return -1;
+    }
+    if (kws_frontend_init(&kws->frontend) != 0)
+    {
+        return -1;
+    }
+
+    kws->threshold = KWS_DETECT_THRESHOLD;
+    kws_engine_reset(kws);
+
+    return 0;
+}
+
+/* 清空音频和后验历史（不影响模型和统计）*/
+void kws_engine_reset(kws_engine_t *kws)
+{
+    kws->frame_fill = 0;
+    kws->mfcc_frames = 0;
+    kws->since_infer = 0;
+    kws->history_idx = 0;
+    kws->history_count = 0;
+    kws->suppress = 0;
+    memset(kws->smoothed, 0, sizeof(kws->smoothed));
+}
+
+/* 对当前1秒窗口做一次推理 */
+int kws_engine_classify(kws_engine_t *kws, q7_t *probs)
+{
+    kws->inferences++;
+    return kws_model_run(&kws->model, &kws->work, kws->mfcc, probs);
+}
+
+/* kws->frame 计算一帧MFCC，窗口左移一帧，新帧放在末尾 */
+static void kws_engine_add_mfcc(kws_engine_t *kws)
+{
+    memmove(kws->mfcc, kws->mfcc + KWS_MFCC_COEFFS,
+            (KWS_INPUT_FRAMES - 1) * KWS_MFCC_COEFFS);
+    kws_frontend_compute(&kws->frontend, kws->frame, kws->model.mfcc_dec_bits,
+                         kws->mfcc + (KWS_INPUT_FRAMES - 1) * KWS_MFCC_COEFFS);
+    kws->frames++;
+}
+
+/* 一次推理结果进入平滑窗口，返回平滑后超过门限的关键词，否则-1 */
+static int kws_engine_smooth(kws_engine_t *kws, const q7_t *probs)
+{
+    uint32_t i, k;
+
+    memcpy(kws->history[kws->history_idx], probs, kws->model.num_classes);
+    kws->history_idx = (kws->history_idx + 1) % KWS_SMOOTH_WINDOW;
+    if (kws->history_count < KWS_SMOOTH_WINDOW)
+    {
+        kws->history_count++;
+    }
+
+    for (i = 0; i < kws->model.num_classes; i++)
+    {
+        uint32_t sum = 0;
+
+        for (k = 0; k < kws->history_count; k++)
+        {
+            sum += (uint8_t)kws->history[k][i];
+        }
+        kws->smoothed[i] = sum / kws->history_count;
+    }
+
+    if (kws->suppress == 0 && kws->history_count == KWS_SMOOTH_WINDOW &&
+        kws->smoothed[kws->model.wakeup_index] >= kws->threshold)
+    {
+        return kws->model.wakeup_index;
+    }
+
+    return -1;
+}
+
+/* 送入任意长度的PCM，检测到唤醒词时返回类别序号，否则返回-1 */
+int kws_engine_process(kws_engine_t *kws, const int16_t *samples, uint32_t count)
+{
+    int detected = -1;
+
+    while (count > 0)
+    {
+        uint32_t n = KWS_FRAME_LEN - kws->frame_fill;
+        q7_t probs[KWS_MAX_CLASSES];
+
+        if (n > count)
+        {
+            n = count;
+        }
+        memcpy(kws->frame + kws->frame_fill, samples, n * sizeof(int16_t));
+        kws->frame_fill += n;
+        samples += n;
+        count -= n;
+
+        if (kws->frame_fill < KWS_FRAME_LEN)
+        {
+            break;
+        }
+
+        kws_engine_add_mfcc(kws);
+
+        /* 帧移20ms：保留后半帧 */
+        memmove(kws->frame, kws->frame + KWS_FRAME_SHIFT,
+                (KWS_FRAME_LEN - KWS_FRAME_SHIFT) * sizeof(int16_t));
+        kws->frame_fill = KWS_FRAME_LEN - KWS_FRAME_SHIFT;
+
+        if (kws->suppress > 0)
+        {
+            kws->suppress--;
+        }
+        if (kws->mfcc_frames < KWS_INPUT_FRAMES)
+        {
+            kws->mfcc_frames++;
+            continue;
+        }
+        if (++kws->since_infer < KWS_INFER_INTERVAL)
+        {
+            continue;
+        }
+        kws->since_infer = 0;
+
+        if (kws_engine_classify(kws, probs) != 0)
+        {
+            continue;
+        }
+
+        if (kws_engine_smooth(kws, probs) >= 0)
+        {
+            detected = kws->model.wakeup_index;
+            kws->detections++;
+            kws->suppress = KWS_SUPPRESS_FRAMES;
+            kws->history_idx = 0;
+            kws->history_count = 0;
+        }
+    }
+
+    return detected;
+}
+
+/* ==================== 短语识别 ==================== */
+
+/* 静音、其他词等不对应任何命令的类别 */
+int kws_is_filler(const char *label)
+{
+    return label[0] == '_' || strcmp(label, "silence") == 0 || strcmp(label, "unknown") == 0;
+}
+
+/* 从补零后的语音中取出从start开始的一帧，start可以为负（前面补的零）*/
+static void kws_spot_frame(int16_t *frame, const int16_t *pcm, uint32_t count, int32_t start)
+{
+    int32_t from = start < 0 ? -start : 0;
+    int32_t to = (int32_t)count - start;
+
+    if (to > KWS_FRAME_LEN)
+    {
+        to = KWS_FRAME_LEN;
+    }
+    memset(frame, 0, KWS_FRAME_LEN * sizeof(int16_t));
+    if (to > from)
+    {
+        memcpy(frame + from, pcm + start + from, (to - from) * sizeof(int16_t));
+    }
+}
+
+/* 对一段完整的语音（VAD裁剪后的一句话）做短语识别：不足1秒时前后补零居中，推理一次；
+ * 超过1秒时窗口每 KWS_SPOT_STRIDE 帧滑动一次，最后一个窗口总是包括语音末尾。
+ * scores为各类别在所有窗口中的最大后验（q7）；返回后验不低于threshold的非填充类别，否则-1 */
+int kws_engine_spot(kws_engine_t *kws, const int16_t *pcm, uint32_t count, uint8_t threshold, uint8_t *scores)
+{
+    uint32_t total = count > KWS_SAMPLE_RATE ? count : KWS_SAMPLE_RATE;
+    int32_t lead = (int32_t)(total - count) / 2;
+    q7_t probs[KWS_MAX_CLASSES];
+    uint32_t pos, frames = 0;
+    int best = -1;
+    int i;
+
+    kws_engine_reset(kws);
+    memset(scores, 0, KWS_MAX_CLASSES);
+
+    for (pos = 0; pos + KWS_FRAME_LEN <= total; pos += KWS_FRAME_SHIFT)
+    {
+        kws_spot_frame(kws->frame, pcm, count, (int32_t)pos - lead);
+        kws_engine_add_mfcc(kws);
+
+        if (++frames < KWS_INPUT_FRAMES)
+        {
+            continue;
+        }
+        if ((frames - KWS_INPUT_FRAMES) % KWS_SPOT_STRIDE != 0 &&
+            pos + KWS_FRAME_SHIFT + KWS_FRAME_LEN <= total)
+        {
+            continue;
+        }
+        if (kws_engine_classify(kws, probs) != 0)
+        {
+            return -1;
+        }
+
+        for (i = 0; i < kws->model.num_classes; i++)
+        {
+            if ((uint8_t)probs[i] > scores[i])
+            {
+                scores[i] = (uint8_t)probs[i];
+            }
+        }
+    }
+
+    for (i = 0; i < kws->model.num_classes; i++)
+    {
+        if (!kws_is_filler(kws->model.labels[i]) && (best < 0 || scores[i] > scores[best]))
+        {
+            best = i;
+        }
+    }
+
+    return (best >= 0 && scores[best] >= threshold) ? best : -1;
+}
+
+#endif /* KWS_ENABLE */
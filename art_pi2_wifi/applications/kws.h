@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-21     AI Assistant first version - On-device Keyword Spotting
+ * 2024-10-27     AI Assistant Add utterance-level phrase spotting for local commands
+ */
+
+#ifndef __KWS_H__
+#define __KWS_H__
+
+/*
+ * 本地唤醒词识别 (KWS)：
+ *   16kHz PCM -> MFCC (CMSIS-DSP arm_rfft_q15) -> DS-CNN (CMSIS-NN q7) -> 后验平滑
+ *
+ * 本模块不依赖RT-Thread内核接口，内存由调用者分配，同一份代码可在x86上编译，
+ * 用于离线评估准确率和耗时（见 kws_bench.c）。
+ */
+
+#include <stdint.h>
+
+#ifdef __RTTHREAD__
+#include <rtconfig.h>
+#endif
+
+/* 设备端需要在menuconfig中开启 External Libraries -> CMSIS-DSP/NN */
+#if !defined(__RTTHREAD__) || defined(ART_PI_USING_CMSIS_DSP_NN)
+#define KWS_ENABLE              1
+#else
+#define KWS_ENABLE              0
+#endif
+
+#if KWS_ENABLE
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/* ==================== 前端 (MFCC) ==================== */
+
+#define KWS_SAMPLE_RATE         16000
+#define KWS_FRAME_LEN           640     /* 40ms */
+#define KWS_FRAME_SHIFT         320     /* 20ms */
+#define KWS_FFT_LEN             1024
+#define KWS_MEL_BINS            40
+#define KWS_MEL_LOW_HZ          20
+#define KWS_MEL_HIGH_HZ         4000
+#define KWS_MFCC_COEFFS         10
+#define KWS_MEL_WEIGHTS_MAX     ((KWS_FFT_LEN / 2 + 1) * 2)
+
+typedef struct {
+    arm_rfft_instance_q15 rfft;
+    q15_t window[KWS_FRAME_LEN];
+    q15_t fft_in[KWS_FFT_LEN];
+    q15_t fft_out[KWS_FFT_LEN * 2];
+
+    /* 三角滤波器组：每个滤波器覆盖 [mel_start, mel_start + mel_len) 个FFT点 */
+    uint16_t mel_start[KWS_MEL_BINS];
+    uint16_t mel_len[KWS_MEL_BINS];
+    uint16_t mel_offset[KWS_MEL_BINS];
+    float mel_weight[KWS_MEL_WEIGHTS_MAX];
+
+    float dct[KWS_MFCC_COEFFS * KWS_MEL_BINS];
+} kws_frontend_t;
+
+int kws_frontend_init(kws_frontend_t *fe);
+void kws_frontend_compute(kws_frontend_t *fe, const int16_t *frame, int dec_bits, q7_t *mfcc);
+
+/* ==================== 模型 (DS-CNN) ==================== */
+
+/*
+ * 模型文件格式（小端，由训练脚本量化导出）：
+ *   [0]   magic "KWS1"
+ *   [4]   version, num_classes, wakeup_index, channels
+ *   [8]   mfcc_dec_bits, reserved[3]
+ *   [12]  每层 {bias_shift, out_shift}，共 KWS_LAYER_NUM 层
+ *   [32]  类别名，KWS_MAX_CLASSES x KWS_LABEL_LEN
+ *   [176] q7权重：conv1_w, conv1_b, 4 x {dw_w, dw_b, pw_w, pw_b}, fc_w, fc_b
+ *
+ * 网络结构（ML-KWS DS-CNN small）：
+ *   conv 10x4/2 (C) -> 4 x [dw 3x3 (C) -> pw 1x1 (C)] -> avgpool -> fc (N)
+ *   卷积权重为HWC排列，每层之后ReLU
+ */
+#define KWS_MODEL_MAGIC         0x3153574B  /* "KWS1" */
+#define KWS_MODEL_VERSION       1
+#define KWS_MODEL_HEADER_SIZE   176
+
+#define KWS_INPUT_FRAMES        49          /* 1秒窗口 */
+#define KWS_DS_BLOCKS           4
+#define KWS_LAYER_NUM           (2 + KWS_DS_BLOCKS * 2)
+#define KWS_MAX_CLASSES         12
+#define KWS_MAX_CHANNELS        64
+#define KWS_LABEL_LEN           12
+
+#define KWS_CONV1_KX            4
+#define KWS_CONV1_KY            10
+#define KWS_FEAT_X              5           /* conv1输出: 5 (MFCC方向) x 25 (时间方向) */
+#define KWS_FEAT_Y              25
+#define KWS_ACT_SIZE            (KWS_FEAT_X * KWS_FEAT_Y * KWS_MAX_CHANNELS)
+#define KWS_COL_BUFFER_LEN      (2 * KWS_MAX_CHANNELS * 3 * 3)
+
+typedef struct {
+    uint8_t num_classes;
+    uint8_t wakeup_index;
+    uint8_t channels;
+    int8_t mfcc_dec_bits;
+    uint8_t bias_shift[KWS_LAYER_NUM];
+    uint8_t out_shift[KWS_LAYER_NUM];
+    char labels[KWS_MAX_CLASSES][KWS_LABEL_LEN + 1];
+
+    /* 指向模型数据内部，模型数据需在使用期间保持有效 */
+    const q7_t *conv1_w;
+    const q7_t *conv1_b;
+    const q7_t *dw_w[KWS_DS_BLOCKS];
+    const q7_t *dw_b[KWS_DS_BLOCKS];
+    const q7_t *pw_w[KWS_DS_BLOCKS];
+    const q7_t *pw_b[KWS_DS_BLOCKS];
+    const q7_t *fc_w;
+    const q7_t *fc_b;
+} kws_model_t;
+
+/* 推理工作区 */
+typedef struct {
+    q7_t act_a[KWS_ACT_SIZE];
+    q7_t act_b[KWS_ACT_SIZE];
+    q15_t col[KWS_COL_BUFFER_LEN];
+    q7_t logits[KWS_MAX_CLASSES];
+} kws_model_work_t;
+
+uint32_t kws_model_size(uint8_t channels, uint8_t num_classes);
+int kws_model_load(kws_model_t *model, const uint8_t *blob, uint32_t size);
+int kws_model_run(const kws_model_t *model, kws_model_work_t *work, const q7_t *mfcc, q7_t *probs);
+
+/* ==================== 识别引擎 ==================== */
+
+#define KWS_INFER_INTERVAL      2       /* 每2帧 (40ms) 推理一次 */
+#define KWS_SMOOTH_WINDOW       5       /* 后验概率平均的推理次数 (200ms) */
+#define KWS_DETECT_THRESHOLD    90      /* 平滑后的q7概率门限 (约0.7) */
+#define KWS_SUPPRESS_FRAMES     50      /* 触发后抑制的帧数 (1秒) */
+
+typedef struct {
+    kws_frontend_t frontend;
+    kws_model_t model;
+    kws_model_work_t work;
+
+    /* 分帧：保留上一帧的后半部分 */
+    int16_t frame[KWS_FRAME_LEN];
+    uint32_t frame_fill;
+
+    /* MFCC滑动窗口，最新帧在末尾 */
+    q7_t mfcc[KWS_INPUT_FRAMES * KWS_MFCC_COEFFS];
+    uint32_t mfcc_frames;
+    uint32_t since_infer;
+
+    /* 后验平滑 */
+    q7_t history[KWS_SMOOTH_WINDOW][KWS_MAX_CLASSES];
+    uint32_t history_idx;
+    uint32_t history_count;
+    uint8_t smoothed[KWS_MAX_CLASSES];
+    uint8_t threshold;
+    uint32_t suppress;
+
+    /* 统计 */
+    uint32_t frames;
+    uint32_t inferences;
+    uint32_t detections;
+} kws_engine_t;
+
+int kws_engine_init(kws_engine_t *kws, const uint8_t *model_blob, uint32_t model_size);
+void kws_engine_reset(kws_engine_t *kws);
+int kws_engine_process(kws_engine_t *kws, const int16_t *samples, uint32_t count);
+int kws_engine_classify(kws_engine_t *kws, q7_t *probs);
+
+/* ==================== 短语识别 ==================== */
+
+/*
+ * 本地命令：同一个前端和网络结构，模型的类别为命令词（"stop"、"vol_up"等），
+ * 类别名为 silence、unknown 或以'_'开头的是填充类别，识别为这些类别时交给云端。
+ * 与唤醒词的连续检测不同，输入是一句已经结束的话，一次处理完。
+ */
+#define KWS_SPOT_STRIDE         5       /* 超过1秒的语音，窗口每5帧 (100ms) 推理一次 */
+
+int kws_is_filler(const char *label);
+int kws_engine_spot(kws_engine_t *kws, const int16_t *pcm, uint32_t count, uint8_t threshold, uint8_t *scores);
+
+#endif /* KWS_ENABLE */
+
+#endif /* __KWS_H__ */
@@ -0,0 +1,556 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-21     AI Assistant first version - KWS accuracy/latency benchmark
+ * 2024-10-27     AI Assistant Add local command mode (whole utterances, fallback rate)
+ */
+
+/*
+ * 本地唤醒词识别评估：对目录中的1秒WAV逐个分类，统计准确率、误唤醒/漏唤醒和耗时
+ *
+ * 目录结构（与Speech Commands数据集相同）：
+ *   <dir>/<label>/xxx.wav  类别取子目录名
+ *   <dir>/<label>_xxx.wav  或文件名中第一个'_'之前的部分
+ * WAV须为16kHz/16bit/单声道，不足1秒补零，超过1秒截断。
+ *
+ * 加上 cmd 参数时按本地命令评估（voice_cmd.c 的判定方法）：每个文件是VAD裁剪后的一句话，
+ * 可以长于1秒；类别不在模型中或为填充类别的文件是应该交给云端的普通问题，
+ * 统计命令的识别率、错识别为其他命令和被误拦截的普通问题。
+ * 命令名带'_'（vol_up等）时须用子目录存放。
+ *
+ * 设备端：kws_bench /sdcard/kws_model.bin /sdcard/kws_test
+ *         kws_bench /sdcard/cmd_model.bin /sdcard/cmd_test cmd
+ * PC端（与设备端同一份代码）：
+ *   gcc -O2 -DKWS_BENCH_MAIN -D__GNUC_PYTHON__ -D__RESTRICT=__restrict -include arm_math.h \
+ *       -DARM_DSP_CONFIG_TABLES -DARM_FFT_ALLOW_TABLES -DARM_TABLE_REALCOEF_Q15 \
+ *       -DARM_TABLE_TWIDDLECOEF_Q15_512 -DARM_TABLE_BITREVIDX_FXT_512 \
+ *       -I../libraries/CMSIS/DSP/Include -I../libraries/CMSIS/DSP/PrivateInclude \
+ *       -I../libraries/CMSIS/NN/Include -I../libraries/CMSIS/Core/Include \
+ *       kws.c kws_bench.c <libraries/CMSIS/SConscript 中列出的CMSIS源文件> -lm -o kws_bench
+ *   ./kws_bench kws_model.bin speech_commands_test/
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "kws.h"
+#include "voice_assistant_config.h"
+
+#if KWS_ENABLE
+
+#ifdef __RTTHREAD__
+#include <rtthread.h>
+#include <board.h>
+#define KWS_PRINTF      rt_kprintf
+#define KWS_SNPRINTF    rt_snprintf
+#define KWS_MALLOC      rt_malloc
+#define KWS_FREE        rt_free
+#else
+#include <stdio.h>
+#include <time.h>
+#define KWS_PRINTF      printf
+#define KWS_SNPRINTF    snprintf
+#define KWS_MALLOC      malloc
+#define KWS_FREE        free
+#endif
+
+#define KWS_BENCH_SAMPLES   KWS_SAMPLE_RATE     /* 1秒 */
+#define KWS_BENCH_CMD_SAMPLES   (KWS_SAMPLE_RATE * VOICE_CMD_MAX_MS / 1000)
+#define KWS_BENCH_PATH_MAX  256
+
+/* 评估统计 */
+typedef struct {
+    kws_engine_t *kws;
+    int16_t *pcm;
+
+    uint32_t files;
+    uint32_t labeled;
+    uint32_t correct;
+    uint32_t wakeup_files;
+    uint32_t false_reject;
+    uint32_t false_accept;
+
+    /* 本地命令模式 */
+    int cmd_mode;
+    uint32_t cmd_files;
+    uint32_t cmd_correct;
+    uint32_t cmd_wrong;         /* 识别成了另一个命令 */
+    uint32_t other_files;
+    uint32_t intercepted;       /* 普通问题被当作命令 */
+    uint32_t too_long;          /* 超过 VOICE_CMD_MAX_MS，不识别直接交给云端 */
+
+    uint64_t fe_us;
+    uint64_t nn_us;
+    uint32_t fe_max_us;
+    uint32_t nn_max_us;
+} kws_bench_t;
+
+/* 微秒时间戳（只用于计算差值）*/
+static uint32_t kws_bench_now_us(void)
+{
+#ifdef __RTTHREAD__
+    /* DWT周期计数器 */
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    return DWT->CYCCNT / (SystemCoreClock / 1000000);
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000);
+#endif
+}
+
+/* 读取整个文件 */
+static uint8_t *kws_bench_load_file(const char *path, uint32_t *size)
+{
+    struct stat st;
+    uint8_t *data;
+    int fd;
+
+    if (stat(path, &st) != 0 || st.st_size <= 0)
+    {
+        return NULL;
+    }
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+    data = (uint8_t *)KWS_MALLOC(st.st_size);
+    if (data != NULL && read(fd, data, st.st_size) != st.st_size)
+    {
+        KWS_FREE(data);
+        data = NULL;
+    }
+    close(fd);
+
+    *size = st.st_size;
+    return data;
+}
+
+/* 读取WAV的PCM数据（只支持16kHz/16bit/单声道），返回样本数，失败返回-1 */
+static int kws_bench_read_wav(const char *path, int16_t *pcm, uint32_t max_samples)
+{
+    uint8_t header[12];
+    uint8_t chunk[8];
+    uint32_t sample_rate = 0;
+    uint16_t channels = 0, bits = 0;
+    int fd, len = -1;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    if (read(fd, header, sizeof(header)) != sizeof(header) ||
+        memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    while (read(fd, chunk, sizeof(chunk)) == sizeof(chunk))
+    {
+        uint32_t size = chunk[4] | (chunk[5] << 8) | (chunk[6] << 16) | ((uint32_t)chunk[7] << 24);
+
+        if (memcmp(chunk, "fmt ", 4) == 0 && size >= 16)
+        {
+            uint8_t fmt[16];
+
+            if (read(fd, fmt, sizeof(fmt)) != sizeof(fmt))
+            {
+                break;
+            }
+            channels = fmt[2] | (fmt[3] << 8);
+            sample_rate = fmt[4] | (fmt[5] << 8) | (fmt[6] << 16) | ((uint32_t)fmt[7] << 24);
+            bits = fmt[14] | (fmt[15] << 8);
+            size -= sizeof(fmt);
+        }
+        else if (memcmp(chunk, "data", 4) == 0)
+        {
+            if (sample_rate != KWS_SAMPLE_RATE || channels != 1 || bits != 16)
+            {
+                break;
+            }
+            if (size > max_samples * sizeof(int16_t))
+            {
+                size = max_samples * sizeof(int16_t);
+            }
+            len = read(fd, pcm, size);
+            len = len > 0 ? len / (int)sizeof(int16_t) : -1;
+            break;
+        }
+        lseek(fd, (size + 1) & ~1, SEEK_CUR);
+    }
+    close(fd);
+
+    return len;
+}
+
+/* 类别名 -> 模型类别序号，找不到返回-1 */
+static int kws_bench_label_index(const kws_model_t *model, const char *label, uint32_t len)
+{
+    int i;
+
+    for (i = 0; i < model->num_classes; i++)
+    {
+        if (strlen(model->labels[i]) == len && strncmp(model->labels[i], label, len) == 0)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/* 按本地命令评估一句话 */
+static void kws_bench_cmd_file(kws_bench_t *bench, const char *path, const char *label, uint32_t label_len)
+{
+    kws_engine_t *kws = bench->kws;
+    uint8_t scores[KWS_MAX_CLASSES];
+    uint32_t t0, t1;
+    int samples, expected, predicted = -1;
+    int is_cmd;
+
+    /* 多读一个样本，用来判断是否超长 */
+    samples = kws_bench_read_wav(path, bench->pcm, KWS_BENCH_CMD_SAMPLES + 1);
+    if (samples < 0)
+    {
+        KWS_PRINTF("skip %s (not 16kHz/16bit/mono)\n", path);
+        return;
+    }
+
+    expected = kws_bench_label_index(&kws->model, label, label_len);
+    is_cmd = expected >= 0 && !kws_is_filler(kws->model.labels[expected]);
+
+    bench->files++;
+    if (samples > KWS_BENCH_CMD_SAMPLES)
+    {
+        bench->too_long++;
+    }
+    else
+    {
+        t0 = kws_bench_now_us();
+        predicted = kws_engine_spot(kws, bench->pcm, samples, VOICE_CMD_THRESHOLD, scores);
+        t1 = kws_bench_now_us();
+        bench->nn_us += t1 - t0;
+        if (t1 - t0 > bench->nn_max_us)
+        {
+            bench->nn_max_us = t1 - t0;
+        }
+    }
+
+    if (is_cmd)
+    {
+        bench->cmd_files++;
+        if (predicted == expected)
+        {
+            bench->cmd_correct++;
+        }
+        else if (predicted >= 0)
+        {
+            bench->cmd_wrong++;
+        }
+    }
+    else
+    {
+        bench->other_files++;
+        if (predicted >= 0)
+        {
+            bench->intercepted++;
+        }
+    }
+}
+
+/* 评估一个WAV文件 */
+static void kws_bench_file(kws_bench_t *bench, const char *path, const char *label, uint32_t label_len)
+{
+    kws_engine_t *kws = bench->kws;
+    q7_t probs[KWS_MAX_CLASSES];
+    uint32_t t0, t1, t2;
+    int samples, expected, predicted = 0;
+    int i;
+
+    if (bench->cmd_mode)
+    {
+        kws_bench_cmd_file(bench, path, label, label_len);
+        return;
+    }
+
+    samples = kws_bench_read_wav(path, bench->pcm, KWS_BENCH_SAMPLES);
+    if (samples < 0)
+    {
+        KWS_PRINTF("skip %s (not 16kHz/16bit/mono)\n", path);
+        return;
+    }
+    memset(bench->pcm + samples, 0, (KWS_BENCH_SAMPLES - samples) * sizeof(int16_t));
+
+    /* 1秒正好产生 KWS_INPUT_FRAMES 帧MFCC，引擎不会自行推理 */
+    kws_engine_reset(kws);
+    t0 = kws_bench_now_us();
+    kws_engine_process(kws, bench->pcm, KWS_BENCH_SAMPLES);
+    t1 = kws_bench_now_us();
+    if (kws_engine_classify(kws, probs) != 0)
+    {
+        KWS_PRINTF("inference failed on %s\n", path);
+        return;
+    }
+    t2 = kws_bench_now_us();
+
+    for (i = 1; i < kws->model.num_classes; i++)
+    {
+        if (probs[i] > probs[predicted])
+        {
+            predicted = i;
+        }
+    }
+
+    bench->files++;
+    bench->fe_us += t1 - t0;
+    bench->nn_us += t2 - t1;
+    if (t1 - t0 > bench->fe_max_us)
+    {
+        bench->fe_max_us = t1 - t0;
+    }
+    if (t2 - t1 > bench->nn_max_us)
+    {
+        bench->nn_max_us = t2 - t1;
+    }
+
+    expected = kws_bench_label_index(&kws->model, label, label_len);
+    if (expected >= 0)
+    {
+        bench->labeled++;
+        if (predicted == expected)
+        {
+            bench->correct++;
+        }
+    }
+
+    if (expected == kws->model.wakeup_index)
+    {
+        bench->wakeup_files++;
+        if (predicted != expected)
+        {
+            bench->false_reject++;
+        }
+    }
+    else if (predicted == kws->model.wakeup_index)
+    {
+        bench->false_accept++;
+    }
+}
+
+/* 遍历目录，depth=0时子目录名作为类别 */
+static void kws_bench_dir(kws_bench_t *bench, const char *dir, const char *dir_label, int depth)
+{
+    char path[KWS_BENCH_PATH_MAX];
+    struct dirent *ent;
+    struct stat st;
+    DIR *d;
+
+    d = opendir(dir);
+    if (d == NULL)
+    {
+        KWS_PRINTF("Failed to open %s\n", dir);
+        return;
+    }
+
+    while ((ent = readdir(d)) != NULL)
+    {
+        const char *name = ent->d_name;
+        uint32_t len = strlen(name);
+
+        if (name[0] == '.')
+        {
+            continue;
+        }
+        /* 截断的路径会指向别的文件，跳过 */
+        if (KWS_SNPRINTF(path, sizeof(path), "%s/%s", dir, name) >= (int)sizeof(path))
+        {
+            KWS_PRINTF("Path too long, skipped: %s/%s\n", dir, name);
+            continue;
+        }
+        if (stat(path, &st) != 0)
+        {
+            continue;
+        }
+
+        if (S_ISDIR(st.st_mode))
+        {
+            if (depth == 0)
+            {
+                kws_bench_dir(bench, path, name, 1);
+            }
+        }
+        else if (len > 4 && strcmp(name + len - 4, ".wav") == 0)
+        {
+            if (dir_label != NULL)
+            {
+                kws_bench_file(bench, path, dir_label, strlen(dir_label));
+            }
+            else
+            {
+                const char *sep = strchr(name, '_');
+                kws_bench_file(bench, path, name, sep ? (uint32_t)(sep - name) : len - 4);
+            }
+        }
+    }
+    closedir(d);
+}
+
+/* 输出本地命令模式的统计 */
+static void kws_bench_cmd_report(kws_bench_t *bench)
+{
+    uint32_t spotted = bench->files - bench->too_long;
+
+    KWS_PRINTF("Files: %u (commands %u, other %u, longer than %d ms %u)\n", bench->files,
+               bench->cmd_files, bench->other_files, VOICE_CMD_MAX_MS, bench->too_long);
+    if (bench->cmd_files > 0)
+    {
+        KWS_PRINTF("Commands: handled locally %u/%u (%u%%), wrong command %u, sent to cloud %u\n",
+                   bench->cmd_correct, bench->cmd_files, bench->cmd_correct * 100 / bench->cmd_files,
+                   bench->cmd_wrong, bench->cmd_files - bench->cmd_correct - bench->cmd_wrong);
+    }
+    if (bench->other_files > 0)
+    {
+        KWS_PRINTF("Other speech: intercepted %u/%u\n", bench->intercepted, bench->other_files);
+    }
+    if (spotted > 0)
+    {
+        KWS_PRINTF("Spotting (threshold %d/127): avg %u us, max %u us\n", VOICE_CMD_THRESHOLD,
+                   (uint32_t)(bench->nn_us / spotted), bench->nn_max_us);
+    }
+}
+
+/* 运行评估，cmd_mode为真时按本地命令评估 */
+int kws_bench(const char *model_path, const char *dir, int cmd_mode)
+{
+    kws_bench_t bench;
+    uint8_t *model;
+    uint32_t model_size;
+    int ret = -1;
+
+    memset(&bench, 0, sizeof(bench));
+    bench.cmd_mode = cmd_mode;
+
+    model = kws_bench_load_file(model_path, &model_size);
+    if (model == NULL)
+    {
+        KWS_PRINTF("Failed to load model %s\n", model_path);
+        return -1;
+    }
+
+    bench.kws = (kws_engine_t *)KWS_MALLOC(sizeof(kws_engine_t));
+    bench.pcm = (int16_t *)KWS_MALLOC((KWS_BENCH_CMD_SAMPLES + 1) * sizeof(int16_t));
+    if (bench.kws == NULL || bench.pcm == NULL)
+    {
+        KWS_PRINTF("Out of memory\n");
+        goto _exit;
+    }
+
+    if (kws_engine_init(bench.kws, model, model_size) != 0)
+    {
+        KWS_PRINTF("Invalid model %s\n", model_path);
+        goto _exit;
+    }
+
+    if (cmd_mode)
+    {
+        KWS_PRINTF("Model: %d classes, %d channels, local commands\n",
+                   bench.kws->model.num_classes, bench.kws->model.channels);
+    }
+    else
+    {
+        KWS_PRINTF("Model: %d classes, %d channels, wakeup class '%s'\n",
+                   bench.kws->model.num_classes, bench.kws->model.channels,
+                   bench.kws->model.labels[bench.kws->model.wakeup_index]);
+    }
+
+    kws_bench_dir(&bench, dir, NULL, 0);
+
+    if (bench.files == 0)
+    {
+        KWS_PRINTF("No WAV files in %s\n", dir);
+        goto _exit;
+    }
+
+    if (cmd_mode)
+    {
+        kws_bench_cmd_report(&bench);
+        ret = 0;
+        goto _exit;
+    }
+
+    KWS_PRINTF("Files: %u (labeled %u)\n", bench.files, bench.labeled);
+    if (bench.labeled > 0)
+    {
+        KWS_PRINTF("Accuracy: %u/%u (%u.%u%%)\n", bench.correct, bench.labeled,
+                   bench.correct * 100 / bench.labeled, bench.correct * 1000 / bench.labeled % 10);
+    }
+    KWS_PRINTF("Wakeup: false reject %u/%u, false accept %u/%u\n",
+               bench.false_reject, bench.wakeup_files,
+               bench.false_accept, bench.files - bench.wakeup_files);
+    KWS_PRINTF("MFCC (49 frames): avg %u us, max %u us\n",
+               (uint32_t)(bench.fe_us / bench.files), bench.fe_max_us);
+    KWS_PRINTF("DS-CNN inference: avg %u us, max %u us\n",
+               (uint32_t)(bench.nn_us / bench.files), bench.nn_max_us);
+    ret = 0;
+
+_exit:
+    if (bench.pcm)
+    {
+        KWS_FREE(bench.pcm);
+    }
+    if (bench.kws)
+    {
+        KWS_FREE(bench.kws);
+    }
+    KWS_FREE(model);
+
+    return ret;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+static int cmd_kws_bench(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        rt_kprintf("Usage: kws_bench <model.bin> <wav_dir> [cmd]\n");
+        return -1;
+    }
+
+    return kws_bench(argv[1], argv[2], argc > 3 && strcmp(argv[3], "cmd") == 0);
+}
+MSH_CMD_EXPORT_ALIAS(cmd_kws_bench, kws_bench, Evaluate KWS or local command model on a WAV directory);
+#endif
+
+#ifdef KWS_BENCH_MAIN
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        printf("Usage: %s <model.bin> <wav_dir> [cmd]\n", argv[0]);
+        return 1;
+    }
+
+    return kws_bench(argv[1], argv[2], argc > 3 && strcmp(argv[3], "cmd") == 0) == 0 ? 0 : 1;
+}
+#endif
+
+#endif /* KWS_ENABLE */
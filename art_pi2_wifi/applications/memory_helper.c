@@ -6,14 +6,252 @@
  * Change Logs:
  * Date           Author       Notes
  * 2024-10-17     AI Assistant Memory helper utilities
+ * 2024-10-27     AI Assistant Add memory allocation classes
+ * 2024-10-27     AI Assistant Keep FAST allocations in SRAM, free PSRAM blocks through memheap
+ * 2024-10-27     AI Assistant Add mem_class_realloc
  */
 
 #include <rtthread.h>
+#include "memory_helper.h"
 
 #define DBG_TAG "mem.helper"
 #define DBG_LVL DBG_INFO
 #include <rtdbg.h>
 
+static const char *const mem_class_names[MEM_CLASS_COUNT] = {"fast", "bulk"};
+
+static struct {
+#ifdef RT_USING_MEMHEAP
+    struct rt_memheap *sram;
+    struct rt_memheap *psram;
+    rt_bool_t probed;
+#endif
+    uint32_t allocs[MEM_CLASS_COUNT];
+    uint32_t live[MEM_CLASS_COUNT];
+    uint32_t fallbacks[MEM_CLASS_COUNT];
+    uint32_t failures[MEM_CLASS_COUNT];
+} mem_class_ctrl;
+
+#ifdef RT_USING_MEMHEAP
+/*
+ * 第一次使用时查找两个堆：PSRAM在板级初始化时注册为memheap "psram"；
+ * 开启 RT_USING_MEMHEAP_AS_HEAP 时SRAM中的系统堆也是memheap，名为 "heap"
+ */
+static void mem_class_probe(void)
+{
+    if (!mem_class_ctrl.probed)
+    {
+#ifdef RT_USING_MEMHEAP_AS_HEAP
+        mem_class_ctrl.sram = (struct rt_memheap *)rt_object_find("heap", RT_Object_Class_MemHeap);
+#endif
+        mem_class_ctrl.psram = (struct rt_memheap *)rt_object_find("psram", RT_Object_Class_MemHeap);
+        mem_class_ctrl.probed = RT_TRUE;
+    }
+}
+
+static struct rt_memheap *mem_class_psram(void)
+{
+    mem_class_probe();
+    return mem_class_ctrl.psram;
+}
+
+static struct rt_memheap *mem_class_sram(void)
+{
+    mem_class_probe();
+    return mem_class_ctrl.sram;
+}
+#endif
+
+mem_class_t mem_class_of(const void *ptr)
+{
+#ifdef RT_USING_MEMHEAP
+    struct rt_memheap *psram = mem_class_psram();
+    
+    if (psram != RT_NULL &&
+        (const uint8_t *)ptr >= (const uint8_t *)psram->start_addr &&
+        (const uint8_t *)ptr < (const uint8_t *)psram->start_addr + psram->pool_size)
+    {
+        return MEM_CLASS_BULK;
+    }
+#else
+    (void)ptr;
+#endif
+    
+    return MEM_CLASS_FAST;
+}
+
+void *mem_class_alloc(mem_class_t cls, rt_size_t size)
+{
+    void *ptr = RT_NULL;
+    mem_class_t got;
+    
+    RT_ASSERT(cls < MEM_CLASS_COUNT);
+    
+#ifdef RT_USING_MEMHEAP
+    if (cls == MEM_CLASS_BULK && mem_class_psram() != RT_NULL)
+    {
+        ptr = rt_memheap_alloc(mem_class_ctrl.psram, size);
+    }
+    else if (cls == MEM_CLASS_FAST && mem_class_sram() != RT_NULL)
+    {
+        /* 只从SRAM分配：rt_malloc 在SRAM不足时会落到PSRAM，FAST宁可失败 */
+        ptr = rt_memheap_alloc(mem_class_ctrl.sram, size);
+        if (ptr == RT_NULL)
+        {
+            rt_enter_critical();
+            mem_class_ctrl.failures[cls]++;
+            rt_exit_critical();
+            return RT_NULL;
+        }
+    }
+#endif
+    if (ptr == RT_NULL)
+    {
+        /* BULK在PSRAM不足时落到系统堆；系统堆不是memheap时只有SRAM */
+        ptr = rt_malloc(size);
+    }
+    if (ptr == RT_NULL)
+    {
+        rt_enter_critical();
+        mem_class_ctrl.failures[cls]++;
+        rt_exit_critical();
+        return RT_NULL;
+    }
+    
+    got = mem_class_of(ptr);
+    rt_enter_critical();
+    mem_class_ctrl.allocs[cls]++;
+    mem_class_ctrl.live[got]++;
+    if (got != cls)
+    {
+        mem_class_ctrl.fallbacks[cls]++;
+    }
+    rt_exit_critical();
+    
+    if (got != cls)
+    {
+        LOG_D("%s allocation of %d bytes placed in %s memory", mem_class_names[cls], (int)size, mem_class_names[got]);
+    }
+    
+    return ptr;
+}
+
+void *mem_class_realloc(void *ptr, rt_size_t size)
+{
+    mem_class_t cls;
+    mem_class_t got;
+    void *new_ptr;
+    
+    if (ptr == RT_NULL)
+    {
+        return mem_class_alloc(MEM_CLASS_BULK, size);
+    }
+    if (size == 0)
+    {
+        mem_class_free(ptr);
+        return RT_NULL;
+    }
+    
+    cls = mem_class_of(ptr);
+#ifdef RT_USING_MEMHEAP
+    /* 原地扩大不了时memheap在同一个堆中另分配、复制并释放原来的块 */
+    if (cls == MEM_CLASS_BULK)
+    {
+        new_ptr = rt_memheap_realloc(mem_class_ctrl.psram, ptr, size);
+    }
+    else if (mem_class_sram() != RT_NULL)
+    {
+        new_ptr = rt_memheap_realloc(mem_class_ctrl.sram, ptr, size);
+    }
+    else
+#endif
+    {
+        new_ptr = rt_realloc(ptr, size);
+    }
+    if (new_ptr == RT_NULL)
+    {
+        /* 原来的块保持不变 */
+        rt_enter_critical();
+        mem_class_ctrl.failures[cls]++;
+        rt_exit_critical();
+        return RT_NULL;
+    }
+    
+    got = mem_class_of(new_ptr);
+    if (got != cls)
+    {
+        rt_enter_critical();
+        if (mem_class_ctrl.live[cls] > 0)
+        {
+            mem_class_ctrl.live[cls]--;
+        }
+        mem_class_ctrl.live[got]++;
+        rt_exit_critical();
+    }
+    
+    return new_ptr;
+}
+
+void mem_class_free(void *ptr)
+{
+    mem_class_t cls;
+    
+    if (ptr == RT_NULL)
+    {
+        return;
+    }
+    
+    cls = mem_class_of(ptr);
+    rt_enter_critical();
+    if (mem_class_ctrl.live[cls] > 0)
+    {
+        mem_class_ctrl.live[cls]--;
+    }
+    rt_exit_critical();
+    
+#ifdef RT_USING_MEMHEAP
+    /* PSRAM中的块交给memheap释放：系统堆不是memheap时 rt_free 不认识它们 */
+    if (cls == MEM_CLASS_BULK)
+    {
+        rt_memheap_free(ptr);
+        return;
+    }
+#endif
+    rt_free(ptr);
+}
+
+void mem_class_get_stats(mem_class_t cls, mem_class_stats_t *stats)
+{
+    RT_ASSERT(cls < MEM_CLASS_COUNT);
+    
+    rt_memset(stats, 0, sizeof(mem_class_stats_t));
+#ifdef RT_USING_MEMHEAP
+    if (cls == MEM_CLASS_BULK)
+    {
+        stats->heap = "psram";
+        if (mem_class_psram() != RT_NULL)
+        {
+            rt_memheap_info(mem_class_ctrl.psram, &stats->total, &stats->used, &stats->max_used);
+        }
+    }
+    else
+    {
+        stats->heap = "heap";
+        rt_memory_info(&stats->total, &stats->used, &stats->max_used);
+    }
+#else
+    stats->heap = "malloc";
+#endif
+    
+    rt_enter_critical();
+    stats->allocs = mem_class_ctrl.allocs[cls];
+    stats->live = mem_class_ctrl.live[cls];
+    stats->fallbacks = mem_class_ctrl.fallbacks[cls];
+    stats->failures = mem_class_ctrl.failures[cls];
+    rt_exit_critical();
+}
+
+#ifdef FINSH_USING_MSH
 /* 获取可用内存信息 */
 static void show_memory_info(void)
 {
@@ -29,6 +267,19 @@ static void show_memory_info(void)
     rt_kprintf("Free Memory  : %d bytes (%.2f KB)\n", total - used, (total - used) / 1024.0);
     rt_kprintf("Max Used     : %d bytes (%.2f KB)\n", max_used, max_used / 1024.0);
     rt_kprintf("Usage        : %.1f%%\n", (used * 100.0) / total);
+    rt_kprintf("========================================\n");
+    
+    /* 各类内存所在堆的用量，以及经 mem_class_alloc 分配的情况 */
+    rt_kprintf("Class Heap     Total KB  Used KB   Max KB   Live  Allocs  Fallback  Failed\n");
+    for (int i = 0; i < MEM_CLASS_COUNT; i++)
+    {
+        mem_class_stats_t stats;
+        
+        mem_class_get_stats((mem_class_t)i, &stats);
+        rt_kprintf("%-5s %-6s %9d %8d %8d %6d %7d %9d %7d\n",
+                   mem_class_names[i], stats.heap, stats.total / 1024, stats.used / 1024,
+                   stats.max_used / 1024, stats.live, stats.allocs, stats.fallbacks, stats.failures);
+    }
     rt_kprintf("========================================\n\n");
     
     if ((total - used) < 64 * 1024)
@@ -42,7 +293,6 @@ static void show_memory_info(void)
 }
 
 /* MSH命令 */
-#ifdef FINSH_USING_MSH
 static int cmd_meminfo(int argc, char **argv)
 {
     show_memory_info();
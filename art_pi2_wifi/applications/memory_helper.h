@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Memory allocation classes
+ */
+
+#ifndef __MEMORY_HELPER_H__
+#define __MEMORY_HELPER_H__
+
+/*
+ * 按用途选择内存：
+ *   FAST  片内AXI SRAM（系统堆 "heap"），频繁访问的小块数据，如唤醒词模型和推理状态
+ *   BULK  32MB PSRAM（memheap "psram"），录音、播放、HTTP响应体这类大块且允许慢一些的数据
+ * rt_malloc 总是先用SRAM，SRAM用完才轮到PSRAM，因此大缓冲区应明确申请BULK，把SRAM留给需要快的数据。
+ * 音频DMA缓冲区仍是驱动中的 rt_align(32) 静态数组，位于SRAM，不经过这里。
+ * FAST只从SRAM分配，SRAM不足时返回NULL并计入失败次数；BULK在PSRAM不足时落到系统堆并计入fallbacks。
+ * 用 mem_class_free 释放：PSRAM中的块由memheap释放，只有开启 RT_USING_MEMHEAP_AS_HEAP 时才能直接 rt_free；
+ * 同样用 mem_class_realloc 改变大小，块留在原来的堆中。
+ */
+
+#include <rtthread.h>
+
+typedef enum {
+    MEM_CLASS_FAST = 0,
+    MEM_CLASS_BULK,
+    MEM_CLASS_COUNT
+} mem_class_t;
+
+typedef struct {
+    const char *heap;       /* 所在堆的名字 */
+    rt_size_t total;        /* 堆大小，PC上为0 */
+    rt_size_t used;
+    rt_size_t max_used;
+    uint32_t allocs;        /* 经本接口分配的次数 */
+    uint32_t live;          /* 经本接口分配、尚未释放的块数 */
+    uint32_t fallbacks;     /* PSRAM不足、BULK落到系统堆的次数（FAST不会落到PSRAM）*/
+    uint32_t failures;      /* 分配失败的次数 */
+} mem_class_stats_t;
+
+void *mem_class_alloc(mem_class_t cls, rt_size_t size);
+
+/* 在指针原来所在的堆中改变大小，失败时原来的块不变；ptr为NULL时按BULK分配 */
+void *mem_class_realloc(void *ptr, rt_size_t size);
+
+/* 释放 mem_class_alloc/realloc 得到的指针 */
+void mem_class_free(void *ptr);
+
+/* 指针所在的内存类别 */
+mem_class_t mem_class_of(const void *ptr);
+
+void mem_class_get_stats(mem_class_t cls, mem_class_stats_t *stats);
+
+#endif /* __MEMORY_HELPER_H__ */
@@ -0,0 +1,991 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Content-addressed TTS audio cache on the SD card
+ * 2024-10-27     AI Assistant Batch index writes after cache hits
+ */
+
+#include <rtthread.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "tts_cache.h"
+#include "memory_helper.h"
+
+#define DBG_TAG "tts.cache"
+#define DBG_LVL DBG_INFO
+#include <rtdbg.h>
+
+#define TTS_CACHE_MAGIC         0x43535454      /* "TTSC" */
+#define TTS_CACHE_INDEX_MAGIC   0x58494354      /* "TCIX" */
+#define TTS_CACHE_VERSION       1
+#define TTS_CACHE_DIR_MAX       48
+#define TTS_CACHE_PATH_MAX      (TTS_CACHE_DIR_MAX + 32)
+#define TTS_CACHE_INDEX_NAME    "index.bin"
+#define TTS_CACHE_FNV_OFFSET    0xCBF29CE484222325ULL
+#define TTS_CACHE_FNV_PRIME     0x00000100000001B3ULL
+
+/* 音频文件头，之后是发音人标识、文本，补齐到4字节后是PCM */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t sample_rate;
+    uint32_t pcm_len;
+    uint16_t voice_len;
+    uint16_t text_len;
+} tts_cache_header_t;
+
+/* 索引文件头，之后是count个条目 */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t seq;
+    uint32_t checksum;          /* 条目数组的哈希，写入中断的索引被丢弃 */
+} tts_cache_index_t;
+
+typedef struct {
+    uint64_t hash;
+    uint32_t size;              /* 文件字节数 */
+    uint32_t last_used;         /* 最近使用序号，越大越新 */
+    uint32_t readers;           /* 正在读取的句柄数（只在内存中有效），不为0时不淘汰 */
+} tts_cache_entry_t;
+
+struct tts_cache_file {
+    int fd;
+    rt_bool_t writing;
+    rt_bool_t failed;           /* 写入出错或超长，关闭时放弃 */
+    uint64_t hash;
+    uint32_t pos;               /* 块缓冲区中下一个未读字节，或已填入的字节数 */
+    uint32_t fill;              /* 块缓冲区中的有效字节数 */
+    uint32_t size;              /* 已写入的文件字节数 */
+    uint32_t pcm_len;
+    uint32_t remain;            /* 还未读出的PCM字节数 */
+    uint16_t voice_len;
+    uint16_t text_len;
+    uint8_t block[TTS_CACHE_BLOCK];
+};
+
+static struct {
+    struct rt_mutex lock;
+    rt_bool_t ready;            /* 锁已初始化 */
+    rt_bool_t opened;           /* 目录已打开、索引已加载 */
+    rt_bool_t disabled;
+    rt_bool_t dirty;            /* 内存中的使用顺序比 index.bin 新 */
+    rt_tick_t retry_tick;
+    rt_tick_t save_tick;        /* 上次写索引的时间 */
+    char dir[TTS_CACHE_DIR_MAX];
+    uint32_t max_bytes;
+    uint32_t seq;
+    uint32_t count;
+    uint32_t total_bytes;
+    tts_cache_entry_t *entries;
+    tts_cache_stats_t stats;
+} tts_cache;
+
+/* 首次使用时初始化 */
+static void tts_cache_lock(void)
+{
+    if (!tts_cache.ready)
+    {
+        rt_enter_critical();
+        if (!tts_cache.ready)
+        {
+            rt_mutex_init(&tts_cache.lock, "tts_cache", RT_IPC_FLAG_PRIO);
+            tts_cache.ready = RT_TRUE;
+        }
+        rt_exit_critical();
+    }
+
+    rt_mutex_take(&tts_cache.lock, RT_WAITING_FOREVER);
+}
+
+static void tts_cache_unlock(void)
+{
+    rt_mutex_release(&tts_cache.lock);
+}
+
+uint64_t tts_cache_hash(const void *data, uint32_t len, uint64_t seed)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    uint64_t hash = seed ? seed : TTS_CACHE_FNV_OFFSET;
+
+    while (len--)
+    {
+        hash ^= *p++;
+        hash *= TTS_CACHE_FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/* 键 = 标识（含结尾的'\0'作为分隔）+ 文本 */
+static uint64_t tts_cache_key(const char *voice, const char *text)
+{
+    return tts_cache_hash(text, strlen(text), tts_cache_hash(voice, strlen(voice) + 1, 0));
+}
+
+/* 文件头、标识和文本之后PCM的偏移 */
+static uint32_t tts_cache_data_offset(uint32_t voice_len, uint32_t text_len)
+{
+    return (sizeof(tts_cache_header_t) + voice_len + text_len + 3) & ~3U;
+}
+
+static void tts_cache_path(char *path, uint64_t hash, const char *ext)
+{
+    rt_snprintf(path, TTS_CACHE_PATH_MAX, "%s/%08x%08x.%s", tts_cache.dir,
+                (uint32_t)(hash >> 32), (uint32_t)hash, ext);
+}
+
+/* 文件名（16位十六进制 + .pcm）转换为哈希，不是缓存文件返回-1 */
+static int tts_cache_parse_name(const char *name, uint64_t *hash)
+{
+    uint64_t value = 0;
+    int i;
+
+    if (strlen(name) != 20 || strcmp(name + 16, ".pcm") != 0)
+    {
+        return -1;
+    }
+
+    for (i = 0; i < 16; i++)
+    {
+        char c = name[i];
+
+        value <<= 4;
+        if (c >= '0' && c <= '9')
+        {
+            value |= c - '0';
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            value |= c - 'a' + 10;
+        }
+        else
+        {
+            return -1;
+        }
+    }
+
+    *hash = value;
+    return 0;
+}
+
+/* ==================== 索引（调用者持有锁）==================== */
+
+static tts_cache_entry_t *tts_cache_find(uint64_t hash)
+{
+    uint32_t i;
+
+    for (i = 0; i < tts_cache.count; i++)
+    {
+        if (tts_cache.entries[i].hash == hash)
+        {
+            return &tts_cache.entries[i];
+        }
+    }
+
+    return RT_NULL;
+}
+
+/* 从索引中去掉条目并删除文件 */
+static void tts_cache_remove(tts_cache_entry_t *entry)
+{
+    char path[TTS_CACHE_PATH_MAX];
+
+    tts_cache_path(path, entry->hash, "pcm");
+    unlink(path);
+
+    tts_cache.total_bytes -= entry->size;
+    *entry = tts_cache.entries[--tts_cache.count];
+}
+
+static void tts_cache_save_index(void)
+{
+    char path[TTS_CACHE_PATH_MAX];
+    tts_cache_index_t index;
+    uint32_t bytes = tts_cache.count * sizeof(tts_cache_entry_t);
+    int fd;
+
+    index.magic = TTS_CACHE_INDEX_MAGIC;
+    index.version = TTS_CACHE_VERSION;
+    index.count = tts_cache.count;
+    index.seq = tts_cache.seq;
+    index.checksum = (uint32_t)tts_cache_hash(tts_cache.entries, bytes, 0);
+
+    rt_snprintf(path, sizeof(path), "%s/%s", tts_cache.dir, TTS_CACHE_INDEX_NAME);
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0)
+    {
+        tts_cache.stats.errors++;
+        return;
+    }
+    if (write(fd, &index, sizeof(index)) != sizeof(index) ||
+        (bytes > 0 && write(fd, tts_cache.entries, bytes) != (int)bytes))
+    {
+        tts_cache.stats.errors++;
+    }
+    close(fd);
+
+    tts_cache.dirty = RT_FALSE;
+    tts_cache.save_tick = rt_tick_get();
+    tts_cache.stats.index_saves++;
+}
+
+/* 写入推迟的使用顺序；force为假时距上次写索引不足 TTS_CACHE_SYNC_MS 则继续推迟（调用者持有锁）*/
+static void tts_cache_sync_index(rt_bool_t force)
+{
+    if (!tts_cache.opened || !tts_cache.dirty)
+    {
+        return;
+    }
+    if (force || rt_tick_get() - tts_cache.save_tick >= rt_tick_from_millisecond(TTS_CACHE_SYNC_MS))
+    {
+        tts_cache_save_index();
+    }
+}
+
+/* 读取索引，得到各条目的大小和使用顺序；索引损坏时为空 */
+static void tts_cache_load_index(void)
+{
+    char path[TTS_CACHE_PATH_MAX];
+    tts_cache_index_t index;
+    uint32_t bytes;
+    int fd;
+
+    tts_cache.count = 0;
+    tts_cache.seq = 0;
+
+    rt_snprintf(path, sizeof(path), "%s/%s", tts_cache.dir, TTS_CACHE_INDEX_NAME);
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    if (read(fd, &index, sizeof(index)) == sizeof(index) && index.magic == TTS_CACHE_INDEX_MAGIC &&
+        index.version == TTS_CACHE_VERSION && index.count <= TTS_CACHE_MAX_ENTRIES)
+    {
+        bytes = index.count * sizeof(tts_cache_entry_t);
+        if (read(fd, tts_cache.entries, bytes) == (int)bytes &&
+            (uint32_t)tts_cache_hash(tts_cache.entries, bytes, 0) == index.checksum)
+        {
+            tts_cache.count = index.count;
+            tts_cache.seq = index.seq;
+            close(fd);
+            return;
+        }
+    }
+    close(fd);
+
+    LOG_W("TTS cache index is damaged, rebuilding from %s", tts_cache.dir);
+}
+
+/* 以目录为准核对索引：删除残留的临时文件，去掉文件已不存在的条目，
+ * 补上不在索引中的文件（最先淘汰）*/
+static void tts_cache_scan(void)
+{
+    char path[TTS_CACHE_PATH_MAX];
+    uint8_t present[TTS_CACHE_MAX_ENTRIES];
+    struct dirent *dirent;
+    struct stat st;
+    DIR *dir;
+    uint32_t i;
+
+    dir = opendir(tts_cache.dir);
+    rt_memset(present, dir == RT_NULL, sizeof(present));
+    while (dir != RT_NULL && (dirent = readdir(dir)) != RT_NULL)
+    {
+        tts_cache_entry_t *entry;
+        uint64_t hash;
+        uint32_t len = strlen(dirent->d_name);
+
+        /* 缓存文件名都是20个字符 */
+        if (len != 20)
+        {
+            continue;
+        }
+        rt_snprintf(path, sizeof(path), "%s/%.20s", tts_cache.dir, dirent->d_name);
+        if (strcmp(dirent->d_name + 16, ".tmp") == 0)
+        {
+            unlink(path);
+            continue;
+        }
+        if (tts_cache_parse_name(dirent->d_name, &hash) != 0)
+        {
+            continue;
+        }
+
+        entry = tts_cache_find(hash);
+        if (entry == RT_NULL)
+        {
+            if (tts_cache.count >= TTS_CACHE_MAX_ENTRIES || stat(path, &st) != 0)
+            {
+                unlink(path);
+                continue;
+            }
+            entry = &tts_cache.entries[tts_cache.count++];
+            entry->hash = hash;
+            entry->size = (uint32_t)st.st_size;
+            entry->last_used = 0;
+        }
+        present[entry - tts_cache.entries] = 1;
+    }
+    if (dir != RT_NULL)
+    {
+        closedir(dir);
+    }
+
+    tts_cache.total_bytes = 0;
+    for (i = 0; i < tts_cache.count; )
+    {
+        /* 去掉条目时最后一个条目移到此处，present跟着移动 */
+        if (!present[i])
+        {
+            present[i] = present[tts_cache.count - 1];
+            tts_cache.entries[i] = tts_cache.entries[--tts_cache.count];
+            continue;
+        }
+        tts_cache.entries[i].readers = 0;
+        tts_cache.total_bytes += tts_cache.entries[i].size;
+        i++;
+    }
+}
+
+/* 打开缓存目录并加载索引 */
+static int tts_cache_load(void)
+{
+    struct stat st;
+
+    if (stat(tts_cache.dir, &st) != 0 && mkdir(tts_cache.dir, 0777) != 0)
+    {
+        return -RT_EIO;
+    }
+
+    if (tts_cache.entries == RT_NULL)
+    {
+        tts_cache.entries = (tts_cache_entry_t *)mem_class_alloc(MEM_CLASS_BULK,
+                                                                 TTS_CACHE_MAX_ENTRIES * sizeof(tts_cache_entry_t));
+        if (tts_cache.entries == RT_NULL)
+        {
+            return -RT_ENOMEM;
+        }
+    }
+
+    tts_cache_load_index();
+    tts_cache_scan();
+    tts_cache.opened = RT_TRUE;
+    tts_cache.dirty = RT_FALSE;
+    tts_cache.save_tick = rt_tick_get();
+    tts_cache.stats.entries = tts_cache.count;
+    tts_cache.stats.total_bytes = tts_cache.total_bytes;
+
+    LOG_I("TTS cache %s: %d entries, %d KB", tts_cache.dir, tts_cache.count, tts_cache.total_bytes / 1024);
+    return RT_EOK;
+}
+
+/* 缓存是否可用：第一次使用或SD卡此前不可用时尝试打开默认目录 */
+static rt_bool_t tts_cache_usable(void)
+{
+    if (tts_cache.disabled)
+    {
+        return RT_FALSE;
+    }
+    if (tts_cache.opened)
+    {
+        return RT_TRUE;
+    }
+    if (tts_cache.retry_tick != 0 &&
+        rt_tick_get() - tts_cache.retry_tick < rt_tick_from_millisecond(TTS_CACHE_RETRY_MS))
+    {
+        return RT_FALSE;
+    }
+
+    if (tts_cache.dir[0] == '\0')
+    {
+        strncpy(tts_cache.dir, TTS_CACHE_DIR, sizeof(tts_cache.dir) - 1);
+    }
+    if (tts_cache.max_bytes == 0)
+    {
+        tts_cache.max_bytes = TTS_CACHE_MAX_BYTES;
+    }
+    if (tts_cache_load() != RT_EOK)
+    {
+        LOG_D("TTS cache %s not available", tts_cache.dir);
+        tts_cache.retry_tick = rt_tick_get() | 1;
+        return RT_FALSE;
+    }
+
+    return RT_TRUE;
+}
+
+/* ==================== 接口 ==================== */
+
+int tts_cache_init(const char *dir, uint32_t max_bytes)
+{
+    int ret;
+
+    if (dir == RT_NULL || strlen(dir) >= TTS_CACHE_DIR_MAX)
+    {
+        return -RT_EINVAL;
+    }
+
+    tts_cache_lock();
+    tts_cache_sync_index(RT_TRUE);
+    tts_cache.opened = RT_FALSE;
+    tts_cache.retry_tick = 0;
+    strncpy(tts_cache.dir, dir, sizeof(tts_cache.dir) - 1);
+    tts_cache.dir[sizeof(tts_cache.dir) - 1] = '\0';
+    tts_cache.max_bytes = max_bytes ? max_bytes : TTS_CACHE_MAX_BYTES;
+    ret = tts_cache_load();
+    tts_cache_unlock();
+
+    return ret;
+}
+
+void tts_cache_deinit(void)
+{
+    tts_cache_lock();
+    tts_cache_sync_index(RT_TRUE);
+    if (tts_cache.entries)
+    {
+        mem_class_free(tts_cache.entries);
+        tts_cache.entries = RT_NULL;
+    }
+    tts_cache.opened = RT_FALSE;
+    tts_cache.count = 0;
+    tts_cache.total_bytes = 0;
+    rt_memset(&tts_cache.stats, 0, sizeof(tts_cache.stats));
+    tts_cache_unlock();
+}
+
+rt_bool_t tts_cache_set_enabled(rt_bool_t enabled)
+{
+    rt_bool_t old = !tts_cache.disabled;
+
+    tts_cache.disabled = !enabled;
+    return old;
+}
+
+/* 读句柄：检查文件头，标识和文本与请求的一致才算命中 */
+static int tts_cache_check(tts_cache_file_t *file, const char *voice, const char *text)
+{
+    tts_cache_header_t *header = (tts_cache_header_t *)file->block;
+    uint32_t voice_len = strlen(voice);
+    uint32_t text_len = strlen(text);
+    uint32_t offset = tts_cache_data_offset(voice_len, text_len);
+    int n;
+
+    n = read(file->fd, file->block, TTS_CACHE_BLOCK);
+    if (n < (int)sizeof(tts_cache_header_t) || header->magic != TTS_CACHE_MAGIC ||
+        header->version != TTS_CACHE_VERSION || (uint32_t)n < offset)
+    {
+        return -RT_ERROR;
+    }
+    if (header->voice_len != voice_len || header->text_len != text_len ||
+        rt_memcmp(file->block + sizeof(tts_cache_header_t), voice, voice_len) != 0 ||
+        rt_memcmp(file->block + sizeof(tts_cache_header_t) + voice_len, text, text_len) != 0)
+    {
+        return -RT_EEMPTY;
+    }
+
+    file->pcm_len = header->pcm_len;
+    file->remain = header->pcm_len;
+    file->fill = (uint32_t)n;
+    file->pos = offset;
+    return RT_EOK;
+}
+
+tts_cache_file_t *tts_cache_open(const char *voice, const char *text, uint32_t *sample_rate, uint32_t *pcm_len)
+{
+    char path[TTS_CACHE_PATH_MAX];
+    tts_cache_file_t *file;
+    tts_cache_entry_t *entry;
+    uint64_t hash = tts_cache_key(voice, text);
+    int ret = -RT_ERROR;
+
+    tts_cache_lock();
+    if (!tts_cache_usable())
+    {
+        tts_cache_unlock();
+        return RT_NULL;
+    }
+    entry = tts_cache_find(hash);
+    if (entry == RT_NULL)
+    {
+        tts_cache.stats.misses++;
+        tts_cache_unlock();
+        return RT_NULL;
+    }
+    entry->readers++;
+    entry->last_used = ++tts_cache.seq;
+    tts_cache.dirty = RT_TRUE;
+    tts_cache_unlock();
+
+    /* 文件读取不持有锁 */
+    file = (tts_cache_file_t *)mem_class_alloc(MEM_CLASS_BULK, sizeof(tts_cache_file_t));
+    if (file != RT_NULL)
+    {
+        rt_memset(file, 0, offsetof(tts_cache_file_t, block));
+        file->hash = hash;
+        tts_cache_path(path, hash, "pcm");
+        file->fd = open(path, O_RDONLY);
+        ret = file->fd >= 0 ? tts_cache_check(file, voice, text) : -RT_EIO;
+        if (ret == RT_EOK)
+        {
+            *sample_rate = ((tts_cache_header_t *)file->block)->sample_rate;
+            *pcm_len = file->pcm_len;
+        }
+    }
+
+    tts_cache_lock();
+    if (ret == RT_EOK)
+    {
+        tts_cache.stats.hits++;
+        tts_cache_unlock();
+        return file;
+    }
+
+    /* 哈希冲突保留原条目；文件丢失或损坏时去掉条目 */
+    tts_cache.stats.misses++;
+    entry = tts_cache_find(hash);
+    if (entry != RT_NULL)
+    {
+        entry->readers--;
+        if (ret == -RT_EEMPTY)
+        {
+            tts_cache.stats.collisions++;
+        }
+        else if (file != RT_NULL && entry->readers == 0)
+        {
+            LOG_W("TTS cache entry %08x%08x is missing or damaged", (uint32_t)(hash >> 32), (uint32_t)hash);
+            tts_cache.stats.errors++;
+            tts_cache_remove(entry);
+            tts_cache_save_index();
+        }
+    }
+    tts_cache.stats.entries = tts_cache.count;
+    tts_cache.stats.total_bytes = tts_cache.total_bytes;
+    tts_cache_unlock();
+
+    if (file != RT_NULL)
+    {
+        if (file->fd >= 0)
+        {
+            close(file->fd);
+        }
+        mem_class_free(file);
+    }
+    return RT_NULL;
+}
+
+int tts_cache_read(tts_cache_file_t *file, const uint8_t **data)
+{
+    uint32_t n;
+
+    if (file->remain == 0)
+    {
+        return 0;
+    }
+
+    /* 块缓冲区读完后读入下一块，文件偏移始终是块大小的整数倍 */
+    if (file->pos >= file->fill)
+    {
+        int ret = read(file->fd, file->block, TTS_CACHE_BLOCK);
+
+        if (ret <= 0)
+        {
+            file->failed = RT_TRUE;
+            return -RT_EIO;
+        }
+        file->fill = (uint32_t)ret;
+        file->pos = 0;
+    }
+
+    n = file->fill - file->pos;
+    if (n > file->remain)
+    {
+        n = file->remain;
+    }
+    *data = file->block + file->pos;
+    file->pos += n;
+    file->remain -= n;
+
+    return (int)n;
+}
+
+tts_cache_file_t *tts_cache_create(const char *voice, const char *text)
+{
+    char path[TTS_CACHE_PATH_MAX];
+    tts_cache_header_t header;
+    tts_cache_file_t *file;
+    uint32_t voice_len = strlen(voice);
+    uint32_t text_len = strlen(text);
+
+    /* 文件头、标识和文本必须在第一块中 */
+    if (tts_cache_data_offset(voice_len, text_len) > TTS_CACHE_BLOCK)
+    {
+        return RT_NULL;
+    }
+
+    tts_cache_lock();
+    if (!tts_cache_usable())
+    {
+        tts_cache_unlock();
+        return RT_NULL;
+    }
+    tts_cache_unlock();
+
+    file = (tts_cache_file_t *)mem_class_alloc(MEM_CLASS_BULK, sizeof(tts_cache_file_t));
+    if (file == RT_NULL)
+    {
+        return RT_NULL;
+    }
+    rt_memset(file, 0, offsetof(tts_cache_file_t, block));
+    file->writing = RT_TRUE;
+    file->hash = tts_cache_key(voice, text);
+    file->voice_len = (uint16_t)voice_len;
+    file->text_len = (uint16_t)text_len;
+
+    /* 同一文本同时合成时只有一个写入者 */
+    tts_cache_path(path, file->hash, "tmp");
+    file->fd = open(path, O_WRONLY | O_CREAT | O_EXCL, 0666);
+    if (file->fd < 0)
+    {
+        mem_class_free(file);
+        return RT_NULL;
+    }
+
+    rt_memset(&header, 0, sizeof(header));
+    header.magic = TTS_CACHE_MAGIC;
+    header.version = TTS_CACHE_VERSION;
+    header.voice_len = (uint16_t)voice_len;
+    header.text_len = (uint16_t)text_len;
+    rt_memset(file->block, 0, tts_cache_data_offset(voice_len, text_len));
+    rt_memcpy(file->block, &header, sizeof(header));
+    rt_memcpy(file->block + sizeof(header), voice, voice_len);
+    rt_memcpy(file->block + sizeof(header) + voice_len, text, text_len);
+    file->pos = tts_cache_data_offset(voice_len, text_len);
+
+    return file;
+}
+
+int tts_cache_write(tts_cache_file_t *file, const uint8_t *pcm, uint32_t len)
+{
+    if (file->failed)
+    {
+        return -RT_ERROR;
+    }
+    if (file->size + file->pos + len > TTS_CACHE_ENTRY_MAX)
+    {
+        file->failed = RT_TRUE;
+        return -RT_EFULL;
+    }
+
+    file->pcm_len += len;
+    while (len > 0)
+    {
+        uint32_t n = TTS_CACHE_BLOCK - file->pos;
+
+        if (n > len)
+        {
+            n = len;
+        }
+        rt_memcpy(file->block + file->pos, pcm, n);
+        file->pos += n;
+        pcm += n;
+        len -= n;
+
+        /* 只写整块，SD卡上每次写入都是完整的扇区 */
+        if (file->pos == TTS_CACHE_BLOCK)
+        {
+            if (write(file->fd, file->block, TTS_CACHE_BLOCK) != TTS_CACHE_BLOCK)
+            {
+                file->failed = RT_TRUE;
+                return -RT_EIO;
+            }
+            file->size += TTS_CACHE_BLOCK;
+            file->pos = 0;
+        }
+    }
+
+    return RT_EOK;
+}
+
+/* 写句柄：补写最后一块，回到开头写入完整的文件头，关闭文件 */
+static int tts_cache_finish_write(tts_cache_file_t *file, uint32_t sample_rate)
+{
+    tts_cache_header_t header;
+    int ret = -RT_EIO;
+
+    if (file->pos > 0 && write(file->fd, file->block, file->pos) == (int)file->pos)
+    {
+        file->size += file->pos;
+        file->pos = 0;
+    }
+
+    if (file->pos == 0 && lseek(file->fd, 0, SEEK_SET) == 0)
+    {
+        rt_memset(&header, 0, sizeof(header));
+        header.magic = TTS_CACHE_MAGIC;
+        header.version = TTS_CACHE_VERSION;
+        header.sample_rate = sample_rate;
+        header.pcm_len = file->pcm_len;
+        header.voice_len = file->voice_len;
+        header.text_len = file->text_len;
+        if (write(file->fd, &header, sizeof(header)) == sizeof(header))
+        {
+            ret = RT_EOK;
+        }
+    }
+
+    close(file->fd);
+    file->fd = -1;
+    return ret;
+}
+
+/* 加入索引：淘汰最久未使用的条目直到放得下，临时文件改名为正式文件（调用者持有锁）*/
+static int tts_cache_insert(uint64_t hash, uint32_t size)
+{
+    char tmp[TTS_CACHE_PATH_MAX];
+    char path[TTS_CACHE_PATH_MAX];
+    tts_cache_entry_t *entry;
+
+    entry = tts_cache_find(hash);
+    if (entry != RT_NULL)
+    {
+        if (entry->readers > 0)
+        {
+            return -RT_EBUSY;
+        }
+        tts_cache_remove(entry);
+    }
+    if (size > tts_cache.max_bytes)
+    {
+        return -RT_EFULL;
+    }
+
+    while (tts_cache.count >= TTS_CACHE_MAX_ENTRIES || tts_cache.total_bytes + size > tts_cache.max_bytes)
+    {
+        tts_cache_entry_t *oldest = RT_NULL;
+        uint32_t i;
+
+        for (i = 0; i < tts_cache.count; i++)
+        {
+            entry = &tts_cache.entries[i];
+            if (entry->readers == 0 && (oldest == RT_NULL || entry->last_used < oldest->last_used))
+            {
+                oldest = entry;
+            }
+        }
+        if (oldest == RT_NULL)
+        {
+            return -RT_EFULL;
+        }
+        tts_cache_remove(oldest);
+        tts_cache.stats.evictions++;
+    }
+
+    tts_cache_path(tmp, hash, "tmp");
+    tts_cache_path(path, hash, "pcm");
+    unlink(path);
+    if (rename(tmp, path) != 0)
+    {
+        return -RT_EIO;
+    }
+
+    entry = &tts_cache.entries[tts_cache.count++];
+    entry->hash = hash;
+    entry->size = size;
+    entry->last_used = ++tts_cache.seq;
+    entry->readers = 0;
+    tts_cache.total_bytes += size;
+    tts_cache_save_index();
+
+    return RT_EOK;
+}
+
+int tts_cache_commit(tts_cache_file_t *file, uint32_t sample_rate)
+{
+    char tmp[TTS_CACHE_PATH_MAX];
+    int ret = -RT_ERROR;
+
+    if (!file->failed)
+    {
+        ret = tts_cache_finish_write(file, sample_rate);
+    }
+    else
+    {
+        close(file->fd);
+    }
+
+    tts_cache_lock();
+    if (ret == RT_EOK)
+    {
+        ret = tts_cache.opened ? tts_cache_insert(file->hash, file->size) : -RT_ERROR;
+    }
+    if (ret == RT_EOK)
+    {
+        tts_cache.stats.stores++;
+    }
+    else
+    {
+        tts_cache_path(tmp, file->hash, "tmp");
+        unlink(tmp);
+        tts_cache.stats.skipped++;
+        if (ret == -RT_EIO)
+        {
+            tts_cache.stats.errors++;
+        }
+    }
+    tts_cache.stats.entries = tts_cache.count;
+    tts_cache.stats.total_bytes = tts_cache.total_bytes;
+    tts_cache_unlock();
+
+    mem_class_free(file);
+    return ret;
+}
+
+void tts_cache_close(tts_cache_file_t *file)
+{
+    char tmp[TTS_CACHE_PATH_MAX];
+    tts_cache_entry_t *entry;
+
+    if (file == RT_NULL)
+    {
+        return;
+    }
+    if (file->fd >= 0)
+    {
+        close(file->fd);
+    }
+
+    tts_cache_lock();
+    if (file->writing)
+    {
+        /* 未提交：下载失败或被中止 */
+        tts_cache_path(tmp, file->hash, "tmp");
+        unlink(tmp);
+        tts_cache.stats.skipped++;
+    }
+    else
+    {
+        tts_cache.stats.bytes_served += file->pcm_len - file->remain;
+        if (file->failed)
+        {
+            tts_cache.stats.errors++;
+        }
+        entry = tts_cache_find(file->hash);
+        if (entry != RT_NULL)
+        {
+            entry->readers--;
+        }
+        /* 新的使用顺序不必马上写入，丢失只影响淘汰的先后；每次命中都重写索引会拖慢SD卡 */
+        tts_cache_sync_index(RT_FALSE);
+    }
+    tts_cache_unlock();
+
+    mem_class_free(file);
+}
+
+void tts_cache_flush(void)
+{
+    uint32_t i;
+
+    tts_cache_lock();
+    if (tts_cache.opened)
+    {
+        /* 倒序删除，去掉的位置由已检查过的末尾条目填充 */
+        for (i = tts_cache.count; i > 0; i--)
+        {
+            if (tts_cache.entries[i - 1].readers == 0)
+            {
+                tts_cache_remove(&tts_cache.entries[i - 1]);
+            }
+        }
+        tts_cache_save_index();
+        tts_cache.stats.entries = tts_cache.count;
+        tts_cache.stats.total_bytes = tts_cache.total_bytes;
+    }
+    tts_cache_unlock();
+}
+
+void tts_cache_sync(void)
+{
+    tts_cache_lock();
+    tts_cache_sync_index(RT_TRUE);
+    tts_cache_unlock();
+}
+
+void tts_cache_get_stats(tts_cache_stats_t *stats)
+{
+    tts_cache_lock();
+    rt_memcpy(stats, &tts_cache.stats, sizeof(tts_cache_stats_t));
+    tts_cache_unlock();
+}
+
+#ifdef FINSH_USING_MSH
+#include <finsh.h>
+
+static int cmd_tts_cache(int argc, char **argv)
+{
+    tts_cache_stats_t stats;
+    uint32_t lookups, i;
+
+    if (argc > 1 && strcmp(argv[1], "flush") == 0)
+    {
+        tts_cache_flush();
+        rt_kprintf("TTS cache flushed\n");
+        return 0;
+    }
+    if (argc > 1 && strcmp(argv[1], "sync") == 0)
+    {
+        tts_cache_sync();
+        rt_kprintf("TTS cache index saved\n");
+        return 0;
+    }
+    if (argc > 1 && (strcmp(argv[1], "on") == 0 || strcmp(argv[1], "off") == 0))
+    {
+        tts_cache_set_enabled(strcmp(argv[1], "on") == 0);
+        rt_kprintf("TTS cache %s\n", argv[1]);
+        return 0;
+    }
+
+    tts_cache_get_stats(&stats);
+    lookups = stats.hits + stats.misses;
+    rt_kprintf("TTS cache %s%s: %d entries, %d/%d KB\n", tts_cache.dir[0] ? tts_cache.dir : TTS_CACHE_DIR,
+               tts_cache.opened ? "" : " (not mounted)", stats.entries, stats.total_bytes / 1024,
+               (tts_cache.max_bytes ? tts_cache.max_bytes : TTS_CACHE_MAX_BYTES) / 1024);
+    rt_kprintf("Hits: %d, misses: %d, hit rate: %d%%%s\n", stats.hits, stats.misses,
+               lookups ? stats.hits * 100 / lookups : 0, tts_cache.disabled ? " (disabled)" : "");
+    rt_kprintf("Stores: %d, skipped: %d, evictions: %d, collisions: %d, errors: %d, served: %d KB\n",
+               stats.stores, stats.skipped, stats.evictions, stats.collisions, stats.errors,
+               stats.bytes_served / 1024);
+    rt_kprintf("Index writes: %d%s\n", stats.index_saves, tts_cache.dirty ? " (usage order pending)" : "");
+
+    if (argc > 1 && strcmp(argv[1], "list") == 0)
+    {
+        tts_cache_lock();
+        for (i = 0; i < tts_cache.count; i++)
+        {
+            tts_cache_entry_t *entry = &tts_cache.entries[i];
+
+            rt_kprintf("  %08x%08x  %6d bytes  used %d ago%s\n", (uint32_t)(entry->hash >> 32),
+                       (uint32_t)entry->hash, entry->size, tts_cache.seq - entry->last_used,
+                       entry->readers ? " (reading)" : "");
+        }
+        tts_cache_unlock();
+    }
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_tts_cache, tts_cache, Show TTS audio cache: tts_cache [list|flush|sync|on|off]);
+#endif
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Content-addressed TTS audio cache on the SD card
+ * 2024-10-27     AI Assistant Batch index writes after cache hits
+ */
+
+#ifndef __TTS_CACHE_H__
+#define __TTS_CACHE_H__
+
+/*
+ * TTS音频缓存：重复的句子（"好的"、错误提示、复述时单独合成的"您说的是："等）直接从SD卡播放，不经过网络
+ *   - 以（发音人标识，文本）的64位FNV-1a哈希为文件名，文件头中保存完整的标识和文本，命中时逐字比较
+ *   - 保存的是解码后的16bit PCM和采样率，与请求时的压缩格式无关
+ *   - 索引（哈希、文件大小、最近使用序号）常驻内存并写入 index.bin；总大小或条数超出上限时
+ *     淘汰最久未使用的条目。加入、淘汰条目时立即写索引；命中只改变使用顺序，
+ *     最多每 TTS_CACHE_SYNC_MS 写一次，tts_cache_sync、重新打开和 tts_cache_deinit 时补写
+ *   - 读取按 TTS_CACHE_BLOCK 对齐的块进行，tts_cache_read 直接返回块缓冲区中的指针，
+ *     播放器从中拷贝，不再经过中间缓冲
+ *   - 写入先写临时文件，完整下载后才改名并加入索引；下载失败或被中止的音频不会被缓存
+ * SD卡未挂载时缓存不可用，之后每 TTS_CACHE_RETRY_MS 重试一次。
+ */
+
+#include <rtthread.h>
+
+#define TTS_CACHE_DIR           "/sdcard/tts_cache"
+#define TTS_CACHE_MAX_BYTES     (16 * 1024 * 1024)
+#define TTS_CACHE_MAX_ENTRIES   256
+#define TTS_CACHE_ENTRY_MAX     (512 * 1024)    /* 单条音频上限（16kHz约16秒），更长的回复很少重复 */
+#define TTS_CACHE_BLOCK         4096            /* 读写块大小，FAT簇的整数分之一 */
+#define TTS_CACHE_RETRY_MS      10000           /* SD卡不可用时重试打开的间隔 */
+#define TTS_CACHE_SYNC_MS       60000           /* 命中后的使用顺序最多推迟多久写入索引 */
+
+typedef struct {
+    uint32_t hits;              /* 从缓存播放 */
+    uint32_t misses;            /* 未命中，经网络合成 */
+    uint32_t stores;            /* 新加入缓存 */
+    uint32_t skipped;           /* 未命中但没有缓存（超长、下载失败或写入出错）*/
+    uint32_t evictions;         /* 被淘汰的条目 */
+    uint32_t collisions;        /* 哈希相同但标识或文本不同 */
+    uint32_t errors;            /* 读写错误或文件丢失 */
+    uint32_t bytes_served;      /* 从缓存读出的PCM字节数 */
+    uint32_t index_saves;       /* index.bin 的写入次数 */
+    uint32_t entries;
+    uint32_t total_bytes;
+} tts_cache_stats_t;
+
+typedef struct tts_cache_file tts_cache_file_t;
+
+/* 在dir下打开缓存（不存在时创建），max_bytes为0时使用 TTS_CACHE_MAX_BYTES；
+ * 不调用时第一次查找打开 TTS_CACHE_DIR */
+int tts_cache_init(const char *dir, uint32_t max_bytes);
+void tts_cache_deinit(void);
+
+/* 关闭后查找总是未命中、也不写入（用于测量网络延迟），返回原来的状态 */
+rt_bool_t tts_cache_set_enabled(rt_bool_t enabled);
+
+/* FNV-1a 64位哈希，seed为0时使用标准初值，可以把多段数据串起来 */
+uint64_t tts_cache_hash(const void *data, uint32_t len, uint64_t seed);
+
+/* 查找：命中时返回读句柄，sample_rate、pcm_len 为音频的采样率和字节数；未命中返回RT_NULL */
+tts_cache_file_t *tts_cache_open(const char *voice, const char *text, uint32_t *sample_rate, uint32_t *pcm_len);
+
+/* 读取下一段PCM：*data指向句柄内部的块缓冲区，返回字节数，读完返回0，出错返回负值 */
+int tts_cache_read(tts_cache_file_t *file, const uint8_t **data);
+
+/* 写入：未命中时创建临时文件，之后依次追加合成的PCM */
+tts_cache_file_t *tts_cache_create(const char *voice, const char *text);
+int tts_cache_write(tts_cache_file_t *file, const uint8_t *pcm, uint32_t len);
+
+/* 写入完整后提交（加入索引，必要时淘汰旧条目）；返回前关闭句柄 */
+int tts_cache_commit(tts_cache_file_t *file, uint32_t sample_rate);
+
+/* 关闭读句柄；未提交的写句柄放弃临时文件 */
+void tts_cache_close(tts_cache_file_t *file);
+
+/* 删除所有条目 */
+void tts_cache_flush(void);
+
+/* 把还未写入的使用顺序写入索引，卸载SD卡之前调用 */
+void tts_cache_sync(void);
+void tts_cache_get_stats(tts_cache_stats_t *stats);
+
+#endif /* __TTS_CACHE_H__ */
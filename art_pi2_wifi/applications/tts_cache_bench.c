@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - TTS cache consistency and latency check
+ * 2024-10-27     AI Assistant Check that cache hits do not rewrite the index
+ */
+
+/*
+ * TTS缓存检查：在单独的目录中依次验证
+ *   store      写入（奇数长度分段）、提交后命中，采样率、长度、内容一致，读出的每段长度为偶数
+ *   abort      未提交和超过 TTS_CACHE_ENTRY_MAX 的音频不进入缓存，不留临时文件
+ *   lru        总大小超出上限时淘汰最久未使用的条目，最近命中过的保留
+ *   reopen     重新打开后条目和使用顺序不变；索引损坏时从目录重建
+ *   batch      命中不写索引，重新打开前补写，淘汰按补写的使用顺序进行
+ *   collision  文件名（哈希）相同但文本不同时不算命中
+ *   missing    文件被删除后未命中，条目被去掉
+ *   latency    命中时从查找到第一段PCM的耗时，以及整条读出的速度
+ * 结束后缓存指回 TTS_CACHE_DIR，统计清零。
+ *
+ * 设备端：tts_cache_bench [目录]（默认 /sdcard/tts_cache_bench）
+ * PC端（与设备端同一份tts_cache.c）：
+ *   gcc -O2 -DTTS_CACHE_BENCH_MAIN -I../host -I. tts_cache.c memory_helper.c tts_cache_bench.c -lpthread -o tts_cache_bench
+ *   ./tts_cache_bench /tmp/tts_cache_bench
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "tts_cache.h"
+
+#define CACHE_BENCH_VOICE       "0/bench/00000000"
+#define CACHE_BENCH_PHRASE      (8 * 1024)      /* 每条短语的PCM字节数 */
+#define CACHE_BENCH_LONG        (64 * 1024)     /* 测量读取速度的条目 */
+
+static int cache_bench_failed;
+
+static void cache_bench_check(const char *name, int ok)
+{
+    rt_kprintf("%-10s %s\n", name, ok ? "ok" : "FAIL");
+    cache_bench_failed += !ok;
+}
+
+/* 第i个字节由短语编号和位置决定，命中时逐字节核对 */
+static uint8_t cache_bench_byte(uint32_t phrase, uint32_t i)
+{
+    return (uint8_t)(phrase * 31 + i * 7 + (i >> 8));
+}
+
+/* 按奇数长度分段写入一条短语，commit为0时不提交 */
+static int cache_bench_store(const char *text, uint32_t phrase, uint32_t len, uint32_t rate, int commit)
+{
+    uint8_t chunk[333];
+    tts_cache_file_t *file;
+    uint32_t done = 0;
+
+    file = tts_cache_create(CACHE_BENCH_VOICE, text);
+    if (file == RT_NULL)
+    {
+        return -RT_ERROR;
+    }
+
+    while (done < len)
+    {
+        uint32_t n = len - done < sizeof(chunk) ? len - done : sizeof(chunk);
+
+        for (uint32_t i = 0; i < n; i++)
+        {
+            chunk[i] = cache_bench_byte(phrase, done + i);
+        }
+        tts_cache_write(file, chunk, n);
+        done += n;
+    }
+
+    if (!commit)
+    {
+        tts_cache_close(file);
+        return RT_EOK;
+    }
+    return tts_cache_commit(file, rate);
+}
+
+/* 查找并读出一条短语，返回不一致的字节数，未命中返回-1 */
+static int cache_bench_load(const char *text, uint32_t phrase, uint32_t *rate, uint32_t *len)
+{
+    tts_cache_file_t *file;
+    const uint8_t *data;
+    uint32_t done = 0;
+    int mismatches = 0;
+    int n;
+
+    file = tts_cache_open(CACHE_BENCH_VOICE, text, rate, len);
+    if (file == RT_NULL)
+    {
+        return -1;
+    }
+
+    while ((n = tts_cache_read(file, &data)) > 0)
+    {
+        if (n & 1)
+        {
+            mismatches++;
+        }
+        for (int i = 0; i < n; i++)
+        {
+            mismatches += data[i] != cache_bench_byte(phrase, done + i);
+        }
+        done += n;
+    }
+    tts_cache_close(file);
+
+    return (n < 0 || done != *len) ? mismatches + 1 : mismatches;
+}
+
+static int cache_bench_hit(const char *text, uint32_t phrase)
+{
+    uint32_t rate, len;
+
+    return cache_bench_load(text, phrase, &rate, &len) == 0;
+}
+
+static int cache_bench_file_exists(const char *path)
+{
+    struct stat st;
+
+    return stat(path, &st) == 0;
+}
+
+/* 复制文件，用于构造哈希冲突 */
+static int cache_bench_copy(const char *from, const char *to)
+{
+    uint8_t buf[512];
+    int in, out, n, ret = 0;
+
+    in = open(from, O_RDONLY);
+    out = open(to, O_WRONLY | O_CREAT | O_TRUNC, 0);
+    if (in < 0 || out < 0)
+    {
+        ret = -1;
+    }
+    while (ret == 0 && (n = read(in, buf, sizeof(buf))) > 0)
+    {
+        if (write(out, buf, n) != n)
+        {
+            ret = -1;
+        }
+    }
+    if (in >= 0)
+    {
+        close(in);
+    }
+    if (out >= 0)
+    {
+        close(out);
+    }
+    return ret;
+}
+
+static void cache_bench_path(char *path, uint32_t size, const char *dir, const char *text)
+{
+    uint64_t hash = tts_cache_hash(text, strlen(text), tts_cache_hash(CACHE_BENCH_VOICE, sizeof(CACHE_BENCH_VOICE), 0));
+
+    rt_snprintf(path, size, "%s/%08x%08x.pcm", dir, (uint32_t)(hash >> 32), (uint32_t)hash);
+}
+
+int tts_cache_bench(const char *dir)
+{
+    char path[96], other[96];
+    char text[32];
+    tts_cache_stats_t stats;
+    uint32_t rate = 0, len = 0;
+    uint32_t entry_size, saves;
+    rt_tick_t start, first, end;
+    int ok, fd;
+
+    cache_bench_failed = 0;
+
+    /* 从空目录开始 */
+    if (tts_cache_init(dir, 0) != RT_EOK)
+    {
+        rt_kprintf("Cannot open %s\n", dir);
+        return -1;
+    }
+    tts_cache_flush();
+
+    /* store */
+    ok = cache_bench_load("好的", 0, &rate, &len) == -1;
+    ok &= cache_bench_store("好的", 0, CACHE_BENCH_PHRASE, 24000, 1) == RT_EOK;
+    ok &= cache_bench_load("好的", 0, &rate, &len) == 0 && rate == 24000 && len == CACHE_BENCH_PHRASE;
+    cache_bench_check("store", ok);
+
+    /* abort */
+    ok = cache_bench_store("网络错误", 1, CACHE_BENCH_PHRASE, 16000, 0) == RT_EOK;
+    ok &= cache_bench_store("很长的回复", 2, TTS_CACHE_ENTRY_MAX, 16000, 1) != RT_EOK;
+    ok &= !cache_bench_hit("网络错误", 1) && !cache_bench_hit("很长的回复", 2);
+    cache_bench_path(path, sizeof(path), dir, "网络错误");
+    rt_snprintf(path + strlen(path) - 3, 4, "tmp");
+    ok &= !cache_bench_file_exists(path);
+    cache_bench_check("abort", ok);
+
+    /* lru：上限为4条，写入第5条时淘汰最久未使用的 */
+    cache_bench_path(path, sizeof(path), dir, "好的");
+    fd = open(path, O_RDONLY);
+    entry_size = fd >= 0 ? (uint32_t)lseek(fd, 0, SEEK_END) : 0;
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    tts_cache_init(dir, entry_size * 4 + entry_size / 2);
+    for (int i = 1; i < 4; i++)
+    {
+        rt_snprintf(text, sizeof(text), "短语%d", i);
+        cache_bench_store(text, 10 + i, CACHE_BENCH_PHRASE, 16000, 1);
+    }
+    ok = cache_bench_hit("好的", 0);                        /* 最旧的条目刚被使用过 */
+    cache_bench_store("短语4", 14, CACHE_BENCH_PHRASE, 16000, 1);
+    ok &= cache_bench_hit("好的", 0) && !cache_bench_hit("短语1", 11) &&
+          cache_bench_hit("短语2", 12) && cache_bench_hit("短语4", 14);
+    tts_cache_get_stats(&stats);
+    ok &= stats.entries == 4 && stats.evictions == 1;
+    cache_bench_check("lru", ok);
+
+    /* reopen：顺序为 短语3 < 好的 < 短语2 < 短语4，再写入一条淘汰短语3 */
+    tts_cache_init(dir, entry_size * 4 + entry_size / 2);
+    tts_cache_get_stats(&stats);
+    ok = stats.entries == 4;
+    cache_bench_store("短语5", 15, CACHE_BENCH_PHRASE, 16000, 1);
+    ok &= !cache_bench_hit("短语3", 13) && cache_bench_hit("好的", 0);
+
+    /* 索引损坏：条目从目录中重建 */
+    rt_snprintf(path, sizeof(path), "%s/index.bin", dir);
+    fd = open(path, O_WRONLY | O_TRUNC, 0);
+    if (fd >= 0)
+    {
+        write(fd, "damaged", 7);
+        close(fd);
+    }
+    tts_cache_init(dir, 0);
+    tts_cache_get_stats(&stats);
+    ok &= stats.entries == 4 && cache_bench_hit("短语5", 15) && cache_bench_hit("好的", 0);
+    cache_bench_check("reopen", ok);
+
+    /* batch：重建时短语2、短语4排在最前，之后是 短语5 < 好的；命中短语2、短语4后短语5最旧 */
+    tts_cache_get_stats(&stats);
+    saves = stats.index_saves;
+    ok = 1;
+    for (int i = 0; i < 4; i++)
+    {
+        ok &= cache_bench_hit("短语2", 12) && cache_bench_hit("短语4", 14);
+    }
+    tts_cache_get_stats(&stats);
+    ok &= stats.index_saves == saves;
+    tts_cache_init(dir, entry_size * 4 + entry_size / 2);
+    cache_bench_store("短语6", 16, CACHE_BENCH_PHRASE, 16000, 1);
+    ok &= !cache_bench_hit("短语5", 15) && cache_bench_hit("短语2", 12) && cache_bench_hit("短语4", 14);
+    cache_bench_check("batch", ok);
+
+    /* collision：把"好的"的文件复制为"冲突"的文件名 */
+    cache_bench_path(path, sizeof(path), dir, "好的");
+    cache_bench_path(other, sizeof(other), dir, "冲突");
+    ok = cache_bench_copy(path, other) == 0;
+    tts_cache_init(dir, 0);
+    ok &= !cache_bench_hit("冲突", 0) && cache_bench_hit("好的", 0);
+    tts_cache_get_stats(&stats);
+    ok &= stats.collisions == 1;
+    cache_bench_check("collision", ok);
+
+    /* missing */
+    unlink(path);
+    ok = !cache_bench_hit("好的", 0);
+    tts_cache_get_stats(&stats);
+    ok &= stats.entries == 4 && stats.errors == 1;
+    cache_bench_check("missing", ok);
+
+    /* latency */
+    ok = cache_bench_store("长回复", 20, CACHE_BENCH_LONG, 16000, 1) == RT_EOK;
+    {
+        tts_cache_file_t *file;
+        const uint8_t *data;
+        uint32_t total = 0;
+        int n;
+
+        start = rt_tick_get();
+        file = tts_cache_open(CACHE_BENCH_VOICE, "长回复", &rate, &len);
+        ok &= file != RT_NULL;
+        n = file ? tts_cache_read(file, &data) : -1;
+        first = rt_tick_get();
+        while (n > 0)
+        {
+            total += n;
+            n = tts_cache_read(file, &data);
+        }
+        end = rt_tick_get();
+        tts_cache_close(file);
+        ok &= total == CACHE_BENCH_LONG;
+        rt_kprintf("latency    first PCM %d ms, %d KB read in %d ms\n",
+                   (int)((first - start) * 1000 / RT_TICK_PER_SECOND), total / 1024,
+                   (int)((end - start) * 1000 / RT_TICK_PER_SECOND));
+    }
+    cache_bench_check("latency", ok);
+
+    tts_cache_get_stats(&stats);
+    rt_kprintf("Hits %d, misses %d, stores %d, skipped %d, evictions %d, collisions %d, errors %d\n",
+               stats.hits, stats.misses, stats.stores, stats.skipped, stats.evictions,
+               stats.collisions, stats.errors);
+    rt_kprintf("Result: %s\n", cache_bench_failed ? "FAIL" : "PASS");
+
+    /* 清理，之后的TTS使用默认目录 */
+    tts_cache_flush();
+    tts_cache_deinit();
+    tts_cache_init(TTS_CACHE_DIR, 0);
+
+    return cache_bench_failed ? -1 : 0;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+#include <finsh.h>
+
+static int cmd_tts_cache_bench(int argc, char **argv)
+{
+    return tts_cache_bench(argc > 1 ? argv[1] : "/sdcard/tts_cache_bench");
+}
+MSH_CMD_EXPORT_ALIAS(cmd_tts_cache_bench, tts_cache_bench, Check TTS cache: tts_cache_bench [dir]);
+#endif
+
+#ifdef TTS_CACHE_BENCH_MAIN
+HOST_CRITICAL_LOCK_DEFINE;
+
+int main(int argc, char **argv)
+{
+    mkdir(argc > 1 ? argv[1] : "/tmp/tts_cache_bench", 0777);
+    return tts_cache_bench(argc > 1 ? argv[1] : "/tmp/tts_cache_bench") == 0 ? 0 : 1;
+}
+#endif
@@ -6,6 +6,11 @@
  * Change Logs:
  * Date           Author       Notes
  * 2024-10-16     AI Assistant first version - Voice Assistant Implementation
+ * 2024-10-27     AI Assistant Record through the capture hub alongside wakeup detection
+ * 2024-10-27     AI Assistant Splice capture history from the wake word end into the recording
+ * 2024-10-27     AI Assistant Play TTS audio at the sample rate the service reports
+ * 2024-10-27     AI Assistant Handle local commands before going to the cloud
+ * 2024-10-27     AI Assistant Add latency trace points around each interaction stage
  */
 
 #include <rtthread.h>
@@ -13,9 +18,16 @@
 #include "voice_assistant.h"
 #include "voice_assistant_config.h"
 #include "audio_capture.h"
+#include "audio_hub.h"
 #include "audio_player.h"
 #include "ai_cloud_service.h"
 #include "wakeup_detector.h"
+#include "voice_vad.h"
+#include "voice_pipeline.h"
+#include "voice_cmd.h"
+#include "ai_arena.h"
+#include "ai_trace.h"
+#include "memory_helper.h"
 
 #define DBG_TAG "voice.assistant"
 #define DBG_LVL DBG_INFO
@@ -28,6 +40,8 @@ static struct {
     rt_sem_t trigger_sem;
     rt_bool_t running;
     rt_bool_t initialized;
+    rt_bool_t preroll;              /* 由唤醒词触发，从 preroll_pos 开始录音 */
+    uint32_t preroll_pos;
 } voice_assistant_ctrl = {
     .state = VOICE_ASSISTANT_IDLE,
     .main_thread = RT_NULL,
@@ -39,17 +53,41 @@ static struct {
 /* 前置声明 */
 static void wakeup_callback_handler(void);
 
+#if VOICE_FULL_DUPLEX_ENABLE && !VOICE_PIPELINE_ENABLE
+/* TTS音频输出：第一段音频到达时开始播放，之后边下载边写入播放器 */
+static int voice_assistant_tts_sink(const uint8_t *pcm, uint32_t len, void *user_data)
+{
+    ai_response_t *response = (ai_response_t *)user_data;
+    
+    if (voice_assistant_ctrl.state != VOICE_ASSISTANT_SPEAKING)
+    {
+        voice_assistant_ctrl.state = VOICE_ASSISTANT_SPEAKING;
+        LOG_I("Playing AI response...");
+    }
+    
+    /* 采样率在第一段音频到达前已从响应头解析，与当前相同时不做任何事 */
+    if (audio_player_stream_set_rate(response->sample_rate) != RT_EOK)
+    {
+        return -RT_ERROR;
+    }
+    
+    return audio_player_stream_write(pcm, len);
+}
+#endif
+
 /* 语音助手主线程 */
 static void voice_assistant_thread_entry(void *parameter)
 {
     uint8_t *audio_buffer = RT_NULL;
     ai_response_t ai_response;
+    audio_hub_sub_t mic;
     int ret;
     
     LOG_I("Voice assistant thread started");
     
     /* 分配音频缓冲区 */
-    audio_buffer = (uint8_t *)rt_malloc(VOICE_BUFFER_SIZE);
+    /* 录音缓冲区只由CPU顺序读写，放在PSRAM */
+    audio_buffer = (uint8_t *)mem_class_alloc(MEM_CLASS_BULK, VOICE_BUFFER_SIZE);
     if (audio_buffer == RT_NULL)
     {
         LOG_E("Failed to allocate audio buffer");
@@ -75,9 +113,33 @@ static void voice_assistant_thread_entry(void *parameter)
         
         LOG_I("Voice assistant triggered, start listening...");
         voice_assistant_ctrl.state = VOICE_ASSISTANT_LISTENING;
+        AI_TRACE_INSTANT("trigger", voice_assistant_ctrl.preroll);
         
-        /* 开始录音 */
-        ret = audio_capture_start();
+        /* 开始录音：订阅麦克风，唤醒词检测可能正在读取同一路采集 */
+#if VOICE_WAKEUP_PREROLL
+        if (voice_assistant_ctrl.preroll)
+        {
+            uint32_t pos = voice_assistant_ctrl.preroll_pos;
+            uint32_t max_back = VOICE_SAMPLE_RATE * VOICE_PREROLL_MAX_MS / 1000;
+            
+            /* 唤醒词之后说的话已经在采集历史中，从唤醒词结束处接上 */
+            if (audio_hub_position() - pos > max_back)
+            {
+                pos = audio_hub_position() - max_back;
+            }
+            ret = audio_hub_subscribe_from(&mic, "record", pos);
+            if (ret == RT_EOK)
+            {
+                LOG_I("Pre-roll: %d ms before recording started",
+                      (audio_hub_position() - mic.cursor) * 1000 / VOICE_SAMPLE_RATE);
+            }
+        }
+        else
+#endif
+        {
+            ret = audio_hub_subscribe(&mic, "record");
+        }
+        voice_assistant_ctrl.preroll = RT_FALSE;
         if (ret != RT_EOK)
         {
             LOG_E("Failed to start audio capture");
@@ -86,19 +148,37 @@ static void voice_assistant_thread_entry(void *parameter)
         }
         
         /* 读取音频数据 */
+        AI_TRACE_BEGIN("record");
         rt_memset(audio_buffer, 0, VOICE_BUFFER_SIZE);
         uint32_t total_read = 0;
         uint32_t timeout_count = 0;
         
+#if VOICE_VAD_ENABLE
+        /* VAD检测到静音持续VOICE_SILENCE_DURATION后提前结束录音 */
+        voice_vad_t vad;
+        voice_vad_init(&vad, VOICE_SAMPLE_RATE, VOICE_SILENCE_THRESHOLD, VOICE_SILENCE_DURATION);
+        
+        LOG_I("Recording up to %d seconds (VAD enabled)...", VOICE_RECORD_DURATION);
+#else
         LOG_I("Recording for %d seconds...", VOICE_RECORD_DURATION);
+#endif
         
         while (total_read < VOICE_BUFFER_SIZE && timeout_count < 100)
         {
-            int read_size = audio_capture_read(audio_buffer + total_read,
-                                                VOICE_BUFFER_SIZE - total_read,
-                                                1000);
+            int read_size = audio_hub_read(&mic, audio_buffer + total_read,
+                                           VOICE_BUFFER_SIZE - total_read,
+                                           1000);
             if (read_size > 0)
             {
+#if VOICE_VAD_ENABLE
+                if (voice_vad_process(&vad, (int16_t *)(audio_buffer + total_read),
+                                      read_size / 2) == VAD_END)
+                {
+                    total_read += read_size;
+                    LOG_I("End of speech detected");
+                    break;
+                }
+#endif
                 total_read += read_size;
                 LOG_D("Read %d bytes, total: %d", read_size, total_read);
             }
@@ -116,10 +196,36 @@ static void voice_assistant_thread_entry(void *parameter)
         }
         
         /* 停止录音 */
-        audio_capture_stop();
+        audio_hub_unsubscribe(&mic);
+        AI_TRACE_END("record", total_read);
         
         LOG_I("Recording completed, captured %d bytes", total_read);
         
+#if VOICE_VAD_ENABLE
+        if (!voice_vad_has_speech(&vad))
+        {
+            LOG_W("No speech detected, skipping...");
+            continue;
+        }
+        
+        /* 裁剪前导和尾部静音，减少上传数据量 */
+        {
+            uint32_t start = voice_vad_speech_start(&vad) * 2;
+            uint32_t end = voice_vad_speech_end(&vad) * 2;
+            
+            if (end > total_read)
+            {
+                end = total_read;
+            }
+            if (start > 0)
+            {
+                rt_memmove(audio_buffer, audio_buffer + start, end - start);
+            }
+            LOG_I("VAD trimmed %d -> %d bytes", total_read, end - start);
+            total_read = end - start;
+        }
+#endif
+        
 #if VOICE_SAVE_AUDIO_FILE
         /* 保存音频文件到SD卡（调试用）*/
         int fd = open(VOICE_AUDIO_FILE_PATH, O_WRONLY | O_CREAT | O_TRUNC);
@@ -139,13 +245,71 @@ static void voice_assistant_thread_entry(void *parameter)
         
         /* 处理语音数据 */
         voice_assistant_ctrl.state = VOICE_ASSISTANT_PROCESSING;
+        
+#if VOICE_LOCAL_CMD_ENABLE
+        /* 本地命令不联网直接执行，其他的话交给云端 */
+        AI_TRACE_BEGIN("local cmd");
+        ret = voice_cmd_process((const int16_t *)audio_buffer, total_read / 2);
+        AI_TRACE_END("local cmd", ret == RT_EOK);
+        if (ret == RT_EOK)
+        {
+            LOG_I("Voice assistant interaction completed (local command)");
+            continue;
+        }
+#endif
+        
         LOG_I("Processing audio data...");
         
         rt_memset(&ai_response, 0, sizeof(ai_response_t));
         
-#if VOICE_FULL_DUPLEX_ENABLE
-        /* 使用全双工模式（语音识别+AI回复+语音合成）*/
-        ret = ai_cloud_service_full_duplex(audio_buffer, total_read, &ai_response);
+        /* 本轮的HTTP、JSON、文本和音频临时内存都从内存池分配，结束时整体复位 */
+        ai_arena_begin();
+        
+#if VOICE_FULL_DUPLEX_ENABLE && VOICE_PIPELINE_ENABLE
+        /* 流水线模式：识别结果和回复由流水线打印，本线程只等待本轮播完 */
+        AI_TRACE_BEGIN("interaction");
+        ret = voice_pipeline_submit(audio_buffer, total_read);
+        if (ret == RT_EOK)
+        {
+            ret = voice_pipeline_wait(rt_tick_from_millisecond(VOICE_PIPELINE_TIMEOUT * 1000));
+            if (ret == -RT_ETIMEOUT)
+            {
+                LOG_W("Voice pipeline timeout");
+                voice_pipeline_cancel();
+            }
+        }
+        AI_TRACE_END("interaction", ret == RT_EOK);
+        ai_arena_end();
+        if (ret != RT_EOK)
+        {
+            LOG_E("Voice pipeline failed: %d", ret);
+            voice_assistant_ctrl.state = VOICE_ASSISTANT_ERROR;
+            rt_thread_mdelay(1000);
+            continue;
+        }
+        
+        LOG_I("Voice assistant interaction completed");
+        continue;
+#elif VOICE_FULL_DUPLEX_ENABLE
+        /* 使用全双工模式（语音识别+AI回复+语音合成），回复音频边下载边播放 */
+        AI_TRACE_BEGIN("interaction");
+        if (audio_player_stream_begin() == RT_EOK)
+        {
+            ret = ai_cloud_service_full_duplex_stream(audio_buffer, total_read,
+                                                      voice_assistant_tts_sink, &ai_response,
+                                                      &ai_response);
+            audio_player_stream_end();
+            if (ai_response.audio_len > 0)
+            {
+                LOG_I("AI response played (%d bytes, first audio after %d ms)",
+                      ai_response.audio_len, ai_response.first_audio_ms);
+            }
+        }
+        else
+        {
+            ret = ai_cloud_service_full_duplex(audio_buffer, total_read, &ai_response);
+        }
+        AI_TRACE_END("interaction", ret == RT_EOK);
 #elif VOICE_STT_ENABLE
         /* 只使用语音识别 */
         ret = ai_cloud_service_speech_to_text(audio_buffer, total_read, &ai_response);
@@ -160,6 +324,7 @@ static void voice_assistant_thread_entry(void *parameter)
                   ai_response.error_msg ? ai_response.error_msg : "Unknown error");
             voice_assistant_ctrl.state = VOICE_ASSISTANT_ERROR;
             ai_cloud_service_free_response(&ai_response);
+            ai_arena_end();
             
             rt_thread_mdelay(1000);
             continue;
@@ -178,8 +343,8 @@ static void voice_assistant_thread_entry(void *parameter)
             voice_assistant_ctrl.state = VOICE_ASSISTANT_SPEAKING;
             LOG_I("Playing AI response (%d bytes)...", ai_response.audio_len);
             
-            ret = audio_player_play((uint8_t *)ai_response.audio_result, 
-                                    ai_response.audio_len);
+            ret = audio_player_play_rate((uint8_t *)ai_response.audio_result, 
+                                         ai_response.audio_len, ai_response.sample_rate);
             if (ret != RT_EOK)
             {
                 LOG_E("Failed to play audio");
@@ -195,11 +360,12 @@ static void voice_assistant_thread_entry(void *parameter)
         }
         
         ai_cloud_service_free_response(&ai_response);
+        ai_arena_end();
         
         LOG_I("Voice assistant interaction completed");
     }
     
-    rt_free(audio_buffer);
+    mem_class_free(audio_buffer);
     voice_assistant_ctrl.state = VOICE_ASSISTANT_IDLE;
     
     LOG_I("Voice assistant thread stopped");
@@ -219,6 +385,11 @@ int voice_assistant_init(void)
     
     LOG_I("Initializing voice assistant...");
     
+#if AI_TRACE_ENABLE
+    /* 延迟追踪，分配失败只是不记录 */
+    ai_trace_init();
+#endif
+    
     /* 初始化音频采集 */
     ret = audio_capture_init();
     if (ret != RT_EOK)
@@ -244,16 +415,19 @@ int voice_assistant_init(void)
     strncpy(ai_config.api_secret, BAIDU_SECRET_KEY, sizeof(ai_config.api_secret) - 1);
     strncpy(ai_config.app_id, BAIDU_APP_ID, sizeof(ai_config.app_id) - 1);
     strncpy(ai_config.api_url, BAIDU_STT_URL, sizeof(ai_config.api_url) - 1);
+    strncpy(ai_config.tts_url, BAIDU_TTS_URL, sizeof(ai_config.tts_url) - 1);
 #elif AI_SERVICE_PROVIDER == 1  /* 讯飞 */
     strncpy(ai_config.api_key, XFYUN_API_KEY, sizeof(ai_config.api_key) - 1);
     strncpy(ai_config.api_secret, XFYUN_API_SECRET, sizeof(ai_config.api_secret) - 1);
     strncpy(ai_config.app_id, XFYUN_APP_ID, sizeof(ai_config.app_id) - 1);
     strncpy(ai_config.api_url, XFYUN_STT_URL, sizeof(ai_config.api_url) - 1);
+    strncpy(ai_config.tts_url, XFYUN_TTS_URL, sizeof(ai_config.tts_url) - 1);
 #elif AI_SERVICE_PROVIDER == 2  /* 阿里云 */
     strncpy(ai_config.api_key, ALIYUN_API_KEY, sizeof(ai_config.api_key) - 1);
     strncpy(ai_config.api_secret, ALIYUN_API_SECRET, sizeof(ai_config.api_secret) - 1);
     strncpy(ai_config.app_id, ALIYUN_APP_ID, sizeof(ai_config.app_id) - 1);
     strncpy(ai_config.api_url, ALIYUN_STT_URL, sizeof(ai_config.api_url) - 1);
+    strncpy(ai_config.tts_url, ALIYUN_TTS_URL, sizeof(ai_config.tts_url) - 1);
 #else  /* 自定义 */
     strncpy(ai_config.api_key, CUSTOM_API_KEY, sizeof(ai_config.api_key) - 1);
     strncpy(ai_config.api_secret, CUSTOM_API_SECRET, sizeof(ai_config.api_secret) - 1);
@@ -269,6 +443,19 @@ int voice_assistant_init(void)
         return ret;
     }
     
+#if VOICE_LOCAL_CMD_ENABLE
+    voice_cmd_init();
+#endif
+    
+#if VOICE_FULL_DUPLEX_ENABLE && VOICE_PIPELINE_ENABLE
+    ret = voice_pipeline_init();
+    if (ret != RT_EOK)
+    {
+        LOG_E("Failed to initialize voice pipeline");
+        return ret;
+    }
+#endif
+    
     /* 创建触发信号量 */
     voice_assistant_ctrl.trigger_sem = rt_sem_create("va_trigger", 0, RT_IPC_FLAG_FIFO);
     if (voice_assistant_ctrl.trigger_sem == RT_NULL)
@@ -356,6 +543,11 @@ int voice_assistant_stop(void)
     
     voice_assistant_ctrl.running = RT_FALSE;
     
+#if VOICE_FULL_DUPLEX_ENABLE && VOICE_PIPELINE_ENABLE
+    /* 中止正在进行的一轮，主线程不再等待播放结束 */
+    voice_pipeline_cancel();
+#endif
+    
     /* 释放信号量以退出线程 */
     rt_sem_release(voice_assistant_ctrl.trigger_sem);
     
@@ -373,8 +565,8 @@ voice_assistant_state_t voice_assistant_get_state(void)
     return voice_assistant_ctrl.state;
 }
 
-/* 手动触发语音识别 */
-int voice_assistant_trigger(void)
+/* 触发语音识别，preroll为真时从采集样本序号pos开始录音 */
+static int voice_assistant_trigger_at(rt_bool_t preroll, uint32_t pos)
 {
     if (!voice_assistant_ctrl.initialized || !voice_assistant_ctrl.running)
     {
@@ -389,16 +581,24 @@ int voice_assistant_trigger(void)
     }
     
     LOG_I("Voice assistant triggered");
+    voice_assistant_ctrl.preroll_pos = pos;
+    voice_assistant_ctrl.preroll = preroll;
     rt_sem_release(voice_assistant_ctrl.trigger_sem);
     
     return RT_EOK;
 }
 
+/* 手动触发语音识别 */
+int voice_assistant_trigger(void)
+{
+    return voice_assistant_trigger_at(RT_FALSE, 0);
+}
+
 /* 唤醒词检测回调实现 */
 static void wakeup_callback_handler(void)
 {
     LOG_I("Wakeup callback triggered");
-    voice_assistant_trigger();
+    voice_assistant_trigger_at(RT_TRUE, wakeup_detector_wake_position());
 }
 
 /* 导出MSH命令 */
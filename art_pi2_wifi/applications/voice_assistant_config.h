@@ -6,6 +6,7 @@
  * Change Logs:
  * Date           Author       Notes
  * 2024-10-16     AI Assistant first version - Voice Assistant Configuration
+ * 2024-10-27     AI Assistant Add local command recognizer settings
  */
 
 #ifndef __VOICE_ASSISTANT_CONFIG_H__
@@ -59,7 +60,7 @@
 /* 音频位深度 (bits) */
 #define VOICE_BITS_PER_SAMPLE   16
 
-/* 录音持续时间 (秒) - 减少以节省内存 */
+/* 录音持续时间 (秒) - 减少以节省内存；启用VAD时为最长录音时间 */
 #define VOICE_RECORD_DURATION   3
 
 /* 音频缓冲区大小 (字节) */
@@ -73,10 +74,19 @@
 /* 唤醒词 */
 #define VOICE_WAKEUP_WORD       "Hi小石"
 
+/* 本地唤醒词模型 (kws_pack_model.py生成)，不存在时回退到云端识别 */
+#define VOICE_KWS_MODEL_PATH    "/sdcard/kws_model.bin"
+
+/* 唤醒后从唤醒词结束处开始录音，唤醒到录音开始之间说的话从采集历史中补上，不必停顿 */
+#define VOICE_WAKEUP_PREROLL    1
+
+/* 最多补上的历史 (毫秒)，不超过采集环形缓冲区长度 (audio_hub.h) */
+#define VOICE_PREROLL_MAX_MS    1500
+
 /* VAD (Voice Activity Detection) 使能 */
-#define VOICE_VAD_ENABLE        0
+#define VOICE_VAD_ENABLE        1
 
-/* 静音检测阈值 (用于自动停止录音) */
+/* 静音检测阈值 (用于自动停止录音，16bit PCM帧平均绝对幅度) */
 #define VOICE_SILENCE_THRESHOLD 100
 
 /* 静音持续时间 (毫秒，超过此时间认为说话结束) */
@@ -120,8 +130,27 @@
 /* 启用全双工交互 */
 #define VOICE_FULL_DUPLEX_ENABLE    1
 
-/* 启用本地命令识别（不需要联网）*/
-#define VOICE_LOCAL_CMD_ENABLE  0
+/* 全双工使用流水线：识别、对话、逐句合成和播放在各自线程中并行 (voice_pipeline.c) */
+#define VOICE_PIPELINE_ENABLE       1
+
+/* 流水线单轮超时 (秒)，包括回复播放时间 */
+#define VOICE_PIPELINE_TIMEOUT      60
+
+/* 启用本地命令识别（不需要联网）：唤醒后的一句话先由本地命令模型识别，
+ * 是音量、停止、时间、开关灯等命令时在本地执行并播放预录的回复，其余的话交给云端 (voice_cmd.c) */
+#define VOICE_LOCAL_CMD_ENABLE  1
+
+/* 本地命令模型 (kws_pack_model.py生成，类别为命令词)，不存在时所有的话都交给云端 */
+#define VOICE_CMD_MODEL_PATH    "/sdcard/cmd_model.bin"
+
+/* 预录回复音频目录 (<命令>.wav)，由 voice_cmd render 联网生成一次，也可以换成自己的录音 */
+#define VOICE_CMD_AUDIO_DIR     "/sdcard/voice_cmd"
+
+/* 超过此长度 (毫秒) 的话不是命令，不做本地识别 */
+#define VOICE_CMD_MAX_MS        1500
+
+/* 命令词后验概率门限 (q7，0~127)，低于门限时交给云端 */
+#define VOICE_CMD_THRESHOLD     100
 
 #endif /* __VOICE_ASSISTANT_CONFIG_H__ */
 
@@ -0,0 +1,719 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Offline local command recognizer
+ */
+
+#include <rtthread.h>
+#include <rtdevice.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "drv_common.h"
+#include "voice_assistant_config.h"
+#include "voice_cmd.h"
+#include "kws.h"
+#include "audio_player.h"
+#include "ai_cloud_service.h"
+#include "memory_helper.h"
+
+#define DBG_TAG "voice.cmd"
+#define DBG_LVL DBG_INFO
+#include <rtdbg.h>
+
+#if VOICE_LOCAL_CMD_ENABLE
+
+/* 开关灯命令控制的LED（板上红色LED，低电平点亮），蓝色LED由main线程闪烁 */
+#ifndef VOICE_CMD_LED_PIN
+#define VOICE_CMD_LED_PIN       GET_PIN(O, 1)
+#endif
+#ifndef VOICE_CMD_LED_ON
+#define VOICE_CMD_LED_ON        PIN_LOW
+#endif
+#define VOICE_CMD_LED_OFF       (!VOICE_CMD_LED_ON)
+
+#define VOICE_CMD_READ_SIZE     2048    /* 读片段文件的块大小 */
+#define VOICE_CMD_PATH_MAX      64
+#define VOICE_CMD_WAV_HEADER    44
+
+typedef struct {
+    char name[VOICE_CMD_NAME_LEN + 1];
+    const char *reply;
+    voice_cmd_handler_t handler;
+    uint32_t count;                 /* 执行次数 */
+} voice_cmd_entry_t;
+
+/* 本地命令控制结构 */
+static struct {
+    rt_bool_t initialized;
+    voice_cmd_entry_t cmds[VOICE_CMD_MAX];
+    uint32_t count;
+#if KWS_ENABLE
+    kws_engine_t *kws;              /* 命令模型，第一次识别时加载 */
+    uint8_t *model;
+    rt_bool_t model_missing;        /* 已提示过模型不存在 */
+    uint8_t scores[KWS_MAX_CLASSES];
+#endif
+    /* 统计 */
+    uint32_t utterances;
+    uint32_t handled;
+    uint32_t too_long;
+    uint32_t unsure;
+    uint32_t last_ms;
+} voice_cmd_ctrl;
+
+/* ==================== 内置命令 ==================== */
+
+static int voice_cmd_stop(const char *name, voice_cmd_reply_t *reply)
+{
+    audio_player_stop();
+    return RT_EOK;
+}
+
+static int voice_cmd_volume(const char *name, voice_cmd_reply_t *reply)
+{
+    int32_t volume = (int32_t)audio_player_get_volume();
+
+    volume += strcmp(name, "vol_up") == 0 ? VOICE_CMD_VOLUME_STEP : -VOICE_CMD_VOLUME_STEP;
+    volume = volume > 100 ? 100 : (volume < VOICE_CMD_VOLUME_STEP ? VOICE_CMD_VOLUME_STEP : volume);
+
+    return audio_player_set_volume((uint32_t)volume);
+}
+
+/* 报时：现在时间是 + 时 + 点 + 分 + 分，数字各有一个片段 */
+static int voice_cmd_time(const char *name, voice_cmd_reply_t *reply)
+{
+    time_t now = time(RT_NULL);
+    struct tm tm;
+
+    /* 没有联网校时的时候RTC从2000年开始 */
+    if (now < 1704067200 || localtime_r(&now, &tm) == RT_NULL)
+    {
+        rt_snprintf(reply->text, sizeof(reply->text), "还不知道现在的时间");
+        rt_snprintf(reply->clips[0], VOICE_CMD_CLIP_LEN, "no_time");
+        reply->clip_count = 1;
+        return RT_EOK;
+    }
+
+    rt_snprintf(reply->clips[1], VOICE_CMD_CLIP_LEN, "num_%d", tm.tm_hour);
+    rt_snprintf(reply->clips[2], VOICE_CMD_CLIP_LEN, "hour");
+    reply->clip_count = 3;
+    if (tm.tm_min > 0)
+    {
+        rt_snprintf(reply->clips[3], VOICE_CMD_CLIP_LEN, "num_%d", tm.tm_min);
+        rt_snprintf(reply->clips[4], VOICE_CMD_CLIP_LEN, "minute");
+        reply->clip_count = 5;
+        rt_snprintf(reply->text, sizeof(reply->text), "现在时间是%d点%d分", tm.tm_hour, tm.tm_min);
+    }
+    else
+    {
+        rt_snprintf(reply->text, sizeof(reply->text), "现在时间是%d点", tm.tm_hour);
+    }
+
+    return RT_EOK;
+}
+
+static int voice_cmd_led(const char *name, voice_cmd_reply_t *reply)
+{
+    rt_pin_write(VOICE_CMD_LED_PIN, strcmp(name, "led_on") == 0 ? VOICE_CMD_LED_ON : VOICE_CMD_LED_OFF);
+    return RT_EOK;
+}
+
+/* 报时用的其他片段 */
+static const struct {
+    const char *name;
+    const char *text;
+} voice_cmd_extra_clips[] = {
+    {"hour", "点"},
+    {"minute", "分"},
+    {"no_time", "还不知道现在的时间"},
+};
+
+int voice_cmd_init(void)
+{
+    if (voice_cmd_ctrl.initialized)
+    {
+        return RT_EOK;
+    }
+    voice_cmd_ctrl.initialized = RT_TRUE;
+
+    rt_pin_mode(VOICE_CMD_LED_PIN, PIN_MODE_OUTPUT);
+    rt_pin_write(VOICE_CMD_LED_PIN, VOICE_CMD_LED_OFF);
+
+    voice_cmd_register("stop", "好的", voice_cmd_stop);
+    voice_cmd_register("vol_up", "音量已调大", voice_cmd_volume);
+    voice_cmd_register("vol_down", "音量已调小", voice_cmd_volume);
+    voice_cmd_register("time", "现在时间是", voice_cmd_time);
+    voice_cmd_register("led_on", "灯已打开", voice_cmd_led);
+    voice_cmd_register("led_off", "灯已关闭", voice_cmd_led);
+
+    return RT_EOK;
+}
+
+static voice_cmd_entry_t *voice_cmd_find(const char *name)
+{
+    uint32_t i;
+
+    for (i = 0; i < voice_cmd_ctrl.count; i++)
+    {
+        if (strcmp(voice_cmd_ctrl.cmds[i].name, name) == 0)
+        {
+            return &voice_cmd_ctrl.cmds[i];
+        }
+    }
+
+    return RT_NULL;
+}
+
+int voice_cmd_register(const char *name, const char *reply, voice_cmd_handler_t handler)
+{
+    voice_cmd_entry_t *cmd;
+
+    voice_cmd_init();
+
+    if (name == RT_NULL || strlen(name) > VOICE_CMD_NAME_LEN)
+    {
+        return -RT_EINVAL;
+    }
+
+    cmd = voice_cmd_find(name);
+    if (cmd == RT_NULL)
+    {
+        if (voice_cmd_ctrl.count >= VOICE_CMD_MAX)
+        {
+            LOG_E("Too many local commands");
+            return -RT_EFULL;
+        }
+        cmd = &voice_cmd_ctrl.cmds[voice_cmd_ctrl.count++];
+        strcpy(cmd->name, name);
+    }
+    cmd->reply = reply ? reply : "";
+    cmd->handler = handler;
+
+    return RT_EOK;
+}
+
+/* ==================== 回复 ==================== */
+
+static uint32_t voice_cmd_get32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void voice_cmd_put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static void voice_cmd_clip_path(char *path, const char *clip)
+{
+    rt_snprintf(path, VOICE_CMD_PATH_MAX, "%s/%s.wav", VOICE_CMD_AUDIO_DIR, clip);
+}
+
+/* 打开片段并定位到PCM数据：只接受16bit单声道PCM的WAV，返回文件描述符，失败返回-1 */
+static int voice_cmd_wav_open(const char *clip, uint32_t *sample_rate, uint32_t *len)
+{
+    char path[VOICE_CMD_PATH_MAX];
+    uint8_t header[12];
+    uint8_t chunk[8];
+    uint8_t fmt[16];
+    rt_bool_t has_fmt = RT_FALSE;
+    int fd;
+
+    voice_cmd_clip_path(path, clip);
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    if (read(fd, header, sizeof(header)) == sizeof(header) &&
+        memcmp(header, "RIFF", 4) == 0 && memcmp(header + 8, "WAVE", 4) == 0)
+    {
+        while (read(fd, chunk, sizeof(chunk)) == sizeof(chunk))
+        {
+            uint32_t size = voice_cmd_get32(chunk + 4);
+
+            if (memcmp(chunk, "fmt ", 4) == 0 && size >= sizeof(fmt))
+            {
+                if (read(fd, fmt, sizeof(fmt)) != sizeof(fmt))
+                {
+                    break;
+                }
+                has_fmt = RT_TRUE;
+                size -= sizeof(fmt);
+            }
+            else if (memcmp(chunk, "data", 4) == 0)
+            {
+                /* 格式1 (PCM)，单声道，16bit */
+                if (!has_fmt || fmt[0] != 1 || fmt[1] != 0 || fmt[2] != 1 || fmt[14] != 16)
+                {
+                    break;
+                }
+                *sample_rate = voice_cmd_get32(fmt + 4);
+                *len = size;
+                return fd;
+            }
+            lseek(fd, (size + 1) & ~1, SEEK_CUR);
+        }
+    }
+
+    LOG_W("%s is not a 16-bit mono PCM WAV", path);
+    close(fd);
+    return -1;
+}
+
+/* 保存16bit单声道PCM为WAV */
+static int voice_cmd_wav_save(const char *clip, const uint8_t *pcm, uint32_t len, uint32_t sample_rate)
+{
+    char path[VOICE_CMD_PATH_MAX];
+    uint8_t header[VOICE_CMD_WAV_HEADER];
+    int fd, ret = RT_EOK;
+
+    memcpy(header, "RIFF\0\0\0\0WAVEfmt \x10\0\0\0\x01\0\x01\0\0\0\0\0\0\0\0\0\x02\0\x10\0data\0\0\0\0",
+           VOICE_CMD_WAV_HEADER);
+    voice_cmd_put32(header + 4, 36 + len);
+    voice_cmd_put32(header + 24, sample_rate);
+    voice_cmd_put32(header + 28, sample_rate * 2);
+    voice_cmd_put32(header + 40, len);
+
+    voice_cmd_clip_path(path, clip);
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0)
+    {
+        return -RT_EIO;
+    }
+    if (write(fd, header, sizeof(header)) != sizeof(header) || write(fd, pcm, len) != (int)len)
+    {
+        ret = -RT_EIO;
+    }
+    close(fd);
+
+    if (ret != RT_EOK)
+    {
+        unlink(path);
+    }
+    return ret;
+}
+
+/* 回复的片段是否都在 */
+static rt_bool_t voice_cmd_clips_ready(const voice_cmd_reply_t *reply)
+{
+    char path[VOICE_CMD_PATH_MAX];
+    struct stat st;
+    uint32_t i;
+
+    for (i = 0; i < reply->clip_count; i++)
+    {
+        voice_cmd_clip_path(path, reply->clips[i]);
+        if (stat(path, &st) != 0)
+        {
+            return RT_FALSE;
+        }
+    }
+
+    return reply->clip_count > 0;
+}
+
+/* 依次播放回复的片段，边读边写入扬声器流 */
+static int voice_cmd_play_clips(const voice_cmd_reply_t *reply)
+{
+    uint8_t *buf;
+    uint32_t i;
+    int ret;
+
+    buf = (uint8_t *)mem_class_alloc(MEM_CLASS_BULK, VOICE_CMD_READ_SIZE);
+    if (buf == RT_NULL)
+    {
+        return -RT_ENOMEM;
+    }
+
+    ret = audio_player_stream_begin();
+    for (i = 0; i < reply->clip_count && ret == RT_EOK; i++)
+    {
+        uint32_t sample_rate, len;
+        int fd, n;
+
+        fd = voice_cmd_wav_open(reply->clips[i], &sample_rate, &len);
+        if (fd < 0)
+        {
+            ret = -RT_EIO;
+            break;
+        }
+
+        ret = audio_player_stream_set_rate(sample_rate);
+        while (ret == RT_EOK && len > 0)
+        {
+            n = read(fd, buf, len < VOICE_CMD_READ_SIZE ? len : VOICE_CMD_READ_SIZE);
+            if (n <= 0)
+            {
+                break;
+            }
+            len -= n;
+            ret = audio_player_stream_write(buf, n & ~1);
+        }
+        close(fd);
+    }
+    if (audio_player_stream_end() != RT_EOK && ret == RT_EOK)
+    {
+        ret = -RT_ERROR;
+    }
+
+    mem_class_free(buf);
+    return ret;
+}
+
+/* 片段不全时的回复：联网合成（合成过的文本由TTS缓存提供，不再联网）*/
+static int voice_cmd_tts_sink(const uint8_t *pcm, uint32_t len, void *user_data)
+{
+    ai_response_t *response = (ai_response_t *)user_data;
+
+    if (audio_player_stream_set_rate(response->sample_rate) != RT_EOK)
+    {
+        return -RT_ERROR;
+    }
+
+    return audio_player_stream_write(pcm, len);
+}
+
+static int voice_cmd_say(const voice_cmd_reply_t *reply)
+{
+    ai_response_t response;
+    int ret;
+
+    rt_kprintf("[Voice] %s\n", reply->text);
+
+    if (voice_cmd_clips_ready(reply))
+    {
+        return voice_cmd_play_clips(reply);
+    }
+
+    if (reply->text[0] == '\0' || audio_player_stream_begin() != RT_EOK)
+    {
+        return -RT_ERROR;
+    }
+    rt_memset(&response, 0, sizeof(response));
+    ret = ai_cloud_service_text_to_speech_stream(reply->text, voice_cmd_tts_sink, &response, &response);
+    audio_player_stream_end();
+    ai_cloud_service_free_response(&response);
+
+    if (ret != RT_EOK)
+    {
+        LOG_W("No recorded reply in %s and TTS failed", VOICE_CMD_AUDIO_DIR);
+    }
+    return ret;
+}
+
+/* 执行命令并播放回复 */
+static int voice_cmd_run(voice_cmd_entry_t *cmd)
+{
+    voice_cmd_reply_t reply;
+    int ret = RT_EOK;
+
+    rt_memset(&reply, 0, sizeof(reply));
+    rt_strncpy(reply.text, cmd->reply, sizeof(reply.text) - 1);
+    rt_strncpy(reply.clips[0], cmd->name, VOICE_CMD_CLIP_LEN - 1);
+    reply.clip_count = 1;
+
+    cmd->count++;
+    if (cmd->handler != RT_NULL)
+    {
+        ret = cmd->handler(cmd->name, &reply);
+    }
+    if (ret != RT_EOK)
+    {
+        LOG_W("Local command '%s' failed: %d", cmd->name, ret);
+        return ret;
+    }
+
+    /* 命令已经执行，回复播放失败不影响结果 */
+    voice_cmd_say(&reply);
+    return RT_EOK;
+}
+
+int voice_cmd_execute(const char *name)
+{
+    voice_cmd_entry_t *cmd;
+
+    voice_cmd_init();
+    cmd = voice_cmd_find(name);
+    if (cmd == RT_NULL)
+    {
+        return -RT_ENOENT;
+    }
+
+    return voice_cmd_run(cmd);
+}
+
+/* ==================== 识别 ==================== */
+
+#if KWS_ENABLE
+/* 从SD卡加载命令模型；只在一句话结束后推理，引擎和模型放在PSRAM */
+static rt_bool_t voice_cmd_load_model(void)
+{
+    struct stat st;
+    int fd;
+
+    if (voice_cmd_ctrl.kws != RT_NULL)
+    {
+        return RT_TRUE;
+    }
+
+    if (stat(VOICE_CMD_MODEL_PATH, &st) != 0 || st.st_size <= 0)
+    {
+        if (!voice_cmd_ctrl.model_missing)
+        {
+            LOG_W("No command model at %s, sending all speech to the cloud", VOICE_CMD_MODEL_PATH);
+            voice_cmd_ctrl.model_missing = RT_TRUE;
+        }
+        return RT_FALSE;
+    }
+    voice_cmd_ctrl.model_missing = RT_FALSE;
+
+    voice_cmd_ctrl.model = (uint8_t *)mem_class_alloc(MEM_CLASS_BULK, st.st_size);
+    voice_cmd_ctrl.kws = (kws_engine_t *)mem_class_alloc(MEM_CLASS_BULK, sizeof(kws_engine_t));
+    if (voice_cmd_ctrl.model == RT_NULL || voice_cmd_ctrl.kws == RT_NULL)
+    {
+        LOG_E("Failed to allocate command recognizer");
+        goto _fail;
+    }
+
+    fd = open(VOICE_CMD_MODEL_PATH, O_RDONLY);
+    if (fd < 0)
+    {
+        goto _fail;
+    }
+    if (read(fd, voice_cmd_ctrl.model, st.st_size) != st.st_size)
+    {
+        close(fd);
+        goto _fail;
+    }
+    close(fd);
+
+    if (kws_engine_init(voice_cmd_ctrl.kws, voice_cmd_ctrl.model, st.st_size) != 0)
+    {
+        LOG_E("Invalid command model %s", VOICE_CMD_MODEL_PATH);
+        goto _fail;
+    }
+
+    LOG_I("Command model loaded: %d classes", voice_cmd_ctrl.kws->model.num_classes);
+    return RT_TRUE;
+
+_fail:
+    if (voice_cmd_ctrl.model)
+    {
+        mem_class_free(voice_cmd_ctrl.model);
+        voice_cmd_ctrl.model = RT_NULL;
+    }
+    if (voice_cmd_ctrl.kws)
+    {
+        mem_class_free(voice_cmd_ctrl.kws);
+        voice_cmd_ctrl.kws = RT_NULL;
+    }
+    return RT_FALSE;
+}
+#endif
+
+int voice_cmd_process(const int16_t *pcm, uint32_t samples)
+{
+#if KWS_ENABLE
+    kws_model_t *model;
+    voice_cmd_entry_t *cmd = RT_NULL;
+    rt_tick_t start;
+    int best;
+
+    voice_cmd_init();
+    voice_cmd_ctrl.utterances++;
+
+    /* 命令都很短，长句直接交给云端，不花时间识别 */
+    if (samples > VOICE_SAMPLE_RATE * VOICE_CMD_MAX_MS / 1000)
+    {
+        voice_cmd_ctrl.too_long++;
+        return -RT_ENOENT;
+    }
+    if (!voice_cmd_load_model())
+    {
+        return -RT_ENOSYS;
+    }
+    model = &voice_cmd_ctrl.kws->model;
+
+    start = rt_tick_get();
+    best = kws_engine_spot(voice_cmd_ctrl.kws, pcm, samples, VOICE_CMD_THRESHOLD, voice_cmd_ctrl.scores);
+    voice_cmd_ctrl.last_ms = (rt_tick_get() - start) * 1000 / RT_TICK_PER_SECOND;
+
+    if (best >= 0)
+    {
+        cmd = voice_cmd_find(model->labels[best]);
+    }
+    if (cmd == RT_NULL)
+    {
+        voice_cmd_ctrl.unsure++;
+        LOG_I("Not a local command (%d ms), asking the cloud", voice_cmd_ctrl.last_ms);
+        return -RT_ENOENT;
+    }
+
+    LOG_I("Local command '%s' (%d/127, %d ms)", cmd->name, voice_cmd_ctrl.scores[best], voice_cmd_ctrl.last_ms);
+    voice_cmd_ctrl.handled++;
+    return voice_cmd_run(cmd);
+#else
+    return -RT_ENOSYS;
+#endif
+}
+
+/* ==================== 预录回复 ==================== */
+
+/* 0~59的中文读法 */
+static void voice_cmd_number_text(uint32_t n, char *text, uint32_t size)
+{
+    static const char *const digits[] = {"零", "一", "二", "三", "四", "五", "六", "七", "八", "九"};
+
+    if (n < 10)
+    {
+        rt_snprintf(text, size, "%s", digits[n]);
+    }
+    else
+    {
+        rt_snprintf(text, size, "%s十%s", n >= 20 ? digits[n / 10] : "", n % 10 ? digits[n % 10] : "");
+    }
+}
+
+static int voice_cmd_render_clip(const char *clip, const char *text)
+{
+    ai_response_t response;
+    int ret;
+
+    rt_memset(&response, 0, sizeof(response));
+    ret = ai_cloud_service_text_to_speech(text, &response);
+    if (ret == RT_EOK && response.audio_result != RT_NULL && response.audio_len > 0)
+    {
+        ret = voice_cmd_wav_save(clip, (const uint8_t *)response.audio_result,
+                                 response.audio_len & ~1U, response.sample_rate);
+    }
+    else if (ret == RT_EOK)
+    {
+        ret = -RT_ERROR;
+    }
+    ai_cloud_service_free_response(&response);
+
+    rt_kprintf("  %-12s %s %s\n", clip, text, ret == RT_EOK ? "ok" : "FAILED");
+    return ret;
+}
+
+int voice_cmd_render(void)
+{
+    struct stat st;
+    char text[16];
+    char clip[VOICE_CMD_CLIP_LEN];
+    int failed = 0;
+    uint32_t i;
+
+    voice_cmd_init();
+
+    if (stat(VOICE_CMD_AUDIO_DIR, &st) != 0 && mkdir(VOICE_CMD_AUDIO_DIR, 0777) != 0)
+    {
+        LOG_E("Cannot create %s", VOICE_CMD_AUDIO_DIR);
+        return -RT_EIO;
+    }
+
+    for (i = 0; i < voice_cmd_ctrl.count; i++)
+    {
+        if (voice_cmd_ctrl.cmds[i].reply[0] != '\0' &&
+            voice_cmd_render_clip(voice_cmd_ctrl.cmds[i].name, voice_cmd_ctrl.cmds[i].reply) != RT_EOK)
+        {
+            failed++;
+        }
+    }
+    for (i = 0; i < sizeof(voice_cmd_extra_clips) / sizeof(voice_cmd_extra_clips[0]); i++)
+    {
+        if (voice_cmd_render_clip(voice_cmd_extra_clips[i].name, voice_cmd_extra_clips[i].text) != RT_EOK)
+        {
+            failed++;
+        }
+    }
+    for (i = 0; i < 60; i++)
+    {
+        rt_snprintf(clip, sizeof(clip), "num_%d", i);
+        voice_cmd_number_text(i, text, sizeof(text));
+        if (voice_cmd_render_clip(clip, text) != RT_EOK)
+        {
+            failed++;
+        }
+    }
+
+    return failed;
+}
+
+/* 导出MSH命令 */
+#ifdef FINSH_USING_MSH
+static int cmd_voice_cmd(int argc, char **argv)
+{
+    uint32_t i;
+
+    voice_cmd_init();
+
+    if (argc > 2 && strcmp(argv[1], "run") == 0)
+    {
+        int ret = voice_cmd_execute(argv[2]);
+
+        if (ret == -RT_ENOENT)
+        {
+            rt_kprintf("Unknown command: %s\n", argv[2]);
+        }
+        return ret;
+    }
+    if (argc > 1 && strcmp(argv[1], "render") == 0)
+    {
+        int failed;
+
+        rt_kprintf("Rendering replies to %s ...\n", VOICE_CMD_AUDIO_DIR);
+        failed = voice_cmd_render();
+        rt_kprintf("Done, %d failed\n", failed);
+        return failed == 0 ? 0 : -1;
+    }
+    if (argc > 1)
+    {
+        rt_kprintf("Usage: voice_cmd [run <command>|render]\n");
+        return -1;
+    }
+
+    rt_kprintf("Utterances: %d, handled locally: %d, too long: %d, not a command: %d\n",
+               voice_cmd_ctrl.utterances, voice_cmd_ctrl.handled, voice_cmd_ctrl.too_long,
+               voice_cmd_ctrl.unsure);
+    for (i = 0; i < voice_cmd_ctrl.count; i++)
+    {
+        rt_kprintf("  %-12s %-12s %d times\n", voice_cmd_ctrl.cmds[i].name,
+                   voice_cmd_ctrl.cmds[i].reply, voice_cmd_ctrl.cmds[i].count);
+    }
+#if KWS_ENABLE
+    if (voice_cmd_ctrl.kws != RT_NULL)
+    {
+        kws_model_t *model = &voice_cmd_ctrl.kws->model;
+
+        rt_kprintf("Model: %s, threshold %d/127, last spotting %d ms\n", VOICE_CMD_MODEL_PATH,
+                   VOICE_CMD_THRESHOLD, voice_cmd_ctrl.last_ms);
+        for (i = 0; i < model->num_classes; i++)
+        {
+            rt_kprintf("  %-12s %3d/127%s\n", model->labels[i], voice_cmd_ctrl.scores[i],
+                       kws_is_filler(model->labels[i]) ? " (filler)" :
+                       (voice_cmd_find(model->labels[i]) ? "" : " (not registered)"));
+        }
+        return 0;
+    }
+#endif
+    rt_kprintf("Model: not loaded (%s)\n", VOICE_CMD_MODEL_PATH);
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_voice_cmd, voice_cmd, Local voice commands: voice_cmd [run <command>|render]);
+#endif
+
+#endif /* VOICE_LOCAL_CMD_ENABLE */
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Offline local command recognizer
+ */
+
+#ifndef __VOICE_CMD_H__
+#define __VOICE_CMD_H__
+
+/*
+ * 本地命令：唤醒后的一句话在交给云端之前，先由本地命令模型识别（kws_engine_spot，
+ * 与唤醒词相同的MFCC前端和DS-CNN）。识别为已注册的命令时在本地执行，回复从SD卡上
+ * 预录的片段播放，整个过程不联网；超长、模型没有把握或不是命令的话返回错误，由调用者交给云端。
+ *   - 模型：VOICE_CMD_MODEL_PATH，类别名即命令名，silence/unknown 等填充类别表示不是命令
+ *   - 回复：VOICE_CMD_AUDIO_DIR/<片段>.wav（16bit单声道PCM，采样率不限），
+ *     缺少片段时联网合成回复文本（之后由TTS缓存提供），离线时只打印
+ *   - voice_cmd_register 可以增加命令，名称与模型的类别名对应
+ */
+
+#include <rtthread.h>
+
+#define VOICE_CMD_MAX           12      /* 命令数上限，与模型类别数上限相同 */
+#define VOICE_CMD_NAME_LEN      12
+#define VOICE_CMD_MAX_CLIPS     6
+#define VOICE_CMD_CLIP_LEN      16
+#define VOICE_CMD_VOLUME_STEP   20
+
+/* 命令的回复：依次播放的片段，片段不全时改为合成text */
+typedef struct {
+    char text[64];
+    char clips[VOICE_CMD_MAX_CLIPS][VOICE_CMD_CLIP_LEN];
+    uint32_t clip_count;
+} voice_cmd_reply_t;
+
+/* 命令处理函数：执行动作并修改回复（预先填好注册时的回复文本和与命令同名的片段），
+ * 返回错误时不播放回复 */
+typedef int (*voice_cmd_handler_t)(const char *name, voice_cmd_reply_t *reply);
+
+/* 注册内置命令（stop、vol_up、vol_down、time、led_on、led_off），重复调用无副作用 */
+int voice_cmd_init(void);
+
+/* 注册命令，名称已存在时替换其回复和处理函数；handler可以为空（只播放回复）*/
+int voice_cmd_register(const char *name, const char *reply, voice_cmd_handler_t handler);
+
+/* 识别并执行一句话（16kHz PCM，VAD裁剪后）：本地处理完返回RT_EOK，应交给云端时返回错误 */
+int voice_cmd_process(const int16_t *pcm, uint32_t samples);
+
+/* 不经过识别直接执行命令 */
+int voice_cmd_execute(const char *name);
+
+/* 联网合成所有命令的回复和报时用的片段，保存到 VOICE_CMD_AUDIO_DIR，返回失败的片段数 */
+int voice_cmd_render(void);
+
+#endif /* __VOICE_CMD_H__ */
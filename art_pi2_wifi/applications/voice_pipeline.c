@@ -0,0 +1,915 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-23     AI Assistant first version - Pipelined STT/Chat/TTS
+ * 2024-10-27     AI Assistant Carry the TTS sample rate to the play stage
+ * 2024-10-27     AI Assistant Bypass the TTS cache in vp_test
+ * 2024-10-27     AI Assistant Stream chat replies into the sentence splitter
+ * 2024-10-27     AI Assistant Send the echo prefix to TTS as its own sentence
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include "voice_pipeline.h"
+#include "ai_cloud_service.h"
+#include "ai_chat_service.h"
+#include "ai_arena.h"
+#include "audio_player.h"
+#include "tts_cache.h"
+
+#define DBG_TAG "voice.pipe"
+#define DBG_LVL DBG_INFO
+#include <rtdbg.h>
+
+#define VOICE_TICK_TO_MS(tick)      ((uint32_t)(tick) * 1000 / RT_TICK_PER_SECOND)
+
+/* 阶段线程等待消息的超时，用于及时发现本轮被中止 */
+#define VOICE_PIPELINE_POLL_MS      100
+
+/* 阶段间消息 */
+typedef enum {
+    VOICE_MSG_DATA = 0,         /* 数据：录音、文本、句子或PCM，除录音外由接收方释放 */
+    VOICE_MSG_END               /* 本轮结束 */
+} voice_msg_type_t;
+
+typedef struct {
+    uint32_t turn;
+    uint8_t type;
+    uint8_t error;              /* END消息：上游阶段是否出错 */
+    uint8_t *data;
+    uint32_t len;
+    uint32_t rate;              /* 音频消息：PCM采样率 */
+} voice_msg_t;
+
+/* 流水线控制结构 */
+static struct {
+    rt_mq_t stt_mq;
+    rt_mq_t chat_mq;
+    rt_mq_t tts_mq;
+    rt_mq_t play_mq;
+    rt_sem_t done_sem;
+    rt_mutex_t lock;
+    volatile uint32_t turn;     /* 当前轮次，旧轮次的消息被丢弃 */
+    volatile rt_bool_t busy;
+    volatile rt_bool_t turn_error;
+    int result;
+    rt_tick_t submit_tick;
+    voice_pipeline_stats_t stats;
+    rt_bool_t initialized;
+} voice_pipeline_ctrl = {
+    .initialized = RT_FALSE
+};
+
+/* ==================== 分句器 ==================== */
+
+/* 句末标点：。！？；… */
+static rt_bool_t voice_sentence_is_end(const char *buf, uint32_t len)
+{
+    const uint8_t *p;
+    char c = buf[len - 1];
+
+    if (c == '!' || c == '?' || c == ';' || c == '\n')
+    {
+        return RT_TRUE;
+    }
+
+    /* 英文句号后跟空白才算句末，避免切开小数和缩写 */
+    if ((c == ' ' || c == '\t') && len >= 2 && buf[len - 2] == '.')
+    {
+        return RT_TRUE;
+    }
+
+    if (len < 3)
+    {
+        return RT_FALSE;
+    }
+
+    p = (const uint8_t *)&buf[len - 3];
+    return (p[0] == 0xE3 && p[1] == 0x80 && p[2] == 0x82) ||    /* 。 */
+           (p[0] == 0xEF && p[1] == 0xBC && p[2] == 0x81) ||    /* ！ */
+           (p[0] == 0xEF && p[1] == 0xBC && p[2] == 0x9F) ||    /* ？ */
+           (p[0] == 0xEF && p[1] == 0xBC && p[2] == 0x9B) ||    /* ； */
+           (p[0] == 0xE2 && p[1] == 0x80 && p[2] == 0xA6);      /* … */
+}
+
+/* 输出缓冲区的前len字节，去掉首尾空白，剩余部分移到开头 */
+static void voice_sentence_emit(voice_sentence_t *splitter, uint32_t len)
+{
+    char *start = splitter->buf;
+    char *end = splitter->buf + len;
+    char saved;
+
+    while (start < end && (*start == ' ' || *start == '\t' || *start == '\r' || *start == '\n'))
+    {
+        start++;
+    }
+    while (end > start && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r' || end[-1] == '\n'))
+    {
+        end--;
+    }
+
+    if (end > start)
+    {
+        saved = *end;
+        *end = '\0';
+        splitter->callback(start, end - start, splitter->user_data);
+        *end = saved;
+    }
+
+    splitter->len -= len;
+    rt_memmove(splitter->buf, splitter->buf + len, splitter->len);
+}
+
+/* 句子过长：在最后一个逗号后切开，没有逗号时在UTF-8字符边界切开 */
+static void voice_sentence_split_long(voice_sentence_t *splitter)
+{
+    const uint8_t *p = (const uint8_t *)splitter->buf;
+    uint32_t cut = 0;
+    uint32_t i;
+
+    for (i = splitter->len; i > 0; i--)
+    {
+        if (p[i - 1] == ',')
+        {
+            cut = i;
+            break;
+        }
+        if (i >= 3 && p[i - 3] == 0xEF && p[i - 2] == 0xBC && p[i - 1] == 0x8C)   /* ， */
+        {
+            cut = i;
+            break;
+        }
+    }
+
+    if (cut == 0)
+    {
+        cut = splitter->len;
+        while (cut > 0 && (p[cut] & 0xC0) == 0x80)
+        {
+            cut--;
+        }
+        if (cut == 0)
+        {
+            cut = splitter->len;
+        }
+    }
+
+    voice_sentence_emit(splitter, cut);
+}
+
+void voice_sentence_init(voice_sentence_t *splitter, voice_sentence_cb_t callback, void *user_data)
+{
+    rt_memset(splitter, 0, sizeof(voice_sentence_t));
+    splitter->callback = callback;
+    splitter->user_data = user_data;
+}
+
+void voice_sentence_push(voice_sentence_t *splitter, const char *text, uint32_t len)
+{
+    uint32_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        splitter->buf[splitter->len++] = text[i];
+
+        if (voice_sentence_is_end(splitter->buf, splitter->len))
+        {
+            voice_sentence_emit(splitter, splitter->len);
+        }
+        else if (splitter->len >= VOICE_SENTENCE_MAX)
+        {
+            voice_sentence_split_long(splitter);
+        }
+    }
+}
+
+void voice_sentence_flush(voice_sentence_t *splitter)
+{
+    if (splitter->len > 0)
+    {
+        voice_sentence_emit(splitter, splitter->len);
+    }
+}
+
+/* ==================== 延迟统计 ==================== */
+
+static const uint32_t voice_latency_bounds[VOICE_LATENCY_BUCKETS - 1] = {
+    100, 200, 400, 800, 1600, 3200, 6400, 12800
+};
+
+static void voice_latency_record(voice_pipeline_stage_t stage, uint32_t ms)
+{
+    voice_latency_hist_t *hist = &voice_pipeline_ctrl.stats.latency[stage];
+    uint32_t i;
+
+    for (i = 0; i < VOICE_LATENCY_BUCKETS - 1 && ms >= voice_latency_bounds[i]; i++)
+    {
+    }
+
+    rt_mutex_take(voice_pipeline_ctrl.lock, RT_WAITING_FOREVER);
+    hist->count++;
+    hist->sum_ms += ms;
+    if (ms > hist->max_ms)
+    {
+        hist->max_ms = ms;
+    }
+    hist->buckets[i]++;
+    rt_mutex_release(voice_pipeline_ctrl.lock);
+}
+
+/* ==================== 阶段线程 ==================== */
+
+static rt_bool_t voice_msg_stale(const voice_msg_t *msg)
+{
+    return msg->turn != voice_pipeline_ctrl.turn;
+}
+
+/* 发送到下一阶段；队列满时等待，等待期间本轮被中止则释放数据 */
+static int voice_pipeline_send(rt_mq_t mq, voice_msg_t *msg)
+{
+    while (rt_mq_send_wait(mq, msg, sizeof(voice_msg_t),
+                           rt_tick_from_millisecond(VOICE_PIPELINE_POLL_MS)) != RT_EOK)
+    {
+        if (voice_msg_stale(msg))
+        {
+            ai_arena_free(msg->data);
+            return -RT_ERROR;
+        }
+    }
+
+    return RT_EOK;
+}
+
+static void voice_pipeline_send_end(rt_mq_t mq, uint32_t turn, rt_bool_t error)
+{
+    voice_msg_t msg = {0};
+
+    msg.turn = turn;
+    msg.type = VOICE_MSG_END;
+    msg.error = error;
+    voice_pipeline_send(mq, &msg);
+}
+
+/* STT：录音 -> 文本 */
+static void voice_stt_thread_entry(void *parameter)
+{
+    ai_response_t response;
+    voice_msg_t msg;
+    rt_tick_t start;
+    int ret;
+
+    while (1)
+    {
+        if (rt_mq_recv(voice_pipeline_ctrl.stt_mq, &msg, sizeof(msg), RT_WAITING_FOREVER) < 0)
+        {
+            continue;
+        }
+        if (voice_msg_stale(&msg))
+        {
+            continue;
+        }
+
+        rt_memset(&response, 0, sizeof(response));
+        start = rt_tick_get();
+        ret = ai_cloud_service_speech_to_text(msg.data, msg.len, &response);
+        voice_latency_record(VOICE_STAGE_STT, VOICE_TICK_TO_MS(rt_tick_get() - start));
+
+        if (ret != RT_EOK || response.text_result == RT_NULL)
+        {
+            LOG_E("Speech to text failed: %s", response.error_msg ? response.error_msg : "no result");
+            ai_cloud_service_free_response(&response);
+            voice_pipeline_send_end(voice_pipeline_ctrl.chat_mq, msg.turn, RT_TRUE);
+            continue;
+        }
+
+        rt_kprintf("\n[Voice] You said: %s\n", response.text_result);
+
+        msg.type = VOICE_MSG_DATA;
+        msg.data = (uint8_t *)response.text_result;
+        msg.len = strlen(response.text_result);
+        response.text_result = RT_NULL;  /* 所有权交给对话阶段 */
+        ai_cloud_service_free_response(&response);
+
+        if (voice_pipeline_send(voice_pipeline_ctrl.chat_mq, &msg) == RT_EOK)
+        {
+            voice_pipeline_send_end(voice_pipeline_ctrl.chat_mq, msg.turn, RT_FALSE);
+        }
+    }
+}
+
+/* 分句回调：每个完整的句子交给TTS阶段 */
+static void voice_chat_sentence(const char *sentence, uint32_t len, void *user_data)
+{
+    voice_msg_t msg = {0};
+
+    msg.turn = *(uint32_t *)user_data;
+    msg.type = VOICE_MSG_DATA;
+    msg.data = (uint8_t *)ai_arena_alloc(len + 1);
+    if (msg.data == RT_NULL)
+    {
+        LOG_E("No memory for sentence (%d bytes)", len);
+        voice_pipeline_ctrl.turn_error = RT_TRUE;
+        return;
+    }
+    rt_memcpy(msg.data, sentence, len + 1);
+    msg.len = len;
+
+    LOG_D("Sentence: %s", sentence);
+    voice_pipeline_ctrl.stats.sentences++;
+    voice_pipeline_send(voice_pipeline_ctrl.tts_mq, &msg);
+}
+
+/* 流式回复的片段直接送入分句器（其user_data是本轮的turn），第一句完整时就交给TTS；
+ * 本轮被中止时停止接收 */
+static int voice_chat_delta(const char *text, uint32_t len, void *user_data)
+{
+    voice_sentence_t *splitter = (voice_sentence_t *)user_data;
+
+    if (*(uint32_t *)splitter->user_data != voice_pipeline_ctrl.turn)
+    {
+        return -RT_EINTR;
+    }
+
+    voice_sentence_push(splitter, text, len);
+    return RT_EOK;
+}
+
+/* 对话：文本 -> 回复 -> 句子 */
+static void voice_chat_thread_entry(void *parameter)
+{
+    static voice_sentence_t splitter;
+    ai_chat_config_t chat_config;
+    ai_chat_response_t chat_resp;
+    const char *reply;
+    voice_msg_t msg;
+    uint32_t turn = 0;
+    rt_tick_t start;
+
+    voice_sentence_init(&splitter, voice_chat_sentence, &turn);
+
+    while (1)
+    {
+        if (rt_mq_recv(voice_pipeline_ctrl.chat_mq, &msg, sizeof(msg), RT_WAITING_FOREVER) < 0)
+        {
+            continue;
+        }
+        if (voice_msg_stale(&msg))
+        {
+            ai_arena_free(msg.data);
+            continue;
+        }
+
+        if (msg.type == VOICE_MSG_END)
+        {
+            voice_sentence_flush(&splitter);
+            voice_pipeline_send_end(voice_pipeline_ctrl.tts_mq, msg.turn, msg.error);
+            continue;
+        }
+
+        if (turn != msg.turn)
+        {
+            voice_sentence_init(&splitter, voice_chat_sentence, &turn);
+            turn = msg.turn;
+        }
+
+        /* 对话服务已初始化时由对话AI回答，否则复述识别结果 */
+        rt_memset(&chat_resp, 0, sizeof(chat_resp));
+        reply = RT_NULL;
+        if (ai_chat_service_get_config(&chat_config) == RT_EOK)
+        {
+            /* 回复边收边分句，句子在回调中已经交给TTS */
+            start = rt_tick_get();
+            if (ai_chat_service_chat_stream((const char *)msg.data, voice_chat_delta, &splitter,
+                                            &chat_resp) == RT_EOK && chat_resp.reply_text)
+            {
+                reply = chat_resp.reply_text;
+                voice_latency_record(VOICE_STAGE_CHAT_FIRST, chat_resp.first_token_ms);
+            }
+            voice_latency_record(VOICE_STAGE_CHAT, VOICE_TICK_TO_MS(rt_tick_get() - start));
+
+            if (reply == RT_NULL)
+            {
+                LOG_E("Chat failed: %s", chat_resp.error_msg ? chat_resp.error_msg : "no reply");
+                voice_pipeline_ctrl.turn_error = RT_TRUE;
+            }
+            else
+            {
+                rt_kprintf("[AI] %s\n", reply);
+            }
+        }
+        else
+        {
+            /* 前缀单独成句（分句器不在"："处切分），每轮都从TTS缓存播放 */
+            rt_kprintf("[AI] %s%s\n", AI_ECHO_PREFIX, (const char *)msg.data);
+            voice_sentence_push(&splitter, AI_ECHO_PREFIX, strlen(AI_ECHO_PREFIX));
+            voice_sentence_flush(&splitter);
+            voice_sentence_push(&splitter, (const char *)msg.data, strlen((const char *)msg.data));
+        }
+
+        ai_chat_service_free_response(&chat_resp);
+        ai_arena_free(msg.data);
+    }
+}
+
+/* TTS：句子 -> PCM */
+static void voice_tts_thread_entry(void *parameter)
+{
+    ai_response_t response;
+    voice_msg_t msg;
+    rt_tick_t start;
+    int ret;
+
+    while (1)
+    {
+        if (rt_mq_recv(voice_pipeline_ctrl.tts_mq, &msg, sizeof(msg), RT_WAITING_FOREVER) < 0)
+        {
+            continue;
+        }
+        if (voice_msg_stale(&msg))
+        {
+            ai_arena_free(msg.data);
+            continue;
+        }
+
+        if (msg.type == VOICE_MSG_END)
+        {
+            voice_pipeline_send(voice_pipeline_ctrl.play_mq, &msg);
+            continue;
+        }
+
+        rt_memset(&response, 0, sizeof(response));
+        start = rt_tick_get();
+        ret = ai_cloud_service_text_to_speech((const char *)msg.data, &response);
+        voice_latency_record(VOICE_STAGE_TTS, VOICE_TICK_TO_MS(rt_tick_get() - start));
+        ai_arena_free(msg.data);
+
+        if (ret != RT_EOK || response.audio_len == 0)
+        {
+            LOG_E("Text to speech failed: %s", response.error_msg ? response.error_msg : "no audio");
+            voice_pipeline_ctrl.turn_error = RT_TRUE;
+            ai_cloud_service_free_response(&response);
+            continue;
+        }
+
+        msg.data = (uint8_t *)response.audio_result;
+        msg.len = response.audio_len;
+        msg.rate = response.sample_rate;
+        response.audio_result = RT_NULL;  /* 所有权交给播放阶段 */
+        ai_cloud_service_free_response(&response);
+
+        voice_pipeline_send(voice_pipeline_ctrl.play_mq, &msg);
+    }
+}
+
+/* 结束一轮：被中止的轮次已由 voice_pipeline_cancel 结束 */
+static void voice_pipeline_finish(uint32_t turn, rt_bool_t error)
+{
+    rt_mutex_take(voice_pipeline_ctrl.lock, RT_WAITING_FOREVER);
+    if (voice_pipeline_ctrl.busy && turn == voice_pipeline_ctrl.turn)
+    {
+        error = error || voice_pipeline_ctrl.turn_error;
+        voice_pipeline_ctrl.result = error ? -RT_ERROR : RT_EOK;
+        voice_pipeline_ctrl.busy = RT_FALSE;
+        if (error)
+        {
+            voice_pipeline_ctrl.stats.errors++;
+        }
+        else
+        {
+            voice_pipeline_ctrl.stats.completed++;
+        }
+        rt_sem_release(voice_pipeline_ctrl.done_sem);
+    }
+    rt_mutex_release(voice_pipeline_ctrl.lock);
+}
+
+/* 播放：PCM -> 扬声器，一轮的各句写入同一个播放流，句间不停止I2S */
+static void voice_play_thread_entry(void *parameter)
+{
+    rt_bool_t playing = RT_FALSE;
+    rt_bool_t failed = RT_FALSE;
+    uint32_t playing_turn = 0;
+    voice_msg_t msg;
+
+    while (1)
+    {
+        if (rt_mq_recv(voice_pipeline_ctrl.play_mq, &msg, sizeof(msg),
+                       rt_tick_from_millisecond(VOICE_PIPELINE_POLL_MS)) < 0)
+        {
+            /* 本轮被中止时尽快释放播放器 */
+            if (playing && playing_turn != voice_pipeline_ctrl.turn)
+            {
+                audio_player_stream_end();
+                playing = RT_FALSE;
+            }
+            continue;
+        }
+
+        if (msg.turn != playing_turn)
+        {
+            if (playing)
+            {
+                audio_player_stream_end();
+                playing = RT_FALSE;
+            }
+            playing_turn = msg.turn;
+            failed = RT_FALSE;
+        }
+
+        if (voice_msg_stale(&msg))
+        {
+            ai_arena_free(msg.data);
+            continue;
+        }
+
+        if (msg.type == VOICE_MSG_END)
+        {
+            if (playing)
+            {
+                audio_player_stream_end();
+                playing = RT_FALSE;
+            }
+            voice_latency_record(VOICE_STAGE_TOTAL,
+                                 VOICE_TICK_TO_MS(rt_tick_get() - voice_pipeline_ctrl.submit_tick));
+            voice_pipeline_finish(msg.turn, msg.error || failed);
+            continue;
+        }
+
+        if (!playing && !failed)
+        {
+            if (audio_player_stream_begin() == RT_EOK)
+            {
+                playing = RT_TRUE;
+                voice_latency_record(VOICE_STAGE_FIRST_AUDIO,
+                                     VOICE_TICK_TO_MS(rt_tick_get() - voice_pipeline_ctrl.submit_tick));
+            }
+            else
+            {
+                failed = RT_TRUE;
+            }
+        }
+
+        if (playing && (audio_player_stream_set_rate(msg.rate) != RT_EOK ||
+                        audio_player_stream_write(msg.data, msg.len & ~1U) != RT_EOK))
+        {
+            audio_player_stream_end();
+            playing = RT_FALSE;
+            failed = RT_TRUE;
+        }
+
+        ai_arena_free(msg.data);
+    }
+}
+
+/* ==================== 流水线接口 ==================== */
+
+static rt_thread_t voice_pipeline_start_thread(const char *name, void (*entry)(void *),
+                                               rt_uint32_t stack_size, rt_uint8_t priority)
+{
+    rt_thread_t thread = rt_thread_create(name, entry, RT_NULL, stack_size, priority, 10);
+
+    if (thread != RT_NULL)
+    {
+        rt_thread_startup(thread);
+    }
+    else
+    {
+        LOG_E("Failed to create %s thread", name);
+    }
+
+    return thread;
+}
+
+int voice_pipeline_init(void)
+{
+    if (voice_pipeline_ctrl.initialized)
+    {
+        return RT_EOK;
+    }
+
+    voice_pipeline_ctrl.lock = rt_mutex_create("vp_lock", RT_IPC_FLAG_PRIO);
+    voice_pipeline_ctrl.done_sem = rt_sem_create("vp_done", 0, RT_IPC_FLAG_FIFO);
+    voice_pipeline_ctrl.stt_mq = rt_mq_create("vp_stt", sizeof(voice_msg_t),
+                                              VOICE_PIPELINE_QUEUE_DEPTH, RT_IPC_FLAG_FIFO);
+    voice_pipeline_ctrl.chat_mq = rt_mq_create("vp_chat", sizeof(voice_msg_t),
+                                               VOICE_PIPELINE_QUEUE_DEPTH, RT_IPC_FLAG_FIFO);
+    voice_pipeline_ctrl.tts_mq = rt_mq_create("vp_tts", sizeof(voice_msg_t),
+                                              VOICE_PIPELINE_QUEUE_DEPTH, RT_IPC_FLAG_FIFO);
+    voice_pipeline_ctrl.play_mq = rt_mq_create("vp_play", sizeof(voice_msg_t),
+                                               VOICE_PIPELINE_PLAY_DEPTH, RT_IPC_FLAG_FIFO);
+    if (voice_pipeline_ctrl.lock == RT_NULL || voice_pipeline_ctrl.done_sem == RT_NULL ||
+        voice_pipeline_ctrl.stt_mq == RT_NULL || voice_pipeline_ctrl.chat_mq == RT_NULL ||
+        voice_pipeline_ctrl.tts_mq == RT_NULL || voice_pipeline_ctrl.play_mq == RT_NULL)
+    {
+        LOG_E("Failed to create pipeline IPC objects");
+        return -RT_ENOMEM;
+    }
+
+    /* 播放线程优先级最高，保证扬声器数据供给；网络阶段同优先级轮转 */
+    if (voice_pipeline_start_thread("vp_stt", voice_stt_thread_entry, 4096, 11) == RT_NULL ||
+        voice_pipeline_start_thread("vp_chat", voice_chat_thread_entry, 4096, 11) == RT_NULL ||
+        voice_pipeline_start_thread("vp_tts", voice_tts_thread_entry, 4096, 11) == RT_NULL ||
+        voice_pipeline_start_thread("vp_play", voice_play_thread_entry, 2048, 9) == RT_NULL)
+    {
+        return -RT_ERROR;
+    }
+
+    voice_pipeline_ctrl.initialized = RT_TRUE;
+    LOG_I("Voice pipeline initialized");
+
+    return RT_EOK;
+}
+
+int voice_pipeline_submit(const uint8_t *audio, uint32_t len)
+{
+    voice_msg_t msg = {0};
+
+    if (!voice_pipeline_ctrl.initialized)
+    {
+        LOG_E("Voice pipeline not initialized");
+        return -RT_ERROR;
+    }
+    if (audio == RT_NULL || len == 0)
+    {
+        return -RT_EINVAL;
+    }
+
+    rt_mutex_take(voice_pipeline_ctrl.lock, RT_WAITING_FOREVER);
+    if (voice_pipeline_ctrl.busy)
+    {
+        rt_mutex_release(voice_pipeline_ctrl.lock);
+        return -RT_EBUSY;
+    }
+    voice_pipeline_ctrl.turn++;
+    voice_pipeline_ctrl.busy = RT_TRUE;
+    voice_pipeline_ctrl.turn_error = RT_FALSE;
+    voice_pipeline_ctrl.result = -RT_ERROR;
+    voice_pipeline_ctrl.submit_tick = rt_tick_get();
+    voice_pipeline_ctrl.stats.turns++;
+    rt_sem_control(voice_pipeline_ctrl.done_sem, RT_IPC_CMD_RESET, RT_NULL);
+    msg.turn = voice_pipeline_ctrl.turn;
+    rt_mutex_release(voice_pipeline_ctrl.lock);
+
+    msg.type = VOICE_MSG_DATA;
+    msg.data = (uint8_t *)audio;
+    msg.len = len;
+    if (rt_mq_send(voice_pipeline_ctrl.stt_mq, &msg, sizeof(msg)) != RT_EOK)
+    {
+        voice_pipeline_finish(msg.turn, RT_TRUE);
+        return -RT_EFULL;
+    }
+
+    return RT_EOK;
+}
+
+int voice_pipeline_wait(rt_int32_t timeout)
+{
+    if (!voice_pipeline_ctrl.initialized)
+    {
+        return -RT_ERROR;
+    }
+
+    if (voice_pipeline_ctrl.busy &&
+        rt_sem_take(voice_pipeline_ctrl.done_sem, timeout) != RT_EOK)
+    {
+        return -RT_ETIMEOUT;
+    }
+
+    return voice_pipeline_ctrl.result;
+}
+
+void voice_pipeline_cancel(void)
+{
+    rt_bool_t cancelled = RT_FALSE;
+
+    if (!voice_pipeline_ctrl.initialized)
+    {
+        return;
+    }
+
+    rt_mutex_take(voice_pipeline_ctrl.lock, RT_WAITING_FOREVER);
+    if (voice_pipeline_ctrl.busy)
+    {
+        voice_pipeline_ctrl.turn++;
+        voice_pipeline_ctrl.busy = RT_FALSE;
+        voice_pipeline_ctrl.result = -RT_ERROR;
+        voice_pipeline_ctrl.stats.cancelled++;
+        rt_sem_release(voice_pipeline_ctrl.done_sem);
+        cancelled = RT_TRUE;
+    }
+    rt_mutex_release(voice_pipeline_ctrl.lock);
+
+    if (cancelled)
+    {
+        /* 播放线程的下一次写入返回错误，由它结束播放流 */
+        audio_player_stop();
+        LOG_I("Voice pipeline turn cancelled");
+    }
+}
+
+rt_bool_t voice_pipeline_is_busy(void)
+{
+    return voice_pipeline_ctrl.busy;
+}
+
+void voice_pipeline_get_stats(voice_pipeline_stats_t *stats)
+{
+    if (!voice_pipeline_ctrl.initialized)
+    {
+        rt_memset(stats, 0, sizeof(voice_pipeline_stats_t));
+        return;
+    }
+
+    rt_mutex_take(voice_pipeline_ctrl.lock, RT_WAITING_FOREVER);
+    rt_memcpy(stats, &voice_pipeline_ctrl.stats, sizeof(voice_pipeline_stats_t));
+    rt_mutex_release(voice_pipeline_ctrl.lock);
+}
+
+void voice_pipeline_reset_stats(void)
+{
+    if (!voice_pipeline_ctrl.initialized)
+    {
+        return;
+    }
+
+    rt_mutex_take(voice_pipeline_ctrl.lock, RT_WAITING_FOREVER);
+    rt_memset(&voice_pipeline_ctrl.stats, 0, sizeof(voice_pipeline_stats_t));
+    rt_mutex_release(voice_pipeline_ctrl.lock);
+}
+
+#ifdef FINSH_USING_MSH
+#include <finsh.h>
+
+static void voice_pipeline_print_stats(void)
+{
+    static const char *const stage_names[VOICE_STAGE_NUM] = {
+        "stt", "chat", "chat first", "tts/sentence", "first audio", "total"
+    };
+    voice_pipeline_stats_t stats;
+    voice_latency_hist_t *hist;
+    int stage, i;
+
+    voice_pipeline_get_stats(&stats);
+
+    rt_kprintf("Turns: %d, completed: %d, errors: %d, cancelled: %d, sentences: %d\n",
+               stats.turns, stats.completed, stats.errors, stats.cancelled, stats.sentences);
+    rt_kprintf("%-13s %5s %6s %6s |", "stage (ms)", "count", "avg", "max");
+    for (i = 0; i < VOICE_LATENCY_BUCKETS - 1; i++)
+    {
+        rt_kprintf(" <%-5d", voice_latency_bounds[i]);
+    }
+    rt_kprintf("  more\n");
+
+    for (stage = 0; stage < VOICE_STAGE_NUM; stage++)
+    {
+        hist = &stats.latency[stage];
+        rt_kprintf("%-13s %5d %6d %6d |", stage_names[stage], hist->count,
+                   hist->count ? hist->sum_ms / hist->count : 0, hist->max_ms);
+        for (i = 0; i < VOICE_LATENCY_BUCKETS; i++)
+        {
+            rt_kprintf(" %6d", hist->buckets[i]);
+        }
+        rt_kprintf("\n");
+    }
+}
+
+static int cmd_vp_stats(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "reset") == 0)
+    {
+        voice_pipeline_reset_stats();
+        rt_kprintf("Voice pipeline stats reset\n");
+        return 0;
+    }
+
+    voice_pipeline_print_stats();
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_vp_stats, vp_stats, Show voice pipeline latency histograms: vp_stats [reset]);
+
+/*
+ * 对照 mock_ai_server.py 测量流水线：
+ *   STT -> /stt (校验请求体)，对话 -> /chat (返回多句回复)，TTS -> /tts (合成耗时与字数成正比)
+ * 先用串行的全双工接口跑一轮作为基线，再用流水线跑指定轮数
+ */
+static int cmd_vp_test(int argc, char **argv)
+{
+    ai_service_config_t saved_ai, test_ai;
+    ai_chat_config_t saved_chat, test_chat;
+    rt_bool_t has_ai, has_chat, cache_enabled;
+    ai_response_t response;
+    uint32_t bytes = 16000 * 2;
+    uint8_t *pcm;
+    rt_tick_t start;
+    int turns, sentences, i, ret;
+
+    if (argc < 2)
+    {
+        rt_kprintf("Usage: vp_test <mock_base_url> [turns] [sentences]\n");
+        rt_kprintf("  e.g. vp_test http://PC_IP:8090 3 4\n");
+        return -1;
+    }
+    turns = argc > 2 ? atoi(argv[2]) : 3;
+    sentences = argc > 3 ? atoi(argv[3]) : 4;
+
+    pcm = (uint8_t *)rt_malloc(bytes);
+    if (pcm == RT_NULL)
+    {
+        rt_kprintf("Failed to allocate %d bytes\n", bytes);
+        return -1;
+    }
+    for (i = 0; i < (int)bytes; i++)
+    {
+        pcm[i] = (uint8_t)(i * 31 + 7);
+    }
+
+    has_ai = (ai_cloud_service_get_config(&saved_ai) == RT_EOK);
+    has_chat = (ai_chat_service_get_config(&saved_chat) == RT_EOK);
+
+    rt_memset(&test_ai, 0, sizeof(test_ai));
+    test_ai.provider = AI_SERVICE_BAIDU;
+    strncpy(test_ai.api_key, "test_token", sizeof(test_ai.api_key) - 1);
+    strncpy(test_ai.app_id, "test_cuid", sizeof(test_ai.app_id) - 1);
+    rt_snprintf(test_ai.api_url, sizeof(test_ai.api_url), "%s/stt", argv[1]);
+    rt_snprintf(test_ai.tts_url, sizeof(test_ai.tts_url),
+                "%s/tts?delay=200&char_ms=30&char_bytes=6400&rate=64000", argv[1]);
+    ai_cloud_service_init(&test_ai);
+
+    rt_memset(&test_chat, 0, sizeof(test_chat));
+    test_chat.provider = AI_CHAT_OPENAI;
+    strncpy(test_chat.model, "mock", sizeof(test_chat.model) - 1);
+    rt_snprintf(test_chat.api_url, sizeof(test_chat.api_url),
+                "%s/chat?sentences=%d&delay=300&token_ms=40", argv[1], sentences);
+    ai_chat_service_init(&test_chat);
+
+    audio_player_init();
+    if (voice_pipeline_init() != RT_EOK)
+    {
+        rt_free(pcm);
+        return -1;
+    }
+    /* 每轮的回复相同，从TTS缓存播放就测不到合成延迟了 */
+    cache_enabled = tts_cache_set_enabled(RT_FALSE);
+
+    /* 基线：串行全双工，回复整体合成后播放 */
+    rt_memset(&response, 0, sizeof(response));
+    start = rt_tick_get();
+    ret = ai_cloud_service_full_duplex(pcm, bytes, &response);
+    if (ret == RT_EOK)
+    {
+        audio_player_play_rate((uint8_t *)response.audio_result, response.audio_len, response.sample_rate);
+        rt_kprintf("Serial: first audio %d ms, %d bytes\n",
+                   VOICE_TICK_TO_MS(rt_tick_get() - start), response.audio_len);
+        while (audio_player_get_state() == AUDIO_PLAYER_PLAYING)
+        {
+            rt_thread_mdelay(10);
+        }
+        rt_kprintf("Serial: total %d ms\n", VOICE_TICK_TO_MS(rt_tick_get() - start));
+    }
+    else
+    {
+        rt_kprintf("Serial: failed (%d)\n", ret);
+    }
+    ai_cloud_service_free_response(&response);
+
+    /* 流水线 */
+    voice_pipeline_reset_stats();
+    for (i = 0; i < turns; i++)
+    {
+        start = rt_tick_get();
+        ai_arena_begin();
+        ret = voice_pipeline_submit(pcm, bytes);
+        if (ret == RT_EOK)
+        {
+            ret = voice_pipeline_wait(rt_tick_from_millisecond(60000));
+            if (ret == -RT_ETIMEOUT)
+            {
+                voice_pipeline_cancel();
+            }
+        }
+        ai_arena_end();
+        rt_kprintf("Pipeline turn %d: %s, %d ms\n", i + 1, ret == RT_EOK ? "ok" : "failed",
+                   VOICE_TICK_TO_MS(rt_tick_get() - start));
+    }
+    voice_pipeline_print_stats();
+    tts_cache_set_enabled(cache_enabled);
+
+    if (has_ai)
+    {
+        ai_cloud_service_init(&saved_ai);
+    }
+    if (has_chat)
+    {
+        ai_chat_service_init(&saved_chat);
+    }
+    rt_free(pcm);
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_vp_test, vp_test, Benchmark voice pipeline against mock_ai_server.py);
+#endif
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-23     AI Assistant first version - Pipelined STT/Chat/TTS
+ */
+
+#ifndef __VOICE_PIPELINE_H__
+#define __VOICE_PIPELINE_H__
+
+/*
+ * 语音交互流水线：
+ *   submit -> [STT线程] -文本-> [对话线程] -分句-> [TTS线程] -PCM-> [播放线程]
+ *
+ * 各阶段由消息队列连接，对话回复按句切分后逐句合成，第一句开始播放时
+ * 后面的句子仍在合成。TTS与播放之间的队列很浅，播放跟不上时TTS线程阻塞，
+ * 避免整段回复的PCM同时堆积在内存中。
+ */
+
+#include <rtthread.h>
+
+/* 阶段间队列深度 */
+#define VOICE_PIPELINE_QUEUE_DEPTH  8
+#define VOICE_PIPELINE_PLAY_DEPTH   2
+
+/* 单句最大字节数（UTF-8），超长的句子在逗号处或字符边界处切开 */
+#define VOICE_SENTENCE_MAX          192
+
+/* ==================== 分句器 ==================== */
+
+typedef void (*voice_sentence_cb_t)(const char *sentence, uint32_t len, void *user_data);
+
+typedef struct {
+    char buf[VOICE_SENTENCE_MAX + 4];
+    uint32_t len;
+    voice_sentence_cb_t callback;
+    void *user_data;
+} voice_sentence_t;
+
+/* 文本可以分多次送入（如流式对话回复），句子完整时通过回调输出，回调中的字符串以0结尾 */
+void voice_sentence_init(voice_sentence_t *splitter, voice_sentence_cb_t callback, void *user_data);
+void voice_sentence_push(voice_sentence_t *splitter, const char *text, uint32_t len);
+void voice_sentence_flush(voice_sentence_t *splitter);
+
+/* ==================== 延迟统计 ==================== */
+
+/* 直方图桶上限 (ms)：100, 200, 400 ... 12800，最后一个桶为更大的值 */
+#define VOICE_LATENCY_BUCKETS       9
+
+typedef struct {
+    uint32_t count;
+    uint32_t sum_ms;
+    uint32_t max_ms;
+    uint32_t buckets[VOICE_LATENCY_BUCKETS];
+} voice_latency_hist_t;
+
+typedef enum {
+    VOICE_STAGE_STT = 0,        /* 语音识别请求 */
+    VOICE_STAGE_CHAT,           /* 对话请求 */
+    VOICE_STAGE_CHAT_FIRST,     /* 对话请求到第一段回复（流式）*/
+    VOICE_STAGE_TTS,            /* 单句语音合成 */
+    VOICE_STAGE_FIRST_AUDIO,    /* 提交到第一句音频开始播放 */
+    VOICE_STAGE_TOTAL,          /* 提交到最后一句播完 */
+    VOICE_STAGE_NUM
+} voice_pipeline_stage_t;
+
+typedef struct {
+    uint32_t turns;
+    uint32_t completed;
+    uint32_t errors;
+    uint32_t cancelled;
+    uint32_t sentences;
+    voice_latency_hist_t latency[VOICE_STAGE_NUM];
+} voice_pipeline_stats_t;
+
+/* ==================== 流水线接口 ==================== */
+
+int voice_pipeline_init(void);
+
+/* 提交一段录音，audio须保持有效直到 voice_pipeline_wait 返回；上一轮未结束时返回 -RT_EBUSY */
+int voice_pipeline_submit(const uint8_t *audio, uint32_t len);
+
+/* 等待本轮结束（最后一句播完），返回本轮结果 */
+int voice_pipeline_wait(rt_int32_t timeout);
+
+/* 中止本轮：停止播放，丢弃各阶段中尚未处理的消息 */
+void voice_pipeline_cancel(void);
+
+rt_bool_t voice_pipeline_is_busy(void);
+void voice_pipeline_get_stats(voice_pipeline_stats_t *stats);
+void voice_pipeline_reset_stats(void);
+
+#endif /* __VOICE_PIPELINE_H__ */
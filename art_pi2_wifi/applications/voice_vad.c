@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-20     AI Assistant first version - Voice Activity Detection
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include "voice_vad.h"
+#include "voice_assistant_config.h"
+
+#define DBG_TAG "voice.vad"
+#define DBG_LVL DBG_INFO
+#include <rtdbg.h>
+
+/* 初始化VAD */
+void voice_vad_init(voice_vad_t *vad, uint32_t sample_rate, uint32_t threshold, uint32_t silence_ms)
+{
+    rt_memset(vad, 0, sizeof(voice_vad_t));
+
+    vad->frame_len = sample_rate * VAD_FRAME_MS / 1000;
+    vad->threshold = threshold;
+    vad->end_frames = silence_ms / VAD_FRAME_MS;
+    if (vad->end_frames < VAD_HANGOVER_FRAMES)
+    {
+        vad->end_frames = VAD_HANGOVER_FRAMES;
+    }
+    vad->preroll = sample_rate * VAD_PREROLL_MS / 1000;
+    vad->noise_floor = threshold / 2;
+    vad->state = VAD_SILENCE;
+}
+
+/* 判定一帧是否为语音 */
+static rt_bool_t vad_frame_is_speech(voice_vad_t *vad, uint32_t energy, uint32_t zcr_permille)
+{
+    /* 门限随环境噪声自适应，但不低于配置值 */
+    uint32_t threshold = vad->noise_floor * 3;
+    if (threshold < vad->threshold)
+    {
+        threshold = vad->threshold;
+    }
+
+    /* 强能量帧直接判为语音（浊音）*/
+    if (energy >= threshold * 4)
+    {
+        return RT_TRUE;
+    }
+
+    /* 中等能量帧需过零率落在语音范围内（清音），排除工频和白噪声 */
+    return energy >= threshold &&
+           zcr_permille >= VAD_ZCR_MIN_PERMILLE &&
+           zcr_permille <= VAD_ZCR_MAX_PERMILLE;
+}
+
+/* 处理一个完整帧 */
+static void vad_process_frame(voice_vad_t *vad)
+{
+    uint32_t energy = vad->frame_abs_sum / vad->frame_len;
+    uint32_t zcr_permille = vad->frame_crossings * 1000 / vad->frame_len;
+    uint32_t frame_end = vad->samples;
+    rt_bool_t speech = vad_frame_is_speech(vad, energy, zcr_permille);
+
+    if (!speech)
+    {
+        /* 噪声底噪：1/16权重的滑动平均 */
+        vad->noise_floor = (vad->noise_floor * 15 + energy) / 16;
+    }
+
+    switch (vad->state)
+    {
+    case VAD_SILENCE:
+        if (!speech)
+        {
+            vad->onset_run = 0;
+            break;
+        }
+
+        if (++vad->onset_run >= VAD_ONSET_FRAMES)
+        {
+            uint32_t onset = frame_end - vad->onset_run * vad->frame_len;
+
+            vad->speech_start = onset > vad->preroll ? onset - vad->preroll : 0;
+            vad->speech_end = frame_end;
+            vad->silence_run = 0;
+            vad->state = VAD_SPEECH;
+            LOG_D("Speech start at %d ms", onset * VAD_FRAME_MS / vad->frame_len);
+        }
+        break;
+
+    case VAD_SPEECH:
+        if (speech)
+        {
+            vad->silence_run = 0;
+            vad->speech_end = frame_end;
+            break;
+        }
+
+        vad->silence_run++;
+        if (vad->silence_run <= VAD_HANGOVER_FRAMES)
+        {
+            /* 挂起期内仍计入语音区间 */
+            vad->speech_end = frame_end;
+        }
+        if (vad->silence_run >= vad->end_frames)
+        {
+            vad->state = VAD_END;
+            LOG_D("Speech end at %d ms", vad->speech_end * VAD_FRAME_MS / vad->frame_len);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+/* 处理一段PCM数据，长度不要求与帧对齐 */
+vad_result_t voice_vad_process(voice_vad_t *vad, const int16_t *samples, uint32_t count)
+{
+    for (uint32_t i = 0; i < count && vad->state != VAD_END; i++)
+    {
+        int16_t sample = samples[i];
+
+        vad->frame_abs_sum += (uint32_t)abs(sample);
+        if ((sample ^ vad->last_sample) < 0)
+        {
+            vad->frame_crossings++;
+        }
+        vad->last_sample = sample;
+        vad->samples++;
+
+        if (++vad->frame_fill == vad->frame_len)
+        {
+            vad_process_frame(vad);
+            vad->frame_fill = 0;
+            vad->frame_abs_sum = 0;
+            vad->frame_crossings = 0;
+        }
+    }
+
+    return vad->state;
+}
+
+/* 是否检测到过语音 */
+rt_bool_t voice_vad_has_speech(const voice_vad_t *vad)
+{
+    return vad->state != VAD_SILENCE;
+}
+
+/* 语音起点（样本序号）*/
+uint32_t voice_vad_speech_start(const voice_vad_t *vad)
+{
+    return vad->speech_start;
+}
+
+/* 语音终点（样本序号）*/
+uint32_t voice_vad_speech_end(const voice_vad_t *vad)
+{
+    return vad->state == VAD_SILENCE ? 0 : vad->speech_end;
+}
+
+/* 对WAV/PCM文件运行VAD，直到说话结束或文件结束
+ * WAV文件从fmt块取采样率，定位到data块（只支持16bit单声道PCM，其他格式返回-RT_EINVAL）；
+ * PCM文件按VOICE_SAMPLE_RATE处理 */
+int voice_vad_file(voice_vad_t *vad, const char *path, uint32_t threshold)
+{
+    int16_t chunk[256];
+    uint32_t sample_rate = VOICE_SAMPLE_RATE;
+    int fd, len;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return -RT_EIO;
+    }
+
+    len = strlen(path);
+    if (len > 4 && strcmp(path + len - 4, ".wav") == 0)
+    {
+        uint8_t header[12];
+        uint8_t chunk_hdr[8] = {0};
+        rt_bool_t fmt_ok = RT_FALSE;
+
+        if (read(fd, header, sizeof(header)) != sizeof(header) || memcmp(header, "RIFF", 4) != 0)
+        {
+            close(fd);
+            return -RT_EINVAL;
+        }
+        while (read(fd, chunk_hdr, sizeof(chunk_hdr)) == sizeof(chunk_hdr))
+        {
+            uint32_t size = chunk_hdr[4] | (chunk_hdr[5] << 8) | (chunk_hdr[6] << 16) | (chunk_hdr[7] << 24);
+
+            if (memcmp(chunk_hdr, "data", 4) == 0)
+            {
+                break;
+            }
+            if (memcmp(chunk_hdr, "fmt ", 4) == 0)
+            {
+                uint8_t fmt[16];
+                uint16_t format, channels, bits;
+
+                if (size < sizeof(fmt) || read(fd, fmt, sizeof(fmt)) != sizeof(fmt))
+                {
+                    break;
+                }
+                format = fmt[0] | (fmt[1] << 8);
+                channels = fmt[2] | (fmt[3] << 8);
+                bits = fmt[14] | (fmt[15] << 8);
+                if (format != 1 || channels != 1 || bits != 16)
+                {
+                    break;
+                }
+                sample_rate = fmt[4] | (fmt[5] << 8) | (fmt[6] << 16) | (fmt[7] << 24);
+                fmt_ok = RT_TRUE;
+                size -= sizeof(fmt);
+            }
+            lseek(fd, (size + 1) & ~1, SEEK_CUR);
+        }
+
+        /* 没有data块、fmt块过短或不是16bit单声道PCM */
+        if (!fmt_ok || memcmp(chunk_hdr, "data", 4) != 0)
+        {
+            close(fd);
+            return -RT_EINVAL;
+        }
+    }
+
+    voice_vad_init(vad, sample_rate, threshold, VOICE_SILENCE_DURATION);
+
+    while ((len = read(fd, chunk, sizeof(chunk))) > 0)
+    {
+        if (voice_vad_process(vad, chunk, len / 2) == VAD_END)
+        {
+            break;
+        }
+    }
+    close(fd);
+
+    return (int)sample_rate;
+}
+
+/* 导出MSH命令 */
+#ifdef FINSH_USING_MSH
+
+/* 离线测试：对SD卡上的WAV/PCM文件运行VAD，输出语音区间 */
+static int cmd_vad_file(int argc, char **argv)
+{
+    voice_vad_t vad;
+    uint32_t threshold = argc > 2 ? atoi(argv[2]) : VOICE_SILENCE_THRESHOLD;
+    int sample_rate;
+
+    if (argc < 2)
+    {
+        rt_kprintf("Usage: vad_file <file.wav|file.pcm> [threshold]\n");
+        return -1;
+    }
+
+    sample_rate = voice_vad_file(&vad, argv[1], threshold);
+    if (sample_rate == -RT_EINVAL)
+    {
+        rt_kprintf("%s is not a 16-bit mono PCM WAV\n", argv[1]);
+        return -1;
+    }
+    if (sample_rate <= 0)
+    {
+        rt_kprintf("Failed to read %s\n", argv[1]);
+        return -1;
+    }
+
+    rt_kprintf("Processed %d ms @ %d Hz, noise floor %d\n",
+               vad.samples * 1000 / sample_rate, sample_rate, vad.noise_floor);
+    if (!voice_vad_has_speech(&vad))
+    {
+        rt_kprintf("No speech detected\n");
+        return 0;
+    }
+
+    rt_kprintf("Speech: %d ms - %d ms%s\n",
+               voice_vad_speech_start(&vad) * 1000 / sample_rate,
+               voice_vad_speech_end(&vad) * 1000 / sample_rate,
+               vad.state == VAD_END ? " (ended by silence)" : "");
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_vad_file, vad_file, Run VAD on a WAV/PCM file);
+#endif
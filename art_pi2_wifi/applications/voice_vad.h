@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-20     AI Assistant first version - Voice Activity Detection
+ */
+
+#ifndef __VOICE_VAD_H__
+#define __VOICE_VAD_H__
+
+#include <rtthread.h>
+
+/* VAD帧长 (毫秒) */
+#define VAD_FRAME_MS            20
+
+/* 判定为语音开始所需的连续语音帧数 */
+#define VAD_ONSET_FRAMES        3
+
+/* 语音帧之后保持语音状态的帧数（挂起，吸收字间停顿）*/
+#define VAD_HANGOVER_FRAMES     8
+
+/* 裁剪前导静音时在语音起点前保留的时长 (毫秒) */
+#define VAD_PREROLL_MS          200
+
+/* 过零率范围（千分比）：低于下限为直流/工频干扰，高于上限为白噪声 */
+#define VAD_ZCR_MIN_PERMILLE    10
+#define VAD_ZCR_MAX_PERMILLE    400
+
+/* VAD处理结果 */
+typedef enum {
+    VAD_SILENCE = 0,    /* 尚未检测到语音 */
+    VAD_SPEECH,         /* 正在说话（含挂起期）*/
+    VAD_END             /* 说话结束（静音超过设定时长）*/
+} vad_result_t;
+
+/* VAD状态 */
+typedef struct {
+    /* 配置 */
+    uint32_t frame_len;         /* 每帧样本数 */
+    uint32_t threshold;         /* 最小能量门限（平均绝对幅度）*/
+    uint32_t end_frames;        /* 结束所需的静音帧数 */
+    uint32_t preroll;           /* 语音起点前保留的样本数 */
+
+    /* 当前帧累加 */
+    uint32_t frame_fill;
+    uint32_t frame_abs_sum;
+    uint32_t frame_crossings;
+    int16_t last_sample;
+
+    /* 检测状态 */
+    vad_result_t state;
+    uint32_t noise_floor;       /* 静音段能量的滑动平均 */
+    uint32_t onset_run;         /* 连续语音帧计数 */
+    uint32_t silence_run;       /* 最后一个语音帧之后的静音帧计数 */
+    uint32_t samples;           /* 已处理样本总数 */
+    uint32_t speech_start;      /* 语音起点（样本序号，含预留）*/
+    uint32_t speech_end;        /* 最后一个语音帧结束位置（样本序号，含挂起）*/
+} voice_vad_t;
+
+/* VAD接口 */
+void voice_vad_init(voice_vad_t *vad, uint32_t sample_rate, uint32_t threshold, uint32_t silence_ms);
+vad_result_t voice_vad_process(voice_vad_t *vad, const int16_t *samples, uint32_t count);
+rt_bool_t voice_vad_has_speech(const voice_vad_t *vad);
+
+/* 语音区间（样本序号），用于裁剪前导和尾部静音 */
+uint32_t voice_vad_speech_start(const voice_vad_t *vad);
+uint32_t voice_vad_speech_end(const voice_vad_t *vad);
+
+/* 离线测试：对WAV（16bit单声道）/PCM文件运行VAD，返回采样率，打开失败返回负数 */
+int voice_vad_file(voice_vad_t *vad, const char *path, uint32_t threshold);
+
+#endif /* __VOICE_VAD_H__ */
@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-20     AI Assistant first version - VAD fixture test
+ */
+
+/*
+ * VAD离线测试：生成语音起止位置已知的WAV文件（16kHz单声道），用与 vad_file 相同的 voice_vad_file 处理，
+ * 检查语音区间和结束位置都落在预期的帧上，底噪估计与背景的平均绝对幅度相差不超过1/4：
+ *   起点 = 第一段语音开始 - VAD_PREROLL_MS（连续 VAD_ONSET_FRAMES 帧语音后回溯到第一帧）
+ *   终点 = 最后一段语音结束 + VAD_HANGOVER_FRAMES 帧（挂起期计入语音）
+ *   结束 = 最后一段语音结束 + VOICE_SILENCE_DURATION（静音帧数达到设定值时停止处理）
+ * 语音为140Hz基频加谐波、按4Hz音节起伏的浊音，起止对齐到帧边界，两端各有5ms渐变。
+ *   quiet    低底噪中的一段语音
+ *   pause    两段语音间停顿400ms（长于挂起期、短于结束时长），仍为一句话
+ *   noisy    白噪声高于配置门限（过零率超出语音范围），底噪跟踪后门限升高，语音仍被检出
+ *   hum      50Hz工频干扰高于配置门限（过零率低于语音范围），不误判为语音。
+ *            只有工频没有宽带噪声：噪声会在工频的过零点附近产生多次过零，设备端由前端高通先去掉工频
+ *   rising   低通噪声（过零率在语音范围内）在1秒内从无升到配置门限的3倍，门限跟着底噪升高，不误判为语音
+ *   silence  只有白噪声，不应检测到语音
+ *   format   立体声、8bit、浮点、fmt块短于16字节、没有fmt块的WAV都返回-RT_EINVAL
+ *
+ * 设备端：vad_bench [目录]（默认 /sdcard/vad_bench，生成的WAV留在目录中，可以再用 vad_file 查看）
+ * PC端（与设备端同一份voice_vad.c）：
+ *   gcc -O2 -DVOICE_VAD_BENCH_MAIN -I../host -I. voice_vad.c voice_vad_bench.c -lm -o vad_bench
+ *   ./vad_bench /tmp/vad_bench
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "voice_vad.h"
+#include "voice_assistant_config.h"
+
+#define VAD_BENCH_RATE          VOICE_SAMPLE_RATE
+#define VAD_BENCH_F0            140     /* 基频（Hz）*/
+#define VAD_BENCH_HARMONICS     6
+#define VAD_BENCH_PEAK          6000    /* 语音峰值 */
+#define VAD_BENCH_RAMP_MS       5
+#define VAD_BENCH_SEGMENTS      2
+#define VAD_BENCH_PI            3.14159265358979f
+
+#define VAD_BENCH_MS(ms)        ((uint32_t)(ms) * VAD_BENCH_RATE / 1000)
+
+typedef struct {
+    const char *name;
+    uint32_t noise;         /* 白噪声的平均绝对幅度 */
+    uint32_t hum;           /* 50Hz工频干扰的平均绝对幅度 */
+    rt_bool_t lowpass;      /* 噪声经过一阶低通（约250Hz），过零率落在语音范围内 */
+    uint32_t fade_ms;       /* 背景在开头这段时间内从0线性升到设定值 */
+    uint32_t total_ms;
+    uint32_t segments[VAD_BENCH_SEGMENTS][2];   /* 语音段起止（毫秒，帧对齐），{0, 0}为不使用 */
+} vad_bench_case_t;
+
+static const vad_bench_case_t vad_bench_cases[] = {
+    { "quiet",   20,  0,   RT_FALSE, 0,    3000, { { 500, 1300 }, { 0, 0 } } },
+    { "pause",   20,  0,   RT_FALSE, 0,    3500, { { 500, 900 }, { 1300, 1700 } } },
+    { "noisy",   250, 0,   RT_FALSE, 0,    3000, { { 800, 1600 }, { 0, 0 } } },
+    { "hum",     0,   300, RT_FALSE, 0,    3000, { { 800, 1600 }, { 0, 0 } } },
+    { "rising",  300, 0,   RT_TRUE,  1000, 3500, { { 1500, 2300 }, { 0, 0 } } },
+    { "silence", 250, 0,   RT_FALSE, 0,    2000, { { 0, 0 }, { 0, 0 } } },
+};
+
+/* 第n个样本的语音包络（0~1），不在语音段内为0 */
+static float vad_bench_envelope(const vad_bench_case_t *c, uint32_t n)
+{
+    uint32_t ramp = VAD_BENCH_MS(VAD_BENCH_RAMP_MS);
+
+    for (int i = 0; i < VAD_BENCH_SEGMENTS; i++)
+    {
+        uint32_t start = VAD_BENCH_MS(c->segments[i][0]);
+        uint32_t end = VAD_BENCH_MS(c->segments[i][1]);
+        float env;
+
+        if (n < start || n >= end)
+        {
+            continue;
+        }
+
+        /* 4Hz音节起伏：0.7~1.0 */
+        env = 0.85f + 0.15f * cosf(2 * VAD_BENCH_PI * 4 * (n - start) / VAD_BENCH_RATE);
+        if (n - start < ramp)
+        {
+            env = env * (n - start + 1) / ramp;
+        }
+        if (end - n < ramp)
+        {
+            env = env * (end - n) / ramp;
+        }
+        return env;
+    }
+
+    return 0;
+}
+
+/* 噪声发生器状态 */
+typedef struct {
+    uint32_t seed;
+    float lowpass;
+} vad_bench_noise_t;
+
+static int16_t vad_bench_sample(const vad_bench_case_t *c, uint32_t n, vad_bench_noise_t *noise)
+{
+    float value = 0;
+    float env = vad_bench_envelope(c, n);
+    float white, level = 1;
+
+    if (env > 0)
+    {
+        float voiced = 0;
+        for (int k = 1; k <= VAD_BENCH_HARMONICS; k++)
+        {
+            voiced += sinf(2 * VAD_BENCH_PI * VAD_BENCH_F0 * k * n / VAD_BENCH_RATE) / k;
+        }
+        value += VAD_BENCH_PEAK / 2.0f * env * voiced;
+    }
+
+    if (n < VAD_BENCH_MS(c->fade_ms))
+    {
+        level = (float)n / VAD_BENCH_MS(c->fade_ms);
+    }
+
+    /* 均匀分布[-2A, 2A]的平均绝对值为A；一阶低通(0.9)后标准差约为原来的0.23；正弦幅度P的平均绝对值为2P/π */
+    noise->seed = noise->seed * 1103515245 + 12345;
+    white = (float)c->noise * 4 * ((float)(noise->seed >> 16 & 0x7FFF) / 32767 - 0.5f);
+    if (c->lowpass)
+    {
+        noise->lowpass = noise->lowpass * 0.9f + white * 0.1f;
+        white = noise->lowpass / 0.23f;
+    }
+    value += level * white;
+    value += level * c->hum * VAD_BENCH_PI / 2 * sinf(2 * VAD_BENCH_PI * 50 * n / VAD_BENCH_RATE);
+
+    if (value > 32767)
+    {
+        value = 32767;
+    }
+    if (value < -32768)
+    {
+        value = -32768;
+    }
+    return (int16_t)value;
+}
+
+static void vad_bench_le32(uint8_t *p, uint32_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+/* 生成一个测试用例的WAV文件 */
+static rt_err_t vad_bench_write(const vad_bench_case_t *c, const char *path)
+{
+    uint32_t total = VAD_BENCH_MS(c->total_ms);
+    vad_bench_noise_t noise = { 1, 0 };
+    uint8_t header[44];
+    int16_t chunk[256];
+    uint32_t n = 0;
+    int fd;
+
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0)
+    {
+        return -RT_EIO;
+    }
+
+    memcpy(header, "RIFF\0\0\0\0WAVEfmt \x10\0\0\0\x01\0\x01\0\0\0\0\0\0\0\0\0\x02\0\x10\0data", 40);
+    vad_bench_le32(header + 4, 36 + total * 2);
+    vad_bench_le32(header + 24, VAD_BENCH_RATE);
+    vad_bench_le32(header + 28, VAD_BENCH_RATE * 2);
+    vad_bench_le32(header + 40, total * 2);
+    if (write(fd, header, sizeof(header)) != sizeof(header))
+    {
+        close(fd);
+        return -RT_EIO;
+    }
+
+    while (n < total)
+    {
+        uint32_t count = total - n < 256 ? total - n : 256;
+
+        for (uint32_t i = 0; i < count; i++, n++)
+        {
+            chunk[i] = vad_bench_sample(c, n, &noise);
+        }
+        if (write(fd, chunk, count * 2) != (int)(count * 2))
+        {
+            close(fd);
+            return -RT_EIO;
+        }
+    }
+
+    close(fd);
+    return RT_EOK;
+}
+
+static rt_bool_t vad_bench_case(const vad_bench_case_t *c, const char *dir)
+{
+    char path[128];
+    voice_vad_t vad;
+    uint32_t first = c->segments[0][0];
+    uint32_t last = 0;
+    uint32_t end_ms = VOICE_SILENCE_DURATION / VAD_FRAME_MS * VAD_FRAME_MS;
+    uint32_t expect_start, expect_end, expect_stop;
+    uint32_t background = c->noise + c->hum;
+    rt_bool_t floor_ok;
+    int rate;
+    rt_bool_t ok;
+
+    for (int i = 0; i < VAD_BENCH_SEGMENTS; i++)
+    {
+        if (c->segments[i][1] > last)
+        {
+            last = c->segments[i][1];
+        }
+    }
+    if (end_ms < VAD_HANGOVER_FRAMES * VAD_FRAME_MS)
+    {
+        end_ms = VAD_HANGOVER_FRAMES * VAD_FRAME_MS;
+    }
+
+    rt_snprintf(path, sizeof(path), "%s/%s.wav", dir, c->name);
+    if (vad_bench_write(c, path) != RT_EOK)
+    {
+        rt_kprintf("%-8s failed to write %s\n", c->name, path);
+        return RT_FALSE;
+    }
+
+    rate = voice_vad_file(&vad, path, VOICE_SILENCE_THRESHOLD);
+    if (rate != VAD_BENCH_RATE)
+    {
+        rt_kprintf("%-8s failed to read %s (%d)\n", c->name, path, rate);
+        return RT_FALSE;
+    }
+
+    floor_ok = vad.noise_floor * 4 >= background * 3 && vad.noise_floor * 4 <= background * 5;
+
+    if (last == 0)
+    {
+        ok = !voice_vad_has_speech(&vad) && vad.samples == VAD_BENCH_MS(c->total_ms) && floor_ok;
+        rt_kprintf("%-8s %s in %d ms, noise floor %d (background %d)  %s\n", c->name,
+                   voice_vad_has_speech(&vad) ? "speech detected" : "no speech",
+                   vad.samples * 1000 / VAD_BENCH_RATE, vad.noise_floor, background, ok ? "ok" : "FAIL");
+        return ok;
+    }
+
+    expect_start = first > VAD_PREROLL_MS ? first - VAD_PREROLL_MS : 0;
+    expect_end = last + VAD_HANGOVER_FRAMES * VAD_FRAME_MS;
+    expect_stop = last + end_ms;
+
+    ok = vad.state == VAD_END &&
+         voice_vad_speech_start(&vad) == VAD_BENCH_MS(expect_start) &&
+         voice_vad_speech_end(&vad) == VAD_BENCH_MS(expect_end) &&
+         vad.samples == VAD_BENCH_MS(expect_stop) && floor_ok;
+    rt_kprintf("%-8s speech %d-%d ms (expect %d-%d), ended at %d ms (expect %d), noise floor %d (background %d)  %s\n",
+               c->name, voice_vad_speech_start(&vad) * 1000 / VAD_BENCH_RATE,
+               voice_vad_speech_end(&vad) * 1000 / VAD_BENCH_RATE, expect_start, expect_end,
+               vad.state == VAD_END ? vad.samples * 1000 / VAD_BENCH_RATE : 0, expect_stop,
+               vad.noise_floor, background, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+/* 不支持的WAV头：voice_vad_file必须拒绝，不能按16bit单声道处理 */
+static const struct
+{
+    const char *name;
+    uint32_t fmt_size;      /* 0表示没有fmt块 */
+    uint16_t format;
+    uint16_t channels;
+    uint16_t bits;
+} vad_bench_formats[] =
+{
+    { "stereo",    16, 1, 2, 16 },
+    { "8-bit",     16, 1, 1, 8  },
+    { "float",     16, 3, 1, 32 },
+    { "short fmt", 14, 1, 1, 16 },
+    { "no fmt",    0,  1, 1, 16 },
+};
+
+static rt_bool_t vad_bench_reject(const char *dir)
+{
+    char path[128];
+    voice_vad_t vad;
+    rt_bool_t ok = RT_TRUE;
+
+    rt_snprintf(path, sizeof(path), "%s/format.wav", dir);
+    rt_kprintf("format  ");
+
+    for (uint32_t i = 0; i < sizeof(vad_bench_formats) / sizeof(vad_bench_formats[0]); i++)
+    {
+        uint8_t wav[12 + 8 + 16 + 8 + 64];
+        uint32_t len = 12;
+        int fd, rate;
+
+        memset(wav, 0, sizeof(wav));
+        memcpy(wav, "RIFFxxxxWAVE", 12);
+        if (vad_bench_formats[i].fmt_size)
+        {
+            memcpy(wav + len, "fmt ", 4);
+            vad_bench_le32(wav + len + 4, vad_bench_formats[i].fmt_size);
+            wav[len + 8] = (uint8_t)vad_bench_formats[i].format;
+            wav[len + 10] = (uint8_t)vad_bench_formats[i].channels;
+            vad_bench_le32(wav + len + 12, VAD_BENCH_RATE);
+            if (vad_bench_formats[i].fmt_size >= 16)
+            {
+                wav[len + 22] = (uint8_t)vad_bench_formats[i].bits;
+            }
+            len += 8 + vad_bench_formats[i].fmt_size;
+        }
+        memcpy(wav + len, "data", 4);
+        vad_bench_le32(wav + len + 4, 64);
+        len += 8 + 64;
+        vad_bench_le32(wav + 4, len - 8);
+
+        fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+        if (fd < 0 || write(fd, wav, len) != (int)len)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+            rt_kprintf(" failed to write %s  FAIL\n", path);
+            return RT_FALSE;
+        }
+        close(fd);
+
+        rate = voice_vad_file(&vad, path, VOICE_SILENCE_THRESHOLD);
+        rt_kprintf(" %s %s", vad_bench_formats[i].name, rate == -RT_EINVAL ? "rejected" : "ACCEPTED");
+        ok = ok && rate == -RT_EINVAL;
+    }
+
+    rt_kprintf("  %s\n", ok ? "ok" : "FAIL");
+    return ok;
+}
+
+static int vad_bench(const char *dir)
+{
+    rt_bool_t ok = RT_TRUE;
+
+    mkdir(dir, 0777);
+    rt_kprintf("VAD: %d ms frames, onset %d frames, hangover %d frames, pre-roll %d ms, end after %d ms, threshold %d\n",
+               VAD_FRAME_MS, VAD_ONSET_FRAMES, VAD_HANGOVER_FRAMES, VAD_PREROLL_MS,
+               VOICE_SILENCE_DURATION, VOICE_SILENCE_THRESHOLD);
+
+    for (uint32_t i = 0; i < sizeof(vad_bench_cases) / sizeof(vad_bench_cases[0]); i++)
+    {
+        ok = vad_bench_case(&vad_bench_cases[i], dir) && ok;
+    }
+    ok = vad_bench_reject(dir) && ok;
+
+    rt_kprintf("Result: %s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : -1;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+#include <finsh.h>
+
+static int cmd_vad_bench(int argc, char **argv)
+{
+    return vad_bench(argc > 1 ? argv[1] : "/sdcard/vad_bench");
+}
+MSH_CMD_EXPORT_ALIAS(cmd_vad_bench, vad_bench, VAD fixture test: vad_bench [dir]);
+#endif
+
+#ifdef VOICE_VAD_BENCH_MAIN
+int main(int argc, char **argv)
+{
+    return vad_bench(argc > 1 ? argv[1] : "/tmp/vad_bench") == 0 ? 0 : 1;
+}
+#endif
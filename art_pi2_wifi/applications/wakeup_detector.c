@@ -6,13 +6,21 @@
  * Change Logs:
  * Date           Author       Notes
  * 2024-10-17     AI Assistant first version - Wakeup Word Detector Implementation
+ * 2024-10-27     AI Assistant Read microphone through the capture hub
+ * 2024-10-27     AI Assistant Report wake word end position for recording pre-roll
  */
 
 #include <rtthread.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
 #include "wakeup_detector.h"
-#include "audio_capture.h"
+#include "audio_hub.h"
 #include "ai_cloud_service.h"
+#include "voice_assistant_config.h"
+#include "kws.h"
+#include "memory_helper.h"
 
 #define DBG_TAG "wakeup"
 #define DBG_LVL DBG_INFO
@@ -26,12 +34,33 @@ static struct {
     rt_bool_t running;
     rt_thread_t detector_thread;
     wakeup_callback callback;
+    audio_hub_sub_t mic;        /* 与录音线程共用采集，各读各的 */
+    uint32_t wake_pos;          /* 唤醒词结束处的采集样本序号 */
+#if KWS_ENABLE
+    kws_engine_t *kws;          /* 本地识别引擎，为空时使用云端识别 */
+    uint8_t *kws_model;
+#endif
 } wakeup_ctrl = {
     .running = RT_FALSE,
     .detector_thread = RT_NULL,
     .callback = RT_NULL
 };
 
+/* 检测到唤醒词，pos为唤醒词结束处的采集样本序号 */
+static void wakeup_detector_fire(uint32_t pos)
+{
+    wakeup_ctrl.wake_pos = pos;
+    
+    LOG_I("=== Wakeup word detected! ===");
+    rt_kprintf("\n[Wakeup] 检测到唤醒词: %s\n", wakeup_ctrl.wakeup_word);
+
+    /* 触发回调 */
+    if (wakeup_ctrl.callback)
+    {
+        wakeup_ctrl.callback();
+    }
+}
+
 /* 简单的文本匹配检测 */
 rt_bool_t wakeup_detector_check_text(const char *text, const char *wakeup_word)
 {
@@ -104,26 +133,113 @@ rt_bool_t wakeup_detector_check_text(const char *text, const char *wakeup_word)
     return RT_FALSE;
 }
 
-/* 唤醒词检测线程 */
-static void wakeup_detector_thread_entry(void *parameter)
+#if KWS_ENABLE
+/* 从SD卡加载本地唤醒词模型 */
+static rt_bool_t wakeup_kws_load(void)
+{
+    struct stat st;
+    int fd;
+
+    if (wakeup_ctrl.kws != RT_NULL)
+    {
+        return RT_TRUE;
+    }
+
+    if (stat(VOICE_KWS_MODEL_PATH, &st) != 0 || st.st_size <= 0)
+    {
+        LOG_W("No KWS model at %s, using cloud detection", VOICE_KWS_MODEL_PATH);
+        return RT_FALSE;
+    }
+
+    /* 每20ms推理一次都要读模型权重和引擎状态，放在SRAM */
+    wakeup_ctrl.kws_model = (uint8_t *)mem_class_alloc(MEM_CLASS_FAST, st.st_size);
+    wakeup_ctrl.kws = (kws_engine_t *)mem_class_alloc(MEM_CLASS_FAST, sizeof(kws_engine_t));
+    if (wakeup_ctrl.kws_model == RT_NULL || wakeup_ctrl.kws == RT_NULL)
+    {
+        LOG_E("Failed to allocate KWS engine");
+        goto _fail;
+    }
+
+    fd = open(VOICE_KWS_MODEL_PATH, O_RDONLY);
+    if (fd < 0)
+    {
+        goto _fail;
+    }
+    if (read(fd, wakeup_ctrl.kws_model, st.st_size) != st.st_size)
+    {
+        close(fd);
+        goto _fail;
+    }
+    close(fd);
+
+    if (kws_engine_init(wakeup_ctrl.kws, wakeup_ctrl.kws_model, st.st_size) != 0)
+    {
+        LOG_E("Invalid KWS model %s", VOICE_KWS_MODEL_PATH);
+        goto _fail;
+    }
+
+    LOG_I("KWS model loaded: %d classes, wakeup class '%s'",
+          wakeup_ctrl.kws->model.num_classes,
+          wakeup_ctrl.kws->model.labels[wakeup_ctrl.kws->model.wakeup_index]);
+    return RT_TRUE;
+
+_fail:
+    if (wakeup_ctrl.kws_model)
+    {
+        mem_class_free(wakeup_ctrl.kws_model);
+        wakeup_ctrl.kws_model = RT_NULL;
+    }
+    if (wakeup_ctrl.kws)
+    {
+        mem_class_free(wakeup_ctrl.kws);
+        wakeup_ctrl.kws = RT_NULL;
+    }
+    return RT_FALSE;
+}
+
+/* 本地识别：每20ms送入一帧，由引擎做滑动窗口推理和后验平滑 */
+static void wakeup_detector_local_loop(void)
+{
+    const int16_t *samples;
+    int count;
+
+    kws_engine_reset(wakeup_ctrl.kws);
+
+    while (wakeup_ctrl.running)
+    {
+        /* 直接在采集环形缓冲区上推理，不复制 */
+        count = audio_hub_peek(&wakeup_ctrl.mic, &samples, 500);
+        if (count <= 0)
+        {
+            continue;
+        }
+
+        if (kws_engine_process(wakeup_ctrl.kws, samples, count) >= 0)
+        {
+            /* 后验在送入的这段数据末尾越过门限 */
+            wakeup_detector_fire(wakeup_ctrl.mic.cursor + count);
+        }
+        audio_hub_consume(&wakeup_ctrl.mic, count);
+    }
+}
+#endif
+
+/* 云端识别：每2秒录音上传识别，在结果中查找唤醒词 */
+static void wakeup_detector_cloud_loop(void)
 {
     uint8_t *audio_buffer = RT_NULL;
     ai_response_t ai_response;
+    uint32_t window_end;
     int ret;
-    
-    LOG_I("Wakeup detector thread started, listening for: %s", wakeup_ctrl.wakeup_word);
-    
+
     /* 分配音频缓冲区 */
-    audio_buffer = (uint8_t *)rt_malloc(WAKEUP_BUFFER_SIZE);
+    audio_buffer = (uint8_t *)mem_class_alloc(MEM_CLASS_BULK, WAKEUP_BUFFER_SIZE);
     if (audio_buffer == RT_NULL)
     {
         LOG_E("Failed to allocate wakeup buffer");
         return;
     }
-    
-    /* 开始音频采集 */
-    audio_capture_start();
-    
+
     while (wakeup_ctrl.running)
     {
         /* 读取2秒音频数据进行检测 */
@@ -132,9 +248,9 @@ static void wakeup_detector_thread_entry(void *parameter)
         
         while (total_read < WAKEUP_BUFFER_SIZE && wakeup_ctrl.running)
         {
-            int read_size = audio_capture_read(audio_buffer + total_read,
-                                                WAKEUP_BUFFER_SIZE - total_read,
-                                                500);
+            int read_size = audio_hub_read(&wakeup_ctrl.mic, audio_buffer + total_read,
+                                           WAKEUP_BUFFER_SIZE - total_read,
+                                           500);
             if (read_size > 0)
             {
                 total_read += read_size;
@@ -151,6 +267,9 @@ static void wakeup_detector_thread_entry(void *parameter)
             continue;
         }
         
+        /* 唤醒词在这段录音中，上传识别期间说的话仍在采集历史里 */
+        window_end = wakeup_ctrl.mic.cursor;
+        
         /* 发送到AI进行识别 */
         rt_memset(&ai_response, 0, sizeof(ai_response_t));
         ret = ai_cloud_service_speech_to_text(audio_buffer, total_read, &ai_response);
@@ -162,14 +281,7 @@ static void wakeup_detector_thread_entry(void *parameter)
             /* 检查是否包含唤醒词 */
             if (wakeup_detector_check_text(ai_response.text_result, wakeup_ctrl.wakeup_word))
             {
-                LOG_I("=== Wakeup word detected! ===");
-                rt_kprintf("\n[Wakeup] 检测到唤醒词: %s\n", wakeup_ctrl.wakeup_word);
-                
-                /* 触发回调 */
-                if (wakeup_ctrl.callback)
-                {
-                    wakeup_ctrl.callback();
-                }
+                wakeup_detector_fire(window_end);
             }
         }
         
@@ -179,8 +291,34 @@ static void wakeup_detector_thread_entry(void *parameter)
         rt_thread_mdelay(500);
     }
     
-    audio_capture_stop();
-    rt_free(audio_buffer);
+    mem_class_free(audio_buffer);
+}
+
+/* 唤醒词检测线程 */
+static void wakeup_detector_thread_entry(void *parameter)
+{
+    LOG_I("Wakeup detector thread started, listening for: %s", wakeup_ctrl.wakeup_word);
+    
+    /* 订阅麦克风，录音线程可以同时订阅 */
+    if (audio_hub_subscribe(&wakeup_ctrl.mic, "wakeup") != RT_EOK)
+    {
+        LOG_E("Failed to subscribe to microphone");
+        wakeup_ctrl.running = RT_FALSE;
+        return;
+    }
+    
+#if KWS_ENABLE
+    if (wakeup_kws_load())
+    {
+        wakeup_detector_local_loop();
+    }
+    else
+#endif
+    {
+        wakeup_detector_cloud_loop();
+    }
+    
+    audio_hub_unsubscribe(&wakeup_ctrl.mic);
     
     LOG_I("Wakeup detector thread stopped");
 }
@@ -259,6 +397,12 @@ int wakeup_detector_set_callback(wakeup_callback callback)
     return RT_EOK;
 }
 
+/* 最近一次唤醒词结束处的采集样本序号 */
+uint32_t wakeup_detector_wake_position(void)
+{
+    return wakeup_ctrl.wake_pos;
+}
+
 /* 导出MSH命令 */
 #ifdef FINSH_USING_MSH
 static int cmd_wakeup_start(int argc, char **argv)
@@ -280,5 +424,29 @@ static int cmd_wakeup_stop(int argc, char **argv)
     return wakeup_detector_stop();
 }
 MSH_CMD_EXPORT_ALIAS(cmd_wakeup_stop, wakeup_stop, Stop wakeup detection);
+
+static int cmd_wakeup_status(int argc, char **argv)
+{
+    rt_kprintf("Wakeup detector: %s\n", wakeup_ctrl.running ? "running" : "stopped");
+#if KWS_ENABLE
+    if (wakeup_ctrl.kws != RT_NULL)
+    {
+        kws_engine_t *kws = wakeup_ctrl.kws;
+
+        rt_kprintf("Mode: local KWS (%s)\n", VOICE_KWS_MODEL_PATH);
+        rt_kprintf("Frames: %d, inferences: %d, detections: %d\n",
+                   kws->frames, kws->inferences, kws->detections);
+        for (int i = 0; i < kws->model.num_classes; i++)
+        {
+            rt_kprintf("  %-12s %3d/127%s\n", kws->model.labels[i], kws->smoothed[i],
+                       i == kws->model.wakeup_index ? " (wakeup)" : "");
+        }
+        return 0;
+    }
+#endif
+    rt_kprintf("Mode: cloud STT polling\n");
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_wakeup_status, wakeup_status, Show wakeup detection status);
 #endif
 
@@ -22,6 +22,9 @@ int wakeup_detector_start(void);
 int wakeup_detector_stop(void);
 int wakeup_detector_set_callback(wakeup_callback callback);
 
+/* 最近一次唤醒词结束处的采集样本序号（audio_hub_position），在回调中调用 */
+uint32_t wakeup_detector_wake_position(void);
+
 /* 简单的文本匹配检测（用于识别结果中查找唤醒词）*/
 rt_bool_t wakeup_detector_check_text(const char *text, const char *wakeup_word);
 
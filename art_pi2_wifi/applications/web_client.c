@@ -6,6 +6,7 @@
  * Change Logs:
  * Date           Author       Notes
  * 2024-10-16     AI Assistant first version - Web Client Implementation
+ * 2024-10-27     AI Assistant Keep-alive connection pool, one request path for all methods
  */
 
 #include <rtthread.h>
@@ -15,14 +16,21 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <errno.h>
 #include "web_client.h"
+#include "web_dns.h"
+#include "web_http_parser.h"
+#include "ai_arena.h"
+#include "ai_trace.h"
 
 #define DBG_TAG "web.client"
 #define DBG_LVL DBG_INFO
 #include <rtdbg.h>
 
 #define HTTP_BUFFER_SIZE    (1024)
-#define HTTP_RESPONSE_MAX   (16 * 1024)  /* 16KB最大响应（极限优化）*/
+#define HTTP_RESPONSE_MAX   (256 * 1024) /* 缓冲式响应体上限，按实际长度分配，更大的响应使用流式接口 */
+#define HTTP_RECV_BUFFER_SIZE (2 * 1024) /* 接收块大小，响应头和响应体都经过它交给解析器 */
+#define HTTP_REQUEST_HEADER_MAX (1024)   /* 请求头上限（含自定义Header）*/
 
 /* 解析URL */
 static int parse_url(const char *url, char *host, int *port, char *path)
@@ -77,43 +85,25 @@ static int parse_url(const char *url, char *host, int *port, char *path)
     return RT_EOK;
 }
 
-/* HTTP GET请求 */
-int web_client_get(const char *url, http_response_t *response)
+/* 建立TCP连接 */
+static int web_client_connect(const char *host, int port, int timeout_s)
 {
     int sock = -1;
-    struct hostent *host_entry;
+    int nodelay = 1;
+    int ret;
+    uint32_t addr;
     struct sockaddr_in server_addr;
-    char host[128] = {0};
-    char path[256] = {0};
-    char request[512] = {0};
-    char *recv_buffer = RT_NULL;
-    int port = 80;
-    int ret = -RT_ERROR;
-    int recv_len = 0;
-    int total_len = 0;
     
-    if (url == RT_NULL || response == RT_NULL)
-    {
-        return -RT_EINVAL;
-    }
-    
-    rt_memset(response, 0, sizeof(http_response_t));
+    LOG_D("Connecting to %s:%d", host, port);
     
-    /* 解析URL */
-    if (parse_url(url, host, &port, path) != RT_EOK)
-    {
-        LOG_E("Failed to parse URL: %s", url);
-        return -RT_ERROR;
-    }
-    
-    LOG_D("Connecting to %s:%d%s", host, port, path);
-    
-    /* 域名解析 */
-    host_entry = gethostbyname(host);
-    if (host_entry == RT_NULL)
+    /* 域名解析（带缓存）*/
+    AI_TRACE_BEGIN("http dns");
+    ret = web_dns_resolve(host, &addr);
+    AI_TRACE_END("http dns", ret == RT_EOK);
+    if (ret != RT_EOK)
     {
         LOG_E("Failed to resolve host: %s", host);
-        return -RT_ERROR;
+        return -1;
     }
     
     /* 创建socket */
@@ -121,278 +111,703 @@ int web_client_get(const char *url, http_response_t *response)
     if (sock < 0)
     {
         LOG_E("Failed to create socket");
-        return -RT_ERROR;
+        return -1;
     }
     
     /* 设置超时 */
-    struct timeval timeout = {10, 0};
+    struct timeval timeout = {timeout_s, 0};
     setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
     setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
     
+    /* 请求头和请求体分开发送，关闭Nagle避免请求体等待对端的延迟ACK */
+    setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+    
     /* 连接服务器 */
     server_addr.sin_family = AF_INET;
     server_addr.sin_port = htons(port);
-    server_addr.sin_addr = *((struct in_addr *)host_entry->h_addr);
+    server_addr.sin_addr.s_addr = addr;
     rt_memset(&(server_addr.sin_zero), 0, sizeof(server_addr.sin_zero));
     
-    if (connect(sock, (struct sockaddr *)&server_addr, sizeof(struct sockaddr)) < 0)
+    AI_TRACE_BEGIN("http connect");
+    ret = connect(sock, (struct sockaddr *)&server_addr, sizeof(struct sockaddr));
+    AI_TRACE_END("http connect", ret == 0);
+    if (ret < 0)
     {
         LOG_E("Failed to connect to server");
         closesocket(sock);
-        return -RT_ERROR;
+        /* 地址可能已变更，下次重新解析 */
+        web_dns_invalidate(host);
+        return -1;
+    }
+    
+    return sock;
+}
+
+/* ==================== 连接池 ==================== */
+
+/* 池中的空闲连接，取出使用期间由调用者独占 */
+typedef struct {
+    int sock;                 /* -1 表示空位 */
+    int port;
+    char host[WEB_CLIENT_HOST_MAX];
+    rt_tick_t last_used;
+} web_client_conn_t;
+
+static struct {
+    struct rt_mutex lock;
+    rt_bool_t lock_ready;
+    web_client_conn_t conns[WEB_CLIENT_POOL_SIZE];
+    web_client_pool_stats_t stats;
+} web_client_pool;
+
+static void web_client_pool_lock(void)
+{
+    if (!web_client_pool.lock_ready)
+    {
+        rt_enter_critical();
+        if (!web_client_pool.lock_ready)
+        {
+            int i;
+            for (i = 0; i < WEB_CLIENT_POOL_SIZE; i++)
+            {
+                web_client_pool.conns[i].sock = -1;
+            }
+            rt_mutex_init(&web_client_pool.lock, "web_pool", RT_IPC_FLAG_PRIO);
+            web_client_pool.lock_ready = RT_TRUE;
+        }
+        rt_exit_critical();
     }
     
-    /* 构造HTTP GET请求 */
-    rt_snprintf(request, sizeof(request),
-                "GET %s HTTP/1.1\r\n"
-                "Host: %s\r\n"
-                "User-Agent: RT-Thread\r\n"
-                "Connection: close\r\n"
-                "\r\n",
-                path, host);
+    rt_mutex_take(&web_client_pool.lock, RT_WAITING_FOREVER);
+}
+
+static void web_client_pool_unlock(void)
+{
+    rt_mutex_release(&web_client_pool.lock);
+}
+
+/* 关闭池中的连接（需持有锁）*/
+static void web_client_pool_drop(web_client_conn_t *conn)
+{
+    closesocket(conn->sock);
+    conn->sock = -1;
+    web_client_pool.stats.idle--;
+}
+
+/* 关闭空闲超时的连接（需持有锁），服务器通常在几十秒后关闭空闲连接 */
+static void web_client_pool_evict_idle(void)
+{
+    rt_tick_t now = rt_tick_get();
+    int i;
     
-    /* 发送请求 */
-    if (send(sock, request, strlen(request), 0) < 0)
+    for (i = 0; i < WEB_CLIENT_POOL_SIZE; i++)
     {
-        LOG_E("Failed to send request");
-        closesocket(sock);
-        return -RT_ERROR;
+        web_client_conn_t *conn = &web_client_pool.conns[i];
+        if (conn->sock >= 0 &&
+            now - conn->last_used >= rt_tick_from_millisecond(WEB_CLIENT_IDLE_TIMEOUT_MS))
+        {
+            web_client_pool_drop(conn);
+            web_client_pool.stats.evicted++;
+        }
     }
+}
+
+/* 空闲连接是否仍可用：对端已关闭（FIN）或有未读数据时不再复用 */
+static rt_bool_t web_client_conn_alive(int sock)
+{
+    char c;
+    int n = recv(sock, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    
+    return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+}
+
+/* 取得到host:port的连接：优先复用池中的空闲连接，否则新建 */
+static int web_client_pool_acquire(const char *host, int port, int timeout_s, rt_bool_t *reused)
+{
+    int sock = -1;
+    int i;
     
-    /* 分配接收缓冲区 */
-    recv_buffer = (char *)rt_malloc(HTTP_RESPONSE_MAX);
-    if (recv_buffer == RT_NULL)
+    web_client_pool_lock();
+    web_client_pool.stats.requests++;
+    web_client_pool_evict_idle();
+    
+    for (i = 0; i < WEB_CLIENT_POOL_SIZE && sock < 0; i++)
     {
-        LOG_E("Failed to allocate receive buffer (%d bytes)", HTTP_RESPONSE_MAX);
-        LOG_E("Available memory insufficient. Run 'free' command to check");
-        closesocket(sock);
-        return -RT_ERROR;
+        web_client_conn_t *conn = &web_client_pool.conns[i];
+        if (conn->sock < 0 || conn->port != port || strcmp(conn->host, host) != 0)
+        {
+            continue;
+        }
+        
+        if (web_client_conn_alive(conn->sock))
+        {
+            sock = conn->sock;
+            conn->sock = -1;
+            web_client_pool.stats.idle--;
+            web_client_pool.stats.reused++;
+        }
+        else
+        {
+            web_client_pool_drop(conn);
+            web_client_pool.stats.stale++;
+        }
     }
+    web_client_pool_unlock();
     
-    LOG_D("Allocated %d bytes for HTTP response", HTTP_RESPONSE_MAX);
+    if (sock >= 0)
+    {
+        struct timeval timeout = {timeout_s, 0};
+        setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        *reused = RT_TRUE;
+        LOG_D("Reusing connection to %s:%d", host, port);
+        return sock;
+    }
     
-    /* 接收响应 */
-    while ((recv_len = recv(sock, recv_buffer + total_len, HTTP_RESPONSE_MAX - total_len - 1, 0)) > 0)
+    *reused = RT_FALSE;
+    sock = web_client_connect(host, port, timeout_s);
+    if (sock >= 0)
     {
-        total_len += recv_len;
-        if (total_len >= HTTP_RESPONSE_MAX - 1)
+        web_client_pool_lock();
+        web_client_pool.stats.opened++;
+        web_client_pool_unlock();
+    }
+    
+    return sock;
+}
+
+/* 归还连接：响应完整且服务器允许保持时放回池中，池满时替换最久未用的连接 */
+static void web_client_pool_release(int sock, const char *host, int port, rt_bool_t keep_alive)
+{
+    web_client_conn_t *slot = RT_NULL;
+    int i;
+    
+    if (!keep_alive)
+    {
+        closesocket(sock);
+        return;
+    }
+    
+    web_client_pool_lock();
+    for (i = 0; i < WEB_CLIENT_POOL_SIZE; i++)
+    {
+        web_client_conn_t *conn = &web_client_pool.conns[i];
+        if (conn->sock < 0)
         {
-            LOG_W("Response too large, truncated");
+            slot = conn;
             break;
         }
+        if (slot == RT_NULL || conn->last_used - slot->last_used > RT_TICK_MAX / 2)
+        {
+            slot = conn;
+        }
+    }
+    
+    if (slot->sock >= 0)
+    {
+        web_client_pool_drop(slot);
+        web_client_pool.stats.evicted++;
     }
     
-    recv_buffer[total_len] = '\0';
+    slot->sock = sock;
+    slot->port = port;
+    strncpy(slot->host, host, sizeof(slot->host) - 1);
+    slot->host[sizeof(slot->host) - 1] = '\0';
+    slot->last_used = rt_tick_get();
+    web_client_pool.stats.idle++;
+    web_client_pool_unlock();
+}
+
+/* 关闭所有空闲连接（如网络切换后）*/
+void web_client_pool_flush(void)
+{
+    int i;
     
-    if (total_len > 0)
+    web_client_pool_lock();
+    for (i = 0; i < WEB_CLIENT_POOL_SIZE; i++)
     {
-        /* 解析HTTP响应 */
-        char *status_line = recv_buffer;
-        char *header_end = strstr(recv_buffer, "\r\n\r\n");
+        if (web_client_pool.conns[i].sock >= 0)
+        {
+            web_client_pool_drop(&web_client_pool.conns[i]);
+        }
+    }
+    web_client_pool_unlock();
+}
+
+void web_client_pool_get_stats(web_client_pool_stats_t *stats)
+{
+    web_client_pool_lock();
+    rt_memcpy(stats, &web_client_pool.stats, sizeof(web_client_pool_stats_t));
+    web_client_pool_unlock();
+}
+
+/* ==================== 请求与响应 ==================== */
+
+/* 发送全部数据（处理部分发送）*/
+static int web_client_send_all(int sock, const void *data, uint32_t len, int flags)
+{
+    const char *p = (const char *)data;
+    
+    while (len > 0)
+    {
+        int sent = send(sock, p, len, flags);
+        if (sent <= 0)
+        {
+            return -RT_ERROR;
+        }
+        p += sent;
+        len -= sent;
+    }
+    
+    return RT_EOK;
+}
+
+/*
+ * 依次发送各段，除最后一段外带MSG_MORE，协议栈可以把请求头和请求体合并到同一报文段
+ * （SAL的msghdr依赖C库的struct iovec，newlib没有提供，因此不用sendmsg）
+ */
+static int web_client_send_vec(int sock, const web_client_iovec_t *vec, int count)
+{
+    int i;
+    
+    for (i = 0; i < count; i++)
+    {
+        if (web_client_send_all(sock, vec[i].data, vec[i].len, i + 1 < count ? MSG_MORE : 0) != RT_EOK)
+        {
+            return -RT_ERROR;
+        }
+    }
+    
+    return RT_EOK;
+}
+
+/* 接收响应并逐段交给解析器；响应按Content-Length或chunked收完即停，连接可以继续使用 */
+static int web_client_recv(int sock, web_http_parser_t *parser, rt_bool_t *keep_alive)
+{
+    uint8_t *buffer;
+    uint32_t total_len = 0;
+    rt_bool_t extra = RT_FALSE;
+    int recv_len;
+    int used;
+    int ret = RT_EOK;
+    
+    *keep_alive = RT_FALSE;
+    
+    buffer = (uint8_t *)ai_arena_alloc(HTTP_RECV_BUFFER_SIZE);
+    if (buffer == RT_NULL)
+    {
+        LOG_E("Failed to allocate receive buffer (%d bytes)", HTTP_RECV_BUFFER_SIZE);
+        return -RT_ENOMEM;
+    }
+    
+    /* 请求发出到响应的第一个字节是服务器的处理时间，之后是下载 */
+    AI_TRACE_BEGIN("http wait");
+    while (!web_http_parser_done(parser))
+    {
+        recv_len = recv(sock, buffer, HTTP_RECV_BUFFER_SIZE, 0);
+        if (total_len == 0)
+        {
+            AI_TRACE_END("http wait", recv_len > 0);
+            AI_TRACE_BEGIN("http download");
+        }
+        if (recv_len <= 0)
+        {
+            if (total_len == 0)
+            {
+                /* 复用的连接已被服务器关闭，调用者可以换新连接重试 */
+                ret = -RT_EEMPTY;
+            }
+            else if ((ret = web_http_parser_finish(parser)) != RT_EOK)
+            {
+                LOG_E("Response incomplete (%d body bytes received)", parser->body_len);
+            }
+            break;
+        }
+        total_len += recv_len;
         
-        if (header_end)
+        used = web_http_parser_execute(parser, buffer, recv_len);
+        if (used < 0)
         {
-            /* 提取状态码 */
-            sscanf(status_line, "HTTP/1.%*d %d", &response->status_code);
-            
-            /* 提取响应体 */
-            char *body_start = header_end + 4;
-            response->body_len = total_len - (body_start - recv_buffer);
-            response->body = (char *)rt_malloc(response->body_len + 1);
-            if (response->body)
+            if (used == -RT_ERROR)
             {
-                rt_memcpy(response->body, body_start, response->body_len);
-                response->body[response->body_len] = '\0';
+                LOG_E("Malformed HTTP response");
             }
-            
-            LOG_D("HTTP Response: status=%d, body_len=%d", 
-                  response->status_code, response->body_len);
-            
-            ret = RT_EOK;
+            ret = used;
+            break;
+        }
+        if (used < recv_len)
+        {
+            /* 响应之后多出的数据无法归属，连接不再复用 */
+            LOG_W("Unexpected %d bytes after response", recv_len - used);
+            extra = RT_TRUE;
         }
     }
     
-    rt_free(recv_buffer);
-    closesocket(sock);
+    AI_TRACE_END("http download", total_len);
+    
+    if (ret == RT_EOK)
+    {
+        *keep_alive = parser->keep_alive && !extra;
+        LOG_D("HTTP Response: status=%d, body_len=%d%s", parser->status_code, parser->body_len,
+              parser->chunked ? " (chunked)" : "");
+    }
+    
+    ai_arena_free(buffer);
     
     return ret;
 }
 
-/* HTTP POST请求 */
-int web_client_post(const char *url, const char *data, uint32_t data_len,
-                    const char *content_type, http_response_t *response)
+/* 缓冲式响应：按Content-Length一次分配，chunked或未声明长度时按需扩大 */
+typedef struct {
+    http_response_t *response;
+    uint32_t capacity;
+    int error;
+} web_client_body_buf_t;
+
+static int web_client_body_reserve(web_client_body_buf_t *buf, uint32_t size)
 {
-    int sock = -1;
-    struct hostent *host_entry;
-    struct sockaddr_in server_addr;
-    char host[128] = {0};
-    char path[256] = {0};
-    char *request = RT_NULL;
-    char *recv_buffer = RT_NULL;
-    int port = 80;
-    int ret = -RT_ERROR;
-    int recv_len = 0;
-    int total_len = 0;
+    char *body;
     
-    if (url == RT_NULL || data == RT_NULL || response == RT_NULL)
+    if (size <= buf->capacity && buf->response->body)
     {
-        return -RT_EINVAL;
+        return RT_EOK;
+    }
+    if (size > HTTP_RESPONSE_MAX)
+    {
+        LOG_E("Response too large (%d bytes, max %d), use the streaming API", size, HTTP_RESPONSE_MAX);
+        buf->error = -RT_ENOMEM;
+        return -RT_ENOMEM;
     }
     
-    rt_memset(response, 0, sizeof(http_response_t));
-    
-    /* 解析URL */
-    if (parse_url(url, host, &port, path) != RT_EOK)
+    body = (char *)ai_arena_realloc(buf->response->body, size + 1);
+    if (body == RT_NULL)
     {
-        LOG_E("Failed to parse URL: %s", url);
-        return -RT_ERROR;
+        LOG_E("Failed to allocate response body (%d bytes)", size);
+        buf->error = -RT_ENOMEM;
+        return -RT_ENOMEM;
     }
+    buf->response->body = body;
+    buf->capacity = size;
     
-    LOG_D("Connecting to %s:%d%s", host, port, path);
+    return RT_EOK;
+}
+
+static int web_client_body_headers(web_http_parser_t *parser, void *user_data)
+{
+    web_client_body_buf_t *buf = (web_client_body_buf_t *)user_data;
     
-    /* 域名解析 */
-    host_entry = gethostbyname(host);
-    if (host_entry == RT_NULL)
+    buf->response->status_code = parser->status_code;
+    if (web_client_body_reserve(buf, parser->content_len >= 0 ? parser->content_len : HTTP_BUFFER_SIZE) != RT_EOK)
     {
-        LOG_E("Failed to resolve host: %s", host);
         return -RT_ERROR;
     }
+    buf->response->body[0] = '\0';
     
-    /* 创建socket */
-    sock = socket(AF_INET, SOCK_STREAM, 0);
-    if (sock < 0)
+    return RT_EOK;
+}
+
+static int web_client_body_append(web_http_parser_t *parser, const uint8_t *data, uint32_t len,
+                                  void *user_data)
+{
+    web_client_body_buf_t *buf = (web_client_body_buf_t *)user_data;
+    http_response_t *response = buf->response;
+    uint32_t size = response->body_len + len;
+    
+    (void)parser;
+    if (size > buf->capacity)
     {
-        LOG_E("Failed to create socket");
-        return -RT_ERROR;
+        if (size < buf->capacity * 2)
+        {
+            size = buf->capacity * 2;
+        }
+        if (size > HTTP_RESPONSE_MAX && response->body_len + len <= HTTP_RESPONSE_MAX)
+        {
+            size = HTTP_RESPONSE_MAX;
+        }
+        if (web_client_body_reserve(buf, size) != RT_EOK)
+        {
+            return -RT_ERROR;
+        }
     }
     
-    /* 设置超时 */
-    struct timeval timeout = {30, 0};  /* POST请求可能需要更长时间 */
-    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
-    setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+    rt_memcpy(response->body + response->body_len, data, len);
+    response->body_len += len;
+    response->body[response->body_len] = '\0';
     
-    /* 连接服务器 */
-    server_addr.sin_family = AF_INET;
-    server_addr.sin_port = htons(port);
-    server_addr.sin_addr = *((struct in_addr *)host_entry->h_addr);
-    rt_memset(&(server_addr.sin_zero), 0, sizeof(server_addr.sin_zero));
+    return RT_EOK;
+}
+
+/* 接收响应，响应体保存到response->body（以0结尾）*/
+static int web_client_recv_response(int sock, http_response_t *response, rt_bool_t *keep_alive)
+{
+    web_http_parser_t parser;
+    web_client_body_buf_t buf = {response, 0, RT_EOK};
+    int ret;
+    
+    web_http_parser_init(&parser, web_client_body_headers, web_client_body_append, &buf);
     
-    if (connect(sock, (struct sockaddr *)&server_addr, sizeof(struct sockaddr)) < 0)
+    ret = web_client_recv(sock, &parser, keep_alive);
+    if (ret == -RT_EINTR)
     {
-        LOG_E("Failed to connect to server");
-        closesocket(sock);
-        return -RT_ERROR;
+        ret = buf.error;
     }
-    
-    /* 分配请求缓冲区 */
-    request = (char *)rt_malloc(1024 + data_len);
-    if (request == RT_NULL)
+    if (ret != RT_EOK)
     {
-        LOG_E("Failed to allocate request buffer (%d bytes)", 1024 + data_len);
-        closesocket(sock);
-        return -RT_ERROR;
+        web_client_free_response(response);
     }
     
-    /* 构造HTTP POST请求 */
-    int header_len = rt_snprintf(request, 1024,
-                                  "POST %s HTTP/1.1\r\n"
-                                  "Host: %s\r\n"
-                                  "User-Agent: RT-Thread\r\n"
-                                  "Content-Type: %s\r\n"
-                                  "Content-Length: %d\r\n"
-                                  "Connection: close\r\n"
-                                  "\r\n",
-                                  path, host, content_type ? content_type : "application/octet-stream", data_len);
+    return ret;
+}
+
+/* 流式响应：响应体片段直接从接收缓冲区交给调用者的回调 */
+typedef struct {
+    web_client_resp_stream_t *resp;
+    web_client_body_reader reader;
+    void *user_data;
+} web_client_stream_ctx_t;
+
+static int web_client_stream_headers(web_http_parser_t *parser, void *user_data)
+{
+    web_client_stream_ctx_t *ctx = (web_client_stream_ctx_t *)user_data;
     
-    /* 添加数据 */
-    rt_memcpy(request + header_len, data, data_len);
+    ctx->resp->status_code = parser->status_code;
+    ctx->resp->content_len = parser->content_len;
+    rt_memcpy(ctx->resp->content_type, parser->content_type, sizeof(ctx->resp->content_type));
+    ctx->resp->content_type[sizeof(ctx->resp->content_type) - 1] = '\0';
     
-    /* 发送请求 */
-    if (send(sock, request, header_len + data_len, 0) < 0)
+    return RT_EOK;
+}
+
+static int web_client_stream_body(web_http_parser_t *parser, const uint8_t *data, uint32_t len,
+                                  void *user_data)
+{
+    web_client_stream_ctx_t *ctx = (web_client_stream_ctx_t *)user_data;
+    
+    ctx->resp->body_len = parser->body_len;
+    return ctx->reader(ctx->resp, data, len, ctx->user_data);
+}
+
+/* 接收响应并把响应体分段交给回调 */
+static int web_client_recv_stream(int sock, web_client_body_reader reader, void *user_data,
+                                  web_client_resp_stream_t *resp, rt_bool_t *keep_alive)
+{
+    web_http_parser_t parser;
+    web_client_stream_ctx_t ctx = {resp, reader, user_data};
+    int ret;
+    
+    web_http_parser_init(&parser, web_client_stream_headers, web_client_stream_body, &ctx);
+    
+    ret = web_client_recv(sock, &parser, keep_alive);
+    if (ret == -RT_EINTR)
     {
-        LOG_E("Failed to send request");
-        rt_free(request);
-        closesocket(sock);
-        return -RT_ERROR;
+        LOG_W("Response body aborted by reader (%d bytes)", resp->body_len);
+        ret = -RT_ERROR;
     }
     
-    rt_free(request);
+    return ret;
+}
+
+/* 一次HTTP请求的描述 */
+typedef struct {
+    const char *method;
+    const char *content_type;
+    const char *custom_header;          /* 完整的"Name: value\r\n"行，可以为空 */
+    const void *data;                   /* 内存中的请求体 */
+    uint32_t data_len;
+    const web_client_iovec_t *iov;      /* 或调用者持有的多段请求体，总长为data_len */
+    int iov_count;
+    web_client_body_writer writer;      /* 或由回调分段写出data_len字节 */
+    void *writer_data;
+    int timeout_s;
+} web_client_request_t;
+
+/*
+ * 发送请求并接收响应：response不为空时缓存响应体，否则交给reader
+ * 连接取自连接池，复用的连接在收到任何响应前失效（服务器已关闭）时换新连接重试一次，
+ * 因此writer可能被调用两次，须能从头重新写出请求体
+ */
+static int web_client_request(const char *url, const web_client_request_t *req,
+                              http_response_t *response,
+                              web_client_body_reader reader, void *user_data,
+                              web_client_resp_stream_t *resp)
+{
+    web_client_stream_t stream;
+    char host[WEB_CLIENT_HOST_MAX] = {0};
+    char path[256] = {0};
+    char *header;
+    int header_len;
+    int port = 80;
+    rt_bool_t reused = RT_FALSE;
+    rt_bool_t keep_alive;
+    rt_bool_t has_body = (req->data != RT_NULL || req->iov != RT_NULL || req->writer != RT_NULL);
+    web_client_iovec_t vec[1 + WEB_CLIENT_IOV_MAX];
+    int vec_count;
+    int i;
+    int attempt;
+    int ret = -RT_ERROR;
     
-    /* 分配接收缓冲区 */
-    recv_buffer = (char *)rt_malloc(HTTP_RESPONSE_MAX);
-    if (recv_buffer == RT_NULL)
+    /* 解析URL */
+    if (parse_url(url, host, &port, path) != RT_EOK)
     {
-        LOG_E("Failed to allocate receive buffer (%d bytes)", HTTP_RESPONSE_MAX);
-        LOG_E("Available memory insufficient. Run 'free' command to check");
-        closesocket(sock);
+        LOG_E("Failed to parse URL: %s", url);
         return -RT_ERROR;
     }
     
-    LOG_D("Allocated %d bytes for HTTP response", HTTP_RESPONSE_MAX);
+    header = (char *)ai_arena_alloc(HTTP_REQUEST_HEADER_MAX);
+    if (header == RT_NULL)
+    {
+        LOG_E("Failed to allocate request header (%d bytes)", HTTP_REQUEST_HEADER_MAX);
+        return -RT_ENOMEM;
+    }
     
-    /* 接收响应 */
-    while ((recv_len = recv(sock, recv_buffer + total_len, HTTP_RESPONSE_MAX - total_len - 1, 0)) > 0)
+    /* 构造请求头，请求体单独发送，不再拼接拷贝 */
+    header_len = rt_snprintf(header, HTTP_REQUEST_HEADER_MAX,
+                             "%s %s HTTP/1.1\r\n"
+                             "Host: %s\r\n"
+                             "User-Agent: RT-Thread\r\n",
+                             req->method, path, host);
+    if (has_body)
     {
-        total_len += recv_len;
-        if (total_len >= HTTP_RESPONSE_MAX - 1)
-        {
-            LOG_W("Response too large, truncated");
-            break;
-        }
+        header_len += rt_snprintf(header + header_len, HTTP_REQUEST_HEADER_MAX - header_len,
+                                  "Content-Type: %s\r\n"
+                                  "Content-Length: %d\r\n",
+                                  req->content_type ? req->content_type : "application/octet-stream",
+                                  req->data_len);
+    }
+    header_len += rt_snprintf(header + header_len, HTTP_REQUEST_HEADER_MAX - header_len,
+                              "%s"
+                              "Connection: keep-alive\r\n"
+                              "\r\n",
+                              req->custom_header ? req->custom_header : "");
+    if (header_len >= HTTP_REQUEST_HEADER_MAX)
+    {
+        LOG_E("Request header too large");
+        ai_arena_free(header);
+        return -RT_ERROR;
     }
     
-    recv_buffer[total_len] = '\0';
+    LOG_D("Request headers:\n%.*s", header_len, header);
     
-    if (total_len > 0)
+    AI_TRACE_BEGIN("http");
+    for (attempt = 0; attempt < 2; attempt++)
     {
-        /* 解析HTTP响应 */
-        char *status_line = recv_buffer;
-        char *header_end = strstr(recv_buffer, "\r\n\r\n");
+        stream.sock = web_client_pool_acquire(host, port, req->timeout_s, &reused);
+        if (stream.sock < 0)
+        {
+            ret = -RT_ERROR;
+            break;
+        }
+        stream.sent = 0;
+        stream.content_len = req->data_len;
+        keep_alive = RT_FALSE;
         
-        if (header_end)
+        /* 请求头和内存中的请求体各段直接从原处发送，不拼接拷贝 */
+        vec[0].data = header;
+        vec[0].len = header_len;
+        vec_count = 1;
+        if (req->data && req->data_len > 0)
         {
-            /* 提取状态码 */
-            sscanf(status_line, "HTTP/1.%*d %d", &response->status_code);
-            
-            /* 提取响应体 */
-            char *body_start = header_end + 4;
-            response->body_len = total_len - (body_start - recv_buffer);
-            response->body = (char *)rt_malloc(response->body_len + 1);
-            if (response->body)
+            vec[vec_count].data = req->data;
+            vec[vec_count].len = req->data_len;
+            vec_count++;
+        }
+        for (i = 0; req->iov && i < req->iov_count; i++)
+        {
+            if (req->iov[i].len > 0)
+            {
+                vec[vec_count++] = req->iov[i];
+            }
+        }
+        
+        AI_TRACE_BEGIN("http upload");
+        ret = web_client_send_vec(stream.sock, vec, vec_count);
+        if (ret == RT_EOK && req->writer)
+        {
+            /* 由调用者分段写出请求体 */
+            ret = req->writer(&stream, req->writer_data);
+            if (ret == RT_EOK && stream.sent != req->data_len)
             {
-                rt_memcpy(response->body, body_start, response->body_len);
-                response->body[response->body_len] = '\0';
+                LOG_E("Stream body incomplete (%d/%d bytes)", stream.sent, req->data_len);
+                ret = -RT_ERROR;
+                reused = RT_FALSE;  /* 调用者的错误，不重试 */
             }
-            
-            LOG_D("HTTP Response: status=%d, body_len=%d",
-                  response->status_code, response->body_len);
-            
-            ret = RT_EOK;
         }
+        AI_TRACE_END("http upload", header_len + req->data_len);
+        
+        if (ret != RT_EOK)
+        {
+            LOG_D("Failed to send request");
+            ret = -RT_EEMPTY;
+        }
+        else if (response)
+        {
+            rt_memset(response, 0, sizeof(http_response_t));
+            ret = web_client_recv_response(stream.sock, response, &keep_alive);
+        }
+        else
+        {
+            rt_memset(resp, 0, sizeof(web_client_resp_stream_t));
+            ret = web_client_recv_stream(stream.sock, reader, user_data, resp, &keep_alive);
+        }
+        
+        web_client_pool_release(stream.sock, host, port, ret == RT_EOK && keep_alive);
+        
+        if (ret != -RT_EEMPTY || !reused)
+        {
+            break;
+        }
+        
+        LOG_D("Reused connection to %s:%d closed by server, retrying", host, port);
+        web_client_pool_lock();
+        web_client_pool.stats.retried++;
+        web_client_pool_unlock();
     }
+    AI_TRACE_END("http", ret == RT_EOK);
+    
+    ai_arena_free(header);
     
-    rt_free(recv_buffer);
-    closesocket(sock);
+    if (ret == -RT_EEMPTY)
+    {
+        LOG_E("Failed to send request or connection closed before response");
+        ret = -RT_ERROR;
+    }
     
     return ret;
 }
 
+/* HTTP GET请求 */
+int web_client_get(const char *url, http_response_t *response)
+{
+    web_client_request_t req = {0};
+    
+    if (url == RT_NULL || response == RT_NULL)
+    {
+        return -RT_EINVAL;
+    }
+    
+    rt_memset(response, 0, sizeof(http_response_t));
+    
+    req.method = "GET";
+    req.timeout_s = 10;
+    
+    return web_client_request(url, &req, response, RT_NULL, RT_NULL, RT_NULL);
+}
+
+/* HTTP POST请求 */
+int web_client_post(const char *url, const char *data, uint32_t data_len,
+                    const char *content_type, http_response_t *response)
+{
+    return web_client_post_with_header(url, data, data_len,
+                                       content_type ? content_type : "application/octet-stream",
+                                       RT_NULL, response);
+}
+
 /* HTTP POST请求（带自定义Header）*/
 int web_client_post_with_header(const char *url, const char *data, uint32_t data_len,
                                   const char *content_type, const char *custom_header,
                                   http_response_t *response)
 {
-    int sock = -1;
-    struct hostent *host_entry;
-    struct sockaddr_in server_addr;
-    char host[128] = {0};
-    char path[256] = {0};
-    char *request = RT_NULL;
-    char *recv_buffer = RT_NULL;
-    int port = 80;
-    int ret = -RT_ERROR;
-    int recv_len = 0;
-    int total_len = 0;
+    web_client_request_t req = {0};
     
     if (url == RT_NULL || data == RT_NULL || response == RT_NULL)
     {
@@ -401,195 +816,209 @@ int web_client_post_with_header(const char *url, const char *data, uint32_t data
     
     rt_memset(response, 0, sizeof(http_response_t));
     
-    /* 解析URL */
-    if (parse_url(url, host, &port, path) != RT_EOK)
-    {
-        LOG_E("Failed to parse URL: %s", url);
-        return -RT_ERROR;
-    }
+    req.method = "POST";
+    req.content_type = content_type ? content_type : "application/json";
+    req.custom_header = custom_header;
+    req.data = data;
+    req.data_len = data_len;
+    req.timeout_s = 30;  /* POST请求可能需要更长时间 */
     
-    LOG_D("Connecting to %s:%d%s", host, port, path);
+    return web_client_request(url, &req, response, RT_NULL, RT_NULL, RT_NULL);
+}
+
+/* HTTP POST请求（分段请求体）：各段与请求头一起发送，不拼接到新的缓冲区 */
+int web_client_post_iov(const char *url, const char *content_type,
+                        const web_client_iovec_t *iov, int iov_count,
+                        http_response_t *response)
+{
+    web_client_request_t req = {0};
+    int i;
     
-    /* 域名解析 */
-    host_entry = gethostbyname(host);
-    if (host_entry == RT_NULL)
+    if (url == RT_NULL || iov == RT_NULL || iov_count <= 0 || response == RT_NULL)
     {
-        LOG_E("Failed to resolve host: %s", host);
-        return -RT_ERROR;
+        return -RT_EINVAL;
     }
     
-    /* 创建socket */
-    sock = socket(AF_INET, SOCK_STREAM, 0);
-    if (sock < 0)
+    if (iov_count > WEB_CLIENT_IOV_MAX)
     {
-        LOG_E("Failed to create socket");
-        return -RT_ERROR;
+        LOG_E("Too many body segments (%d > %d)", iov_count, WEB_CLIENT_IOV_MAX);
+        return -RT_EINVAL;
     }
     
-    /* 设置超时 */
-    struct timeval timeout = {30, 0};
-    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
-    setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+    rt_memset(response, 0, sizeof(http_response_t));
     
-    /* 连接服务器 */
-    server_addr.sin_family = AF_INET;
-    server_addr.sin_port = htons(port);
-    server_addr.sin_addr = *((struct in_addr *)host_entry->h_addr);
-    rt_memset(&(server_addr.sin_zero), 0, sizeof(server_addr.sin_zero));
+    req.method = "POST";
+    req.content_type = content_type;
+    req.iov = iov;
+    req.iov_count = iov_count;
+    for (i = 0; i < iov_count; i++)
+    {
+        if (iov[i].data == RT_NULL && iov[i].len > 0)
+        {
+            return -RT_EINVAL;
+        }
+        req.data_len += iov[i].len;
+    }
+    req.timeout_s = 30;
     
-    if (connect(sock, (struct sockaddr *)&server_addr, sizeof(struct sockaddr)) < 0)
+    return web_client_request(url, &req, response, RT_NULL, RT_NULL, RT_NULL);
+}
+
+/* 流式请求体写入 */
+int web_client_stream_write(web_client_stream_t *stream, const void *data, uint32_t len)
+{
+    if (stream == RT_NULL || (data == RT_NULL && len > 0))
     {
-        LOG_E("Failed to connect to server");
-        closesocket(sock);
-        return -RT_ERROR;
+        return -RT_EINVAL;
     }
     
-    /* 分配请求缓冲区 */
-    request = (char *)rt_malloc(1024 + data_len);
-    if (request == RT_NULL)
+    if (stream->sent + len > stream->content_len)
     {
-        LOG_E("Failed to allocate request buffer (%d bytes)", 1024 + data_len);
-        closesocket(sock);
+        LOG_E("Stream body exceeds Content-Length (%d > %d)",
+              stream->sent + len, stream->content_len);
         return -RT_ERROR;
     }
     
-    /* 构造HTTP POST请求（带自定义Header）*/
-    int header_len = rt_snprintf(request, 1024,
-                                  "POST %s HTTP/1.1\r\n"
-                                  "Host: %s\r\n"
-                                  "User-Agent: RT-Thread\r\n"
-                                  "Content-Type: %s\r\n"
-                                  "Content-Length: %d\r\n"
-                                  "%s"  /* 自定义Header */
-                                  "Connection: close\r\n"
-                                  "\r\n",
-                                  path, host, content_type ? content_type : "application/json", data_len,
-                                  custom_header ? custom_header : "");
-    
-    /* 添加数据 */
-    rt_memcpy(request + header_len, data, data_len);
-    
-    LOG_D("Request headers:\n%.*s", header_len, request);
-    
-    /* 发送请求 */
-    if (send(sock, request, header_len + data_len, 0) < 0)
+    if (web_client_send_all(stream->sock, data, len, 0) != RT_EOK)
     {
-        LOG_E("Failed to send request");
-        rt_free(request);
-        closesocket(sock);
+        LOG_D("Failed to send stream body");
         return -RT_ERROR;
     }
     
-    rt_free(request);
+    stream->sent += len;
+    return RT_EOK;
+}
+
+/* HTTP POST请求（流式请求体，长度预先确定）*/
+int web_client_post_stream(const char *url, const char *content_type, uint32_t content_len,
+                           web_client_body_writer writer, void *user_data,
+                           http_response_t *response)
+{
+    return web_client_post_stream_with_header(url, content_type, RT_NULL, content_len,
+                                              writer, user_data, response);
+}
+
+/* HTTP POST请求（流式请求体，带自定义Header）*/
+int web_client_post_stream_with_header(const char *url, const char *content_type,
+                                       const char *custom_header, uint32_t content_len,
+                                       web_client_body_writer writer, void *user_data,
+                                       http_response_t *response)
+{
+    web_client_request_t req = {0};
     
-    /* 分配接收缓冲区 */
-    recv_buffer = (char *)rt_malloc(HTTP_RESPONSE_MAX);
-    if (recv_buffer == RT_NULL)
+    if (url == RT_NULL || writer == RT_NULL || response == RT_NULL)
     {
-        LOG_E("Failed to allocate receive buffer (%d bytes)", HTTP_RESPONSE_MAX);
-        closesocket(sock);
-        return -RT_ERROR;
+        return -RT_EINVAL;
     }
     
-    /* 接收响应 */
-    while ((recv_len = recv(sock, recv_buffer + total_len, HTTP_RESPONSE_MAX - total_len - 1, 0)) > 0)
+    rt_memset(response, 0, sizeof(http_response_t));
+    
+    req.method = "POST";
+    req.content_type = content_type;
+    req.custom_header = custom_header;
+    req.data_len = content_len;
+    req.writer = writer;
+    req.writer_data = user_data;
+    req.timeout_s = 30;
+    
+    return web_client_request(url, &req, response, RT_NULL, RT_NULL, RT_NULL);
+}
+
+/* HTTP POST请求（流式响应）*/
+int web_client_post_recv_stream(const char *url, const char *data, uint32_t data_len,
+                                const char *content_type, web_client_body_reader reader,
+                                void *user_data, web_client_resp_stream_t *resp)
+{
+    web_client_request_t req = {0};
+    
+    if (url == RT_NULL || data == RT_NULL || reader == RT_NULL || resp == RT_NULL)
     {
-        total_len += recv_len;
-        if (total_len >= HTTP_RESPONSE_MAX - 1)
-        {
-            LOG_W("Response too large, truncated");
-            break;
-        }
+        return -RT_EINVAL;
     }
     
-    recv_buffer[total_len] = '\0';
+    rt_memset(resp, 0, sizeof(web_client_resp_stream_t));
+    
+    req.method = "POST";
+    req.content_type = content_type;
+    req.data = data;
+    req.data_len = data_len;
+    req.timeout_s = 30;
+    
+    return web_client_request(url, &req, RT_NULL, reader, user_data, resp);
+}
+
+/* HTTP POST请求（流式请求体 + 流式响应，带自定义Header）*/
+int web_client_post_stream_recv(const char *url, const char *content_type,
+                                const char *custom_header, uint32_t content_len,
+                                web_client_body_writer writer, void *writer_data,
+                                web_client_body_reader reader, void *user_data,
+                                web_client_resp_stream_t *resp)
+{
+    web_client_request_t req = {0};
     
-    if (total_len > 0)
+    if (url == RT_NULL || writer == RT_NULL || reader == RT_NULL || resp == RT_NULL)
     {
-        /* 解析HTTP响应 */
-        char *status_line = recv_buffer;
-        char *header_end = strstr(recv_buffer, "\r\n\r\n");
-        
-        if (header_end)
-        {
-            /* 提取状态码 */
-            sscanf(status_line, "HTTP/1.%*d %d", &response->status_code);
-            
-            /* 提取响应体 */
-            char *body_start = header_end + 4;
-            response->body_len = total_len - (body_start - recv_buffer);
-            response->body = (char *)rt_malloc(response->body_len + 1);
-            if (response->body)
-            {
-                rt_memcpy(response->body, body_start, response->body_len);
-                response->body[response->body_len] = '\0';
-            }
-            
-            LOG_D("HTTP Response: status=%d, body_len=%d", 
-                  response->status_code, response->body_len);
-            
-            ret = RT_EOK;
-        }
+        return -RT_EINVAL;
     }
     
-    rt_free(recv_buffer);
-    closesocket(sock);
+    rt_memset(resp, 0, sizeof(web_client_resp_stream_t));
     
-    return ret;
+    req.method = "POST";
+    req.content_type = content_type;
+    req.custom_header = custom_header;
+    req.data_len = content_len;
+    req.writer = writer;
+    req.writer_data = writer_data;
+    req.timeout_s = 30;
+    
+    return web_client_request(url, &req, RT_NULL, reader, user_data, resp);
 }
 
-/* 上传文件（multipart/form-data）*/
+/* 上传文件（multipart/form-data）：前导、文件内容和结尾分段发送，文件内容不拷贝 */
 int web_client_post_file(const char *url, const uint8_t *file_data, uint32_t file_len,
                           const char *field_name, const char *file_name,
                           http_response_t *response)
 {
     const char *boundary = "----WebKitFormBoundary7MA4YWxkTrZu0gW";
-    char *multipart_data = RT_NULL;
-    int multipart_len = 0;
-    int ret = -RT_ERROR;
+    web_client_iovec_t iov[3];
+    char preamble[384];
+    char epilogue[64];
     char content_type[128];
+    int preamble_len;
+    int epilogue_len;
     
     if (url == RT_NULL || file_data == RT_NULL || response == RT_NULL)
     {
         return -RT_EINVAL;
     }
     
-    /* 计算multipart数据大小 */
-    multipart_len = strlen(boundary) * 2 + strlen(field_name) + strlen(file_name) + file_len + 256;
-    
-    /* 分配缓冲区 */
-    multipart_data = (char *)rt_malloc(multipart_len);
-    if (multipart_data == RT_NULL)
+    /* 构造multipart前导和结尾 */
+    preamble_len = rt_snprintf(preamble, sizeof(preamble),
+                               "--%s\r\n"
+                               "Content-Disposition: form-data; name=\"%s\"; filename=\"%s\"\r\n"
+                               "Content-Type: application/octet-stream\r\n"
+                               "\r\n",
+                               boundary, field_name, file_name);
+    if (preamble_len >= (int)sizeof(preamble))
     {
-        LOG_E("Failed to allocate multipart buffer");
-        return -RT_ERROR;
+        LOG_E("Multipart field or file name too long");
+        return -RT_EINVAL;
     }
     
-    /* 构造multipart数据 */
-    int offset = 0;
-    offset += rt_snprintf(multipart_data + offset, multipart_len - offset,
-                          "--%s\r\n"
-                          "Content-Disposition: form-data; name=\"%s\"; filename=\"%s\"\r\n"
-                          "Content-Type: application/octet-stream\r\n"
-                          "\r\n",
-                          boundary, field_name, file_name);
-    
-    rt_memcpy(multipart_data + offset, file_data, file_len);
-    offset += file_len;
+    epilogue_len = rt_snprintf(epilogue, sizeof(epilogue), "\r\n--%s--\r\n", boundary);
     
-    offset += rt_snprintf(multipart_data + offset, multipart_len - offset,
-                          "\r\n--%s--\r\n", boundary);
+    iov[0].data = preamble;
+    iov[0].len = preamble_len;
+    iov[1].data = file_data;
+    iov[1].len = file_len;
+    iov[2].data = epilogue;
+    iov[2].len = epilogue_len;
     
     /* 设置Content-Type */
     rt_snprintf(content_type, sizeof(content_type), 
                 "multipart/form-data; boundary=%s", boundary);
     
-    /* 发送POST请求 */
-    ret = web_client_post(url, multipart_data, offset, content_type, response);
-    
-    rt_free(multipart_data);
-    
-    return ret;
+    return web_client_post_iov(url, content_type, iov, 3, response);
 }
 
 /* 释放响应数据 */
@@ -599,12 +1028,12 @@ void web_client_free_response(http_response_t *response)
     {
         if (response->body)
         {
-            rt_free(response->body);
+            ai_arena_free(response->body);
             response->body = RT_NULL;
         }
         if (response->content_type)
         {
-            rt_free(response->content_type);
+            ai_arena_free(response->content_type);
             response->content_type = RT_NULL;
         }
         response->body_len = 0;
@@ -612,3 +1041,39 @@ void web_client_free_response(http_response_t *response)
     }
 }
 
+#ifdef FINSH_USING_MSH
+#include <finsh.h>
+
+static int cmd_web_pool(int argc, char **argv)
+{
+    web_client_pool_stats_t stats;
+    int i;
+    
+    if (argc > 1 && strcmp(argv[1], "flush") == 0)
+    {
+        web_client_pool_flush();
+        rt_kprintf("Idle connections closed\n");
+        return 0;
+    }
+    
+    web_client_pool_get_stats(&stats);
+    rt_kprintf("Requests: %d, opened: %d, reused: %d\n", stats.requests, stats.opened, stats.reused);
+    rt_kprintf("Stale: %d, retried: %d, evicted: %d, idle: %d/%d\n",
+               stats.stale, stats.retried, stats.evicted, stats.idle, WEB_CLIENT_POOL_SIZE);
+    
+    web_client_pool_lock();
+    for (i = 0; i < WEB_CLIENT_POOL_SIZE; i++)
+    {
+        web_client_conn_t *conn = &web_client_pool.conns[i];
+        if (conn->sock >= 0)
+        {
+            rt_kprintf("  [%d] %s:%d idle %d ms\n", i, conn->host, conn->port,
+                       (rt_tick_get() - conn->last_used) * 1000 / RT_TICK_PER_SECOND);
+        }
+    }
+    web_client_pool_unlock();
+    
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_web_pool, web_pool, Show HTTP keep-alive pool: web_pool [flush]);
+#endif
@@ -13,6 +13,25 @@
 
 #include <rtthread.h>
 
+/* 连接池：请求使用HTTP/1.1 keep-alive，响应完整的连接按host:port放回池中复用 */
+#define WEB_CLIENT_POOL_SIZE        4
+#define WEB_CLIENT_IDLE_TIMEOUT_MS  20000   /* 空闲超过此时间的连接被关闭，应小于服务器的keep-alive超时 */
+#define WEB_CLIENT_HOST_MAX         128
+
+/* 分段请求体最多的段数（不含请求头）*/
+#define WEB_CLIENT_IOV_MAX          6
+
+/* 连接池统计 */
+typedef struct {
+    uint32_t requests;        /* 请求次数（含重试）*/
+    uint32_t opened;          /* 新建的TCP连接 */
+    uint32_t reused;          /* 复用空闲连接的次数 */
+    uint32_t stale;           /* 取出时发现已被服务器关闭的连接 */
+    uint32_t retried;         /* 复用的连接发送后失效，换新连接重试 */
+    uint32_t evicted;         /* 空闲超时或池满被关闭的连接 */
+    uint32_t idle;            /* 当前池中的空闲连接 */
+} web_client_pool_stats_t;
+
 /* HTTP响应结构 */
 typedef struct {
     int status_code;
@@ -21,6 +40,35 @@ typedef struct {
     char *content_type;
 } http_response_t;
 
+/* 请求体的一段：内存由调用者持有，请求返回前不得释放 */
+typedef struct {
+    const void *data;
+    uint32_t len;
+} web_client_iovec_t;
+
+/* 流式请求体 */
+typedef struct {
+    int sock;
+    uint32_t sent;            /* 已发送的请求体字节数 */
+    uint32_t content_len;     /* 声明的Content-Length */
+} web_client_stream_t;
+
+/* 请求体写出回调：通过web_client_stream_write分段发送，写完返回RT_EOK
+ * 复用的连接失效时会在新连接上再调用一次，须能从头重新写出 */
+typedef int (*web_client_body_writer)(web_client_stream_t *stream, void *user_data);
+
+/* 流式响应：响应体不缓存，直接从接收块交给回调，长度不受HTTP_RESPONSE_MAX限制，支持chunked */
+typedef struct {
+    int status_code;
+    int32_t content_len;      /* -1 表示未声明（chunked或读到连接关闭）*/
+    char content_type[64];
+    uint32_t body_len;        /* 已交给回调的响应体字节数 */
+} web_client_resp_stream_t;
+
+/* 响应体读取回调：响应头解析完成后按到达顺序调用，返回非RT_EOK时中止接收 */
+typedef int (*web_client_body_reader)(web_client_resp_stream_t *resp, const uint8_t *data,
+                                      uint32_t len, void *user_data);
+
 /* HTTP请求接口 */
 int web_client_get(const char *url, http_response_t *response);
 int web_client_post(const char *url, const char *data, uint32_t data_len, 
@@ -31,7 +79,30 @@ int web_client_post_with_header(const char *url, const char *data, uint32_t data
 int web_client_post_file(const char *url, const uint8_t *file_data, uint32_t file_len,
                           const char *field_name, const char *file_name,
                           http_response_t *response);
+int web_client_post_iov(const char *url, const char *content_type,
+                        const web_client_iovec_t *iov, int iov_count,
+                        http_response_t *response);
+int web_client_post_stream(const char *url, const char *content_type, uint32_t content_len,
+                           web_client_body_writer writer, void *user_data,
+                           http_response_t *response);
+int web_client_post_stream_with_header(const char *url, const char *content_type,
+                                       const char *custom_header, uint32_t content_len,
+                                       web_client_body_writer writer, void *user_data,
+                                       http_response_t *response);
+int web_client_stream_write(web_client_stream_t *stream, const void *data, uint32_t len);
+int web_client_post_recv_stream(const char *url, const char *data, uint32_t data_len,
+                                const char *content_type, web_client_body_reader reader,
+                                void *user_data, web_client_resp_stream_t *resp);
+int web_client_post_stream_recv(const char *url, const char *content_type,
+                                const char *custom_header, uint32_t content_len,
+                                web_client_body_writer writer, void *writer_data,
+                                web_client_body_reader reader, void *user_data,
+                                web_client_resp_stream_t *resp);
 void web_client_free_response(http_response_t *response);
 
+/* 连接池接口 */
+void web_client_pool_flush(void);
+void web_client_pool_get_stats(web_client_pool_stats_t *stats);
+
 #endif /* __WEB_CLIENT_H__ */
 
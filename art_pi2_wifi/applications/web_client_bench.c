@@ -0,0 +1,445 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-24     AI Assistant first version - HTTP connection pool benchmark
+ */
+
+/*
+ * HTTP连接复用测试：对同一地址连续发送N次请求，统计新建的TCP连接数和平均耗时
+ *   1. 每次请求前清空连接池（与原来每次请求新建连接的行为相同）
+ *   2. 使用连接池
+ *   3. 可选：空闲超过服务器的keep-alive超时后再请求一次，验证失效连接的检测
+ * 连接数同时从 mock_ai_server.py 的 /stats 读取，与客户端统计交叉验证。
+ *
+ * upload 模式对比multipart上传的堆峰值：原做法把前导、文件和结尾拼接到新分配的缓冲区，
+ * 现在分段直接发送。音频缓冲区本身也计入峰值，服务器端 /upload 逐字节校验文件内容。
+ * 设备端通过rt_malloc/rt_free钩子只统计本线程的分配，PC端用链接器的--wrap统计。
+ *
+ * 设备端：web_bench http://PC_IP:8090/ping [次数] [空闲秒数]
+ *         web_bench upload http://PC_IP:8090/upload [KB]
+ * PC端（与设备端同一份web_client.c，host/ 下是最小的RT-Thread接口）：
+ *   gcc -O2 -DWEB_CLIENT_BENCH_MAIN -I../host -I. web_client.c web_dns.c web_http_parser.c ai_trace.c ai_arena.c memory_helper.c web_client_bench.c \
+ *       -Wl,--wrap=malloc,--wrap=realloc,--wrap=free -lpthread -o web_bench
+ *   python ../mock_ai_server.py 8090 &
+ *   ./web_bench http://127.0.0.1:8090/ping 100 12
+ *   ./web_bench upload http://127.0.0.1:8090/upload 96
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include "web_client.h"
+
+#define WEB_BENCH_URL_MAX   256
+
+/* ==================== 堆内存统计 ==================== */
+
+#define WEB_BENCH_HEAP_SLOTS    32
+
+/* 统计期间的存活分配，只记录发起测试的线程 */
+static struct {
+    rt_bool_t active;
+    rt_thread_t thread;
+    void *ptr[WEB_BENCH_HEAP_SLOTS];
+    uint32_t size[WEB_BENCH_HEAP_SLOTS];
+    uint32_t current;
+    uint32_t peak;
+} web_bench_heap;
+
+static void web_bench_heap_add(void *ptr, uint32_t size)
+{
+    int i;
+
+    if (!web_bench_heap.active || ptr == RT_NULL || rt_thread_self() != web_bench_heap.thread)
+    {
+        return;
+    }
+    for (i = 0; i < WEB_BENCH_HEAP_SLOTS; i++)
+    {
+        if (web_bench_heap.ptr[i] == RT_NULL)
+        {
+            web_bench_heap.ptr[i] = ptr;
+            web_bench_heap.size[i] = size;
+            web_bench_heap.current += size;
+            if (web_bench_heap.current > web_bench_heap.peak)
+            {
+                web_bench_heap.peak = web_bench_heap.current;
+            }
+            return;
+        }
+    }
+}
+
+static void web_bench_heap_remove(void *ptr)
+{
+    int i;
+
+    if (!web_bench_heap.active || ptr == RT_NULL)
+    {
+        return;
+    }
+    for (i = 0; i < WEB_BENCH_HEAP_SLOTS; i++)
+    {
+        if (web_bench_heap.ptr[i] == ptr)
+        {
+            web_bench_heap.ptr[i] = RT_NULL;
+            web_bench_heap.current -= web_bench_heap.size[i];
+            return;
+        }
+    }
+}
+
+#ifdef WEB_CLIENT_BENCH_MAIN
+/* PC端：web_client.c 中的 rt_malloc 即 malloc，链接时用 --wrap 截获 */
+void *__real_malloc(size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+void *__wrap_malloc(size_t size)
+{
+    void *ptr = __real_malloc(size);
+    web_bench_heap_add(ptr, size);
+    return ptr;
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    void *new_ptr;
+
+    web_bench_heap_remove(ptr);
+    new_ptr = __real_realloc(ptr, size);
+    web_bench_heap_add(new_ptr, size);
+    return new_ptr;
+}
+
+void __wrap_free(void *ptr)
+{
+    web_bench_heap_remove(ptr);
+    __real_free(ptr);
+}
+#else
+static void web_bench_malloc_hook(void **ptr, rt_size_t size)
+{
+    web_bench_heap_add(*ptr, size);
+}
+
+static void web_bench_realloc_entry_hook(void **ptr, rt_size_t size)
+{
+    web_bench_heap_remove(*ptr);
+}
+
+static void web_bench_realloc_exit_hook(void **ptr, rt_size_t size)
+{
+    web_bench_heap_add(*ptr, size);
+}
+
+static void web_bench_free_hook(void **ptr)
+{
+    web_bench_heap_remove(*ptr);
+}
+#endif
+
+static void web_bench_heap_begin(void)
+{
+    rt_memset(&web_bench_heap, 0, sizeof(web_bench_heap));
+    web_bench_heap.thread = rt_thread_self();
+#ifndef WEB_CLIENT_BENCH_MAIN
+    rt_malloc_sethook(web_bench_malloc_hook);
+    rt_realloc_set_entry_hook(web_bench_realloc_entry_hook);
+    rt_realloc_set_exit_hook(web_bench_realloc_exit_hook);
+    rt_free_sethook(web_bench_free_hook);
+#endif
+    web_bench_heap.active = RT_TRUE;
+}
+
+/* 结束统计，返回峰值 */
+static uint32_t web_bench_heap_end(void)
+{
+    web_bench_heap.active = RT_FALSE;
+#ifndef WEB_CLIENT_BENCH_MAIN
+    rt_malloc_sethook(RT_NULL);
+    rt_realloc_set_entry_hook(RT_NULL);
+    rt_realloc_set_exit_hook(RT_NULL);
+    rt_free_sethook(RT_NULL);
+#endif
+    return web_bench_heap.peak;
+}
+
+/* 由测试地址得到同一服务器的 /stats 地址 */
+static void web_bench_stats_url(const char *url, char *stats_url)
+{
+    const char *p = strstr(url, "://");
+    const char *path;
+
+    p = p ? p + 3 : url;
+    path = strchr(p, '/');
+    if (path == RT_NULL)
+    {
+        path = p + strlen(p);
+    }
+    rt_snprintf(stats_url, WEB_BENCH_URL_MAX, "%.*s/stats", (int)(path - url), url);
+}
+
+/* 服务器端统计的连接数，失败时返回-1 */
+static int web_bench_server_connections(const char *stats_url)
+{
+    http_response_t response;
+    const char *value;
+    int connections = -1;
+
+    if (web_client_get(stats_url, &response) == RT_EOK && response.status_code == 200 && response.body)
+    {
+        value = strstr(response.body, "\"connections\":");
+        if (value)
+        {
+            connections = atoi(value + 14);
+        }
+    }
+    web_client_free_response(&response);
+
+    return connections;
+}
+
+/* 发送count次GET请求，返回成功次数 */
+static int web_bench_run(const char *url, int count, rt_bool_t flush, const char *name)
+{
+    web_client_pool_stats_t before, after;
+    http_response_t response;
+    char stats_url[WEB_BENCH_URL_MAX];
+    int server_before, server_after;
+    int ok = 0;
+    int i;
+    rt_tick_t start, elapsed;
+
+    web_bench_stats_url(url, stats_url);
+    server_before = web_bench_server_connections(stats_url);
+    web_client_pool_get_stats(&before);
+
+    start = rt_tick_get();
+    for (i = 0; i < count; i++)
+    {
+        if (flush)
+        {
+            web_client_pool_flush();
+        }
+        if (web_client_get(url, &response) == RT_EOK && response.status_code == 200)
+        {
+            ok++;
+        }
+        web_client_free_response(&response);
+    }
+    elapsed = rt_tick_get() - start;
+
+    web_client_pool_get_stats(&after);
+    server_after = web_bench_server_connections(stats_url);
+
+    rt_kprintf("%-10s %d/%d ok, %d ms (%d.%02d ms/request), opened %d, reused %d, server connections %d\n",
+               name, ok, count, elapsed * 1000 / RT_TICK_PER_SECOND,
+               elapsed * 1000 / RT_TICK_PER_SECOND / count,
+               elapsed * 100000 / RT_TICK_PER_SECOND / count % 100,
+               after.opened - before.opened, after.reused - before.reused,
+               (server_before >= 0 && server_after >= 0) ? server_after - server_before : -1);
+
+    return ok;
+}
+
+/* ==================== multipart上传 ==================== */
+
+/* 原来的做法：前导、文件和结尾拼接到新分配的缓冲区再发送 */
+static int web_bench_post_file_copy(const char *url, const uint8_t *file_data, uint32_t file_len,
+                                    const char *field_name, const char *file_name,
+                                    http_response_t *response)
+{
+    const char *boundary = "----WebKitFormBoundary7MA4YWxkTrZu0gW";
+    char *multipart_data;
+    int multipart_len;
+    int offset = 0;
+    int ret;
+    char content_type[128];
+
+    multipart_len = strlen(boundary) * 2 + strlen(field_name) + strlen(file_name) + file_len + 256;
+    multipart_data = (char *)rt_malloc(multipart_len);
+    if (multipart_data == RT_NULL)
+    {
+        return -RT_ENOMEM;
+    }
+
+    offset += rt_snprintf(multipart_data + offset, multipart_len - offset,
+                          "--%s\r\n"
+                          "Content-Disposition: form-data; name=\"%s\"; filename=\"%s\"\r\n"
+                          "Content-Type: application/octet-stream\r\n"
+                          "\r\n",
+                          boundary, field_name, file_name);
+    rt_memcpy(multipart_data + offset, file_data, file_len);
+    offset += file_len;
+    offset += rt_snprintf(multipart_data + offset, multipart_len - offset,
+                          "\r\n--%s--\r\n", boundary);
+
+    rt_snprintf(content_type, sizeof(content_type), "multipart/form-data; boundary=%s", boundary);
+    ret = web_client_post(url, multipart_data, offset, content_type, response);
+
+    rt_free(multipart_data);
+    return ret;
+}
+
+/* 上传一段与服务器端 test_pcm 相同的音频，返回RT_EOK表示服务器校验通过 */
+static int web_bench_upload_once(const char *url, uint32_t len, rt_bool_t copy, const char *name)
+{
+    http_response_t response;
+    uint8_t *audio;
+    uint32_t peak, i;
+    rt_tick_t start, elapsed;
+    rt_bool_t ok;
+    int ret;
+
+    web_bench_heap_begin();
+
+    /* 录音缓冲区也计入峰值 */
+    audio = (uint8_t *)rt_malloc(len);
+    if (audio == RT_NULL)
+    {
+        web_bench_heap_end();
+        rt_kprintf("No memory for %d bytes of audio\n", len);
+        return -RT_ENOMEM;
+    }
+    for (i = 0; i < len; i++)
+    {
+        audio[i] = (uint8_t)((i * 31 + 7) & 0xFF);
+    }
+
+    start = rt_tick_get();
+    if (copy)
+    {
+        ret = web_bench_post_file_copy(url, audio, len, "file", "audio.pcm", &response);
+    }
+    else
+    {
+        ret = web_client_post_file(url, audio, len, "file", "audio.pcm", &response);
+    }
+    elapsed = rt_tick_get() - start;
+
+    ok = ret == RT_EOK && response.status_code == 200 && response.body &&
+         strstr(response.body, "\"ok\": true") != RT_NULL;
+    web_client_free_response(&response);
+    rt_free(audio);
+    peak = web_bench_heap_end();
+
+    rt_kprintf("%-10s %s, peak heap %6d bytes (%d.%02d x audio), %d ms\n",
+               name, ok ? "server verified" : "FAILED", peak,
+               peak / len, peak * 100 / len % 100, elapsed * 1000 / RT_TICK_PER_SECOND);
+
+    return ok ? RT_EOK : -RT_ERROR;
+}
+
+static int web_bench_upload(const char *url, int kbytes)
+{
+    uint32_t len;
+    http_response_t response;
+    int ret;
+
+    if (kbytes <= 0)
+    {
+        kbytes = 96;
+    }
+    len = (uint32_t)kbytes * 1024;
+
+    /* 先建立连接，两次测量都复用同一连接 */
+    web_client_post_file(url, (const uint8_t *)"\x07", 1, "file", "warmup.pcm", &response);
+    web_client_free_response(&response);
+
+    rt_kprintf("multipart upload of %d KB\n", kbytes);
+    ret = web_bench_upload_once(url, len, RT_TRUE, "copy");
+    if (web_bench_upload_once(url, len, RT_FALSE, "segments") != RT_EOK)
+    {
+        ret = -RT_ERROR;
+    }
+
+    return ret;
+}
+
+static int web_bench(const char *url, int count, int idle_s)
+{
+    web_client_pool_stats_t before, after;
+    http_response_t response;
+    int ret;
+
+    if (count <= 0)
+    {
+        count = 100;
+    }
+
+    web_bench_run(url, count, RT_TRUE, "no reuse");
+    web_bench_run(url, count, RT_FALSE, "pool");
+
+    if (idle_s > 0)
+    {
+        /* 服务器关闭空闲连接后，池中的连接应被检测为失效并换新连接 */
+        rt_kprintf("Idle %d s...\n", idle_s);
+        rt_thread_mdelay(idle_s * 1000);
+
+        web_client_pool_get_stats(&before);
+        ret = web_client_get(url, &response);
+        web_client_pool_get_stats(&after);
+        rt_kprintf("after idle: %s (status %d), stale %d, retried %d, evicted %d, opened %d\n",
+                   ret == RT_EOK ? "ok" : "failed", response.status_code,
+                   after.stale - before.stale, after.retried - before.retried,
+                   after.evicted - before.evicted, after.opened - before.opened);
+        web_client_free_response(&response);
+    }
+
+    return 0;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+#include <finsh.h>
+
+static int cmd_web_bench(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        rt_kprintf("Usage: web_bench <url> [count] [idle_s]\n");
+        rt_kprintf("       web_bench upload <url> [KB]\n");
+        rt_kprintf("  e.g. web_bench http://PC_IP:8090/ping 100 12\n");
+        rt_kprintf("       web_bench upload http://PC_IP:8090/upload 96\n");
+        return -1;
+    }
+
+    if (strcmp(argv[1], "upload") == 0)
+    {
+        return argc > 2 ? web_bench_upload(argv[2], argc > 3 ? atoi(argv[3]) : 96) : -1;
+    }
+
+    return web_bench(argv[1], argc > 2 ? atoi(argv[2]) : 100, argc > 3 ? atoi(argv[3]) : 0);
+}
+MSH_CMD_EXPORT_ALIAS(cmd_web_bench, web_bench, HTTP benchmark: web_bench [upload] <url> [count|KB] [idle_s]);
+#endif
+
+#ifdef WEB_CLIENT_BENCH_MAIN
+#include <signal.h>
+
+HOST_CRITICAL_LOCK_DEFINE;
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        printf("Usage: %s <url> [count] [idle_s]\n", argv[0]);
+        printf("       %s upload <url> [KB]\n", argv[0]);
+        return 1;
+    }
+
+    /* 对端关闭的连接上send时不要被SIGPIPE终止，与lwIP的行为一致 */
+    signal(SIGPIPE, SIG_IGN);
+
+    if (strcmp(argv[1], "upload") == 0)
+    {
+        return argc > 2 && web_bench_upload(argv[2], argc > 3 ? atoi(argv[3]) : 96) == RT_EOK ? 0 : 1;
+    }
+
+    return web_bench(argv[1], argc > 2 ? atoi(argv[2]) : 100, argc > 3 ? atoi(argv[3]) : 0);
+}
+#endif
@@ -0,0 +1,741 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-25     AI Assistant first version - DNS cache with TTL
+ * 2024-10-27     AI Assistant Wake waiters on a per-entry semaphore instead of polling
+ */
+
+#include <rtthread.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netdb.h>
+#include <string.h>
+#include <stdlib.h>
+#include "web_dns.h"
+
+#ifdef RT_USING_NETDEV
+#include <netdev.h>
+#endif
+
+#define DBG_TAG "web.dns"
+#define DBG_LVL DBG_INFO
+#include <rtdbg.h>
+
+#define WEB_DNS_PORT            53
+#define WEB_DNS_PACKET_MAX      512
+#define WEB_DNS_TYPE_A          1
+#define WEB_DNS_TYPE_CNAME      5
+#define WEB_DNS_CLASS_IN        1
+
+typedef struct {
+    char host[WEB_DNS_HOST_MAX];    /* 空字符串表示空位 */
+    uint32_t addr;                  /* 网络字节序，0表示尚无地址 */
+    uint32_t ttl_ms;
+    rt_tick_t resolved;             /* 最近一次解析成功的时刻 */
+    rt_tick_t last_used;
+    uint8_t resolving;              /* 前台或后台正在解析 */
+    uint8_t refresh_queued;         /* 等待后台刷新 */
+    uint8_t waiters;                /* 在 wait_sem 上等待解析结束的线程数 */
+} web_dns_entry_t;
+
+static struct {
+    struct rt_mutex lock;
+    rt_bool_t ready;
+    rt_sem_t refresh_sem;
+    rt_thread_t refresh_thread;
+    uint16_t query_id;
+    web_dns_entry_t entries[WEB_DNS_CACHE_SIZE];
+    rt_sem_t wait_sem[WEB_DNS_CACHE_SIZE];  /* 与表项一一对应，第一次等待时创建 */
+    web_dns_stats_t stats;
+} web_dns;
+
+/* 首次使用时初始化 */
+static void web_dns_lock(void)
+{
+    if (!web_dns.ready)
+    {
+        rt_enter_critical();
+        if (!web_dns.ready)
+        {
+            rt_mutex_init(&web_dns.lock, "web_dns", RT_IPC_FLAG_PRIO);
+            web_dns.ready = RT_TRUE;
+        }
+        rt_exit_critical();
+    }
+
+    rt_mutex_take(&web_dns.lock, RT_WAITING_FOREVER);
+}
+
+static void web_dns_unlock(void)
+{
+    rt_mutex_release(&web_dns.lock);
+}
+
+/* ==================== DNS查询 ==================== */
+
+/* 点分十进制地址不需要解析 */
+static rt_bool_t web_dns_parse_ipv4(const char *host, uint32_t *addr)
+{
+    uint8_t octets[4];
+    int value, i;
+
+    for (i = 0; i < 4; i++)
+    {
+        if (*host < '0' || *host > '9')
+        {
+            return RT_FALSE;
+        }
+        value = 0;
+        while (*host >= '0' && *host <= '9')
+        {
+            value = value * 10 + (*host++ - '0');
+            if (value > 255)
+            {
+                return RT_FALSE;
+            }
+        }
+        octets[i] = (uint8_t)value;
+        if (*host != (i < 3 ? '.' : '\0'))
+        {
+            return RT_FALSE;
+        }
+        host++;
+    }
+
+    rt_memcpy(addr, octets, sizeof(octets));
+    return RT_TRUE;
+}
+
+/* 网卡配置的DNS服务器；PC端由环境变量 WEB_DNS_SERVER 指定 */
+static int web_dns_server(struct sockaddr_in *server)
+{
+    uint32_t addr = 0;
+
+#ifdef RT_USING_NETDEV
+    if (netdev_default != RT_NULL)
+    {
+        rt_memcpy(&addr, &netdev_default->dns_servers[0], sizeof(addr));
+    }
+#else
+    const char *env = getenv("WEB_DNS_SERVER");
+    if (env == RT_NULL || !web_dns_parse_ipv4(env, &addr))
+    {
+        addr = 0;
+    }
+#endif
+
+    if (addr == 0)
+    {
+        return -RT_ERROR;
+    }
+
+    rt_memset(server, 0, sizeof(struct sockaddr_in));
+    server->sin_family = AF_INET;
+    server->sin_port = htons(WEB_DNS_PORT);
+    rt_memcpy(&server->sin_addr, &addr, sizeof(addr));
+    return RT_EOK;
+}
+
+/* 构造A记录查询，返回报文长度 */
+static int web_dns_build_query(uint8_t *buf, uint16_t id, const char *host)
+{
+    const char *label = host;
+    int pos = 12;
+    int len;
+
+    rt_memset(buf, 0, 12);
+    buf[0] = id >> 8;
+    buf[1] = id & 0xFF;
+    buf[2] = 0x01;              /* RD：请求递归 */
+    buf[5] = 1;                 /* QDCOUNT */
+
+    while (*label)
+    {
+        len = strcspn(label, ".");
+        if (len == 0 || len > 63 || pos + len + 6 > WEB_DNS_PACKET_MAX)
+        {
+            return -1;
+        }
+        buf[pos++] = (uint8_t)len;
+        rt_memcpy(&buf[pos], label, len);
+        pos += len;
+        label += len;
+        if (*label == '.')
+        {
+            label++;
+        }
+    }
+    buf[pos++] = 0;
+    buf[pos++] = 0;
+    buf[pos++] = WEB_DNS_TYPE_A;
+    buf[pos++] = 0;
+    buf[pos++] = WEB_DNS_CLASS_IN;
+
+    return pos;
+}
+
+/* 跳过报文中的域名（可能是压缩指针），返回之后的位置 */
+static int web_dns_skip_name(const uint8_t *buf, int len, int pos)
+{
+    while (pos < len)
+    {
+        if (buf[pos] == 0)
+        {
+            return pos + 1;
+        }
+        if ((buf[pos] & 0xC0) == 0xC0)
+        {
+            return pos + 2;
+        }
+        pos += buf[pos] + 1;
+    }
+
+    return -1;
+}
+
+/* 解析应答：取第一条A记录，TTL取CNAME链和A记录中最小的 */
+static int web_dns_parse_response(const uint8_t *buf, int len, uint16_t id,
+                                  uint32_t *addr, uint32_t *ttl_s)
+{
+    uint32_t ttl_min = WEB_DNS_TTL_MAX;
+    uint16_t qdcount, ancount, type, klass, rdlen;
+    uint32_t ttl;
+    int pos = 12;
+
+    if (len < 12 || ((buf[0] << 8) | buf[1]) != id || !(buf[2] & 0x80) || (buf[3] & 0x0F) != 0)
+    {
+        return -RT_ERROR;
+    }
+
+    qdcount = (buf[4] << 8) | buf[5];
+    ancount = (buf[6] << 8) | buf[7];
+
+    while (qdcount-- > 0)
+    {
+        pos = web_dns_skip_name(buf, len, pos);
+        if (pos < 0)
+        {
+            return -RT_ERROR;
+        }
+        pos += 4;
+    }
+
+    while (ancount-- > 0)
+    {
+        pos = web_dns_skip_name(buf, len, pos);
+        if (pos < 0 || pos + 10 > len)
+        {
+            return -RT_ERROR;
+        }
+
+        type = (buf[pos] << 8) | buf[pos + 1];
+        klass = (buf[pos + 2] << 8) | buf[pos + 3];
+        ttl = ((uint32_t)buf[pos + 4] << 24) | ((uint32_t)buf[pos + 5] << 16) |
+              ((uint32_t)buf[pos + 6] << 8) | buf[pos + 7];
+        rdlen = (buf[pos + 8] << 8) | buf[pos + 9];
+        pos += 10;
+        if (pos + rdlen > len)
+        {
+            return -RT_ERROR;
+        }
+
+        if (klass == WEB_DNS_CLASS_IN && (type == WEB_DNS_TYPE_A || type == WEB_DNS_TYPE_CNAME) &&
+            ttl < ttl_min)
+        {
+            ttl_min = ttl;
+        }
+
+        if (type == WEB_DNS_TYPE_A && klass == WEB_DNS_CLASS_IN && rdlen == 4)
+        {
+            rt_memcpy(addr, &buf[pos], 4);
+            *ttl_s = ttl_min;
+            return RT_EOK;
+        }
+        pos += rdlen;
+    }
+
+    return -RT_ERROR;
+}
+
+/* 向DNS服务器查询，得到地址和TTL */
+static int web_dns_query(const char *host, uint32_t *addr, uint32_t *ttl_s)
+{
+    struct sockaddr_in server;
+    struct timeval timeout = {WEB_DNS_QUERY_TIMEOUT / 1000, (WEB_DNS_QUERY_TIMEOUT % 1000) * 1000};
+    uint8_t *buf;
+    uint16_t id;
+    int query_len, recv_len;
+    int sock, attempt;
+    int ret = -RT_ERROR;
+
+    if (web_dns_server(&server) != RT_EOK)
+    {
+        return -RT_ERROR;
+    }
+
+    buf = (uint8_t *)rt_malloc(WEB_DNS_PACKET_MAX);
+    if (buf == RT_NULL)
+    {
+        return -RT_ENOMEM;
+    }
+
+    web_dns_lock();
+    id = (uint16_t)(++web_dns.query_id ^ rt_tick_get());
+    web_dns.stats.queries++;
+    web_dns_unlock();
+
+    query_len = web_dns_build_query(buf, id, host);
+    sock = query_len > 0 ? socket(AF_INET, SOCK_DGRAM, 0) : -1;
+    if (sock < 0)
+    {
+        rt_free(buf);
+        return -RT_ERROR;
+    }
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    for (attempt = 0; attempt < WEB_DNS_QUERY_RETRIES && ret != RT_EOK; attempt++)
+    {
+        web_dns_build_query(buf, id, host);
+        if (sendto(sock, buf, query_len, 0, (struct sockaddr *)&server, sizeof(server)) != query_len)
+        {
+            continue;
+        }
+
+        /* 丢弃ID不匹配的迟到应答，直到超时 */
+        while ((recv_len = recv(sock, buf, WEB_DNS_PACKET_MAX, 0)) > 0)
+        {
+            if (recv_len >= 2 && ((buf[0] << 8) | buf[1]) == id)
+            {
+                ret = web_dns_parse_response(buf, recv_len, id, addr, ttl_s);
+                break;
+            }
+        }
+
+        if (recv_len > 0 && ret != RT_EOK)
+        {
+            break;  /* 服务器明确应答但没有A记录（如NXDOMAIN），不再重试 */
+        }
+    }
+
+    closesocket(sock);
+    rt_free(buf);
+
+    return ret;
+}
+
+/* 系统解析器，没有TTL信息 */
+static int web_dns_query_system(const char *host, uint32_t *addr)
+{
+    struct hostent entry, *result = RT_NULL;
+    char buf[256];
+    int err = 0;
+
+    web_dns_lock();
+    web_dns.stats.fallbacks++;
+    web_dns_unlock();
+
+    if (gethostbyname_r(host, &entry, buf, sizeof(buf), &result, &err) != 0 ||
+        result == RT_NULL || result->h_addr == RT_NULL)
+    {
+        return -RT_ERROR;
+    }
+
+    rt_memcpy(addr, result->h_addr, sizeof(uint32_t));
+    return RT_EOK;
+}
+
+/* 解析一次：优先直接查询以得到TTL，失败时退回系统解析器 */
+static int web_dns_lookup(const char *host, uint32_t *addr, uint32_t *ttl_ms)
+{
+    uint32_t ttl_s;
+
+    if (web_dns_query(host, addr, &ttl_s) != RT_EOK)
+    {
+        if (web_dns_query_system(host, addr) != RT_EOK)
+        {
+            return -RT_ERROR;
+        }
+        ttl_s = WEB_DNS_TTL_DEFAULT;
+    }
+
+    if (ttl_s < WEB_DNS_TTL_MIN)
+    {
+        ttl_s = WEB_DNS_TTL_MIN;
+    }
+    if (ttl_s > WEB_DNS_TTL_MAX)
+    {
+        ttl_s = WEB_DNS_TTL_MAX;
+    }
+    *ttl_ms = ttl_s * 1000;
+
+    return RT_EOK;
+}
+
+/* ==================== 缓存 ==================== */
+
+static void web_dns_refresh_thread_entry(void *parameter);
+
+/* 节拍差先除后乘，避免乘1000溢出（1kHz节拍下约71分钟就会回绕成很小的值，过期条目被当作新的）；
+ * 超出毫秒表示范围的条目按已过期处理 */
+static uint32_t web_dns_age_ms(const web_dns_entry_t *entry)
+{
+    rt_tick_t delta = rt_tick_get() - entry->resolved;
+
+    if (delta / RT_TICK_PER_SECOND >= UINT32_MAX / 1000)
+    {
+        return UINT32_MAX;
+    }
+    return delta / RT_TICK_PER_SECOND * 1000 + delta % RT_TICK_PER_SECOND * 1000 / RT_TICK_PER_SECOND;
+}
+
+/* 查找表项（需持有锁）*/
+static web_dns_entry_t *web_dns_find(const char *host)
+{
+    int i;
+
+    for (i = 0; i < WEB_DNS_CACHE_SIZE; i++)
+    {
+        if (web_dns.entries[i].host[0] && strcmp(web_dns.entries[i].host, host) == 0)
+        {
+            return &web_dns.entries[i];
+        }
+    }
+
+    return RT_NULL;
+}
+
+/* 分配表项：空位优先，否则替换最久未用且不在解析中的表项（需持有锁）*/
+static web_dns_entry_t *web_dns_alloc(const char *host)
+{
+    web_dns_entry_t *slot = RT_NULL;
+    int i;
+
+    for (i = 0; i < WEB_DNS_CACHE_SIZE; i++)
+    {
+        web_dns_entry_t *entry = &web_dns.entries[i];
+        if (entry->host[0] == '\0')
+        {
+            slot = entry;
+            break;
+        }
+        if (!entry->resolving &&
+            (slot == RT_NULL || entry->last_used - slot->last_used > RT_TICK_MAX / 2))
+        {
+            slot = entry;
+        }
+    }
+
+    if (slot != RT_NULL)
+    {
+        rt_memset(slot, 0, sizeof(web_dns_entry_t));
+        strncpy(slot->host, host, sizeof(slot->host) - 1);
+        slot->last_used = rt_tick_get();
+    }
+
+    return slot;
+}
+
+/* 解析结束：唤醒等待这个表项的线程（需持有锁）*/
+static void web_dns_finish(web_dns_entry_t *entry)
+{
+    rt_sem_t sem = web_dns.wait_sem[entry - web_dns.entries];
+
+    entry->resolving = 0;
+    while (entry->waiters > 0)
+    {
+        rt_sem_release(sem);
+        entry->waiters--;
+    }
+}
+
+/* 命中后剩余TTL不足时交给后台线程刷新（需持有锁）*/
+static void web_dns_queue_refresh(web_dns_entry_t *entry)
+{
+    if (web_dns.refresh_thread == RT_NULL)
+    {
+        /* 信号量只创建一次，线程创建失败时留给下次重试 */
+        if (web_dns.refresh_sem == RT_NULL)
+        {
+            web_dns.refresh_sem = rt_sem_create("dns_ref", 0, RT_IPC_FLAG_FIFO);
+        }
+        if (web_dns.refresh_sem != RT_NULL)
+        {
+            web_dns.refresh_thread = rt_thread_create("web_dns", web_dns_refresh_thread_entry,
+                                                      RT_NULL, 1536, 20, 10);
+        }
+        if (web_dns.refresh_thread == RT_NULL)
+        {
+            LOG_W("DNS refresh thread not available");
+            return;
+        }
+        rt_thread_startup(web_dns.refresh_thread);
+    }
+
+    entry->resolving = 1;
+    entry->refresh_queued = 1;
+    rt_sem_release(web_dns.refresh_sem);
+}
+
+static void web_dns_refresh_thread_entry(void *parameter)
+{
+    char host[WEB_DNS_HOST_MAX];
+    web_dns_entry_t *entry;
+    uint32_t addr, ttl_ms;
+    int i, ret;
+
+    (void)parameter;
+    while (1)
+    {
+        rt_sem_take(web_dns.refresh_sem, RT_WAITING_FOREVER);
+
+        for (i = 0; i < WEB_DNS_CACHE_SIZE; i++)
+        {
+            web_dns_lock();
+            entry = &web_dns.entries[i];
+            if (!entry->refresh_queued)
+            {
+                web_dns_unlock();
+                continue;
+            }
+            entry->refresh_queued = 0;
+            rt_memcpy(host, entry->host, sizeof(host));
+            web_dns_unlock();
+
+            ret = web_dns_lookup(host, &addr, &ttl_ms);
+
+            /* 解析中的表项不会被替换，host不变 */
+            web_dns_lock();
+            if (ret == RT_EOK)
+            {
+                entry->addr = addr;
+                entry->ttl_ms = ttl_ms;
+                entry->resolved = rt_tick_get();
+                web_dns.stats.refreshes++;
+                LOG_D("Refreshed %s (ttl %d s)", host, ttl_ms / 1000);
+            }
+            else
+            {
+                web_dns.stats.refresh_failures++;
+                LOG_W("Background refresh of %s failed", host);
+            }
+            web_dns_finish(entry);
+            web_dns_unlock();
+        }
+    }
+}
+
+int web_dns_resolve(const char *host, uint32_t *addr)
+{
+    web_dns_entry_t *entry;
+    uint32_t new_addr, ttl_ms, age;
+    rt_bool_t waited = RT_FALSE;
+    rt_sem_t sem;
+    int ret;
+
+    if (host == RT_NULL || addr == RT_NULL || strlen(host) >= WEB_DNS_HOST_MAX)
+    {
+        return -RT_EINVAL;
+    }
+
+    if (web_dns_parse_ipv4(host, addr))
+    {
+        return RT_EOK;
+    }
+
+    web_dns_lock();
+
+    while (1)
+    {
+        entry = web_dns_find(host);
+        if (entry != RT_NULL && entry->addr != 0)
+        {
+            age = web_dns_age_ms(entry);
+            if (age < entry->ttl_ms)
+            {
+                web_dns.stats.hits++;
+                entry->last_used = rt_tick_get();
+                *addr = entry->addr;
+                if (!entry->resolving && age >= entry->ttl_ms / 100 * (100 - WEB_DNS_REFRESH_AHEAD))
+                {
+                    web_dns_queue_refresh(entry);
+                }
+                web_dns_unlock();
+                return RT_EOK;
+            }
+        }
+
+        /* 同一域名正在解析时等它完成，不重复查询；不同域名互不影响 */
+        if (entry == RT_NULL || !entry->resolving)
+        {
+            break;
+        }
+        sem = web_dns.wait_sem[entry - web_dns.entries];
+        if (sem == RT_NULL)
+        {
+            sem = rt_sem_create("dns_wait", 0, RT_IPC_FLAG_FIFO);
+            if (sem == RT_NULL)
+            {
+                /* 无法等待，单独解析一次，不缓存 */
+                web_dns_unlock();
+                return web_dns_lookup(host, addr, &ttl_ms);
+            }
+            web_dns.wait_sem[entry - web_dns.entries] = sem;
+        }
+        if (!waited)
+        {
+            web_dns.stats.waits++;
+            waited = RT_TRUE;
+        }
+        entry->waiters++;
+        web_dns_unlock();
+        rt_sem_take(sem, RT_WAITING_FOREVER);
+        web_dns_lock();
+    }
+
+    if (entry == RT_NULL)
+    {
+        entry = web_dns_alloc(host);
+    }
+    if (entry == RT_NULL)
+    {
+        /* 所有表项都在解析中，不缓存 */
+        web_dns_unlock();
+        return web_dns_lookup(host, addr, &ttl_ms);
+    }
+
+    web_dns.stats.misses++;
+    entry->resolving = 1;
+    entry->last_used = rt_tick_get();
+    web_dns_unlock();
+
+    ret = web_dns_lookup(host, &new_addr, &ttl_ms);
+
+    web_dns_lock();
+    if (ret == RT_EOK)
+    {
+        entry->addr = new_addr;
+        entry->ttl_ms = ttl_ms;
+        entry->resolved = rt_tick_get();
+        *addr = new_addr;
+        LOG_D("Resolved %s (ttl %d s)", host, ttl_ms / 1000);
+    }
+    else if (entry->addr != 0 && web_dns_age_ms(entry) < entry->ttl_ms + WEB_DNS_STALE_MAX * 1000)
+    {
+        web_dns.stats.stale_served++;
+        *addr = entry->addr;
+        ret = RT_EOK;
+        LOG_W("Failed to resolve %s, using expired address", host);
+    }
+    else
+    {
+        web_dns.stats.failures++;
+    }
+    web_dns_finish(entry);
+    web_dns_unlock();
+
+    return ret;
+}
+
+void web_dns_invalidate(const char *host)
+{
+    web_dns_entry_t *entry;
+
+    web_dns_lock();
+    entry = web_dns_find(host);
+    if (entry != RT_NULL && !entry->resolving)
+    {
+        entry->host[0] = '\0';
+    }
+    web_dns_unlock();
+}
+
+void web_dns_flush(void)
+{
+    int i;
+
+    web_dns_lock();
+    for (i = 0; i < WEB_DNS_CACHE_SIZE; i++)
+    {
+        if (!web_dns.entries[i].resolving)
+        {
+            web_dns.entries[i].host[0] = '\0';
+        }
+    }
+    web_dns_unlock();
+}
+
+void web_dns_get_stats(web_dns_stats_t *stats)
+{
+    web_dns_lock();
+    rt_memcpy(stats, &web_dns.stats, sizeof(web_dns_stats_t));
+    web_dns_unlock();
+}
+
+#ifdef FINSH_USING_MSH
+#include <finsh.h>
+
+static int cmd_dns_cache(int argc, char **argv)
+{
+    web_dns_stats_t stats;
+    web_dns_entry_t *entry;
+    uint8_t *ip;
+    uint32_t age;
+    int i;
+
+    if (argc > 1 && strcmp(argv[1], "flush") == 0)
+    {
+        web_dns_flush();
+        rt_kprintf("DNS cache flushed\n");
+        return 0;
+    }
+
+    if (argc > 2 && strcmp(argv[1], "resolve") == 0)
+    {
+        uint32_t addr;
+        rt_tick_t start = rt_tick_get();
+        int ret = web_dns_resolve(argv[2], &addr);
+
+        ip = (uint8_t *)&addr;
+        if (ret == RT_EOK)
+        {
+            rt_kprintf("%s -> %d.%d.%d.%d (%d ms)\n", argv[2], ip[0], ip[1], ip[2], ip[3],
+                       (rt_tick_get() - start) * 1000 / RT_TICK_PER_SECOND);
+        }
+        else
+        {
+            rt_kprintf("Failed to resolve %s\n", argv[2]);
+        }
+        return ret;
+    }
+
+    web_dns_get_stats(&stats);
+    rt_kprintf("Hits: %d, misses: %d, waits: %d, failures: %d, stale served: %d\n",
+               stats.hits, stats.misses, stats.waits, stats.failures, stats.stale_served);
+    rt_kprintf("Refreshes: %d, refresh failures: %d, queries: %d, system fallbacks: %d\n",
+               stats.refreshes, stats.refresh_failures, stats.queries, stats.fallbacks);
+
+    web_dns_lock();
+    for (i = 0; i < WEB_DNS_CACHE_SIZE; i++)
+    {
+        entry = &web_dns.entries[i];
+        if (entry->host[0] == '\0')
+        {
+            continue;
+        }
+        ip = (uint8_t *)&entry->addr;
+        age = web_dns_age_ms(entry);
+        rt_kprintf("  %-32s %d.%d.%d.%d  ttl %d s, expires in %d s%s\n", entry->host,
+                   ip[0], ip[1], ip[2], ip[3], entry->ttl_ms / 1000,
+                   age < entry->ttl_ms ? (entry->ttl_ms - age) / 1000 : 0,
+                   entry->resolving ? " (resolving)" : "");
+    }
+    web_dns_unlock();
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(cmd_dns_cache, dns_cache, Show DNS cache: dns_cache [flush|resolve <host>]);
+#endif
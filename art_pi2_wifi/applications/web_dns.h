@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-25     AI Assistant first version - DNS cache with TTL
+ */
+
+#ifndef __WEB_DNS_H__
+#define __WEB_DNS_H__
+
+/*
+ * web_client使用的域名缓存：
+ *   - 直接向网卡的DNS服务器发送A记录查询，按应答中的TTL缓存（限制在[TTL_MIN, TTL_MAX]内）；
+ *     查询失败时退回系统解析器 (gethostbyname_r)，使用默认TTL
+ *   - 表锁只保护缓存表，解析期间不持有；不同域名可以同时解析，同一域名只发一次查询
+ *   - 命中时剩余TTL不足 REFRESH_AHEAD 时由后台线程提前刷新，请求线程不等待
+ *   - 过期后重新解析失败时，在 STALE_MAX 内继续使用旧地址
+ */
+
+#include <rtthread.h>
+
+#define WEB_DNS_CACHE_SIZE          8
+#define WEB_DNS_HOST_MAX            128
+#define WEB_DNS_TTL_MIN             30      /* 秒 */
+#define WEB_DNS_TTL_MAX             3600    /* 秒 */
+#define WEB_DNS_TTL_DEFAULT         300     /* 系统解析器不提供TTL时使用 (秒) */
+#define WEB_DNS_REFRESH_AHEAD       20      /* 剩余TTL少于此百分比时后台刷新 */
+#define WEB_DNS_STALE_MAX           600     /* 过期后解析失败时仍可使用旧地址的时长 (秒) */
+#define WEB_DNS_QUERY_TIMEOUT       2000    /* 单次查询超时 (ms) */
+#define WEB_DNS_QUERY_RETRIES       2
+
+typedef struct {
+    uint32_t hits;              /* 命中缓存 */
+    uint32_t misses;            /* 未命中或已过期，前台解析 */
+    uint32_t waits;             /* 等待同一域名正在进行的解析 */
+    uint32_t refreshes;         /* 后台提前刷新 */
+    uint32_t refresh_failures;
+    uint32_t stale_served;      /* 解析失败，使用过期的旧地址 */
+    uint32_t failures;          /* 解析失败且没有可用地址 */
+    uint32_t queries;           /* 直接发送的DNS查询 */
+    uint32_t fallbacks;         /* 退回系统解析器 */
+} web_dns_stats_t;
+
+/* 解析域名或点分十进制地址，addr为网络字节序的IPv4地址 */
+int web_dns_resolve(const char *host, uint32_t *addr);
+
+/* 连接失败时使缓存的地址失效，下次重新解析 */
+void web_dns_invalidate(const char *host);
+
+void web_dns_flush(void);
+void web_dns_get_stats(web_dns_stats_t *stats);
+
+#endif /* __WEB_DNS_H__ */
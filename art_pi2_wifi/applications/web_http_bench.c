@@ -0,0 +1,690 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-26     AI Assistant first version - HTTP parser fuzz/benchmark
+ */
+
+/*
+ * HTTP响应解析器的随机测试和性能对比，不需要网络，响应在内存中生成后按随机长度分段送入：
+ *   1. 随机响应：Content-Length/chunked/读到关闭，随机chunk长度和扩展、trailer、100 Continue、
+ *      超长响应头，逐段送入解析器，校验响应体长度、校验和、keep-alive和消耗的字节数
+ *      chunk长度行的边界情况（只有LF、扩展、CR后不是LF）整段和逐字节各送入一遍
+ *   2. 变异：随机改写或截断上面的响应，解析器只能报错或正常结束，不能越界（PC端配合 -fsanitize=address）
+ *   3. 性能：缓冲式接收（响应体保存到内存）的吞吐量和堆内存峰值，
+ *      与原实现（16KB接收缓冲区 + strstr找响应头 + 拷贝响应体）对比
+ *
+ * 设备端：http_bench [随机测试次数]
+ * PC端（与设备端同一份web_http_parser.c）：
+ *   gcc -O2 -DWEB_HTTP_BENCH_MAIN -I../host -I. web_http_parser.c web_http_bench.c -o http_bench
+ *   gcc -g -fsanitize=address,undefined -DWEB_HTTP_BENCH_MAIN -I../host -I. web_http_parser.c web_http_bench.c -o http_fuzz
+ *   ./http_bench 20000
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include "web_http_parser.h"
+
+#define HTTP_BENCH_RECV_SIZE        (2 * 1024)  /* 与web_client.c的接收块相同 */
+#define HTTP_BENCH_LEGACY_MAX       (16 * 1024) /* 原实现的响应缓冲区 */
+#define HTTP_BENCH_BODY_MAX         (64 * 1024)
+#define HTTP_BENCH_MSS              1460        /* 性能测试中每次recv得到的字节数 */
+
+typedef enum {
+    HTTP_BENCH_LENGTH = 0,      /* Content-Length */
+    HTTP_BENCH_CHUNKED,
+    HTTP_BENCH_EOF,             /* 读到连接关闭 */
+} http_bench_framing_t;
+
+/* 内存中的一条响应 */
+typedef struct {
+    uint8_t *wire;
+    uint32_t len;
+    uint32_t capacity;
+    uint32_t body_len;
+    uint32_t body_sum;
+    int framing;
+    rt_bool_t keep_alive;
+} http_bench_msg_t;
+
+/* 解析结果 */
+typedef struct {
+    uint32_t body_len;
+    uint32_t body_sum;
+    char *body;                 /* 缓冲式接收时保存的响应体 */
+    uint32_t capacity;
+} http_bench_result_t;
+
+static uint32_t http_bench_seed = 1;
+
+static uint32_t http_bench_rand(void)
+{
+    http_bench_seed = http_bench_seed * 1103515245 + 12345;
+    return (http_bench_seed >> 8) & 0xFFFFFF;
+}
+
+static uint32_t http_bench_sum(uint32_t sum, const uint8_t *data, uint32_t len)
+{
+    while (len--)
+    {
+        sum = sum * 31 + *data++;
+    }
+    return sum;
+}
+
+/* ==================== 堆内存统计 ==================== */
+
+static struct {
+    uint32_t current;
+    uint32_t peak;
+} http_bench_heap;
+
+static void *http_bench_malloc(uint32_t size)
+{
+    uint32_t *p = (uint32_t *)rt_malloc(size + sizeof(uint32_t) * 2);
+
+    if (p == RT_NULL)
+    {
+        return RT_NULL;
+    }
+    p[0] = size;
+    http_bench_heap.current += size;
+    if (http_bench_heap.current > http_bench_heap.peak)
+    {
+        http_bench_heap.peak = http_bench_heap.current;
+    }
+    return p + 2;
+}
+
+static void *http_bench_realloc(void *ptr, uint32_t size)
+{
+    uint32_t *p = ptr ? (uint32_t *)ptr - 2 : RT_NULL;
+    uint32_t old = p ? p[0] : 0;
+
+    p = (uint32_t *)rt_realloc(p, size + sizeof(uint32_t) * 2);
+    if (p == RT_NULL)
+    {
+        return RT_NULL;
+    }
+    p[0] = size;
+    http_bench_heap.current += size - old;
+    if (http_bench_heap.current > http_bench_heap.peak)
+    {
+        http_bench_heap.peak = http_bench_heap.current;
+    }
+    return p + 2;
+}
+
+static void http_bench_free(void *ptr)
+{
+    if (ptr)
+    {
+        uint32_t *p = (uint32_t *)ptr - 2;
+        http_bench_heap.current -= p[0];
+        rt_free(p);
+    }
+}
+
+/* ==================== 生成响应 ==================== */
+
+static void http_bench_put(http_bench_msg_t *msg, const void *data, uint32_t len)
+{
+    rt_memcpy(msg->wire + msg->len, data, len);
+    msg->len += len;
+}
+
+static void http_bench_printf(http_bench_msg_t *msg, const char *text)
+{
+    http_bench_put(msg, text, strlen(text));
+}
+
+/* 随机或指定的响应；chunk_max为0时随机选择 */
+static int http_bench_generate(http_bench_msg_t *msg, int framing, uint32_t body_len,
+                               uint32_t chunk_max, rt_bool_t variants)
+{
+    char line[400];
+    uint32_t i, n, offset;
+    uint32_t chunk_min;
+
+    if (chunk_max == 0)
+    {
+        chunk_max = (http_bench_rand() & 1) ? 16 : 4096;
+    }
+    chunk_min = chunk_max > 1024 ? 1024 : 1;
+
+    msg->capacity = 1024 + body_len + (body_len / chunk_min + 1) * 48;
+    msg->wire = (uint8_t *)rt_malloc(msg->capacity);
+    if (msg->wire == RT_NULL)
+    {
+        return -RT_ENOMEM;
+    }
+    msg->len = 0;
+    msg->framing = framing;
+    msg->body_len = body_len;
+    msg->keep_alive = (framing != HTTP_BENCH_EOF);
+
+    if (variants && http_bench_rand() % 4 == 0)
+    {
+        http_bench_printf(msg, "HTTP/1.1 100 Continue\r\n\r\n");
+    }
+    http_bench_printf(msg, "HTTP/1.1 200 OK\r\n");
+
+    if (variants)
+    {
+        if (http_bench_rand() % 2)
+        {
+            http_bench_printf(msg, "content-type:audio/L16;rate=16000\r\n");
+        }
+        if (http_bench_rand() % 4 == 0)
+        {
+            /* 超过行缓冲的响应头 */
+            rt_memset(line, 'x', sizeof(line));
+            rt_memcpy(line, "X-Padding: ", 11);
+            rt_memcpy(line + sizeof(line) - 3, "\r\n", 3);
+            http_bench_printf(msg, line);
+        }
+        if (http_bench_rand() % 4 == 0)
+        {
+            http_bench_printf(msg, "Connection: close\r\n");
+            msg->keep_alive = RT_FALSE;
+        }
+    }
+
+    if (framing == HTTP_BENCH_LENGTH)
+    {
+        rt_snprintf(line, sizeof(line), "Content-Length: %u\r\n", (unsigned)body_len);
+        http_bench_printf(msg, line);
+    }
+    else if (framing == HTTP_BENCH_CHUNKED)
+    {
+        http_bench_printf(msg, variants && (http_bench_rand() & 1) ?
+                          "transfer-encoding: chunked\r\n" : "Transfer-Encoding: chunked\r\n");
+    }
+    http_bench_printf(msg, "\r\n");
+
+    /* 响应体是伪随机字节，包含CR/LF和0 */
+    msg->body_sum = 0;
+    offset = 0;
+    while (offset < body_len)
+    {
+        n = body_len - offset;
+        if (framing == HTTP_BENCH_CHUNKED)
+        {
+            uint32_t size = chunk_min + http_bench_rand() % (chunk_max - chunk_min + 1);
+            if (n > size)
+            {
+                n = size;
+            }
+            rt_snprintf(line, sizeof(line), (variants && http_bench_rand() % 8 == 0) ? "%X;ext=1\r\n" : "%x\r\n",
+                        (unsigned)n);
+            http_bench_printf(msg, line);
+        }
+        for (i = 0; i < n; i++)
+        {
+            msg->wire[msg->len + i] = (uint8_t)(http_bench_rand() >> 4);
+        }
+        msg->body_sum = http_bench_sum(msg->body_sum, msg->wire + msg->len, n);
+        msg->len += n;
+        offset += n;
+        if (framing == HTTP_BENCH_CHUNKED)
+        {
+            http_bench_printf(msg, "\r\n");
+        }
+    }
+
+    if (framing == HTTP_BENCH_CHUNKED)
+    {
+        http_bench_printf(msg, variants && http_bench_rand() % 4 == 0 ? "0\r\nX-Trailer: 1\r\n\r\n" : "0\r\n\r\n");
+    }
+
+    return RT_EOK;
+}
+
+/* ==================== 新实现：增量解析 ==================== */
+
+static int http_bench_on_body(web_http_parser_t *parser, const uint8_t *data, uint32_t len, void *user_data)
+{
+    http_bench_result_t *result = (http_bench_result_t *)user_data;
+
+    (void)parser;
+    result->body_sum = http_bench_sum(result->body_sum, data, len);
+    result->body_len += len;
+    return RT_EOK;
+}
+
+/* 与web_client.c的缓冲式接收相同：Content-Length时一次分配，否则按需加倍 */
+static int http_bench_on_headers_buffered(web_http_parser_t *parser, void *user_data)
+{
+    http_bench_result_t *result = (http_bench_result_t *)user_data;
+
+    result->capacity = parser->content_len >= 0 ? parser->content_len : 1024;
+    result->body = (char *)http_bench_malloc(result->capacity + 1);
+    return result->body ? RT_EOK : -RT_ENOMEM;
+}
+
+static int http_bench_on_body_buffered(web_http_parser_t *parser, const uint8_t *data, uint32_t len,
+                                       void *user_data)
+{
+    http_bench_result_t *result = (http_bench_result_t *)user_data;
+    uint32_t size = result->body_len + len;
+
+    (void)parser;
+    if (size > result->capacity)
+    {
+        if (size < result->capacity * 2)
+        {
+            size = result->capacity * 2;
+        }
+        result->body = (char *)http_bench_realloc(result->body, size + 1);
+        if (result->body == RT_NULL)
+        {
+            return -RT_ENOMEM;
+        }
+        result->capacity = size;
+    }
+    rt_memcpy(result->body + result->body_len, data, len);
+    result->body_len += len;
+    result->body[result->body_len] = '\0';
+    return RT_EOK;
+}
+
+/*
+ * 按段送入解析器，seg为0时每段长度随机；buffered时模拟web_client的缓冲式接收
+ * 返回RT_EOK表示得到完整的响应，*used为消耗的字节数
+ */
+static int http_bench_parse(const uint8_t *wire, uint32_t len, uint32_t seg, rt_bool_t buffered,
+                            web_http_parser_t *parser, http_bench_result_t *result, uint32_t *used)
+{
+    uint8_t *buffer;
+    uint32_t offset = 0;
+    uint32_t n;
+    int ret = RT_EOK;
+
+    rt_memset(result, 0, sizeof(http_bench_result_t));
+    if (buffered)
+    {
+        web_http_parser_init(parser, http_bench_on_headers_buffered, http_bench_on_body_buffered, result);
+    }
+    else
+    {
+        web_http_parser_init(parser, RT_NULL, http_bench_on_body, result);
+    }
+
+    buffer = (uint8_t *)http_bench_malloc(HTTP_BENCH_RECV_SIZE);
+    if (buffer == RT_NULL)
+    {
+        return -RT_ENOMEM;
+    }
+
+    *used = 0;
+    while (!web_http_parser_done(parser))
+    {
+        if (offset >= len)
+        {
+            ret = web_http_parser_finish(parser);
+            break;
+        }
+
+        /* 模拟recv：从"网络"拷贝到接收缓冲区 */
+        n = seg ? seg : 1 + http_bench_rand() % HTTP_BENCH_RECV_SIZE;
+        if (n > HTTP_BENCH_RECV_SIZE)
+        {
+            n = HTTP_BENCH_RECV_SIZE;
+        }
+        if (n > len - offset)
+        {
+            n = len - offset;
+        }
+        rt_memcpy(buffer, wire + offset, n);
+        offset += n;
+
+        ret = web_http_parser_execute(parser, buffer, n);
+        if (ret < 0)
+        {
+            break;
+        }
+        *used = offset - n + ret;
+        ret = RT_EOK;
+    }
+
+    http_bench_free(buffer);
+
+    if (buffered && result->body)
+    {
+        result->body_sum = http_bench_sum(0, (const uint8_t *)result->body, result->body_len);
+        http_bench_free(result->body);
+        result->body = RT_NULL;
+    }
+
+    return ret;
+}
+
+/* ==================== 原实现 ==================== */
+
+/*
+ * 原web_client_recv_response的做法：16KB缓冲区收到Content-Length为止或连接关闭，
+ * 每次recv后strstr查找响应头结束，最后把响应体拷贝到新分配的内存；不识别chunked，超长截断
+ */
+static int http_bench_legacy(const uint8_t *wire, uint32_t len, uint32_t seg, http_bench_result_t *result)
+{
+    char *buffer;
+    char *header_end = RT_NULL;
+    char *body;
+    const char *value;
+    uint32_t offset = 0;
+    int total_len = 0;
+    int expected_len = -1;
+    int limit, n;
+
+    rt_memset(result, 0, sizeof(http_bench_result_t));
+
+    buffer = (char *)http_bench_malloc(HTTP_BENCH_LEGACY_MAX);
+    if (buffer == RT_NULL)
+    {
+        return -RT_ENOMEM;
+    }
+
+    while (1)
+    {
+        limit = HTTP_BENCH_LEGACY_MAX - 1;
+        if (expected_len >= 0 && expected_len < limit)
+        {
+            limit = expected_len;
+        }
+        if (total_len >= limit || offset >= len)
+        {
+            break;
+        }
+
+        n = limit - total_len;
+        if (n > (int)seg)
+        {
+            n = seg;
+        }
+        if (n > (int)(len - offset))
+        {
+            n = len - offset;
+        }
+        rt_memcpy(buffer + total_len, wire + offset, n);
+        offset += n;
+        total_len += n;
+        buffer[total_len] = '\0';
+
+        if (header_end == RT_NULL && (header_end = strstr(buffer, "\r\n\r\n")) != RT_NULL)
+        {
+            value = strstr(buffer, "Content-Length:");
+            if (value && value < header_end)
+            {
+                expected_len = (int)(header_end + 4 - buffer) + atoi(value + 15);
+            }
+        }
+    }
+
+    if (header_end == RT_NULL)
+    {
+        http_bench_free(buffer);
+        return -RT_ERROR;
+    }
+
+    result->body_len = total_len - (header_end + 4 - buffer);
+    body = (char *)http_bench_malloc(result->body_len + 1);
+    if (body)
+    {
+        rt_memcpy(body, header_end + 4, result->body_len);
+        body[result->body_len] = '\0';
+        result->body_sum = http_bench_sum(0, (const uint8_t *)body, result->body_len);
+        http_bench_free(body);
+    }
+    http_bench_free(buffer);
+
+    return RT_EOK;
+}
+
+/* ==================== 测试 ==================== */
+
+/* 随机响应逐段解析，返回不一致的次数 */
+static int http_bench_fuzz(int count)
+{
+    static const char *framing_name[] = {"length", "chunked", "eof"};
+    http_bench_msg_t msg;
+    http_bench_result_t result;
+    web_http_parser_t parser;
+    uint32_t used, body_len;
+    int mismatches = 0;
+    int i, ret;
+
+    for (i = 0; i < count; i++)
+    {
+        int framing = http_bench_rand() % 3;
+        body_len = (http_bench_rand() % 4 == 0) ? http_bench_rand() % 16 : http_bench_rand() % HTTP_BENCH_BODY_MAX;
+
+        if (http_bench_generate(&msg, framing, body_len, 0, RT_TRUE) != RT_EOK)
+        {
+            rt_kprintf("Out of memory\n");
+            return -1;
+        }
+
+        ret = http_bench_parse(msg.wire, msg.len, 0, i & 1, &parser, &result, &used);
+        if (ret != RT_EOK || result.body_len != msg.body_len || result.body_sum != msg.body_sum ||
+            parser.status_code != 200 || parser.keep_alive != msg.keep_alive || used != msg.len)
+        {
+            if (mismatches++ < 5)
+            {
+                rt_kprintf("Mismatch #%d (%s, %d bytes): ret %d, body %d/%d, used %d/%d, keep-alive %d/%d\n",
+                           i, framing_name[framing], msg.body_len, ret, result.body_len, msg.body_len,
+                           used, msg.len, parser.keep_alive, msg.keep_alive);
+            }
+        }
+        rt_free(msg.wire);
+    }
+
+    return mismatches;
+}
+
+/* chunk长度行的边界情况，整段和逐字节送入各一遍，返回结果不符的个数 */
+static int http_bench_chunk_edges(void)
+{
+    static const struct {
+        const char *chunks;
+        int ok;
+        uint32_t body_len;
+    } cases[] = {
+        {"1\r\nX\r\n0\r\n\r\n",         1, 1},
+        {"1\nX\n0\n\n",                 1, 1},      /* 只有LF */
+        {"A;name=val\r\n0123456789\r\n0\r\n\r\n", 1, 10},
+        {"1\r2\r\n",                    0, 0},      /* CR后不是LF，不能拼成0x12 */
+        {"1\r\rX\r\n0\r\n\r\n",         0, 0},
+        {"1\r X\r\n0\r\n\r\n",          0, 0},
+        {"\r\nX\r\n0\r\n\r\n",          0, 0},      /* 没有长度 */
+    };
+    static const char head[] = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n";
+    http_bench_result_t result;
+    web_http_parser_t parser;
+    uint8_t wire[128];
+    uint32_t len, used, seg;
+    int failures = 0;
+    int i, ok;
+
+    for (i = 0; i < (int)(sizeof(cases) / sizeof(cases[0])); i++)
+    {
+        len = rt_strlen(head) + rt_strlen(cases[i].chunks);
+        rt_memcpy(wire, head, rt_strlen(head));
+        rt_memcpy(wire + rt_strlen(head), cases[i].chunks, rt_strlen(cases[i].chunks));
+
+        for (seg = 1; seg <= len; seg += len - 1)
+        {
+            ok = http_bench_parse(wire, len, seg, RT_FALSE, &parser, &result, &used) == RT_EOK;
+            if (ok != cases[i].ok || (ok && result.body_len != cases[i].body_len))
+            {
+                rt_kprintf("Chunk edge case #%d (%d-byte segments): %s, body %d\n",
+                           i, seg, ok ? "accepted" : "rejected", result.body_len);
+                failures++;
+            }
+        }
+    }
+
+    return failures;
+}
+
+/* 随机改写或截断响应，解析器须正常返回，返回被拒绝的次数 */
+static int http_bench_mutate(int count, int *accepted)
+{
+    http_bench_msg_t msg;
+    http_bench_result_t result;
+    web_http_parser_t parser;
+    uint32_t used, n;
+    int rejected = 0;
+    int i, k;
+
+    *accepted = 0;
+    for (i = 0; i < count; i++)
+    {
+        if (http_bench_generate(&msg, http_bench_rand() % 3, http_bench_rand() % 2048, 16, RT_TRUE) != RT_EOK)
+        {
+            return -1;
+        }
+
+        /* 变异集中在响应头和chunk长度行所在的前部 */
+        n = 1 + http_bench_rand() % 4;
+        for (k = 0; k < (int)n; k++)
+        {
+            uint32_t pos = http_bench_rand() % (msg.len < 256 ? msg.len : 256);
+            static const char alphabet[] = "\r\n:; 0123456789abcdefXHTP/.-";
+            msg.wire[pos] = (http_bench_rand() & 1) ? (uint8_t)http_bench_rand() :
+                            (uint8_t)alphabet[http_bench_rand() % (sizeof(alphabet) - 1)];
+        }
+        if (http_bench_rand() % 4 == 0)
+        {
+            msg.len = http_bench_rand() % msg.len;
+        }
+
+        if (http_bench_parse(msg.wire, msg.len, 0, i & 1, &parser, &result, &used) == RT_EOK)
+        {
+            (*accepted)++;
+        }
+        else
+        {
+            rejected++;
+        }
+        if (used > msg.len || parser.body_len > msg.len)
+        {
+            rt_kprintf("Mutation #%d: consumed %d of %d bytes\n", i, used, msg.len);
+        }
+        rt_free(msg.wire);
+    }
+
+    return rejected;
+}
+
+/* 缓冲式接收的吞吐量和堆峰值 */
+static void http_bench_throughput(int framing, uint32_t body_len)
+{
+    http_bench_msg_t msg;
+    http_bench_result_t result;
+    web_http_parser_t parser;
+    uint32_t used, bytes, peak_legacy, peak_parser, result_legacy_len;
+    rt_tick_t start, legacy_ticks, parser_ticks;
+    int iterations, i, ret;
+    rt_bool_t legacy_ok;
+
+    if (http_bench_generate(&msg, framing, body_len, 4096, RT_FALSE) != RT_EOK)
+    {
+        rt_kprintf("Out of memory\n");
+        return;
+    }
+
+    /* 每项约处理16MB */
+    iterations = (16 * 1024 * 1024) / msg.len + 1;
+    bytes = 0;
+
+    http_bench_heap.peak = http_bench_heap.current = 0;
+    ret = http_bench_legacy(msg.wire, msg.len, HTTP_BENCH_MSS, &result);
+    legacy_ok = (ret == RT_EOK && result.body_len == msg.body_len && result.body_sum == msg.body_sum);
+    result_legacy_len = result.body_len;
+    start = rt_tick_get();
+    for (i = 0; i < iterations; i++)
+    {
+        http_bench_legacy(msg.wire, msg.len, HTTP_BENCH_MSS, &result);
+    }
+    legacy_ticks = rt_tick_get() - start;
+    peak_legacy = http_bench_heap.peak;
+
+    http_bench_heap.peak = http_bench_heap.current = 0;
+    start = rt_tick_get();
+    for (i = 0; i < iterations; i++)
+    {
+        ret = http_bench_parse(msg.wire, msg.len, HTTP_BENCH_MSS, RT_TRUE, &parser, &result, &used);
+        bytes += msg.len;
+    }
+    parser_ticks = rt_tick_get() - start;
+    peak_parser = http_bench_heap.peak;
+
+    if (legacy_ticks == 0)
+    {
+        legacy_ticks = 1;
+    }
+    if (parser_ticks == 0)
+    {
+        parser_ticks = 1;
+    }
+
+    rt_kprintf("%-8s %6d B  legacy: %5d MB/s, peak %6d B%-12s  parser: %5d MB/s, peak %6d B%s\n",
+               framing == HTTP_BENCH_CHUNKED ? "chunked" : "length", body_len,
+               (int)((uint64_t)bytes * RT_TICK_PER_SECOND / legacy_ticks / (1024 * 1024)), peak_legacy,
+               legacy_ok ? "" : (result_legacy_len < msg.body_len ? " (truncated)" : " (wrong body)"),
+               (int)((uint64_t)bytes * RT_TICK_PER_SECOND / parser_ticks / (1024 * 1024)), peak_parser,
+               ret == RT_EOK && result.body_sum == msg.body_sum ? "" : " (wrong body)");
+
+    rt_free(msg.wire);
+}
+
+static int http_bench(int count)
+{
+    static const uint32_t sizes[] = {256, 4096, 15 * 1024, 64 * 1024};
+    int mismatches, rejected, accepted, edges;
+    int i;
+
+    if (count <= 0)
+    {
+        count = 2000;
+    }
+    http_bench_seed = 1;
+
+    mismatches = http_bench_fuzz(count);
+    rt_kprintf("Random responses: %d, mismatches: %d\n", count, mismatches);
+
+    edges = http_bench_chunk_edges();
+    rt_kprintf("Chunk size edge cases: %s\n", edges == 0 ? "ok" : "FAILED");
+
+    rejected = http_bench_mutate(count, &accepted);
+    rt_kprintf("Mutated responses: %d, rejected: %d, accepted: %d\n", count, rejected, accepted);
+
+    for (i = 0; i < (int)(sizeof(sizes) / sizeof(sizes[0])); i++)
+    {
+        http_bench_throughput(HTTP_BENCH_LENGTH, sizes[i]);
+    }
+    http_bench_throughput(HTTP_BENCH_CHUNKED, 64 * 1024);
+
+    return mismatches == 0 && edges == 0 ? 0 : -1;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+#include <finsh.h>
+
+static int cmd_http_bench(int argc, char **argv)
+{
+    return http_bench(argc > 1 ? atoi(argv[1]) : 2000);
+}
+MSH_CMD_EXPORT_ALIAS(cmd_http_bench, http_bench, HTTP parser fuzz and benchmark: http_bench [count]);
+#endif
+
+#ifdef WEB_HTTP_BENCH_MAIN
+int main(int argc, char **argv)
+{
+    return http_bench(argc > 1 ? atoi(argv[1]) : 2000) == 0 ? 0 : 1;
+}
+#endif
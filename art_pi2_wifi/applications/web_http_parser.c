@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-26     AI Assistant first version - Incremental HTTP response parser
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include "web_http_parser.h"
+
+#define DBG_TAG "web.http"
+#define DBG_LVL DBG_INFO
+#include <rtdbg.h>
+
+#define WEB_HTTP_CHUNK_DIGITS_MAX   7       /* chunk长度上限 0xFFFFFFF */
+
+void web_http_parser_init(web_http_parser_t *parser, web_http_headers_cb on_headers,
+                          web_http_body_cb on_body, void *user_data)
+{
+    rt_memset(parser, 0, sizeof(web_http_parser_t));
+    parser->state = WEB_HTTP_STATE_STATUS;
+    parser->content_len = -1;
+    parser->on_headers = on_headers;
+    parser->on_body = on_body;
+    parser->user_data = user_data;
+}
+
+static int web_http_parser_fail(web_http_parser_t *parser, const char *reason)
+{
+    LOG_D("Malformed HTTP response: %s", reason);
+    parser->state = WEB_HTTP_STATE_ERROR;
+    return -RT_ERROR;
+}
+
+/* 状态行：HTTP/1.x NNN reason */
+static int web_http_parse_status(web_http_parser_t *parser)
+{
+    const char *line = parser->line;
+    int code = 0;
+    int i;
+
+    if (parser->line_len < 12 || strncmp(line, "HTTP/1.", 7) != 0 || line[8] != ' ')
+    {
+        return web_http_parser_fail(parser, "status line");
+    }
+
+    for (i = 9; i < 12; i++)
+    {
+        if (line[i] < '0' || line[i] > '9')
+        {
+            return web_http_parser_fail(parser, "status code");
+        }
+        code = code * 10 + (line[i] - '0');
+    }
+
+    parser->status_code = code;
+    parser->keep_alive = (line[7] == '1');
+    parser->state = WEB_HTTP_STATE_HEADER;
+
+    return RT_EOK;
+}
+
+/* 响应头中与解析有关的字段，其余忽略 */
+static int web_http_parse_header(web_http_parser_t *parser)
+{
+    char *line = parser->line;
+    char *value = strchr(line, ':');
+    size_t name_len, len;
+
+    if (value == RT_NULL)
+    {
+        return web_http_parser_fail(parser, "header line");
+    }
+    name_len = value - line;
+
+    value++;
+    while (*value == ' ' || *value == '\t')
+    {
+        value++;
+    }
+    len = strlen(value);
+    while (len > 0 && (value[len - 1] == ' ' || value[len - 1] == '\t'))
+    {
+        value[--len] = '\0';
+    }
+
+    if (name_len == 14 && strncasecmp(line, "Content-Length", 14) == 0)
+    {
+        char *end;
+        long content_len = strtol(value, &end, 10);
+        if (end == value || *end != '\0' || content_len < 0 || content_len > 0x7FFFFFFF)
+        {
+            return web_http_parser_fail(parser, "Content-Length");
+        }
+        parser->content_len = (int32_t)content_len;
+    }
+    else if (name_len == 17 && strncasecmp(line, "Transfer-Encoding", 17) == 0)
+    {
+        /* chunked必须是最后一种编码 */
+        parser->chunked = (len >= 7 && strcasecmp(value + len - 7, "chunked") == 0);
+    }
+    else if (name_len == 10 && strncasecmp(line, "Connection", 10) == 0)
+    {
+        if (strcasecmp(value, "close") == 0)
+        {
+            parser->keep_alive = RT_FALSE;
+        }
+    }
+    else if (name_len == 12 && strncasecmp(line, "Content-Type", 12) == 0)
+    {
+        strncpy(parser->content_type, value, sizeof(parser->content_type) - 1);
+        parser->content_type[sizeof(parser->content_type) - 1] = '\0';
+    }
+
+    return RT_EOK;
+}
+
+/* 空行：响应头结束，确定响应体的长度 */
+static int web_http_headers_complete(web_http_parser_t *parser)
+{
+    if (parser->status_code >= 100 && parser->status_code < 200)
+    {
+        /* 临时响应，后面还有正式的响应 */
+        web_http_parser_init(parser, parser->on_headers, parser->on_body, parser->user_data);
+        return RT_EOK;
+    }
+
+    if (parser->chunked)
+    {
+        parser->content_len = -1;
+        parser->state = WEB_HTTP_STATE_CHUNK_SIZE;
+    }
+    else if (parser->status_code == 204 || parser->status_code == 304)
+    {
+        parser->content_len = 0;
+        parser->state = WEB_HTTP_STATE_DONE;
+    }
+    else if (parser->content_len >= 0)
+    {
+        parser->remaining = parser->content_len;
+        parser->state = parser->remaining > 0 ? WEB_HTTP_STATE_BODY : WEB_HTTP_STATE_DONE;
+    }
+    else
+    {
+        /* 没有声明长度，只能读到连接关闭，连接不能复用 */
+        parser->keep_alive = RT_FALSE;
+        parser->state = WEB_HTTP_STATE_BODY_EOF;
+    }
+
+    if (parser->on_headers && parser->on_headers(parser, parser->user_data) != RT_EOK)
+    {
+        parser->state = WEB_HTTP_STATE_ERROR;
+        return -RT_EINTR;
+    }
+
+    return RT_EOK;
+}
+
+/* 把一段输入追加到行缓冲，超长部分丢弃 */
+static void web_http_line_append(web_http_parser_t *parser, const uint8_t *data, uint32_t len)
+{
+    if (len > (uint32_t)(WEB_HTTP_LINE_MAX - 1 - parser->line_len))
+    {
+        len = WEB_HTTP_LINE_MAX - 1 - parser->line_len;
+    }
+    rt_memcpy(parser->line + parser->line_len, data, len);
+    parser->line_len += len;
+}
+
+static int web_http_deliver(web_http_parser_t *parser, const uint8_t *data, uint32_t len)
+{
+    parser->body_len += len;
+    if (parser->on_body && parser->on_body(parser, data, len, parser->user_data) != RT_EOK)
+    {
+        parser->state = WEB_HTTP_STATE_ERROR;
+        return -RT_EINTR;
+    }
+    return RT_EOK;
+}
+
+int web_http_parser_execute(web_http_parser_t *parser, const uint8_t *data, uint32_t len)
+{
+    const uint8_t *p = data;
+    const uint8_t *end = data + len;
+    const uint8_t *eol;
+    uint32_t n;
+    int value;
+    int ret;
+    char c;
+
+    while (p < end)
+    {
+        switch (parser->state)
+        {
+        case WEB_HTTP_STATE_STATUS:
+        case WEB_HTTP_STATE_HEADER:
+            /* 按行查找，整段拷贝到行缓冲 */
+            eol = (const uint8_t *)memchr(p, '\n', end - p);
+            web_http_line_append(parser, p, (uint32_t)((eol ? eol : end) - p));
+            if (eol == RT_NULL)
+            {
+                p = end;
+                break;
+            }
+            p = eol + 1;
+            if (parser->line_len > 0 && parser->line[parser->line_len - 1] == '\r')
+            {
+                parser->line_len--;
+            }
+            parser->line[parser->line_len] = '\0';
+            if (parser->state == WEB_HTTP_STATE_STATUS)
+            {
+                ret = web_http_parse_status(parser);
+            }
+            else if (parser->line_len == 0)
+            {
+                ret = web_http_headers_complete(parser);
+            }
+            else
+            {
+                ret = web_http_parse_header(parser);
+            }
+            parser->line_len = 0;
+            if (ret != RT_EOK)
+            {
+                return ret;
+            }
+            break;
+
+        case WEB_HTTP_STATE_BODY:
+        case WEB_HTTP_STATE_CHUNK_DATA:
+            /* 直接把输入中的片段交给回调 */
+            n = (uint32_t)(end - p);
+            if (n > parser->remaining)
+            {
+                n = parser->remaining;
+            }
+            ret = web_http_deliver(parser, p, n);
+            if (ret != RT_EOK)
+            {
+                return ret;
+            }
+            p += n;
+            parser->remaining -= n;
+            if (parser->remaining == 0)
+            {
+                parser->state = parser->state == WEB_HTTP_STATE_BODY ?
+                                WEB_HTTP_STATE_DONE : WEB_HTTP_STATE_CHUNK_END;
+            }
+            break;
+
+        case WEB_HTTP_STATE_BODY_EOF:
+            ret = web_http_deliver(parser, p, (uint32_t)(end - p));
+            if (ret != RT_EOK)
+            {
+                return ret;
+            }
+            p = end;
+            break;
+
+        case WEB_HTTP_STATE_CHUNK_SIZE:
+            c = (char)*p++;
+            if (c >= '0' && c <= '9')
+            {
+                value = c - '0';
+            }
+            else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+            {
+                value = (c | 0x20) - 'a' + 10;
+            }
+            else
+            {
+                value = -1;
+            }
+
+            if (value >= 0)
+            {
+                if (++parser->digits > WEB_HTTP_CHUNK_DIGITS_MAX)
+                {
+                    return web_http_parser_fail(parser, "chunk size too large");
+                }
+                parser->remaining = (parser->remaining << 4) | value;
+                break;
+            }
+            if (parser->digits == 0)
+            {
+                return web_http_parser_fail(parser, "chunk size");
+            }
+            if (c == ';' || c == ' ' || c == '\t')
+            {
+                parser->state = WEB_HTTP_STATE_CHUNK_EXT;
+                break;
+            }
+            if (c == '\r')
+            {
+                parser->state = WEB_HTTP_STATE_CHUNK_LF;
+                break;
+            }
+            if (c != '\n')
+            {
+                return web_http_parser_fail(parser, "chunk size");
+            }
+            /* 长度行结束 */
+            /* fall through */
+        case WEB_HTTP_STATE_CHUNK_LF:
+            /* CR之后不是LF时不能再当作长度继续解析（"1\r2\r\n"不是0x12） */
+            if (parser->state == WEB_HTTP_STATE_CHUNK_LF && *p++ != '\n')
+            {
+                return web_http_parser_fail(parser, "chunk size");
+            }
+            /* fall through */
+        case WEB_HTTP_STATE_CHUNK_EXT:
+            if (parser->state == WEB_HTTP_STATE_CHUNK_EXT && *p++ != '\n')
+            {
+                break;
+            }
+            parser->digits = 0;
+            parser->line_len = 0;
+            parser->state = parser->remaining > 0 ? WEB_HTTP_STATE_CHUNK_DATA : WEB_HTTP_STATE_TRAILER;
+            break;
+
+        case WEB_HTTP_STATE_CHUNK_END:
+            c = (char)*p++;
+            if (c == '\n')
+            {
+                parser->state = WEB_HTTP_STATE_CHUNK_SIZE;
+            }
+            else if (c != '\r')
+            {
+                return web_http_parser_fail(parser, "missing CRLF after chunk");
+            }
+            break;
+
+        case WEB_HTTP_STATE_TRAILER:
+            /* trailer字段不使用，遇到空行结束 */
+            c = (char)*p++;
+            if (c == '\n')
+            {
+                if (parser->line_len == 0)
+                {
+                    parser->content_len = (int32_t)parser->body_len;
+                    parser->state = WEB_HTTP_STATE_DONE;
+                }
+                parser->line_len = 0;
+            }
+            else if (c != '\r')
+            {
+                parser->line_len = 1;
+            }
+            break;
+
+        case WEB_HTTP_STATE_DONE:
+            return (int)(p - data);
+
+        default:
+            return -RT_ERROR;
+        }
+    }
+
+    return (int)(p - data);
+}
+
+int web_http_parser_finish(web_http_parser_t *parser)
+{
+    if (parser->state == WEB_HTTP_STATE_BODY_EOF)
+    {
+        parser->content_len = (int32_t)parser->body_len;
+        parser->state = WEB_HTTP_STATE_DONE;
+    }
+
+    return parser->state == WEB_HTTP_STATE_DONE ? RT_EOK : -RT_ERROR;
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-26     AI Assistant first version - Incremental HTTP response parser
+ */
+
+#ifndef __WEB_HTTP_PARSER_H__
+#define __WEB_HTTP_PARSER_H__
+
+/*
+ * 增量式HTTP/1.x响应解析器：
+ *   - 每次recv到的数据直接送入，不要求一次收全，任意位置断开都可以继续
+ *   - 支持Content-Length、chunked和读到连接关闭三种响应体
+ *   - 响应体以指向输入数据的片段交给回调，不经过中间缓冲区
+ *   - 只有响应头逐行暂存在 WEB_HTTP_LINE_MAX 的行缓冲中，超长的行截断（不影响解析）
+ *   - 1xx临时响应（如100 Continue）被跳过
+ */
+
+#include <rtthread.h>
+
+#define WEB_HTTP_LINE_MAX           256
+#define WEB_HTTP_CONTENT_TYPE_MAX   64
+
+typedef enum {
+    WEB_HTTP_STATE_STATUS = 0,      /* 状态行 */
+    WEB_HTTP_STATE_HEADER,          /* 响应头 */
+    WEB_HTTP_STATE_BODY,            /* Content-Length响应体 */
+    WEB_HTTP_STATE_BODY_EOF,        /* 响应体到连接关闭为止 */
+    WEB_HTTP_STATE_CHUNK_SIZE,      /* chunk长度行 */
+    WEB_HTTP_STATE_CHUNK_LF,        /* chunk长度行的CR之后，只接受LF */
+    WEB_HTTP_STATE_CHUNK_EXT,       /* chunk长度后的扩展，忽略 */
+    WEB_HTTP_STATE_CHUNK_DATA,
+    WEB_HTTP_STATE_CHUNK_END,       /* chunk数据后的CRLF */
+    WEB_HTTP_STATE_TRAILER,         /* 最后一个chunk后的trailer */
+    WEB_HTTP_STATE_DONE,
+    WEB_HTTP_STATE_ERROR
+} web_http_state_t;
+
+typedef struct web_http_parser web_http_parser_t;
+
+/* 响应头解析完成，返回非RT_EOK时中止 */
+typedef int (*web_http_headers_cb)(web_http_parser_t *parser, void *user_data);
+
+/* 响应体片段，data指向送入 web_http_parser_execute 的数据，返回非RT_EOK时中止 */
+typedef int (*web_http_body_cb)(web_http_parser_t *parser, const uint8_t *data, uint32_t len,
+                                void *user_data);
+
+struct web_http_parser {
+    web_http_state_t state;
+    int status_code;
+    int32_t content_len;            /* -1 表示未声明（chunked或读到连接关闭）*/
+    uint32_t body_len;              /* 已交给回调的响应体字节数 */
+    rt_bool_t chunked;
+    rt_bool_t keep_alive;           /* HTTP/1.1且未声明 Connection: close */
+    char content_type[WEB_HTTP_CONTENT_TYPE_MAX];
+
+    web_http_headers_cb on_headers;
+    web_http_body_cb on_body;
+    void *user_data;
+
+    /* 内部状态 */
+    uint32_t remaining;             /* 当前响应体或chunk剩余字节数 */
+    uint16_t line_len;
+    uint8_t digits;                 /* chunk长度的十六进制位数 */
+    char line[WEB_HTTP_LINE_MAX];
+};
+
+void web_http_parser_init(web_http_parser_t *parser, web_http_headers_cb on_headers,
+                          web_http_body_cb on_body, void *user_data);
+
+/*
+ * 送入收到的数据，返回消耗的字节数；响应结束后剩余的数据不再消耗。
+ * 格式错误返回 -RT_ERROR，回调中止返回 -RT_EINTR
+ */
+int web_http_parser_execute(web_http_parser_t *parser, const uint8_t *data, uint32_t len);
+
+/* 连接已关闭：读到连接关闭为止的响应体在此结束，其余未完成的状态返回 -RT_ERROR */
+int web_http_parser_finish(web_http_parser_t *parser);
+
+rt_inline rt_bool_t web_http_parser_done(const web_http_parser_t *parser)
+{
+    return parser->state == WEB_HTTP_STATE_DONE;
+}
+
+/* 响应头是否已经解析完成 */
+rt_inline rt_bool_t web_http_parser_headers_done(const web_http_parser_t *parser)
+{
+    return parser->state > WEB_HTTP_STATE_HEADER && parser->state != WEB_HTTP_STATE_ERROR;
+}
+
+#endif /* __WEB_HTTP_PARSER_H__ */
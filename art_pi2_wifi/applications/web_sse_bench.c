@@ -0,0 +1,422 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - SSE parser tests/benchmark
+ */
+
+/*
+ * Server-Sent Events解析器的测试和性能，不需要网络，事件流在内存中生成：
+ *   1. 边界情况：CRLF/LF/CR行尾、多行data、无冒号的字段、冒号后的空格、注释、事件名、
+ *      未结束的事件、超长事件，分别整段、逐字节和随机分段送入，结果必须相同
+ *   2. 随机事件流：随机的字段、行尾和分段，与生成时记录的期望事件比较
+ *   3. 性能：OpenAI格式的流式回复（每个事件一个delta）的解析吞吐量
+ *
+ * 设备端：sse_bench [随机测试次数]
+ * PC端（与设备端同一份web_sse_parser.c）：
+ *   gcc -O2 -DWEB_SSE_BENCH_MAIN -I../host -I. web_sse_parser.c web_sse_bench.c -o sse_bench
+ *   gcc -g -fsanitize=address,undefined -DWEB_SSE_BENCH_MAIN -I../host -I. web_sse_parser.c web_sse_bench.c -o sse_fuzz
+ *   ./sse_bench 5000
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include "web_sse_parser.h"
+
+#define SSE_BENCH_STREAM_MAX    (16 * 1024)
+#define SSE_BENCH_RESULT_MAX    (16 * 1024)
+
+/* 解析结果：每个事件记为 "事件名\x01data\x02" */
+typedef struct {
+    char text[SSE_BENCH_RESULT_MAX];
+    uint32_t len;
+    rt_bool_t overflow;
+} sse_bench_result_t;
+
+static uint32_t sse_bench_seed = 1;
+
+static uint32_t sse_bench_rand(void)
+{
+    sse_bench_seed = sse_bench_seed * 1103515245 + 12345;
+    return (sse_bench_seed >> 8) & 0xFFFFFF;
+}
+
+static void sse_bench_put(sse_bench_result_t *result, const char *data, uint32_t len)
+{
+    if (result->len + len > sizeof(result->text))
+    {
+        result->overflow = RT_TRUE;
+        return;
+    }
+    rt_memcpy(result->text + result->len, data, len);
+    result->len += len;
+}
+
+static int sse_bench_on_event(web_sse_parser_t *parser, const char *event, const char *data,
+                              uint32_t len, void *user_data)
+{
+    sse_bench_result_t *result = (sse_bench_result_t *)user_data;
+
+    if (strlen(data) != len)
+    {
+        sse_bench_put(result, "<len>", 5);
+    }
+    sse_bench_put(result, event, strlen(event));
+    sse_bench_put(result, "\x01", 1);
+    sse_bench_put(result, data, len);
+    sse_bench_put(result, "\x02", 1);
+
+    return RT_EOK;
+}
+
+/* 按seg分段送入（0表示随机长度），返回finish的结果 */
+static int sse_bench_parse(web_sse_parser_t *parser, const char *stream, uint32_t len, uint32_t seg,
+                           sse_bench_result_t *result)
+{
+    uint32_t off = 0, n;
+
+    result->len = 0;
+    result->overflow = RT_FALSE;
+    web_sse_parser_init(parser, sse_bench_on_event, result);
+
+    while (off < len)
+    {
+        n = seg ? seg : 1 + sse_bench_rand() % 64;
+        if (n > len - off)
+        {
+            n = len - off;
+        }
+        web_sse_parser_execute(parser, (const uint8_t *)stream + off, n);
+        off += n;
+    }
+
+    return web_sse_parser_finish(parser);
+}
+
+/* ==================== 边界情况 ==================== */
+
+typedef struct {
+    const char *name;
+    const char *stream;
+    const char *expect;         /* 期望的事件，格式同 sse_bench_result_t */
+    int finish;                 /* 期望的 web_sse_parser_finish 返回值 */
+} sse_bench_case_t;
+
+static const sse_bench_case_t sse_bench_cases[] = {
+    {"lf",          "data: a\n\ndata: b\n\n",               "\x01" "a\x02\x01" "b\x02",     RT_EOK},
+    {"crlf",        "data: a\r\n\r\ndata: b\r\n\r\n",       "\x01" "a\x02\x01" "b\x02",     RT_EOK},
+    {"cr",          "data: a\r\rdata: b\r\r",               "\x01" "a\x02\x01" "b\x02",     RT_EOK},
+    {"multiline",   "data: a\ndata:b\ndata\n\n",            "\x01" "a\nb\n\x02",            RT_EOK},
+    {"space",       "data:  a \ndata:\n\n",                 "\x01 a \n\x02",                RT_EOK},
+    {"empty",       "data\n\n",                             "\x01\x02",                     RT_EOK},
+    {"colon",       "data: {\"a\":\"b:c\"}\n\n",            "\x01{\"a\":\"b:c\"}\x02",      RT_EOK},
+    {"comment",     ": keep-alive\n\n:\ndata: a\n: x\n\n",  "\x01" "a\x02",                 RT_EOK},
+    {"ignored",     "id: 1\nretry: 10\nfoo: x\n\ndata: a\nid\n\n", "\x01" "a\x02",          RT_EOK},
+    {"event",       "event: delta\ndata: a\n\ndata: b\n\n", "delta\x01" "a\x02\x01" "b\x02", RT_EOK},
+    {"event-only",  "event: ping\n\ndata: a\n\n",           "\x01" "a\x02",                 RT_EOK},
+    {"long-field",  "datadata: x\nevents: y\ndata: a\n\n",  "\x01" "a\x02",                 RT_EOK},
+    {"done",        "data: {\"x\":1}\n\ndata: [DONE]\n\n",  "\x01{\"x\":1}\x02\x01[DONE]\x02", RT_EOK},
+    {"unfinished",  "data: a\n\ndata: b\n",                 "\x01" "a\x02",                 -RT_ERROR},
+    {"no-newline",  "data: a\n\ndata: b",                   "\x01" "a\x02",                 -RT_ERROR},
+    {"blank-only",  "\n\n\r\n\r",                           "",                             RT_EOK},
+};
+
+static web_sse_parser_t sse_bench_parser;
+static sse_bench_result_t sse_bench_result;
+static char sse_bench_stream[SSE_BENCH_STREAM_MAX];
+static char sse_bench_expect[SSE_BENCH_RESULT_MAX];
+
+static int sse_bench_check(const char *name, const char *stream, uint32_t len,
+                           const char *expect, uint32_t expect_len, int finish)
+{
+    static const uint32_t segs[] = {0xFFFFFFFF, 1, 2, 3, 7, 0, 0, 0};
+    int failures = 0;
+    int ret;
+    int i;
+
+    for (i = 0; i < (int)(sizeof(segs) / sizeof(segs[0])); i++)
+    {
+        ret = sse_bench_parse(&sse_bench_parser, stream, len, segs[i], &sse_bench_result);
+        if (ret != finish || sse_bench_result.overflow || sse_bench_result.len != expect_len ||
+            memcmp(sse_bench_result.text, expect, expect_len) != 0)
+        {
+            if (failures == 0)
+            {
+                rt_kprintf("  %s: mismatch (segment %d, finish %d)\n", name,
+                           segs[i] == 0xFFFFFFFF ? -1 : (int)segs[i], ret);
+            }
+            failures++;
+        }
+    }
+
+    return failures ? 1 : 0;
+}
+
+static int sse_bench_edge_cases(void)
+{
+    int failures = 0;
+    uint32_t len;
+    int i;
+
+    for (i = 0; i < (int)(sizeof(sse_bench_cases) / sizeof(sse_bench_cases[0])); i++)
+    {
+        const sse_bench_case_t *c = &sse_bench_cases[i];
+
+        failures += sse_bench_check(c->name, c->stream, strlen(c->stream),
+                                    c->expect, strlen(c->expect), c->finish);
+    }
+
+    /* 超长事件丢弃，前后的事件不受影响 */
+    len = rt_snprintf(sse_bench_stream, sizeof(sse_bench_stream), "data: a\n\ndata: ");
+    rt_memset(sse_bench_stream + len, 'x', WEB_SSE_DATA_MAX + 1);
+    len += WEB_SSE_DATA_MAX + 1;
+    len += rt_snprintf(sse_bench_stream + len, sizeof(sse_bench_stream) - len, "\n\ndata: b\n\n");
+    failures += sse_bench_check("too-long", sse_bench_stream, len, "\x01" "a\x02\x01" "b\x02", 6, RT_EOK);
+
+    /* 刚好达到上限的事件保留 */
+    len = rt_snprintf(sse_bench_stream, sizeof(sse_bench_stream), "data: ");
+    rt_memset(sse_bench_stream + len, 'y', WEB_SSE_DATA_MAX);
+    len += WEB_SSE_DATA_MAX;
+    len += rt_snprintf(sse_bench_stream + len, sizeof(sse_bench_stream) - len, "\r\n\r\n");
+    sse_bench_expect[0] = '\x01';
+    rt_memset(sse_bench_expect + 1, 'y', WEB_SSE_DATA_MAX);
+    sse_bench_expect[WEB_SSE_DATA_MAX + 1] = '\x02';
+    failures += sse_bench_check("max-size", sse_bench_stream, len,
+                                sse_bench_expect, WEB_SSE_DATA_MAX + 2, RT_EOK);
+
+    return failures;
+}
+
+/* ==================== 随机事件流 ==================== */
+
+static const char *const sse_bench_eols[] = {"\n", "\r\n", "\r"};
+
+static void sse_bench_append(char *buf, uint32_t *len, uint32_t capacity, const char *data, uint32_t n)
+{
+    if (*len + n <= capacity)
+    {
+        rt_memcpy(buf + *len, data, n);
+    }
+    *len += n;
+}
+
+/* 生成随机事件流，同时写出期望的结果；返回RT_EOK表示没有超出缓冲区 */
+static int sse_bench_generate(uint32_t *stream_len, uint32_t *expect_len)
+{
+    static const char alphabet[] = "abcXYZ :{}\"[]0123456789\xe4\xbd\xa0\xe5\xa5\xbd";
+    char value[96];
+    char data[4 * sizeof(value)];
+    char event[WEB_SSE_EVENT_MAX];
+    uint32_t sl = 0, el = 0;
+    uint32_t data_len;
+    int events = 1 + sse_bench_rand() % 12;
+    int lines, i, j, k;
+    uint32_t n;
+    const char *eol;
+    rt_bool_t has_data;
+
+    for (i = 0; i < events; i++)
+    {
+        lines = sse_bench_rand() % 5;
+        has_data = RT_FALSE;
+        data_len = 0;
+        event[0] = '\0';
+
+        for (j = 0; j < lines; j++)
+        {
+            /* 随机的值，开头可能有空格 */
+            n = sse_bench_rand() % (sizeof(value) - 1);
+            for (k = 0; k < (int)n; k++)
+            {
+                value[k] = alphabet[sse_bench_rand() % (sizeof(alphabet) - 1)];
+            }
+            value[n] = '\0';
+
+            switch (sse_bench_rand() % 6)
+            {
+            case 0:
+                /* 注释 */
+                sse_bench_append(sse_bench_stream, &sl, sizeof(sse_bench_stream), ":", 1);
+                break;
+
+            case 1:
+                /* 事件名（截断到上限）*/
+                if (n >= WEB_SSE_EVENT_MAX)
+                {
+                    n = WEB_SSE_EVENT_MAX - 1;
+                }
+                sse_bench_append(sse_bench_stream, &sl, sizeof(sse_bench_stream), "event: ", 7);
+                rt_memcpy(event, value, n);
+                event[n] = '\0';
+                break;
+
+            case 2:
+                /* 忽略的字段 */
+                sse_bench_append(sse_bench_stream, &sl, sizeof(sse_bench_stream), "id:", 3);
+                break;
+
+            default:
+                /* data，冒号后没有空格时值开头的空格会被当作分隔符去掉，换成别的字符 */
+                if (sse_bench_rand() & 1)
+                {
+                    sse_bench_append(sse_bench_stream, &sl, sizeof(sse_bench_stream), "data: ", 6);
+                }
+                else
+                {
+                    sse_bench_append(sse_bench_stream, &sl, sizeof(sse_bench_stream), "data:", 5);
+                    if (n > 0 && value[0] == ' ')
+                    {
+                        value[0] = '_';
+                    }
+                }
+                rt_memcpy(data + data_len, value, n);
+                data[data_len + n] = '\n';
+                data_len += n + 1;
+                has_data = RT_TRUE;
+                break;
+            }
+            sse_bench_append(sse_bench_stream, &sl, sizeof(sse_bench_stream), value, n);
+
+            eol = sse_bench_eols[sse_bench_rand() % 3];
+            sse_bench_append(sse_bench_stream, &sl, sizeof(sse_bench_stream), eol, strlen(eol));
+        }
+
+        /* 空行结束事件；前一行以单独的CR结束时，紧跟的LF属于同一个行尾，改用CRLF */
+        eol = sse_bench_eols[sse_bench_rand() % 3];
+        if (sl > 0 && sl <= sizeof(sse_bench_stream) && sse_bench_stream[sl - 1] == '\r' && eol[0] == '\n')
+        {
+            eol = "\r\n";
+        }
+        sse_bench_append(sse_bench_stream, &sl, sizeof(sse_bench_stream), eol, strlen(eol));
+
+        /* 期望结果：事件名\x01data（去掉最后的'\n'）\x02 */
+        if (has_data)
+        {
+            sse_bench_append(sse_bench_expect, &el, sizeof(sse_bench_expect), event, strlen(event));
+            sse_bench_append(sse_bench_expect, &el, sizeof(sse_bench_expect), "\x01", 1);
+            sse_bench_append(sse_bench_expect, &el, sizeof(sse_bench_expect), data, data_len - 1);
+            sse_bench_append(sse_bench_expect, &el, sizeof(sse_bench_expect), "\x02", 1);
+        }
+    }
+
+    *stream_len = sl;
+    *expect_len = el;
+
+    return (sl <= sizeof(sse_bench_stream) && el <= sizeof(sse_bench_expect)) ? RT_EOK : -RT_EFULL;
+}
+
+static int sse_bench_random(int count)
+{
+    uint32_t stream_len, expect_len;
+    int mismatches = 0;
+    int i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (sse_bench_generate(&stream_len, &expect_len) != RT_EOK)
+        {
+            continue;
+        }
+        if (sse_bench_parse(&sse_bench_parser, sse_bench_stream, stream_len, 0, &sse_bench_result) != RT_EOK ||
+            sse_bench_result.len != expect_len ||
+            memcmp(sse_bench_result.text, sse_bench_expect, expect_len) != 0)
+        {
+            if (mismatches == 0)
+            {
+                rt_kprintf("  random stream %d: mismatch (%d events expected bytes %d, got %d)\n",
+                           i, sse_bench_parser.events, expect_len, sse_bench_result.len);
+            }
+            mismatches++;
+        }
+    }
+
+    return mismatches;
+}
+
+/* ==================== 性能 ==================== */
+
+static int sse_bench_count(web_sse_parser_t *parser, const char *event, const char *data,
+                           uint32_t len, void *user_data)
+{
+    *(uint32_t *)user_data += len;
+    return RT_EOK;
+}
+
+static void sse_bench_throughput(void)
+{
+    uint32_t len = 0, n, bytes = 0, data_bytes = 0;
+    rt_tick_t start, ticks;
+    int rounds = 0;
+    int i;
+
+    /* 一段典型的流式回复：每个事件一个中文字的delta */
+    for (i = 0; len + 160 < sizeof(sse_bench_stream); i++)
+    {
+        len += rt_snprintf(sse_bench_stream + len, sizeof(sse_bench_stream) - len,
+                           "data: {\"id\":\"chatcmpl-%d\",\"object\":\"chat.completion.chunk\","
+                           "\"choices\":[{\"index\":0,\"delta\":{\"content\":\"\xe5\xa5\xbd\"}}]}\n\n", i);
+    }
+
+    start = rt_tick_get();
+    do
+    {
+        web_sse_parser_init(&sse_bench_parser, sse_bench_count, &data_bytes);
+        for (n = 0; n < len; n += 1460)
+        {
+            web_sse_parser_execute(&sse_bench_parser, (const uint8_t *)sse_bench_stream + n,
+                                   len - n < 1460 ? len - n : 1460);
+        }
+        web_sse_parser_finish(&sse_bench_parser);
+        bytes += len;
+        rounds++;
+        ticks = rt_tick_get() - start;
+    } while (ticks < RT_TICK_PER_SECOND / 2);
+
+    rt_kprintf("Throughput: %d events x %d rounds, %d KB/s, %d ns per event\n",
+               sse_bench_parser.events, rounds,
+               (int)((uint64_t)bytes * RT_TICK_PER_SECOND / (ticks ? ticks : 1) / 1024),
+               (int)((uint64_t)ticks * 1000000000 / RT_TICK_PER_SECOND / ((uint64_t)rounds * i)));
+}
+
+static int sse_bench(int count)
+{
+    int failures, mismatches;
+
+    if (count <= 0)
+    {
+        count = 1000;
+    }
+    sse_bench_seed = 1;
+
+    failures = sse_bench_edge_cases();
+    rt_kprintf("Edge cases: %d, failures: %d\n",
+               (int)(sizeof(sse_bench_cases) / sizeof(sse_bench_cases[0])) + 2, failures);
+
+    mismatches = sse_bench_random(count);
+    rt_kprintf("Random streams: %d, mismatches: %d\n", count, mismatches);
+
+    sse_bench_throughput();
+
+    return (failures == 0 && mismatches == 0) ? 0 : -1;
+}
+
+#if defined(__RTTHREAD__) && defined(FINSH_USING_MSH)
+#include <finsh.h>
+
+static int cmd_sse_bench(int argc, char **argv)
+{
+    return sse_bench(argc > 1 ? atoi(argv[1]) : 1000);
+}
+MSH_CMD_EXPORT_ALIAS(cmd_sse_bench, sse_bench, SSE parser tests and benchmark: sse_bench [count]);
+#endif
+
+#ifdef WEB_SSE_BENCH_MAIN
+int main(int argc, char **argv)
+{
+    return sse_bench(argc > 1 ? atoi(argv[1]) : 1000) == 0 ? 0 : 1;
+}
+#endif
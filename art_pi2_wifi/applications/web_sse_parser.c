@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Incremental Server-Sent Events parser
+ */
+
+#include <rtthread.h>
+#include <string.h>
+#include "web_sse_parser.h"
+
+#define DBG_TAG "web.sse"
+#define DBG_LVL DBG_INFO
+#include <rtdbg.h>
+
+/* 行首的字段 */
+#define WEB_SSE_FIELD_OTHER     0
+#define WEB_SSE_FIELD_DATA      1
+#define WEB_SSE_FIELD_EVENT     2
+
+void web_sse_parser_init(web_sse_parser_t *parser, web_sse_event_cb on_event, void *user_data)
+{
+    rt_memset(parser, 0, sizeof(web_sse_parser_t));
+    parser->state = WEB_SSE_STATE_LINE;
+    parser->on_event = on_event;
+    parser->user_data = user_data;
+}
+
+/* 冒号之前的字段名已完整，决定这一行的值保存到哪里 */
+static void web_sse_field_begin(web_sse_parser_t *parser)
+{
+    if (parser->field_len == 4 && memcmp(parser->field_name, "data", 4) == 0)
+    {
+        parser->field = WEB_SSE_FIELD_DATA;
+    }
+    else if (parser->field_len == 5 && memcmp(parser->field_name, "event", 5) == 0)
+    {
+        parser->field = WEB_SSE_FIELD_EVENT;
+        parser->event_len = 0;
+    }
+    else
+    {
+        parser->field = WEB_SSE_FIELD_OTHER;
+    }
+}
+
+static void web_sse_append_data(web_sse_parser_t *parser, const uint8_t *data, uint32_t len)
+{
+    /* 多出的1字节给最后一行的'\n'，交给回调前去掉 */
+    if (parser->overflow || parser->data_len + len > WEB_SSE_DATA_MAX + 1)
+    {
+        parser->overflow = RT_TRUE;
+        return;
+    }
+
+    rt_memcpy(parser->data + parser->data_len, data, len);
+    parser->data_len += len;
+}
+
+/* 空行：结束当前事件 */
+static int web_sse_dispatch(web_sse_parser_t *parser)
+{
+    int ret = RT_EOK;
+
+    if (parser->has_data)
+    {
+        if (parser->overflow)
+        {
+            LOG_W("SSE event too large (max %d bytes), dropped", WEB_SSE_DATA_MAX);
+            parser->dropped++;
+        }
+        else
+        {
+            /* 去掉最后一个data行的'\n' */
+            parser->data_len--;
+            parser->data[parser->data_len] = '\0';
+            parser->event[parser->event_len] = '\0';
+            parser->events++;
+            if (parser->on_event &&
+                parser->on_event(parser, parser->event, parser->data, parser->data_len,
+                                 parser->user_data) != RT_EOK)
+            {
+                ret = -RT_EINTR;
+            }
+        }
+    }
+
+    /* 事件名只对这一个事件有效 */
+    parser->has_data = RT_FALSE;
+    parser->overflow = RT_FALSE;
+    parser->data_len = 0;
+    parser->event_len = 0;
+
+    return ret;
+}
+
+static int web_sse_line_end(web_sse_parser_t *parser)
+{
+    int ret = RT_EOK;
+
+    switch (parser->state)
+    {
+    case WEB_SSE_STATE_LINE:
+        ret = web_sse_dispatch(parser);
+        break;
+
+    case WEB_SSE_STATE_FIELD:
+        /* 没有冒号的行：整行是字段名，值为空 */
+        web_sse_field_begin(parser);
+        /* fall through */
+    case WEB_SSE_STATE_SPACE:
+    case WEB_SSE_STATE_VALUE:
+        if (parser->field == WEB_SSE_FIELD_DATA)
+        {
+            web_sse_append_data(parser, (const uint8_t *)"\n", 1);
+            parser->has_data = RT_TRUE;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    parser->state = WEB_SSE_STATE_LINE;
+    return ret;
+}
+
+int web_sse_parser_execute(web_sse_parser_t *parser, const uint8_t *data, uint32_t len)
+{
+    uint32_t i, end;
+    uint8_t c;
+
+    for (i = 0; i < len; i++)
+    {
+        c = data[i];
+
+        if (parser->skip_lf)
+        {
+            parser->skip_lf = RT_FALSE;
+            if (c == '\n')
+            {
+                continue;
+            }
+        }
+
+        if (c == '\r' || c == '\n')
+        {
+            parser->skip_lf = (c == '\r');
+            if (web_sse_line_end(parser) != RT_EOK)
+            {
+                return -RT_EINTR;
+            }
+            continue;
+        }
+
+        switch (parser->state)
+        {
+        case WEB_SSE_STATE_LINE:
+            if (c == ':')
+            {
+                parser->state = WEB_SSE_STATE_IGNORE;
+                break;
+            }
+            parser->field_len = 0;
+            parser->state = WEB_SSE_STATE_FIELD;
+            /* fall through */
+        case WEB_SSE_STATE_FIELD:
+            if (c == ':')
+            {
+                web_sse_field_begin(parser);
+                parser->state = (parser->field == WEB_SSE_FIELD_OTHER) ?
+                                WEB_SSE_STATE_IGNORE : WEB_SSE_STATE_SPACE;
+            }
+            else if (parser->field_len < WEB_SSE_FIELD_MAX)
+            {
+                /* 更长的字段名停在上限，不会与data/event相等 */
+                parser->field_name[parser->field_len++] = c;
+            }
+            break;
+
+        case WEB_SSE_STATE_SPACE:
+            parser->state = WEB_SSE_STATE_VALUE;
+            if (c == ' ')
+            {
+                break;
+            }
+            /* fall through */
+        case WEB_SSE_STATE_VALUE:
+            /* 到行尾为止的一段整体处理 */
+            for (end = i + 1; end < len && data[end] != '\r' && data[end] != '\n'; end++)
+            {
+            }
+            if (parser->field == WEB_SSE_FIELD_DATA)
+            {
+                web_sse_append_data(parser, data + i, end - i);
+            }
+            else
+            {
+                for (; i < end && parser->event_len < WEB_SSE_EVENT_MAX - 1; i++)
+                {
+                    parser->event[parser->event_len++] = data[i];
+                }
+            }
+            i = end - 1;
+            break;
+
+        default:
+            /* 注释或忽略的字段 */
+            break;
+        }
+    }
+
+    return RT_EOK;
+}
+
+int web_sse_parser_finish(web_sse_parser_t *parser)
+{
+    int ret = (parser->has_data || parser->state != WEB_SSE_STATE_LINE) ? -RT_ERROR : RT_EOK;
+
+    if (ret != RT_EOK)
+    {
+        LOG_D("SSE stream ended inside an event, discarded");
+    }
+
+    parser->has_data = RT_FALSE;
+    parser->overflow = RT_FALSE;
+    parser->data_len = 0;
+    parser->event_len = 0;
+    parser->state = WEB_SSE_STATE_LINE;
+
+    return ret;
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-27     AI Assistant first version - Incremental Server-Sent Events parser
+ */
+
+#ifndef __WEB_SSE_PARSER_H__
+#define __WEB_SSE_PARSER_H__
+
+/*
+ * 增量式Server-Sent Events（text/event-stream）解析器，用于流式对话响应：
+ *   - 流式响应体的片段直接送入，任意位置断开都可以继续，行尾可以是CRLF、LF或CR
+ *   - data 字段累积到事件缓冲区，多行之间以'\n'连接，空行结束一个事件并交给回调
+ *   - event 字段保存事件名，id、retry和注释行（以':'开头）忽略，不做断线重连
+ *   - 超过 WEB_SSE_DATA_MAX 的事件整个丢弃（截断的JSON没有意义），计入dropped
+ *   - 连接关闭时未以空行结束的事件丢弃（与浏览器的行为相同）
+ */
+
+#include <rtthread.h>
+
+#define WEB_SSE_DATA_MAX        2048    /* 一个事件的data总长上限 */
+#define WEB_SSE_EVENT_MAX       32      /* 事件名长度上限，更长的截断 */
+#define WEB_SSE_FIELD_MAX       8       /* 字段名长度上限，更长的字段不会是data/event */
+
+typedef enum {
+    WEB_SSE_STATE_LINE = 0,         /* 行首 */
+    WEB_SSE_STATE_FIELD,            /* 字段名 */
+    WEB_SSE_STATE_SPACE,            /* 冒号后，跳过一个空格 */
+    WEB_SSE_STATE_VALUE,            /* 字段值 */
+    WEB_SSE_STATE_IGNORE            /* 注释或不关心的字段，跳到行尾 */
+} web_sse_state_t;
+
+typedef struct web_sse_parser web_sse_parser_t;
+
+/*
+ * 一个完整的事件：event为事件名（未声明时为空串），data以0结尾，
+ * 只在回调期间有效；返回非RT_EOK时中止解析
+ */
+typedef int (*web_sse_event_cb)(web_sse_parser_t *parser, const char *event,
+                                const char *data, uint32_t len, void *user_data);
+
+struct web_sse_parser {
+    web_sse_event_cb on_event;
+    void *user_data;
+    uint32_t events;                /* 交给回调的事件数 */
+    uint32_t dropped;               /* 超长丢弃的事件数 */
+
+    /* 内部状态 */
+    web_sse_state_t state;
+    uint8_t field;                  /* 当前行的字段 */
+    uint8_t field_len;
+    rt_bool_t skip_lf;              /* 上一行以CR结束，紧跟的LF属于同一个行尾 */
+    rt_bool_t has_data;             /* 当前事件有data字段 */
+    rt_bool_t overflow;             /* 当前事件超长 */
+    uint8_t event_len;
+    uint32_t data_len;
+    char field_name[WEB_SSE_FIELD_MAX];
+    char event[WEB_SSE_EVENT_MAX];
+    char data[WEB_SSE_DATA_MAX + 1];
+};
+
+void web_sse_parser_init(web_sse_parser_t *parser, web_sse_event_cb on_event, void *user_data);
+
+/* 送入一段响应体，全部消耗；回调中止返回 -RT_EINTR */
+int web_sse_parser_execute(web_sse_parser_t *parser, const uint8_t *data, uint32_t len);
+
+/* 流结束：丢弃未完成的事件，有未完成的事件时返回 -RT_ERROR */
+int web_sse_parser_finish(web_sse_parser_t *parser);
+
+#endif /* __WEB_SSE_PARSER_H__ */
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+CMSIS-DSP q15 FFT 常量表生成工具：生成 libraries/CMSIS/DSP/Source/CommonTables/arm_common_tables.c
+
+随工程附带的CMSIS-DSP源码缺少 arm_common_tables.c（CommonTables.c 会包含它），
+kws.c 的q15实数FFT需要其中的 twiddleCoef_N_q15、armBitRevIndexTable_fixed_N 和 realCoefAQ15/realCoefBQ15。
+这里按CMSIS源码注释中的公式重新生成这几类表，条件编译与上游相同，
+只有 libraries/CMSIS/SConscript 中定义了对应的 ARM_TABLE_* 宏的表才会被编译。
+
+使用方法：
+    python cmsis_fft_tables.py [输出文件]
+"""
+
+import math
+import sys
+
+OUTPUT = 'libraries/CMSIS/DSP/Source/CommonTables/arm_common_tables.c'
+CFFT_LENGTHS = (16, 32, 64, 128, 256, 512, 1024, 2048, 4096)
+REALCOEF_N = 4096       # realCoefAQ15/BQ15 按最大的实数FFT长度8192生成，较短的FFT按步长取用
+PER_LINE = 12
+
+HEADER = '''/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_common_tables.c
+ * Description:  q15 FFT tables (generated subset)
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * 由 cmsis_fft_tables.py 生成，请勿手工修改。
+ * 只包含q15 FFT使用的表（旋转因子、定点位反转索引、实数FFT系数），
+ * 公式与上游 arm_common_tables.c 的注释相同，条件编译宏也与上游相同。
+ */
+
+#include "arm_math_types.h"
+#include "arm_common_tables.h"
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_FFT_ALLOW_TABLES)
+'''
+
+FOOTER = '''
+#endif /* !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_FFT_ALLOW_TABLES) */
+'''
+
+
+def q15(x):
+    """round(x * 2^15)，饱和到q15范围"""
+    v = int(math.floor(x * 32768.0 + 0.5))
+    return max(-32768, min(32767, v))
+
+
+def twiddle_q15(n):
+    """for i in 0..3N/4-1: cos(2*pi*i/N), sin(2*pi*i/N)，交错存放"""
+    table = []
+    for i in range(3 * n // 4):
+        table.append(q15(math.cos(2.0 * math.pi * i / n)))
+        table.append(q15(math.sin(2.0 * math.pi * i / n)))
+    return table
+
+
+def bitrev_fixed(n):
+    """arm_bitreversal_16 的交换表：每对为两个复数元素的偏移（元素下标*8，使用时右移2位得到q15下标）"""
+    bits = n.bit_length() - 1
+    table = []
+    for i in range(n):
+        r = int(format(i, '0%db' % bits)[::-1], 2)
+        if i < r:
+            table += [i * 8, r * 8]
+    return table
+
+
+def realcoef_q15(n):
+    """A[2i] = 0.5*(1-sin(2*pi*i/(2n))), A[2i+1] = -0.5*cos(...)
+       B[2i] = 0.5*(1+sin(2*pi*i/(2n))), B[2i+1] =  0.5*cos(...)"""
+    a = []
+    b = []
+    for i in range(n):
+        angle = 2.0 * math.pi / (2 * n) * i
+        a += [q15(0.5 * (1.0 - math.sin(angle))), q15(0.5 * (-1.0 * math.cos(angle)))]
+        b += [q15(0.5 * (1.0 + math.sin(angle))), q15(0.5 * (1.0 * math.cos(angle)))]
+    return a, b
+
+
+def emit(out, guard, ctype, name, values):
+    out.append('')
+    out.append('#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(%s)' % guard)
+    out.append('const %s %s[%d] = {' % (ctype, name, len(values)))
+    for i in range(0, len(values), PER_LINE):
+        out.append('    ' + ', '.join(str(v) for v in values[i:i + PER_LINE]) + ',')
+    out.append('};')
+    out.append('#endif')
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else OUTPUT
+    out = [HEADER.rstrip('\n')]
+
+    for n in CFFT_LENGTHS:
+        emit(out, 'ARM_TABLE_TWIDDLECOEF_Q15_%d' % n, 'q15_t', 'twiddleCoef_%d_q15' % n, twiddle_q15(n))
+
+    for n in CFFT_LENGTHS:
+        table = bitrev_fixed(n)
+        out.append('')
+        out.append('#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_%d)' % n)
+        out.append('const uint16_t armBitRevIndexTable_fixed_%d[ARMBITREVINDEXTABLE_FIXED_%d_TABLE_LENGTH] = {' % (n, n))
+        for i in range(0, len(table), PER_LINE):
+            out.append('    ' + ', '.join(str(v) for v in table[i:i + PER_LINE]) + ',')
+        out.append('};')
+        out.append('#endif')
+
+    a, b = realcoef_q15(REALCOEF_N)
+    emit(out, 'ARM_TABLE_REALCOEF_Q15', 'q15_t', 'realCoefAQ15', a)
+    emit(out, 'ARM_TABLE_REALCOEF_Q15', 'q15_t', 'realCoefBQ15', b)
+
+    out.append(FOOTER.rstrip('\n'))
+    text = '\n'.join(out) + '\n'
+    with open(path, 'w', newline='\n') as f:
+        f.write(text)
+    print('%s: %d lines' % (path, text.count('\n')))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-20     AI Assistant first version - rtdbg shim for PC builds
+ */
+
+#ifndef __HOST_RTDBG_H__
+#define __HOST_RTDBG_H__
+
+#include <stdio.h>
+
+#define DBG_ERROR           0
+#define DBG_WARNING         1
+#define DBG_INFO            2
+#define DBG_LOG             3
+
+#ifndef DBG_LVL
+#define DBG_LVL             DBG_WARNING
+#endif
+
+/* PC端默认只输出警告和错误，编译时加 -DHOST_DBG_LVL=DBG_LOG 查看全部日志 */
+#ifdef HOST_DBG_LVL
+#undef DBG_LVL
+#define DBG_LVL             HOST_DBG_LVL
+#elif DBG_LVL > DBG_WARNING
+#undef DBG_LVL
+#define DBG_LVL             DBG_WARNING
+#endif
+
+#define HOST_DBG(level, lvl, fmt, ...) \
+    do { if (DBG_LVL >= (lvl)) printf("[" level "/" DBG_TAG "] " fmt "\n", ##__VA_ARGS__); } while (0)
+
+#define LOG_E(fmt, ...)     HOST_DBG("E", DBG_ERROR, fmt, ##__VA_ARGS__)
+#define LOG_W(fmt, ...)     HOST_DBG("W", DBG_WARNING, fmt, ##__VA_ARGS__)
+#define LOG_I(fmt, ...)     HOST_DBG("I", DBG_INFO, fmt, ##__VA_ARGS__)
+#define LOG_D(fmt, ...)     HOST_DBG("D", DBG_LOG, fmt, ##__VA_ARGS__)
+
+#endif /* __HOST_RTDBG_H__ */
@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-19     AI Assistant first version - rtdef shim for PC builds
+ */
+
+/* RT-Thread组件的头文件（如ringbuffer.h）包含<rtdef.h>，PC端由rtthread.h提供 */
+
+#ifndef __HOST_RTDEF_H__
+#define __HOST_RTDEF_H__
+
+#include "rtthread.h"
+
+#endif /* __HOST_RTDEF_H__ */
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-19     AI Assistant first version - rtdevice shim for PC builds
+ */
+
+/*
+ * PC端只提供设备框架中的环形缓冲区，实现使用RT-Thread源码：
+ *   gcc -I../host ... ../rt-thread/components/drivers/ipc/ringbuffer.c
+ */
+
+#ifndef __HOST_RTDEVICE_H__
+#define __HOST_RTDEVICE_H__
+
+#include "rtthread.h"
+#include "../rt-thread/components/drivers/include/ipc/ringbuffer.h"
+
+#endif /* __HOST_RTDEVICE_H__ */
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2006-2024, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2024-10-19     AI Assistant first version - RT-Thread API shim for PC builds
+ * 2024-10-20     AI Assistant rt_snprintf and rtdbg.h for the VAD bench
+ * 2024-10-24     AI Assistant Heap, string, mutex and critical section helpers for the web client
+ */
+
+/*
+ * 在PC上编译 applications/ 下与硬件无关的模块（如 audio_capture_ring.c、web_client.c、web_dns.c）时使用的最小RT-Thread接口：
+ *   gcc -I../host -I. ...
+ * 只实现这些模块用到的部分，线程同步基于pthread，时钟节拍为1ms。
+ */
+
+#ifndef __HOST_RTTHREAD_H__
+#define __HOST_RTTHREAD_H__
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/prctl.h>
+#include <netinet/tcp.h>       /* lwIP的sys/socket.h中包含TCP_NODELAY */
+
+typedef int                 rt_bool_t;
+typedef long                rt_err_t;
+typedef long                rt_ssize_t;
+typedef unsigned long       rt_size_t;
+typedef unsigned long       rt_ubase_t;
+typedef uint8_t             rt_uint8_t;
+typedef uint32_t            rt_uint32_t;
+typedef int32_t             rt_int32_t;
+typedef uint32_t            rt_tick_t;
+typedef unsigned long       rt_atomic_t;
+
+#define RT_TRUE             1
+#define RT_FALSE            0
+#define RT_NULL             NULL
+#define rt_inline           static inline
+#define RT_ASSERT(EX)       assert(EX)
+
+#define RT_EOK              0
+#define RT_ERROR            1
+#define RT_ETIMEOUT         2
+#define RT_EFULL            3
+#define RT_EEMPTY           4
+#define RT_ENOMEM           5
+#define RT_ENOSYS           6
+#define RT_EBUSY            7
+#define RT_EIO              8
+#define RT_EINTR            9
+#define RT_EINVAL           10
+
+#define RT_TICK_PER_SECOND  1000
+#define RT_NAME_MAX         16
+#define RT_TICK_MAX         0xFFFFFFFFU
+#define RT_WAITING_FOREVER  -1
+#define RT_IPC_FLAG_FIFO    0x00
+#define RT_IPC_FLAG_PRIO    0x01
+#define RT_IPC_CMD_RESET    0x01
+
+#define RT_ALIGN_SIZE               8
+#define RT_ALIGN_DOWN(size, align)  ((size) & ~((align) - 1))
+#define RTM_EXPORT(symbol)
+
+#define rt_malloc           malloc
+#define rt_realloc          realloc
+#define rt_calloc           calloc
+#define rt_free             free
+#define rt_memcpy           memcpy
+#define rt_memset           memset
+#define rt_memmove          memmove
+#define rt_memcmp           memcmp
+#define rt_strdup           strdup
+#define rt_strlen           strlen
+#define rt_snprintf         snprintf
+#define rt_kprintf          printf
+#define closesocket         close
+
+static inline rt_tick_t rt_tick_get(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (rt_tick_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+static inline rt_tick_t rt_tick_from_millisecond(rt_int32_t ms)
+{
+    return (rt_tick_t)ms;
+}
+
+static inline void rt_thread_mdelay(rt_int32_t ms)
+{
+    usleep(ms * 1000);
+}
+
+/* 原子操作：返回操作前的值 */
+#define rt_atomic_load(ptr)         __atomic_load_n(ptr, __ATOMIC_SEQ_CST)
+#define rt_atomic_store(ptr, v)     __atomic_store_n(ptr, v, __ATOMIC_SEQ_CST)
+#define rt_atomic_add(ptr, v)       __atomic_fetch_add(ptr, v, __ATOMIC_SEQ_CST)
+
+/* 调度锁：用一个全局互斥量代替 */
+extern pthread_mutex_t host_critical_lock;
+#define HOST_CRITICAL_LOCK_DEFINE   pthread_mutex_t host_critical_lock = PTHREAD_MUTEX_INITIALIZER
+
+static inline void rt_enter_critical(void)
+{
+    pthread_mutex_lock(&host_critical_lock);
+}
+
+static inline void rt_exit_critical(void)
+{
+    pthread_mutex_unlock(&host_critical_lock);
+}
+
+/* 互斥量（静态对象）*/
+struct rt_mutex
+{
+    pthread_mutex_t mutex;
+};
+
+static inline rt_err_t rt_mutex_init(struct rt_mutex *mutex, const char *name, rt_uint8_t flag)
+{
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&mutex->mutex, &attr);
+    return RT_EOK;
+}
+
+static inline rt_err_t rt_mutex_take(struct rt_mutex *mutex, rt_int32_t timeout)
+{
+    pthread_mutex_lock(&mutex->mutex);
+    return RT_EOK;
+}
+
+static inline rt_err_t rt_mutex_release(struct rt_mutex *mutex)
+{
+    pthread_mutex_unlock(&mutex->mutex);
+    return RT_EOK;
+}
+
+/* 信号量（动态对象）*/
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    rt_uint32_t value;
+} *rt_sem_t;
+
+static inline rt_sem_t rt_sem_create(const char *name, rt_uint32_t value, rt_uint8_t flag)
+{
+    rt_sem_t sem = (rt_sem_t)calloc(1, sizeof(*sem));
+    if (sem)
+    {
+        pthread_condattr_t attr;
+        pthread_condattr_init(&attr);
+        pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+        pthread_mutex_init(&sem->lock, NULL);
+        pthread_cond_init(&sem->cond, &attr);
+        pthread_condattr_destroy(&attr);
+        sem->value = value;
+    }
+    return sem;
+}
+
+static inline rt_err_t rt_sem_delete(rt_sem_t sem)
+{
+    pthread_cond_destroy(&sem->cond);
+    pthread_mutex_destroy(&sem->lock);
+    free(sem);
+    return RT_EOK;
+}
+
+/* 超时以节拍（1ms）为单位，与设备端一样超时返回-RT_ETIMEOUT */
+static inline rt_err_t rt_sem_take(rt_sem_t sem, rt_int32_t timeout)
+{
+    struct timespec ts;
+    rt_err_t ret = RT_EOK;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    if (timeout > 0)
+    {
+        ts.tv_sec += timeout / 1000;
+        ts.tv_nsec += (long)(timeout % 1000) * 1000000;
+        if (ts.tv_nsec >= 1000000000)
+        {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000;
+        }
+    }
+
+    pthread_mutex_lock(&sem->lock);
+    while (sem->value == 0)
+    {
+        if (timeout == RT_WAITING_FOREVER)
+        {
+            pthread_cond_wait(&sem->cond, &sem->lock);
+        }
+        else if (timeout == 0 || pthread_cond_timedwait(&sem->cond, &sem->lock, &ts) != 0)
+        {
+            ret = -RT_ETIMEOUT;
+            break;
+        }
+    }
+    if (ret == RT_EOK)
+    {
+        sem->value--;
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return ret;
+}
+
+static inline rt_err_t rt_sem_release(rt_sem_t sem)
+{
+    pthread_mutex_lock(&sem->lock);
+    sem->value++;
+    pthread_cond_signal(&sem->cond);
+    pthread_mutex_unlock(&sem->lock);
+    return RT_EOK;
+}
+
+/* 只支持RT_IPC_CMD_RESET：计数设为arg */
+static inline rt_err_t rt_sem_control(rt_sem_t sem, int cmd, void *arg)
+{
+    if (cmd != RT_IPC_CMD_RESET)
+    {
+        return -RT_ENOSYS;
+    }
+    pthread_mutex_lock(&sem->lock);
+    sem->value = (rt_uint32_t)(rt_ubase_t)arg;
+    pthread_mutex_unlock(&sem->lock);
+    return RT_EOK;
+}
+
+/* 线程：创建时保存入口，startup时启动（分离的pthread，忽略栈大小和优先级，名字设为pthread的线程名）*/
+typedef struct
+{
+    pthread_t tid;
+    void (*entry)(void *parameter);
+    void *parameter;
+    char name[RT_NAME_MAX];
+} *rt_thread_t;
+
+static inline void *host_thread_entry(void *arg)
+{
+    rt_thread_t thread = (rt_thread_t)arg;
+    prctl(PR_SET_NAME, thread->name);
+    thread->entry(thread->parameter);
+    return NULL;
+}
+
+static inline rt_thread_t rt_thread_create(const char *name, void (*entry)(void *parameter), void *parameter,
+                                           rt_uint32_t stack_size, rt_uint8_t priority, rt_uint32_t tick)
+{
+    rt_thread_t thread = (rt_thread_t)calloc(1, sizeof(*thread));
+    if (thread)
+    {
+        thread->entry = entry;
+        thread->parameter = parameter;
+        snprintf(thread->name, RT_NAME_MAX, "%s", name);
+    }
+    return thread;
+}
+
+static inline rt_err_t rt_thread_startup(rt_thread_t thread)
+{
+    if (pthread_create(&thread->tid, NULL, host_thread_entry, thread) != 0)
+    {
+        return -RT_ERROR;
+    }
+    pthread_detach(thread->tid);
+    return RT_EOK;
+}
+
+/* 只用于判断是否为同一线程 */
+static inline rt_thread_t rt_thread_self(void)
+{
+    return (rt_thread_t)pthread_self();
+}
+
+#endif /* __HOST_RTTHREAD_H__ */
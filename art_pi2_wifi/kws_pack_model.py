@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+本地唤醒词模型打包工具：生成设备端 kws.c 读取的模型文件 (kws_model.bin)
+
+使用方法：
+1. 打包量化后的DS-CNN权重 (npz，键名见 LAYERS，均为int8，卷积权重为HWC排列):
+   python kws_pack_model.py weights.npz kws_model.bin \
+       --labels silence,unknown,hi_xiaoshi --wakeup hi_xiaoshi \
+       --dec-bits 1 --shifts 0,7,1,6,...      (每层 bias_shift,out_shift)
+2. 生成随机权重的模型（只用于测量推理耗时，准确率无意义）:
+   python kws_pack_model.py --random kws_model.bin
+3. 复制到SD卡: /sdcard/kws_model.bin，设备端执行 kws_bench 或 wakeup_start
+"""
+
+import argparse
+import random
+import struct
+import sys
+
+MAGIC = 0x3153574B      # "KWS1"
+VERSION = 1
+HEADER_SIZE = 176
+MAX_CLASSES = 12
+LABEL_LEN = 12
+DS_BLOCKS = 4
+LAYER_NUM = 2 + DS_BLOCKS * 2
+
+
+def layer_shapes(channels, num_classes):
+    """与 kws_model_load 中的权重顺序一致"""
+    c = channels
+    shapes = [('conv1_w', c * 10 * 4), ('conv1_b', c)]
+    for i in range(DS_BLOCKS):
+        shapes += [('dw%d_w' % i, 9 * c), ('dw%d_b' % i, c),
+                   ('pw%d_w' % i, c * c), ('pw%d_b' % i, c)]
+    shapes += [('fc_w', num_classes * c), ('fc_b', num_classes)]
+    return shapes
+
+
+def pack(path, labels, wakeup, channels, dec_bits, shifts, tensors):
+    if not 0 < len(labels) <= MAX_CLASSES:
+        sys.exit('1..%d labels required' % MAX_CLASSES)
+    if channels % 4 or not 0 < channels <= 64:
+        sys.exit('channels must be a multiple of 4 and <= 64')
+
+    header = struct.pack('<IBBBBb3x', MAGIC, VERSION, len(labels),
+                         labels.index(wakeup), channels, dec_bits)
+    header += bytes(s for pair in shifts for s in pair)
+    for i in range(MAX_CLASSES):
+        name = labels[i].encode('utf-8') if i < len(labels) else b''
+        header += name[:LABEL_LEN].ljust(LABEL_LEN, b'\0')
+    assert len(header) == HEADER_SIZE
+
+    body = b''
+    for name, size in layer_shapes(channels, len(labels)):
+        data = tensors[name]
+        if len(data) != size:
+            sys.exit('%s: expected %d values, got %d' % (name, size, len(data)))
+        body += struct.pack('<%db' % size, *data)
+
+    with open(path, 'wb') as f:
+        f.write(header + body)
+    print('%s: %d classes, %d channels, %d bytes' % (path, len(labels), channels, len(header + body)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Pack DS-CNN weights for on-device KWS')
+    parser.add_argument('weights', nargs='?', help='int8 weights (.npz)')
+    parser.add_argument('output', help='model file to write')
+    parser.add_argument('--random', action='store_true', help='random weights for latency benchmarks')
+    parser.add_argument('--labels', default='silence,unknown,hi_xiaoshi')
+    parser.add_argument('--wakeup', default='hi_xiaoshi')
+    parser.add_argument('--channels', type=int, default=64)
+    parser.add_argument('--dec-bits', type=int, default=1, help='MFCC fractional bits of the input layer')
+    parser.add_argument('--shifts', default=None, help='bias_shift,out_shift pairs for %d layers' % LAYER_NUM)
+    args = parser.parse_args()
+
+    labels = args.labels.split(',')
+    if args.wakeup not in labels:
+        sys.exit('wakeup label %s not in labels' % args.wakeup)
+
+    if args.shifts:
+        values = [int(v) for v in args.shifts.split(',')]
+        if len(values) != LAYER_NUM * 2:
+            sys.exit('--shifts needs %d values' % (LAYER_NUM * 2))
+        shifts = list(zip(values[0::2], values[1::2]))
+    else:
+        shifts = [(0, 7)] * LAYER_NUM
+
+    if args.random:
+        rng = random.Random(0)
+        tensors = {name: [rng.randint(-64, 63) for _ in range(size)]
+                   for name, size in layer_shapes(args.channels, len(labels))}
+    elif args.weights:
+        import numpy as np
+        npz = np.load(args.weights)
+        tensors = {name: npz[name].astype('int8').flatten().tolist()
+                   for name, _ in layer_shapes(args.channels, len(labels))}
+    else:
+        sys.exit('weights file or --random required')
+
+    pack(args.output, labels, args.wakeup, args.channels, args.dec_bits, shifts, tensors)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,3188 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_common_tables.c
+ * Description:  q15 FFT tables (generated subset)
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * 由 cmsis_fft_tables.py 生成，请勿手工修改。
+ * 只包含q15 FFT使用的表（旋转因子、定点位反转索引、实数FFT系数），
+ * 公式与上游 arm_common_tables.c 的注释相同，条件编译宏也与上游相同。
+ */
+
+#include "arm_math_types.h"
+#include "arm_common_tables.h"
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_FFT_ALLOW_TABLES)
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_16)
+const q15_t twiddleCoef_16_q15[24] = {
+    32767, 0, 30274, 12540, 23170, 23170, 12540, 30274, 0, 32767, -12540, 30274,
+    -23170, 23170, -30274, 12540, -32768, 0, -30274, -12540, -23170, -23170, -12540, -30274,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_32)
+const q15_t twiddleCoef_32_q15[48] = {
+    32767, 0, 32138, 6393, 30274, 12540, 27246, 18205, 23170, 23170, 18205, 27246,
+    12540, 30274, 6393, 32138, 0, 32767, -6393, 32138, -12540, 30274, -18205, 27246,
+    -23170, 23170, -27246, 18205, -30274, 12540, -32138, 6393, -32768, 0, -32138, -6393,
+    -30274, -12540, -27246, -18205, -23170, -23170, -18205, -27246, -12540, -30274, -6393, -32138,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_64)
+const q15_t twiddleCoef_64_q15[96] = {
+    32767, 0, 32610, 3212, 32138, 6393, 31357, 9512, 30274, 12540, 28899, 15447,
+    27246, 18205, 25330, 20788, 23170, 23170, 20788, 25330, 18205, 27246, 15447, 28899,
+    12540, 30274, 9512, 31357, 6393, 32138, 3212, 32610, 0, 32767, -3212, 32610,
+    -6393, 32138, -9512, 31357, -12540, 30274, -15447, 28899, -18205, 27246, -20788, 25330,
+    -23170, 23170, -25330, 20788, -27246, 18205, -28899, 15447, -30274, 12540, -31357, 9512,
+    -32138, 6393, -32610, 3212, -32768, 0, -32610, -3212, -32138, -6393, -31357, -9512,
+    -30274, -12540, -28899, -15447, -27246, -18205, -25330, -20788, -23170, -23170, -20788, -25330,
+    -18205, -27246, -15447, -28899, -12540, -30274, -9512, -31357, -6393, -32138, -3212, -32610,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_128)
+const q15_t twiddleCoef_128_q15[192] = {
+    32767, 0, 32729, 1608, 32610, 3212, 32413, 4808, 32138, 6393, 31786, 7962,
+    31357, 9512, 30853, 11039, 30274, 12540, 29622, 14010, 28899, 15447, 28106, 16846,
+    27246, 18205, 26320, 19520, 25330, 20788, 24279, 22006, 23170, 23170, 22006, 24279,
+    20788, 25330, 19520, 26320, 18205, 27246, 16846, 28106, 15447, 28899, 14010, 29622,
+    12540, 30274, 11039, 30853, 9512, 31357, 7962, 31786, 6393, 32138, 4808, 32413,
+    3212, 32610, 1608, 32729, 0, 32767, -1608, 32729, -3212, 32610, -4808, 32413,
+    -6393, 32138, -7962, 31786, -9512, 31357, -11039, 30853, -12540, 30274, -14010, 29622,
+    -15447, 28899, -16846, 28106, -18205, 27246, -19520, 26320, -20788, 25330, -22006, 24279,
+    -23170, 23170, -24279, 22006, -25330, 20788, -26320, 19520, -27246, 18205, -28106, 16846,
+    -28899, 15447, -29622, 14010, -30274, 12540, -30853, 11039, -31357, 9512, -31786, 7962,
+    -32138, 6393, -32413, 4808, -32610, 3212, -32729, 1608, -32768, 0, -32729, -1608,
+    -32610, -3212, -32413, -4808, -32138, -6393, -31786, -7962, -31357, -9512, -30853, -11039,
+    -30274, -12540, -29622, -14010, -28899, -15447, -28106, -16846, -27246, -18205, -26320, -19520,
+    -25330, -20788, -24279, -22006, -23170, -23170, -22006, -24279, -20788, -25330, -19520, -26320,
+    -18205, -27246, -16846, -28106, -15447, -28899, -14010, -29622, -12540, -30274, -11039, -30853,
+    -9512, -31357, -7962, -31786, -6393, -32138, -4808, -32413, -3212, -32610, -1608, -32729,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_256)
+const q15_t twiddleCoef_256_q15[384] = {
+    32767, 0, 32758, 804, 32729, 1608, 32679, 2411, 32610, 3212, 32522, 4011,
+    32413, 4808, 32286, 5602, 32138, 6393, 31972, 7180, 31786, 7962, 31581, 8740,
+    31357, 9512, 31114, 10279, 30853, 11039, 30572, 11793, 30274, 12540, 29957, 13279,
+    29622, 14010, 29269, 14733, 28899, 15447, 28511, 16151, 28106, 16846, 27684, 17531,
+    27246, 18205, 26791, 18868, 26320, 19520, 25833, 20160, 25330, 20788, 24812, 21403,
+    24279, 22006, 23732, 22595, 23170, 23170, 22595, 23732, 22006, 24279, 21403, 24812,
+    20788, 25330, 20160, 25833, 19520, 26320, 18868, 26791, 18205, 27246, 17531, 27684,
+    16846, 28106, 16151, 28511, 15447, 28899, 14733, 29269, 14010, 29622, 13279, 29957,
+    12540, 30274, 11793, 30572, 11039, 30853, 10279, 31114, 9512, 31357, 8740, 31581,
+    7962, 31786, 7180, 31972, 6393, 32138, 5602, 32286, 4808, 32413, 4011, 32522,
+    3212, 32610, 2411, 32679, 1608, 32729, 804, 32758, 0, 32767, -804, 32758,
+    -1608, 32729, -2411, 32679, -3212, 32610, -4011, 32522, -4808, 32413, -5602, 32286,
+    -6393, 32138, -7180, 31972, -7962, 31786, -8740, 31581, -9512, 31357, -10279, 31114,
+    -11039, 30853, -11793, 30572, -12540, 30274, -13279, 29957, -14010, 29622, -14733, 29269,
+    -15447, 28899, -16151, 28511, -16846, 28106, -17531, 27684, -18205, 27246, -18868, 26791,
+    -19520, 26320, -20160, 25833, -20788, 25330, -21403, 24812, -22006, 24279, -22595, 23732,
+    -23170, 23170, -23732, 22595, -24279, 22006, -24812, 21403, -25330, 20788, -25833, 20160,
+    -26320, 19520, -26791, 18868, -27246, 18205, -27684, 17531, -28106, 16846, -28511, 16151,
+    -28899, 15447, -29269, 14733, -29622, 14010, -29957, 13279, -30274, 12540, -30572, 11793,
+    -30853, 11039, -31114, 10279, -31357, 9512, -31581, 8740, -31786, 7962, -31972, 7180,
+    -32138, 6393, -32286, 5602, -32413, 4808, -32522, 4011, -32610, 3212, -32679, 2411,
+    -32729, 1608, -32758, 804, -32768, 0, -32758, -804, -32729, -1608, -32679, -2411,
+    -32610, -3212, -32522, -4011, -32413, -4808, -32286, -5602, -32138, -6393, -31972, -7180,
+    -31786, -7962, -31581, -8740, -31357, -9512, -31114, -10279, -30853, -11039, -30572, -11793,
+    -30274, -12540, -29957, -13279, -29622, -14010, -29269, -14733, -28899, -15447, -28511, -16151,
+    -28106, -16846, -27684, -17531, -27246, -18205, -26791, -18868, -26320, -19520, -25833, -20160,
+    -25330, -20788, -24812, -21403, -24279, -22006, -23732, -22595, -23170, -23170, -22595, -23732,
+    -22006, -24279, -21403, -24812, -20788, -25330, -20160, -25833, -19520, -26320, -18868, -26791,
+    -18205, -27246, -17531, -27684, -16846, -28106, -16151, -28511, -15447, -28899, -14733, -29269,
+    -14010, -29622, -13279, -29957, -12540, -30274, -11793, -30572, -11039, -30853, -10279, -31114,
+    -9512, -31357, -8740, -31581, -7962, -31786, -7180, -31972, -6393, -32138, -5602, -32286,
+    -4808, -32413, -4011, -32522, -3212, -32610, -2411, -32679, -1608, -32729, -804, -32758,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_512)
+const q15_t twiddleCoef_512_q15[768] = {
+    32767, 0, 32766, 402, 32758, 804, 32746, 1206, 32729, 1608, 32706, 2009,
+    32679, 2411, 32647, 2811, 32610, 3212, 32568, 3612, 32522, 4011, 32470, 4410,
+    32413, 4808, 32352, 5205, 32286, 5602, 32214, 5998, 32138, 6393, 32058, 6787,
+    31972, 7180, 31881, 7571, 31786, 7962, 31686, 8351, 31581, 8740, 31471, 9127,
+    31357, 9512, 31238, 9896, 31114, 10279, 30986, 10660, 30853, 11039, 30715, 11417,
+    30572, 11793, 30425, 12167, 30274, 12540, 30118, 12910, 29957, 13279, 29792, 13646,
+    29622, 14010, 29448, 14373, 29269, 14733, 29086, 15091, 28899, 15447, 28707, 15800,
+    28511, 16151, 28311, 16500, 28106, 16846, 27897, 17190, 27684, 17531, 27467, 17869,
+    27246, 18205, 27020, 18538, 26791, 18868, 26557, 19195, 26320, 19520, 26078, 19841,
+    25833, 20160, 25583, 20475, 25330, 20788, 25073, 21097, 24812, 21403, 24548, 21706,
+    24279, 22006, 24008, 22302, 23732, 22595, 23453, 22884, 23170, 23170, 22884, 23453,
+    22595, 23732, 22302, 24008, 22006, 24279, 21706, 24548, 21403, 24812, 21097, 25073,
+    20788, 25330, 20475, 25583, 20160, 25833, 19841, 26078, 19520, 26320, 19195, 26557,
+    18868, 26791, 18538, 27020, 18205, 27246, 17869, 27467, 17531, 27684, 17190, 27897,
+    16846, 28106, 16500, 28311, 16151, 28511, 15800, 28707, 15447, 28899, 15091, 29086,
+    14733, 29269, 14373, 29448, 14010, 29622, 13646, 29792, 13279, 29957, 12910, 30118,
+    12540, 30274, 12167, 30425, 11793, 30572, 11417, 30715, 11039, 30853, 10660, 30986,
+    10279, 31114, 9896, 31238, 9512, 31357, 9127, 31471, 8740, 31581, 8351, 31686,
+    7962, 31786, 7571, 31881, 7180, 31972, 6787, 32058, 6393, 32138, 5998, 32214,
+    5602, 32286, 5205, 32352, 4808, 32413, 4410, 32470, 4011, 32522, 3612, 32568,
+    3212, 32610, 2811, 32647, 2411, 32679, 2009, 32706, 1608, 32729, 1206, 32746,
+    804, 32758, 402, 32766, 0, 32767, -402, 32766, -804, 32758, -1206, 32746,
+    -1608, 32729, -2009, 32706, -2411, 32679, -2811, 32647, -3212, 32610, -3612, 32568,
+    -4011, 32522, -4410, 32470, -4808, 32413, -5205, 32352, -5602, 32286, -5998, 32214,
+    -6393, 32138, -6787, 32058, -7180, 31972, -7571, 31881, -7962, 31786, -8351, 31686,
+    -8740, 31581, -9127, 31471, -9512, 31357, -9896, 31238, -10279, 31114, -10660, 30986,
+    -11039, 30853, -11417, 30715, -11793, 30572, -12167, 30425, -12540, 30274, -12910, 30118,
+    -13279, 29957, -13646, 29792, -14010, 29622, -14373, 29448, -14733, 29269, -15091, 29086,
+    -15447, 28899, -15800, 28707, -16151, 28511, -16500, 28311, -16846, 28106, -17190, 27897,
+    -17531, 27684, -17869, 27467, -18205, 27246, -18538, 27020, -18868, 26791, -19195, 26557,
+    -19520, 26320, -19841, 26078, -20160, 25833, -20475, 25583, -20788, 25330, -21097, 25073,
+    -21403, 24812, -21706, 24548, -22006, 24279, -22302, 24008, -22595, 23732, -22884, 23453,
+    -23170, 23170, -23453, 22884, -23732, 22595, -24008, 22302, -24279, 22006, -24548, 21706,
+    -24812, 21403, -25073, 21097, -25330, 20788, -25583, 20475, -25833, 20160, -26078, 19841,
+    -26320, 19520, -26557, 19195, -26791, 18868, -27020, 18538, -27246, 18205, -27467, 17869,
+    -27684, 17531, -27897, 17190, -28106, 16846, -28311, 16500, -28511, 16151, -28707, 15800,
+    -28899, 15447, -29086, 15091, -29269, 14733, -29448, 14373, -29622, 14010, -29792, 13646,
+    -29957, 13279, -30118, 12910, -30274, 12540, -30425, 12167, -30572, 11793, -30715, 11417,
+    -30853, 11039, -30986, 10660, -31114, 10279, -31238, 9896, -31357, 9512, -31471, 9127,
+    -31581, 8740, -31686, 8351, -31786, 7962, -31881, 7571, -31972, 7180, -32058, 6787,
+    -32138, 6393, -32214, 5998, -32286, 5602, -32352, 5205, -32413, 4808, -32470, 4410,
+    -32522, 4011, -32568, 3612, -32610, 3212, -32647, 2811, -32679, 2411, -32706, 2009,
+    -32729, 1608, -32746, 1206, -32758, 804, -32766, 402, -32768, 0, -32766, -402,
+    -32758, -804, -32746, -1206, -32729, -1608, -32706, -2009, -32679, -2411, -32647, -2811,
+    -32610, -3212, -32568, -3612, -32522, -4011, -32470, -4410, -32413, -4808, -32352, -5205,
+    -32286, -5602, -32214, -5998, -32138, -6393, -32058, -6787, -31972, -7180, -31881, -7571,
+    -31786, -7962, -31686, -8351, -31581, -8740, -31471, -9127, -31357, -9512, -31238, -9896,
+    -31114, -10279, -30986, -10660, -30853, -11039, -30715, -11417, -30572, -11793, -30425, -12167,
+    -30274, -12540, -30118, -12910, -29957, -13279, -29792, -13646, -29622, -14010, -29448, -14373,
+    -29269, -14733, -29086, -15091, -28899, -15447, -28707, -15800, -28511, -16151, -28311, -16500,
+    -28106, -16846, -27897, -17190, -27684, -17531, -27467, -17869, -27246, -18205, -27020, -18538,
+    -26791, -18868, -26557, -19195, -26320, -19520, -26078, -19841, -25833, -20160, -25583, -20475,
+    -25330, -20788, -25073, -21097, -24812, -21403, -24548, -21706, -24279, -22006, -24008, -22302,
+    -23732, -22595, -23453, -22884, -23170, -23170, -22884, -23453, -22595, -23732, -22302, -24008,
+    -22006, -24279, -21706, -24548, -21403, -24812, -21097, -25073, -20788, -25330, -20475, -25583,
+    -20160, -25833, -19841, -26078, -19520, -26320, -19195, -26557, -18868, -26791, -18538, -27020,
+    -18205, -27246, -17869, -27467, -17531, -27684, -17190, -27897, -16846, -28106, -16500, -28311,
+    -16151, -28511, -15800, -28707, -15447, -28899, -15091, -29086, -14733, -29269, -14373, -29448,
+    -14010, -29622, -13646, -29792, -13279, -29957, -12910, -30118, -12540, -30274, -12167, -30425,
+    -11793, -30572, -11417, -30715, -11039, -30853, -10660, -30986, -10279, -31114, -9896, -31238,
+    -9512, -31357, -9127, -31471, -8740, -31581, -8351, -31686, -7962, -31786, -7571, -31881,
+    -7180, -31972, -6787, -32058, -6393, -32138, -5998, -32214, -5602, -32286, -5205, -32352,
+    -4808, -32413, -4410, -32470, -4011, -32522, -3612, -32568, -3212, -32610, -2811, -32647,
+    -2411, -32679, -2009, -32706, -1608, -32729, -1206, -32746, -804, -32758, -402, -32766,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_1024)
+const q15_t twiddleCoef_1024_q15[1536] = {
+    32767, 0, 32767, 201, 32766, 402, 32762, 603, 32758, 804, 32753, 1005,
+    32746, 1206, 32738, 1407, 32729, 1608, 32718, 1809, 32706, 2009, 32693, 2210,
+    32679, 2411, 32664, 2611, 32647, 2811, 32629, 3012, 32610, 3212, 32590, 3412,
+    32568, 3612, 32546, 3812, 32522, 4011, 32496, 4211, 32470, 4410, 32442, 4609,
+    32413, 4808, 32383, 5007, 32352, 5205, 32319, 5404, 32286, 5602, 32251, 5800,
+    32214, 5998, 32177, 6195, 32138, 6393, 32099, 6590, 32058, 6787, 32015, 6983,
+    31972, 7180, 31927, 7376, 31881, 7571, 31834, 7767, 31786, 7962, 31737, 8157,
+    31686, 8351, 31634, 8546, 31581, 8740, 31527, 8933, 31471, 9127, 31415, 9319,
+    31357, 9512, 31298, 9704, 31238, 9896, 31177, 10088, 31114, 10279, 31050, 10469,
+    30986, 10660, 30920, 10850, 30853, 11039, 30784, 11228, 30715, 11417, 30644, 11605,
+    30572, 11793, 30499, 11980, 30425, 12167, 30350, 12354, 30274, 12540, 30196, 12725,
+    30118, 12910, 30038, 13095, 29957, 13279, 29875, 13463, 29792, 13646, 29707, 13828,
+    29622, 14010, 29535, 14192, 29448, 14373, 29359, 14553, 29269, 14733, 29178, 14912,
+    29086, 15091, 28993, 15269, 28899, 15447, 28803, 15624, 28707, 15800, 28610, 15976,
+    28511, 16151, 28411, 16326, 28311, 16500, 28209, 16673, 28106, 16846, 28002, 17018,
+    27897, 17190, 27791, 17361, 27684, 17531, 27576, 17700, 27467, 17869, 27357, 18037,
+    27246, 18205, 27133, 18372, 27020, 18538, 26906, 18703, 26791, 18868, 26674, 19032,
+    26557, 19195, 26439, 19358, 26320, 19520, 26199, 19681, 26078, 19841, 25956, 20001,
+    25833, 20160, 25708, 20318, 25583, 20475, 25457, 20632, 25330, 20788, 25202, 20943,
+    25073, 21097, 24943, 21251, 24812, 21403, 24680, 21555, 24548, 21706, 24414, 21856,
+    24279, 22006, 24144, 22154, 24008, 22302, 23870, 22449, 23732, 22595, 23593, 22740,
+    23453, 22884, 23312, 23028, 23170, 23170, 23028, 23312, 22884, 23453, 22740, 23593,
+    22595, 23732, 22449, 23870, 22302, 24008, 22154, 24144, 22006, 24279, 21856, 24414,
+    21706, 24548, 21555, 24680, 21403, 24812, 21251, 24943, 21097, 25073, 20943, 25202,
+    20788, 25330, 20632, 25457, 20475, 25583, 20318, 25708, 20160, 25833, 20001, 25956,
+    19841, 26078, 19681, 26199, 19520, 26320, 19358, 26439, 19195, 26557, 19032, 26674,
+    18868, 26791, 18703, 26906, 18538, 27020, 18372, 27133, 18205, 27246, 18037, 27357,
+    17869, 27467, 17700, 27576, 17531, 27684, 17361, 27791, 17190, 27897, 17018, 28002,
+    16846, 28106, 16673, 28209, 16500, 28311, 16326, 28411, 16151, 28511, 15976, 28610,
+    15800, 28707, 15624, 28803, 15447, 28899, 15269, 28993, 15091, 29086, 14912, 29178,
+    14733, 29269, 14553, 29359, 14373, 29448, 14192, 29535, 14010, 29622, 13828, 29707,
+    13646, 29792, 13463, 29875, 13279, 29957, 13095, 30038, 12910, 30118, 12725, 30196,
+    12540, 30274, 12354, 30350, 12167, 30425, 11980, 30499, 11793, 30572, 11605, 30644,
+    11417, 30715, 11228, 30784, 11039, 30853, 10850, 30920, 10660, 30986, 10469, 31050,
+    10279, 31114, 10088, 31177, 9896, 31238, 9704, 31298, 9512, 31357, 9319, 31415,
+    9127, 31471, 8933, 31527, 8740, 31581, 8546, 31634, 8351, 31686, 8157, 31737,
+    7962, 31786, 7767, 31834, 7571, 31881, 7376, 31927, 7180, 31972, 6983, 32015,
+    6787, 32058, 6590, 32099, 6393, 32138, 6195, 32177, 5998, 32214, 5800, 32251,
+    5602, 32286, 5404, 32319, 5205, 32352, 5007, 32383, 4808, 32413, 4609, 32442,
+    4410, 32470, 4211, 32496, 4011, 32522, 3812, 32546, 3612, 32568, 3412, 32590,
+    3212, 32610, 3012, 32629, 2811, 32647, 2611, 32664, 2411, 32679, 2210, 32693,
+    2009, 32706, 1809, 32718, 1608, 32729, 1407, 32738, 1206, 32746, 1005, 32753,
+    804, 32758, 603, 32762, 402, 32766, 201, 32767, 0, 32767, -201, 32767,
+    -402, 32766, -603, 32762, -804, 32758, -1005, 32753, -1206, 32746, -1407, 32738,
+    -1608, 32729, -1809, 32718, -2009, 32706, -2210, 32693, -2411, 32679, -2611, 32664,
+    -2811, 32647, -3012, 32629, -3212, 32610, -3412, 32590, -3612, 32568, -3812, 32546,
+    -4011, 32522, -4211, 32496, -4410, 32470, -4609, 32442, -4808, 32413, -5007, 32383,
+    -5205, 32352, -5404, 32319, -5602, 32286, -5800, 32251, -5998, 32214, -6195, 32177,
+    -6393, 32138, -6590, 32099, -6787, 32058, -6983, 32015, -7180, 31972, -7376, 31927,
+    -7571, 31881, -7767, 31834, -7962, 31786, -8157, 31737, -8351, 31686, -8546, 31634,
+    -8740, 31581, -8933, 31527, -9127, 31471, -9319, 31415, -9512, 31357, -9704, 31298,
+    -9896, 31238, -10088, 31177, -10279, 31114, -10469, 31050, -10660, 30986, -10850, 30920,
+    -11039, 30853, -11228, 30784, -11417, 30715, -11605, 30644, -11793, 30572, -11980, 30499,
+    -12167, 30425, -12354, 30350, -12540, 30274, -12725, 30196, -12910, 30118, -13095, 30038,
+    -13279, 29957, -13463, 29875, -13646, 29792, -13828, 29707, -14010, 29622, -14192, 29535,
+    -14373, 29448, -14553, 29359, -14733, 29269, -14912, 29178, -15091, 29086, -15269, 28993,
+    -15447, 28899, -15624, 28803, -15800, 28707, -15976, 28610, -16151, 28511, -16326, 28411,
+    -16500, 28311, -16673, 28209, -16846, 28106, -17018, 28002, -17190, 27897, -17361, 27791,
+    -17531, 27684, -17700, 27576, -17869, 27467, -18037, 27357, -18205, 27246, -18372, 27133,
+    -18538, 27020, -18703, 26906, -18868, 26791, -19032, 26674, -19195, 26557, -19358, 26439,
+    -19520, 26320, -19681, 26199, -19841, 26078, -20001, 25956, -20160, 25833, -20318, 25708,
+    -20475, 25583, -20632, 25457, -20788, 25330, -20943, 25202, -21097, 25073, -21251, 24943,
+    -21403, 24812, -21555, 24680, -21706, 24548, -21856, 24414, -22006, 24279, -22154, 24144,
+    -22302, 24008, -22449, 23870, -22595, 23732, -22740, 23593, -22884, 23453, -23028, 23312,
+    -23170, 23170, -23312, 23028, -23453, 22884, -23593, 22740, -23732, 22595, -23870, 22449,
+    -24008, 22302, -24144, 22154, -24279, 22006, -24414, 21856, -24548, 21706, -24680, 21555,
+    -24812, 21403, -24943, 21251, -25073, 21097, -25202, 20943, -25330, 20788, -25457, 20632,
+    -25583, 20475, -25708, 20318, -25833, 20160, -25956, 20001, -26078, 19841, -26199, 19681,
+    -26320, 19520, -26439, 19358, -26557, 19195, -26674, 19032, -26791, 18868, -26906, 18703,
+    -27020, 18538, -27133, 18372, -27246, 18205, -27357, 18037, -27467, 17869, -27576, 17700,
+    -27684, 17531, -27791, 17361, -27897, 17190, -28002, 17018, -28106, 16846, -28209, 16673,
+    -28311, 16500, -28411, 16326, -28511, 16151, -28610, 15976, -28707, 15800, -28803, 15624,
+    -28899, 15447, -28993, 15269, -29086, 15091, -29178, 14912, -29269, 14733, -29359, 14553,
+    -29448, 14373, -29535, 14192, -29622, 14010, -29707, 13828, -29792, 13646, -29875, 13463,
+    -29957, 13279, -30038, 13095, -30118, 12910, -30196, 12725, -30274, 12540, -30350, 12354,
+    -30425, 12167, -30499, 11980, -30572, 11793, -30644, 11605, -30715, 11417, -30784, 11228,
+    -30853, 11039, -30920, 10850, -30986, 10660, -31050, 10469, -31114, 10279, -31177, 10088,
+    -31238, 9896, -31298, 9704, -31357, 9512, -31415, 9319, -31471, 9127, -31527, 8933,
+    -31581, 8740, -31634, 8546, -31686, 8351, -31737, 8157, -31786, 7962, -31834, 7767,
+    -31881, 7571, -31927, 7376, -31972, 7180, -32015, 6983, -32058, 6787, -32099, 6590,
+    -32138, 6393, -32177, 6195, -32214, 5998, -32251, 5800, -32286, 5602, -32319, 5404,
+    -32352, 5205, -32383, 5007, -32413, 4808, -32442, 4609, -32470, 4410, -32496, 4211,
+    -32522, 4011, -32546, 3812, -32568, 3612, -32590, 3412, -32610, 3212, -32629, 3012,
+    -32647, 2811, -32664, 2611, -32679, 2411, -32693, 2210, -32706, 2009, -32718, 1809,
+    -32729, 1608, -32738, 1407, -32746, 1206, -32753, 1005, -32758, 804, -32762, 603,
+    -32766, 402, -32767, 201, -32768, 0, -32767, -201, -32766, -402, -32762, -603,
+    -32758, -804, -32753, -1005, -32746, -1206, -32738, -1407, -32729, -1608, -32718, -1809,
+    -32706, -2009, -32693, -2210, -32679, -2411, -32664, -2611, -32647, -2811, -32629, -3012,
+    -32610, -3212, -32590, -3412, -32568, -3612, -32546, -3812, -32522, -4011, -32496, -4211,
+    -32470, -4410, -32442, -4609, -32413, -4808, -32383, -5007, -32352, -5205, -32319, -5404,
+    -32286, -5602, -32251, -5800, -32214, -5998, -32177, -6195, -32138, -6393, -32099, -6590,
+    -32058, -6787, -32015, -6983, -31972, -7180, -31927, -7376, -31881, -7571, -31834, -7767,
+    -31786, -7962, -31737, -8157, -31686, -8351, -31634, -8546, -31581, -8740, -31527, -8933,
+    -31471, -9127, -31415, -9319, -31357, -9512, -31298, -9704, -31238, -9896, -31177, -10088,
+    -31114, -10279, -31050, -10469, -30986, -10660, -30920, -10850, -30853, -11039, -30784, -11228,
+    -30715, -11417, -30644, -11605, -30572, -11793, -30499, -11980, -30425, -12167, -30350, -12354,
+    -30274, -12540, -30196, -12725, -30118, -12910, -30038, -13095, -29957, -13279, -29875, -13463,
+    -29792, -13646, -29707, -13828, -29622, -14010, -29535, -14192, -29448, -14373, -29359, -14553,
+    -29269, -14733, -29178, -14912, -29086, -15091, -28993, -15269, -28899, -15447, -28803, -15624,
+    -28707, -15800, -28610, -15976, -28511, -16151, -28411, -16326, -28311, -16500, -28209, -16673,
+    -28106, -16846, -28002, -17018, -27897, -17190, -27791, -17361, -27684, -17531, -27576, -17700,
+    -27467, -17869, -27357, -18037, -27246, -18205, -27133, -18372, -27020, -18538, -26906, -18703,
+    -26791, -18868, -26674, -19032, -26557, -19195, -26439, -19358, -26320, -19520, -26199, -19681,
+    -26078, -19841, -25956, -20001, -25833, -20160, -25708, -20318, -25583, -20475, -25457, -20632,
+    -25330, -20788, -25202, -20943, -25073, -21097, -24943, -21251, -24812, -21403, -24680, -21555,
+    -24548, -21706, -24414, -21856, -24279, -22006, -24144, -22154, -24008, -22302, -23870, -22449,
+    -23732, -22595, -23593, -22740, -23453, -22884, -23312, -23028, -23170, -23170, -23028, -23312,
+    -22884, -23453, -22740, -23593, -22595, -23732, -22449, -23870, -22302, -24008, -22154, -24144,
+    -22006, -24279, -21856, -24414, -21706, -24548, -21555, -24680, -21403, -24812, -21251, -24943,
+    -21097, -25073, -20943, -25202, -20788, -25330, -20632, -25457, -20475, -25583, -20318, -25708,
+    -20160, -25833, -20001, -25956, -19841, -26078, -19681, -26199, -19520, -26320, -19358, -26439,
+    -19195, -26557, -19032, -26674, -18868, -26791, -18703, -26906, -18538, -27020, -18372, -27133,
+    -18205, -27246, -18037, -27357, -17869, -27467, -17700, -27576, -17531, -27684, -17361, -27791,
+    -17190, -27897, -17018, -28002, -16846, -28106, -16673, -28209, -16500, -28311, -16326, -28411,
+    -16151, -28511, -15976, -28610, -15800, -28707, -15624, -28803, -15447, -28899, -15269, -28993,
+    -15091, -29086, -14912, -29178, -14733, -29269, -14553, -29359, -14373, -29448, -14192, -29535,
+    -14010, -29622, -13828, -29707, -13646, -29792, -13463, -29875, -13279, -29957, -13095, -30038,
+    -12910, -30118, -12725, -30196, -12540, -30274, -12354, -30350, -12167, -30425, -11980, -30499,
+    -11793, -30572, -11605, -30644, -11417, -30715, -11228, -30784, -11039, -30853, -10850, -30920,
+    -10660, -30986, -10469, -31050, -10279, -31114, -10088, -31177, -9896, -31238, -9704, -31298,
+    -9512, -31357, -9319, -31415, -9127, -31471, -8933, -31527, -8740, -31581, -8546, -31634,
+    -8351, -31686, -8157, -31737, -7962, -31786, -7767, -31834, -7571, -31881, -7376, -31927,
+    -7180, -31972, -6983, -32015, -6787, -32058, -6590, -32099, -6393, -32138, -6195, -32177,
+    -5998, -32214, -5800, -32251, -5602, -32286, -5404, -32319, -5205, -32352, -5007, -32383,
+    -4808, -32413, -4609, -32442, -4410, -32470, -4211, -32496, -4011, -32522, -3812, -32546,
+    -3612, -32568, -3412, -32590, -3212, -32610, -3012, -32629, -2811, -32647, -2611, -32664,
+    -2411, -32679, -2210, -32693, -2009, -32706, -1809, -32718, -1608, -32729, -1407, -32738,
+    -1206, -32746, -1005, -32753, -804, -32758, -603, -32762, -402, -32766, -201, -32767,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_2048)
+const q15_t twiddleCoef_2048_q15[3072] = {
+    32767, 0, 32767, 101, 32767, 201, 32767, 302, 32766, 402, 32764, 503,
+    32762, 603, 32760, 704, 32758, 804, 32756, 905, 32753, 1005, 32749, 1106,
+    32746, 1206, 32742, 1307, 32738, 1407, 32733, 1507, 32729, 1608, 32723, 1708,
+    32718, 1809, 32712, 1909, 32706, 2009, 32700, 2110, 32693, 2210, 32686, 2310,
+    32679, 2411, 32672, 2511, 32664, 2611, 32656, 2711, 32647, 2811, 32638, 2912,
+    32629, 3012, 32620, 3112, 32610, 3212, 32600, 3312, 32590, 3412, 32579, 3512,
+    32568, 3612, 32557, 3712, 32546, 3812, 32534, 3911, 32522, 4011, 32509, 4111,
+    32496, 4211, 32483, 4310, 32470, 4410, 32456, 4510, 32442, 4609, 32428, 4709,
+    32413, 4808, 32398, 4907, 32383, 5007, 32368, 5106, 32352, 5205, 32336, 5305,
+    32319, 5404, 32303, 5503, 32286, 5602, 32268, 5701, 32251, 5800, 32233, 5899,
+    32214, 5998, 32196, 6097, 32177, 6195, 32158, 6294, 32138, 6393, 32119, 6491,
+    32099, 6590, 32078, 6688, 32058, 6787, 32037, 6885, 32015, 6983, 31994, 7081,
+    31972, 7180, 31950, 7278, 31927, 7376, 31904, 7473, 31881, 7571, 31858, 7669,
+    31834, 7767, 31810, 7864, 31786, 7962, 31761, 8059, 31737, 8157, 31711, 8254,
+    31686, 8351, 31660, 8449, 31634, 8546, 31608, 8643, 31581, 8740, 31554, 8836,
+    31527, 8933, 31499, 9030, 31471, 9127, 31443, 9223, 31415, 9319, 31386, 9416,
+    31357, 9512, 31328, 9608, 31298, 9704, 31268, 9800, 31238, 9896, 31207, 9992,
+    31177, 10088, 31146, 10183, 31114, 10279, 31082, 10374, 31050, 10469, 31018, 10565,
+    30986, 10660, 30953, 10755, 30920, 10850, 30886, 10945, 30853, 11039, 30819, 11134,
+    30784, 11228, 30750, 11323, 30715, 11417, 30680, 11511, 30644, 11605, 30608, 11699,
+    30572, 11793, 30536, 11887, 30499, 11980, 30462, 12074, 30425, 12167, 30388, 12261,
+    30350, 12354, 30312, 12447, 30274, 12540, 30235, 12633, 30196, 12725, 30157, 12818,
+    30118, 12910, 30078, 13003, 30038, 13095, 29997, 13187, 29957, 13279, 29916, 13371,
+    29875, 13463, 29833, 13554, 29792, 13646, 29750, 13737, 29707, 13828, 29665, 13919,
+    29622, 14010, 29579, 14101, 29535, 14192, 29492, 14282, 29448, 14373, 29404, 14463,
+    29359, 14553, 29314, 14643, 29269, 14733, 29224, 14823, 29178, 14912, 29132, 15002,
+    29086, 15091, 29040, 15180, 28993, 15269, 28946, 15358, 28899, 15447, 28851, 15535,
+    28803, 15624, 28755, 15712, 28707, 15800, 28658, 15888, 28610, 15976, 28560, 16064,
+    28511, 16151, 28461, 16239, 28411, 16326, 28361, 16413, 28311, 16500, 28260, 16587,
+    28209, 16673, 28158, 16760, 28106, 16846, 28054, 16932, 28002, 17018, 27950, 17104,
+    27897, 17190, 27844, 17275, 27791, 17361, 27738, 17446, 27684, 17531, 27630, 17616,
+    27576, 17700, 27522, 17785, 27467, 17869, 27412, 17953, 27357, 18037, 27301, 18121,
+    27246, 18205, 27190, 18288, 27133, 18372, 27077, 18455, 27020, 18538, 26963, 18621,
+    26906, 18703, 26848, 18786, 26791, 18868, 26733, 18950, 26674, 19032, 26616, 19114,
+    26557, 19195, 26498, 19277, 26439, 19358, 26379, 19439, 26320, 19520, 26259, 19601,
+    26199, 19681, 26139, 19761, 26078, 19841, 26017, 19921, 25956, 20001, 25894, 20081,
+    25833, 20160, 25771, 20239, 25708, 20318, 25646, 20397, 25583, 20475, 25520, 20554,
+    25457, 20632, 25394, 20710, 25330, 20788, 25266, 20865, 25202, 20943, 25138, 21020,
+    25073, 21097, 25008, 21174, 24943, 21251, 24878, 21327, 24812, 21403, 24746, 21479,
+    24680, 21555, 24614, 21631, 24548, 21706, 24481, 21781, 24414, 21856, 24347, 21931,
+    24279, 22006, 24212, 22080, 24144, 22154, 24076, 22228, 24008, 22302, 23939, 22375,
+    23870, 22449, 23801, 22522, 23732, 22595, 23663, 22668, 23593, 22740, 23523, 22812,
+    23453, 22884, 23383, 22956, 23312, 23028, 23241, 23099, 23170, 23170, 23099, 23241,
+    23028, 23312, 22956, 23383, 22884, 23453, 22812, 23523, 22740, 23593, 22668, 23663,
+    22595, 23732, 22522, 23801, 22449, 23870, 22375, 23939, 22302, 24008, 22228, 24076,
+    22154, 24144, 22080, 24212, 22006, 24279, 21931, 24347, 21856, 24414, 21781, 24481,
+    21706, 24548, 21631, 24614, 21555, 24680, 21479, 24746, 21403, 24812, 21327, 24878,
+    21251, 24943, 21174, 25008, 21097, 25073, 21020, 25138, 20943, 25202, 20865, 25266,
+    20788, 25330, 20710, 25394, 20632, 25457, 20554, 25520, 20475, 25583, 20397, 25646,
+    20318, 25708, 20239, 25771, 20160, 25833, 20081, 25894, 20001, 25956, 19921, 26017,
+    19841, 26078, 19761, 26139, 19681, 26199, 19601, 26259, 19520, 26320, 19439, 26379,
+    19358, 26439, 19277, 26498, 19195, 26557, 19114, 26616, 19032, 26674, 18950, 26733,
+    18868, 26791, 18786, 26848, 18703, 26906, 18621, 26963, 18538, 27020, 18455, 27077,
+    18372, 27133, 18288, 27190, 18205, 27246, 18121, 27301, 18037, 27357, 17953, 27412,
+    17869, 27467, 17785, 27522, 17700, 27576, 17616, 27630, 17531, 27684, 17446, 27738,
+    17361, 27791, 17275, 27844, 17190, 27897, 17104, 27950, 17018, 28002, 16932, 28054,
+    16846, 28106, 16760, 28158, 16673, 28209, 16587, 28260, 16500, 28311, 16413, 28361,
+    16326, 28411, 16239, 28461, 16151, 28511, 16064, 28560, 15976, 28610, 15888, 28658,
+    15800, 28707, 15712, 28755, 15624, 28803, 15535, 28851, 15447, 28899, 15358, 28946,
+    15269, 28993, 15180, 29040, 15091, 29086, 15002, 29132, 14912, 29178, 14823, 29224,
+    14733, 29269, 14643, 29314, 14553, 29359, 14463, 29404, 14373, 29448, 14282, 29492,
+    14192, 29535, 14101, 29579, 14010, 29622, 13919, 29665, 13828, 29707, 13737, 29750,
+    13646, 29792, 13554, 29833, 13463, 29875, 13371, 29916, 13279, 29957, 13187, 29997,
+    13095, 30038, 13003, 30078, 12910, 30118, 12818, 30157, 12725, 30196, 12633, 30235,
+    12540, 30274, 12447, 30312, 12354, 30350, 12261, 30388, 12167, 30425, 12074, 30462,
+    11980, 30499, 11887, 30536, 11793, 30572, 11699, 30608, 11605, 30644, 11511, 30680,
+    11417, 30715, 11323, 30750, 11228, 30784, 11134, 30819, 11039, 30853, 10945, 30886,
+    10850, 30920, 10755, 30953, 10660, 30986, 10565, 31018, 10469, 31050, 10374, 31082,
+    10279, 31114, 10183, 31146, 10088, 31177, 9992, 31207, 9896, 31238, 9800, 31268,
+    9704, 31298, 9608, 31328, 9512, 31357, 9416, 31386, 9319, 31415, 9223, 31443,
+    9127, 31471, 9030, 31499, 8933, 31527, 8836, 31554, 8740, 31581, 8643, 31608,
+    8546, 31634, 8449, 31660, 8351, 31686, 8254, 31711, 8157, 31737, 8059, 31761,
+    7962, 31786, 7864, 31810, 7767, 31834, 7669, 31858, 7571, 31881, 7473, 31904,
+    7376, 31927, 7278, 31950, 7180, 31972, 7081, 31994, 6983, 32015, 6885, 32037,
+    6787, 32058, 6688, 32078, 6590, 32099, 6491, 32119, 6393, 32138, 6294, 32158,
+    6195, 32177, 6097, 32196, 5998, 32214, 5899, 32233, 5800, 32251, 5701, 32268,
+    5602, 32286, 5503, 32303, 5404, 32319, 5305, 32336, 5205, 32352, 5106, 32368,
+    5007, 32383, 4907, 32398, 4808, 32413, 4709, 32428, 4609, 32442, 4510, 32456,
+    4410, 32470, 4310, 32483, 4211, 32496, 4111, 32509, 4011, 32522, 3911, 32534,
+    3812, 32546, 3712, 32557, 3612, 32568, 3512, 32579, 3412, 32590, 3312, 32600,
+    3212, 32610, 3112, 32620, 3012, 32629, 2912, 32638, 2811, 32647, 2711, 32656,
+    2611, 32664, 2511, 32672, 2411, 32679, 2310, 32686, 2210, 32693, 2110, 32700,
+    2009, 32706, 1909, 32712, 1809, 32718, 1708, 32723, 1608, 32729, 1507, 32733,
+    1407, 32738, 1307, 32742, 1206, 32746, 1106, 32749, 1005, 32753, 905, 32756,
+    804, 32758, 704, 32760, 603, 32762, 503, 32764, 402, 32766, 302, 32767,
+    201, 32767, 101, 32767, 0, 32767, -101, 32767, -201, 32767, -302, 32767,
+    -402, 32766, -503, 32764, -603, 32762, -704, 32760, -804, 32758, -905, 32756,
+    -1005, 32753, -1106, 32749, -1206, 32746, -1307, 32742, -1407, 32738, -1507, 32733,
+    -1608, 32729, -1708, 32723, -1809, 32718, -1909, 32712, -2009, 32706, -2110, 32700,
+    -2210, 32693, -2310, 32686, -2411, 32679, -2511, 32672, -2611, 32664, -2711, 32656,
+    -2811, 32647, -2912, 32638, -3012, 32629, -3112, 32620, -3212, 32610, -3312, 32600,
+    -3412, 32590, -3512, 32579, -3612, 32568, -3712, 32557, -3812, 32546, -3911, 32534,
+    -4011, 32522, -4111, 32509, -4211, 32496, -4310, 32483, -4410, 32470, -4510, 32456,
+    -4609, 32442, -4709, 32428, -4808, 32413, -4907, 32398, -5007, 32383, -5106, 32368,
+    -5205, 32352, -5305, 32336, -5404, 32319, -5503, 32303, -5602, 32286, -5701, 32268,
+    -5800, 32251, -5899, 32233, -5998, 32214, -6097, 32196, -6195, 32177, -6294, 32158,
+    -6393, 32138, -6491, 32119, -6590, 32099, -6688, 32078, -6787, 32058, -6885, 32037,
+    -6983, 32015, -7081, 31994, -7180, 31972, -7278, 31950, -7376, 31927, -7473, 31904,
+    -7571, 31881, -7669, 31858, -7767, 31834, -7864, 31810, -7962, 31786, -8059, 31761,
+    -8157, 31737, -8254, 31711, -8351, 31686, -8449, 31660, -8546, 31634, -8643, 31608,
+    -8740, 31581, -8836, 31554, -8933, 31527, -9030, 31499, -9127, 31471, -9223, 31443,
+    -9319, 31415, -9416, 31386, -9512, 31357, -9608, 31328, -9704, 31298, -9800, 31268,
+    -9896, 31238, -9992, 31207, -10088, 31177, -10183, 31146, -10279, 31114, -10374, 31082,
+    -10469, 31050, -10565, 31018, -10660, 30986, -10755, 30953, -10850, 30920, -10945, 30886,
+    -11039, 30853, -11134, 30819, -11228, 30784, -11323, 30750, -11417, 30715, -11511, 30680,
+    -11605, 30644, -11699, 30608, -11793, 30572, -11887, 30536, -11980, 30499, -12074, 30462,
+    -12167, 30425, -12261, 30388, -12354, 30350, -12447, 30312, -12540, 30274, -12633, 30235,
+    -12725, 30196, -12818, 30157, -12910, 30118, -13003, 30078, -13095, 30038, -13187, 29997,
+    -13279, 29957, -13371, 29916, -13463, 29875, -13554, 29833, -13646, 29792, -13737, 29750,
+    -13828, 29707, -13919, 29665, -14010, 29622, -14101, 29579, -14192, 29535, -14282, 29492,
+    -14373, 29448, -14463, 29404, -14553, 29359, -14643, 29314, -14733, 29269, -14823, 29224,
+    -14912, 29178, -15002, 29132, -15091, 29086, -15180, 29040, -15269, 28993, -15358, 28946,
+    -15447, 28899, -15535, 28851, -15624, 28803, -15712, 28755, -15800, 28707, -15888, 28658,
+    -15976, 28610, -16064, 28560, -16151, 28511, -16239, 28461, -16326, 28411, -16413, 28361,
+    -16500, 28311, -16587, 28260, -16673, 28209, -16760, 28158, -16846, 28106, -16932, 28054,
+    -17018, 28002, -17104, 27950, -17190, 27897, -17275, 27844, -17361, 27791, -17446, 27738,
+    -17531, 27684, -17616, 27630, -17700, 27576, -17785, 27522, -17869, 27467, -17953, 27412,
+    -18037, 27357, -18121, 27301, -18205, 27246, -18288, 27190, -18372, 27133, -18455, 27077,
+    -18538, 27020, -18621, 26963, -18703, 26906, -18786, 26848, -18868, 26791, -18950, 26733,
+    -19032, 26674, -19114, 26616, -19195, 26557, -19277, 26498, -19358, 26439, -19439, 26379,
+    -19520, 26320, -19601, 26259, -19681, 26199, -19761, 26139, -19841, 26078, -19921, 26017,
+    -20001, 25956, -20081, 25894, -20160, 25833, -20239, 25771, -20318, 25708, -20397, 25646,
+    -20475, 25583, -20554, 25520, -20632, 25457, -20710, 25394, -20788, 25330, -20865, 25266,
+    -20943, 25202, -21020, 25138, -21097, 25073, -21174, 25008, -21251, 24943, -21327, 24878,
+    -21403, 24812, -21479, 24746, -21555, 24680, -21631, 24614, -21706, 24548, -21781, 24481,
+    -21856, 24414, -21931, 24347, -22006, 24279, -22080, 24212, -22154, 24144, -22228, 24076,
+    -22302, 24008, -22375, 23939, -22449, 23870, -22522, 23801, -22595, 23732, -22668, 23663,
+    -22740, 23593, -22812, 23523, -22884, 23453, -22956, 23383, -23028, 23312, -23099, 23241,
+    -23170, 23170, -23241, 23099, -23312, 23028, -23383, 22956, -23453, 22884, -23523, 22812,
+    -23593, 22740, -23663, 22668, -23732, 22595, -23801, 22522, -23870, 22449, -23939, 22375,
+    -24008, 22302, -24076, 22228, -24144, 22154, -24212, 22080, -24279, 22006, -24347, 21931,
+    -24414, 21856, -24481, 21781, -24548, 21706, -24614, 21631, -24680, 21555, -24746, 21479,
+    -24812, 21403, -24878, 21327, -24943, 21251, -25008, 21174, -25073, 21097, -25138, 21020,
+    -25202, 20943, -25266, 20865, -25330, 20788, -25394, 20710, -25457, 20632, -25520, 20554,
+    -25583, 20475, -25646, 20397, -25708, 20318, -25771, 20239, -25833, 20160, -25894, 20081,
+    -25956, 20001, -26017, 19921, -26078, 19841, -26139, 19761, -26199, 19681, -26259, 19601,
+    -26320, 19520, -26379, 19439, -26439, 19358, -26498, 19277, -26557, 19195, -26616, 19114,
+    -26674, 19032, -26733, 18950, -26791, 18868, -26848, 18786, -26906, 18703, -26963, 18621,
+    -27020, 18538, -27077, 18455, -27133, 18372, -27190, 18288, -27246, 18205, -27301, 18121,
+    -27357, 18037, -27412, 17953, -27467, 17869, -27522, 17785, -27576, 17700, -27630, 17616,
+    -27684, 17531, -27738, 17446, -27791, 17361, -27844, 17275, -27897, 17190, -27950, 17104,
+    -28002, 17018, -28054, 16932, -28106, 16846, -28158, 16760, -28209, 16673, -28260, 16587,
+    -28311, 16500, -28361, 16413, -28411, 16326, -28461, 16239, -28511, 16151, -28560, 16064,
+    -28610, 15976, -28658, 15888, -28707, 15800, -28755, 15712, -28803, 15624, -28851, 15535,
+    -28899, 15447, -28946, 15358, -28993, 15269, -29040, 15180, -29086, 15091, -29132, 15002,
+    -29178, 14912, -29224, 14823, -29269, 14733, -29314, 14643, -29359, 14553, -29404, 14463,
+    -29448, 14373, -29492, 14282, -29535, 14192, -29579, 14101, -29622, 14010, -29665, 13919,
+    -29707, 13828, -29750, 13737, -29792, 13646, -29833, 13554, -29875, 13463, -29916, 13371,
+    -29957, 13279, -29997, 13187, -30038, 13095, -30078, 13003, -30118, 12910, -30157, 12818,
+    -30196, 12725, -30235, 12633, -30274, 12540, -30312, 12447, -30350, 12354, -30388, 12261,
+    -30425, 12167, -30462, 12074, -30499, 11980, -30536, 11887, -30572, 11793, -30608, 11699,
+    -30644, 11605, -30680, 11511, -30715, 11417, -30750, 11323, -30784, 11228, -30819, 11134,
+    -30853, 11039, -30886, 10945, -30920, 10850, -30953, 10755, -30986, 10660, -31018, 10565,
+    -31050, 10469, -31082, 10374, -31114, 10279, -31146, 10183, -31177, 10088, -31207, 9992,
+    -31238, 9896, -31268, 9800, -31298, 9704, -31328, 9608, -31357, 9512, -31386, 9416,
+    -31415, 9319, -31443, 9223, -31471, 9127, -31499, 9030, -31527, 8933, -31554, 8836,
+    -31581, 8740, -31608, 8643, -31634, 8546, -31660, 8449, -31686, 8351, -31711, 8254,
+    -31737, 8157, -31761, 8059, -31786, 7962, -31810, 7864, -31834, 7767, -31858, 7669,
+    -31881, 7571, -31904, 7473, -31927, 7376, -31950, 7278, -31972, 7180, -31994, 7081,
+    -32015, 6983, -32037, 6885, -32058, 6787, -32078, 6688, -32099, 6590, -32119, 6491,
+    -32138, 6393, -32158, 6294, -32177, 6195, -32196, 6097, -32214, 5998, -32233, 5899,
+    -32251, 5800, -32268, 5701, -32286, 5602, -32303, 5503, -32319, 5404, -32336, 5305,
+    -32352, 5205, -32368, 5106, -32383, 5007, -32398, 4907, -32413, 4808, -32428, 4709,
+    -32442, 4609, -32456, 4510, -32470, 4410, -32483, 4310, -32496, 4211, -32509, 4111,
+    -32522, 4011, -32534, 3911, -32546, 3812, -32557, 3712, -32568, 3612, -32579, 3512,
+    -32590, 3412, -32600, 3312, -32610, 3212, -32620, 3112, -32629, 3012, -32638, 2912,
+    -32647, 2811, -32656, 2711, -32664, 2611, -32672, 2511, -32679, 2411, -32686, 2310,
+    -32693, 2210, -32700, 2110, -32706, 2009, -32712, 1909, -32718, 1809, -32723, 1708,
+    -32729, 1608, -32733, 1507, -32738, 1407, -32742, 1307, -32746, 1206, -32749, 1106,
+    -32753, 1005, -32756, 905, -32758, 804, -32760, 704, -32762, 603, -32764, 503,
+    -32766, 402, -32767, 302, -32767, 201, -32768, 101, -32768, 0, -32768, -101,
+    -32767, -201, -32767, -302, -32766, -402, -32764, -503, -32762, -603, -32760, -704,
+    -32758, -804, -32756, -905, -32753, -1005, -32749, -1106, -32746, -1206, -32742, -1307,
+    -32738, -1407, -32733, -1507, -32729, -1608, -32723, -1708, -32718, -1809, -32712, -1909,
+    -32706, -2009, -32700, -2110, -32693, -2210, -32686, -2310, -32679, -2411, -32672, -2511,
+    -32664, -2611, -32656, -2711, -32647, -2811, -32638, -2912, -32629, -3012, -32620, -3112,
+    -32610, -3212, -32600, -3312, -32590, -3412, -32579, -3512, -32568, -3612, -32557, -3712,
+    -32546, -3812, -32534, -3911, -32522, -4011, -32509, -4111, -32496, -4211, -32483, -4310,
+    -32470, -4410, -32456, -4510, -32442, -4609, -32428, -4709, -32413, -4808, -32398, -4907,
+    -32383, -5007, -32368, -5106, -32352, -5205, -32336, -5305, -32319, -5404, -32303, -5503,
+    -32286, -5602, -32268, -5701, -32251, -5800, -32233, -5899, -32214, -5998, -32196, -6097,
+    -32177, -6195, -32158, -6294, -32138, -6393, -32119, -6491, -32099, -6590, -32078, -6688,
+    -32058, -6787, -32037, -6885, -32015, -6983, -31994, -7081, -31972, -7180, -31950, -7278,
+    -31927, -7376, -31904, -7473, -31881, -7571, -31858, -7669, -31834, -7767, -31810, -7864,
+    -31786, -7962, -31761, -8059, -31737, -8157, -31711, -8254, -31686, -8351, -31660, -8449,
+    -31634, -8546, -31608, -8643, -31581, -8740, -31554, -8836, -31527, -8933, -31499, -9030,
+    -31471, -9127, -31443, -9223, -31415, -9319, -31386, -9416, -31357, -9512, -31328, -9608,
+    -31298, -9704, -31268, -9800, -31238, -9896, -31207, -9992, -31177, -10088, -31146, -10183,
+    -31114, -10279, -31082, -10374, -31050, -10469, -31018, -10565, -30986, -10660, -30953, -10755,
+    -30920, -10850, -30886, -10945, -30853, -11039, -30819, -11134, -30784, -11228, -30750, -11323,
+    -30715, -11417, -30680, -11511, -30644, -11605, -30608, -11699, -30572, -11793, -30536, -11887,
+    -30499, -11980, -30462, -12074, -30425, -12167, -30388, -12261, -30350, -12354, -30312, -12447,
+    -30274, -12540, -30235, -12633, -30196, -12725, -30157, -12818, -30118, -12910, -30078, -13003,
+    -30038, -13095, -29997, -13187, -29957, -13279, -29916, -13371, -29875, -13463, -29833, -13554,
+    -29792, -13646, -29750, -13737, -29707, -13828, -29665, -13919, -29622, -14010, -29579, -14101,
+    -29535, -14192, -29492, -14282, -29448, -14373, -29404, -14463, -29359, -14553, -29314, -14643,
+    -29269, -14733, -29224, -14823, -29178, -14912, -29132, -15002, -29086, -15091, -29040, -15180,
+    -28993, -15269, -28946, -15358, -28899, -15447, -28851, -15535, -28803, -15624, -28755, -15712,
+    -28707, -15800, -28658, -15888, -28610, -15976, -28560, -16064, -28511, -16151, -28461, -16239,
+    -28411, -16326, -28361, -16413, -28311, -16500, -28260, -16587, -28209, -16673, -28158, -16760,
+    -28106, -16846, -28054, -16932, -28002, -17018, -27950, -17104, -27897, -17190, -27844, -17275,
+    -27791, -17361, -27738, -17446, -27684, -17531, -27630, -17616, -27576, -17700, -27522, -17785,
+    -27467, -17869, -27412, -17953, -27357, -18037, -27301, -18121, -27246, -18205, -27190, -18288,
+    -27133, -18372, -27077, -18455, -27020, -18538, -26963, -18621, -26906, -18703, -26848, -18786,
+    -26791, -18868, -26733, -18950, -26674, -19032, -26616, -19114, -26557, -19195, -26498, -19277,
+    -26439, -19358, -26379, -19439, -26320, -19520, -26259, -19601, -26199, -19681, -26139, -19761,
+    -26078, -19841, -26017, -19921, -25956, -20001, -25894, -20081, -25833, -20160, -25771, -20239,
+    -25708, -20318, -25646, -20397, -25583, -20475, -25520, -20554, -25457, -20632, -25394, -20710,
+    -25330, -20788, -25266, -20865, -25202, -20943, -25138, -21020, -25073, -21097, -25008, -21174,
+    -24943, -21251, -24878, -21327, -24812, -21403, -24746, -21479, -24680, -21555, -24614, -21631,
+    -24548, -21706, -24481, -21781, -24414, -21856, -24347, -21931, -24279, -22006, -24212, -22080,
+    -24144, -22154, -24076, -22228, -24008, -22302, -23939, -22375, -23870, -22449, -23801, -22522,
+    -23732, -22595, -23663, -22668, -23593, -22740, -23523, -22812, -23453, -22884, -23383, -22956,
+    -23312, -23028, -23241, -23099, -23170, -23170, -23099, -23241, -23028, -23312, -22956, -23383,
+    -22884, -23453, -22812, -23523, -22740, -23593, -22668, -23663, -22595, -23732, -22522, -23801,
+    -22449, -23870, -22375, -23939, -22302, -24008, -22228, -24076, -22154, -24144, -22080, -24212,
+    -22006, -24279, -21931, -24347, -21856, -24414, -21781, -24481, -21706, -24548, -21631, -24614,
+    -21555, -24680, -21479, -24746, -21403, -24812, -21327, -24878, -21251, -24943, -21174, -25008,
+    -21097, -25073, -21020, -25138, -20943, -25202, -20865, -25266, -20788, -25330, -20710, -25394,
+    -20632, -25457, -20554, -25520, -20475, -25583, -20397, -25646, -20318, -25708, -20239, -25771,
+    -20160, -25833, -20081, -25894, -20001, -25956, -19921, -26017, -19841, -26078, -19761, -26139,
+    -19681, -26199, -19601, -26259, -19520, -26320, -19439, -26379, -19358, -26439, -19277, -26498,
+    -19195, -26557, -19114, -26616, -19032, -26674, -18950, -26733, -18868, -26791, -18786, -26848,
+    -18703, -26906, -18621, -26963, -18538, -27020, -18455, -27077, -18372, -27133, -18288, -27190,
+    -18205, -27246, -18121, -27301, -18037, -27357, -17953, -27412, -17869, -27467, -17785, -27522,
+    -17700, -27576, -17616, -27630, -17531, -27684, -17446, -27738, -17361, -27791, -17275, -27844,
+    -17190, -27897, -17104, -27950, -17018, -28002, -16932, -28054, -16846, -28106, -16760, -28158,
+    -16673, -28209, -16587, -28260, -16500, -28311, -16413, -28361, -16326, -28411, -16239, -28461,
+    -16151, -28511, -16064, -28560, -15976, -28610, -15888, -28658, -15800, -28707, -15712, -28755,
+    -15624, -28803, -15535, -28851, -15447, -28899, -15358, -28946, -15269, -28993, -15180, -29040,
+    -15091, -29086, -15002, -29132, -14912, -29178, -14823, -29224, -14733, -29269, -14643, -29314,
+    -14553, -29359, -14463, -29404, -14373, -29448, -14282, -29492, -14192, -29535, -14101, -29579,
+    -14010, -29622, -13919, -29665, -13828, -29707, -13737, -29750, -13646, -29792, -13554, -29833,
+    -13463, -29875, -13371, -29916, -13279, -29957, -13187, -29997, -13095, -30038, -13003, -30078,
+    -12910, -30118, -12818, -30157, -12725, -30196, -12633, -30235, -12540, -30274, -12447, -30312,
+    -12354, -30350, -12261, -30388, -12167, -30425, -12074, -30462, -11980, -30499, -11887, -30536,
+    -11793, -30572, -11699, -30608, -11605, -30644, -11511, -30680, -11417, -30715, -11323, -30750,
+    -11228, -30784, -11134, -30819, -11039, -30853, -10945, -30886, -10850, -30920, -10755, -30953,
+    -10660, -30986, -10565, -31018, -10469, -31050, -10374, -31082, -10279, -31114, -10183, -31146,
+    -10088, -31177, -9992, -31207, -9896, -31238, -9800, -31268, -9704, -31298, -9608, -31328,
+    -9512, -31357, -9416, -31386, -9319, -31415, -9223, -31443, -9127, -31471, -9030, -31499,
+    -8933, -31527, -8836, -31554, -8740, -31581, -8643, -31608, -8546, -31634, -8449, -31660,
+    -8351, -31686, -8254, -31711, -8157, -31737, -8059, -31761, -7962, -31786, -7864, -31810,
+    -7767, -31834, -7669, -31858, -7571, -31881, -7473, -31904, -7376, -31927, -7278, -31950,
+    -7180, -31972, -7081, -31994, -6983, -32015, -6885, -32037, -6787, -32058, -6688, -32078,
+    -6590, -32099, -6491, -32119, -6393, -32138, -6294, -32158, -6195, -32177, -6097, -32196,
+    -5998, -32214, -5899, -32233, -5800, -32251, -5701, -32268, -5602, -32286, -5503, -32303,
+    -5404, -32319, -5305, -32336, -5205, -32352, -5106, -32368, -5007, -32383, -4907, -32398,
+    -4808, -32413, -4709, -32428, -4609, -32442, -4510, -32456, -4410, -32470, -4310, -32483,
+    -4211, -32496, -4111, -32509, -4011, -32522, -3911, -32534, -3812, -32546, -3712, -32557,
+    -3612, -32568, -3512, -32579, -3412, -32590, -3312, -32600, -3212, -32610, -3112, -32620,
+    -3012, -32629, -2912, -32638, -2811, -32647, -2711, -32656, -2611, -32664, -2511, -32672,
+    -2411, -32679, -2310, -32686, -2210, -32693, -2110, -32700, -2009, -32706, -1909, -32712,
+    -1809, -32718, -1708, -32723, -1608, -32729, -1507, -32733, -1407, -32738, -1307, -32742,
+    -1206, -32746, -1106, -32749, -1005, -32753, -905, -32756, -804, -32758, -704, -32760,
+    -603, -32762, -503, -32764, -402, -32766, -302, -32767, -201, -32767, -101, -32768,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_4096)
+const q15_t twiddleCoef_4096_q15[6144] = {
+    32767, 0, 32767, 50, 32767, 101, 32767, 151, 32767, 201, 32767, 251,
+    32767, 302, 32766, 352, 32766, 402, 32765, 452, 32764, 503, 32763, 553,
+    32762, 603, 32761, 653, 32760, 704, 32759, 754, 32758, 804, 32757, 854,
+    32756, 905, 32754, 955, 32753, 1005, 32751, 1055, 32749, 1106, 32748, 1156,
+    32746, 1206, 32744, 1256, 32742, 1307, 32740, 1357, 32738, 1407, 32736, 1457,
+    32733, 1507, 32731, 1558, 32729, 1608, 32726, 1658, 32723, 1708, 32721, 1758,
+    32718, 1809, 32715, 1859, 32712, 1909, 32709, 1959, 32706, 2009, 32703, 2060,
+    32700, 2110, 32697, 2160, 32693, 2210, 32690, 2260, 32686, 2310, 32683, 2360,
+    32679, 2411, 32675, 2461, 32672, 2511, 32668, 2561, 32664, 2611, 32660, 2661,
+    32656, 2711, 32651, 2761, 32647, 2811, 32643, 2861, 32638, 2912, 32634, 2962,
+    32629, 3012, 32625, 3062, 32620, 3112, 32615, 3162, 32610, 3212, 32605, 3262,
+    32600, 3312, 32595, 3362, 32590, 3412, 32585, 3462, 32579, 3512, 32574, 3562,
+    32568, 3612, 32563, 3662, 32557, 3712, 32551, 3762, 32546, 3812, 32540, 3861,
+    32534, 3911, 32528, 3961, 32522, 4011, 32515, 4061, 32509, 4111, 32503, 4161,
+    32496, 4211, 32490, 4260, 32483, 4310, 32477, 4360, 32470, 4410, 32463, 4460,
+    32456, 4510, 32449, 4559, 32442, 4609, 32435, 4659, 32428, 4709, 32421, 4758,
+    32413, 4808, 32406, 4858, 32398, 4907, 32391, 4957, 32383, 5007, 32376, 5057,
+    32368, 5106, 32360, 5156, 32352, 5205, 32344, 5255, 32336, 5305, 32328, 5354,
+    32319, 5404, 32311, 5453, 32303, 5503, 32294, 5553, 32286, 5602, 32277, 5652,
+    32268, 5701, 32259, 5751, 32251, 5800, 32242, 5850, 32233, 5899, 32224, 5948,
+    32214, 5998, 32205, 6047, 32196, 6097, 32186, 6146, 32177, 6195, 32167, 6245,
+    32158, 6294, 32148, 6343, 32138, 6393, 32129, 6442, 32119, 6491, 32109, 6541,
+    32099, 6590, 32088, 6639, 32078, 6688, 32068, 6737, 32058, 6787, 32047, 6836,
+    32037, 6885, 32026, 6934, 32015, 6983, 32005, 7032, 31994, 7081, 31983, 7130,
+    31972, 7180, 31961, 7229, 31950, 7278, 31938, 7327, 31927, 7376, 31916, 7425,
+    31904, 7473, 31893, 7522, 31881, 7571, 31870, 7620, 31858, 7669, 31846, 7718,
+    31834, 7767, 31822, 7816, 31810, 7864, 31798, 7913, 31786, 7962, 31774, 8011,
+    31761, 8059, 31749, 8108, 31737, 8157, 31724, 8206, 31711, 8254, 31699, 8303,
+    31686, 8351, 31673, 8400, 31660, 8449, 31647, 8497, 31634, 8546, 31621, 8594,
+    31608, 8643, 31594, 8691, 31581, 8740, 31568, 8788, 31554, 8836, 31540, 8885,
+    31527, 8933, 31513, 8982, 31499, 9030, 31485, 9078, 31471, 9127, 31457, 9175,
+    31443, 9223, 31429, 9271, 31415, 9319, 31400, 9368, 31386, 9416, 31372, 9464,
+    31357, 9512, 31342, 9560, 31328, 9608, 31313, 9656, 31298, 9704, 31283, 9752,
+    31268, 9800, 31253, 9848, 31238, 9896, 31223, 9944, 31207, 9992, 31192, 10040,
+    31177, 10088, 31161, 10135, 31146, 10183, 31130, 10231, 31114, 10279, 31098, 10326,
+    31082, 10374, 31067, 10422, 31050, 10469, 31034, 10517, 31018, 10565, 31002, 10612,
+    30986, 10660, 30969, 10707, 30953, 10755, 30936, 10802, 30920, 10850, 30903, 10897,
+    30886, 10945, 30869, 10992, 30853, 11039, 30836, 11087, 30819, 11134, 30801, 11181,
+    30784, 11228, 30767, 11276, 30750, 11323, 30732, 11370, 30715, 11417, 30697, 11464,
+    30680, 11511, 30662, 11558, 30644, 11605, 30626, 11652, 30608, 11699, 30590, 11746,
+    30572, 11793, 30554, 11840, 30536, 11887, 30518, 11934, 30499, 11980, 30481, 12027,
+    30462, 12074, 30444, 12121, 30425, 12167, 30407, 12214, 30388, 12261, 30369, 12307,
+    30350, 12354, 30331, 12400, 30312, 12447, 30293, 12493, 30274, 12540, 30254, 12586,
+    30235, 12633, 30216, 12679, 30196, 12725, 30177, 12772, 30157, 12818, 30137, 12864,
+    30118, 12910, 30098, 12957, 30078, 13003, 30058, 13049, 30038, 13095, 30018, 13141,
+    29997, 13187, 29977, 13233, 29957, 13279, 29936, 13325, 29916, 13371, 29895, 13417,
+    29875, 13463, 29854, 13508, 29833, 13554, 29813, 13600, 29792, 13646, 29771, 13691,
+    29750, 13737, 29729, 13783, 29707, 13828, 29686, 13874, 29665, 13919, 29643, 13965,
+    29622, 14010, 29600, 14056, 29579, 14101, 29557, 14146, 29535, 14192, 29514, 14237,
+    29492, 14282, 29470, 14327, 29448, 14373, 29426, 14418, 29404, 14463, 29381, 14508,
+    29359, 14553, 29337, 14598, 29314, 14643, 29292, 14688, 29269, 14733, 29247, 14778,
+    29224, 14823, 29201, 14867, 29178, 14912, 29155, 14957, 29132, 15002, 29109, 15046,
+    29086, 15091, 29063, 15136, 29040, 15180, 29016, 15225, 28993, 15269, 28970, 15314,
+    28946, 15358, 28922, 15402, 28899, 15447, 28875, 15491, 28851, 15535, 28827, 15580,
+    28803, 15624, 28779, 15668, 28755, 15712, 28731, 15756, 28707, 15800, 28683, 15844,
+    28658, 15888, 28634, 15932, 28610, 15976, 28585, 16020, 28560, 16064, 28536, 16108,
+    28511, 16151, 28486, 16195, 28461, 16239, 28436, 16282, 28411, 16326, 28386, 16369,
+    28361, 16413, 28336, 16456, 28311, 16500, 28285, 16543, 28260, 16587, 28234, 16630,
+    28209, 16673, 28183, 16717, 28158, 16760, 28132, 16803, 28106, 16846, 28080, 16889,
+    28054, 16932, 28028, 16975, 28002, 17018, 27976, 17061, 27950, 17104, 27924, 17147,
+    27897, 17190, 27871, 17233, 27844, 17275, 27818, 17318, 27791, 17361, 27765, 17403,
+    27738, 17446, 27711, 17488, 27684, 17531, 27657, 17573, 27630, 17616, 27603, 17658,
+    27576, 17700, 27549, 17743, 27522, 17785, 27494, 17827, 27467, 17869, 27440, 17911,
+    27412, 17953, 27384, 17995, 27357, 18037, 27329, 18079, 27301, 18121, 27273, 18163,
+    27246, 18205, 27218, 18247, 27190, 18288, 27162, 18330, 27133, 18372, 27105, 18413,
+    27077, 18455, 27049, 18496, 27020, 18538, 26992, 18579, 26963, 18621, 26935, 18662,
+    26906, 18703, 26877, 18745, 26848, 18786, 26820, 18827, 26791, 18868, 26762, 18909,
+    26733, 18950, 26704, 18991, 26674, 19032, 26645, 19073, 26616, 19114, 26586, 19155,
+    26557, 19195, 26528, 19236, 26498, 19277, 26468, 19317, 26439, 19358, 26409, 19399,
+    26379, 19439, 26349, 19479, 26320, 19520, 26290, 19560, 26259, 19601, 26229, 19641,
+    26199, 19681, 26169, 19721, 26139, 19761, 26108, 19801, 26078, 19841, 26048, 19881,
+    26017, 19921, 25986, 19961, 25956, 20001, 25925, 20041, 25894, 20081, 25863, 20120,
+    25833, 20160, 25802, 20200, 25771, 20239, 25739, 20279, 25708, 20318, 25677, 20357,
+    25646, 20397, 25615, 20436, 25583, 20475, 25552, 20515, 25520, 20554, 25489, 20593,
+    25457, 20632, 25425, 20671, 25394, 20710, 25362, 20749, 25330, 20788, 25298, 20827,
+    25266, 20865, 25234, 20904, 25202, 20943, 25170, 20981, 25138, 21020, 25105, 21059,
+    25073, 21097, 25041, 21136, 25008, 21174, 24976, 21212, 24943, 21251, 24910, 21289,
+    24878, 21327, 24845, 21365, 24812, 21403, 24779, 21441, 24746, 21479, 24713, 21517,
+    24680, 21555, 24647, 21593, 24614, 21631, 24581, 21668, 24548, 21706, 24514, 21744,
+    24481, 21781, 24448, 21819, 24414, 21856, 24380, 21894, 24347, 21931, 24313, 21968,
+    24279, 22006, 24246, 22043, 24212, 22080, 24178, 22117, 24144, 22154, 24110, 22191,
+    24076, 22228, 24042, 22265, 24008, 22302, 23973, 22339, 23939, 22375, 23905, 22412,
+    23870, 22449, 23836, 22485, 23801, 22522, 23767, 22558, 23732, 22595, 23697, 22631,
+    23663, 22668, 23628, 22704, 23593, 22740, 23558, 22776, 23523, 22812, 23488, 22848,
+    23453, 22884, 23418, 22920, 23383, 22956, 23348, 22992, 23312, 23028, 23277, 23064,
+    23241, 23099, 23206, 23135, 23170, 23170, 23135, 23206, 23099, 23241, 23064, 23277,
+    23028, 23312, 22992, 23348, 22956, 23383, 22920, 23418, 22884, 23453, 22848, 23488,
+    22812, 23523, 22776, 23558, 22740, 23593, 22704, 23628, 22668, 23663, 22631, 23697,
+    22595, 23732, 22558, 23767, 22522, 23801, 22485, 23836, 22449, 23870, 22412, 23905,
+    22375, 23939, 22339, 23973, 22302, 24008, 22265, 24042, 22228, 24076, 22191, 24110,
+    22154, 24144, 22117, 24178, 22080, 24212, 22043, 24246, 22006, 24279, 21968, 24313,
+    21931, 24347, 21894, 24380, 21856, 24414, 21819, 24448, 21781, 24481, 21744, 24514,
+    21706, 24548, 21668, 24581, 21631, 24614, 21593, 24647, 21555, 24680, 21517, 24713,
+    21479, 24746, 21441, 24779, 21403, 24812, 21365, 24845, 21327, 24878, 21289, 24910,
+    21251, 24943, 21212, 24976, 21174, 25008, 21136, 25041, 21097, 25073, 21059, 25105,
+    21020, 25138, 20981, 25170, 20943, 25202, 20904, 25234, 20865, 25266, 20827, 25298,
+    20788, 25330, 20749, 25362, 20710, 25394, 20671, 25425, 20632, 25457, 20593, 25489,
+    20554, 25520, 20515, 25552, 20475, 25583, 20436, 25615, 20397, 25646, 20357, 25677,
+    20318, 25708, 20279, 25739, 20239, 25771, 20200, 25802, 20160, 25833, 20120, 25863,
+    20081, 25894, 20041, 25925, 20001, 25956, 19961, 25986, 19921, 26017, 19881, 26048,
+    19841, 26078, 19801, 26108, 19761, 26139, 19721, 26169, 19681, 26199, 19641, 26229,
+    19601, 26259, 19560, 26290, 19520, 26320, 19479, 26349, 19439, 26379, 19399, 26409,
+    19358, 26439, 19317, 26468, 19277, 26498, 19236, 26528, 19195, 26557, 19155, 26586,
+    19114, 26616, 19073, 26645, 19032, 26674, 18991, 26704, 18950, 26733, 18909, 26762,
+    18868, 26791, 18827, 26820, 18786, 26848, 18745, 26877, 18703, 26906, 18662, 26935,
+    18621, 26963, 18579, 26992, 18538, 27020, 18496, 27049, 18455, 27077, 18413, 27105,
+    18372, 27133, 18330, 27162, 18288, 27190, 18247, 27218, 18205, 27246, 18163, 27273,
+    18121, 27301, 18079, 27329, 18037, 27357, 17995, 27384, 17953, 27412, 17911, 27440,
+    17869, 27467, 17827, 27494, 17785, 27522, 17743, 27549, 17700, 27576, 17658, 27603,
+    17616, 27630, 17573, 27657, 17531, 27684, 17488, 27711, 17446, 27738, 17403, 27765,
+    17361, 27791, 17318, 27818, 17275, 27844, 17233, 27871, 17190, 27897, 17147, 27924,
+    17104, 27950, 17061, 27976, 17018, 28002, 16975, 28028, 16932, 28054, 16889, 28080,
+    16846, 28106, 16803, 28132, 16760, 28158, 16717, 28183, 16673, 28209, 16630, 28234,
+    16587, 28260, 16543, 28285, 16500, 28311, 16456, 28336, 16413, 28361, 16369, 28386,
+    16326, 28411, 16282, 28436, 16239, 28461, 16195, 28486, 16151, 28511, 16108, 28536,
+    16064, 28560, 16020, 28585, 15976, 28610, 15932, 28634, 15888, 28658, 15844, 28683,
+    15800, 28707, 15756, 28731, 15712, 28755, 15668, 28779, 15624, 28803, 15580, 28827,
+    15535, 28851, 15491, 28875, 15447, 28899, 15402, 28922, 15358, 28946, 15314, 28970,
+    15269, 28993, 15225, 29016, 15180, 29040, 15136, 29063, 15091, 29086, 15046, 29109,
+    15002, 29132, 14957, 29155, 14912, 29178, 14867, 29201, 14823, 29224, 14778, 29247,
+    14733, 29269, 14688, 29292, 14643, 29314, 14598, 29337, 14553, 29359, 14508, 29381,
+    14463, 29404, 14418, 29426, 14373, 29448, 14327, 29470, 14282, 29492, 14237, 29514,
+    14192, 29535, 14146, 29557, 14101, 29579, 14056, 29600, 14010, 29622, 13965, 29643,
+    13919, 29665, 13874, 29686, 13828, 29707, 13783, 29729, 13737, 29750, 13691, 29771,
+    13646, 29792, 13600, 29813, 13554, 29833, 13508, 29854, 13463, 29875, 13417, 29895,
+    13371, 29916, 13325, 29936, 13279, 29957, 13233, 29977, 13187, 29997, 13141, 30018,
+    13095, 30038, 13049, 30058, 13003, 30078, 12957, 30098, 12910, 30118, 12864, 30137,
+    12818, 30157, 12772, 30177, 12725, 30196, 12679, 30216, 12633, 30235, 12586, 30254,
+    12540, 30274, 12493, 30293, 12447, 30312, 12400, 30331, 12354, 30350, 12307, 30369,
+    12261, 30388, 12214, 30407, 12167, 30425, 12121, 30444, 12074, 30462, 12027, 30481,
+    11980, 30499, 11934, 30518, 11887, 30536, 11840, 30554, 11793, 30572, 11746, 30590,
+    11699, 30608, 11652, 30626, 11605, 30644, 11558, 30662, 11511, 30680, 11464, 30697,
+    11417, 30715, 11370, 30732, 11323, 30750, 11276, 30767, 11228, 30784, 11181, 30801,
+    11134, 30819, 11087, 30836, 11039, 30853, 10992, 30869, 10945, 30886, 10897, 30903,
+    10850, 30920, 10802, 30936, 10755, 30953, 10707, 30969, 10660, 30986, 10612, 31002,
+    10565, 31018, 10517, 31034, 10469, 31050, 10422, 31067, 10374, 31082, 10326, 31098,
+    10279, 31114, 10231, 31130, 10183, 31146, 10135, 31161, 10088, 31177, 10040, 31192,
+    9992, 31207, 9944, 31223, 9896, 31238, 9848, 31253, 9800, 31268, 9752, 31283,
+    9704, 31298, 9656, 31313, 9608, 31328, 9560, 31342, 9512, 31357, 9464, 31372,
+    9416, 31386, 9368, 31400, 9319, 31415, 9271, 31429, 9223, 31443, 9175, 31457,
+    9127, 31471, 9078, 31485, 9030, 31499, 8982, 31513, 8933, 31527, 8885, 31540,
+    8836, 31554, 8788, 31568, 8740, 31581, 8691, 31594, 8643, 31608, 8594, 31621,
+    8546, 31634, 8497, 31647, 8449, 31660, 8400, 31673, 8351, 31686, 8303, 31699,
+    8254, 31711, 8206, 31724, 8157, 31737, 8108, 31749, 8059, 31761, 8011, 31774,
+    7962, 31786, 7913, 31798, 7864, 31810, 7816, 31822, 7767, 31834, 7718, 31846,
+    7669, 31858, 7620, 31870, 7571, 31881, 7522, 31893, 7473, 31904, 7425, 31916,
+    7376, 31927, 7327, 31938, 7278, 31950, 7229, 31961, 7180, 31972, 7130, 31983,
+    7081, 31994, 7032, 32005, 6983, 32015, 6934, 32026, 6885, 32037, 6836, 32047,
+    6787, 32058, 6737, 32068, 6688, 32078, 6639, 32088, 6590, 32099, 6541, 32109,
+    6491, 32119, 6442, 32129, 6393, 32138, 6343, 32148, 6294, 32158, 6245, 32167,
+    6195, 32177, 6146, 32186, 6097, 32196, 6047, 32205, 5998, 32214, 5948, 32224,
+    5899, 32233, 5850, 32242, 5800, 32251, 5751, 32259, 5701, 32268, 5652, 32277,
+    5602, 32286, 5553, 32294, 5503, 32303, 5453, 32311, 5404, 32319, 5354, 32328,
+    5305, 32336, 5255, 32344, 5205, 32352, 5156, 32360, 5106, 32368, 5057, 32376,
+    5007, 32383, 4957, 32391, 4907, 32398, 4858, 32406, 4808, 32413, 4758, 32421,
+    4709, 32428, 4659, 32435, 4609, 32442, 4559, 32449, 4510, 32456, 4460, 32463,
+    4410, 32470, 4360, 32477, 4310, 32483, 4260, 32490, 4211, 32496, 4161, 32503,
+    4111, 32509, 4061, 32515, 4011, 32522, 3961, 32528, 3911, 32534, 3861, 32540,
+    3812, 32546, 3762, 32551, 3712, 32557, 3662, 32563, 3612, 32568, 3562, 32574,
+    3512, 32579, 3462, 32585, 3412, 32590, 3362, 32595, 3312, 32600, 3262, 32605,
+    3212, 32610, 3162, 32615, 3112, 32620, 3062, 32625, 3012, 32629, 2962, 32634,
+    2912, 32638, 2861, 32643, 2811, 32647, 2761, 32651, 2711, 32656, 2661, 32660,
+    2611, 32664, 2561, 32668, 2511, 32672, 2461, 32675, 2411, 32679, 2360, 32683,
+    2310, 32686, 2260, 32690, 2210, 32693, 2160, 32697, 2110, 32700, 2060, 32703,
+    2009, 32706, 1959, 32709, 1909, 32712, 1859, 32715, 1809, 32718, 1758, 32721,
+    1708, 32723, 1658, 32726, 1608, 32729, 1558, 32731, 1507, 32733, 1457, 32736,
+    1407, 32738, 1357, 32740, 1307, 32742, 1256, 32744, 1206, 32746, 1156, 32748,
+    1106, 32749, 1055, 32751, 1005, 32753, 955, 32754, 905, 32756, 854, 32757,
+    804, 32758, 754, 32759, 704, 32760, 653, 32761, 603, 32762, 553, 32763,
+    503, 32764, 452, 32765, 402, 32766, 352, 32766, 302, 32767, 251, 32767,
+    201, 32767, 151, 32767, 101, 32767, 50, 32767, 0, 32767, -50, 32767,
+    -101, 32767, -151, 32767, -201, 32767, -251, 32767, -302, 32767, -352, 32766,
+    -402, 32766, -452, 32765, -503, 32764, -553, 32763, -603, 32762, -653, 32761,
+    -704, 32760, -754, 32759, -804, 32758, -854, 32757, -905, 32756, -955, 32754,
+    -1005, 32753, -1055, 32751, -1106, 32749, -1156, 32748, -1206, 32746, -1256, 32744,
+    -1307, 32742, -1357, 32740, -1407, 32738, -1457, 32736, -1507, 32733, -1558, 32731,
+    -1608, 32729, -1658, 32726, -1708, 32723, -1758, 32721, -1809, 32718, -1859, 32715,
+    -1909, 32712, -1959, 32709, -2009, 32706, -2060, 32703, -2110, 32700, -2160, 32697,
+    -2210, 32693, -2260, 32690, -2310, 32686, -2360, 32683, -2411, 32679, -2461, 32675,
+    -2511, 32672, -2561, 32668, -2611, 32664, -2661, 32660, -2711, 32656, -2761, 32651,
+    -2811, 32647, -2861, 32643, -2912, 32638, -2962, 32634, -3012, 32629, -3062, 32625,
+    -3112, 32620, -3162, 32615, -3212, 32610, -3262, 32605, -3312, 32600, -3362, 32595,
+    -3412, 32590, -3462, 32585, -3512, 32579, -3562, 32574, -3612, 32568, -3662, 32563,
+    -3712, 32557, -3762, 32551, -3812, 32546, -3861, 32540, -3911, 32534, -3961, 32528,
+    -4011, 32522, -4061, 32515, -4111, 32509, -4161, 32503, -4211, 32496, -4260, 32490,
+    -4310, 32483, -4360, 32477, -4410, 32470, -4460, 32463, -4510, 32456, -4559, 32449,
+    -4609, 32442, -4659, 32435, -4709, 32428, -4758, 32421, -4808, 32413, -4858, 32406,
+    -4907, 32398, -4957, 32391, -5007, 32383, -5057, 32376, -5106, 32368, -5156, 32360,
+    -5205, 32352, -5255, 32344, -5305, 32336, -5354, 32328, -5404, 32319, -5453, 32311,
+    -5503, 32303, -5553, 32294, -5602, 32286, -5652, 32277, -5701, 32268, -5751, 32259,
+    -5800, 32251, -5850, 32242, -5899, 32233, -5948, 32224, -5998, 32214, -6047, 32205,
+    -6097, 32196, -6146, 32186, -6195, 32177, -6245, 32167, -6294, 32158, -6343, 32148,
+    -6393, 32138, -6442, 32129, -6491, 32119, -6541, 32109, -6590, 32099, -6639, 32088,
+    -6688, 32078, -6737, 32068, -6787, 32058, -6836, 32047, -6885, 32037, -6934, 32026,
+    -6983, 32015, -7032, 32005, -7081, 31994, -7130, 31983, -7180, 31972, -7229, 31961,
+    -7278, 31950, -7327, 31938, -7376, 31927, -7425, 31916, -7473, 31904, -7522, 31893,
+    -7571, 31881, -7620, 31870, -7669, 31858, -7718, 31846, -7767, 31834, -7816, 31822,
+    -7864, 31810, -7913, 31798, -7962, 31786, -8011, 31774, -8059, 31761, -8108, 31749,
+    -8157, 31737, -8206, 31724, -8254, 31711, -8303, 31699, -8351, 31686, -8400, 31673,
+    -8449, 31660, -8497, 31647, -8546, 31634, -8594, 31621, -8643, 31608, -8691, 31594,
+    -8740, 31581, -8788, 31568, -8836, 31554, -8885, 31540, -8933, 31527, -8982, 31513,
+    -9030, 31499, -9078, 31485, -9127, 31471, -9175, 31457, -9223, 31443, -9271, 31429,
+    -9319, 31415, -9368, 31400, -9416, 31386, -9464, 31372, -9512, 31357, -9560, 31342,
+    -9608, 31328, -9656, 31313, -9704, 31298, -9752, 31283, -9800, 31268, -9848, 31253,
+    -9896, 31238, -9944, 31223, -9992, 31207, -10040, 31192, -10088, 31177, -10135, 31161,
+    -10183, 31146, -10231, 31130, -10279, 31114, -10326, 31098, -10374, 31082, -10422, 31067,
+    -10469, 31050, -10517, 31034, -10565, 31018, -10612, 31002, -10660, 30986, -10707, 30969,
+    -10755, 30953, -10802, 30936, -10850, 30920, -10897, 30903, -10945, 30886, -10992, 30869,
+    -11039, 30853, -11087, 30836, -11134, 30819, -11181, 30801, -11228, 30784, -11276, 30767,
+    -11323, 30750, -11370, 30732, -11417, 30715, -11464, 30697, -11511, 30680, -11558, 30662,
+    -11605, 30644, -11652, 30626, -11699, 30608, -11746, 30590, -11793, 30572, -11840, 30554,
+    -11887, 30536, -11934, 30518, -11980, 30499, -12027, 30481, -12074, 30462, -12121, 30444,
+    -12167, 30425, -12214, 30407, -12261, 30388, -12307, 30369, -12354, 30350, -12400, 30331,
+    -12447, 30312, -12493, 30293, -12540, 30274, -12586, 30254, -12633, 30235, -12679, 30216,
+    -12725, 30196, -12772, 30177, -12818, 30157, -12864, 30137, -12910, 30118, -12957, 30098,
+    -13003, 30078, -13049, 30058, -13095, 30038, -13141, 30018, -13187, 29997, -13233, 29977,
+    -13279, 29957, -13325, 29936, -13371, 29916, -13417, 29895, -13463, 29875, -13508, 29854,
+    -13554, 29833, -13600, 29813, -13646, 29792, -13691, 29771, -13737, 29750, -13783, 29729,
+    -13828, 29707, -13874, 29686, -13919, 29665, -13965, 29643, -14010, 29622, -14056, 29600,
+    -14101, 29579, -14146, 29557, -14192, 29535, -14237, 29514, -14282, 29492, -14327, 29470,
+    -14373, 29448, -14418, 29426, -14463, 29404, -14508, 29381, -14553, 29359, -14598, 29337,
+    -14643, 29314, -14688, 29292, -14733, 29269, -14778, 29247, -14823, 29224, -14867, 29201,
+    -14912, 29178, -14957, 29155, -15002, 29132, -15046, 29109, -15091, 29086, -15136, 29063,
+    -15180, 29040, -15225, 29016, -15269, 28993, -15314, 28970, -15358, 28946, -15402, 28922,
+    -15447, 28899, -15491, 28875, -15535, 28851, -15580, 28827, -15624, 28803, -15668, 28779,
+    -15712, 28755, -15756, 28731, -15800, 28707, -15844, 28683, -15888, 28658, -15932, 28634,
+    -15976, 28610, -16020, 28585, -16064, 28560, -16108, 28536, -16151, 28511, -16195, 28486,
+    -16239, 28461, -16282, 28436, -16326, 28411, -16369, 28386, -16413, 28361, -16456, 28336,
+    -16500, 28311, -16543, 28285, -16587, 28260, -16630, 28234, -16673, 28209, -16717, 28183,
+    -16760, 28158, -16803, 28132, -16846, 28106, -16889, 28080, -16932, 28054, -16975, 28028,
+    -17018, 28002, -17061, 27976, -17104, 27950, -17147, 27924, -17190, 27897, -17233, 27871,
+    -17275, 27844, -17318, 27818, -17361, 27791, -17403, 27765, -17446, 27738, -17488, 27711,
+    -17531, 27684, -17573, 27657, -17616, 27630, -17658, 27603, -17700, 27576, -17743, 27549,
+    -17785, 27522, -17827, 27494, -17869, 27467, -17911, 27440, -17953, 27412, -17995, 27384,
+    -18037, 27357, -18079, 27329, -18121, 27301, -18163, 27273, -18205, 27246, -18247, 27218,
+    -18288, 27190, -18330, 27162, -18372, 27133, -18413, 27105, -18455, 27077, -18496, 27049,
+    -18538, 27020, -18579, 26992, -18621, 26963, -18662, 26935, -18703, 26906, -18745, 26877,
+    -18786, 26848, -18827, 26820, -18868, 26791, -18909, 26762, -18950, 26733, -18991, 26704,
+    -19032, 26674, -19073, 26645, -19114, 26616, -19155, 26586, -19195, 26557, -19236, 26528,
+    -19277, 26498, -19317, 26468, -19358, 26439, -19399, 26409, -19439, 26379, -19479, 26349,
+    -19520, 26320, -19560, 26290, -19601, 26259, -19641, 26229, -19681, 26199, -19721, 26169,
+    -19761, 26139, -19801, 26108, -19841, 26078, -19881, 26048, -19921, 26017, -19961, 25986,
+    -20001, 25956, -20041, 25925, -20081, 25894, -20120, 25863, -20160, 25833, -20200, 25802,
+    -20239, 25771, -20279, 25739, -20318, 25708, -20357, 25677, -20397, 25646, -20436, 25615,
+    -20475, 25583, -20515, 25552, -20554, 25520, -20593, 25489, -20632, 25457, -20671, 25425,
+    -20710, 25394, -20749, 25362, -20788, 25330, -20827, 25298, -20865, 25266, -20904, 25234,
+    -20943, 25202, -20981, 25170, -21020, 25138, -21059, 25105, -21097, 25073, -21136, 25041,
+    -21174, 25008, -21212, 24976, -21251, 24943, -21289, 24910, -21327, 24878, -21365, 24845,
+    -21403, 24812, -21441, 24779, -21479, 24746, -21517, 24713, -21555, 24680, -21593, 24647,
+    -21631, 24614, -21668, 24581, -21706, 24548, -21744, 24514, -21781, 24481, -21819, 24448,
+    -21856, 24414, -21894, 24380, -21931, 24347, -21968, 24313, -22006, 24279, -22043, 24246,
+    -22080, 24212, -22117, 24178, -22154, 24144, -22191, 24110, -22228, 24076, -22265, 24042,
+    -22302, 24008, -22339, 23973, -22375, 23939, -22412, 23905, -22449, 23870, -22485, 23836,
+    -22522, 23801, -22558, 23767, -22595, 23732, -22631, 23697, -22668, 23663, -22704, 23628,
+    -22740, 23593, -22776, 23558, -22812, 23523, -22848, 23488, -22884, 23453, -22920, 23418,
+    -22956, 23383, -22992, 23348, -23028, 23312, -23064, 23277, -23099, 23241, -23135, 23206,
+    -23170, 23170, -23206, 23135, -23241, 23099, -23277, 23064, -23312, 23028, -23348, 22992,
+    -23383, 22956, -23418, 22920, -23453, 22884, -23488, 22848, -23523, 22812, -23558, 22776,
+    -23593, 22740, -23628, 22704, -23663, 22668, -23697, 22631, -23732, 22595, -23767, 22558,
+    -23801, 22522, -23836, 22485, -23870, 22449, -23905, 22412, -23939, 22375, -23973, 22339,
+    -24008, 22302, -24042, 22265, -24076, 22228, -24110, 22191, -24144, 22154, -24178, 22117,
+    -24212, 22080, -24246, 22043, -24279, 22006, -24313, 21968, -24347, 21931, -24380, 21894,
+    -24414, 21856, -24448, 21819, -24481, 21781, -24514, 21744, -24548, 21706, -24581, 21668,
+    -24614, 21631, -24647, 21593, -24680, 21555, -24713, 21517, -24746, 21479, -24779, 21441,
+    -24812, 21403, -24845, 21365, -24878, 21327, -24910, 21289, -24943, 21251, -24976, 21212,
+    -25008, 21174, -25041, 21136, -25073, 21097, -25105, 21059, -25138, 21020, -25170, 20981,
+    -25202, 20943, -25234, 20904, -25266, 20865, -25298, 20827, -25330, 20788, -25362, 20749,
+    -25394, 20710, -25425, 20671, -25457, 20632, -25489, 20593, -25520, 20554, -25552, 20515,
+    -25583, 20475, -25615, 20436, -25646, 20397, -25677, 20357, -25708, 20318, -25739, 20279,
+    -25771, 20239, -25802, 20200, -25833, 20160, -25863, 20120, -25894, 20081, -25925, 20041,
+    -25956, 20001, -25986, 19961, -26017, 19921, -26048, 19881, -26078, 19841, -26108, 19801,
+    -26139, 19761, -26169, 19721, -26199, 19681, -26229, 19641, -26259, 19601, -26290, 19560,
+    -26320, 19520, -26349, 19479, -26379, 19439, -26409, 19399, -26439, 19358, -26468, 19317,
+    -26498, 19277, -26528, 19236, -26557, 19195, -26586, 19155, -26616, 19114, -26645, 19073,
+    -26674, 19032, -26704, 18991, -26733, 18950, -26762, 18909, -26791, 18868, -26820, 18827,
+    -26848, 18786, -26877, 18745, -26906, 18703, -26935, 18662, -26963, 18621, -26992, 18579,
+    -27020, 18538, -27049, 18496, -27077, 18455, -27105, 18413, -27133, 18372, -27162, 18330,
+    -27190, 18288, -27218, 18247, -27246, 18205, -27273, 18163, -27301, 18121, -27329, 18079,
+    -27357, 18037, -27384, 17995, -27412, 17953, -27440, 17911, -27467, 17869, -27494, 17827,
+    -27522, 17785, -27549, 17743, -27576, 17700, -27603, 17658, -27630, 17616, -27657, 17573,
+    -27684, 17531, -27711, 17488, -27738, 17446, -27765, 17403, -27791, 17361, -27818, 17318,
+    -27844, 17275, -27871, 17233, -27897, 17190, -27924, 17147, -27950, 17104, -27976, 17061,
+    -28002, 17018, -28028, 16975, -28054, 16932, -28080, 16889, -28106, 16846, -28132, 16803,
+    -28158, 16760, -28183, 16717, -28209, 16673, -28234, 16630, -28260, 16587, -28285, 16543,
+    -28311, 16500, -28336, 16456, -28361, 16413, -28386, 16369, -28411, 16326, -28436, 16282,
+    -28461, 16239, -28486, 16195, -28511, 16151, -28536, 16108, -28560, 16064, -28585, 16020,
+    -28610, 15976, -28634, 15932, -28658, 15888, -28683, 15844, -28707, 15800, -28731, 15756,
+    -28755, 15712, -28779, 15668, -28803, 15624, -28827, 15580, -28851, 15535, -28875, 15491,
+    -28899, 15447, -28922, 15402, -28946, 15358, -28970, 15314, -28993, 15269, -29016, 15225,
+    -29040, 15180, -29063, 15136, -29086, 15091, -29109, 15046, -29132, 15002, -29155, 14957,
+    -29178, 14912, -29201, 14867, -29224, 14823, -29247, 14778, -29269, 14733, -29292, 14688,
+    -29314, 14643, -29337, 14598, -29359, 14553, -29381, 14508, -29404, 14463, -29426, 14418,
+    -29448, 14373, -29470, 14327, -29492, 14282, -29514, 14237, -29535, 14192, -29557, 14146,
+    -29579, 14101, -29600, 14056, -29622, 14010, -29643, 13965, -29665, 13919, -29686, 13874,
+    -29707, 13828, -29729, 13783, -29750, 13737, -29771, 13691, -29792, 13646, -29813, 13600,
+    -29833, 13554, -29854, 13508, -29875, 13463, -29895, 13417, -29916, 13371, -29936, 13325,
+    -29957, 13279, -29977, 13233, -29997, 13187, -30018, 13141, -30038, 13095, -30058, 13049,
+    -30078, 13003, -30098, 12957, -30118, 12910, -30137, 12864, -30157, 12818, -30177, 12772,
+    -30196, 12725, -30216, 12679, -30235, 12633, -30254, 12586, -30274, 12540, -30293, 12493,
+    -30312, 12447, -30331, 12400, -30350, 12354, -30369, 12307, -30388, 12261, -30407, 12214,
+    -30425, 12167, -30444, 12121, -30462, 12074, -30481, 12027, -30499, 11980, -30518, 11934,
+    -30536, 11887, -30554, 11840, -30572, 11793, -30590, 11746, -30608, 11699, -30626, 11652,
+    -30644, 11605, -30662, 11558, -30680, 11511, -30697, 11464, -30715, 11417, -30732, 11370,
+    -30750, 11323, -30767, 11276, -30784, 11228, -30801, 11181, -30819, 11134, -30836, 11087,
+    -30853, 11039, -30869, 10992, -30886, 10945, -30903, 10897, -30920, 10850, -30936, 10802,
+    -30953, 10755, -30969, 10707, -30986, 10660, -31002, 10612, -31018, 10565, -31034, 10517,
+    -31050, 10469, -31067, 10422, -31082, 10374, -31098, 10326, -31114, 10279, -31130, 10231,
+    -31146, 10183, -31161, 10135, -31177, 10088, -31192, 10040, -31207, 9992, -31223, 9944,
+    -31238, 9896, -31253, 9848, -31268, 9800, -31283, 9752, -31298, 9704, -31313, 9656,
+    -31328, 9608, -31342, 9560, -31357, 9512, -31372, 9464, -31386, 9416, -31400, 9368,
+    -31415, 9319, -31429, 9271, -31443, 9223, -31457, 9175, -31471, 9127, -31485, 9078,
+    -31499, 9030, -31513, 8982, -31527, 8933, -31540, 8885, -31554, 8836, -31568, 8788,
+    -31581, 8740, -31594, 8691, -31608, 8643, -31621, 8594, -31634, 8546, -31647, 8497,
+    -31660, 8449, -31673, 8400, -31686, 8351, -31699, 8303, -31711, 8254, -31724, 8206,
+    -31737, 8157, -31749, 8108, -31761, 8059, -31774, 8011, -31786, 7962, -31798, 7913,
+    -31810, 7864, -31822, 7816, -31834, 7767, -31846, 7718, -31858, 7669, -31870, 7620,
+    -31881, 7571, -31893, 7522, -31904, 7473, -31916, 7425, -31927, 7376, -31938, 7327,
+    -31950, 7278, -31961, 7229, -31972, 7180, -31983, 7130, -31994, 7081, -32005, 7032,
+    -32015, 6983, -32026, 6934, -32037, 6885, -32047, 6836, -32058, 6787, -32068, 6737,
+    -32078, 6688, -32088, 6639, -32099, 6590, -32109, 6541, -32119, 6491, -32129, 6442,
+    -32138, 6393, -32148, 6343, -32158, 6294, -32167, 6245, -32177, 6195, -32186, 6146,
+    -32196, 6097, -32205, 6047, -32214, 5998, -32224, 5948, -32233, 5899, -32242, 5850,
+    -32251, 5800, -32259, 5751, -32268, 5701, -32277, 5652, -32286, 5602, -32294, 5553,
+    -32303, 5503, -32311, 5453, -32319, 5404, -32328, 5354, -32336, 5305, -32344, 5255,
+    -32352, 5205, -32360, 5156, -32368, 5106, -32376, 5057, -32383, 5007, -32391, 4957,
+    -32398, 4907, -32406, 4858, -32413, 4808, -32421, 4758, -32428, 4709, -32435, 4659,
+    -32442, 4609, -32449, 4559, -32456, 4510, -32463, 4460, -32470, 4410, -32477, 4360,
+    -32483, 4310, -32490, 4260, -32496, 4211, -32503, 4161, -32509, 4111, -32515, 4061,
+    -32522, 4011, -32528, 3961, -32534, 3911, -32540, 3861, -32546, 3812, -32551, 3762,
+    -32557, 3712, -32563, 3662, -32568, 3612, -32574, 3562, -32579, 3512, -32585, 3462,
+    -32590, 3412, -32595, 3362, -32600, 3312, -32605, 3262, -32610, 3212, -32615, 3162,
+    -32620, 3112, -32625, 3062, -32629, 3012, -32634, 2962, -32638, 2912, -32643, 2861,
+    -32647, 2811, -32651, 2761, -32656, 2711, -32660, 2661, -32664, 2611, -32668, 2561,
+    -32672, 2511, -32675, 2461, -32679, 2411, -32683, 2360, -32686, 2310, -32690, 2260,
+    -32693, 2210, -32697, 2160, -32700, 2110, -32703, 2060, -32706, 2009, -32709, 1959,
+    -32712, 1909, -32715, 1859, -32718, 1809, -32721, 1758, -32723, 1708, -32726, 1658,
+    -32729, 1608, -32731, 1558, -32733, 1507, -32736, 1457, -32738, 1407, -32740, 1357,
+    -32742, 1307, -32744, 1256, -32746, 1206, -32748, 1156, -32749, 1106, -32751, 1055,
+    -32753, 1005, -32754, 955, -32756, 905, -32757, 854, -32758, 804, -32759, 754,
+    -32760, 704, -32761, 653, -32762, 603, -32763, 553, -32764, 503, -32765, 452,
+    -32766, 402, -32766, 352, -32767, 302, -32767, 251, -32767, 201, -32768, 151,
+    -32768, 101, -32768, 50, -32768, 0, -32768, -50, -32768, -101, -32768, -151,
+    -32767, -201, -32767, -251, -32767, -302, -32766, -352, -32766, -402, -32765, -452,
+    -32764, -503, -32763, -553, -32762, -603, -32761, -653, -32760, -704, -32759, -754,
+    -32758, -804, -32757, -854, -32756, -905, -32754, -955, -32753, -1005, -32751, -1055,
+    -32749, -1106, -32748, -1156, -32746, -1206, -32744, -1256, -32742, -1307, -32740, -1357,
+    -32738, -1407, -32736, -1457, -32733, -1507, -32731, -1558, -32729, -1608, -32726, -1658,
+    -32723, -1708, -32721, -1758, -32718, -1809, -32715, -1859, -32712, -1909, -32709, -1959,
+    -32706, -2009, -32703, -2060, -32700, -2110, -32697, -2160, -32693, -2210, -32690, -2260,
+    -32686, -2310, -32683, -2360, -32679, -2411, -32675, -2461, -32672, -2511, -32668, -2561,
+    -32664, -2611, -32660, -2661, -32656, -2711, -32651, -2761, -32647, -2811, -32643, -2861,
+    -32638, -2912, -32634, -2962, -32629, -3012, -32625, -3062, -32620, -3112, -32615, -3162,
+    -32610, -3212, -32605, -3262, -32600, -3312, -32595, -3362, -32590, -3412, -32585, -3462,
+    -32579, -3512, -32574, -3562, -32568, -3612, -32563, -3662, -32557, -3712, -32551, -3762,
+    -32546, -3812, -32540, -3861, -32534, -3911, -32528, -3961, -32522, -4011, -32515, -4061,
+    -32509, -4111, -32503, -4161, -32496, -4211, -32490, -4260, -32483, -4310, -32477, -4360,
+    -32470, -4410, -32463, -4460, -32456, -4510, -32449, -4559, -32442, -4609, -32435, -4659,
+    -32428, -4709, -32421, -4758, -32413, -4808, -32406, -4858, -32398, -4907, -32391, -4957,
+    -32383, -5007, -32376, -5057, -32368, -5106, -32360, -5156, -32352, -5205, -32344, -5255,
+    -32336, -5305, -32328, -5354, -32319, -5404, -32311, -5453, -32303, -5503, -32294, -5553,
+    -32286, -5602, -32277, -5652, -32268, -5701, -32259, -5751, -32251, -5800, -32242, -5850,
+    -32233, -5899, -32224, -5948, -32214, -5998, -32205, -6047, -32196, -6097, -32186, -6146,
+    -32177, -6195, -32167, -6245, -32158, -6294, -32148, -6343, -32138, -6393, -32129, -6442,
+    -32119, -6491, -32109, -6541, -32099, -6590, -32088, -6639, -32078, -6688, -32068, -6737,
+    -32058, -6787, -32047, -6836, -32037, -6885, -32026, -6934, -32015, -6983, -32005, -7032,
+    -31994, -7081, -31983, -7130, -31972, -7180, -31961, -7229, -31950, -7278, -31938, -7327,
+    -31927, -7376, -31916, -7425, -31904, -7473, -31893, -7522, -31881, -7571, -31870, -7620,
+    -31858, -7669, -31846, -7718, -31834, -7767, -31822, -7816, -31810, -7864, -31798, -7913,
+    -31786, -7962, -31774, -8011, -31761, -8059, -31749, -8108, -31737, -8157, -31724, -8206,
+    -31711, -8254, -31699, -8303, -31686, -8351, -31673, -8400, -31660, -8449, -31647, -8497,
+    -31634, -8546, -31621, -8594, -31608, -8643, -31594, -8691, -31581, -8740, -31568, -8788,
+    -31554, -8836, -31540, -8885, -31527, -8933, -31513, -8982, -31499, -9030, -31485, -9078,
+    -31471, -9127, -31457, -9175, -31443, -9223, -31429, -9271, -31415, -9319, -31400, -9368,
+    -31386, -9416, -31372, -9464, -31357, -9512, -31342, -9560, -31328, -9608, -31313, -9656,
+    -31298, -9704, -31283, -9752, -31268, -9800, -31253, -9848, -31238, -9896, -31223, -9944,
+    -31207, -9992, -31192, -10040, -31177, -10088, -31161, -10135, -31146, -10183, -31130, -10231,
+    -31114, -10279, -31098, -10326, -31082, -10374, -31067, -10422, -31050, -10469, -31034, -10517,
+    -31018, -10565, -31002, -10612, -30986, -10660, -30969, -10707, -30953, -10755, -30936, -10802,
+    -30920, -10850, -30903, -10897, -30886, -10945, -30869, -10992, -30853, -11039, -30836, -11087,
+    -30819, -11134, -30801, -11181, -30784, -11228, -30767, -11276, -30750, -11323, -30732, -11370,
+    -30715, -11417, -30697, -11464, -30680, -11511, -30662, -11558, -30644, -11605, -30626, -11652,
+    -30608, -11699, -30590, -11746, -30572, -11793, -30554, -11840, -30536, -11887, -30518, -11934,
+    -30499, -11980, -30481, -12027, -30462, -12074, -30444, -12121, -30425, -12167, -30407, -12214,
+    -30388, -12261, -30369, -12307, -30350, -12354, -30331, -12400, -30312, -12447, -30293, -12493,
+    -30274, -12540, -30254, -12586, -30235, -12633, -30216, -12679, -30196, -12725, -30177, -12772,
+    -30157, -12818, -30137, -12864, -30118, -12910, -30098, -12957, -30078, -13003, -30058, -13049,
+    -30038, -13095, -30018, -13141, -29997, -13187, -29977, -13233, -29957, -13279, -29936, -13325,
+    -29916, -13371, -29895, -13417, -29875, -13463, -29854, -13508, -29833, -13554, -29813, -13600,
+    -29792, -13646, -29771, -13691, -29750, -13737, -29729, -13783, -29707, -13828, -29686, -13874,
+    -29665, -13919, -29643, -13965, -29622, -14010, -29600, -14056, -29579, -14101, -29557, -14146,
+    -29535, -14192, -29514, -14237, -29492, -14282, -29470, -14327, -29448, -14373, -29426, -14418,
+    -29404, -14463, -29381, -14508, -29359, -14553, -29337, -14598, -29314, -14643, -29292, -14688,
+    -29269, -14733, -29247, -14778, -29224, -14823, -29201, -14867, -29178, -14912, -29155, -14957,
+    -29132, -15002, -29109, -15046, -29086, -15091, -29063, -15136, -29040, -15180, -29016, -15225,
+    -28993, -15269, -28970, -15314, -28946, -15358, -28922, -15402, -28899, -15447, -28875, -15491,
+    -28851, -15535, -28827, -15580, -28803, -15624, -28779, -15668, -28755, -15712, -28731, -15756,
+    -28707, -15800, -28683, -15844, -28658, -15888, -28634, -15932, -28610, -15976, -28585, -16020,
+    -28560, -16064, -28536, -16108, -28511, -16151, -28486, -16195, -28461, -16239, -28436, -16282,
+    -28411, -16326, -28386, -16369, -28361, -16413, -28336, -16456, -28311, -16500, -28285, -16543,
+    -28260, -16587, -28234, -16630, -28209, -16673, -28183, -16717, -28158, -16760, -28132, -16803,
+    -28106, -16846, -28080, -16889, -28054, -16932, -28028, -16975, -28002, -17018, -27976, -17061,
+    -27950, -17104, -27924, -17147, -27897, -17190, -27871, -17233, -27844, -17275, -27818, -17318,
+    -27791, -17361, -27765, -17403, -27738, -17446, -27711, -17488, -27684, -17531, -27657, -17573,
+    -27630, -17616, -27603, -17658, -27576, -17700, -27549, -17743, -27522, -17785, -27494, -17827,
+    -27467, -17869, -27440, -17911, -27412, -17953, -27384, -17995, -27357, -18037, -27329, -18079,
+    -27301, -18121, -27273, -18163, -27246, -18205, -27218, -18247, -27190, -18288, -27162, -18330,
+    -27133, -18372, -27105, -18413, -27077, -18455, -27049, -18496, -27020, -18538, -26992, -18579,
+    -26963, -18621, -26935, -18662, -26906, -18703, -26877, -18745, -26848, -18786, -26820, -18827,
+    -26791, -18868, -26762, -18909, -26733, -18950, -26704, -18991, -26674, -19032, -26645, -19073,
+    -26616, -19114, -26586, -19155, -26557, -19195, -26528, -19236, -26498, -19277, -26468, -19317,
+    -26439, -19358, -26409, -19399, -26379, -19439, -26349, -19479, -26320, -19520, -26290, -19560,
+    -26259, -19601, -26229, -19641, -26199, -19681, -26169, -19721, -26139, -19761, -26108, -19801,
+    -26078, -19841, -26048, -19881, -26017, -19921, -25986, -19961, -25956, -20001, -25925, -20041,
+    -25894, -20081, -25863, -20120, -25833, -20160, -25802, -20200, -25771, -20239, -25739, -20279,
+    -25708, -20318, -25677, -20357, -25646, -20397, -25615, -20436, -25583, -20475, -25552, -20515,
+    -25520, -20554, -25489, -20593, -25457, -20632, -25425, -20671, -25394, -20710, -25362, -20749,
+    -25330, -20788, -25298, -20827, -25266, -20865, -25234, -20904, -25202, -20943, -25170, -20981,
+    -25138, -21020, -25105, -21059, -25073, -21097, -25041, -21136, -25008, -21174, -24976, -21212,
+    -24943, -21251, -24910, -21289, -24878, -21327, -24845, -21365, -24812, -21403, -24779, -21441,
+    -24746, -21479, -24713, -21517, -24680, -21555, -24647, -21593, -24614, -21631, -24581, -21668,
+    -24548, -21706, -24514, -21744, -24481, -21781, -24448, -21819, -24414, -21856, -24380, -21894,
+    -24347, -21931, -24313, -21968, -24279, -22006, -24246, -22043, -24212, -22080, -24178, -22117,
+    -24144, -22154, -24110, -22191, -24076, -22228, -24042, -22265, -24008, -22302, -23973, -22339,
+    -23939, -22375, -23905, -22412, -23870, -22449, -23836, -22485, -23801, -22522, -23767, -22558,
+    -23732, -22595, -23697, -22631, -23663, -22668, -23628, -22704, -23593, -22740, -23558, -22776,
+    -23523, -22812, -23488, -22848, -23453, -22884, -23418, -22920, -23383, -22956, -23348, -22992,
+    -23312, -23028, -23277, -23064, -23241, -23099, -23206, -23135, -23170, -23170, -23135, -23206,
+    -23099, -23241, -23064, -23277, -23028, -23312, -22992, -23348, -22956, -23383, -22920, -23418,
+    -22884, -23453, -22848, -23488, -22812, -23523, -22776, -23558, -22740, -23593, -22704, -23628,
+    -22668, -23663, -22631, -23697, -22595, -23732, -22558, -23767, -22522, -23801, -22485, -23836,
+    -22449, -23870, -22412, -23905, -22375, -23939, -22339, -23973, -22302, -24008, -22265, -24042,
+    -22228, -24076, -22191, -24110, -22154, -24144, -22117, -24178, -22080, -24212, -22043, -24246,
+    -22006, -24279, -21968, -24313, -21931, -24347, -21894, -24380, -21856, -24414, -21819, -24448,
+    -21781, -24481, -21744, -24514, -21706, -24548, -21668, -24581, -21631, -24614, -21593, -24647,
+    -21555, -24680, -21517, -24713, -21479, -24746, -21441, -24779, -21403, -24812, -21365, -24845,
+    -21327, -24878, -21289, -24910, -21251, -24943, -21212, -24976, -21174, -25008, -21136, -25041,
+    -21097, -25073, -21059, -25105, -21020, -25138, -20981, -25170, -20943, -25202, -20904, -25234,
+    -20865, -25266, -20827, -25298, -20788, -25330, -20749, -25362, -20710, -25394, -20671, -25425,
+    -20632, -25457, -20593, -25489, -20554, -25520, -20515, -25552, -20475, -25583, -20436, -25615,
+    -20397, -25646, -20357, -25677, -20318, -25708, -20279, -25739, -20239, -25771, -20200, -25802,
+    -20160, -25833, -20120, -25863, -20081, -25894, -20041, -25925, -20001, -25956, -19961, -25986,
+    -19921, -26017, -19881, -26048, -19841, -26078, -19801, -26108, -19761, -26139, -19721, -26169,
+    -19681, -26199, -19641, -26229, -19601, -26259, -19560, -26290, -19520, -26320, -19479, -26349,
+    -19439, -26379, -19399, -26409, -19358, -26439, -19317, -26468, -19277, -26498, -19236, -26528,
+    -19195, -26557, -19155, -26586, -19114, -26616, -19073, -26645, -19032, -26674, -18991, -26704,
+    -18950, -26733, -18909, -26762, -18868, -26791, -18827, -26820, -18786, -26848, -18745, -26877,
+    -18703, -26906, -18662, -26935, -18621, -26963, -18579, -26992, -18538, -27020, -18496, -27049,
+    -18455, -27077, -18413, -27105, -18372, -27133, -18330, -27162, -18288, -27190, -18247, -27218,
+    -18205, -27246, -18163, -27273, -18121, -27301, -18079, -27329, -18037, -27357, -17995, -27384,
+    -17953, -27412, -17911, -27440, -17869, -27467, -17827, -27494, -17785, -27522, -17743, -27549,
+    -17700, -27576, -17658, -27603, -17616, -27630, -17573, -27657, -17531, -27684, -17488, -27711,
+    -17446, -27738, -17403, -27765, -17361, -27791, -17318, -27818, -17275, -27844, -17233, -27871,
+    -17190, -27897, -17147, -27924, -17104, -27950, -17061, -27976, -17018, -28002, -16975, -28028,
+    -16932, -28054, -16889, -28080, -16846, -28106, -16803, -28132, -16760, -28158, -16717, -28183,
+    -16673, -28209, -16630, -28234, -16587, -28260, -16543, -28285, -16500, -28311, -16456, -28336,
+    -16413, -28361, -16369, -28386, -16326, -28411, -16282, -28436, -16239, -28461, -16195, -28486,
+    -16151, -28511, -16108, -28536, -16064, -28560, -16020, -28585, -15976, -28610, -15932, -28634,
+    -15888, -28658, -15844, -28683, -15800, -28707, -15756, -28731, -15712, -28755, -15668, -28779,
+    -15624, -28803, -15580, -28827, -15535, -28851, -15491, -28875, -15447, -28899, -15402, -28922,
+    -15358, -28946, -15314, -28970, -15269, -28993, -15225, -29016, -15180, -29040, -15136, -29063,
+    -15091, -29086, -15046, -29109, -15002, -29132, -14957, -29155, -14912, -29178, -14867, -29201,
+    -14823, -29224, -14778, -29247, -14733, -29269, -14688, -29292, -14643, -29314, -14598, -29337,
+    -14553, -29359, -14508, -29381, -14463, -29404, -14418, -29426, -14373, -29448, -14327, -29470,
+    -14282, -29492, -14237, -29514, -14192, -29535, -14146, -29557, -14101, -29579, -14056, -29600,
+    -14010, -29622, -13965, -29643, -13919, -29665, -13874, -29686, -13828, -29707, -13783, -29729,
+    -13737, -29750, -13691, -29771, -13646, -29792, -13600, -29813, -13554, -29833, -13508, -29854,
+    -13463, -29875, -13417, -29895, -13371, -29916, -13325, -29936, -13279, -29957, -13233, -29977,
+    -13187, -29997, -13141, -30018, -13095, -30038, -13049, -30058, -13003, -30078, -12957, -30098,
+    -12910, -30118, -12864, -30137, -12818, -30157, -12772, -30177, -12725, -30196, -12679, -30216,
+    -12633, -30235, -12586, -30254, -12540, -30274, -12493, -30293, -12447, -30312, -12400, -30331,
+    -12354, -30350, -12307, -30369, -12261, -30388, -12214, -30407, -12167, -30425, -12121, -30444,
+    -12074, -30462, -12027, -30481, -11980, -30499, -11934, -30518, -11887, -30536, -11840, -30554,
+    -11793, -30572, -11746, -30590, -11699, -30608, -11652, -30626, -11605, -30644, -11558, -30662,
+    -11511, -30680, -11464, -30697, -11417, -30715, -11370, -30732, -11323, -30750, -11276, -30767,
+    -11228, -30784, -11181, -30801, -11134, -30819, -11087, -30836, -11039, -30853, -10992, -30869,
+    -10945, -30886, -10897, -30903, -10850, -30920, -10802, -30936, -10755, -30953, -10707, -30969,
+    -10660, -30986, -10612, -31002, -10565, -31018, -10517, -31034, -10469, -31050, -10422, -31067,
+    -10374, -31082, -10326, -31098, -10279, -31114, -10231, -31130, -10183, -31146, -10135, -31161,
+    -10088, -31177, -10040, -31192, -9992, -31207, -9944, -31223, -9896, -31238, -9848, -31253,
+    -9800, -31268, -9752, -31283, -9704, -31298, -9656, -31313, -9608, -31328, -9560, -31342,
+    -9512, -31357, -9464, -31372, -9416, -31386, -9368, -31400, -9319, -31415, -9271, -31429,
+    -9223, -31443, -9175, -31457, -9127, -31471, -9078, -31485, -9030, -31499, -8982, -31513,
+    -8933, -31527, -8885, -31540, -8836, -31554, -8788, -31568, -8740, -31581, -8691, -31594,
+    -8643, -31608, -8594, -31621, -8546, -31634, -8497, -31647, -8449, -31660, -8400, -31673,
+    -8351, -31686, -8303, -31699, -8254, -31711, -8206, -31724, -8157, -31737, -8108, -31749,
+    -8059, -31761, -8011, -31774, -7962, -31786, -7913, -31798, -7864, -31810, -7816, -31822,
+    -7767, -31834, -7718, -31846, -7669, -31858, -7620, -31870, -7571, -31881, -7522, -31893,
+    -7473, -31904, -7425, -31916, -7376, -31927, -7327, -31938, -7278, -31950, -7229, -31961,
+    -7180, -31972, -7130, -31983, -7081, -31994, -7032, -32005, -6983, -32015, -6934, -32026,
+    -6885, -32037, -6836, -32047, -6787, -32058, -6737, -32068, -6688, -32078, -6639, -32088,
+    -6590, -32099, -6541, -32109, -6491, -32119, -6442, -32129, -6393, -32138, -6343, -32148,
+    -6294, -32158, -6245, -32167, -6195, -32177, -6146, -32186, -6097, -32196, -6047, -32205,
+    -5998, -32214, -5948, -32224, -5899, -32233, -5850, -32242, -5800, -32251, -5751, -32259,
+    -5701, -32268, -5652, -32277, -5602, -32286, -5553, -32294, -5503, -32303, -5453, -32311,
+    -5404, -32319, -5354, -32328, -5305, -32336, -5255, -32344, -5205, -32352, -5156, -32360,
+    -5106, -32368, -5057, -32376, -5007, -32383, -4957, -32391, -4907, -32398, -4858, -32406,
+    -4808, -32413, -4758, -32421, -4709, -32428, -4659, -32435, -4609, -32442, -4559, -32449,
+    -4510, -32456, -4460, -32463, -4410, -32470, -4360, -32477, -4310, -32483, -4260, -32490,
+    -4211, -32496, -4161, -32503, -4111, -32509, -4061, -32515, -4011, -32522, -3961, -32528,
+    -3911, -32534, -3861, -32540, -3812, -32546, -3762, -32551, -3712, -32557, -3662, -32563,
+    -3612, -32568, -3562, -32574, -3512, -32579, -3462, -32585, -3412, -32590, -3362, -32595,
+    -3312, -32600, -3262, -32605, -3212, -32610, -3162, -32615, -3112, -32620, -3062, -32625,
+    -3012, -32629, -2962, -32634, -2912, -32638, -2861, -32643, -2811, -32647, -2761, -32651,
+    -2711, -32656, -2661, -32660, -2611, -32664, -2561, -32668, -2511, -32672, -2461, -32675,
+    -2411, -32679, -2360, -32683, -2310, -32686, -2260, -32690, -2210, -32693, -2160, -32697,
+    -2110, -32700, -2060, -32703, -2009, -32706, -1959, -32709, -1909, -32712, -1859, -32715,
+    -1809, -32718, -1758, -32721, -1708, -32723, -1658, -32726, -1608, -32729, -1558, -32731,
+    -1507, -32733, -1457, -32736, -1407, -32738, -1357, -32740, -1307, -32742, -1256, -32744,
+    -1206, -32746, -1156, -32748, -1106, -32749, -1055, -32751, -1005, -32753, -955, -32754,
+    -905, -32756, -854, -32757, -804, -32758, -754, -32759, -704, -32760, -653, -32761,
+    -603, -32762, -553, -32763, -503, -32764, -452, -32765, -402, -32766, -352, -32766,
+    -302, -32767, -251, -32767, -201, -32767, -151, -32768, -101, -32768, -50, -32768,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_16)
+const uint16_t armBitRevIndexTable_fixed_16[ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH] = {
+    8, 64, 16, 32, 24, 96, 40, 80, 56, 112, 88, 104,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_32)
+const uint16_t armBitRevIndexTable_fixed_32[ARMBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH] = {
+    8, 128, 16, 64, 24, 192, 40, 160, 48, 96, 56, 224,
+    72, 144, 88, 208, 104, 176, 120, 240, 152, 200, 184, 232,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_64)
+const uint16_t armBitRevIndexTable_fixed_64[ARMBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH] = {
+    8, 256, 16, 128, 24, 384, 32, 64, 40, 320, 48, 192,
+    56, 448, 72, 288, 80, 160, 88, 416, 104, 352, 112, 224,
+    120, 480, 136, 272, 152, 400, 168, 336, 176, 208, 184, 464,
+    200, 304, 216, 432, 232, 368, 248, 496, 280, 392, 296, 328,
+    312, 456, 344, 424, 376, 488, 440, 472,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_128)
+const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH] = {
+    8, 512, 16, 256, 24, 768, 32, 128, 40, 640, 48, 384,
+    56, 896, 72, 576, 80, 320, 88, 832, 96, 192, 104, 704,
+    112, 448, 120, 960, 136, 544, 144, 288, 152, 800, 168, 672,
+    176, 416, 184, 928, 200, 608, 208, 352, 216, 864, 232, 736,
+    240, 480, 248, 992, 264, 528, 280, 784, 296, 656, 304, 400,
+    312, 912, 328, 592, 344, 848, 360, 720, 368, 464, 376, 976,
+    392, 560, 408, 816, 424, 688, 440, 944, 456, 624, 472, 880,
+    488, 752, 504, 1008, 536, 776, 552, 648, 568, 904, 600, 840,
+    616, 712, 632, 968, 664, 808, 696, 936, 728, 872, 760, 1000,
+    824, 920, 888, 984,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_256)
+const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH] = {
+    8, 1024, 16, 512, 24, 1536, 32, 256, 40, 1280, 48, 768,
+    56, 1792, 64, 128, 72, 1152, 80, 640, 88, 1664, 96, 384,
+    104, 1408, 112, 896, 120, 1920, 136, 1088, 144, 576, 152, 1600,
+    160, 320, 168, 1344, 176, 832, 184, 1856, 200, 1216, 208, 704,
+    216, 1728, 224, 448, 232, 1472, 240, 960, 248, 1984, 264, 1056,
+    272, 544, 280, 1568, 296, 1312, 304, 800, 312, 1824, 328, 1184,
+    336, 672, 344, 1696, 352, 416, 360, 1440, 368, 928, 376, 1952,
+    392, 1120, 400, 608, 408, 1632, 424, 1376, 432, 864, 440, 1888,
+    456, 1248, 464, 736, 472, 1760, 488, 1504, 496, 992, 504, 2016,
+    520, 1040, 536, 1552, 552, 1296, 560, 784, 568, 1808, 584, 1168,
+    592, 656, 600, 1680, 616, 1424, 624, 912, 632, 1936, 648, 1104,
+    664, 1616, 680, 1360, 688, 848, 696, 1872, 712, 1232, 728, 1744,
+    744, 1488, 752, 976, 760, 2000, 776, 1072, 792, 1584, 808, 1328,
+    824, 1840, 840, 1200, 856, 1712, 872, 1456, 880, 944, 888, 1968,
+    904, 1136, 920, 1648, 936, 1392, 952, 1904, 968, 1264, 984, 1776,
+    1000, 1520, 1016, 2032, 1048, 1544, 1064, 1288, 1080, 1800, 1096, 1160,
+    1112, 1672, 1128, 1416, 1144, 1928, 1176, 1608, 1192, 1352, 1208, 1864,
+    1240, 1736, 1256, 1480, 1272, 1992, 1304, 1576, 1336, 1832, 1368, 1704,
+    1384, 1448, 1400, 1960, 1432, 1640, 1464, 1896, 1496, 1768, 1528, 2024,
+    1592, 1816, 1624, 1688, 1656, 1944, 1720, 1880, 1784, 2008, 1912, 1976,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_512)
+const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH] = {
+    8, 2048, 16, 1024, 24, 3072, 32, 512, 40, 2560, 48, 1536,
+    56, 3584, 64, 256, 72, 2304, 80, 1280, 88, 3328, 96, 768,
+    104, 2816, 112, 1792, 120, 3840, 136, 2176, 144, 1152, 152, 3200,
+    160, 640, 168, 2688, 176, 1664, 184, 3712, 192, 384, 200, 2432,
+    208, 1408, 216, 3456, 224, 896, 232, 2944, 240, 1920, 248, 3968,
+    264, 2112, 272, 1088, 280, 3136, 288, 576, 296, 2624, 304, 1600,
+    312, 3648, 328, 2368, 336, 1344, 344, 3392, 352, 832, 360, 2880,
+    368, 1856, 376, 3904, 392, 2240, 400, 1216, 408, 3264, 416, 704,
+    424, 2752, 432, 1728, 440, 3776, 456, 2496, 464, 1472, 472, 3520,
+    480, 960, 488, 3008, 496, 1984, 504, 4032, 520, 2080, 528, 1056,
+    536, 3104, 552, 2592, 560, 1568, 568, 3616, 584, 2336, 592, 1312,
+    600, 3360, 608, 800, 616, 2848, 624, 1824, 632, 3872, 648, 2208,
+    656, 1184, 664, 3232, 680, 2720, 688, 1696, 696, 3744, 712, 2464,
+    720, 1440, 728, 3488, 736, 928, 744, 2976, 752, 1952, 760, 4000,
+    776, 2144, 784, 1120, 792, 3168, 808, 2656, 816, 1632, 824, 3680,
+    840, 2400, 848, 1376, 856, 3424, 872, 2912, 880, 1888, 888, 3936,
+    904, 2272, 912, 1248, 920, 3296, 936, 2784, 944, 1760, 952, 3808,
+    968, 2528, 976, 1504, 984, 3552, 1000, 3040, 1008, 2016, 1016, 4064,
+    1032, 2064, 1048, 3088, 1064, 2576, 1072, 1552, 1080, 3600, 1096, 2320,
+    1104, 1296, 1112, 3344, 1128, 2832, 1136, 1808, 1144, 3856, 1160, 2192,
+    1176, 3216, 1192, 2704, 1200, 1680, 1208, 3728, 1224, 2448, 1232, 1424,
+    1240, 3472, 1256, 2960, 1264, 1936, 1272, 3984, 1288, 2128, 1304, 3152,
+    1320, 2640, 1328, 1616, 1336, 3664, 1352, 2384, 1368, 3408, 1384, 2896,
+    1392, 1872, 1400, 3920, 1416, 2256, 1432, 3280, 1448, 2768, 1456, 1744,
+    1464, 3792, 1480, 2512, 1496, 3536, 1512, 3024, 1520, 2000, 1528, 4048,
+    1544, 2096, 1560, 3120, 1576, 2608, 1592, 3632, 1608, 2352, 1624, 3376,
+    1640, 2864, 1648, 1840, 1656, 3888, 1672, 2224, 1688, 3248, 1704, 2736,
+    1720, 3760, 1736, 2480, 1752, 3504, 1768, 2992, 1776, 1968, 1784, 4016,
+    1800, 2160, 1816, 3184, 1832, 2672, 1848, 3696, 1864, 2416, 1880, 3440,
+    1896, 2928, 1912, 3952, 1928, 2288, 1944, 3312, 1960, 2800, 1976, 3824,
+    1992, 2544, 2008, 3568, 2024, 3056, 2040, 4080, 2072, 3080, 2088, 2568,
+    2104, 3592, 2120, 2312, 2136, 3336, 2152, 2824, 2168, 3848, 2200, 3208,
+    2216, 2696, 2232, 3720, 2248, 2440, 2264, 3464, 2280, 2952, 2296, 3976,
+    2328, 3144, 2344, 2632, 2360, 3656, 2392, 3400, 2408, 2888, 2424, 3912,
+    2456, 3272, 2472, 2760, 2488, 3784, 2520, 3528, 2536, 3016, 2552, 4040,
+    2584, 3112, 2616, 3624, 2648, 3368, 2664, 2856, 2680, 3880, 2712, 3240,
+    2744, 3752, 2776, 3496, 2792, 2984, 2808, 4008, 2840, 3176, 2872, 3688,
+    2904, 3432, 2936, 3944, 2968, 3304, 3000, 3816, 3032, 3560, 3064, 4072,
+    3128, 3608, 3160, 3352, 3192, 3864, 3256, 3736, 3288, 3480, 3320, 3992,
+    3384, 3672, 3448, 3928, 3512, 3800, 3576, 4056, 3704, 3896, 3832, 4024,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_1024)
+const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH] = {
+    8, 4096, 16, 2048, 24, 6144, 32, 1024, 40, 5120, 48, 3072,
+    56, 7168, 64, 512, 72, 4608, 80, 2560, 88, 6656, 96, 1536,
+    104, 5632, 112, 3584, 120, 7680, 128, 256, 136, 4352, 144, 2304,
+    152, 6400, 160, 1280, 168, 5376, 176, 3328, 184, 7424, 192, 768,
+    200, 4864, 208, 2816, 216, 6912, 224, 1792, 232, 5888, 240, 3840,
+    248, 7936, 264, 4224, 272, 2176, 280, 6272, 288, 1152, 296, 5248,
+    304, 3200, 312, 7296, 320, 640, 328, 4736, 336, 2688, 344, 6784,
+    352, 1664, 360, 5760, 368, 3712, 376, 7808, 392, 4480, 400, 2432,
+    408, 6528, 416, 1408, 424, 5504, 432, 3456, 440, 7552, 448, 896,
+    456, 4992, 464, 2944, 472, 7040, 480, 1920, 488, 6016, 496, 3968,
+    504, 8064, 520, 4160, 528, 2112, 536, 6208, 544, 1088, 552, 5184,
+    560, 3136, 568, 7232, 584, 4672, 592, 2624, 600, 6720, 608, 1600,
+    616, 5696, 624, 3648, 632, 7744, 648, 4416, 656, 2368, 664, 6464,
+    672, 1344, 680, 5440, 688, 3392, 696, 7488, 704, 832, 712, 4928,
+    720, 2880, 728, 6976, 736, 1856, 744, 5952, 752, 3904, 760, 8000,
+    776, 4288, 784, 2240, 792, 6336, 800, 1216, 808, 5312, 816, 3264,
+    824, 7360, 840, 4800, 848, 2752, 856, 6848, 864, 1728, 872, 5824,
+    880, 3776, 888, 7872, 904, 4544, 912, 2496, 920, 6592, 928, 1472,
+    936, 5568, 944, 3520, 952, 7616, 968, 5056, 976, 3008, 984, 7104,
+    992, 1984, 1000, 6080, 1008, 4032, 1016, 8128, 1032, 4128, 1040, 2080,
+    1048, 6176, 1064, 5152, 1072, 3104, 1080, 7200, 1096, 4640, 1104, 2592,
+    1112, 6688, 1120, 1568, 1128, 5664, 1136, 3616, 1144, 7712, 1160, 4384,
+    1168, 2336, 1176, 6432, 1184, 1312, 1192, 5408, 1200, 3360, 1208, 7456,
+    1224, 4896, 1232, 2848, 1240, 6944, 1248, 1824, 1256, 5920, 1264, 3872,
+    1272, 7968, 1288, 4256, 1296, 2208, 1304, 6304, 1320, 5280, 1328, 3232,
+    1336, 7328, 1352, 4768, 1360, 2720, 1368, 6816, 1376, 1696, 1384, 5792,
+    1392, 3744, 1400, 7840, 1416, 4512, 1424, 2464, 1432, 6560, 1448, 5536,
+    1456, 3488, 1464, 7584, 1480, 5024, 1488, 2976, 1496, 7072, 1504, 1952,
+    1512, 6048, 1520, 4000, 1528, 8096, 1544, 4192, 1552, 2144, 1560, 6240,
+    1576, 5216, 1584, 3168, 1592, 7264, 1608, 4704, 1616, 2656, 1624, 6752,
+    1640, 5728, 1648, 3680, 1656, 7776, 1672, 4448, 1680, 2400, 1688, 6496,
+    1704, 5472, 1712, 3424, 1720, 7520, 1736, 4960, 1744, 2912, 1752, 7008,
+    1760, 1888, 1768, 5984, 1776, 3936, 1784, 8032, 1800, 4320, 1808, 2272,
+    1816, 6368, 1832, 5344, 1840, 3296, 1848, 7392, 1864, 4832, 1872, 2784,
+    1880, 6880, 1896, 5856, 1904, 3808, 1912, 7904, 1928, 4576, 1936, 2528,
+    1944, 6624, 1960, 5600, 1968, 3552, 1976, 7648, 1992, 5088, 2000, 3040,
+    2008, 7136, 2024, 6112, 2032, 4064, 2040, 8160, 2056, 4112, 2072, 6160,
+    2088, 5136, 2096, 3088, 2104, 7184, 2120, 4624, 2128, 2576, 2136, 6672,
+    2152, 5648, 2160, 3600, 2168, 7696, 2184, 4368, 2192, 2320, 2200, 6416,
+    2216, 5392, 2224, 3344, 2232, 7440, 2248, 4880, 2256, 2832, 2264, 6928,
+    2280, 5904, 2288, 3856, 2296, 7952, 2312, 4240, 2328, 6288, 2344, 5264,
+    2352, 3216, 2360, 7312, 2376, 4752, 2384, 2704, 2392, 6800, 2408, 5776,
+    2416, 3728, 2424, 7824, 2440, 4496, 2456, 6544, 2472, 5520, 2480, 3472,
+    2488, 7568, 2504, 5008, 2512, 2960, 2520, 7056, 2536, 6032, 2544, 3984,
+    2552, 8080, 2568, 4176, 2584, 6224, 2600, 5200, 2608, 3152, 2616, 7248,
+    2632, 4688, 2648, 6736, 2664, 5712, 2672, 3664, 2680, 7760, 2696, 4432,
+    2712, 6480, 2728, 5456, 2736, 3408, 2744, 7504, 2760, 4944, 2768, 2896,
+    2776, 6992, 2792, 5968, 2800, 3920, 2808, 8016, 2824, 4304, 2840, 6352,
+    2856, 5328, 2864, 3280, 2872, 7376, 2888, 4816, 2904, 6864, 2920, 5840,
+    2928, 3792, 2936, 7888, 2952, 4560, 2968, 6608, 2984, 5584, 2992, 3536,
+    3000, 7632, 3016, 5072, 3032, 7120, 3048, 6096, 3056, 4048, 3064, 8144,
+    3080, 4144, 3096, 6192, 3112, 5168, 3128, 7216, 3144, 4656, 3160, 6704,
+    3176, 5680, 3184, 3632, 3192, 7728, 3208, 4400, 3224, 6448, 3240, 5424,
+    3248, 3376, 3256, 7472, 3272, 4912, 3288, 6960, 3304, 5936, 3312, 3888,
+    3320, 7984, 3336, 4272, 3352, 6320, 3368, 5296, 3384, 7344, 3400, 4784,
+    3416, 6832, 3432, 5808, 3440, 3760, 3448, 7856, 3464, 4528, 3480, 6576,
+    3496, 5552, 3512, 7600, 3528, 5040, 3544, 7088, 3560, 6064, 3568, 4016,
+    3576, 8112, 3592, 4208, 3608, 6256, 3624, 5232, 3640, 7280, 3656, 4720,
+    3672, 6768, 3688, 5744, 3704, 7792, 3720, 4464, 3736, 6512, 3752, 5488,
+    3768, 7536, 3784, 4976, 3800, 7024, 3816, 6000, 3824, 3952, 3832, 8048,
+    3848, 4336, 3864, 6384, 3880, 5360, 3896, 7408, 3912, 4848, 3928, 6896,
+    3944, 5872, 3960, 7920, 3976, 4592, 3992, 6640, 4008, 5616, 4024, 7664,
+    4040, 5104, 4056, 7152, 4072, 6128, 4088, 8176, 4120, 6152, 4136, 5128,
+    4152, 7176, 4168, 4616, 4184, 6664, 4200, 5640, 4216, 7688, 4232, 4360,
+    4248, 6408, 4264, 5384, 4280, 7432, 4296, 4872, 4312, 6920, 4328, 5896,
+    4344, 7944, 4376, 6280, 4392, 5256, 4408, 7304, 4424, 4744, 4440, 6792,
+    4456, 5768, 4472, 7816, 4504, 6536, 4520, 5512, 4536, 7560, 4552, 5000,
+    4568, 7048, 4584, 6024, 4600, 8072, 4632, 6216, 4648, 5192, 4664, 7240,
+    4696, 6728, 4712, 5704, 4728, 7752, 4760, 6472, 4776, 5448, 4792, 7496,
+    4808, 4936, 4824, 6984, 4840, 5960, 4856, 8008, 4888, 6344, 4904, 5320,
+    4920, 7368, 4952, 6856, 4968, 5832, 4984, 7880, 5016, 6600, 5032, 5576,
+    5048, 7624, 5080, 7112, 5096, 6088, 5112, 8136, 5144, 6184, 5176, 7208,
+    5208, 6696, 5224, 5672, 5240, 7720, 5272, 6440, 5288, 5416, 5304, 7464,
+    5336, 6952, 5352, 5928, 5368, 7976, 5400, 6312, 5432, 7336, 5464, 6824,
+    5480, 5800, 5496, 7848, 5528, 6568, 5560, 7592, 5592, 7080, 5608, 6056,
+    5624, 8104, 5656, 6248, 5688, 7272, 5720, 6760, 5752, 7784, 5784, 6504,
+    5816, 7528, 5848, 7016, 5864, 5992, 5880, 8040, 5912, 6376, 5944, 7400,
+    5976, 6888, 6008, 7912, 6040, 6632, 6072, 7656, 6104, 7144, 6136, 8168,
+    6200, 7192, 6232, 6680, 6264, 7704, 6296, 6424, 6328, 7448, 6360, 6936,
+    6392, 7960, 6456, 7320, 6488, 6808, 6520, 7832, 6584, 7576, 6616, 7064,
+    6648, 8088, 6712, 7256, 6776, 7768, 6840, 7512, 6872, 7000, 6904, 8024,
+    6968, 7384, 7032, 7896, 7096, 7640, 7160, 8152, 7288, 7736, 7352, 7480,
+    7416, 7992, 7544, 7864, 7672, 8120, 7928, 8056,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_2048)
+const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH] = {
+    8, 8192, 16, 4096, 24, 12288, 32, 2048, 40, 10240, 48, 6144,
+    56, 14336, 64, 1024, 72, 9216, 80, 5120, 88, 13312, 96, 3072,
+    104, 11264, 112, 7168, 120, 15360, 128, 512, 136, 8704, 144, 4608,
+    152, 12800, 160, 2560, 168, 10752, 176, 6656, 184, 14848, 192, 1536,
+    200, 9728, 208, 5632, 216, 13824, 224, 3584, 232, 11776, 240, 7680,
+    248, 15872, 264, 8448, 272, 4352, 280, 12544, 288, 2304, 296, 10496,
+    304, 6400, 312, 14592, 320, 1280, 328, 9472, 336, 5376, 344, 13568,
+    352, 3328, 360, 11520, 368, 7424, 376, 15616, 384, 768, 392, 8960,
+    400, 4864, 408, 13056, 416, 2816, 424, 11008, 432, 6912, 440, 15104,
+    448, 1792, 456, 9984, 464, 5888, 472, 14080, 480, 3840, 488, 12032,
+    496, 7936, 504, 16128, 520, 8320, 528, 4224, 536, 12416, 544, 2176,
+    552, 10368, 560, 6272, 568, 14464, 576, 1152, 584, 9344, 592, 5248,
+    600, 13440, 608, 3200, 616, 11392, 624, 7296, 632, 15488, 648, 8832,
+    656, 4736, 664, 12928, 672, 2688, 680, 10880, 688, 6784, 696, 14976,
+    704, 1664, 712, 9856, 720, 5760, 728, 13952, 736, 3712, 744, 11904,
+    752, 7808, 760, 16000, 776, 8576, 784, 4480, 792, 12672, 800, 2432,
+    808, 10624, 816, 6528, 824, 14720, 832, 1408, 840, 9600, 848, 5504,
+    856, 13696, 864, 3456, 872, 11648, 880, 7552, 888, 15744, 904, 9088,
+    912, 4992, 920, 13184, 928, 2944, 936, 11136, 944, 7040, 952, 15232,
+    960, 1920, 968, 10112, 976, 6016, 984, 14208, 992, 3968, 1000, 12160,
+    1008, 8064, 1016, 16256, 1032, 8256, 1040, 4160, 1048, 12352, 1056, 2112,
+    1064, 10304, 1072, 6208, 1080, 14400, 1096, 9280, 1104, 5184, 1112, 13376,
+    1120, 3136, 1128, 11328, 1136, 7232, 1144, 15424, 1160, 8768, 1168, 4672,
+    1176, 12864, 1184, 2624, 1192, 10816, 1200, 6720, 1208, 14912, 1216, 1600,
+    1224, 9792, 1232, 5696, 1240, 13888, 1248, 3648, 1256, 11840, 1264, 7744,
+    1272, 15936, 1288, 8512, 1296, 4416, 1304, 12608, 1312, 2368, 1320, 10560,
+    1328, 6464, 1336, 14656, 1352, 9536, 1360, 5440, 1368, 13632, 1376, 3392,
+    1384, 11584, 1392, 7488, 1400, 15680, 1416, 9024, 1424, 4928, 1432, 13120,
+    1440, 2880, 1448, 11072, 1456, 6976, 1464, 15168, 1472, 1856, 1480, 10048,
+    1488, 5952, 1496, 14144, 1504, 3904, 1512, 12096, 1520, 8000, 1528, 16192,
+    1544, 8384, 1552, 4288, 1560, 12480, 1568, 2240, 1576, 10432, 1584, 6336,
+    1592, 14528, 1608, 9408, 1616, 5312, 1624, 13504, 1632, 3264, 1640, 11456,
+    1648, 7360, 1656, 15552, 1672, 8896, 1680, 4800, 1688, 12992, 1696, 2752,
+    1704, 10944, 1712, 6848, 1720, 15040, 1736, 9920, 1744, 5824, 1752, 14016,
+    1760, 3776, 1768, 11968, 1776, 7872, 1784, 16064, 1800, 8640, 1808, 4544,
+    1816, 12736, 1824, 2496, 1832, 10688, 1840, 6592, 1848, 14784, 1864, 9664,
+    1872, 5568, 1880, 13760, 1888, 3520, 1896, 11712, 1904, 7616, 1912, 15808,
+    1928, 9152, 1936, 5056, 1944, 13248, 1952, 3008, 1960, 11200, 1968, 7104,
+    1976, 15296, 1992, 10176, 2000, 6080, 2008, 14272, 2016, 4032, 2024, 12224,
+    2032, 8128, 2040, 16320, 2056, 8224, 2064, 4128, 2072, 12320, 2088, 10272,
+    2096, 6176, 2104, 14368, 2120, 9248, 2128, 5152, 2136, 13344, 2144, 3104,
+    2152, 11296, 2160, 7200, 2168, 15392, 2184, 8736, 2192, 4640, 2200, 12832,
+    2208, 2592, 2216, 10784, 2224, 6688, 2232, 14880, 2248, 9760, 2256, 5664,
+    2264, 13856, 2272, 3616, 2280, 11808, 2288, 7712, 2296, 15904, 2312, 8480,
+    2320, 4384, 2328, 12576, 2344, 10528, 2352, 6432, 2360, 14624, 2376, 9504,
+    2384, 5408, 2392, 13600, 2400, 3360, 2408, 11552, 2416, 7456, 2424, 15648,
+    2440, 8992, 2448, 4896, 2456, 13088, 2464, 2848, 2472, 11040, 2480, 6944,
+    2488, 15136, 2504, 10016, 2512, 5920, 2520, 14112, 2528, 3872, 2536, 12064,
+    2544, 7968, 2552, 16160, 2568, 8352, 2576, 4256, 2584, 12448, 2600, 10400,
+    2608, 6304, 2616, 14496, 2632, 9376, 2640, 5280, 2648, 13472, 2656, 3232,
+    2664, 11424, 2672, 7328, 2680, 15520, 2696, 8864, 2704, 4768, 2712, 12960,
+    2728, 10912, 2736, 6816, 2744, 15008, 2760, 9888, 2768, 5792, 2776, 13984,
+    2784, 3744, 2792, 11936, 2800, 7840, 2808, 16032, 2824, 8608, 2832, 4512,
+    2840, 12704, 2856, 10656, 2864, 6560, 2872, 14752, 2888, 9632, 2896, 5536,
+    2904, 13728, 2912, 3488, 2920, 11680, 2928, 7584, 2936, 15776, 2952, 9120,
+    2960, 5024, 2968, 13216, 2984, 11168, 2992, 7072, 3000, 15264, 3016, 10144,
+    3024, 6048, 3032, 14240, 3040, 4000, 3048, 12192, 3056, 8096, 3064, 16288,
+    3080, 8288, 3088, 4192, 3096, 12384, 3112, 10336, 3120, 6240, 3128, 14432,
+    3144, 9312, 3152, 5216, 3160, 13408, 3176, 11360, 3184, 7264, 3192, 15456,
+    3208, 8800, 3216, 4704, 3224, 12896, 3240, 10848, 3248, 6752, 3256, 14944,
+    3272, 9824, 3280, 5728, 3288, 13920, 3296, 3680, 3304, 11872, 3312, 7776,
+    3320, 15968, 3336, 8544, 3344, 4448, 3352, 12640, 3368, 10592, 3376, 6496,
+    3384, 14688, 3400, 9568, 3408, 5472, 3416, 13664, 3432, 11616, 3440, 7520,
+    3448, 15712, 3464, 9056, 3472, 4960, 3480, 13152, 3496, 11104, 3504, 7008,
+    3512, 15200, 3528, 10080, 3536, 5984, 3544, 14176, 3552, 3936, 3560, 12128,
+    3568, 8032, 3576, 16224, 3592, 8416, 3600, 4320, 3608, 12512, 3624, 10464,
+    3632, 6368, 3640, 14560, 3656, 9440, 3664, 5344, 3672, 13536, 3688, 11488,
+    3696, 7392, 3704, 15584, 3720, 8928, 3728, 4832, 3736, 13024, 3752, 10976,
+    3760, 6880, 3768, 15072, 3784, 9952, 3792, 5856, 3800, 14048, 3816, 12000,
+    3824, 7904, 3832, 16096, 3848, 8672, 3856, 4576, 3864, 12768, 3880, 10720,
+    3888, 6624, 3896, 14816, 3912, 9696, 3920, 5600, 3928, 13792, 3944, 11744,
+    3952, 7648, 3960, 15840, 3976, 9184, 3984, 5088, 3992, 13280, 4008, 11232,
+    4016, 7136, 4024, 15328, 4040, 10208, 4048, 6112, 4056, 14304, 4072, 12256,
+    4080, 8160, 4088, 16352, 4104, 8208, 4120, 12304, 4136, 10256, 4144, 6160,
+    4152, 14352, 4168, 9232, 4176, 5136, 4184, 13328, 4200, 11280, 4208, 7184,
+    4216, 15376, 4232, 8720, 4240, 4624, 4248, 12816, 4264, 10768, 4272, 6672,
+    4280, 14864, 4296, 9744, 4304, 5648, 4312, 13840, 4328, 11792, 4336, 7696,
+    4344, 15888, 4360, 8464, 4376, 12560, 4392, 10512, 4400, 6416, 4408, 14608,
+    4424, 9488, 4432, 5392, 4440, 13584, 4456, 11536, 4464, 7440, 4472, 15632,
+    4488, 8976, 4496, 4880, 4504, 13072, 4520, 11024, 4528, 6928, 4536, 15120,
+    4552, 10000, 4560, 5904, 4568, 14096, 4584, 12048, 4592, 7952, 4600, 16144,
+    4616, 8336, 4632, 12432, 4648, 10384, 4656, 6288, 4664, 14480, 4680, 9360,
+    4688, 5264, 4696, 13456, 4712, 11408, 4720, 7312, 4728, 15504, 4744, 8848,
+    4760, 12944, 4776, 10896, 4784, 6800, 4792, 14992, 4808, 9872, 4816, 5776,
+    4824, 13968, 4840, 11920, 4848, 7824, 4856, 16016, 4872, 8592, 4888, 12688,
+    4904, 10640, 4912, 6544, 4920, 14736, 4936, 9616, 4944, 5520, 4952, 13712,
+    4968, 11664, 4976, 7568, 4984, 15760, 5000, 9104, 5016, 13200, 5032, 11152,
+    5040, 7056, 5048, 15248, 5064, 10128, 5072, 6032, 5080, 14224, 5096, 12176,
+    5104, 8080, 5112, 16272, 5128, 8272, 5144, 12368, 5160, 10320, 5168, 6224,
+    5176, 14416, 5192, 9296, 5208, 13392, 5224, 11344, 5232, 7248, 5240, 15440,
+    5256, 8784, 5272, 12880, 5288, 10832, 5296, 6736, 5304, 14928, 5320, 9808,
+    5328, 5712, 5336, 13904, 5352, 11856, 5360, 7760, 5368, 15952, 5384, 8528,
+    5400, 12624, 5416, 10576, 5424, 6480, 5432, 14672, 5448, 9552, 5464, 13648,
+    5480, 11600, 5488, 7504, 5496, 15696, 5512, 9040, 5528, 13136, 5544, 11088,
+    5552, 6992, 5560, 15184, 5576, 10064, 5584, 5968, 5592, 14160, 5608, 12112,
+    5616, 8016, 5624, 16208, 5640, 8400, 5656, 12496, 5672, 10448, 5680, 6352,
+    5688, 14544, 5704, 9424, 5720, 13520, 5736, 11472, 5744, 7376, 5752, 15568,
+    5768, 8912, 5784, 13008, 5800, 10960, 5808, 6864, 5816, 15056, 5832, 9936,
+    5848, 14032, 5864, 11984, 5872, 7888, 5880, 16080, 5896, 8656, 5912, 12752,
+    5928, 10704, 5936, 6608, 5944, 14800, 5960, 9680, 5976, 13776, 5992, 11728,
+    6000, 7632, 6008, 15824, 6024, 9168, 6040, 13264, 6056, 11216, 6064, 7120,
+    6072, 15312, 6088, 10192, 6104, 14288, 6120, 12240, 6128, 8144, 6136, 16336,
+    6152, 8240, 6168, 12336, 6184, 10288, 6200, 14384, 6216, 9264, 6232, 13360,
+    6248, 11312, 6256, 7216, 6264, 15408, 6280, 8752, 6296, 12848, 6312, 10800,
+    6320, 6704, 6328, 14896, 6344, 9776, 6360, 13872, 6376, 11824, 6384, 7728,
+    6392, 15920, 6408, 8496, 6424, 12592, 6440, 10544, 6456, 14640, 6472, 9520,
+    6488, 13616, 6504, 11568, 6512, 7472, 6520, 15664, 6536, 9008, 6552, 13104,
+    6568, 11056, 6576, 6960, 6584, 15152, 6600, 10032, 6616, 14128, 6632, 12080,
+    6640, 7984, 6648, 16176, 6664, 8368, 6680, 12464, 6696, 10416, 6712, 14512,
+    6728, 9392, 6744, 13488, 6760, 11440, 6768, 7344, 6776, 15536, 6792, 8880,
+    6808, 12976, 6824, 10928, 6840, 15024, 6856, 9904, 6872, 14000, 6888, 11952,
+    6896, 7856, 6904, 16048, 6920, 8624, 6936, 12720, 6952, 10672, 6968, 14768,
+    6984, 9648, 7000, 13744, 7016, 11696, 7024, 7600, 7032, 15792, 7048, 9136,
+    7064, 13232, 7080, 11184, 7096, 15280, 7112, 10160, 7128, 14256, 7144, 12208,
+    7152, 8112, 7160, 16304, 7176, 8304, 7192, 12400, 7208, 10352, 7224, 14448,
+    7240, 9328, 7256, 13424, 7272, 11376, 7288, 15472, 7304, 8816, 7320, 12912,
+    7336, 10864, 7352, 14960, 7368, 9840, 7384, 13936, 7400, 11888, 7408, 7792,
+    7416, 15984, 7432, 8560, 7448, 12656, 7464, 10608, 7480, 14704, 7496, 9584,
+    7512, 13680, 7528, 11632, 7544, 15728, 7560, 9072, 7576, 13168, 7592, 11120,
+    7608, 15216, 7624, 10096, 7640, 14192, 7656, 12144, 7664, 8048, 7672, 16240,
+    7688, 8432, 7704, 12528, 7720, 10480, 7736, 14576, 7752, 9456, 7768, 13552,
+    7784, 11504, 7800, 15600, 7816, 8944, 7832, 13040, 7848, 10992, 7864, 15088,
+    7880, 9968, 7896, 14064, 7912, 12016, 7928, 16112, 7944, 8688, 7960, 12784,
+    7976, 10736, 7992, 14832, 8008, 9712, 8024, 13808, 8040, 11760, 8056, 15856,
+    8072, 9200, 8088, 13296, 8104, 11248, 8120, 15344, 8136, 10224, 8152, 14320,
+    8168, 12272, 8184, 16368, 8216, 12296, 8232, 10248, 8248, 14344, 8264, 9224,
+    8280, 13320, 8296, 11272, 8312, 15368, 8328, 8712, 8344, 12808, 8360, 10760,
+    8376, 14856, 8392, 9736, 8408, 13832, 8424, 11784, 8440, 15880, 8472, 12552,
+    8488, 10504, 8504, 14600, 8520, 9480, 8536, 13576, 8552, 11528, 8568, 15624,
+    8584, 8968, 8600, 13064, 8616, 11016, 8632, 15112, 8648, 9992, 8664, 14088,
+    8680, 12040, 8696, 16136, 8728, 12424, 8744, 10376, 8760, 14472, 8776, 9352,
+    8792, 13448, 8808, 11400, 8824, 15496, 8856, 12936, 8872, 10888, 8888, 14984,
+    8904, 9864, 8920, 13960, 8936, 11912, 8952, 16008, 8984, 12680, 9000, 10632,
+    9016, 14728, 9032, 9608, 9048, 13704, 9064, 11656, 9080, 15752, 9112, 13192,
+    9128, 11144, 9144, 15240, 9160, 10120, 9176, 14216, 9192, 12168, 9208, 16264,
+    9240, 12360, 9256, 10312, 9272, 14408, 9304, 13384, 9320, 11336, 9336, 15432,
+    9368, 12872, 9384, 10824, 9400, 14920, 9416, 9800, 9432, 13896, 9448, 11848,
+    9464, 15944, 9496, 12616, 9512, 10568, 9528, 14664, 9560, 13640, 9576, 11592,
+    9592, 15688, 9624, 13128, 9640, 11080, 9656, 15176, 9672, 10056, 9688, 14152,
+    9704, 12104, 9720, 16200, 9752, 12488, 9768, 10440, 9784, 14536, 9816, 13512,
+    9832, 11464, 9848, 15560, 9880, 13000, 9896, 10952, 9912, 15048, 9944, 14024,
+    9960, 11976, 9976, 16072, 10008, 12744, 10024, 10696, 10040, 14792, 10072, 13768,
+    10088, 11720, 10104, 15816, 10136, 13256, 10152, 11208, 10168, 15304, 10200, 14280,
+    10216, 12232, 10232, 16328, 10264, 12328, 10296, 14376, 10328, 13352, 10344, 11304,
+    10360, 15400, 10392, 12840, 10408, 10792, 10424, 14888, 10456, 13864, 10472, 11816,
+    10488, 15912, 10520, 12584, 10552, 14632, 10584, 13608, 10600, 11560, 10616, 15656,
+    10648, 13096, 10664, 11048, 10680, 15144, 10712, 14120, 10728, 12072, 10744, 16168,
+    10776, 12456, 10808, 14504, 10840, 13480, 10856, 11432, 10872, 15528, 10904, 12968,
+    10936, 15016, 10968, 13992, 10984, 11944, 11000, 16040, 11032, 12712, 11064, 14760,
+    11096, 13736, 11112, 11688, 11128, 15784, 11160, 13224, 11192, 15272, 11224, 14248,
+    11240, 12200, 11256, 16296, 11288, 12392, 11320, 14440, 11352, 13416, 11384, 15464,
+    11416, 12904, 11448, 14952, 11480, 13928, 11496, 11880, 11512, 15976, 11544, 12648,
+    11576, 14696, 11608, 13672, 11640, 15720, 11672, 13160, 11704, 15208, 11736, 14184,
+    11752, 12136, 11768, 16232, 11800, 12520, 11832, 14568, 11864, 13544, 11896, 15592,
+    11928, 13032, 11960, 15080, 11992, 14056, 12024, 16104, 12056, 12776, 12088, 14824,
+    12120, 13800, 12152, 15848, 12184, 13288, 12216, 15336, 12248, 14312, 12280, 16360,
+    12344, 14360, 12376, 13336, 12408, 15384, 12440, 12824, 12472, 14872, 12504, 13848,
+    12536, 15896, 12600, 14616, 12632, 13592, 12664, 15640, 12696, 13080, 12728, 15128,
+    12760, 14104, 12792, 16152, 12856, 14488, 12888, 13464, 12920, 15512, 12984, 15000,
+    13016, 13976, 13048, 16024, 13112, 14744, 13144, 13720, 13176, 15768, 13240, 15256,
+    13272, 14232, 13304, 16280, 13368, 14424, 13432, 15448, 13496, 14936, 13528, 13912,
+    13560, 15960, 13624, 14680, 13688, 15704, 13752, 15192, 13784, 14168, 13816, 16216,
+    13880, 14552, 13944, 15576, 14008, 15064, 14072, 16088, 14136, 14808, 14200, 15832,
+    14264, 15320, 14328, 16344, 14456, 15416, 14520, 14904, 14584, 15928, 14712, 15672,
+    14776, 15160, 14840, 16184, 14968, 15544, 15096, 16056, 15224, 15800, 15352, 16312,
+    15608, 15992, 15864, 16248,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_4096)
+const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH] = {
+    8, 16384, 16, 8192, 24, 24576, 32, 4096, 40, 20480, 48, 12288,
+    56, 28672, 64, 2048, 72, 18432, 80, 10240, 88, 26624, 96, 6144,
+    104, 22528, 112, 14336, 120, 30720, 128, 1024, 136, 17408, 144, 9216,
+    152, 25600, 160, 5120, 168, 21504, 176, 13312, 184, 29696, 192, 3072,
+    200, 19456, 208, 11264, 216, 27648, 224, 7168, 232, 23552, 240, 15360,
+    248, 31744, 256, 512, 264, 16896, 272, 8704, 280, 25088, 288, 4608,
+    296, 20992, 304, 12800, 312, 29184, 320, 2560, 328, 18944, 336, 10752,
+    344, 27136, 352, 6656, 360, 23040, 368, 14848, 376, 31232, 384, 1536,
+    392, 17920, 400, 9728, 408, 26112, 416, 5632, 424, 22016, 432, 13824,
+    440, 30208, 448, 3584, 456, 19968, 464, 11776, 472, 28160, 480, 7680,
+    488, 24064, 496, 15872, 504, 32256, 520, 16640, 528, 8448, 536, 24832,
+    544, 4352, 552, 20736, 560, 12544, 568, 28928, 576, 2304, 584, 18688,
+    592, 10496, 600, 26880, 608, 6400, 616, 22784, 624, 14592, 632, 30976,
+    640, 1280, 648, 17664, 656, 9472, 664, 25856, 672, 5376, 680, 21760,
+    688, 13568, 696, 29952, 704, 3328, 712, 19712, 720, 11520, 728, 27904,
+    736, 7424, 744, 23808, 752, 15616, 760, 32000, 776, 17152, 784, 8960,
+    792, 25344, 800, 4864, 808, 21248, 816, 13056, 824, 29440, 832, 2816,
+    840, 19200, 848, 11008, 856, 27392, 864, 6912, 872, 23296, 880, 15104,
+    888, 31488, 896, 1792, 904, 18176, 912, 9984, 920, 26368, 928, 5888,
+    936, 22272, 944, 14080, 952, 30464, 960, 3840, 968, 20224, 976, 12032,
+    984, 28416, 992, 7936, 1000, 24320, 1008, 16128, 1016, 32512, 1032, 16512,
+    1040, 8320, 1048, 24704, 1056, 4224, 1064, 20608, 1072, 12416, 1080, 28800,
+    1088, 2176, 1096, 18560, 1104, 10368, 1112, 26752, 1120, 6272, 1128, 22656,
+    1136, 14464, 1144, 30848, 1160, 17536, 1168, 9344, 1176, 25728, 1184, 5248,
+    1192, 21632, 1200, 13440, 1208, 29824, 1216, 3200, 1224, 19584, 1232, 11392,
+    1240, 27776, 1248, 7296, 1256, 23680, 1264, 15488, 1272, 31872, 1288, 17024,
+    1296, 8832, 1304, 25216, 1312, 4736, 1320, 21120, 1328, 12928, 1336, 29312,
+    1344, 2688, 1352, 19072, 1360, 10880, 1368, 27264, 1376, 6784, 1384, 23168,
+    1392, 14976, 1400, 31360, 1408, 1664, 1416, 18048, 1424, 9856, 1432, 26240,
+    1440, 5760, 1448, 22144, 1456, 13952, 1464, 30336, 1472, 3712, 1480, 20096,
+    1488, 11904, 1496, 28288, 1504, 7808, 1512, 24192, 1520, 16000, 1528, 32384,
+    1544, 16768, 1552, 8576, 1560, 24960, 1568, 4480, 1576, 20864, 1584, 12672,
+    1592, 29056, 1600, 2432, 1608, 18816, 1616, 10624, 1624, 27008, 1632, 6528,
+    1640, 22912, 1648, 14720, 1656, 31104, 1672, 17792, 1680, 9600, 1688, 25984,
+    1696, 5504, 1704, 21888, 1712, 13696, 1720, 30080, 1728, 3456, 1736, 19840,
+    1744, 11648, 1752, 28032, 1760, 7552, 1768, 23936, 1776, 15744, 1784, 32128,
+    1800, 17280, 1808, 9088, 1816, 25472, 1824, 4992, 1832, 21376, 1840, 13184,
+    1848, 29568, 1856, 2944, 1864, 19328, 1872, 11136, 1880, 27520, 1888, 7040,
+    1896, 23424, 1904, 15232, 1912, 31616, 1928, 18304, 1936, 10112, 1944, 26496,
+    1952, 6016, 1960, 22400, 1968, 14208, 1976, 30592, 1984, 3968, 1992, 20352,
+    2000, 12160, 2008, 28544, 2016, 8064, 2024, 24448, 2032, 16256, 2040, 32640,
+    2056, 16448, 2064, 8256, 2072, 24640, 2080, 4160, 2088, 20544, 2096, 12352,
+    2104, 28736, 2120, 18496, 2128, 10304, 2136, 26688, 2144, 6208, 2152, 22592,
+    2160, 14400, 2168, 30784, 2184, 17472, 2192, 9280, 2200, 25664, 2208, 5184,
+    2216, 21568, 2224, 13376, 2232, 29760, 2240, 3136, 2248, 19520, 2256, 11328,
+    2264, 27712, 2272, 7232, 2280, 23616, 2288, 15424, 2296, 31808, 2312, 16960,
+    2320, 8768, 2328, 25152, 2336, 4672, 2344, 21056, 2352, 12864, 2360, 29248,
+    2368, 2624, 2376, 19008, 2384, 10816, 2392, 27200, 2400, 6720, 2408, 23104,
+    2416, 14912, 2424, 31296, 2440, 17984, 2448, 9792, 2456, 26176, 2464, 5696,
+    2472, 22080, 2480, 13888, 2488, 30272, 2496, 3648, 2504, 20032, 2512, 11840,
+    2520, 28224, 2528, 7744, 2536, 24128, 2544, 15936, 2552, 32320, 2568, 16704,
+    2576, 8512, 2584, 24896, 2592, 4416, 2600, 20800, 2608, 12608, 2616, 28992,
+    2632, 18752, 2640, 10560, 2648, 26944, 2656, 6464, 2664, 22848, 2672, 14656,
+    2680, 31040, 2696, 17728, 2704, 9536, 2712, 25920, 2720, 5440, 2728, 21824,
+    2736, 13632, 2744, 30016, 2752, 3392, 2760, 19776, 2768, 11584, 2776, 27968,
+    2784, 7488, 2792, 23872, 2800, 15680, 2808, 32064, 2824, 17216, 2832, 9024,
+    2840, 25408, 2848, 4928, 2856, 21312, 2864, 13120, 2872, 29504, 2888, 19264,
+    2896, 11072, 2904, 27456, 2912, 6976, 2920, 23360, 2928, 15168, 2936, 31552,
+    2952, 18240, 2960, 10048, 2968, 26432, 2976, 5952, 2984, 22336, 2992, 14144,
+    3000, 30528, 3008, 3904, 3016, 20288, 3024, 12096, 3032, 28480, 3040, 8000,
+    3048, 24384, 3056, 16192, 3064, 32576, 3080, 16576, 3088, 8384, 3096, 24768,
+    3104, 4288, 3112, 20672, 3120, 12480, 3128, 28864, 3144, 18624, 3152, 10432,
+    3160, 26816, 3168, 6336, 3176, 22720, 3184, 14528, 3192, 30912, 3208, 17600,
+    3216, 9408, 3224, 25792, 3232, 5312, 3240, 21696, 3248, 13504, 3256, 29888,
+    3272, 19648, 3280, 11456, 3288, 27840, 3296, 7360, 3304, 23744, 3312, 15552,
+    3320, 31936, 3336, 17088, 3344, 8896, 3352, 25280, 3360, 4800, 3368, 21184,
+    3376, 12992, 3384, 29376, 3400, 19136, 3408, 10944, 3416, 27328, 3424, 6848,
+    3432, 23232, 3440, 15040, 3448, 31424, 3464, 18112, 3472, 9920, 3480, 26304,
+    3488, 5824, 3496, 22208, 3504, 14016, 3512, 30400, 3520, 3776, 3528, 20160,
+    3536, 11968, 3544, 28352, 3552, 7872, 3560, 24256, 3568, 16064, 3576, 32448,
+    3592, 16832, 3600, 8640, 3608, 25024, 3616, 4544, 3624, 20928, 3632, 12736,
+    3640, 29120, 3656, 18880, 3664, 10688, 3672, 27072, 3680, 6592, 3688, 22976,
+    3696, 14784, 3704, 31168, 3720, 17856, 3728, 9664, 3736, 26048, 3744, 5568,
+    3752, 21952, 3760, 13760, 3768, 30144, 3784, 19904, 3792, 11712, 3800, 28096,
+    3808, 7616, 3816, 24000, 3824, 15808, 3832, 32192, 3848, 17344, 3856, 9152,
+    3864, 25536, 3872, 5056, 3880, 21440, 3888, 13248, 3896, 29632, 3912, 19392,
+    3920, 11200, 3928, 27584, 3936, 7104, 3944, 23488, 3952, 15296, 3960, 31680,
+    3976, 18368, 3984, 10176, 3992, 26560, 4000, 6080, 4008, 22464, 4016, 14272,
+    4024, 30656, 4040, 20416, 4048, 12224, 4056, 28608, 4064, 8128, 4072, 24512,
+    4080, 16320, 4088, 32704, 4104, 16416, 4112, 8224, 4120, 24608, 4136, 20512,
+    4144, 12320, 4152, 28704, 4168, 18464, 4176, 10272, 4184, 26656, 4192, 6176,
+    4200, 22560, 4208, 14368, 4216, 30752, 4232, 17440, 4240, 9248, 4248, 25632,
+    4256, 5152, 4264, 21536, 4272, 13344, 4280, 29728, 4296, 19488, 4304, 11296,
+    4312, 27680, 4320, 7200, 4328, 23584, 4336, 15392, 4344, 31776, 4360, 16928,
+    4368, 8736, 4376, 25120, 4384, 4640, 4392, 21024, 4400, 12832, 4408, 29216,
+    4424, 18976, 4432, 10784, 4440, 27168, 4448, 6688, 4456, 23072, 4464, 14880,
+    4472, 31264, 4488, 17952, 4496, 9760, 4504, 26144, 4512, 5664, 4520, 22048,
+    4528, 13856, 4536, 30240, 4552, 20000, 4560, 11808, 4568, 28192, 4576, 7712,
+    4584, 24096, 4592, 15904, 4600, 32288, 4616, 16672, 4624, 8480, 4632, 24864,
+    4648, 20768, 4656, 12576, 4664, 28960, 4680, 18720, 4688, 10528, 4696, 26912,
+    4704, 6432, 4712, 22816, 4720, 14624, 4728, 31008, 4744, 17696, 4752, 9504,
+    4760, 25888, 4768, 5408, 4776, 21792, 4784, 13600, 4792, 29984, 4808, 19744,
+    4816, 11552, 4824, 27936, 4832, 7456, 4840, 23840, 4848, 15648, 4856, 32032,
+    4872, 17184, 4880, 8992, 4888, 25376, 4904, 21280, 4912, 13088, 4920, 29472,
+    4936, 19232, 4944, 11040, 4952, 27424, 4960, 6944, 4968, 23328, 4976, 15136,
+    4984, 31520, 5000, 18208, 5008, 10016, 5016, 26400, 5024, 5920, 5032, 22304,
+    5040, 14112, 5048, 30496, 5064, 20256, 5072, 12064, 5080, 28448, 5088, 7968,
+    5096, 24352, 5104, 16160, 5112, 32544, 5128, 16544, 5136, 8352, 5144, 24736,
+    5160, 20640, 5168, 12448, 5176, 28832, 5192, 18592, 5200, 10400, 5208, 26784,
+    5216, 6304, 5224, 22688, 5232, 14496, 5240, 30880, 5256, 17568, 5264, 9376,
+    5272, 25760, 5288, 21664, 5296, 13472, 5304, 29856, 5320, 19616, 5328, 11424,
+    5336, 27808, 5344, 7328, 5352, 23712, 5360, 15520, 5368, 31904, 5384, 17056,
+    5392, 8864, 5400, 25248, 5416, 21152, 5424, 12960, 5432, 29344, 5448, 19104,
+    5456, 10912, 5464, 27296, 5472, 6816, 5480, 23200, 5488, 15008, 5496, 31392,
+    5512, 18080, 5520, 9888, 5528, 26272, 5536, 5792, 5544, 22176, 5552, 13984,
+    5560, 30368, 5576, 20128, 5584, 11936, 5592, 28320, 5600, 7840, 5608, 24224,
+    5616, 16032, 5624, 32416, 5640, 16800, 5648, 8608, 5656, 24992, 5672, 20896,
+    5680, 12704, 5688, 29088, 5704, 18848, 5712, 10656, 5720, 27040, 5728, 6560,
+    5736, 22944, 5744, 14752, 5752, 31136, 5768, 17824, 5776, 9632, 5784, 26016,
+    5800, 21920, 5808, 13728, 5816, 30112, 5832, 19872, 5840, 11680, 5848, 28064,
+    5856, 7584, 5864, 23968, 5872, 15776, 5880, 32160, 5896, 17312, 5904, 9120,
+    5912, 25504, 5928, 21408, 5936, 13216, 5944, 29600, 5960, 19360, 5968, 11168,
+    5976, 27552, 5984, 7072, 5992, 23456, 6000, 15264, 6008, 31648, 6024, 18336,
+    6032, 10144, 6040, 26528, 6056, 22432, 6064, 14240, 6072, 30624, 6088, 20384,
+    6096, 12192, 6104, 28576, 6112, 8096, 6120, 24480, 6128, 16288, 6136, 32672,
+    6152, 16480, 6160, 8288, 6168, 24672, 6184, 20576, 6192, 12384, 6200, 28768,
+    6216, 18528, 6224, 10336, 6232, 26720, 6248, 22624, 6256, 14432, 6264, 30816,
+    6280, 17504, 6288, 9312, 6296, 25696, 6312, 21600, 6320, 13408, 6328, 29792,
+    6344, 19552, 6352, 11360, 6360, 27744, 6368, 7264, 6376, 23648, 6384, 15456,
+    6392, 31840, 6408, 16992, 6416, 8800, 6424, 25184, 6440, 21088, 6448, 12896,
+    6456, 29280, 6472, 19040, 6480, 10848, 6488, 27232, 6496, 6752, 6504, 23136,
+    6512, 14944, 6520, 31328, 6536, 18016, 6544, 9824, 6552, 26208, 6568, 22112,
+    6576, 13920, 6584, 30304, 6600, 20064, 6608, 11872, 6616, 28256, 6624, 7776,
+    6632, 24160, 6640, 15968, 6648, 32352, 6664, 16736, 6672, 8544, 6680, 24928,
+    6696, 20832, 6704, 12640, 6712, 29024, 6728, 18784, 6736, 10592, 6744, 26976,
+    6760, 22880, 6768, 14688, 6776, 31072, 6792, 17760, 6800, 9568, 6808, 25952,
+    6824, 21856, 6832, 13664, 6840, 30048, 6856, 19808, 6864, 11616, 6872, 28000,
+    6880, 7520, 6888, 23904, 6896, 15712, 6904, 32096, 6920, 17248, 6928, 9056,
+    6936, 25440, 6952, 21344, 6960, 13152, 6968, 29536, 6984, 19296, 6992, 11104,
+    7000, 27488, 7016, 23392, 7024, 15200, 7032, 31584, 7048, 18272, 7056, 10080,
+    7064, 26464, 7080, 22368, 7088, 14176, 7096, 30560, 7112, 20320, 7120, 12128,
+    7128, 28512, 7136, 8032, 7144, 24416, 7152, 16224, 7160, 32608, 7176, 16608,
+    7184, 8416, 7192, 24800, 7208, 20704, 7216, 12512, 7224, 28896, 7240, 18656,
+    7248, 10464, 7256, 26848, 7272, 22752, 7280, 14560, 7288, 30944, 7304, 17632,
+    7312, 9440, 7320, 25824, 7336, 21728, 7344, 13536, 7352, 29920, 7368, 19680,
+    7376, 11488, 7384, 27872, 7400, 23776, 7408, 15584, 7416, 31968, 7432, 17120,
+    7440, 8928, 7448, 25312, 7464, 21216, 7472, 13024, 7480, 29408, 7496, 19168,
+    7504, 10976, 7512, 27360, 7528, 23264, 7536, 15072, 7544, 31456, 7560, 18144,
+    7568, 9952, 7576, 26336, 7592, 22240, 7600, 14048, 7608, 30432, 7624, 20192,
+    7632, 12000, 7640, 28384, 7648, 7904, 7656, 24288, 7664, 16096, 7672, 32480,
+    7688, 16864, 7696, 8672, 7704, 25056, 7720, 20960, 7728, 12768, 7736, 29152,
+    7752, 18912, 7760, 10720, 7768, 27104, 7784, 23008, 7792, 14816, 7800, 31200,
+    7816, 17888, 7824, 9696, 7832, 26080, 7848, 21984, 7856, 13792, 7864, 30176,
+    7880, 19936, 7888, 11744, 7896, 28128, 7912, 24032, 7920, 15840, 7928, 32224,
+    7944, 17376, 7952, 9184, 7960, 25568, 7976, 21472, 7984, 13280, 7992, 29664,
+    8008, 19424, 8016, 11232, 8024, 27616, 8040, 23520, 8048, 15328, 8056, 31712,
+    8072, 18400, 8080, 10208, 8088, 26592, 8104, 22496, 8112, 14304, 8120, 30688,
+    8136, 20448, 8144, 12256, 8152, 28640, 8168, 24544, 8176, 16352, 8184, 32736,
+    8200, 16400, 8216, 24592, 8232, 20496, 8240, 12304, 8248, 28688, 8264, 18448,
+    8272, 10256, 8280, 26640, 8296, 22544, 8304, 14352, 8312, 30736, 8328, 17424,
+    8336, 9232, 8344, 25616, 8360, 21520, 8368, 13328, 8376, 29712, 8392, 19472,
+    8400, 11280, 8408, 27664, 8424, 23568, 8432, 15376, 8440, 31760, 8456, 16912,
+    8464, 8720, 8472, 25104, 8488, 21008, 8496, 12816, 8504, 29200, 8520, 18960,
+    8528, 10768, 8536, 27152, 8552, 23056, 8560, 14864, 8568, 31248, 8584, 17936,
+    8592, 9744, 8600, 26128, 8616, 22032, 8624, 13840, 8632, 30224, 8648, 19984,
+    8656, 11792, 8664, 28176, 8680, 24080, 8688, 15888, 8696, 32272, 8712, 16656,
+    8728, 24848, 8744, 20752, 8752, 12560, 8760, 28944, 8776, 18704, 8784, 10512,
+    8792, 26896, 8808, 22800, 8816, 14608, 8824, 30992, 8840, 17680, 8848, 9488,
+    8856, 25872, 8872, 21776, 8880, 13584, 8888, 29968, 8904, 19728, 8912, 11536,
+    8920, 27920, 8936, 23824, 8944, 15632, 8952, 32016, 8968, 17168, 8984, 25360,
+    9000, 21264, 9008, 13072, 9016, 29456, 9032, 19216, 9040, 11024, 9048, 27408,
+    9064, 23312, 9072, 15120, 9080, 31504, 9096, 18192, 9104, 10000, 9112, 26384,
+    9128, 22288, 9136, 14096, 9144, 30480, 9160, 20240, 9168, 12048, 9176, 28432,
+    9192, 24336, 9200, 16144, 9208, 32528, 9224, 16528, 9240, 24720, 9256, 20624,
+    9264, 12432, 9272, 28816, 9288, 18576, 9296, 10384, 9304, 26768, 9320, 22672,
+    9328, 14480, 9336, 30864, 9352, 17552, 9368, 25744, 9384, 21648, 9392, 13456,
+    9400, 29840, 9416, 19600, 9424, 11408, 9432, 27792, 9448, 23696, 9456, 15504,
+    9464, 31888, 9480, 17040, 9496, 25232, 9512, 21136, 9520, 12944, 9528, 29328,
+    9544, 19088, 9552, 10896, 9560, 27280, 9576, 23184, 9584, 14992, 9592, 31376,
+    9608, 18064, 9616, 9872, 9624, 26256, 9640, 22160, 9648, 13968, 9656, 30352,
+    9672, 20112, 9680, 11920, 9688, 28304, 9704, 24208, 9712, 16016, 9720, 32400,
+    9736, 16784, 9752, 24976, 9768, 20880, 9776, 12688, 9784, 29072, 9800, 18832,
+    9808, 10640, 9816, 27024, 9832, 22928, 9840, 14736, 9848, 31120, 9864, 17808,
+    9880, 26000, 9896, 21904, 9904, 13712, 9912, 30096, 9928, 19856, 9936, 11664,
+    9944, 28048, 9960, 23952, 9968, 15760, 9976, 32144, 9992, 17296, 10008, 25488,
+    10024, 21392, 10032, 13200, 10040, 29584, 10056, 19344, 10064, 11152, 10072, 27536,
+    10088, 23440, 10096, 15248, 10104, 31632, 10120, 18320, 10136, 26512, 10152, 22416,
+    10160, 14224, 10168, 30608, 10184, 20368, 10192, 12176, 10200, 28560, 10216, 24464,
+    10224, 16272, 10232, 32656, 10248, 16464, 10264, 24656, 10280, 20560, 10288, 12368,
+    10296, 28752, 10312, 18512, 10328, 26704, 10344, 22608, 10352, 14416, 10360, 30800,
+    10376, 17488, 10392, 25680, 10408, 21584, 10416, 13392, 10424, 29776, 10440, 19536,
+    10448, 11344, 10456, 27728, 10472, 23632, 10480, 15440, 10488, 31824, 10504, 16976,
+    10520, 25168, 10536, 21072, 10544, 12880, 10552, 29264, 10568, 19024, 10576, 10832,
+    10584, 27216, 10600, 23120, 10608, 14928, 10616, 31312, 10632, 18000, 10648, 26192,
+    10664, 22096, 10672, 13904, 10680, 30288, 10696, 20048, 10704, 11856, 10712, 28240,
+    10728, 24144, 10736, 15952, 10744, 32336, 10760, 16720, 10776, 24912, 10792, 20816,
+    10800, 12624, 10808, 29008, 10824, 18768, 10840, 26960, 10856, 22864, 10864, 14672,
+    10872, 31056, 10888, 17744, 10904, 25936, 10920, 21840, 10928, 13648, 10936, 30032,
+    10952, 19792, 10960, 11600, 10968, 27984, 10984, 23888, 10992, 15696, 11000, 32080,
+    11016, 17232, 11032, 25424, 11048, 21328, 11056, 13136, 11064, 29520, 11080, 19280,
+    11096, 27472, 11112, 23376, 11120, 15184, 11128, 31568, 11144, 18256, 11160, 26448,
+    11176, 22352, 11184, 14160, 11192, 30544, 11208, 20304, 11216, 12112, 11224, 28496,
+    11240, 24400, 11248, 16208, 11256, 32592, 11272, 16592, 11288, 24784, 11304, 20688,
+    11312, 12496, 11320, 28880, 11336, 18640, 11352, 26832, 11368, 22736, 11376, 14544,
+    11384, 30928, 11400, 17616, 11416, 25808, 11432, 21712, 11440, 13520, 11448, 29904,
+    11464, 19664, 11480, 27856, 11496, 23760, 11504, 15568, 11512, 31952, 11528, 17104,
+    11544, 25296, 11560, 21200, 11568, 13008, 11576, 29392, 11592, 19152, 11608, 27344,
+    11624, 23248, 11632, 15056, 11640, 31440, 11656, 18128, 11672, 26320, 11688, 22224,
+    11696, 14032, 11704, 30416, 11720, 20176, 11728, 11984, 11736, 28368, 11752, 24272,
+    11760, 16080, 11768, 32464, 11784, 16848, 11800, 25040, 11816, 20944, 11824, 12752,
+    11832, 29136, 11848, 18896, 11864, 27088, 11880, 22992, 11888, 14800, 11896, 31184,
+    11912, 17872, 11928, 26064, 11944, 21968, 11952, 13776, 11960, 30160, 11976, 19920,
+    11992, 28112, 12008, 24016, 12016, 15824, 12024, 32208, 12040, 17360, 12056, 25552,
+    12072, 21456, 12080, 13264, 12088, 29648, 12104, 19408, 12120, 27600, 12136, 23504,
+    12144, 15312, 12152, 31696, 12168, 18384, 12184, 26576, 12200, 22480, 12208, 14288,
+    12216, 30672, 12232, 20432, 12248, 28624, 12264, 24528, 12272, 16336, 12280, 32720,
+    12296, 16432, 12312, 24624, 12328, 20528, 12344, 28720, 12360, 18480, 12376, 26672,
+    12392, 22576, 12400, 14384, 12408, 30768, 12424, 17456, 12440, 25648, 12456, 21552,
+    12464, 13360, 12472, 29744, 12488, 19504, 12504, 27696, 12520, 23600, 12528, 15408,
+    12536, 31792, 12552, 16944, 12568, 25136, 12584, 21040, 12592, 12848, 12600, 29232,
+    12616, 18992, 12632, 27184, 12648, 23088, 12656, 14896, 12664, 31280, 12680, 17968,
+    12696, 26160, 12712, 22064, 12720, 13872, 12728, 30256, 12744, 20016, 12760, 28208,
+    12776, 24112, 12784, 15920, 12792, 32304, 12808, 16688, 12824, 24880, 12840, 20784,
+    12856, 28976, 12872, 18736, 12888, 26928, 12904, 22832, 12912, 14640, 12920, 31024,
+    12936, 17712, 12952, 25904, 12968, 21808, 12976, 13616, 12984, 30000, 13000, 19760,
+    13016, 27952, 13032, 23856, 13040, 15664, 13048, 32048, 13064, 17200, 13080, 25392,
+    13096, 21296, 13112, 29488, 13128, 19248, 13144, 27440, 13160, 23344, 13168, 15152,
+    13176, 31536, 13192, 18224, 13208, 26416, 13224, 22320, 13232, 14128, 13240, 30512,
+    13256, 20272, 13272, 28464, 13288, 24368, 13296, 16176, 13304, 32560, 13320, 16560,
+    13336, 24752, 13352, 20656, 13368, 28848, 13384, 18608, 13400, 26800, 13416, 22704,
+    13424, 14512, 13432, 30896, 13448, 17584, 13464, 25776, 13480, 21680, 13496, 29872,
+    13512, 19632, 13528, 27824, 13544, 23728, 13552, 15536, 13560, 31920, 13576, 17072,
+    13592, 25264, 13608, 21168, 13624, 29360, 13640, 19120, 13656, 27312, 13672, 23216,
+    13680, 15024, 13688, 31408, 13704, 18096, 13720, 26288, 13736, 22192, 13744, 14000,
+    13752, 30384, 13768, 20144, 13784, 28336, 13800, 24240, 13808, 16048, 13816, 32432,
+    13832, 16816, 13848, 25008, 13864, 20912, 13880, 29104, 13896, 18864, 13912, 27056,
+    13928, 22960, 13936, 14768, 13944, 31152, 13960, 17840, 13976, 26032, 13992, 21936,
+    14008, 30128, 14024, 19888, 14040, 28080, 14056, 23984, 14064, 15792, 14072, 32176,
+    14088, 17328, 14104, 25520, 14120, 21424, 14136, 29616, 14152, 19376, 14168, 27568,
+    14184, 23472, 14192, 15280, 14200, 31664, 14216, 18352, 14232, 26544, 14248, 22448,
+    14264, 30640, 14280, 20400, 14296, 28592, 14312, 24496, 14320, 16304, 14328, 32688,
+    14344, 16496, 14360, 24688, 14376, 20592, 14392, 28784, 14408, 18544, 14424, 26736,
+    14440, 22640, 14456, 30832, 14472, 17520, 14488, 25712, 14504, 21616, 14520, 29808,
+    14536, 19568, 14552, 27760, 14568, 23664, 14576, 15472, 14584, 31856, 14600, 17008,
+    14616, 25200, 14632, 21104, 14648, 29296, 14664, 19056, 14680, 27248, 14696, 23152,
+    14704, 14960, 14712, 31344, 14728, 18032, 14744, 26224, 14760, 22128, 14776, 30320,
+    14792, 20080, 14808, 28272, 14824, 24176, 14832, 15984, 14840, 32368, 14856, 16752,
+    14872, 24944, 14888, 20848, 14904, 29040, 14920, 18800, 14936, 26992, 14952, 22896,
+    14968, 31088, 14984, 17776, 15000, 25968, 15016, 21872, 15032, 30064, 15048, 19824,
+    15064, 28016, 15080, 23920, 15088, 15728, 15096, 32112, 15112, 17264, 15128, 25456,
+    15144, 21360, 15160, 29552, 15176, 19312, 15192, 27504, 15208, 23408, 15224, 31600,
+    15240, 18288, 15256, 26480, 15272, 22384, 15288, 30576, 15304, 20336, 15320, 28528,
+    15336, 24432, 15344, 16240, 15352, 32624, 15368, 16624, 15384, 24816, 15400, 20720,
+    15416, 28912, 15432, 18672, 15448, 26864, 15464, 22768, 15480, 30960, 15496, 17648,
+    15512, 25840, 15528, 21744, 15544, 29936, 15560, 19696, 15576, 27888, 15592, 23792,
+    15608, 31984, 15624, 17136, 15640, 25328, 15656, 21232, 15672, 29424, 15688, 19184,
+    15704, 27376, 15720, 23280, 15736, 31472, 15752, 18160, 15768, 26352, 15784, 22256,
+    15800, 30448, 15816, 20208, 15832, 28400, 15848, 24304, 15856, 16112, 15864, 32496,
+    15880, 16880, 15896, 25072, 15912, 20976, 15928, 29168, 15944, 18928, 15960, 27120,
+    15976, 23024, 15992, 31216, 16008, 17904, 16024, 26096, 16040, 22000, 16056, 30192,
+    16072, 19952, 16088, 28144, 16104, 24048, 16120, 32240, 16136, 17392, 16152, 25584,
+    16168, 21488, 16184, 29680, 16200, 19440, 16216, 27632, 16232, 23536, 16248, 31728,
+    16264, 18416, 16280, 26608, 16296, 22512, 16312, 30704, 16328, 20464, 16344, 28656,
+    16360, 24560, 16376, 32752, 16408, 24584, 16424, 20488, 16440, 28680, 16456, 18440,
+    16472, 26632, 16488, 22536, 16504, 30728, 16520, 17416, 16536, 25608, 16552, 21512,
+    16568, 29704, 16584, 19464, 16600, 27656, 16616, 23560, 16632, 31752, 16648, 16904,
+    16664, 25096, 16680, 21000, 16696, 29192, 16712, 18952, 16728, 27144, 16744, 23048,
+    16760, 31240, 16776, 17928, 16792, 26120, 16808, 22024, 16824, 30216, 16840, 19976,
+    16856, 28168, 16872, 24072, 16888, 32264, 16920, 24840, 16936, 20744, 16952, 28936,
+    16968, 18696, 16984, 26888, 17000, 22792, 17016, 30984, 17032, 17672, 17048, 25864,
+    17064, 21768, 17080, 29960, 17096, 19720, 17112, 27912, 17128, 23816, 17144, 32008,
+    17176, 25352, 17192, 21256, 17208, 29448, 17224, 19208, 17240, 27400, 17256, 23304,
+    17272, 31496, 17288, 18184, 17304, 26376, 17320, 22280, 17336, 30472, 17352, 20232,
+    17368, 28424, 17384, 24328, 17400, 32520, 17432, 24712, 17448, 20616, 17464, 28808,
+    17480, 18568, 17496, 26760, 17512, 22664, 17528, 30856, 17560, 25736, 17576, 21640,
+    17592, 29832, 17608, 19592, 17624, 27784, 17640, 23688, 17656, 31880, 17688, 25224,
+    17704, 21128, 17720, 29320, 17736, 19080, 17752, 27272, 17768, 23176, 17784, 31368,
+    17800, 18056, 17816, 26248, 17832, 22152, 17848, 30344, 17864, 20104, 17880, 28296,
+    17896, 24200, 17912, 32392, 17944, 24968, 17960, 20872, 17976, 29064, 17992, 18824,
+    18008, 27016, 18024, 22920, 18040, 31112, 18072, 25992, 18088, 21896, 18104, 30088,
+    18120, 19848, 18136, 28040, 18152, 23944, 18168, 32136, 18200, 25480, 18216, 21384,
+    18232, 29576, 18248, 19336, 18264, 27528, 18280, 23432, 18296, 31624, 18328, 26504,
+    18344, 22408, 18360, 30600, 18376, 20360, 18392, 28552, 18408, 24456, 18424, 32648,
+    18456, 24648, 18472, 20552, 18488, 28744, 18520, 26696, 18536, 22600, 18552, 30792,
+    18584, 25672, 18600, 21576, 18616, 29768, 18632, 19528, 18648, 27720, 18664, 23624,
+    18680, 31816, 18712, 25160, 18728, 21064, 18744, 29256, 18760, 19016, 18776, 27208,
+    18792, 23112, 18808, 31304, 18840, 26184, 18856, 22088, 18872, 30280, 18888, 20040,
+    18904, 28232, 18920, 24136, 18936, 32328, 18968, 24904, 18984, 20808, 19000, 29000,
+    19032, 26952, 19048, 22856, 19064, 31048, 19096, 25928, 19112, 21832, 19128, 30024,
+    19144, 19784, 19160, 27976, 19176, 23880, 19192, 32072, 19224, 25416, 19240, 21320,
+    19256, 29512, 19288, 27464, 19304, 23368, 19320, 31560, 19352, 26440, 19368, 22344,
+    19384, 30536, 19400, 20296, 19416, 28488, 19432, 24392, 19448, 32584, 19480, 24776,
+    19496, 20680, 19512, 28872, 19544, 26824, 19560, 22728, 19576, 30920, 19608, 25800,
+    19624, 21704, 19640, 29896, 19672, 27848, 19688, 23752, 19704, 31944, 19736, 25288,
+    19752, 21192, 19768, 29384, 19800, 27336, 19816, 23240, 19832, 31432, 19864, 26312,
+    19880, 22216, 19896, 30408, 19912, 20168, 19928, 28360, 19944, 24264, 19960, 32456,
+    19992, 25032, 20008, 20936, 20024, 29128, 20056, 27080, 20072, 22984, 20088, 31176,
+    20120, 26056, 20136, 21960, 20152, 30152, 20184, 28104, 20200, 24008, 20216, 32200,
+    20248, 25544, 20264, 21448, 20280, 29640, 20312, 27592, 20328, 23496, 20344, 31688,
+    20376, 26568, 20392, 22472, 20408, 30664, 20440, 28616, 20456, 24520, 20472, 32712,
+    20504, 24616, 20536, 28712, 20568, 26664, 20584, 22568, 20600, 30760, 20632, 25640,
+    20648, 21544, 20664, 29736, 20696, 27688, 20712, 23592, 20728, 31784, 20760, 25128,
+    20776, 21032, 20792, 29224, 20824, 27176, 20840, 23080, 20856, 31272, 20888, 26152,
+    20904, 22056, 20920, 30248, 20952, 28200, 20968, 24104, 20984, 32296, 21016, 24872,
+    21048, 28968, 21080, 26920, 21096, 22824, 21112, 31016, 21144, 25896, 21160, 21800,
+    21176, 29992, 21208, 27944, 21224, 23848, 21240, 32040, 21272, 25384, 21304, 29480,
+    21336, 27432, 21352, 23336, 21368, 31528, 21400, 26408, 21416, 22312, 21432, 30504,
+    21464, 28456, 21480, 24360, 21496, 32552, 21528, 24744, 21560, 28840, 21592, 26792,
+    21608, 22696, 21624, 30888, 21656, 25768, 21688, 29864, 21720, 27816, 21736, 23720,
+    21752, 31912, 21784, 25256, 21816, 29352, 21848, 27304, 21864, 23208, 21880, 31400,
+    21912, 26280, 21928, 22184, 21944, 30376, 21976, 28328, 21992, 24232, 22008, 32424,
+    22040, 25000, 22072, 29096, 22104, 27048, 22120, 22952, 22136, 31144, 22168, 26024,
+    22200, 30120, 22232, 28072, 22248, 23976, 22264, 32168, 22296, 25512, 22328, 29608,
+    22360, 27560, 22376, 23464, 22392, 31656, 22424, 26536, 22456, 30632, 22488, 28584,
+    22504, 24488, 22520, 32680, 22552, 24680, 22584, 28776, 22616, 26728, 22648, 30824,
+    22680, 25704, 22712, 29800, 22744, 27752, 22760, 23656, 22776, 31848, 22808, 25192,
+    22840, 29288, 22872, 27240, 22888, 23144, 22904, 31336, 22936, 26216, 22968, 30312,
+    23000, 28264, 23016, 24168, 23032, 32360, 23064, 24936, 23096, 29032, 23128, 26984,
+    23160, 31080, 23192, 25960, 23224, 30056, 23256, 28008, 23272, 23912, 23288, 32104,
+    23320, 25448, 23352, 29544, 23384, 27496, 23416, 31592, 23448, 26472, 23480, 30568,
+    23512, 28520, 23528, 24424, 23544, 32616, 23576, 24808, 23608, 28904, 23640, 26856,
+    23672, 30952, 23704, 25832, 23736, 29928, 23768, 27880, 23800, 31976, 23832, 25320,
+    23864, 29416, 23896, 27368, 23928, 31464, 23960, 26344, 23992, 30440, 24024, 28392,
+    24040, 24296, 24056, 32488, 24088, 25064, 24120, 29160, 24152, 27112, 24184, 31208,
+    24216, 26088, 24248, 30184, 24280, 28136, 24312, 32232, 24344, 25576, 24376, 29672,
+    24408, 27624, 24440, 31720, 24472, 26600, 24504, 30696, 24536, 28648, 24568, 32744,
+    24632, 28696, 24664, 26648, 24696, 30744, 24728, 25624, 24760, 29720, 24792, 27672,
+    24824, 31768, 24856, 25112, 24888, 29208, 24920, 27160, 24952, 31256, 24984, 26136,
+    25016, 30232, 25048, 28184, 25080, 32280, 25144, 28952, 25176, 26904, 25208, 31000,
+    25240, 25880, 25272, 29976, 25304, 27928, 25336, 32024, 25400, 29464, 25432, 27416,
+    25464, 31512, 25496, 26392, 25528, 30488, 25560, 28440, 25592, 32536, 25656, 28824,
+    25688, 26776, 25720, 30872, 25784, 29848, 25816, 27800, 25848, 31896, 25912, 29336,
+    25944, 27288, 25976, 31384, 26008, 26264, 26040, 30360, 26072, 28312, 26104, 32408,
+    26168, 29080, 26200, 27032, 26232, 31128, 26296, 30104, 26328, 28056, 26360, 32152,
+    26424, 29592, 26456, 27544, 26488, 31640, 26552, 30616, 26584, 28568, 26616, 32664,
+    26680, 28760, 26744, 30808, 26808, 29784, 26840, 27736, 26872, 31832, 26936, 29272,
+    26968, 27224, 27000, 31320, 27064, 30296, 27096, 28248, 27128, 32344, 27192, 29016,
+    27256, 31064, 27320, 30040, 27352, 27992, 27384, 32088, 27448, 29528, 27512, 31576,
+    27576, 30552, 27608, 28504, 27640, 32600, 27704, 28888, 27768, 30936, 27832, 29912,
+    27896, 31960, 27960, 29400, 28024, 31448, 28088, 30424, 28120, 28376, 28152, 32472,
+    28216, 29144, 28280, 31192, 28344, 30168, 28408, 32216, 28472, 29656, 28536, 31704,
+    28600, 30680, 28664, 32728, 28792, 30776, 28856, 29752, 28920, 31800, 28984, 29240,
+    29048, 31288, 29112, 30264, 29176, 32312, 29304, 31032, 29368, 30008, 29432, 32056,
+    29560, 31544, 29624, 30520, 29688, 32568, 29816, 30904, 29944, 31928, 30072, 31416,
+    30136, 30392, 30200, 32440, 30328, 31160, 30456, 32184, 30584, 31672, 30712, 32696,
+    30968, 31864, 31096, 31352, 31224, 32376, 31480, 32120, 31736, 32632, 32248, 32504,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_REALCOEF_Q15)
+const q15_t realCoefAQ15[8192] = {
+    16384, -16384, 16371, -16384, 16359, -16384, 16346, -16384, 16334, -16384, 16321, -16384,
+    16309, -16384, 16296, -16384, 16283, -16384, 16271, -16384, 16258, -16384, 16246, -16383,
+    16233, -16383, 16221, -16383, 16208, -16383, 16196, -16383, 16183, -16383, 16170, -16383,
+    16158, -16382, 16145, -16382, 16133, -16382, 16120, -16382, 16108, -16382, 16095, -16381,
+    16082, -16381, 16070, -16381, 16057, -16381, 16045, -16380, 16032, -16380, 16020, -16380,
+    16007, -16380, 15994, -16379, 15982, -16379, 15969, -16379, 15957, -16378, 15944, -16378,
+    15932, -16378, 15919, -16377, 15907, -16377, 15894, -16377, 15881, -16376, 15869, -16376,
+    15856, -16375, 15844, -16375, 15831, -16375, 15819, -16374, 15806, -16374, 15794, -16373,
+    15781, -16373, 15768, -16372, 15756, -16372, 15743, -16371, 15731, -16371, 15718, -16370,
+    15706, -16370, 15693, -16369, 15680, -16369, 15668, -16368, 15655, -16368, 15643, -16367,
+    15630, -16367, 15618, -16366, 15605, -16365, 15593, -16365, 15580, -16364, 15568, -16364,
+    15555, -16363, 15542, -16362, 15530, -16362, 15517, -16361, 15505, -16360, 15492, -16360,
+    15480, -16359, 15467, -16358, 15455, -16358, 15442, -16357, 15429, -16356, 15417, -16355,
+    15404, -16355, 15392, -16354, 15379, -16353, 15367, -16352, 15354, -16352, 15342, -16351,
+    15329, -16350, 15317, -16349, 15304, -16348, 15292, -16348, 15279, -16347, 15266, -16346,
+    15254, -16345, 15241, -16344, 15229, -16343, 15216, -16342, 15204, -16341, 15191, -16341,
+    15179, -16340, 15166, -16339, 15154, -16338, 15141, -16337, 15129, -16336, 15116, -16335,
+    15104, -16334, 15091, -16333, 15078, -16332, 15066, -16331, 15053, -16330, 15041, -16329,
+    15028, -16328, 15016, -16327, 15003, -16326, 14991, -16325, 14978, -16324, 14966, -16323,
+    14953, -16321, 14941, -16320, 14928, -16319, 14916, -16318, 14903, -16317, 14891, -16316,
+    14878, -16315, 14866, -16313, 14853, -16312, 14841, -16311, 14828, -16310, 14816, -16309,
+    14803, -16308, 14791, -16306, 14778, -16305, 14766, -16304, 14753, -16303, 14741, -16301,
+    14728, -16300, 14716, -16299, 14703, -16298, 14691, -16296, 14678, -16295, 14666, -16294,
+    14653, -16292, 14641, -16291, 14628, -16290, 14616, -16288, 14603, -16287, 14591, -16286,
+    14578, -16284, 14566, -16283, 14553, -16281, 14541, -16280, 14528, -16279, 14516, -16277,
+    14503, -16276, 14491, -16274, 14478, -16273, 14466, -16271, 14453, -16270, 14441, -16268,
+    14428, -16267, 14416, -16265, 14403, -16264, 14391, -16262, 14378, -16261, 14366, -16259,
+    14353, -16258, 14341, -16256, 14329, -16255, 14316, -16253, 14304, -16251, 14291, -16250,
+    14279, -16248, 14266, -16247, 14254, -16245, 14241, -16243, 14229, -16242, 14216, -16240,
+    14204, -16238, 14191, -16237, 14179, -16235, 14167, -16233, 14154, -16232, 14142, -16230,
+    14129, -16228, 14117, -16226, 14104, -16225, 14092, -16223, 14079, -16221, 14067, -16219,
+    14055, -16218, 14042, -16216, 14030, -16214, 14017, -16212, 14005, -16210, 13992, -16209,
+    13980, -16207, 13968, -16205, 13955, -16203, 13943, -16201, 13930, -16199, 13918, -16197,
+    13905, -16195, 13893, -16194, 13881, -16192, 13868, -16190, 13856, -16188, 13843, -16186,
+    13831, -16184, 13818, -16182, 13806, -16180, 13794, -16178, 13781, -16176, 13769, -16174,
+    13756, -16172, 13744, -16170, 13732, -16168, 13719, -16166, 13707, -16164, 13694, -16162,
+    13682, -16160, 13670, -16158, 13657, -16156, 13645, -16153, 13632, -16151, 13620, -16149,
+    13608, -16147, 13595, -16145, 13583, -16143, 13571, -16141, 13558, -16138, 13546, -16136,
+    13533, -16134, 13521, -16132, 13509, -16130, 13496, -16128, 13484, -16125, 13472, -16123,
+    13459, -16121, 13447, -16119, 13435, -16116, 13422, -16114, 13410, -16112, 13397, -16109,
+    13385, -16107, 13373, -16105, 13360, -16103, 13348, -16100, 13336, -16098, 13323, -16096,
+    13311, -16093, 13299, -16091, 13286, -16088, 13274, -16086, 13262, -16084, 13249, -16081,
+    13237, -16079, 13225, -16076, 13212, -16074, 13200, -16072, 13188, -16069, 13175, -16067,
+    13163, -16064, 13151, -16062, 13138, -16059, 13126, -16057, 13114, -16054, 13101, -16052,
+    13089, -16049, 13077, -16047, 13064, -16044, 13052, -16042, 13040, -16039, 13028, -16037,
+    13015, -16034, 13003, -16031, 12991, -16029, 12978, -16026, 12966, -16024, 12954, -16021,
+    12942, -16018, 12929, -16016, 12917, -16013, 12905, -16010, 12892, -16008, 12880, -16005,
+    12868, -16002, 12856, -16000, 12843, -15997, 12831, -15994, 12819, -15991, 12807, -15989,
+    12794, -15986, 12782, -15983, 12770, -15980, 12757, -15978, 12745, -15975, 12733, -15972,
+    12721, -15969, 12708, -15966, 12696, -15964, 12684, -15961, 12672, -15958, 12660, -15955,
+    12647, -15952, 12635, -15949, 12623, -15946, 12611, -15944, 12598, -15941, 12586, -15938,
+    12574, -15935, 12562, -15932, 12549, -15929, 12537, -15926, 12525, -15923, 12513, -15920,
+    12501, -15917, 12488, -15914, 12476, -15911, 12464, -15908, 12452, -15905, 12440, -15902,
+    12427, -15899, 12415, -15896, 12403, -15893, 12391, -15890, 12379, -15887, 12366, -15884,
+    12354, -15881, 12342, -15878, 12330, -15875, 12318, -15871, 12306, -15868, 12293, -15865,
+    12281, -15862, 12269, -15859, 12257, -15856, 12245, -15853, 12233, -15849, 12220, -15846,
+    12208, -15843, 12196, -15840, 12184, -15837, 12172, -15833, 12160, -15830, 12148, -15827,
+    12135, -15824, 12123, -15820, 12111, -15817, 12099, -15814, 12087, -15810, 12075, -15807,
+    12063, -15804, 12051, -15801, 12038, -15797, 12026, -15794, 12014, -15791, 12002, -15787,
+    11990, -15784, 11978, -15780, 11966, -15777, 11954, -15774, 11942, -15770, 11929, -15767,
+    11917, -15763, 11905, -15760, 11893, -15757, 11881, -15753, 11869, -15750, 11857, -15746,
+    11845, -15743, 11833, -15739, 11821, -15736, 11809, -15732, 11797, -15729, 11785, -15725,
+    11772, -15722, 11760, -15718, 11748, -15715, 11736, -15711, 11724, -15707, 11712, -15704,
+    11700, -15700, 11688, -15697, 11676, -15693, 11664, -15689, 11652, -15686, 11640, -15682,
+    11628, -15679, 11616, -15675, 11604, -15671, 11592, -15668, 11580, -15664, 11568, -15660,
+    11556, -15656, 11544, -15653, 11532, -15649, 11520, -15645, 11508, -15642, 11496, -15638,
+    11484, -15634, 11472, -15630, 11460, -15627, 11448, -15623, 11436, -15619, 11424, -15615,
+    11412, -15611, 11400, -15608, 11388, -15604, 11376, -15600, 11364, -15596, 11352, -15592,
+    11340, -15588, 11328, -15584, 11316, -15581, 11304, -15577, 11292, -15573, 11280, -15569,
+    11269, -15565, 11257, -15561, 11245, -15557, 11233, -15553, 11221, -15549, 11209, -15545,
+    11197, -15541, 11185, -15537, 11173, -15533, 11161, -15529, 11149, -15525, 11137, -15521,
+    11125, -15517, 11114, -15513, 11102, -15509, 11090, -15505, 11078, -15501, 11066, -15497,
+    11054, -15493, 11042, -15489, 11030, -15485, 11018, -15481, 11007, -15476, 10995, -15472,
+    10983, -15468, 10971, -15464, 10959, -15460, 10947, -15456, 10935, -15451, 10924, -15447,
+    10912, -15443, 10900, -15439, 10888, -15435, 10876, -15430, 10864, -15426, 10853, -15422,
+    10841, -15418, 10829, -15414, 10817, -15409, 10805, -15405, 10793, -15401, 10782, -15396,
+    10770, -15392, 10758, -15388, 10746, -15383, 10734, -15379, 10723, -15375, 10711, -15370,
+    10699, -15366, 10687, -15362, 10676, -15357, 10664, -15353, 10652, -15349, 10640, -15344,
+    10628, -15340, 10617, -15335, 10605, -15331, 10593, -15326, 10581, -15322, 10570, -15318,
+    10558, -15313, 10546, -15309, 10534, -15304, 10523, -15300, 10511, -15295, 10499, -15291,
+    10487, -15286, 10476, -15282, 10464, -15277, 10452, -15273, 10441, -15268, 10429, -15263,
+    10417, -15259, 10405, -15254, 10394, -15250, 10382, -15245, 10370, -15240, 10359, -15236,
+    10347, -15231, 10335, -15227, 10324, -15222, 10312, -15217, 10300, -15213, 10289, -15208,
+    10277, -15203, 10265, -15199, 10254, -15194, 10242, -15189, 10230, -15184, 10219, -15180,
+    10207, -15175, 10195, -15170, 10184, -15166, 10172, -15161, 10161, -15156, 10149, -15151,
+    10137, -15146, 10126, -15142, 10114, -15137, 10103, -15132, 10091, -15127, 10079, -15122,
+    10068, -15118, 10056, -15113, 10045, -15108, 10033, -15103, 10021, -15098, 10010, -15093,
+    9998, -15088, 9987, -15083, 9975, -15078, 9964, -15074, 9952, -15069, 9940, -15064,
+    9929, -15059, 9917, -15054, 9906, -15049, 9894, -15044, 9883, -15039, 9871, -15034,
+    9860, -15029, 9848, -15024, 9837, -15019, 9825, -15014, 9814, -15009, 9802, -15004,
+    9791, -14999, 9779, -14994, 9768, -14989, 9756, -14984, 9745, -14978, 9733, -14973,
+    9722, -14968, 9710, -14963, 9699, -14958, 9687, -14953, 9676, -14948, 9664, -14943,
+    9653, -14937, 9641, -14932, 9630, -14927, 9618, -14922, 9607, -14917, 9596, -14911,
+    9584, -14906, 9573, -14901, 9561, -14896, 9550, -14891, 9538, -14885, 9527, -14880,
+    9516, -14875, 9504, -14870, 9493, -14864, 9481, -14859, 9470, -14854, 9459, -14848,
+    9447, -14843, 9436, -14838, 9424, -14832, 9413, -14827, 9402, -14822, 9390, -14816,
+    9379, -14811, 9368, -14806, 9356, -14800, 9345, -14795, 9334, -14789, 9322, -14784,
+    9311, -14779, 9300, -14773, 9288, -14768, 9277, -14762, 9266, -14757, 9254, -14751,
+    9243, -14746, 9232, -14740, 9220, -14735, 9209, -14729, 9198, -14724, 9186, -14718,
+    9175, -14713, 9164, -14707, 9153, -14702, 9141, -14696, 9130, -14691, 9119, -14685,
+    9108, -14680, 9096, -14674, 9085, -14668, 9074, -14663, 9063, -14657, 9051, -14651,
+    9040, -14646, 9029, -14640, 9018, -14635, 9006, -14629, 8995, -14623, 8984, -14618,
+    8973, -14612, 8961, -14606, 8950, -14601, 8939, -14595, 8928, -14589, 8917, -14583,
+    8906, -14578, 8894, -14572, 8883, -14566, 8872, -14560, 8861, -14555, 8850, -14549,
+    8839, -14543, 8827, -14537, 8816, -14531, 8805, -14526, 8794, -14520, 8783, -14514,
+    8772, -14508, 8761, -14502, 8749, -14497, 8738, -14491, 8727, -14485, 8716, -14479,
+    8705, -14473, 8694, -14467, 8683, -14461, 8672, -14455, 8661, -14449, 8650, -14443,
+    8638, -14438, 8627, -14432, 8616, -14426, 8605, -14420, 8594, -14414, 8583, -14408,
+    8572, -14402, 8561, -14396, 8550, -14390, 8539, -14384, 8528, -14378, 8517, -14372,
+    8506, -14366, 8495, -14360, 8484, -14354, 8473, -14347, 8462, -14341, 8451, -14335,
+    8440, -14329, 8429, -14323, 8418, -14317, 8407, -14311, 8396, -14305, 8385, -14299,
+    8374, -14293, 8363, -14286, 8352, -14280, 8341, -14274, 8330, -14268, 8319, -14262,
+    8308, -14256, 8297, -14249, 8286, -14243, 8276, -14237, 8265, -14231, 8254, -14224,
+    8243, -14218, 8232, -14212, 8221, -14206, 8210, -14199, 8199, -14193, 8188, -14187,
+    8177, -14181, 8167, -14174, 8156, -14168, 8145, -14162, 8134, -14155, 8123, -14149,
+    8112, -14143, 8101, -14136, 8091, -14130, 8080, -14124, 8069, -14117, 8058, -14111,
+    8047, -14104, 8037, -14098, 8026, -14092, 8015, -14085, 8004, -14079, 7993, -14072,
+    7983, -14066, 7972, -14059, 7961, -14053, 7950, -14047, 7939, -14040, 7929, -14034,
+    7918, -14027, 7907, -14021, 7896, -14014, 7886, -14008, 7875, -14001, 7864, -13995,
+    7853, -13988, 7843, -13981, 7832, -13975, 7821, -13968, 7811, -13962, 7800, -13955,
+    7789, -13949, 7778, -13942, 7768, -13935, 7757, -13929, 7746, -13922, 7736, -13916,
+    7725, -13909, 7714, -13902, 7704, -13896, 7693, -13889, 7682, -13882, 7672, -13876,
+    7661, -13869, 7650, -13862, 7640, -13856, 7629, -13849, 7619, -13842, 7608, -13835,
+    7597, -13829, 7587, -13822, 7576, -13815, 7566, -13808, 7555, -13802, 7544, -13795,
+    7534, -13788, 7523, -13781, 7513, -13774, 7502, -13768, 7492, -13761, 7481, -13754,
+    7470, -13747, 7460, -13740, 7449, -13733, 7439, -13727, 7428, -13720, 7418, -13713,
+    7407, -13706, 7397, -13699, 7386, -13692, 7376, -13685, 7365, -13678, 7355, -13671,
+    7344, -13665, 7334, -13658, 7323, -13651, 7313, -13644, 7302, -13637, 7292, -13630,
+    7282, -13623, 7271, -13616, 7261, -13609, 7250, -13602, 7240, -13595, 7229, -13588,
+    7219, -13581, 7209, -13574, 7198, -13567, 7188, -13560, 7177, -13553, 7167, -13546,
+    7157, -13538, 7146, -13531, 7136, -13524, 7125, -13517, 7115, -13510, 7105, -13503,
+    7094, -13496, 7084, -13489, 7074, -13482, 7063, -13474, 7053, -13467, 7043, -13460,
+    7032, -13453, 7022, -13446, 7012, -13439, 7001, -13431, 6991, -13424, 6981, -13417,
+    6971, -13410, 6960, -13403, 6950, -13395, 6940, -13388, 6929, -13381, 6919, -13374,
+    6909, -13366, 6899, -13359, 6888, -13352, 6878, -13344, 6868, -13337, 6858, -13330,
+    6847, -13323, 6837, -13315, 6827, -13308, 6817, -13301, 6807, -13293, 6796, -13286,
+    6786, -13279, 6776, -13271, 6766, -13264, 6756, -13256, 6746, -13249, 6735, -13242,
+    6725, -13234, 6715, -13227, 6705, -13219, 6695, -13212, 6685, -13205, 6675, -13197,
+    6664, -13190, 6654, -13182, 6644, -13175, 6634, -13167, 6624, -13160, 6614, -13152,
+    6604, -13145, 6594, -13137, 6584, -13130, 6574, -13122, 6564, -13115, 6554, -13107,
+    6543, -13100, 6533, -13092, 6523, -13085, 6513, -13077, 6503, -13069, 6493, -13062,
+    6483, -13054, 6473, -13047, 6463, -13039, 6453, -13031, 6443, -13024, 6433, -13016,
+    6423, -13008, 6413, -13001, 6403, -12993, 6393, -12986, 6383, -12978, 6374, -12970,
+    6364, -12963, 6354, -12955, 6344, -12947, 6334, -12939, 6324, -12932, 6314, -12924,
+    6304, -12916, 6294, -12909, 6284, -12901, 6274, -12893, 6264, -12885, 6255, -12878,
+    6245, -12870, 6235, -12862, 6225, -12854, 6215, -12846, 6205, -12839, 6195, -12831,
+    6186, -12823, 6176, -12815, 6166, -12807, 6156, -12799, 6146, -12792, 6136, -12784,
+    6127, -12776, 6117, -12768, 6107, -12760, 6097, -12752, 6088, -12744, 6078, -12736,
+    6068, -12729, 6058, -12721, 6048, -12713, 6039, -12705, 6029, -12697, 6019, -12689,
+    6010, -12681, 6000, -12673, 5990, -12665, 5980, -12657, 5971, -12649, 5961, -12641,
+    5951, -12633, 5942, -12625, 5932, -12617, 5922, -12609, 5913, -12601, 5903, -12593,
+    5893, -12585, 5884, -12577, 5874, -12569, 5864, -12561, 5855, -12553, 5845, -12545,
+    5835, -12537, 5826, -12528, 5816, -12520, 5807, -12512, 5797, -12504, 5787, -12496,
+    5778, -12488, 5768, -12480, 5759, -12472, 5749, -12463, 5740, -12455, 5730, -12447,
+    5721, -12439, 5711, -12431, 5701, -12423, 5692, -12414, 5682, -12406, 5673, -12398,
+    5663, -12390, 5654, -12381, 5644, -12373, 5635, -12365, 5625, -12357, 5616, -12348,
+    5606, -12340, 5597, -12332, 5588, -12324, 5578, -12315, 5569, -12307, 5559, -12299,
+    5550, -12290, 5540, -12282, 5531, -12274, 5522, -12266, 5512, -12257, 5503, -12249,
+    5493, -12240, 5484, -12232, 5475, -12224, 5465, -12215, 5456, -12207, 5447, -12199,
+    5437, -12190, 5428, -12182, 5418, -12173, 5409, -12165, 5400, -12157, 5390, -12148,
+    5381, -12140, 5372, -12131, 5363, -12123, 5353, -12114, 5344, -12106, 5335, -12097,
+    5325, -12089, 5316, -12080, 5307, -12072, 5298, -12064, 5288, -12055, 5279, -12046,
+    5270, -12038, 5261, -12029, 5251, -12021, 5242, -12012, 5233, -12004, 5224, -11995,
+    5215, -11987, 5205, -11978, 5196, -11970, 5187, -11961, 5178, -11952, 5169, -11944,
+    5160, -11935, 5150, -11927, 5141, -11918, 5132, -11909, 5123, -11901, 5114, -11892,
+    5105, -11883, 5096, -11875, 5087, -11866, 5077, -11857, 5068, -11849, 5059, -11840,
+    5050, -11831, 5041, -11823, 5032, -11814, 5023, -11805, 5014, -11797, 5005, -11788,
+    4996, -11779, 4987, -11770, 4978, -11762, 4969, -11753, 4960, -11744, 4951, -11735,
+    4942, -11727, 4933, -11718, 4924, -11709, 4915, -11700, 4906, -11691, 4897, -11683,
+    4888, -11674, 4879, -11665, 4870, -11656, 4861, -11647, 4852, -11638, 4843, -11630,
+    4834, -11621, 4825, -11612, 4817, -11603, 4808, -11594, 4799, -11585, 4790, -11576,
+    4781, -11567, 4772, -11559, 4763, -11550, 4754, -11541, 4746, -11532, 4737, -11523,
+    4728, -11514, 4719, -11505, 4710, -11496, 4701, -11487, 4693, -11478, 4684, -11469,
+    4675, -11460, 4666, -11451, 4657, -11442, 4649, -11433, 4640, -11424, 4631, -11415,
+    4622, -11406, 4614, -11397, 4605, -11388, 4596, -11379, 4587, -11370, 4579, -11361,
+    4570, -11352, 4561, -11343, 4553, -11334, 4544, -11325, 4535, -11316, 4527, -11307,
+    4518, -11297, 4509, -11288, 4501, -11279, 4492, -11270, 4483, -11261, 4475, -11252,
+    4466, -11243, 4457, -11234, 4449, -11224, 4440, -11215, 4432, -11206, 4423, -11197,
+    4414, -11188, 4406, -11179, 4397, -11169, 4389, -11160, 4380, -11151, 4372, -11142,
+    4363, -11133, 4355, -11123, 4346, -11114, 4338, -11105, 4329, -11096, 4320, -11086,
+    4312, -11077, 4304, -11068, 4295, -11059, 4287, -11049, 4278, -11040, 4270, -11031,
+    4261, -11021, 4253, -11012, 4244, -11003, 4236, -10994, 4227, -10984, 4219, -10975,
+    4211, -10966, 4202, -10956, 4194, -10947, 4185, -10937, 4177, -10928, 4169, -10919,
+    4160, -10909, 4152, -10900, 4144, -10891, 4135, -10881, 4127, -10872, 4118, -10862,
+    4110, -10853, 4102, -10844, 4094, -10834, 4085, -10825, 4077, -10815, 4069, -10806,
+    4060, -10796, 4052, -10787, 4044, -10778, 4036, -10768, 4027, -10759, 4019, -10749,
+    4011, -10740, 4003, -10730, 3994, -10721, 3986, -10711, 3978, -10702, 3970, -10692,
+    3961, -10683, 3953, -10673, 3945, -10663, 3937, -10654, 3929, -10644, 3921, -10635,
+    3912, -10625, 3904, -10616, 3896, -10606, 3888, -10597, 3880, -10587, 3872, -10577,
+    3864, -10568, 3856, -10558, 3847, -10549, 3839, -10539, 3831, -10529, 3823, -10520,
+    3815, -10510, 3807, -10500, 3799, -10491, 3791, -10481, 3783, -10471, 3775, -10462,
+    3767, -10452, 3759, -10442, 3751, -10433, 3743, -10423, 3735, -10413, 3727, -10404,
+    3719, -10394, 3711, -10384, 3703, -10374, 3695, -10365, 3687, -10355, 3679, -10345,
+    3671, -10336, 3663, -10326, 3655, -10316, 3648, -10306, 3640, -10296, 3632, -10287,
+    3624, -10277, 3616, -10267, 3608, -10257, 3600, -10248, 3592, -10238, 3585, -10228,
+    3577, -10218, 3569, -10208, 3561, -10198, 3553, -10189, 3545, -10179, 3538, -10169,
+    3530, -10159, 3522, -10149, 3514, -10139, 3506, -10129, 3499, -10120, 3491, -10110,
+    3483, -10100, 3475, -10090, 3468, -10080, 3460, -10070, 3452, -10060, 3445, -10050,
+    3437, -10040, 3429, -10030, 3421, -10020, 3414, -10010, 3406, -10001, 3398, -9991,
+    3391, -9981, 3383, -9971, 3376, -9961, 3368, -9951, 3360, -9941, 3353, -9931,
+    3345, -9921, 3337, -9911, 3330, -9901, 3322, -9891, 3315, -9881, 3307, -9871,
+    3299, -9861, 3292, -9851, 3284, -9841, 3277, -9830, 3269, -9820, 3262, -9810,
+    3254, -9800, 3247, -9790, 3239, -9780, 3232, -9770, 3224, -9760, 3217, -9750,
+    3209, -9740, 3202, -9730, 3194, -9720, 3187, -9709, 3179, -9699, 3172, -9689,
+    3165, -9679, 3157, -9669, 3150, -9659, 3142, -9649, 3135, -9638, 3128, -9628,
+    3120, -9618, 3113, -9608, 3105, -9598, 3098, -9588, 3091, -9577, 3083, -9567,
+    3076, -9557, 3069, -9547, 3061, -9537, 3054, -9526, 3047, -9516, 3040, -9506,
+    3032, -9496, 3025, -9485, 3018, -9475, 3010, -9465, 3003, -9455, 2996, -9444,
+    2989, -9434, 2981, -9424, 2974, -9413, 2967, -9403, 2960, -9393, 2953, -9383,
+    2945, -9372, 2938, -9362, 2931, -9352, 2924, -9341, 2917, -9331, 2910, -9321,
+    2902, -9310, 2895, -9300, 2888, -9290, 2881, -9279, 2874, -9269, 2867, -9259,
+    2860, -9248, 2853, -9238, 2846, -9227, 2838, -9217, 2831, -9207, 2824, -9196,
+    2817, -9186, 2810, -9175, 2803, -9165, 2796, -9155, 2789, -9144, 2782, -9134,
+    2775, -9123, 2768, -9113, 2761, -9102, 2754, -9092, 2747, -9082, 2740, -9071,
+    2733, -9061, 2726, -9050, 2719, -9040, 2713, -9029, 2706, -9019, 2699, -9008,
+    2692, -8998, 2685, -8987, 2678, -8977, 2671, -8966, 2664, -8956, 2657, -8945,
+    2651, -8935, 2644, -8924, 2637, -8914, 2630, -8903, 2623, -8892, 2616, -8882,
+    2610, -8871, 2603, -8861, 2596, -8850, 2589, -8840, 2582, -8829, 2576, -8818,
+    2569, -8808, 2562, -8797, 2555, -8787, 2549, -8776, 2542, -8765, 2535, -8755,
+    2528, -8744, 2522, -8734, 2515, -8723, 2508, -8712, 2502, -8702, 2495, -8691,
+    2488, -8680, 2482, -8670, 2475, -8659, 2468, -8648, 2462, -8638, 2455, -8627,
+    2449, -8616, 2442, -8606, 2435, -8595, 2429, -8584, 2422, -8573, 2416, -8563,
+    2409, -8552, 2403, -8541, 2396, -8531, 2389, -8520, 2383, -8509, 2376, -8498,
+    2370, -8488, 2363, -8477, 2357, -8466, 2350, -8455, 2344, -8445, 2337, -8434,
+    2331, -8423, 2325, -8412, 2318, -8401, 2312, -8391, 2305, -8380, 2299, -8369,
+    2292, -8358, 2286, -8347, 2280, -8337, 2273, -8326, 2267, -8315, 2260, -8304,
+    2254, -8293, 2248, -8283, 2241, -8272, 2235, -8261, 2229, -8250, 2222, -8239,
+    2216, -8228, 2210, -8217, 2203, -8207, 2197, -8196, 2191, -8185, 2185, -8174,
+    2178, -8163, 2172, -8152, 2166, -8141, 2160, -8130, 2153, -8119, 2147, -8108,
+    2141, -8098, 2135, -8087, 2128, -8076, 2122, -8065, 2116, -8054, 2110, -8043,
+    2104, -8032, 2098, -8021, 2091, -8010, 2085, -7999, 2079, -7988, 2073, -7977,
+    2067, -7966, 2061, -7955, 2055, -7944, 2049, -7933, 2043, -7922, 2037, -7911,
+    2030, -7900, 2024, -7889, 2018, -7878, 2012, -7867, 2006, -7856, 2000, -7845,
+    1994, -7834, 1988, -7823, 1982, -7812, 1976, -7801, 1970, -7790, 1964, -7779,
+    1958, -7768, 1952, -7757, 1946, -7746, 1941, -7734, 1935, -7723, 1929, -7712,
+    1923, -7701, 1917, -7690, 1911, -7679, 1905, -7668, 1899, -7657, 1893, -7646,
+    1887, -7635, 1882, -7623, 1876, -7612, 1870, -7601, 1864, -7590, 1858, -7579,
+    1853, -7568, 1847, -7557, 1841, -7545, 1835, -7534, 1829, -7523, 1824, -7512,
+    1818, -7501, 1812, -7490, 1806, -7478, 1801, -7467, 1795, -7456, 1789, -7445,
+    1783, -7434, 1778, -7423, 1772, -7411, 1766, -7400, 1761, -7389, 1755, -7378,
+    1749, -7366, 1744, -7355, 1738, -7344, 1733, -7333, 1727, -7321, 1721, -7310,
+    1716, -7299, 1710, -7288, 1704, -7276, 1699, -7265, 1693, -7254, 1688, -7243,
+    1682, -7231, 1677, -7220, 1671, -7209, 1666, -7198, 1660, -7186, 1655, -7175,
+    1649, -7164, 1644, -7152, 1638, -7141, 1633, -7130, 1627, -7118, 1622, -7107,
+    1616, -7096, 1611, -7084, 1605, -7073, 1600, -7062, 1595, -7050, 1589, -7039,
+    1584, -7028, 1578, -7016, 1573, -7005, 1568, -6994, 1562, -6982, 1557, -6971,
+    1552, -6960, 1546, -6948, 1541, -6937, 1536, -6925, 1530, -6914, 1525, -6903,
+    1520, -6891, 1514, -6880, 1509, -6868, 1504, -6857, 1499, -6846, 1493, -6834,
+    1488, -6823, 1483, -6811, 1478, -6800, 1473, -6788, 1467, -6777, 1462, -6766,
+    1457, -6754, 1452, -6743, 1447, -6731, 1441, -6720, 1436, -6708, 1431, -6697,
+    1426, -6685, 1421, -6674, 1416, -6662, 1411, -6651, 1406, -6639, 1400, -6628,
+    1395, -6616, 1390, -6605, 1385, -6593, 1380, -6582, 1375, -6570, 1370, -6559,
+    1365, -6547, 1360, -6536, 1355, -6524, 1350, -6513, 1345, -6501, 1340, -6490,
+    1335, -6478, 1330, -6467, 1325, -6455, 1320, -6444, 1315, -6432, 1310, -6420,
+    1306, -6409, 1301, -6397, 1296, -6386, 1291, -6374, 1286, -6363, 1281, -6351,
+    1276, -6339, 1271, -6328, 1266, -6316, 1262, -6305, 1257, -6293, 1252, -6281,
+    1247, -6270, 1242, -6258, 1238, -6247, 1233, -6235, 1228, -6223, 1223, -6212,
+    1218, -6200, 1214, -6189, 1209, -6177, 1204, -6165, 1200, -6154, 1195, -6142,
+    1190, -6130, 1185, -6119, 1181, -6107, 1176, -6095, 1171, -6084, 1167, -6072,
+    1162, -6060, 1157, -6049, 1153, -6037, 1148, -6025, 1144, -6014, 1139, -6002,
+    1134, -5990, 1130, -5979, 1125, -5967, 1121, -5955, 1116, -5943, 1111, -5932,
+    1107, -5920, 1102, -5908, 1098, -5897, 1093, -5885, 1089, -5873, 1084, -5861,
+    1080, -5850, 1075, -5838, 1071, -5826, 1066, -5814, 1062, -5803, 1058, -5791,
+    1053, -5779, 1049, -5767, 1044, -5756, 1040, -5744, 1035, -5732, 1031, -5720,
+    1027, -5708, 1022, -5697, 1018, -5685, 1014, -5673, 1009, -5661, 1005, -5650,
+    1001, -5638, 996, -5626, 992, -5614, 988, -5602, 983, -5591, 979, -5579,
+    975, -5567, 970, -5555, 966, -5543, 962, -5531, 958, -5520, 954, -5508,
+    949, -5496, 945, -5484, 941, -5472, 937, -5460, 933, -5449, 928, -5437,
+    924, -5425, 920, -5413, 916, -5401, 912, -5389, 908, -5377, 903, -5366,
+    899, -5354, 895, -5342, 891, -5330, 887, -5318, 883, -5306, 879, -5294,
+    875, -5282, 871, -5270, 867, -5259, 863, -5247, 859, -5235, 855, -5223,
+    851, -5211, 847, -5199, 843, -5187, 839, -5175, 835, -5163, 831, -5151,
+    827, -5139, 823, -5127, 819, -5115, 815, -5104, 811, -5092, 807, -5080,
+    803, -5068, 800, -5056, 796, -5044, 792, -5032, 788, -5020, 784, -5008,
+    780, -4996, 776, -4984, 773, -4972, 769, -4960, 765, -4948, 761, -4936,
+    757, -4924, 754, -4912, 750, -4900, 746, -4888, 742, -4876, 739, -4864,
+    735, -4852, 731, -4840, 728, -4828, 724, -4816, 720, -4804, 716, -4792,
+    713, -4780, 709, -4768, 705, -4756, 702, -4744, 698, -4732, 695, -4720,
+    691, -4708, 687, -4696, 684, -4684, 680, -4672, 677, -4660, 673, -4648,
+    669, -4636, 666, -4624, 662, -4612, 659, -4599, 655, -4587, 652, -4575,
+    648, -4563, 645, -4551, 641, -4539, 638, -4527, 634, -4515, 631, -4503,
+    627, -4491, 624, -4479, 621, -4467, 617, -4455, 614, -4442, 610, -4430,
+    607, -4418, 604, -4406, 600, -4394, 597, -4382, 593, -4370, 590, -4358,
+    587, -4346, 583, -4333, 580, -4321, 577, -4309, 574, -4297, 570, -4285,
+    567, -4273, 564, -4261, 560, -4249, 557, -4236, 554, -4224, 551, -4212,
+    547, -4200, 544, -4188, 541, -4176, 538, -4164, 535, -4151, 531, -4139,
+    528, -4127, 525, -4115, 522, -4103, 519, -4091, 516, -4078, 513, -4066,
+    509, -4054, 506, -4042, 503, -4030, 500, -4018, 497, -4005, 494, -3993,
+    491, -3981, 488, -3969, 485, -3957, 482, -3944, 479, -3932, 476, -3920,
+    473, -3908, 470, -3896, 467, -3883, 464, -3871, 461, -3859, 458, -3847,
+    455, -3835, 452, -3822, 449, -3810, 446, -3798, 443, -3786, 440, -3773,
+    438, -3761, 435, -3749, 432, -3737, 429, -3724, 426, -3712, 423, -3700,
+    420, -3688, 418, -3676, 415, -3663, 412, -3651, 409, -3639, 406, -3627,
+    404, -3614, 401, -3602, 398, -3590, 395, -3577, 393, -3565, 390, -3553,
+    387, -3541, 384, -3528, 382, -3516, 379, -3504, 376, -3492, 374, -3479,
+    371, -3467, 368, -3455, 366, -3442, 363, -3430, 360, -3418, 358, -3406,
+    355, -3393, 353, -3381, 350, -3369, 347, -3356, 345, -3344, 342, -3332,
+    340, -3320, 337, -3307, 335, -3295, 332, -3283, 330, -3270, 327, -3258,
+    325, -3246, 322, -3233, 320, -3221, 317, -3209, 315, -3196, 312, -3184,
+    310, -3172, 308, -3159, 305, -3147, 303, -3135, 300, -3122, 298, -3110,
+    296, -3098, 293, -3085, 291, -3073, 288, -3061, 286, -3048, 284, -3036,
+    281, -3024, 279, -3011, 277, -2999, 275, -2987, 272, -2974, 270, -2962,
+    268, -2949, 265, -2937, 263, -2925, 261, -2912, 259, -2900, 256, -2888,
+    254, -2875, 252, -2863, 250, -2851, 248, -2838, 246, -2826, 243, -2813,
+    241, -2801, 239, -2789, 237, -2776, 235, -2764, 233, -2752, 231, -2739,
+    228, -2727, 226, -2714, 224, -2702, 222, -2690, 220, -2677, 218, -2665,
+    216, -2652, 214, -2640, 212, -2628, 210, -2615, 208, -2603, 206, -2590,
+    204, -2578, 202, -2566, 200, -2553, 198, -2541, 196, -2528, 194, -2516,
+    192, -2503, 190, -2491, 189, -2479, 187, -2466, 185, -2454, 183, -2441,
+    181, -2429, 179, -2416, 177, -2404, 175, -2392, 174, -2379, 172, -2367,
+    170, -2354, 168, -2342, 166, -2329, 165, -2317, 163, -2305, 161, -2292,
+    159, -2280, 158, -2267, 156, -2255, 154, -2242, 152, -2230, 151, -2217,
+    149, -2205, 147, -2193, 146, -2180, 144, -2168, 142, -2155, 141, -2143,
+    139, -2130, 137, -2118, 136, -2105, 134, -2093, 133, -2080, 131, -2068,
+    129, -2055, 128, -2043, 126, -2031, 125, -2018, 123, -2006, 122, -1993,
+    120, -1981, 119, -1968, 117, -1956, 116, -1943, 114, -1931, 113, -1918,
+    111, -1906, 110, -1893, 108, -1881, 107, -1868, 105, -1856, 104, -1843,
+    103, -1831, 101, -1818, 100, -1806, 98, -1793, 97, -1781, 96, -1768,
+    94, -1756, 93, -1743, 92, -1731, 90, -1718, 89, -1706, 88, -1693,
+    86, -1681, 85, -1668, 84, -1656, 83, -1643, 81, -1631, 80, -1618,
+    79, -1606, 78, -1593, 76, -1581, 75, -1568, 74, -1556, 73, -1543,
+    72, -1531, 71, -1518, 69, -1506, 68, -1493, 67, -1481, 66, -1468,
+    65, -1456, 64, -1443, 63, -1431, 61, -1418, 60, -1406, 59, -1393,
+    58, -1381, 57, -1368, 56, -1356, 55, -1343, 54, -1331, 53, -1318,
+    52, -1306, 51, -1293, 50, -1280, 49, -1268, 48, -1255, 47, -1243,
+    46, -1230, 45, -1218, 44, -1205, 43, -1193, 43, -1180, 42, -1168,
+    41, -1155, 40, -1143, 39, -1130, 38, -1118, 37, -1105, 36, -1092,
+    36, -1080, 35, -1067, 34, -1055, 33, -1042, 32, -1030, 32, -1017,
+    31, -1005, 30, -992, 29, -980, 29, -967, 28, -955, 27, -942,
+    26, -929, 26, -917, 25, -904, 24, -892, 24, -879, 23, -867,
+    22, -854, 22, -842, 21, -829, 20, -816, 20, -804, 19, -791,
+    19, -779, 18, -766, 17, -754, 17, -741, 16, -729, 16, -716,
+    15, -704, 15, -691, 14, -678, 14, -666, 13, -653, 13, -641,
+    12, -628, 12, -616, 11, -603, 11, -590, 10, -578, 10, -565,
+    9, -553, 9, -540, 9, -528, 8, -515, 8, -503, 7, -490,
+    7, -477, 7, -465, 6, -452, 6, -440, 6, -427, 5, -415,
+    5, -402, 5, -390, 4, -377, 4, -364, 4, -352, 4, -339,
+    3, -327, 3, -314, 3, -302, 3, -289, 2, -276, 2, -264,
+    2, -251, 2, -239, 2, -226, 1, -214, 1, -201, 1, -188,
+    1, -176, 1, -163, 1, -151, 1, -138, 0, -126, 0, -113,
+    0, -101, 0, -88, 0, -75, 0, -63, 0, -50, 0, -38,
+    0, -25, 0, -13, 0, 0, 0, 13, 0, 25, 0, 38,
+    0, 50, 0, 63, 0, 75, 0, 88, 0, 101, 0, 113,
+    0, 126, 1, 138, 1, 151, 1, 163, 1, 176, 1, 188,
+    1, 201, 1, 214, 2, 226, 2, 239, 2, 251, 2, 264,
+    2, 276, 3, 289, 3, 302, 3, 314, 3, 327, 4, 339,
+    4, 352, 4, 364, 4, 377, 5, 390, 5, 402, 5, 415,
+    6, 427, 6, 440, 6, 452, 7, 465, 7, 477, 7, 490,
+    8, 503, 8, 515, 9, 528, 9, 540, 9, 553, 10, 565,
+    10, 578, 11, 590, 11, 603, 12, 616, 12, 628, 13, 641,
+    13, 653, 14, 666, 14, 678, 15, 691, 15, 704, 16, 716,
+    16, 729, 17, 741, 17, 754, 18, 766, 19, 779, 19, 791,
+    20, 804, 20, 816, 21, 829, 22, 842, 22, 854, 23, 867,
+    24, 879, 24, 892, 25, 904, 26, 917, 26, 929, 27, 942,
+    28, 955, 29, 967, 29, 980, 30, 992, 31, 1005, 32, 1017,
+    32, 1030, 33, 1042, 34, 1055, 35, 1067, 36, 1080, 36, 1092,
+    37, 1105, 38, 1118, 39, 1130, 40, 1143, 41, 1155, 42, 1168,
+    43, 1180, 43, 1193, 44, 1205, 45, 1218, 46, 1230, 47, 1243,
+    48, 1255, 49, 1268, 50, 1280, 51, 1293, 52, 1306, 53, 1318,
+    54, 1331, 55, 1343, 56, 1356, 57, 1368, 58, 1381, 59, 1393,
+    60, 1406, 61, 1418, 63, 1431, 64, 1443, 65, 1456, 66, 1468,
+    67, 1481, 68, 1493, 69, 1506, 71, 1518, 72, 1531, 73, 1543,
+    74, 1556, 75, 1568, 76, 1581, 78, 1593, 79, 1606, 80, 1618,
+    81, 1631, 83, 1643, 84, 1656, 85, 1668, 86, 1681, 88, 1693,
+    89, 1706, 90, 1718, 92, 1731, 93, 1743, 94, 1756, 96, 1768,
+    97, 1781, 98, 1793, 100, 1806, 101, 1818, 103, 1831, 104, 1843,
+    105, 1856, 107, 1868, 108, 1881, 110, 1893, 111, 1906, 113, 1918,
+    114, 1931, 116, 1943, 117, 1956, 119, 1968, 120, 1981, 122, 1993,
+    123, 2006, 125, 2018, 126, 2031, 128, 2043, 129, 2055, 131, 2068,
+    133, 2080, 134, 2093, 136, 2105, 137, 2118, 139, 2130, 141, 2143,
+    142, 2155, 144, 2168, 146, 2180, 147, 2193, 149, 2205, 151, 2217,
+    152, 2230, 154, 2242, 156, 2255, 158, 2267, 159, 2280, 161, 2292,
+    163, 2305, 165, 2317, 166, 2329, 168, 2342, 170, 2354, 172, 2367,
+    174, 2379, 175, 2392, 177, 2404, 179, 2416, 181, 2429, 183, 2441,
+    185, 2454, 187, 2466, 189, 2479, 190, 2491, 192, 2503, 194, 2516,
+    196, 2528, 198, 2541, 200, 2553, 202, 2566, 204, 2578, 206, 2590,
+    208, 2603, 210, 2615, 212, 2628, 214, 2640, 216, 2652, 218, 2665,
+    220, 2677, 222, 2690, 224, 2702, 226, 2714, 228, 2727, 231, 2739,
+    233, 2752, 235, 2764, 237, 2776, 239, 2789, 241, 2801, 243, 2813,
+    246, 2826, 248, 2838, 250, 2851, 252, 2863, 254, 2875, 256, 2888,
+    259, 2900, 261, 2912, 263, 2925, 265, 2937, 268, 2949, 270, 2962,
+    272, 2974, 275, 2987, 277, 2999, 279, 3011, 281, 3024, 284, 3036,
+    286, 3048, 288, 3061, 291, 3073, 293, 3085, 296, 3098, 298, 3110,
+    300, 3122, 303, 3135, 305, 3147, 308, 3159, 310, 3172, 312, 3184,
+    315, 3196, 317, 3209, 320, 3221, 322, 3233, 325, 3246, 327, 3258,
+    330, 3270, 332, 3283, 335, 3295, 337, 3307, 340, 3320, 342, 3332,
+    345, 3344, 347, 3356, 350, 3369, 353, 3381, 355, 3393, 358, 3406,
+    360, 3418, 363, 3430, 366, 3442, 368, 3455, 371, 3467, 374, 3479,
+    376, 3492, 379, 3504, 382, 3516, 384, 3528, 387, 3541, 390, 3553,
+    393, 3565, 395, 3577, 398, 3590, 401, 3602, 404, 3614, 406, 3627,
+    409, 3639, 412, 3651, 415, 3663, 418, 3676, 420, 3688, 423, 3700,
+    426, 3712, 429, 3724, 432, 3737, 435, 3749, 438, 3761, 440, 3773,
+    443, 3786, 446, 3798, 449, 3810, 452, 3822, 455, 3835, 458, 3847,
+    461, 3859, 464, 3871, 467, 3883, 470, 3896, 473, 3908, 476, 3920,
+    479, 3932, 482, 3944, 485, 3957, 488, 3969, 491, 3981, 494, 3993,
+    497, 4005, 500, 4018, 503, 4030, 506, 4042, 509, 4054, 513, 4066,
+    516, 4078, 519, 4091, 522, 4103, 525, 4115, 528, 4127, 531, 4139,
+    535, 4151, 538, 4164, 541, 4176, 544, 4188, 547, 4200, 551, 4212,
+    554, 4224, 557, 4236, 560, 4249, 564, 4261, 567, 4273, 570, 4285,
+    574, 4297, 577, 4309, 580, 4321, 583, 4333, 587, 4346, 590, 4358,
+    593, 4370, 597, 4382, 600, 4394, 604, 4406, 607, 4418, 610, 4430,
+    614, 4442, 617, 4455, 621, 4467, 624, 4479, 627, 4491, 631, 4503,
+    634, 4515, 638, 4527, 641, 4539, 645, 4551, 648, 4563, 652, 4575,
+    655, 4587, 659, 4599, 662, 4612, 666, 4624, 669, 4636, 673, 4648,
+    677, 4660, 680, 4672, 684, 4684, 687, 4696, 691, 4708, 695, 4720,
+    698, 4732, 702, 4744, 705, 4756, 709, 4768, 713, 4780, 716, 4792,
+    720, 4804, 724, 4816, 728, 4828, 731, 4840, 735, 4852, 739, 4864,
+    742, 4876, 746, 4888, 750, 4900, 754, 4912, 757, 4924, 761, 4936,
+    765, 4948, 769, 4960, 773, 4972, 776, 4984, 780, 4996, 784, 5008,
+    788, 5020, 792, 5032, 796, 5044, 800, 5056, 803, 5068, 807, 5080,
+    811, 5092, 815, 5104, 819, 5115, 823, 5127, 827, 5139, 831, 5151,
+    835, 5163, 839, 5175, 843, 5187, 847, 5199, 851, 5211, 855, 5223,
+    859, 5235, 863, 5247, 867, 5259, 871, 5270, 875, 5282, 879, 5294,
+    883, 5306, 887, 5318, 891, 5330, 895, 5342, 899, 5354, 903, 5366,
+    908, 5377, 912, 5389, 916, 5401, 920, 5413, 924, 5425, 928, 5437,
+    933, 5449, 937, 5460, 941, 5472, 945, 5484, 949, 5496, 954, 5508,
+    958, 5520, 962, 5531, 966, 5543, 970, 5555, 975, 5567, 979, 5579,
+    983, 5591, 988, 5602, 992, 5614, 996, 5626, 1001, 5638, 1005, 5650,
+    1009, 5661, 1014, 5673, 1018, 5685, 1022, 5697, 1027, 5708, 1031, 5720,
+    1035, 5732, 1040, 5744, 1044, 5756, 1049, 5767, 1053, 5779, 1058, 5791,
+    1062, 5803, 1066, 5814, 1071, 5826, 1075, 5838, 1080, 5850, 1084, 5861,
+    1089, 5873, 1093, 5885, 1098, 5897, 1102, 5908, 1107, 5920, 1111, 5932,
+    1116, 5943, 1121, 5955, 1125, 5967, 1130, 5979, 1134, 5990, 1139, 6002,
+    1144, 6014, 1148, 6025, 1153, 6037, 1157, 6049, 1162, 6060, 1167, 6072,
+    1171, 6084, 1176, 6095, 1181, 6107, 1185, 6119, 1190, 6130, 1195, 6142,
+    1200, 6154, 1204, 6165, 1209, 6177, 1214, 6189, 1218, 6200, 1223, 6212,
+    1228, 6223, 1233, 6235, 1238, 6247, 1242, 6258, 1247, 6270, 1252, 6281,
+    1257, 6293, 1262, 6305, 1266, 6316, 1271, 6328, 1276, 6339, 1281, 6351,
+    1286, 6363, 1291, 6374, 1296, 6386, 1301, 6397, 1306, 6409, 1310, 6420,
+    1315, 6432, 1320, 6444, 1325, 6455, 1330, 6467, 1335, 6478, 1340, 6490,
+    1345, 6501, 1350, 6513, 1355, 6524, 1360, 6536, 1365, 6547, 1370, 6559,
+    1375, 6570, 1380, 6582, 1385, 6593, 1390, 6605, 1395, 6616, 1400, 6628,
+    1406, 6639, 1411, 6651, 1416, 6662, 1421, 6674, 1426, 6685, 1431, 6697,
+    1436, 6708, 1441, 6720, 1447, 6731, 1452, 6743, 1457, 6754, 1462, 6766,
+    1467, 6777, 1473, 6788, 1478, 6800, 1483, 6811, 1488, 6823, 1493, 6834,
+    1499, 6846, 1504, 6857, 1509, 6868, 1514, 6880, 1520, 6891, 1525, 6903,
+    1530, 6914, 1536, 6925, 1541, 6937, 1546, 6948, 1552, 6960, 1557, 6971,
+    1562, 6982, 1568, 6994, 1573, 7005, 1578, 7016, 1584, 7028, 1589, 7039,
+    1595, 7050, 1600, 7062, 1605, 7073, 1611, 7084, 1616, 7096, 1622, 7107,
+    1627, 7118, 1633, 7130, 1638, 7141, 1644, 7152, 1649, 7164, 1655, 7175,
+    1660, 7186, 1666, 7198, 1671, 7209, 1677, 7220, 1682, 7231, 1688, 7243,
+    1693, 7254, 1699, 7265, 1704, 7276, 1710, 7288, 1716, 7299, 1721, 7310,
+    1727, 7321, 1733, 7333, 1738, 7344, 1744, 7355, 1749, 7366, 1755, 7378,
+    1761, 7389, 1766, 7400, 1772, 7411, 1778, 7423, 1783, 7434, 1789, 7445,
+    1795, 7456, 1801, 7467, 1806, 7478, 1812, 7490, 1818, 7501, 1824, 7512,
+    1829, 7523, 1835, 7534, 1841, 7545, 1847, 7557, 1853, 7568, 1858, 7579,
+    1864, 7590, 1870, 7601, 1876, 7612, 1882, 7623, 1887, 7635, 1893, 7646,
+    1899, 7657, 1905, 7668, 1911, 7679, 1917, 7690, 1923, 7701, 1929, 7712,
+    1935, 7723, 1941, 7734, 1946, 7746, 1952, 7757, 1958, 7768, 1964, 7779,
+    1970, 7790, 1976, 7801, 1982, 7812, 1988, 7823, 1994, 7834, 2000, 7845,
+    2006, 7856, 2012, 7867, 2018, 7878, 2024, 7889, 2030, 7900, 2037, 7911,
+    2043, 7922, 2049, 7933, 2055, 7944, 2061, 7955, 2067, 7966, 2073, 7977,
+    2079, 7988, 2085, 7999, 2091, 8010, 2098, 8021, 2104, 8032, 2110, 8043,
+    2116, 8054, 2122, 8065, 2128, 8076, 2135, 8087, 2141, 8098, 2147, 8108,
+    2153, 8119, 2160, 8130, 2166, 8141, 2172, 8152, 2178, 8163, 2185, 8174,
+    2191, 8185, 2197, 8196, 2203, 8207, 2210, 8217, 2216, 8228, 2222, 8239,
+    2229, 8250, 2235, 8261, 2241, 8272, 2248, 8283, 2254, 8293, 2260, 8304,
+    2267, 8315, 2273, 8326, 2280, 8337, 2286, 8347, 2292, 8358, 2299, 8369,
+    2305, 8380, 2312, 8391, 2318, 8401, 2325, 8412, 2331, 8423, 2337, 8434,
+    2344, 8445, 2350, 8455, 2357, 8466, 2363, 8477, 2370, 8488, 2376, 8498,
+    2383, 8509, 2389, 8520, 2396, 8531, 2403, 8541, 2409, 8552, 2416, 8563,
+    2422, 8573, 2429, 8584, 2435, 8595, 2442, 8606, 2449, 8616, 2455, 8627,
+    2462, 8638, 2468, 8648, 2475, 8659, 2482, 8670, 2488, 8680, 2495, 8691,
+    2502, 8702, 2508, 8712, 2515, 8723, 2522, 8734, 2528, 8744, 2535, 8755,
+    2542, 8765, 2549, 8776, 2555, 8787, 2562, 8797, 2569, 8808, 2576, 8818,
+    2582, 8829, 2589, 8840, 2596, 8850, 2603, 8861, 2610, 8871, 2616, 8882,
+    2623, 8892, 2630, 8903, 2637, 8914, 2644, 8924, 2651, 8935, 2657, 8945,
+    2664, 8956, 2671, 8966, 2678, 8977, 2685, 8987, 2692, 8998, 2699, 9008,
+    2706, 9019, 2713, 9029, 2719, 9040, 2726, 9050, 2733, 9061, 2740, 9071,
+    2747, 9082, 2754, 9092, 2761, 9102, 2768, 9113, 2775, 9123, 2782, 9134,
+    2789, 9144, 2796, 9155, 2803, 9165, 2810, 9175, 2817, 9186, 2824, 9196,
+    2831, 9207, 2838, 9217, 2846, 9227, 2853, 9238, 2860, 9248, 2867, 9259,
+    2874, 9269, 2881, 9279, 2888, 9290, 2895, 9300, 2902, 9310, 2910, 9321,
+    2917, 9331, 2924, 9341, 2931, 9352, 2938, 9362, 2945, 9372, 2953, 9383,
+    2960, 9393, 2967, 9403, 2974, 9413, 2981, 9424, 2989, 9434, 2996, 9444,
+    3003, 9455, 3010, 9465, 3018, 9475, 3025, 9485, 3032, 9496, 3040, 9506,
+    3047, 9516, 3054, 9526, 3061, 9537, 3069, 9547, 3076, 9557, 3083, 9567,
+    3091, 9577, 3098, 9588, 3105, 9598, 3113, 9608, 3120, 9618, 3128, 9628,
+    3135, 9638, 3142, 9649, 3150, 9659, 3157, 9669, 3165, 9679, 3172, 9689,
+    3179, 9699, 3187, 9709, 3194, 9720, 3202, 9730, 3209, 9740, 3217, 9750,
+    3224, 9760, 3232, 9770, 3239, 9780, 3247, 9790, 3254, 9800, 3262, 9810,
+    3269, 9820, 3277, 9830, 3284, 9841, 3292, 9851, 3299, 9861, 3307, 9871,
+    3315, 9881, 3322, 9891, 3330, 9901, 3337, 9911, 3345, 9921, 3353, 9931,
+    3360, 9941, 3368, 9951, 3376, 9961, 3383, 9971, 3391, 9981, 3398, 9991,
+    3406, 10001, 3414, 10010, 3421, 10020, 3429, 10030, 3437, 10040, 3445, 10050,
+    3452, 10060, 3460, 10070, 3468, 10080, 3475, 10090, 3483, 10100, 3491, 10110,
+    3499, 10120, 3506, 10129, 3514, 10139, 3522, 10149, 3530, 10159, 3538, 10169,
+    3545, 10179, 3553, 10189, 3561, 10198, 3569, 10208, 3577, 10218, 3585, 10228,
+    3592, 10238, 3600, 10248, 3608, 10257, 3616, 10267, 3624, 10277, 3632, 10287,
+    3640, 10296, 3648, 10306, 3655, 10316, 3663, 10326, 3671, 10336, 3679, 10345,
+    3687, 10355, 3695, 10365, 3703, 10374, 3711, 10384, 3719, 10394, 3727, 10404,
+    3735, 10413, 3743, 10423, 3751, 10433, 3759, 10442, 3767, 10452, 3775, 10462,
+    3783, 10471, 3791, 10481, 3799, 10491, 3807, 10500, 3815, 10510, 3823, 10520,
+    3831, 10529, 3839, 10539, 3847, 10549, 3856, 10558, 3864, 10568, 3872, 10577,
+    3880, 10587, 3888, 10597, 3896, 10606, 3904, 10616, 3912, 10625, 3921, 10635,
+    3929, 10644, 3937, 10654, 3945, 10663, 3953, 10673, 3961, 10683, 3970, 10692,
+    3978, 10702, 3986, 10711, 3994, 10721, 4003, 10730, 4011, 10740, 4019, 10749,
+    4027, 10759, 4036, 10768, 4044, 10778, 4052, 10787, 4060, 10796, 4069, 10806,
+    4077, 10815, 4085, 10825, 4094, 10834, 4102, 10844, 4110, 10853, 4118, 10862,
+    4127, 10872, 4135, 10881, 4144, 10891, 4152, 10900, 4160, 10909, 4169, 10919,
+    4177, 10928, 4185, 10937, 4194, 10947, 4202, 10956, 4211, 10966, 4219, 10975,
+    4227, 10984, 4236, 10994, 4244, 11003, 4253, 11012, 4261, 11021, 4270, 11031,
+    4278, 11040, 4287, 11049, 4295, 11059, 4304, 11068, 4312, 11077, 4320, 11086,
+    4329, 11096, 4338, 11105, 4346, 11114, 4355, 11123, 4363, 11133, 4372, 11142,
+    4380, 11151, 4389, 11160, 4397, 11169, 4406, 11179, 4414, 11188, 4423, 11197,
+    4432, 11206, 4440, 11215, 4449, 11224, 4457, 11234, 4466, 11243, 4475, 11252,
+    4483, 11261, 4492, 11270, 4501, 11279, 4509, 11288, 4518, 11297, 4527, 11307,
+    4535, 11316, 4544, 11325, 4553, 11334, 4561, 11343, 4570, 11352, 4579, 11361,
+    4587, 11370, 4596, 11379, 4605, 11388, 4614, 11397, 4622, 11406, 4631, 11415,
+    4640, 11424, 4649, 11433, 4657, 11442, 4666, 11451, 4675, 11460, 4684, 11469,
+    4693, 11478, 4701, 11487, 4710, 11496, 4719, 11505, 4728, 11514, 4737, 11523,
+    4746, 11532, 4754, 11541, 4763, 11550, 4772, 11559, 4781, 11567, 4790, 11576,
+    4799, 11585, 4808, 11594, 4817, 11603, 4825, 11612, 4834, 11621, 4843, 11630,
+    4852, 11638, 4861, 11647, 4870, 11656, 4879, 11665, 4888, 11674, 4897, 11683,
+    4906, 11691, 4915, 11700, 4924, 11709, 4933, 11718, 4942, 11727, 4951, 11735,
+    4960, 11744, 4969, 11753, 4978, 11762, 4987, 11770, 4996, 11779, 5005, 11788,
+    5014, 11797, 5023, 11805, 5032, 11814, 5041, 11823, 5050, 11831, 5059, 11840,
+    5068, 11849, 5077, 11857, 5087, 11866, 5096, 11875, 5105, 11883, 5114, 11892,
+    5123, 11901, 5132, 11909, 5141, 11918, 5150, 11927, 5160, 11935, 5169, 11944,
+    5178, 11952, 5187, 11961, 5196, 11970, 5205, 11978, 5215, 11987, 5224, 11995,
+    5233, 12004, 5242, 12012, 5251, 12021, 5261, 12029, 5270, 12038, 5279, 12046,
+    5288, 12055, 5298, 12064, 5307, 12072, 5316, 12080, 5325, 12089, 5335, 12097,
+    5344, 12106, 5353, 12114, 5363, 12123, 5372, 12131, 5381, 12140, 5390, 12148,
+    5400, 12157, 5409, 12165, 5418, 12173, 5428, 12182, 5437, 12190, 5447, 12199,
+    5456, 12207, 5465, 12215, 5475, 12224, 5484, 12232, 5493, 12240, 5503, 12249,
+    5512, 12257, 5522, 12266, 5531, 12274, 5540, 12282, 5550, 12290, 5559, 12299,
+    5569, 12307, 5578, 12315, 5588, 12324, 5597, 12332, 5606, 12340, 5616, 12348,
+    5625, 12357, 5635, 12365, 5644, 12373, 5654, 12381, 5663, 12390, 5673, 12398,
+    5682, 12406, 5692, 12414, 5701, 12423, 5711, 12431, 5721, 12439, 5730, 12447,
+    5740, 12455, 5749, 12463, 5759, 12472, 5768, 12480, 5778, 12488, 5787, 12496,
+    5797, 12504, 5807, 12512, 5816, 12520, 5826, 12528, 5835, 12537, 5845, 12545,
+    5855, 12553, 5864, 12561, 5874, 12569, 5884, 12577, 5893, 12585, 5903, 12593,
+    5913, 12601, 5922, 12609, 5932, 12617, 5942, 12625, 5951, 12633, 5961, 12641,
+    5971, 12649, 5980, 12657, 5990, 12665, 6000, 12673, 6010, 12681, 6019, 12689,
+    6029, 12697, 6039, 12705, 6048, 12713, 6058, 12721, 6068, 12729, 6078, 12736,
+    6088, 12744, 6097, 12752, 6107, 12760, 6117, 12768, 6127, 12776, 6136, 12784,
+    6146, 12792, 6156, 12799, 6166, 12807, 6176, 12815, 6186, 12823, 6195, 12831,
+    6205, 12839, 6215, 12846, 6225, 12854, 6235, 12862, 6245, 12870, 6255, 12878,
+    6264, 12885, 6274, 12893, 6284, 12901, 6294, 12909, 6304, 12916, 6314, 12924,
+    6324, 12932, 6334, 12939, 6344, 12947, 6354, 12955, 6364, 12963, 6374, 12970,
+    6383, 12978, 6393, 12986, 6403, 12993, 6413, 13001, 6423, 13008, 6433, 13016,
+    6443, 13024, 6453, 13031, 6463, 13039, 6473, 13047, 6483, 13054, 6493, 13062,
+    6503, 13069, 6513, 13077, 6523, 13085, 6533, 13092, 6543, 13100, 6554, 13107,
+    6564, 13115, 6574, 13122, 6584, 13130, 6594, 13137, 6604, 13145, 6614, 13152,
+    6624, 13160, 6634, 13167, 6644, 13175, 6654, 13182, 6664, 13190, 6675, 13197,
+    6685, 13205, 6695, 13212, 6705, 13219, 6715, 13227, 6725, 13234, 6735, 13242,
+    6746, 13249, 6756, 13256, 6766, 13264, 6776, 13271, 6786, 13279, 6796, 13286,
+    6807, 13293, 6817, 13301, 6827, 13308, 6837, 13315, 6847, 13323, 6858, 13330,
+    6868, 13337, 6878, 13344, 6888, 13352, 6899, 13359, 6909, 13366, 6919, 13374,
+    6929, 13381, 6940, 13388, 6950, 13395, 6960, 13403, 6971, 13410, 6981, 13417,
+    6991, 13424, 7001, 13431, 7012, 13439, 7022, 13446, 7032, 13453, 7043, 13460,
+    7053, 13467, 7063, 13474, 7074, 13482, 7084, 13489, 7094, 13496, 7105, 13503,
+    7115, 13510, 7125, 13517, 7136, 13524, 7146, 13531, 7157, 13538, 7167, 13546,
+    7177, 13553, 7188, 13560, 7198, 13567, 7209, 13574, 7219, 13581, 7229, 13588,
+    7240, 13595, 7250, 13602, 7261, 13609, 7271, 13616, 7282, 13623, 7292, 13630,
+    7302, 13637, 7313, 13644, 7323, 13651, 7334, 13658, 7344, 13665, 7355, 13671,
+    7365, 13678, 7376, 13685, 7386, 13692, 7397, 13699, 7407, 13706, 7418, 13713,
+    7428, 13720, 7439, 13727, 7449, 13733, 7460, 13740, 7470, 13747, 7481, 13754,
+    7492, 13761, 7502, 13768, 7513, 13774, 7523, 13781, 7534, 13788, 7544, 13795,
+    7555, 13802, 7566, 13808, 7576, 13815, 7587, 13822, 7597, 13829, 7608, 13835,
+    7619, 13842, 7629, 13849, 7640, 13856, 7650, 13862, 7661, 13869, 7672, 13876,
+    7682, 13882, 7693, 13889, 7704, 13896, 7714, 13902, 7725, 13909, 7736, 13916,
+    7746, 13922, 7757, 13929, 7768, 13935, 7778, 13942, 7789, 13949, 7800, 13955,
+    7811, 13962, 7821, 13968, 7832, 13975, 7843, 13981, 7853, 13988, 7864, 13995,
+    7875, 14001, 7886, 14008, 7896, 14014, 7907, 14021, 7918, 14027, 7929, 14034,
+    7939, 14040, 7950, 14047, 7961, 14053, 7972, 14059, 7983, 14066, 7993, 14072,
+    8004, 14079, 8015, 14085, 8026, 14092, 8037, 14098, 8047, 14104, 8058, 14111,
+    8069, 14117, 8080, 14124, 8091, 14130, 8101, 14136, 8112, 14143, 8123, 14149,
+    8134, 14155, 8145, 14162, 8156, 14168, 8167, 14174, 8177, 14181, 8188, 14187,
+    8199, 14193, 8210, 14199, 8221, 14206, 8232, 14212, 8243, 14218, 8254, 14224,
+    8265, 14231, 8276, 14237, 8286, 14243, 8297, 14249, 8308, 14256, 8319, 14262,
+    8330, 14268, 8341, 14274, 8352, 14280, 8363, 14286, 8374, 14293, 8385, 14299,
+    8396, 14305, 8407, 14311, 8418, 14317, 8429, 14323, 8440, 14329, 8451, 14335,
+    8462, 14341, 8473, 14347, 8484, 14354, 8495, 14360, 8506, 14366, 8517, 14372,
+    8528, 14378, 8539, 14384, 8550, 14390, 8561, 14396, 8572, 14402, 8583, 14408,
+    8594, 14414, 8605, 14420, 8616, 14426, 8627, 14432, 8638, 14438, 8650, 14443,
+    8661, 14449, 8672, 14455, 8683, 14461, 8694, 14467, 8705, 14473, 8716, 14479,
+    8727, 14485, 8738, 14491, 8749, 14497, 8761, 14502, 8772, 14508, 8783, 14514,
+    8794, 14520, 8805, 14526, 8816, 14531, 8827, 14537, 8839, 14543, 8850, 14549,
+    8861, 14555, 8872, 14560, 8883, 14566, 8894, 14572, 8906, 14578, 8917, 14583,
+    8928, 14589, 8939, 14595, 8950, 14601, 8961, 14606, 8973, 14612, 8984, 14618,
+    8995, 14623, 9006, 14629, 9018, 14635, 9029, 14640, 9040, 14646, 9051, 14651,
+    9063, 14657, 9074, 14663, 9085, 14668, 9096, 14674, 9108, 14680, 9119, 14685,
+    9130, 14691, 9141, 14696, 9153, 14702, 9164, 14707, 9175, 14713, 9186, 14718,
+    9198, 14724, 9209, 14729, 9220, 14735, 9232, 14740, 9243, 14746, 9254, 14751,
+    9266, 14757, 9277, 14762, 9288, 14768, 9300, 14773, 9311, 14779, 9322, 14784,
+    9334, 14789, 9345, 14795, 9356, 14800, 9368, 14806, 9379, 14811, 9390, 14816,
+    9402, 14822, 9413, 14827, 9424, 14832, 9436, 14838, 9447, 14843, 9459, 14848,
+    9470, 14854, 9481, 14859, 9493, 14864, 9504, 14870, 9516, 14875, 9527, 14880,
+    9538, 14885, 9550, 14891, 9561, 14896, 9573, 14901, 9584, 14906, 9596, 14911,
+    9607, 14917, 9618, 14922, 9630, 14927, 9641, 14932, 9653, 14937, 9664, 14943,
+    9676, 14948, 9687, 14953, 9699, 14958, 9710, 14963, 9722, 14968, 9733, 14973,
+    9745, 14978, 9756, 14984, 9768, 14989, 9779, 14994, 9791, 14999, 9802, 15004,
+    9814, 15009, 9825, 15014, 9837, 15019, 9848, 15024, 9860, 15029, 9871, 15034,
+    9883, 15039, 9894, 15044, 9906, 15049, 9917, 15054, 9929, 15059, 9940, 15064,
+    9952, 15069, 9964, 15074, 9975, 15078, 9987, 15083, 9998, 15088, 10010, 15093,
+    10021, 15098, 10033, 15103, 10045, 15108, 10056, 15113, 10068, 15118, 10079, 15122,
+    10091, 15127, 10103, 15132, 10114, 15137, 10126, 15142, 10137, 15146, 10149, 15151,
+    10161, 15156, 10172, 15161, 10184, 15166, 10195, 15170, 10207, 15175, 10219, 15180,
+    10230, 15184, 10242, 15189, 10254, 15194, 10265, 15199, 10277, 15203, 10289, 15208,
+    10300, 15213, 10312, 15217, 10324, 15222, 10335, 15227, 10347, 15231, 10359, 15236,
+    10370, 15240, 10382, 15245, 10394, 15250, 10405, 15254, 10417, 15259, 10429, 15263,
+    10441, 15268, 10452, 15273, 10464, 15277, 10476, 15282, 10487, 15286, 10499, 15291,
+    10511, 15295, 10523, 15300, 10534, 15304, 10546, 15309, 10558, 15313, 10570, 15318,
+    10581, 15322, 10593, 15326, 10605, 15331, 10617, 15335, 10628, 15340, 10640, 15344,
+    10652, 15349, 10664, 15353, 10676, 15357, 10687, 15362, 10699, 15366, 10711, 15370,
+    10723, 15375, 10734, 15379, 10746, 15383, 10758, 15388, 10770, 15392, 10782, 15396,
+    10793, 15401, 10805, 15405, 10817, 15409, 10829, 15414, 10841, 15418, 10853, 15422,
+    10864, 15426, 10876, 15430, 10888, 15435, 10900, 15439, 10912, 15443, 10924, 15447,
+    10935, 15451, 10947, 15456, 10959, 15460, 10971, 15464, 10983, 15468, 10995, 15472,
+    11007, 15476, 11018, 15481, 11030, 15485, 11042, 15489, 11054, 15493, 11066, 15497,
+    11078, 15501, 11090, 15505, 11102, 15509, 11114, 15513, 11125, 15517, 11137, 15521,
+    11149, 15525, 11161, 15529, 11173, 15533, 11185, 15537, 11197, 15541, 11209, 15545,
+    11221, 15549, 11233, 15553, 11245, 15557, 11257, 15561, 11269, 15565, 11280, 15569,
+    11292, 15573, 11304, 15577, 11316, 15581, 11328, 15584, 11340, 15588, 11352, 15592,
+    11364, 15596, 11376, 15600, 11388, 15604, 11400, 15608, 11412, 15611, 11424, 15615,
+    11436, 15619, 11448, 15623, 11460, 15627, 11472, 15630, 11484, 15634, 11496, 15638,
+    11508, 15642, 11520, 15645, 11532, 15649, 11544, 15653, 11556, 15656, 11568, 15660,
+    11580, 15664, 11592, 15668, 11604, 15671, 11616, 15675, 11628, 15679, 11640, 15682,
+    11652, 15686, 11664, 15689, 11676, 15693, 11688, 15697, 11700, 15700, 11712, 15704,
+    11724, 15707, 11736, 15711, 11748, 15715, 11760, 15718, 11772, 15722, 11785, 15725,
+    11797, 15729, 11809, 15732, 11821, 15736, 11833, 15739, 11845, 15743, 11857, 15746,
+    11869, 15750, 11881, 15753, 11893, 15757, 11905, 15760, 11917, 15763, 11929, 15767,
+    11942, 15770, 11954, 15774, 11966, 15777, 11978, 15780, 11990, 15784, 12002, 15787,
+    12014, 15791, 12026, 15794, 12038, 15797, 12051, 15801, 12063, 15804, 12075, 15807,
+    12087, 15810, 12099, 15814, 12111, 15817, 12123, 15820, 12135, 15824, 12148, 15827,
+    12160, 15830, 12172, 15833, 12184, 15837, 12196, 15840, 12208, 15843, 12220, 15846,
+    12233, 15849, 12245, 15853, 12257, 15856, 12269, 15859, 12281, 15862, 12293, 15865,
+    12306, 15868, 12318, 15871, 12330, 15875, 12342, 15878, 12354, 15881, 12366, 15884,
+    12379, 15887, 12391, 15890, 12403, 15893, 12415, 15896, 12427, 15899, 12440, 15902,
+    12452, 15905, 12464, 15908, 12476, 15911, 12488, 15914, 12501, 15917, 12513, 15920,
+    12525, 15923, 12537, 15926, 12549, 15929, 12562, 15932, 12574, 15935, 12586, 15938,
+    12598, 15941, 12611, 15944, 12623, 15946, 12635, 15949, 12647, 15952, 12660, 15955,
+    12672, 15958, 12684, 15961, 12696, 15964, 12708, 15966, 12721, 15969, 12733, 15972,
+    12745, 15975, 12757, 15978, 12770, 15980, 12782, 15983, 12794, 15986, 12807, 15989,
+    12819, 15991, 12831, 15994, 12843, 15997, 12856, 16000, 12868, 16002, 12880, 16005,
+    12892, 16008, 12905, 16010, 12917, 16013, 12929, 16016, 12942, 16018, 12954, 16021,
+    12966, 16024, 12978, 16026, 12991, 16029, 13003, 16031, 13015, 16034, 13028, 16037,
+    13040, 16039, 13052, 16042, 13064, 16044, 13077, 16047, 13089, 16049, 13101, 16052,
+    13114, 16054, 13126, 16057, 13138, 16059, 13151, 16062, 13163, 16064, 13175, 16067,
+    13188, 16069, 13200, 16072, 13212, 16074, 13225, 16076, 13237, 16079, 13249, 16081,
+    13262, 16084, 13274, 16086, 13286, 16088, 13299, 16091, 13311, 16093, 13323, 16096,
+    13336, 16098, 13348, 16100, 13360, 16103, 13373, 16105, 13385, 16107, 13397, 16109,
+    13410, 16112, 13422, 16114, 13435, 16116, 13447, 16119, 13459, 16121, 13472, 16123,
+    13484, 16125, 13496, 16128, 13509, 16130, 13521, 16132, 13533, 16134, 13546, 16136,
+    13558, 16138, 13571, 16141, 13583, 16143, 13595, 16145, 13608, 16147, 13620, 16149,
+    13632, 16151, 13645, 16153, 13657, 16156, 13670, 16158, 13682, 16160, 13694, 16162,
+    13707, 16164, 13719, 16166, 13732, 16168, 13744, 16170, 13756, 16172, 13769, 16174,
+    13781, 16176, 13794, 16178, 13806, 16180, 13818, 16182, 13831, 16184, 13843, 16186,
+    13856, 16188, 13868, 16190, 13881, 16192, 13893, 16194, 13905, 16195, 13918, 16197,
+    13930, 16199, 13943, 16201, 13955, 16203, 13968, 16205, 13980, 16207, 13992, 16209,
+    14005, 16210, 14017, 16212, 14030, 16214, 14042, 16216, 14055, 16218, 14067, 16219,
+    14079, 16221, 14092, 16223, 14104, 16225, 14117, 16226, 14129, 16228, 14142, 16230,
+    14154, 16232, 14167, 16233, 14179, 16235, 14191, 16237, 14204, 16238, 14216, 16240,
+    14229, 16242, 14241, 16243, 14254, 16245, 14266, 16247, 14279, 16248, 14291, 16250,
+    14304, 16251, 14316, 16253, 14329, 16255, 14341, 16256, 14353, 16258, 14366, 16259,
+    14378, 16261, 14391, 16262, 14403, 16264, 14416, 16265, 14428, 16267, 14441, 16268,
+    14453, 16270, 14466, 16271, 14478, 16273, 14491, 16274, 14503, 16276, 14516, 16277,
+    14528, 16279, 14541, 16280, 14553, 16281, 14566, 16283, 14578, 16284, 14591, 16286,
+    14603, 16287, 14616, 16288, 14628, 16290, 14641, 16291, 14653, 16292, 14666, 16294,
+    14678, 16295, 14691, 16296, 14703, 16298, 14716, 16299, 14728, 16300, 14741, 16301,
+    14753, 16303, 14766, 16304, 14778, 16305, 14791, 16306, 14803, 16308, 14816, 16309,
+    14828, 16310, 14841, 16311, 14853, 16312, 14866, 16313, 14878, 16315, 14891, 16316,
+    14903, 16317, 14916, 16318, 14928, 16319, 14941, 16320, 14953, 16321, 14966, 16323,
+    14978, 16324, 14991, 16325, 15003, 16326, 15016, 16327, 15028, 16328, 15041, 16329,
+    15053, 16330, 15066, 16331, 15078, 16332, 15091, 16333, 15104, 16334, 15116, 16335,
+    15129, 16336, 15141, 16337, 15154, 16338, 15166, 16339, 15179, 16340, 15191, 16341,
+    15204, 16341, 15216, 16342, 15229, 16343, 15241, 16344, 15254, 16345, 15266, 16346,
+    15279, 16347, 15292, 16348, 15304, 16348, 15317, 16349, 15329, 16350, 15342, 16351,
+    15354, 16352, 15367, 16352, 15379, 16353, 15392, 16354, 15404, 16355, 15417, 16355,
+    15429, 16356, 15442, 16357, 15455, 16358, 15467, 16358, 15480, 16359, 15492, 16360,
+    15505, 16360, 15517, 16361, 15530, 16362, 15542, 16362, 15555, 16363, 15568, 16364,
+    15580, 16364, 15593, 16365, 15605, 16365, 15618, 16366, 15630, 16367, 15643, 16367,
+    15655, 16368, 15668, 16368, 15680, 16369, 15693, 16369, 15706, 16370, 15718, 16370,
+    15731, 16371, 15743, 16371, 15756, 16372, 15768, 16372, 15781, 16373, 15794, 16373,
+    15806, 16374, 15819, 16374, 15831, 16375, 15844, 16375, 15856, 16375, 15869, 16376,
+    15881, 16376, 15894, 16377, 15907, 16377, 15919, 16377, 15932, 16378, 15944, 16378,
+    15957, 16378, 15969, 16379, 15982, 16379, 15994, 16379, 16007, 16380, 16020, 16380,
+    16032, 16380, 16045, 16380, 16057, 16381, 16070, 16381, 16082, 16381, 16095, 16381,
+    16108, 16382, 16120, 16382, 16133, 16382, 16145, 16382, 16158, 16382, 16170, 16383,
+    16183, 16383, 16196, 16383, 16208, 16383, 16221, 16383, 16233, 16383, 16246, 16383,
+    16258, 16384, 16271, 16384, 16283, 16384, 16296, 16384, 16309, 16384, 16321, 16384,
+    16334, 16384, 16346, 16384, 16359, 16384, 16371, 16384,
+};
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_REALCOEF_Q15)
+const q15_t realCoefBQ15[8192] = {
+    16384, 16384, 16397, 16384, 16409, 16384, 16422, 16384, 16434, 16384, 16447, 16384,
+    16459, 16384, 16472, 16384, 16485, 16384, 16497, 16384, 16510, 16384, 16522, 16383,
+    16535, 16383, 16547, 16383, 16560, 16383, 16572, 16383, 16585, 16383, 16598, 16383,
+    16610, 16382, 16623, 16382, 16635, 16382, 16648, 16382, 16660, 16382, 16673, 16381,
+    16686, 16381, 16698, 16381, 16711, 16381, 16723, 16380, 16736, 16380, 16748, 16380,
+    16761, 16380, 16774, 16379, 16786, 16379, 16799, 16379, 16811, 16378, 16824, 16378,
+    16836, 16378, 16849, 16377, 16861, 16377, 16874, 16377, 16887, 16376, 16899, 16376,
+    16912, 16375, 16924, 16375, 16937, 16375, 16949, 16374, 16962, 16374, 16974, 16373,
+    16987, 16373, 17000, 16372, 17012, 16372, 17025, 16371, 17037, 16371, 17050, 16370,
+    17062, 16370, 17075, 16369, 17088, 16369, 17100, 16368, 17113, 16368, 17125, 16367,
+    17138, 16367, 17150, 16366, 17163, 16365, 17175, 16365, 17188, 16364, 17200, 16364,
+    17213, 16363, 17226, 16362, 17238, 16362, 17251, 16361, 17263, 16360, 17276, 16360,
+    17288, 16359, 17301, 16358, 17313, 16358, 17326, 16357, 17339, 16356, 17351, 16355,
+    17364, 16355, 17376, 16354, 17389, 16353, 17401, 16352, 17414, 16352, 17426, 16351,
+    17439, 16350, 17451, 16349, 17464, 16348, 17476, 16348, 17489, 16347, 17502, 16346,
+    17514, 16345, 17527, 16344, 17539, 16343, 17552, 16342, 17564, 16341, 17577, 16341,
+    17589, 16340, 17602, 16339, 17614, 16338, 17627, 16337, 17639, 16336, 17652, 16335,
+    17664, 16334, 17677, 16333, 17690, 16332, 17702, 16331, 17715, 16330, 17727, 16329,
+    17740, 16328, 17752, 16327, 17765, 16326, 17777, 16325, 17790, 16324, 17802, 16323,
+    17815, 16321, 17827, 16320, 17840, 16319, 17852, 16318, 17865, 16317, 17877, 16316,
+    17890, 16315, 17902, 16313, 17915, 16312, 17927, 16311, 17940, 16310, 17952, 16309,
+    17965, 16308, 17977, 16306, 17990, 16305, 18002, 16304, 18015, 16303, 18027, 16301,
+    18040, 16300, 18052, 16299, 18065, 16298, 18077, 16296, 18090, 16295, 18102, 16294,
+    18115, 16292, 18127, 16291, 18140, 16290, 18152, 16288, 18165, 16287, 18177, 16286,
+    18190, 16284, 18202, 16283, 18215, 16281, 18227, 16280, 18240, 16279, 18252, 16277,
+    18265, 16276, 18277, 16274, 18290, 16273, 18302, 16271, 18315, 16270, 18327, 16268,
+    18340, 16267, 18352, 16265, 18365, 16264, 18377, 16262, 18390, 16261, 18402, 16259,
+    18415, 16258, 18427, 16256, 18439, 16255, 18452, 16253, 18464, 16251, 18477, 16250,
+    18489, 16248, 18502, 16247, 18514, 16245, 18527, 16243, 18539, 16242, 18552, 16240,
+    18564, 16238, 18577, 16237, 18589, 16235, 18601, 16233, 18614, 16232, 18626, 16230,
+    18639, 16228, 18651, 16226, 18664, 16225, 18676, 16223, 18689, 16221, 18701, 16219,
+    18713, 16218, 18726, 16216, 18738, 16214, 18751, 16212, 18763, 16210, 18776, 16209,
+    18788, 16207, 18800, 16205, 18813, 16203, 18825, 16201, 18838, 16199, 18850, 16197,
+    18863, 16195, 18875, 16194, 18887, 16192, 18900, 16190, 18912, 16188, 18925, 16186,
+    18937, 16184, 18950, 16182, 18962, 16180, 18974, 16178, 18987, 16176, 18999, 16174,
+    19012, 16172, 19024, 16170, 19036, 16168, 19049, 16166, 19061, 16164, 19074, 16162,
+    19086, 16160, 19098, 16158, 19111, 16156, 19123, 16153, 19136, 16151, 19148, 16149,
+    19160, 16147, 19173, 16145, 19185, 16143, 19197, 16141, 19210, 16138, 19222, 16136,
+    19235, 16134, 19247, 16132, 19259, 16130, 19272, 16128, 19284, 16125, 19296, 16123,
+    19309, 16121, 19321, 16119, 19333, 16116, 19346, 16114, 19358, 16112, 19371, 16109,
+    19383, 16107, 19395, 16105, 19408, 16103, 19420, 16100, 19432, 16098, 19445, 16096,
+    19457, 16093, 19469, 16091, 19482, 16088, 19494, 16086, 19506, 16084, 19519, 16081,
+    19531, 16079, 19543, 16076, 19556, 16074, 19568, 16072, 19580, 16069, 19593, 16067,
+    19605, 16064, 19617, 16062, 19630, 16059, 19642, 16057, 19654, 16054, 19667, 16052,
+    19679, 16049, 19691, 16047, 19704, 16044, 19716, 16042, 19728, 16039, 19740, 16037,
+    19753, 16034, 19765, 16031, 19777, 16029, 19790, 16026, 19802, 16024, 19814, 16021,
+    19826, 16018, 19839, 16016, 19851, 16013, 19863, 16010, 19876, 16008, 19888, 16005,
+    19900, 16002, 19912, 16000, 19925, 15997, 19937, 15994, 19949, 15991, 19961, 15989,
+    19974, 15986, 19986, 15983, 19998, 15980, 20011, 15978, 20023, 15975, 20035, 15972,
+    20047, 15969, 20060, 15966, 20072, 15964, 20084, 15961, 20096, 15958, 20108, 15955,
+    20121, 15952, 20133, 15949, 20145, 15946, 20157, 15944, 20170, 15941, 20182, 15938,
+    20194, 15935, 20206, 15932, 20219, 15929, 20231, 15926, 20243, 15923, 20255, 15920,
+    20267, 15917, 20280, 15914, 20292, 15911, 20304, 15908, 20316, 15905, 20328, 15902,
+    20341, 15899, 20353, 15896, 20365, 15893, 20377, 15890, 20389, 15887, 20402, 15884,
+    20414, 15881, 20426, 15878, 20438, 15875, 20450, 15871, 20462, 15868, 20475, 15865,
+    20487, 15862, 20499, 15859, 20511, 15856, 20523, 15853, 20535, 15849, 20548, 15846,
+    20560, 15843, 20572, 15840, 20584, 15837, 20596, 15833, 20608, 15830, 20620, 15827,
+    20633, 15824, 20645, 15820, 20657, 15817, 20669, 15814, 20681, 15810, 20693, 15807,
+    20705, 15804, 20717, 15801, 20730, 15797, 20742, 15794, 20754, 15791, 20766, 15787,
+    20778, 15784, 20790, 15780, 20802, 15777, 20814, 15774, 20826, 15770, 20839, 15767,
+    20851, 15763, 20863, 15760, 20875, 15757, 20887, 15753, 20899, 15750, 20911, 15746,
+    20923, 15743, 20935, 15739, 20947, 15736, 20959, 15732, 20971, 15729, 20983, 15725,
+    20996, 15722, 21008, 15718, 21020, 15715, 21032, 15711, 21044, 15707, 21056, 15704,
+    21068, 15700, 21080, 15697, 21092, 15693, 21104, 15689, 21116, 15686, 21128, 15682,
+    21140, 15679, 21152, 15675, 21164, 15671, 21176, 15668, 21188, 15664, 21200, 15660,
+    21212, 15656, 21224, 15653, 21236, 15649, 21248, 15645, 21260, 15642, 21272, 15638,
+    21284, 15634, 21296, 15630, 21308, 15627, 21320, 15623, 21332, 15619, 21344, 15615,
+    21356, 15611, 21368, 15608, 21380, 15604, 21392, 15600, 21404, 15596, 21416, 15592,
+    21428, 15588, 21440, 15584, 21452, 15581, 21464, 15577, 21476, 15573, 21488, 15569,
+    21499, 15565, 21511, 15561, 21523, 15557, 21535, 15553, 21547, 15549, 21559, 15545,
+    21571, 15541, 21583, 15537, 21595, 15533, 21607, 15529, 21619, 15525, 21631, 15521,
+    21643, 15517, 21654, 15513, 21666, 15509, 21678, 15505, 21690, 15501, 21702, 15497,
+    21714, 15493, 21726, 15489, 21738, 15485, 21750, 15481, 21761, 15476, 21773, 15472,
+    21785, 15468, 21797, 15464, 21809, 15460, 21821, 15456, 21833, 15451, 21844, 15447,
+    21856, 15443, 21868, 15439, 21880, 15435, 21892, 15430, 21904, 15426, 21915, 15422,
+    21927, 15418, 21939, 15414, 21951, 15409, 21963, 15405, 21975, 15401, 21986, 15396,
+    21998, 15392, 22010, 15388, 22022, 15383, 22034, 15379, 22045, 15375, 22057, 15370,
+    22069, 15366, 22081, 15362, 22092, 15357, 22104, 15353, 22116, 15349, 22128, 15344,
+    22140, 15340, 22151, 15335, 22163, 15331, 22175, 15326, 22187, 15322, 22198, 15318,
+    22210, 15313, 22222, 15309, 22234, 15304, 22245, 15300, 22257, 15295, 22269, 15291,
+    22281, 15286, 22292, 15282, 22304, 15277, 22316, 15273, 22327, 15268, 22339, 15263,
+    22351, 15259, 22363, 15254, 22374, 15250, 22386, 15245, 22398, 15240, 22409, 15236,
+    22421, 15231, 22433, 15227, 22444, 15222, 22456, 15217, 22468, 15213, 22479, 15208,
+    22491, 15203, 22503, 15199, 22514, 15194, 22526, 15189, 22538, 15184, 22549, 15180,
+    22561, 15175, 22573, 15170, 22584, 15166, 22596, 15161, 22607, 15156, 22619, 15151,
+    22631, 15146, 22642, 15142, 22654, 15137, 22665, 15132, 22677, 15127, 22689, 15122,
+    22700, 15118, 22712, 15113, 22723, 15108, 22735, 15103, 22747, 15098, 22758, 15093,
+    22770, 15088, 22781, 15083, 22793, 15078, 22804, 15074, 22816, 15069, 22828, 15064,
+    22839, 15059, 22851, 15054, 22862, 15049, 22874, 15044, 22885, 15039, 22897, 15034,
+    22908, 15029, 22920, 15024, 22931, 15019, 22943, 15014, 22954, 15009, 22966, 15004,
+    22977, 14999, 22989, 14994, 23000, 14989, 23012, 14984, 23023, 14978, 23035, 14973,
+    23046, 14968, 23058, 14963, 23069, 14958, 23081, 14953, 23092, 14948, 23104, 14943,
+    23115, 14937, 23127, 14932, 23138, 14927, 23150, 14922, 23161, 14917, 23172, 14911,
+    23184, 14906, 23195, 14901, 23207, 14896, 23218, 14891, 23230, 14885, 23241, 14880,
+    23252, 14875, 23264, 14870, 23275, 14864, 23287, 14859, 23298, 14854, 23309, 14848,
+    23321, 14843, 23332, 14838, 23344, 14832, 23355, 14827, 23366, 14822, 23378, 14816,
+    23389, 14811, 23400, 14806, 23412, 14800, 23423, 14795, 23434, 14789, 23446, 14784,
+    23457, 14779, 23468, 14773, 23480, 14768, 23491, 14762, 23502, 14757, 23514, 14751,
+    23525, 14746, 23536, 14740, 23548, 14735, 23559, 14729, 23570, 14724, 23582, 14718,
+    23593, 14713, 23604, 14707, 23615, 14702, 23627, 14696, 23638, 14691, 23649, 14685,
+    23660, 14680, 23672, 14674, 23683, 14668, 23694, 14663, 23705, 14657, 23717, 14651,
+    23728, 14646, 23739, 14640, 23750, 14635, 23762, 14629, 23773, 14623, 23784, 14618,
+    23795, 14612, 23807, 14606, 23818, 14601, 23829, 14595, 23840, 14589, 23851, 14583,
+    23862, 14578, 23874, 14572, 23885, 14566, 23896, 14560, 23907, 14555, 23918, 14549,
+    23929, 14543, 23941, 14537, 23952, 14531, 23963, 14526, 23974, 14520, 23985, 14514,
+    23996, 14508, 24007, 14502, 24019, 14497, 24030, 14491, 24041, 14485, 24052, 14479,
+    24063, 14473, 24074, 14467, 24085, 14461, 24096, 14455, 24107, 14449, 24118, 14443,
+    24130, 14438, 24141, 14432, 24152, 14426, 24163, 14420, 24174, 14414, 24185, 14408,
+    24196, 14402, 24207, 14396, 24218, 14390, 24229, 14384, 24240, 14378, 24251, 14372,
+    24262, 14366, 24273, 14360, 24284, 14354, 24295, 14347, 24306, 14341, 24317, 14335,
+    24328, 14329, 24339, 14323, 24350, 14317, 24361, 14311, 24372, 14305, 24383, 14299,
+    24394, 14293, 24405, 14286, 24416, 14280, 24427, 14274, 24438, 14268, 24449, 14262,
+    24460, 14256, 24471, 14249, 24482, 14243, 24492, 14237, 24503, 14231, 24514, 14224,
+    24525, 14218, 24536, 14212, 24547, 14206, 24558, 14199, 24569, 14193, 24580, 14187,
+    24591, 14181, 24601, 14174, 24612, 14168, 24623, 14162, 24634, 14155, 24645, 14149,
+    24656, 14143, 24667, 14136, 24677, 14130, 24688, 14124, 24699, 14117, 24710, 14111,
+    24721, 14104, 24731, 14098, 24742, 14092, 24753, 14085, 24764, 14079, 24775, 14072,
+    24785, 14066, 24796, 14059, 24807, 14053, 24818, 14047, 24829, 14040, 24839, 14034,
+    24850, 14027, 24861, 14021, 24872, 14014, 24882, 14008, 24893, 14001, 24904, 13995,
+    24915, 13988, 24925, 13981, 24936, 13975, 24947, 13968, 24957, 13962, 24968, 13955,
+    24979, 13949, 24990, 13942, 25000, 13935, 25011, 13929, 25022, 13922, 25032, 13916,
+    25043, 13909, 25054, 13902, 25064, 13896, 25075, 13889, 25086, 13882, 25096, 13876,
+    25107, 13869, 25118, 13862, 25128, 13856, 25139, 13849, 25149, 13842, 25160, 13835,
+    25171, 13829, 25181, 13822, 25192, 13815, 25202, 13808, 25213, 13802, 25224, 13795,
+    25234, 13788, 25245, 13781, 25255, 13774, 25266, 13768, 25276, 13761, 25287, 13754,
+    25298, 13747, 25308, 13740, 25319, 13733, 25329, 13727, 25340, 13720, 25350, 13713,
+    25361, 13706, 25371, 13699, 25382, 13692, 25392, 13685, 25403, 13678, 25413, 13671,
+    25424, 13665, 25434, 13658, 25445, 13651, 25455, 13644, 25466, 13637, 25476, 13630,
+    25486, 13623, 25497, 13616, 25507, 13609, 25518, 13602, 25528, 13595, 25539, 13588,
+    25549, 13581, 25559, 13574, 25570, 13567, 25580, 13560, 25591, 13553, 25601, 13546,
+    25611, 13538, 25622, 13531, 25632, 13524, 25643, 13517, 25653, 13510, 25663, 13503,
+    25674, 13496, 25684, 13489, 25694, 13482, 25705, 13474, 25715, 13467, 25725, 13460,
+    25736, 13453, 25746, 13446, 25756, 13439, 25767, 13431, 25777, 13424, 25787, 13417,
+    25797, 13410, 25808, 13403, 25818, 13395, 25828, 13388, 25839, 13381, 25849, 13374,
+    25859, 13366, 25869, 13359, 25880, 13352, 25890, 13344, 25900, 13337, 25910, 13330,
+    25921, 13323, 25931, 13315, 25941, 13308, 25951, 13301, 25961, 13293, 25972, 13286,
+    25982, 13279, 25992, 13271, 26002, 13264, 26012, 13256, 26022, 13249, 26033, 13242,
+    26043, 13234, 26053, 13227, 26063, 13219, 26073, 13212, 26083, 13205, 26093, 13197,
+    26104, 13190, 26114, 13182, 26124, 13175, 26134, 13167, 26144, 13160, 26154, 13152,
+    26164, 13145, 26174, 13137, 26184, 13130, 26194, 13122, 26204, 13115, 26214, 13107,
+    26225, 13100, 26235, 13092, 26245, 13085, 26255, 13077, 26265, 13069, 26275, 13062,
+    26285, 13054, 26295, 13047, 26305, 13039, 26315, 13031, 26325, 13024, 26335, 13016,
+    26345, 13008, 26355, 13001, 26365, 12993, 26375, 12986, 26385, 12978, 26394, 12970,
+    26404, 12963, 26414, 12955, 26424, 12947, 26434, 12939, 26444, 12932, 26454, 12924,
+    26464, 12916, 26474, 12909, 26484, 12901, 26494, 12893, 26504, 12885, 26513, 12878,
+    26523, 12870, 26533, 12862, 26543, 12854, 26553, 12846, 26563, 12839, 26573, 12831,
+    26582, 12823, 26592, 12815, 26602, 12807, 26612, 12799, 26622, 12792, 26632, 12784,
+    26641, 12776, 26651, 12768, 26661, 12760, 26671, 12752, 26680, 12744, 26690, 12736,
+    26700, 12729, 26710, 12721, 26720, 12713, 26729, 12705, 26739, 12697, 26749, 12689,
+    26758, 12681, 26768, 12673, 26778, 12665, 26788, 12657, 26797, 12649, 26807, 12641,
+    26817, 12633, 26826, 12625, 26836, 12617, 26846, 12609, 26855, 12601, 26865, 12593,
+    26875, 12585, 26884, 12577, 26894, 12569, 26904, 12561, 26913, 12553, 26923, 12545,
+    26933, 12537, 26942, 12528, 26952, 12520, 26961, 12512, 26971, 12504, 26981, 12496,
+    26990, 12488, 27000, 12480, 27009, 12472, 27019, 12463, 27028, 12455, 27038, 12447,
+    27047, 12439, 27057, 12431, 27067, 12423, 27076, 12414, 27086, 12406, 27095, 12398,
+    27105, 12390, 27114, 12381, 27124, 12373, 27133, 12365, 27143, 12357, 27152, 12348,
+    27162, 12340, 27171, 12332, 27180, 12324, 27190, 12315, 27199, 12307, 27209, 12299,
+    27218, 12290, 27228, 12282, 27237, 12274, 27246, 12266, 27256, 12257, 27265, 12249,
+    27275, 12240, 27284, 12232, 27293, 12224, 27303, 12215, 27312, 12207, 27321, 12199,
+    27331, 12190, 27340, 12182, 27350, 12173, 27359, 12165, 27368, 12157, 27378, 12148,
+    27387, 12140, 27396, 12131, 27405, 12123, 27415, 12114, 27424, 12106, 27433, 12097,
+    27443, 12089, 27452, 12080, 27461, 12072, 27470, 12064, 27480, 12055, 27489, 12046,
+    27498, 12038, 27507, 12029, 27517, 12021, 27526, 12012, 27535, 12004, 27544, 11995,
+    27553, 11987, 27563, 11978, 27572, 11970, 27581, 11961, 27590, 11952, 27599, 11944,
+    27608, 11935, 27618, 11927, 27627, 11918, 27636, 11909, 27645, 11901, 27654, 11892,
+    27663, 11883, 27672, 11875, 27681, 11866, 27691, 11857, 27700, 11849, 27709, 11840,
+    27718, 11831, 27727, 11823, 27736, 11814, 27745, 11805, 27754, 11797, 27763, 11788,
+    27772, 11779, 27781, 11770, 27790, 11762, 27799, 11753, 27808, 11744, 27817, 11735,
+    27826, 11727, 27835, 11718, 27844, 11709, 27853, 11700, 27862, 11691, 27871, 11683,
+    27880, 11674, 27889, 11665, 27898, 11656, 27907, 11647, 27916, 11638, 27925, 11630,
+    27934, 11621, 27943, 11612, 27951, 11603, 27960, 11594, 27969, 11585, 27978, 11576,
+    27987, 11567, 27996, 11559, 28005, 11550, 28014, 11541, 28022, 11532, 28031, 11523,
+    28040, 11514, 28049, 11505, 28058, 11496, 28067, 11487, 28075, 11478, 28084, 11469,
+    28093, 11460, 28102, 11451, 28111, 11442, 28119, 11433, 28128, 11424, 28137, 11415,
+    28146, 11406, 28154, 11397, 28163, 11388, 28172, 11379, 28181, 11370, 28189, 11361,
+    28198, 11352, 28207, 11343, 28215, 11334, 28224, 11325, 28233, 11316, 28241, 11307,
+    28250, 11297, 28259, 11288, 28267, 11279, 28276, 11270, 28285, 11261, 28293, 11252,
+    28302, 11243, 28311, 11234, 28319, 11224, 28328, 11215, 28336, 11206, 28345, 11197,
+    28354, 11188, 28362, 11179, 28371, 11169, 28379, 11160, 28388, 11151, 28396, 11142,
+    28405, 11133, 28413, 11123, 28422, 11114, 28430, 11105, 28439, 11096, 28448, 11086,
+    28456, 11077, 28464, 11068, 28473, 11059, 28481, 11049, 28490, 11040, 28498, 11031,
+    28507, 11021, 28515, 11012, 28524, 11003, 28532, 10994, 28541, 10984, 28549, 10975,
+    28557, 10966, 28566, 10956, 28574, 10947, 28583, 10937, 28591, 10928, 28599, 10919,
+    28608, 10909, 28616, 10900, 28624, 10891, 28633, 10881, 28641, 10872, 28650, 10862,
+    28658, 10853, 28666, 10844, 28674, 10834, 28683, 10825, 28691, 10815, 28699, 10806,
+    28708, 10796, 28716, 10787, 28724, 10778, 28732, 10768, 28741, 10759, 28749, 10749,
+    28757, 10740, 28765, 10730, 28774, 10721, 28782, 10711, 28790, 10702, 28798, 10692,
+    28807, 10683, 28815, 10673, 28823, 10663, 28831, 10654, 28839, 10644, 28847, 10635,
+    28856, 10625, 28864, 10616, 28872, 10606, 28880, 10597, 28888, 10587, 28896, 10577,
+    28904, 10568, 28912, 10558, 28921, 10549, 28929, 10539, 28937, 10529, 28945, 10520,
+    28953, 10510, 28961, 10500, 28969, 10491, 28977, 10481, 28985, 10471, 28993, 10462,
+    29001, 10452, 29009, 10442, 29017, 10433, 29025, 10423, 29033, 10413, 29041, 10404,
+    29049, 10394, 29057, 10384, 29065, 10374, 29073, 10365, 29081, 10355, 29089, 10345,
+    29097, 10336, 29105, 10326, 29113, 10316, 29120, 10306, 29128, 10296, 29136, 10287,
+    29144, 10277, 29152, 10267, 29160, 10257, 29168, 10248, 29176, 10238, 29183, 10228,
+    29191, 10218, 29199, 10208, 29207, 10198, 29215, 10189, 29223, 10179, 29230, 10169,
+    29238, 10159, 29246, 10149, 29254, 10139, 29262, 10129, 29269, 10120, 29277, 10110,
+    29285, 10100, 29293, 10090, 29300, 10080, 29308, 10070, 29316, 10060, 29323, 10050,
+    29331, 10040, 29339, 10030, 29347, 10020, 29354, 10010, 29362, 10001, 29370, 9991,
+    29377, 9981, 29385, 9971, 29392, 9961, 29400, 9951, 29408, 9941, 29415, 9931,
+    29423, 9921, 29431, 9911, 29438, 9901, 29446, 9891, 29453, 9881, 29461, 9871,
+    29469, 9861, 29476, 9851, 29484, 9841, 29491, 9830, 29499, 9820, 29506, 9810,
+    29514, 9800, 29521, 9790, 29529, 9780, 29536, 9770, 29544, 9760, 29551, 9750,
+    29559, 9740, 29566, 9730, 29574, 9720, 29581, 9709, 29589, 9699, 29596, 9689,
+    29603, 9679, 29611, 9669, 29618, 9659, 29626, 9649, 29633, 9638, 29640, 9628,
+    29648, 9618, 29655, 9608, 29663, 9598, 29670, 9588, 29677, 9577, 29685, 9567,
+    29692, 9557, 29699, 9547, 29707, 9537, 29714, 9526, 29721, 9516, 29728, 9506,
+    29736, 9496, 29743, 9485, 29750, 9475, 29758, 9465, 29765, 9455, 29772, 9444,
+    29779, 9434, 29787, 9424, 29794, 9413, 29801, 9403, 29808, 9393, 29815, 9383,
+    29823, 9372, 29830, 9362, 29837, 9352, 29844, 9341, 29851, 9331, 29858, 9321,
+    29866, 9310, 29873, 9300, 29880, 9290, 29887, 9279, 29894, 9269, 29901, 9259,
+    29908, 9248, 29915, 9238, 29922, 9227, 29930, 9217, 29937, 9207, 29944, 9196,
+    29951, 9186, 29958, 9175, 29965, 9165, 29972, 9155, 29979, 9144, 29986, 9134,
+    29993, 9123, 30000, 9113, 30007, 9102, 30014, 9092, 30021, 9082, 30028, 9071,
+    30035, 9061, 30042, 9050, 30049, 9040, 30055, 9029, 30062, 9019, 30069, 9008,
+    30076, 8998, 30083, 8987, 30090, 8977, 30097, 8966, 30104, 8956, 30111, 8945,
+    30117, 8935, 30124, 8924, 30131, 8914, 30138, 8903, 30145, 8892, 30152, 8882,
+    30158, 8871, 30165, 8861, 30172, 8850, 30179, 8840, 30186, 8829, 30192, 8818,
+    30199, 8808, 30206, 8797, 30213, 8787, 30219, 8776, 30226, 8765, 30233, 8755,
+    30240, 8744, 30246, 8734, 30253, 8723, 30260, 8712, 30266, 8702, 30273, 8691,
+    30280, 8680, 30286, 8670, 30293, 8659, 30300, 8648, 30306, 8638, 30313, 8627,
+    30319, 8616, 30326, 8606, 30333, 8595, 30339, 8584, 30346, 8573, 30352, 8563,
+    30359, 8552, 30365, 8541, 30372, 8531, 30379, 8520, 30385, 8509, 30392, 8498,
+    30398, 8488, 30405, 8477, 30411, 8466, 30418, 8455, 30424, 8445, 30431, 8434,
+    30437, 8423, 30443, 8412, 30450, 8401, 30456, 8391, 30463, 8380, 30469, 8369,
+    30476, 8358, 30482, 8347, 30488, 8337, 30495, 8326, 30501, 8315, 30508, 8304,
+    30514, 8293, 30520, 8283, 30527, 8272, 30533, 8261, 30539, 8250, 30546, 8239,
+    30552, 8228, 30558, 8217, 30565, 8207, 30571, 8196, 30577, 8185, 30583, 8174,
+    30590, 8163, 30596, 8152, 30602, 8141, 30608, 8130, 30615, 8119, 30621, 8108,
+    30627, 8098, 30633, 8087, 30640, 8076, 30646, 8065, 30652, 8054, 30658, 8043,
+    30664, 8032, 30670, 8021, 30677, 8010, 30683, 7999, 30689, 7988, 30695, 7977,
+    30701, 7966, 30707, 7955, 30713, 7944, 30719, 7933, 30725, 7922, 30731, 7911,
+    30738, 7900, 30744, 7889, 30750, 7878, 30756, 7867, 30762, 7856, 30768, 7845,
+    30774, 7834, 30780, 7823, 30786, 7812, 30792, 7801, 30798, 7790, 30804, 7779,
+    30810, 7768, 30816, 7757, 30822, 7746, 30827, 7734, 30833, 7723, 30839, 7712,
+    30845, 7701, 30851, 7690, 30857, 7679, 30863, 7668, 30869, 7657, 30875, 7646,
+    30881, 7635, 30886, 7623, 30892, 7612, 30898, 7601, 30904, 7590, 30910, 7579,
+    30915, 7568, 30921, 7557, 30927, 7545, 30933, 7534, 30939, 7523, 30944, 7512,
+    30950, 7501, 30956, 7490, 30962, 7478, 30967, 7467, 30973, 7456, 30979, 7445,
+    30985, 7434, 30990, 7423, 30996, 7411, 31002, 7400, 31007, 7389, 31013, 7378,
+    31019, 7366, 31024, 7355, 31030, 7344, 31035, 7333, 31041, 7321, 31047, 7310,
+    31052, 7299, 31058, 7288, 31064, 7276, 31069, 7265, 31075, 7254, 31080, 7243,
+    31086, 7231, 31091, 7220, 31097, 7209, 31102, 7198, 31108, 7186, 31113, 7175,
+    31119, 7164, 31124, 7152, 31130, 7141, 31135, 7130, 31141, 7118, 31146, 7107,
+    31152, 7096, 31157, 7084, 31163, 7073, 31168, 7062, 31173, 7050, 31179, 7039,
+    31184, 7028, 31190, 7016, 31195, 7005, 31200, 6994, 31206, 6982, 31211, 6971,
+    31216, 6960, 31222, 6948, 31227, 6937, 31232, 6925, 31238, 6914, 31243, 6903,
+    31248, 6891, 31254, 6880, 31259, 6868, 31264, 6857, 31269, 6846, 31275, 6834,
+    31280, 6823, 31285, 6811, 31290, 6800, 31295, 6788, 31301, 6777, 31306, 6766,
+    31311, 6754, 31316, 6743, 31321, 6731, 31327, 6720, 31332, 6708, 31337, 6697,
+    31342, 6685, 31347, 6674, 31352, 6662, 31357, 6651, 31362, 6639, 31368, 6628,
+    31373, 6616, 31378, 6605, 31383, 6593, 31388, 6582, 31393, 6570, 31398, 6559,
+    31403, 6547, 31408, 6536, 31413, 6524, 31418, 6513, 31423, 6501, 31428, 6490,
+    31433, 6478, 31438, 6467, 31443, 6455, 31448, 6444, 31453, 6432, 31458, 6420,
+    31462, 6409, 31467, 6397, 31472, 6386, 31477, 6374, 31482, 6363, 31487, 6351,
+    31492, 6339, 31497, 6328, 31502, 6316, 31506, 6305, 31511, 6293, 31516, 6281,
+    31521, 6270, 31526, 6258, 31530, 6247, 31535, 6235, 31540, 6223, 31545, 6212,
+    31550, 6200, 31554, 6189, 31559, 6177, 31564, 6165, 31568, 6154, 31573, 6142,
+    31578, 6130, 31583, 6119, 31587, 6107, 31592, 6095, 31597, 6084, 31601, 6072,
+    31606, 6060, 31611, 6049, 31615, 6037, 31620, 6025, 31624, 6014, 31629, 6002,
+    31634, 5990, 31638, 5979, 31643, 5967, 31647, 5955, 31652, 5943, 31657, 5932,
+    31661, 5920, 31666, 5908, 31670, 5897, 31675, 5885, 31679, 5873, 31684, 5861,
+    31688, 5850, 31693, 5838, 31697, 5826, 31702, 5814, 31706, 5803, 31710, 5791,
+    31715, 5779, 31719, 5767, 31724, 5756, 31728, 5744, 31733, 5732, 31737, 5720,
+    31741, 5708, 31746, 5697, 31750, 5685, 31754, 5673, 31759, 5661, 31763, 5650,
+    31767, 5638, 31772, 5626, 31776, 5614, 31780, 5602, 31785, 5591, 31789, 5579,
+    31793, 5567, 31798, 5555, 31802, 5543, 31806, 5531, 31810, 5520, 31814, 5508,
+    31819, 5496, 31823, 5484, 31827, 5472, 31831, 5460, 31835, 5449, 31840, 5437,
+    31844, 5425, 31848, 5413, 31852, 5401, 31856, 5389, 31860, 5377, 31865, 5366,
+    31869, 5354, 31873, 5342, 31877, 5330, 31881, 5318, 31885, 5306, 31889, 5294,
+    31893, 5282, 31897, 5270, 31901, 5259, 31905, 5247, 31909, 5235, 31913, 5223,
+    31917, 5211, 31921, 5199, 31925, 5187, 31929, 5175, 31933, 5163, 31937, 5151,
+    31941, 5139, 31945, 5127, 31949, 5115, 31953, 5104, 31957, 5092, 31961, 5080,
+    31965, 5068, 31968, 5056, 31972, 5044, 31976, 5032, 31980, 5020, 31984, 5008,
+    31988, 4996, 31992, 4984, 31995, 4972, 31999, 4960, 32003, 4948, 32007, 4936,
+    32011, 4924, 32014, 4912, 32018, 4900, 32022, 4888, 32026, 4876, 32029, 4864,
+    32033, 4852, 32037, 4840, 32040, 4828, 32044, 4816, 32048, 4804, 32052, 4792,
+    32055, 4780, 32059, 4768, 32063, 4756, 32066, 4744, 32070, 4732, 32073, 4720,
+    32077, 4708, 32081, 4696, 32084, 4684, 32088, 4672, 32091, 4660, 32095, 4648,
+    32099, 4636, 32102, 4624, 32106, 4612, 32109, 4599, 32113, 4587, 32116, 4575,
+    32120, 4563, 32123, 4551, 32127, 4539, 32130, 4527, 32134, 4515, 32137, 4503,
+    32141, 4491, 32144, 4479, 32147, 4467, 32151, 4455, 32154, 4442, 32158, 4430,
+    32161, 4418, 32164, 4406, 32168, 4394, 32171, 4382, 32175, 4370, 32178, 4358,
+    32181, 4346, 32185, 4333, 32188, 4321, 32191, 4309, 32194, 4297, 32198, 4285,
+    32201, 4273, 32204, 4261, 32208, 4249, 32211, 4236, 32214, 4224, 32217, 4212,
+    32221, 4200, 32224, 4188, 32227, 4176, 32230, 4164, 32233, 4151, 32237, 4139,
+    32240, 4127, 32243, 4115, 32246, 4103, 32249, 4091, 32252, 4078, 32255, 4066,
+    32259, 4054, 32262, 4042, 32265, 4030, 32268, 4018, 32271, 4005, 32274, 3993,
+    32277, 3981, 32280, 3969, 32283, 3957, 32286, 3944, 32289, 3932, 32292, 3920,
+    32295, 3908, 32298, 3896, 32301, 3883, 32304, 3871, 32307, 3859, 32310, 3847,
+    32313, 3835, 32316, 3822, 32319, 3810, 32322, 3798, 32325, 3786, 32328, 3773,
+    32330, 3761, 32333, 3749, 32336, 3737, 32339, 3724, 32342, 3712, 32345, 3700,
+    32348, 3688, 32350, 3676, 32353, 3663, 32356, 3651, 32359, 3639, 32362, 3627,
+    32364, 3614, 32367, 3602, 32370, 3590, 32373, 3577, 32375, 3565, 32378, 3553,
+    32381, 3541, 32384, 3528, 32386, 3516, 32389, 3504, 32392, 3492, 32394, 3479,
+    32397, 3467, 32400, 3455, 32402, 3442, 32405, 3430, 32408, 3418, 32410, 3406,
+    32413, 3393, 32415, 3381, 32418, 3369, 32421, 3356, 32423, 3344, 32426, 3332,
+    32428, 3320, 32431, 3307, 32433, 3295, 32436, 3283, 32438, 3270, 32441, 3258,
+    32443, 3246, 32446, 3233, 32448, 3221, 32451, 3209, 32453, 3196, 32456, 3184,
+    32458, 3172, 32460, 3159, 32463, 3147, 32465, 3135, 32468, 3122, 32470, 3110,
+    32472, 3098, 32475, 3085, 32477, 3073, 32480, 3061, 32482, 3048, 32484, 3036,
+    32487, 3024, 32489, 3011, 32491, 2999, 32493, 2987, 32496, 2974, 32498, 2962,
+    32500, 2949, 32503, 2937, 32505, 2925, 32507, 2912, 32509, 2900, 32512, 2888,
+    32514, 2875, 32516, 2863, 32518, 2851, 32520, 2838, 32522, 2826, 32525, 2813,
+    32527, 2801, 32529, 2789, 32531, 2776, 32533, 2764, 32535, 2752, 32537, 2739,
+    32540, 2727, 32542, 2714, 32544, 2702, 32546, 2690, 32548, 2677, 32550, 2665,
+    32552, 2652, 32554, 2640, 32556, 2628, 32558, 2615, 32560, 2603, 32562, 2590,
+    32564, 2578, 32566, 2566, 32568, 2553, 32570, 2541, 32572, 2528, 32574, 2516,
+    32576, 2503, 32578, 2491, 32579, 2479, 32581, 2466, 32583, 2454, 32585, 2441,
+    32587, 2429, 32589, 2416, 32591, 2404, 32593, 2392, 32594, 2379, 32596, 2367,
+    32598, 2354, 32600, 2342, 32602, 2329, 32603, 2317, 32605, 2305, 32607, 2292,
+    32609, 2280, 32610, 2267, 32612, 2255, 32614, 2242, 32616, 2230, 32617, 2217,
+    32619, 2205, 32621, 2193, 32622, 2180, 32624, 2168, 32626, 2155, 32627, 2143,
+    32629, 2130, 32631, 2118, 32632, 2105, 32634, 2093, 32635, 2080, 32637, 2068,
+    32639, 2055, 32640, 2043, 32642, 2031, 32643, 2018, 32645, 2006, 32646, 1993,
+    32648, 1981, 32649, 1968, 32651, 1956, 32652, 1943, 32654, 1931, 32655, 1918,
+    32657, 1906, 32658, 1893, 32660, 1881, 32661, 1868, 32663, 1856, 32664, 1843,
+    32665, 1831, 32667, 1818, 32668, 1806, 32670, 1793, 32671, 1781, 32672, 1768,
+    32674, 1756, 32675, 1743, 32676, 1731, 32678, 1718, 32679, 1706, 32680, 1693,
+    32682, 1681, 32683, 1668, 32684, 1656, 32685, 1643, 32687, 1631, 32688, 1618,
+    32689, 1606, 32690, 1593, 32692, 1581, 32693, 1568, 32694, 1556, 32695, 1543,
+    32696, 1531, 32697, 1518, 32699, 1506, 32700, 1493, 32701, 1481, 32702, 1468,
+    32703, 1456, 32704, 1443, 32705, 1431, 32707, 1418, 32708, 1406, 32709, 1393,
+    32710, 1381, 32711, 1368, 32712, 1356, 32713, 1343, 32714, 1331, 32715, 1318,
+    32716, 1306, 32717, 1293, 32718, 1280, 32719, 1268, 32720, 1255, 32721, 1243,
+    32722, 1230, 32723, 1218, 32724, 1205, 32725, 1193, 32725, 1180, 32726, 1168,
+    32727, 1155, 32728, 1143, 32729, 1130, 32730, 1118, 32731, 1105, 32732, 1092,
+    32732, 1080, 32733, 1067, 32734, 1055, 32735, 1042, 32736, 1030, 32736, 1017,
+    32737, 1005, 32738, 992, 32739, 980, 32739, 967, 32740, 955, 32741, 942,
+    32742, 929, 32742, 917, 32743, 904, 32744, 892, 32744, 879, 32745, 867,
+    32746, 854, 32746, 842, 32747, 829, 32748, 816, 32748, 804, 32749, 791,
+    32749, 779, 32750, 766, 32751, 754, 32751, 741, 32752, 729, 32752, 716,
+    32753, 704, 32753, 691, 32754, 678, 32754, 666, 32755, 653, 32755, 641,
+    32756, 628, 32756, 616, 32757, 603, 32757, 590, 32758, 578, 32758, 565,
+    32759, 553, 32759, 540, 32759, 528, 32760, 515, 32760, 503, 32761, 490,
+    32761, 477, 32761, 465, 32762, 452, 32762, 440, 32762, 427, 32763, 415,
+    32763, 402, 32763, 390, 32764, 377, 32764, 364, 32764, 352, 32764, 339,
+    32765, 327, 32765, 314, 32765, 302, 32765, 289, 32766, 276, 32766, 264,
+    32766, 251, 32766, 239, 32766, 226, 32767, 214, 32767, 201, 32767, 188,
+    32767, 176, 32767, 163, 32767, 151, 32767, 138, 32767, 126, 32767, 113,
+    32767, 101, 32767, 88, 32767, 75, 32767, 63, 32767, 50, 32767, 38,
+    32767, 25, 32767, 13, 32767, 0, 32767, -13, 32767, -25, 32767, -38,
+    32767, -50, 32767, -63, 32767, -75, 32767, -88, 32767, -101, 32767, -113,
+    32767, -126, 32767, -138, 32767, -151, 32767, -163, 32767, -176, 32767, -188,
+    32767, -201, 32767, -214, 32766, -226, 32766, -239, 32766, -251, 32766, -264,
+    32766, -276, 32765, -289, 32765, -302, 32765, -314, 32765, -327, 32764, -339,
+    32764, -352, 32764, -364, 32764, -377, 32763, -390, 32763, -402, 32763, -415,
+    32762, -427, 32762, -440, 32762, -452, 32761, -465, 32761, -477, 32761, -490,
+    32760, -503, 32760, -515, 32759, -528, 32759, -540, 32759, -553, 32758, -565,
+    32758, -578, 32757, -590, 32757, -603, 32756, -616, 32756, -628, 32755, -641,
+    32755, -653, 32754, -666, 32754, -678, 32753, -691, 32753, -704, 32752, -716,
+    32752, -729, 32751, -741, 32751, -754, 32750, -766, 32749, -779, 32749, -791,
+    32748, -804, 32748, -816, 32747, -829, 32746, -842, 32746, -854, 32745, -867,
+    32744, -879, 32744, -892, 32743, -904, 32742, -917, 32742, -929, 32741, -942,
+    32740, -955, 32739, -967, 32739, -980, 32738, -992, 32737, -1005, 32736, -1017,
+    32736, -1030, 32735, -1042, 32734, -1055, 32733, -1067, 32732, -1080, 32732, -1092,
+    32731, -1105, 32730, -1118, 32729, -1130, 32728, -1143, 32727, -1155, 32726, -1168,
+    32725, -1180, 32725, -1193, 32724, -1205, 32723, -1218, 32722, -1230, 32721, -1243,
+    32720, -1255, 32719, -1268, 32718, -1280, 32717, -1293, 32716, -1306, 32715, -1318,
+    32714, -1331, 32713, -1343, 32712, -1356, 32711, -1368, 32710, -1381, 32709, -1393,
+    32708, -1406, 32707, -1418, 32705, -1431, 32704, -1443, 32703, -1456, 32702, -1468,
+    32701, -1481, 32700, -1493, 32699, -1506, 32697, -1518, 32696, -1531, 32695, -1543,
+    32694, -1556, 32693, -1568, 32692, -1581, 32690, -1593, 32689, -1606, 32688, -1618,
+    32687, -1631, 32685, -1643, 32684, -1656, 32683, -1668, 32682, -1681, 32680, -1693,
+    32679, -1706, 32678, -1718, 32676, -1731, 32675, -1743, 32674, -1756, 32672, -1768,
+    32671, -1781, 32670, -1793, 32668, -1806, 32667, -1818, 32665, -1831, 32664, -1843,
+    32663, -1856, 32661, -1868, 32660, -1881, 32658, -1893, 32657, -1906, 32655, -1918,
+    32654, -1931, 32652, -1943, 32651, -1956, 32649, -1968, 32648, -1981, 32646, -1993,
+    32645, -2006, 32643, -2018, 32642, -2031, 32640, -2043, 32639, -2055, 32637, -2068,
+    32635, -2080, 32634, -2093, 32632, -2105, 32631, -2118, 32629, -2130, 32627, -2143,
+    32626, -2155, 32624, -2168, 32622, -2180, 32621, -2193, 32619, -2205, 32617, -2217,
+    32616, -2230, 32614, -2242, 32612, -2255, 32610, -2267, 32609, -2280, 32607, -2292,
+    32605, -2305, 32603, -2317, 32602, -2329, 32600, -2342, 32598, -2354, 32596, -2367,
+    32594, -2379, 32593, -2392, 32591, -2404, 32589, -2416, 32587, -2429, 32585, -2441,
+    32583, -2454, 32581, -2466, 32579, -2479, 32578, -2491, 32576, -2503, 32574, -2516,
+    32572, -2528, 32570, -2541, 32568, -2553, 32566, -2566, 32564, -2578, 32562, -2590,
+    32560, -2603, 32558, -2615, 32556, -2628, 32554, -2640, 32552, -2652, 32550, -2665,
+    32548, -2677, 32546, -2690, 32544, -2702, 32542, -2714, 32540, -2727, 32537, -2739,
+    32535, -2752, 32533, -2764, 32531, -2776, 32529, -2789, 32527, -2801, 32525, -2813,
+    32522, -2826, 32520, -2838, 32518, -2851, 32516, -2863, 32514, -2875, 32512, -2888,
+    32509, -2900, 32507, -2912, 32505, -2925, 32503, -2937, 32500, -2949, 32498, -2962,
+    32496, -2974, 32493, -2987, 32491, -2999, 32489, -3011, 32487, -3024, 32484, -3036,
+    32482, -3048, 32480, -3061, 32477, -3073, 32475, -3085, 32472, -3098, 32470, -3110,
+    32468, -3122, 32465, -3135, 32463, -3147, 32460, -3159, 32458, -3172, 32456, -3184,
+    32453, -3196, 32451, -3209, 32448, -3221, 32446, -3233, 32443, -3246, 32441, -3258,
+    32438, -3270, 32436, -3283, 32433, -3295, 32431, -3307, 32428, -3320, 32426, -3332,
+    32423, -3344, 32421, -3356, 32418, -3369, 32415, -3381, 32413, -3393, 32410, -3406,
+    32408, -3418, 32405, -3430, 32402, -3442, 32400, -3455, 32397, -3467, 32394, -3479,
+    32392, -3492, 32389, -3504, 32386, -3516, 32384, -3528, 32381, -3541, 32378, -3553,
+    32375, -3565, 32373, -3577, 32370, -3590, 32367, -3602, 32364, -3614, 32362, -3627,
+    32359, -3639, 32356, -3651, 32353, -3663, 32350, -3676, 32348, -3688, 32345, -3700,
+    32342, -3712, 32339, -3724, 32336, -3737, 32333, -3749, 32330, -3761, 32328, -3773,
+    32325, -3786, 32322, -3798, 32319, -3810, 32316, -3822, 32313, -3835, 32310, -3847,
+    32307, -3859, 32304, -3871, 32301, -3883, 32298, -3896, 32295, -3908, 32292, -3920,
+    32289, -3932, 32286, -3944, 32283, -3957, 32280, -3969, 32277, -3981, 32274, -3993,
+    32271, -4005, 32268, -4018, 32265, -4030, 32262, -4042, 32259, -4054, 32255, -4066,
+    32252, -4078, 32249, -4091, 32246, -4103, 32243, -4115, 32240, -4127, 32237, -4139,
+    32233, -4151, 32230, -4164, 32227, -4176, 32224, -4188, 32221, -4200, 32217, -4212,
+    32214, -4224, 32211, -4236, 32208, -4249, 32204, -4261, 32201, -4273, 32198, -4285,
+    32194, -4297, 32191, -4309, 32188, -4321, 32185, -4333, 32181, -4346, 32178, -4358,
+    32175, -4370, 32171, -4382, 32168, -4394, 32164, -4406, 32161, -4418, 32158, -4430,
+    32154, -4442, 32151, -4455, 32147, -4467, 32144, -4479, 32141, -4491, 32137, -4503,
+    32134, -4515, 32130, -4527, 32127, -4539, 32123, -4551, 32120, -4563, 32116, -4575,
+    32113, -4587, 32109, -4599, 32106, -4612, 32102, -4624, 32099, -4636, 32095, -4648,
+    32091, -4660, 32088, -4672, 32084, -4684, 32081, -4696, 32077, -4708, 32073, -4720,
+    32070, -4732, 32066, -4744, 32063, -4756, 32059, -4768, 32055, -4780, 32052, -4792,
+    32048, -4804, 32044, -4816, 32040, -4828, 32037, -4840, 32033, -4852, 32029, -4864,
+    32026, -4876, 32022, -4888, 32018, -4900, 32014, -4912, 32011, -4924, 32007, -4936,
+    32003, -4948, 31999, -4960, 31995, -4972, 31992, -4984, 31988, -4996, 31984, -5008,
+    31980, -5020, 31976, -5032, 31972, -5044, 31968, -5056, 31965, -5068, 31961, -5080,
+    31957, -5092, 31953, -5104, 31949, -5115, 31945, -5127, 31941, -5139, 31937, -5151,
+    31933, -5163, 31929, -5175, 31925, -5187, 31921, -5199, 31917, -5211, 31913, -5223,
+    31909, -5235, 31905, -5247, 31901, -5259, 31897, -5270, 31893, -5282, 31889, -5294,
+    31885, -5306, 31881, -5318, 31877, -5330, 31873, -5342, 31869, -5354, 31865, -5366,
+    31860, -5377, 31856, -5389, 31852, -5401, 31848, -5413, 31844, -5425, 31840, -5437,
+    31835, -5449, 31831, -5460, 31827, -5472, 31823, -5484, 31819, -5496, 31814, -5508,
+    31810, -5520, 31806, -5531, 31802, -5543, 31798, -5555, 31793, -5567, 31789, -5579,
+    31785, -5591, 31780, -5602, 31776, -5614, 31772, -5626, 31767, -5638, 31763, -5650,
+    31759, -5661, 31754, -5673, 31750, -5685, 31746, -5697, 31741, -5708, 31737, -5720,
+    31733, -5732, 31728, -5744, 31724, -5756, 31719, -5767, 31715, -5779, 31710, -5791,
+    31706, -5803, 31702, -5814, 31697, -5826, 31693, -5838, 31688, -5850, 31684, -5861,
+    31679, -5873, 31675, -5885, 31670, -5897, 31666, -5908, 31661, -5920, 31657, -5932,
+    31652, -5943, 31647, -5955, 31643, -5967, 31638, -5979, 31634, -5990, 31629, -6002,
+    31624, -6014, 31620, -6025, 31615, -6037, 31611, -6049, 31606, -6060, 31601, -6072,
+    31597, -6084, 31592, -6095, 31587, -6107, 31583, -6119, 31578, -6130, 31573, -6142,
+    31568, -6154, 31564, -6165, 31559, -6177, 31554, -6189, 31550, -6200, 31545, -6212,
+    31540, -6223, 31535, -6235, 31530, -6247, 31526, -6258, 31521, -6270, 31516, -6281,
+    31511, -6293, 31506, -6305, 31502, -6316, 31497, -6328, 31492, -6339, 31487, -6351,
+    31482, -6363, 31477, -6374, 31472, -6386, 31467, -6397, 31462, -6409, 31458, -6420,
+    31453, -6432, 31448, -6444, 31443, -6455, 31438, -6467, 31433, -6478, 31428, -6490,
+    31423, -6501, 31418, -6513, 31413, -6524, 31408, -6536, 31403, -6547, 31398, -6559,
+    31393, -6570, 31388, -6582, 31383, -6593, 31378, -6605, 31373, -6616, 31368, -6628,
+    31362, -6639, 31357, -6651, 31352, -6662, 31347, -6674, 31342, -6685, 31337, -6697,
+    31332, -6708, 31327, -6720, 31321, -6731, 31316, -6743, 31311, -6754, 31306, -6766,
+    31301, -6777, 31295, -6788, 31290, -6800, 31285, -6811, 31280, -6823, 31275, -6834,
+    31269, -6846, 31264, -6857, 31259, -6868, 31254, -6880, 31248, -6891, 31243, -6903,
+    31238, -6914, 31232, -6925, 31227, -6937, 31222, -6948, 31216, -6960, 31211, -6971,
+    31206, -6982, 31200, -6994, 31195, -7005, 31190, -7016, 31184, -7028, 31179, -7039,
+    31173, -7050, 31168, -7062, 31163, -7073, 31157, -7084, 31152, -7096, 31146, -7107,
+    31141, -7118, 31135, -7130, 31130, -7141, 31124, -7152, 31119, -7164, 31113, -7175,
+    31108, -7186, 31102, -7198, 31097, -7209, 31091, -7220, 31086, -7231, 31080, -7243,
+    31075, -7254, 31069, -7265, 31064, -7276, 31058, -7288, 31052, -7299, 31047, -7310,
+    31041, -7321, 31035, -7333, 31030, -7344, 31024, -7355, 31019, -7366, 31013, -7378,
+    31007, -7389, 31002, -7400, 30996, -7411, 30990, -7423, 30985, -7434, 30979, -7445,
+    30973, -7456, 30967, -7467, 30962, -7478, 30956, -7490, 30950, -7501, 30944, -7512,
+    30939, -7523, 30933, -7534, 30927, -7545, 30921, -7557, 30915, -7568, 30910, -7579,
+    30904, -7590, 30898, -7601, 30892, -7612, 30886, -7623, 30881, -7635, 30875, -7646,
+    30869, -7657, 30863, -7668, 30857, -7679, 30851, -7690, 30845, -7701, 30839, -7712,
+    30833, -7723, 30827, -7734, 30822, -7746, 30816, -7757, 30810, -7768, 30804, -7779,
+    30798, -7790, 30792, -7801, 30786, -7812, 30780, -7823, 30774, -7834, 30768, -7845,
+    30762, -7856, 30756, -7867, 30750, -7878, 30744, -7889, 30738, -7900, 30731, -7911,
+    30725, -7922, 30719, -7933, 30713, -7944, 30707, -7955, 30701, -7966, 30695, -7977,
+    30689, -7988, 30683, -7999, 30677, -8010, 30670, -8021, 30664, -8032, 30658, -8043,
+    30652, -8054, 30646, -8065, 30640, -8076, 30633, -8087, 30627, -8098, 30621, -8108,
+    30615, -8119, 30608, -8130, 30602, -8141, 30596, -8152, 30590, -8163, 30583, -8174,
+    30577, -8185, 30571, -8196, 30565, -8207, 30558, -8217, 30552, -8228, 30546, -8239,
+    30539, -8250, 30533, -8261, 30527, -8272, 30520, -8283, 30514, -8293, 30508, -8304,
+    30501, -8315, 30495, -8326, 30488, -8337, 30482, -8347, 30476, -8358, 30469, -8369,
+    30463, -8380, 30456, -8391, 30450, -8401, 30443, -8412, 30437, -8423, 30431, -8434,
+    30424, -8445, 30418, -8455, 30411, -8466, 30405, -8477, 30398, -8488, 30392, -8498,
+    30385, -8509, 30379, -8520, 30372, -8531, 30365, -8541, 30359, -8552, 30352, -8563,
+    30346, -8573, 30339, -8584, 30333, -8595, 30326, -8606, 30319, -8616, 30313, -8627,
+    30306, -8638, 30300, -8648, 30293, -8659, 30286, -8670, 30280, -8680, 30273, -8691,
+    30266, -8702, 30260, -8712, 30253, -8723, 30246, -8734, 30240, -8744, 30233, -8755,
+    30226, -8765, 30219, -8776, 30213, -8787, 30206, -8797, 30199, -8808, 30192, -8818,
+    30186, -8829, 30179, -8840, 30172, -8850, 30165, -8861, 30158, -8871, 30152, -8882,
+    30145, -8892, 30138, -8903, 30131, -8914, 30124, -8924, 30117, -8935, 30111, -8945,
+    30104, -8956, 30097, -8966, 30090, -8977, 30083, -8987, 30076, -8998, 30069, -9008,
+    30062, -9019, 30055, -9029, 30049, -9040, 30042, -9050, 30035, -9061, 30028, -9071,
+    30021, -9082, 30014, -9092, 30007, -9102, 30000, -9113, 29993, -9123, 29986, -9134,
+    29979, -9144, 29972, -9155, 29965, -9165, 29958, -9175, 29951, -9186, 29944, -9196,
+    29937, -9207, 29930, -9217, 29922, -9227, 29915, -9238, 29908, -9248, 29901, -9259,
+    29894, -9269, 29887, -9279, 29880, -9290, 29873, -9300, 29866, -9310, 29858, -9321,
+    29851, -9331, 29844, -9341, 29837, -9352, 29830, -9362, 29823, -9372, 29815, -9383,
+    29808, -9393, 29801, -9403, 29794, -9413, 29787, -9424, 29779, -9434, 29772, -9444,
+    29765, -9455, 29758, -9465, 29750, -9475, 29743, -9485, 29736, -9496, 29728, -9506,
+    29721, -9516, 29714, -9526, 29707, -9537, 29699, -9547, 29692, -9557, 29685, -9567,
+    29677, -9577, 29670, -9588, 29663, -9598, 29655, -9608, 29648, -9618, 29640, -9628,
+    29633, -9638, 29626, -9649, 29618, -9659, 29611, -9669, 29603, -9679, 29596, -9689,
+    29589, -9699, 29581, -9709, 29574, -9720, 29566, -9730, 29559, -9740, 29551, -9750,
+    29544, -9760, 29536, -9770, 29529, -9780, 29521, -9790, 29514, -9800, 29506, -9810,
+    29499, -9820, 29491, -9830, 29484, -9841, 29476, -9851, 29469, -9861, 29461, -9871,
+    29453, -9881, 29446, -9891, 29438, -9901, 29431, -9911, 29423, -9921, 29415, -9931,
+    29408, -9941, 29400, -9951, 29392, -9961, 29385, -9971, 29377, -9981, 29370, -9991,
+    29362, -10001, 29354, -10010, 29347, -10020, 29339, -10030, 29331, -10040, 29323, -10050,
+    29316, -10060, 29308, -10070, 29300, -10080, 29293, -10090, 29285, -10100, 29277, -10110,
+    29269, -10120, 29262, -10129, 29254, -10139, 29246, -10149, 29238, -10159, 29230, -10169,
+    29223, -10179, 29215, -10189, 29207, -10198, 29199, -10208, 29191, -10218, 29183, -10228,
+    29176, -10238, 29168, -10248, 29160, -10257, 29152, -10267, 29144, -10277, 29136, -10287,
+    29128, -10296, 29120, -10306, 29113, -10316, 29105, -10326, 29097, -10336, 29089, -10345,
+    29081, -10355, 29073, -10365, 29065, -10374, 29057, -10384, 29049, -10394, 29041, -10404,
+    29033, -10413, 29025, -10423, 29017, -10433, 29009, -10442, 29001, -10452, 28993, -10462,
+    28985, -10471, 28977, -10481, 28969, -10491, 28961, -10500, 28953, -10510, 28945, -10520,
+    28937, -10529, 28929, -10539, 28921, -10549, 28912, -10558, 28904, -10568, 28896, -10577,
+    28888, -10587, 28880, -10597, 28872, -10606, 28864, -10616, 28856, -10625, 28847, -10635,
+    28839, -10644, 28831, -10654, 28823, -10663, 28815, -10673, 28807, -10683, 28798, -10692,
+    28790, -10702, 28782, -10711, 28774, -10721, 28765, -10730, 28757, -10740, 28749, -10749,
+    28741, -10759, 28732, -10768, 28724, -10778, 28716, -10787, 28708, -10796, 28699, -10806,
+    28691, -10815, 28683, -10825, 28674, -10834, 28666, -10844, 28658, -10853, 28650, -10862,
+    28641, -10872, 28633, -10881, 28624, -10891, 28616, -10900, 28608, -10909, 28599, -10919,
+    28591, -10928, 28583, -10937, 28574, -10947, 28566, -10956, 28557, -10966, 28549, -10975,
+    28541, -10984, 28532, -10994, 28524, -11003, 28515, -11012, 28507, -11021, 28498, -11031,
+    28490, -11040, 28481, -11049, 28473, -11059, 28464, -11068, 28456, -11077, 28448, -11086,
+    28439, -11096, 28430, -11105, 28422, -11114, 28413, -11123, 28405, -11133, 28396, -11142,
+    28388, -11151, 28379, -11160, 28371, -11169, 28362, -11179, 28354, -11188, 28345, -11197,
+    28336, -11206, 28328, -11215, 28319, -11224, 28311, -11234, 28302, -11243, 28293, -11252,
+    28285, -11261, 28276, -11270, 28267, -11279, 28259, -11288, 28250, -11297, 28241, -11307,
+    28233, -11316, 28224, -11325, 28215, -11334, 28207, -11343, 28198, -11352, 28189, -11361,
+    28181, -11370, 28172, -11379, 28163, -11388, 28154, -11397, 28146, -11406, 28137, -11415,
+    28128, -11424, 28119, -11433, 28111, -11442, 28102, -11451, 28093, -11460, 28084, -11469,
+    28075, -11478, 28067, -11487, 28058, -11496, 28049, -11505, 28040, -11514, 28031, -11523,
+    28022, -11532, 28014, -11541, 28005, -11550, 27996, -11559, 27987, -11567, 27978, -11576,
+    27969, -11585, 27960, -11594, 27951, -11603, 27943, -11612, 27934, -11621, 27925, -11630,
+    27916, -11638, 27907, -11647, 27898, -11656, 27889, -11665, 27880, -11674, 27871, -11683,
+    27862, -11691, 27853, -11700, 27844, -11709, 27835, -11718, 27826, -11727, 27817, -11735,
+    27808, -11744, 27799, -11753, 27790, -11762, 27781, -11770, 27772, -11779, 27763, -11788,
+    27754, -11797, 27745, -11805, 27736, -11814, 27727, -11823, 27718, -11831, 27709, -11840,
+    27700, -11849, 27691, -11857, 27681, -11866, 27672, -11875, 27663, -11883, 27654, -11892,
+    27645, -11901, 27636, -11909, 27627, -11918, 27618, -11927, 27608, -11935, 27599, -11944,
+    27590, -11952, 27581, -11961, 27572, -11970, 27563, -11978, 27553, -11987, 27544, -11995,
+    27535, -12004, 27526, -12012, 27517, -12021, 27507, -12029, 27498, -12038, 27489, -12046,
+    27480, -12055, 27470, -12064, 27461, -12072, 27452, -12080, 27443, -12089, 27433, -12097,
+    27424, -12106, 27415, -12114, 27405, -12123, 27396, -12131, 27387, -12140, 27378, -12148,
+    27368, -12157, 27359, -12165, 27350, -12173, 27340, -12182, 27331, -12190, 27321, -12199,
+    27312, -12207, 27303, -12215, 27293, -12224, 27284, -12232, 27275, -12240, 27265, -12249,
+    27256, -12257, 27246, -12266, 27237, -12274, 27228, -12282, 27218, -12290, 27209, -12299,
+    27199, -12307, 27190, -12315, 27180, -12324, 27171, -12332, 27162, -12340, 27152, -12348,
+    27143, -12357, 27133, -12365, 27124, -12373, 27114, -12381, 27105, -12390, 27095, -12398,
+    27086, -12406, 27076, -12414, 27067, -12423, 27057, -12431, 27047, -12439, 27038, -12447,
+    27028, -12455, 27019, -12463, 27009, -12472, 27000, -12480, 26990, -12488, 26981, -12496,
+    26971, -12504, 26961, -12512, 26952, -12520, 26942, -12528, 26933, -12537, 26923, -12545,
+    26913, -12553, 26904, -12561, 26894, -12569, 26884, -12577, 26875, -12585, 26865, -12593,
+    26855, -12601, 26846, -12609, 26836, -12617, 26826, -12625, 26817, -12633, 26807, -12641,
+    26797, -12649, 26788, -12657, 26778, -12665, 26768, -12673, 26758, -12681, 26749, -12689,
+    26739, -12697, 26729, -12705, 26720, -12713, 26710, -12721, 26700, -12729, 26690, -12736,
+    26680, -12744, 26671, -12752, 26661, -12760, 26651, -12768, 26641, -12776, 26632, -12784,
+    26622, -12792, 26612, -12799, 26602, -12807, 26592, -12815, 26582, -12823, 26573, -12831,
+    26563, -12839, 26553, -12846, 26543, -12854, 26533, -12862, 26523, -12870, 26513, -12878,
+    26504, -12885, 26494, -12893, 26484, -12901, 26474, -12909, 26464, -12916, 26454, -12924,
+    26444, -12932, 26434, -12939, 26424, -12947, 26414, -12955, 26404, -12963, 26394, -12970,
+    26385, -12978, 26375, -12986, 26365, -12993, 26355, -13001, 26345, -13008, 26335, -13016,
+    26325, -13024, 26315, -13031, 26305, -13039, 26295, -13047, 26285, -13054, 26275, -13062,
+    26265, -13069, 26255, -13077, 26245, -13085, 26235, -13092, 26225, -13100, 26214, -13107,
+    26204, -13115, 26194, -13122, 26184, -13130, 26174, -13137, 26164, -13145, 26154, -13152,
+    26144, -13160, 26134, -13167, 26124, -13175, 26114, -13182, 26104, -13190, 26093, -13197,
+    26083, -13205, 26073, -13212, 26063, -13219, 26053, -13227, 26043, -13234, 26033, -13242,
+    26022, -13249, 26012, -13256, 26002, -13264, 25992, -13271, 25982, -13279, 25972, -13286,
+    25961, -13293, 25951, -13301, 25941, -13308, 25931, -13315, 25921, -13323, 25910, -13330,
+    25900, -13337, 25890, -13344, 25880, -13352, 25869, -13359, 25859, -13366, 25849, -13374,
+    25839, -13381, 25828, -13388, 25818, -13395, 25808, -13403, 25797, -13410, 25787, -13417,
+    25777, -13424, 25767, -13431, 25756, -13439, 25746, -13446, 25736, -13453, 25725, -13460,
+    25715, -13467, 25705, -13474, 25694, -13482, 25684, -13489, 25674, -13496, 25663, -13503,
+    25653, -13510, 25643, -13517, 25632, -13524, 25622, -13531, 25611, -13538, 25601, -13546,
+    25591, -13553, 25580, -13560, 25570, -13567, 25559, -13574, 25549, -13581, 25539, -13588,
+    25528, -13595, 25518, -13602, 25507, -13609, 25497, -13616, 25486, -13623, 25476, -13630,
+    25466, -13637, 25455, -13644, 25445, -13651, 25434, -13658, 25424, -13665, 25413, -13671,
+    25403, -13678, 25392, -13685, 25382, -13692, 25371, -13699, 25361, -13706, 25350, -13713,
+    25340, -13720, 25329, -13727, 25319, -13733, 25308, -13740, 25298, -13747, 25287, -13754,
+    25276, -13761, 25266, -13768, 25255, -13774, 25245, -13781, 25234, -13788, 25224, -13795,
+    25213, -13802, 25202, -13808, 25192, -13815, 25181, -13822, 25171, -13829, 25160, -13835,
+    25149, -13842, 25139, -13849, 25128, -13856, 25118, -13862, 25107, -13869, 25096, -13876,
+    25086, -13882, 25075, -13889, 25064, -13896, 25054, -13902, 25043, -13909, 25032, -13916,
+    25022, -13922, 25011, -13929, 25000, -13935, 24990, -13942, 24979, -13949, 24968, -13955,
+    24957, -13962, 24947, -13968, 24936, -13975, 24925, -13981, 24915, -13988, 24904, -13995,
+    24893, -14001, 24882, -14008, 24872, -14014, 24861, -14021, 24850, -14027, 24839, -14034,
+    24829, -14040, 24818, -14047, 24807, -14053, 24796, -14059, 24785, -14066, 24775, -14072,
+    24764, -14079, 24753, -14085, 24742, -14092, 24731, -14098, 24721, -14104, 24710, -14111,
+    24699, -14117, 24688, -14124, 24677, -14130, 24667, -14136, 24656, -14143, 24645, -14149,
+    24634, -14155, 24623, -14162, 24612, -14168, 24601, -14174, 24591, -14181, 24580, -14187,
+    24569, -14193, 24558, -14199, 24547, -14206, 24536, -14212, 24525, -14218, 24514, -14224,
+    24503, -14231, 24492, -14237, 24482, -14243, 24471, -14249, 24460, -14256, 24449, -14262,
+    24438, -14268, 24427, -14274, 24416, -14280, 24405, -14286, 24394, -14293, 24383, -14299,
+    24372, -14305, 24361, -14311, 24350, -14317, 24339, -14323, 24328, -14329, 24317, -14335,
+    24306, -14341, 24295, -14347, 24284, -14354, 24273, -14360, 24262, -14366, 24251, -14372,
+    24240, -14378, 24229, -14384, 24218, -14390, 24207, -14396, 24196, -14402, 24185, -14408,
+    24174, -14414, 24163, -14420, 24152, -14426, 24141, -14432, 24130, -14438, 24118, -14443,
+    24107, -14449, 24096, -14455, 24085, -14461, 24074, -14467, 24063, -14473, 24052, -14479,
+    24041, -14485, 24030, -14491, 24019, -14497, 24007, -14502, 23996, -14508, 23985, -14514,
+    23974, -14520, 23963, -14526, 23952, -14531, 23941, -14537, 23929, -14543, 23918, -14549,
+    23907, -14555, 23896, -14560, 23885, -14566, 23874, -14572, 23862, -14578, 23851, -14583,
+    23840, -14589, 23829, -14595, 23818, -14601, 23807, -14606, 23795, -14612, 23784, -14618,
+    23773, -14623, 23762, -14629, 23750, -14635, 23739, -14640, 23728, -14646, 23717, -14651,
+    23705, -14657, 23694, -14663, 23683, -14668, 23672, -14674, 23660, -14680, 23649, -14685,
+    23638, -14691, 23627, -14696, 23615, -14702, 23604, -14707, 23593, -14713, 23582, -14718,
+    23570, -14724, 23559, -14729, 23548, -14735, 23536, -14740, 23525, -14746, 23514, -14751,
+    23502, -14757, 23491, -14762, 23480, -14768, 23468, -14773, 23457, -14779, 23446, -14784,
+    23434, -14789, 23423, -14795, 23412, -14800, 23400, -14806, 23389, -14811, 23378, -14816,
+    23366, -14822, 23355, -14827, 23344, -14832, 23332, -14838, 23321, -14843, 23309, -14848,
+    23298, -14854, 23287, -14859, 23275, -14864, 23264, -14870, 23252, -14875, 23241, -14880,
+    23230, -14885, 23218, -14891, 23207, -14896, 23195, -14901, 23184, -14906, 23172, -14911,
+    23161, -14917, 23150, -14922, 23138, -14927, 23127, -14932, 23115, -14937, 23104, -14943,
+    23092, -14948, 23081, -14953, 23069, -14958, 23058, -14963, 23046, -14968, 23035, -14973,
+    23023, -14978, 23012, -14984, 23000, -14989, 22989, -14994, 22977, -14999, 22966, -15004,
+    22954, -15009, 22943, -15014, 22931, -15019, 22920, -15024, 22908, -15029, 22897, -15034,
+    22885, -15039, 22874, -15044, 22862, -15049, 22851, -15054, 22839, -15059, 22828, -15064,
+    22816, -15069, 22804, -15074, 22793, -15078, 22781, -15083, 22770, -15088, 22758, -15093,
+    22747, -15098, 22735, -15103, 22723, -15108, 22712, -15113, 22700, -15118, 22689, -15122,
+    22677, -15127, 22665, -15132, 22654, -15137, 22642, -15142, 22631, -15146, 22619, -15151,
+    22607, -15156, 22596, -15161, 22584, -15166, 22573, -15170, 22561, -15175, 22549, -15180,
+    22538, -15184, 22526, -15189, 22514, -15194, 22503, -15199, 22491, -15203, 22479, -15208,
+    22468, -15213, 22456, -15217, 22444, -15222, 22433, -15227, 22421, -15231, 22409, -15236,
+    22398, -15240, 22386, -15245, 22374, -15250, 22363, -15254, 22351, -15259, 22339, -15263,
+    22327, -15268, 22316, -15273, 22304, -15277, 22292, -15282, 22281, -15286, 22269, -15291,
+    22257, -15295, 22245, -15300, 22234, -15304, 22222, -15309, 22210, -15313, 22198, -15318,
+    22187, -15322, 22175, -15326, 22163, -15331, 22151, -15335, 22140, -15340, 22128, -15344,
+    22116, -15349, 22104, -15353, 22092, -15357, 22081, -15362, 22069, -15366, 22057, -15370,
+    22045, -15375, 22034, -15379, 22022, -15383, 22010, -15388, 21998, -15392, 21986, -15396,
+    21975, -15401, 21963, -15405, 21951, -15409, 21939, -15414, 21927, -15418, 21915, -15422,
+    21904, -15426, 21892, -15430, 21880, -15435, 21868, -15439, 21856, -15443, 21844, -15447,
+    21833, -15451, 21821, -15456, 21809, -15460, 21797, -15464, 21785, -15468, 21773, -15472,
+    21761, -15476, 21750, -15481, 21738, -15485, 21726, -15489, 21714, -15493, 21702, -15497,
+    21690, -15501, 21678, -15505, 21666, -15509, 21654, -15513, 21643, -15517, 21631, -15521,
+    21619, -15525, 21607, -15529, 21595, -15533, 21583, -15537, 21571, -15541, 21559, -15545,
+    21547, -15549, 21535, -15553, 21523, -15557, 21511, -15561, 21499, -15565, 21488, -15569,
+    21476, -15573, 21464, -15577, 21452, -15581, 21440, -15584, 21428, -15588, 21416, -15592,
+    21404, -15596, 21392, -15600, 21380, -15604, 21368, -15608, 21356, -15611, 21344, -15615,
+    21332, -15619, 21320, -15623, 21308, -15627, 21296, -15630, 21284, -15634, 21272, -15638,
+    21260, -15642, 21248, -15645, 21236, -15649, 21224, -15653, 21212, -15656, 21200, -15660,
+    21188, -15664, 21176, -15668, 21164, -15671, 21152, -15675, 21140, -15679, 21128, -15682,
+    21116, -15686, 21104, -15689, 21092, -15693, 21080, -15697, 21068, -15700, 21056, -15704,
+    21044, -15707, 21032, -15711, 21020, -15715, 21008, -15718, 20996, -15722, 20983, -15725,
+    20971, -15729, 20959, -15732, 20947, -15736, 20935, -15739, 20923, -15743, 20911, -15746,
+    20899, -15750, 20887, -15753, 20875, -15757, 20863, -15760, 20851, -15763, 20839, -15767,
+    20826, -15770, 20814, -15774, 20802, -15777, 20790, -15780, 20778, -15784, 20766, -15787,
+    20754, -15791, 20742, -15794, 20730, -15797, 20717, -15801, 20705, -15804, 20693, -15807,
+    20681, -15810, 20669, -15814, 20657, -15817, 20645, -15820, 20633, -15824, 20620, -15827,
+    20608, -15830, 20596, -15833, 20584, -15837, 20572, -15840, 20560, -15843, 20548, -15846,
+    20535, -15849, 20523, -15853, 20511, -15856, 20499, -15859, 20487, -15862, 20475, -15865,
+    20462, -15868, 20450, -15871, 20438, -15875, 20426, -15878, 20414, -15881, 20402, -15884,
+    20389, -15887, 20377, -15890, 20365, -15893, 20353, -15896, 20341, -15899, 20328, -15902,
+    20316, -15905, 20304, -15908, 20292, -15911, 20280, -15914, 20267, -15917, 20255, -15920,
+    20243, -15923, 20231, -15926, 20219, -15929, 20206, -15932, 20194, -15935, 20182, -15938,
+    20170, -15941, 20157, -15944, 20145, -15946, 20133, -15949, 20121, -15952, 20108, -15955,
+    20096, -15958, 20084, -15961, 20072, -15964, 20060, -15966, 20047, -15969, 20035, -15972,
+    20023, -15975, 20011, -15978, 19998, -15980, 19986, -15983, 19974, -15986, 19961, -15989,
+    19949, -15991, 19937, -15994, 19925, -15997, 19912, -16000, 19900, -16002, 19888, -16005,
+    19876, -16008, 19863, -16010, 19851, -16013, 19839, -16016, 19826, -16018, 19814, -16021,
+    19802, -16024, 19790, -16026, 19777, -16029, 19765, -16031, 19753, -16034, 19740, -16037,
+    19728, -16039, 19716, -16042, 19704, -16044, 19691, -16047, 19679, -16049, 19667, -16052,
+    19654, -16054, 19642, -16057, 19630, -16059, 19617, -16062, 19605, -16064, 19593, -16067,
+    19580, -16069, 19568, -16072, 19556, -16074, 19543, -16076, 19531, -16079, 19519, -16081,
+    19506, -16084, 19494, -16086, 19482, -16088, 19469, -16091, 19457, -16093, 19445, -16096,
+    19432, -16098, 19420, -16100, 19408, -16103, 19395, -16105, 19383, -16107, 19371, -16109,
+    19358, -16112, 19346, -16114, 19333, -16116, 19321, -16119, 19309, -16121, 19296, -16123,
+    19284, -16125, 19272, -16128, 19259, -16130, 19247, -16132, 19235, -16134, 19222, -16136,
+    19210, -16138, 19197, -16141, 19185, -16143, 19173, -16145, 19160, -16147, 19148, -16149,
+    19136, -16151, 19123, -16153, 19111, -16156, 19098, -16158, 19086, -16160, 19074, -16162,
+    19061, -16164, 19049, -16166, 19036, -16168, 19024, -16170, 19012, -16172, 18999, -16174,
+    18987, -16176, 18974, -16178, 18962, -16180, 18950, -16182, 18937, -16184, 18925, -16186,
+    18912, -16188, 18900, -16190, 18887, -16192, 18875, -16194, 18863, -16195, 18850, -16197,
+    18838, -16199, 18825, -16201, 18813, -16203, 18800, -16205, 18788, -16207, 18776, -16209,
+    18763, -16210, 18751, -16212, 18738, -16214, 18726, -16216, 18713, -16218, 18701, -16219,
+    18689, -16221, 18676, -16223, 18664, -16225, 18651, -16226, 18639, -16228, 18626, -16230,
+    18614, -16232, 18601, -16233, 18589, -16235, 18577, -16237, 18564, -16238, 18552, -16240,
+    18539, -16242, 18527, -16243, 18514, -16245, 18502, -16247, 18489, -16248, 18477, -16250,
+    18464, -16251, 18452, -16253, 18439, -16255, 18427, -16256, 18415, -16258, 18402, -16259,
+    18390, -16261, 18377, -16262, 18365, -16264, 18352, -16265, 18340, -16267, 18327, -16268,
+    18315, -16270, 18302, -16271, 18290, -16273, 18277, -16274, 18265, -16276, 18252, -16277,
+    18240, -16279, 18227, -16280, 18215, -16281, 18202, -16283, 18190, -16284, 18177, -16286,
+    18165, -16287, 18152, -16288, 18140, -16290, 18127, -16291, 18115, -16292, 18102, -16294,
+    18090, -16295, 18077, -16296, 18065, -16298, 18052, -16299, 18040, -16300, 18027, -16301,
+    18015, -16303, 18002, -16304, 17990, -16305, 17977, -16306, 17965, -16308, 17952, -16309,
+    17940, -16310, 17927, -16311, 17915, -16312, 17902, -16313, 17890, -16315, 17877, -16316,
+    17865, -16317, 17852, -16318, 17840, -16319, 17827, -16320, 17815, -16321, 17802, -16323,
+    17790, -16324, 17777, -16325, 17765, -16326, 17752, -16327, 17740, -16328, 17727, -16329,
+    17715, -16330, 17702, -16331, 17690, -16332, 17677, -16333, 17664, -16334, 17652, -16335,
+    17639, -16336, 17627, -16337, 17614, -16338, 17602, -16339, 17589, -16340, 17577, -16341,
+    17564, -16341, 17552, -16342, 17539, -16343, 17527, -16344, 17514, -16345, 17502, -16346,
+    17489, -16347, 17476, -16348, 17464, -16348, 17451, -16349, 17439, -16350, 17426, -16351,
+    17414, -16352, 17401, -16352, 17389, -16353, 17376, -16354, 17364, -16355, 17351, -16355,
+    17339, -16356, 17326, -16357, 17313, -16358, 17301, -16358, 17288, -16359, 17276, -16360,
+    17263, -16360, 17251, -16361, 17238, -16362, 17226, -16362, 17213, -16363, 17200, -16364,
+    17188, -16364, 17175, -16365, 17163, -16365, 17150, -16366, 17138, -16367, 17125, -16367,
+    17113, -16368, 17100, -16368, 17088, -16369, 17075, -16369, 17062, -16370, 17050, -16370,
+    17037, -16371, 17025, -16371, 17012, -16372, 17000, -16372, 16987, -16373, 16974, -16373,
+    16962, -16374, 16949, -16374, 16937, -16375, 16924, -16375, 16912, -16375, 16899, -16376,
+    16887, -16376, 16874, -16377, 16861, -16377, 16849, -16377, 16836, -16378, 16824, -16378,
+    16811, -16378, 16799, -16379, 16786, -16379, 16774, -16379, 16761, -16380, 16748, -16380,
+    16736, -16380, 16723, -16380, 16711, -16381, 16698, -16381, 16686, -16381, 16673, -16381,
+    16660, -16382, 16648, -16382, 16635, -16382, 16623, -16382, 16610, -16382, 16598, -16383,
+    16585, -16383, 16572, -16383, 16560, -16383, 16547, -16383, 16535, -16383, 16522, -16383,
+    16510, -16384, 16497, -16384, 16485, -16384, 16472, -16384, 16459, -16384, 16447, -16384,
+    16434, -16384, 16422, -16384, 16409, -16384, 16397, -16384,
+};
+#endif
+
+#endif /* !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_FFT_ALLOW_TABLES) */
@@ -0,0 +1,471 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+本地AI服务模拟服务器（仅用于设备端联调和性能验证）
+用途：不依赖云端，校验设备发出的HTTP请求字节，并返回可控的响应
+
+使用方法：
+1. 无需第三方依赖，直接运行: python mock_ai_server.py [端口，默认8090]
+2. 设备端执行对应的msh测试命令，例如:
+   ai_test init 0 test_token test_cuid http://你的PC_IP:8090/stt
+   ai_test stt_wire http://你的PC_IP:8090/stt
+
+   ai_test tts_stream "http://你的PC_IP:8090/tts?bytes=96000&rate=64000&b64=1"
+   ai_test tts_stream "http://你的PC_IP:8090/tts?bytes=96000&sr=24000&wav=1"
+
+   vp_test http://你的PC_IP:8090 3 4
+   echo_bench http://你的PC_IP:8090
+   chat_bench http://你的PC_IP:8090 5 300 40
+
+   web_bench http://你的PC_IP:8090/ping 100
+   web_bench upload http://你的PC_IP:8090/upload 96
+
+接口：
+  POST /stt   校验STT请求体：按设备端同样的规则重建JSON，逐字节比较
+  POST /tts   返回确定性的锯齿波PCM，可选Base64编码，按指定速率分段发送
+              参数: bytes=PCM字节数 rate=发送速率(字节/秒，0不限速)
+                    b64=1 Base64编码 delay=首字节前的延时(ms，模拟合成耗时)
+                    char_ms/char_bytes: 按请求文本的字数追加延时和PCM长度
+                    sr=采样率(Content-Type中的rate=，默认16000) wav=1 加44字节WAV头
+                    codec=adpcm 返回WAV IMA ADPCM（PCM的1/4），未指定时按请求JSON的format
+  POST /chat  OpenAI格式的对话回复，参数: sentences=句数 delay=回复前的延时(ms)
+                    token_ms=每个片段（2个字）的生成耗时(ms) format=baidu 百度格式（result字段）
+              请求体带 "stream":true 时以SSE（chunked）逐段返回，第一段在delay后发出，
+              之后每token_ms一段；否则等全部生成完（delay + 片段数 x token_ms）一次返回
+              校验请求体的messages（合法JSON，历史中用户和AI交替），日志中显示带上的历史轮数
+  POST /upload 校验multipart/form-data上传：文件内容应与 test_pcm 一致
+  GET  /ping  返回pong，用于测量连接复用
+  GET  /stats 返回服务器端统计的连接数和请求数
+
+任意接口加 chunked=N 参数时响应体改用 Transfer-Encoding: chunked，每块N字节
+
+连接支持HTTP/1.1 keep-alive，空闲超过 KEEPALIVE_TIMEOUT 秒由服务器关闭（与云端行为一致）
+"""
+
+import base64
+import json
+import logging
+import socket
+import socketserver
+import sys
+import struct
+import threading
+import time
+from urllib.parse import parse_qs
+
+logging.basicConfig(
+    level=logging.INFO,
+    format='%(asctime)s [%(levelname)s] %(message)s'
+)
+logger = logging.getLogger(__name__)
+
+DEFAULT_PORT = 8090
+KEEPALIVE_TIMEOUT = 10
+
+# 统计信息（多线程访问）
+stats_lock = threading.Lock()
+stats = {
+    'connections': 0,
+    'requests': 0,
+}
+
+
+def test_pcm(length):
+    """与设备端 ai_test stt_wire 生成的PCM完全一致"""
+    return bytes(((i * 31 + 7) & 0xFF) for i in range(length))
+
+
+def expected_stt_body(body):
+    """按设备端的JSON格式重建期望的请求体"""
+    req = json.loads(body.decode('utf-8'))
+
+    if 'speech' in req:
+        # 百度格式
+        audio_len = req['len']
+        speech = base64.b64encode(test_pcm(audio_len)).decode('ascii')
+        return ('{"format":"pcm","rate":16000,"channel":1,'
+                '"cuid":"%s","token":"%s","speech":"%s","len":%d}'
+                % (req['cuid'], req['token'], speech, audio_len)).encode('utf-8')
+    if 'common' in req:
+        # 讯飞格式（请求中没有长度字段，按实际解码长度重建）
+        audio_len = len(base64.b64decode(req['data']['audio']))
+        audio = base64.b64encode(test_pcm(audio_len)).decode('ascii')
+        return ('{"common":{"app_id":"%s"},"business":{"language":"zh_cn",'
+                '"domain":"iat","accent":"mandarin"},"data":{"status":2,'
+                '"format":"audio/L16;rate=16000","encoding":"raw",'
+                '"audio":"%s"}}' % (req['common']['app_id'], audio)).encode('utf-8')
+    # 通用格式
+    audio_len = req['audio_len']
+    audio = base64.b64encode(test_pcm(audio_len)).decode('ascii')
+    return ('{"audio_data":"%s","audio_len":%d,"format":"pcm",'
+            '"sample_rate":16000,"channels":1}' % (audio, audio_len)).encode('utf-8')
+
+
+def handle_stt(headers, body, query):
+    """POST /stt：逐字节校验请求体"""
+    try:
+        expected = expected_stt_body(body)
+    except (ValueError, KeyError) as e:
+        return 400, 'application/json', json.dumps({'error': 'bad json: %s' % e}).encode()
+
+    if body == expected:
+        result = 'wire ok %d bytes' % len(body)
+    else:
+        offset = next((i for i, (a, b) in enumerate(zip(body, expected)) if a != b),
+                      min(len(body), len(expected)))
+        result = 'wire mismatch at %d (got %d, expected %d bytes)' % (offset, len(body), len(expected))
+
+    logger.info('STT: %s', result)
+    return 200, 'application/json', json.dumps({'result': [result]}).encode('utf-8')
+
+
+def tts_pcm(length):
+    """与设备端 ai_test tts_stream 校验的锯齿波一致：第i个样本 = ((i*64) & 0x1FFF) - 4096"""
+    samples = length // 2
+    return struct.pack('<%dh' % samples, *((((i * 64) & 0x1FFF) - 4096) for i in range(samples)))
+
+
+def paced(payload, rate, delay_ms, chunk=1024):
+    """按速率分段输出响应体，模拟云端边合成边返回"""
+    if delay_ms:
+        time.sleep(delay_ms / 1000.0)
+    for offset in range(0, len(payload), chunk):
+        yield payload[offset:offset + chunk]
+        if rate:
+            time.sleep(chunk / float(rate))
+
+
+def tts_text(body):
+    """从各厂商格式的TTS请求中取出待合成的文本"""
+    try:
+        req = json.loads(body.decode('utf-8'))
+    except ValueError:
+        return ''
+    if 'tex' in req:
+        return req['tex']
+    if 'data' in req:
+        return req['data'].get('text', '')
+    return req.get('text', '')
+
+
+def wav_header(length, sample_rate):
+    """16bit单声道PCM的标准44字节WAV头"""
+    return (b'RIFF' + struct.pack('<I', 36 + length) + b'WAVE' +
+            b'fmt ' + struct.pack('<IHHIIHH', 16, 1, 1, sample_rate, sample_rate * 2, 2, 16) +
+            b'data' + struct.pack('<I', length))
+
+
+IMA_STEP = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66,
+    73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449,
+    494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272,
+    2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493,
+    10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767]
+IMA_INDEX = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def ima_adpcm_wav(pcm, sample_rate, block_align=256):
+    """WAV IMA ADPCM（单声道）：每块4字节块头（第一个样本、步长索引）+ 低4位在前的码；
+    与CPython audioop.lin2adpcm 的量化相同（设备端 dec_bench 的参考数据由它生成）"""
+    samples = struct.unpack('<%dh' % (len(pcm) // 2), pcm)
+    per_block = (block_align - 4) * 2 + 1
+    out = bytearray()
+    index = 0
+    for start in range(0, len(samples), per_block):
+        block = samples[start:start + per_block]
+        pred = block[0]
+        out += struct.pack('<hBB', pred, index, 0)
+        codes = []
+        for sample in block[1:]:
+            step = IMA_STEP[index]
+            diff = sample - pred
+            code = 8 if diff < 0 else 0
+            diff = abs(diff)
+            vpdiff = step >> 3
+            if diff >= step:
+                code |= 4
+                diff -= step
+                vpdiff += step
+            step >>= 1
+            if diff >= step:
+                code |= 2
+                diff -= step
+                vpdiff += step
+            step >>= 1
+            if diff >= step:
+                code |= 1
+                vpdiff += step
+            pred = max(-32768, min(32767, pred - vpdiff if code & 8 else pred + vpdiff))
+            index = max(0, min(88, index + IMA_INDEX[code & 7]))
+            codes.append(code)
+        if len(codes) % 2:
+            codes.append(0)
+        out += bytes(codes[i] | (codes[i + 1] << 4) for i in range(0, len(codes), 2))
+    fmt = struct.pack('<HHIIHHHH', 0x11, 1, sample_rate, sample_rate * block_align // per_block,
+                      block_align, 4, 2, per_block)
+    return (b'RIFF' + struct.pack('<I', 4 + 8 + len(fmt) + 8 + len(out)) + b'WAVE' +
+            b'fmt ' + struct.pack('<I', len(fmt)) + fmt +
+            b'data' + struct.pack('<I', len(out)) + bytes(out))
+
+
+def tts_format(body):
+    """通用格式请求中的 format 字段；模拟服务器只能生成pcm和adpcm"""
+    try:
+        fmt = json.loads(body.decode('utf-8')).get('format', 'pcm')
+    except (ValueError, AttributeError):
+        return 'pcm'
+    return fmt if fmt == 'adpcm' else 'pcm'
+
+
+def handle_tts(headers, body, query):
+    """POST /tts：返回锯齿波PCM（原始或Base64），按速率分段发送"""
+    chars = len(tts_text(body))
+    length = (int(query.get('bytes', ['0' if 'char_bytes' in query else '96000'])[0]) +
+              int(query.get('char_bytes', ['0'])[0]) * chars) & ~1
+    rate = int(query.get('rate', ['0'])[0])
+    delay_ms = int(query.get('delay', ['0'])[0]) + int(query.get('char_ms', ['0'])[0]) * chars
+    sample_rate = int(query.get('sr', ['16000'])[0])
+    pcm = tts_pcm(length)
+
+    codec = query.get('codec', [tts_format(body)])[0]
+    if codec == 'adpcm':
+        pcm = ima_adpcm_wav(pcm, sample_rate)
+    elif query.get('wav', ['0'])[0] == '1':
+        pcm = wav_header(length, sample_rate) + pcm
+
+    if query.get('b64', ['0'])[0] == '1':
+        payload, ctype = base64.b64encode(pcm), 'text/plain'
+    elif codec == 'adpcm':
+        payload, ctype = pcm, 'audio/wav'
+    else:
+        payload, ctype = pcm, 'audio/L16;rate=%d' % sample_rate
+
+    logger.info('TTS: %d PCM bytes, %s %d body bytes, rate %d B/s, delay %d ms',
+                length, codec, len(payload), rate, delay_ms)
+    return 200, ctype, (len(payload), paced(payload, rate, delay_ms))
+
+
+CHAT_SENTENCES = ['好的，我来帮你看看。', '今天天气晴，气温二十度左右。',
+                  '适合出门散步。', '记得带上水杯！', '还有什么需要帮忙的吗？']
+
+
+def chat_events(pieces, baidu, delay_ms, token_ms):
+    """流式回复的SSE事件，与云端一样按生成节奏逐个发出"""
+    time.sleep(delay_ms / 1000.0)
+    yield b': keep-alive\n\n'
+    if not baidu:
+        yield b'data: {"choices":[{"index":0,"delta":{"role":"assistant","content":""}}]}\n\n'
+    for i, piece in enumerate(pieces):
+        if i:
+            time.sleep(token_ms / 1000.0)
+        if baidu:
+            event = {'result': piece, 'is_end': i == len(pieces) - 1}
+        else:
+            event = {'choices': [{'index': 0, 'delta': {'content': piece}}]}
+        yield b'data: ' + json.dumps(event, ensure_ascii=False).encode('utf-8') + b'\n\n'
+    if not baidu:
+        yield b'data: {"choices":[{"index":0,"delta":{},"finish_reason":"stop"}]}\n\ndata: [DONE]\n\n'
+
+
+def handle_chat(headers, body, query):
+    """POST /chat：返回指定句数的回复，delay和token_ms模拟模型生成耗时，可选SSE流式返回"""
+    count = int(query.get('sentences', ['3'])[0])
+    delay_ms = int(query.get('delay', ['0'])[0])
+    token_ms = int(query.get('token_ms', ['0'])[0])
+    baidu = query.get('format', [''])[0] == 'baidu'
+    reply = ''.join(CHAT_SENTENCES[i % len(CHAT_SENTENCES)] for i in range(count))
+    pieces = [reply[i:i + 2] for i in range(0, len(reply), 2)]
+
+    # 请求体须是合法JSON，messages以用户的提问结尾，历史中用户和AI交替
+    try:
+        request = json.loads(body.decode('utf-8'))
+        stream = request.get('stream') is True
+        messages = request['messages']
+        roles = [m['role'] for m in messages if m['role'] != 'system']
+        valid = roles and roles[-1] == 'user' and all(
+            r == ('user' if i % 2 == 0 else 'assistant') for i, r in enumerate(roles))
+    except (ValueError, KeyError, TypeError):
+        valid = False
+    if not valid:
+        logger.warning('Chat: bad request body %r', body[:200])
+        return 400, 'application/json', b'{"error":"bad messages"}'
+
+    logger.info('Chat: %d messages (%d history turns), %d sentences, %d chars%s',
+                len(messages), (len(roles) - 1) // 2, count, len(reply),
+                ', streamed in %d pieces' % len(pieces) if stream else '')
+    if stream:
+        # 长度未知，以chunked发送，每个事件一块
+        return 200, 'text/event-stream', (None, chat_events(pieces, baidu, delay_ms, token_ms))
+
+    time.sleep((delay_ms + token_ms * len(pieces)) / 1000.0)
+    if baidu:
+        result = {'result': reply}
+    else:
+        result = {'choices': [{'message': {'role': 'assistant', 'content': reply}}]}
+    return 200, 'application/json', json.dumps(result, ensure_ascii=False).encode('utf-8')
+
+
+def handle_upload(headers, body, query):
+    """POST /upload：解析multipart/form-data，逐字节校验文件内容"""
+    ctype = headers.get('content-type', '')
+    boundary = ctype.partition('boundary=')[2].strip('"').encode('latin-1')
+    if not boundary:
+        return 400, 'application/json', b'{"error":"no boundary"}'
+
+    opening = b'--' + boundary + b'\r\n'
+    closing = b'\r\n--' + boundary + b'--\r\n'
+    head_end = body.find(b'\r\n\r\n')
+    if not body.startswith(opening) or not body.endswith(closing) or head_end < 0:
+        return 400, 'application/json', b'{"error":"bad multipart framing"}'
+
+    part_headers = body[len(opening):head_end].decode('latin-1')
+    data = body[head_end + 4:len(body) - len(closing)]
+    ok = data == test_pcm(len(data)) and 'filename=' in part_headers
+    logger.info('Upload: %d file bytes, %s', len(data), 'ok' if ok else 'mismatch')
+    return 200, 'application/json', json.dumps({'received': len(data), 'ok': ok}).encode('utf-8')
+
+
+def handle_ping(headers, body, query):
+    """GET/POST /ping：最小的响应，用于测量连接开销"""
+    return 200, 'text/plain', b'pong'
+
+
+def handle_stats(headers, body, query):
+    """GET /stats：服务器端统计"""
+    with stats_lock:
+        return 200, 'application/json', json.dumps(stats).encode('utf-8')
+
+
+ROUTES = {
+    ('GET', '/ping'): handle_ping,
+    ('POST', '/ping'): handle_ping,
+    ('GET', '/stats'): handle_stats,
+    ('POST', '/stt'): handle_stt,
+    ('POST', '/tts'): handle_tts,
+    ('POST', '/chat'): handle_chat,
+    ('POST', '/upload'): handle_upload,
+}
+
+
+class MockHandler(socketserver.StreamRequestHandler):
+    """手写的HTTP/1.1处理，便于精确观察线上的字节"""
+
+    def setup(self):
+        super().setup()
+        self.request.settimeout(KEEPALIVE_TIMEOUT)
+        # 响应头和响应体分开写出，关闭Nagle，否则keep-alive连接上每个响应都要等客户端的延迟ACK
+        self.request.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        with stats_lock:
+            stats['connections'] += 1
+        logger.info('connection from %s:%d', *self.client_address)
+
+    def read_body(self, headers):
+        if headers.get('transfer-encoding', '').lower() == 'chunked':
+            body = b''
+            while True:
+                size = int(self.rfile.readline().split(b';')[0].strip(), 16)
+                if size == 0:
+                    self.rfile.readline()
+                    return body
+                body += self.rfile.read(size)
+                self.rfile.readline()
+        length = int(headers.get('content-length', '0'))
+        return self.rfile.read(length)
+
+    def handle(self):
+        while True:
+            try:
+                request_line = self.rfile.readline()
+            except socket.timeout:
+                logger.info('idle connection from %s:%d closed', *self.client_address)
+                return
+            if not request_line:
+                return
+            try:
+                method, target, _ = request_line.decode('latin-1').split(' ', 2)
+            except ValueError:
+                return
+
+            headers = {}
+            while True:
+                line = self.rfile.readline().decode('latin-1')
+                if line in ('\r\n', '\n', ''):
+                    break
+                key, _, value = line.partition(':')
+                headers[key.strip().lower()] = value.strip()
+
+            body = self.read_body(headers)
+            with stats_lock:
+                stats['requests'] += 1
+
+            path, _, query = target.partition('?')
+            route = ROUTES.get((method, path))
+            if route is None:
+                status, ctype, payload = 404, 'text/plain', b'not found'
+            else:
+                status, ctype, payload = route(headers, body, parse_qs(query))
+
+            # 响应体可以是bytes，也可以是 (长度, 分段迭代器) 以便分段发送，长度为None时用chunked逐段发送
+            if isinstance(payload, bytes):
+                length, chunks = len(payload), [payload]
+            else:
+                length, chunks = payload
+
+            keep_alive = headers.get('connection', '').lower() == 'keep-alive'
+            chunk_size = int(parse_qs(query).get('chunked', ['0'])[0])
+            if length is None and not chunk_size:
+                chunk_size = 1 << 30
+            if chunk_size:
+                framing = 'Transfer-Encoding: chunked\r\n'
+            else:
+                framing = 'Content-Length: %d\r\n' % length
+            self.wfile.write(('HTTP/1.1 %d %s\r\n'
+                              'Content-Type: %s\r\n'
+                              '%s'
+                              'Connection: %s\r\n'
+                              '\r\n' % (status, 'OK' if status == 200 else 'ERR', ctype,
+                                        framing, 'keep-alive' if keep_alive else 'close')).encode('latin-1'))
+            for chunk in chunks:
+                if chunk_size:
+                    # 按chunk_size重新分块，与分段发送的节奏无关
+                    chunk = b''.join(b'%x\r\n%s\r\n' % (len(chunk[i:i + chunk_size]), chunk[i:i + chunk_size])
+                                     for i in range(0, len(chunk), chunk_size))
+                self.wfile.write(chunk)
+                self.wfile.flush()
+            if chunk_size:
+                self.wfile.write(b'0\r\n\r\n')
+                self.wfile.flush()
+
+            if not keep_alive:
+                return
+
+
+class MockServer(socketserver.ThreadingTCPServer):
+    allow_reuse_address = True
+    daemon_threads = True
+
+
+def get_local_ip():
+    """获取本机局域网IP"""
+    try:
+        s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        s.connect(('8.8.8.8', 80))
+        ip = s.getsockname()[0]
+        s.close()
+        return ip
+    except OSError:
+        return 'localhost'
+
+
+if __name__ == '__main__':
+    port = int(sys.argv[1]) if len(sys.argv) > 1 else DEFAULT_PORT
+    print('=' * 70)
+    print('本地AI模拟服务器: http://%s:%d' % (get_local_ip(), port))
+    for method, path in ROUTES:
+        print('  %-5s %s' % (method, path))
+    print('=' * 70)
+    with MockServer(('0.0.0.0', port), MockHandler) as server:
+        try:
+            server.serve_forever()
+        except KeyboardInterrupt:
+            print('\n连接数: %(connections)d, 请求数: %(requests)d' % stats)
@@ -522,6 +522,7 @@
 
 /* External Libraries */
 
+#define ART_PI_USING_CMSIS_DSP_NN
 /* end of External Libraries */
 #define FIRMWARE_EXEC_USING_OSPI_FLASH
 #define RT_STUDIO_BUILT_IN